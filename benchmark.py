@@ -11,6 +11,37 @@ import time
 from pathlib import Path
 
 
+def run_batch(solver_path: Path, words: list[str], threads: int) -> None:
+    start = time.perf_counter()
+    result = subprocess.run(
+        [str(solver_path), "solve-batch", "-", "--threads", str(threads)],
+        input="\n".join(words) + "\n",
+        stdout=subprocess.PIPE,
+        stderr=subprocess.PIPE,
+        text=True,
+    )
+    elapsed = time.perf_counter() - start
+
+    failures = []
+    guesses: list[int] = []
+    for line in result.stdout.splitlines():
+        fields = line.split()
+        if len(fields) < 2 or not fields[1].isdigit():
+            failures.append(line)
+        else:
+            guesses.append(int(fields[1]))
+    if failures or len(guesses) != len(words):
+        for line in failures:
+            print(f"Failed solving: {line}", file=sys.stderr)
+        if result.stderr.strip():
+            print(result.stderr.strip(), file=sys.stderr)
+        sys.exit(result.returncode or 1)
+
+    print(f"Solved {len(words)} words in {elapsed:.4f} s (one process)")
+    print(f"Average solve time: {elapsed / len(words):.6f} s")
+    print(f"Average guesses: {statistics.fmean(guesses):.4f}")
+
+
 def main() -> None:
     parser = argparse.ArgumentParser(description=__doc__)
     parser.add_argument(
@@ -19,6 +50,17 @@ def main() -> None:
         default=10,
         help="Number of target words to benchmark (default: 10).",
     )
+    parser.add_argument(
+        "--batch",
+        action="store_true",
+        help="Solve every target in one `solver solve-batch` process instead of one process per word.",
+    )
+    parser.add_argument(
+        "--threads",
+        type=int,
+        default=1,
+        help="Worker threads for --batch (default: 1, 0 = all cores).",
+    )
     args = parser.parse_args()
 
     repo_root = Path(__file__).resolve().parent
@@ -40,6 +82,10 @@ def main() -> None:
 
     words = words[: args.limit]
 
+    if args.batch:
+        run_batch(solver_path, words, args.threads)
+        return
+
     timings: list[float] = []
 
     for word in words:
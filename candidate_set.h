@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Fixed-width bitsets over the answer list (bit i = answer i) used by the
+// lookup generator to track the candidates still consistent with a node.
+
+inline size_t candidate_words_for(size_t universe) { return (universe + 63) / 64; }
+
+// Non-owning view of a bitset. Only words in [lo, hi) may be non-zero, so
+// scanning or clearing a small deep-tree state never touches the rest of
+// the row.
+struct CandidateSet {
+  uint64_t *bits = nullptr;
+  uint32_t lo = 0;
+  uint32_t hi = 0;
+  uint32_t count = 0;
+
+  bool empty() const { return count == 0; }
+  size_t size() const { return count; }
+
+  // Index of the lowest member; the set must not be empty.
+  size_t first() const {
+    uint32_t w = lo;
+    while (bits[w] == 0)
+      ++w;
+    return size_t{w} * 64 + static_cast<size_t>(__builtin_ctzll(bits[w]));
+  }
+
+  // Calls fn(index) for every member in ascending order.
+  template <typename Fn> void for_each(Fn &&fn) const {
+    for (uint32_t w = lo; w < hi; ++w) {
+      for (uint64_t word = bits[w]; word; word &= word - 1) {
+        fn(size_t{w} * 64 + static_cast<size_t>(__builtin_ctzll(word)));
+      }
+    }
+  }
+
+  // Members must be added in ascending order.
+  void push_back(size_t idx) {
+    const uint32_t w = static_cast<uint32_t>(idx / 64);
+    if (count == 0)
+      lo = w;
+    hi = w + 1;
+    bits[w] |= uint64_t{1} << (idx % 64);
+    ++count;
+  }
+
+  void clear() {
+    if (count != 0) {
+      std::memset(bits + lo, 0, (hi - lo) * sizeof(uint64_t));
+    }
+    lo = hi = count = 0;
+  }
+};
+
+// Scratch for one node being built: the 243 child sets it is partitioned
+// into (one allocation, reused across nodes through PartitionArenaPool) and
+// the node's own members as an index list for the guess search.
+class PartitionArena {
+public:
+  explicit PartitionArena(size_t universe)
+      : stride_(candidate_words_for(universe)), storage_(243 * stride_, 0) {
+    for (size_t fb = 0; fb < 243; ++fb) {
+      children_[fb].bits = storage_.data() + fb * stride_;
+    }
+  }
+
+  // Empties every child touched by the previous partition.
+  void reset() {
+    for (auto &child : children_) {
+      child.clear();
+    }
+  }
+
+  CandidateSet &child(size_t fb) { return children_[fb]; }
+  const CandidateSet &child(size_t fb) const { return children_[fb]; }
+
+  std::vector<size_t> indices;
+
+private:
+  size_t stride_;
+  std::vector<uint64_t> storage_;
+  std::array<CandidateSet, 243> children_;
+};
+
+// Hands out arenas to concurrently running subtree builds. Arenas are
+// recycled, so a run allocates about one per node being built at once
+// rather than one per state.
+class PartitionArenaPool {
+public:
+  class Lease {
+  public:
+    Lease(PartitionArenaPool &pool, std::unique_ptr<PartitionArena> arena)
+        : pool_(pool), arena_(std::move(arena)) {}
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+    ~Lease() { pool_.release(std::move(arena_)); }
+
+    PartitionArena &operator*() const { return *arena_; }
+
+  private:
+    PartitionArenaPool &pool_;
+    std::unique_ptr<PartitionArena> arena_;
+  };
+
+  explicit PartitionArenaPool(size_t universe) : universe_(universe) {}
+
+  Lease acquire() {
+    std::unique_ptr<PartitionArena> arena;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!free_.empty()) {
+        arena = std::move(free_.back());
+        free_.pop_back();
+      }
+    }
+    if (!arena) {
+      arena = std::make_unique<PartitionArena>(universe_);
+    }
+    return Lease(*this, std::move(arena));
+  }
+
+private:
+  void release(std::unique_ptr<PartitionArena> arena) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(std::move(arena));
+  }
+
+  size_t universe_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<PartitionArena>> free_;
+};
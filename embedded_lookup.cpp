@@ -0,0 +1,40 @@
+#include "embedded_lookup.h"
+
+#if !defined(SOLVER_EMBEDDED_LOOKUP_PATH)
+#error "embedded_lookup.cpp needs SOLVER_EMBEDDED_LOOKUP_PATH (set by CMake)"
+#endif
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "SOLVER_EMBED_LOOKUP needs a GNU-compatible assembler for .incbin"
+#endif
+
+// The file is pulled in by the assembler, so a tree of tens of megabytes
+// costs no more to compile than an empty one. The 64-byte alignment keeps
+// every uint32/uint64 field at the alignment it has in a mapped file.
+#if defined(__APPLE__)
+#define SOLVER_ASM_NAME(name) "_" #name
+#define SOLVER_ASM_RODATA ".const_data"
+#define SOLVER_ASM_RESTORE ".text"
+#else
+#define SOLVER_ASM_NAME(name) #name
+#define SOLVER_ASM_RODATA ".section .rodata"
+#define SOLVER_ASM_RESTORE ".previous"
+#endif
+
+extern "C" const uint8_t solver_embedded_lookup_begin[];
+extern "C" const uint8_t solver_embedded_lookup_end[];
+
+__asm__(SOLVER_ASM_RODATA "\n"
+        ".balign 64\n"
+        ".globl " SOLVER_ASM_NAME(solver_embedded_lookup_begin) "\n"
+        SOLVER_ASM_NAME(solver_embedded_lookup_begin) ":\n"
+        ".incbin \"" SOLVER_EMBEDDED_LOOKUP_PATH "\"\n"
+        ".globl " SOLVER_ASM_NAME(solver_embedded_lookup_end) "\n"
+        SOLVER_ASM_NAME(solver_embedded_lookup_end) ":\n"
+        SOLVER_ASM_RESTORE "\n");
+
+const uint8_t *embedded_lookup_data() { return solver_embedded_lookup_begin; }
+
+size_t embedded_lookup_size() {
+  return static_cast<size_t>(solver_embedded_lookup_end -
+                             solver_embedded_lookup_begin);
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// The lookup tree compiled into the binary when CMake is configured with
+// -DSOLVER_EMBED_LOOKUP=ON (see DESIGN.md). Only linked into builds that
+// define SOLVER_EMBEDDED_LOOKUP; the image is a complete lookup_<start>.bin.
+const uint8_t *embedded_lookup_data();
+size_t embedded_lookup_size();
@@ -0,0 +1,332 @@
+#include "entropy_fallback.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+namespace {
+
+struct FallbackOverlayHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t word_count;
+  uint32_t answer_count;
+  uint64_t word_hash;
+  uint64_t answer_hash;
+};
+static_assert(sizeof(FallbackOverlayHeader) == 32,
+              "FallbackOverlayHeader must be 32 bytes");
+
+struct FallbackOverlayRecord {
+  uint8_t count;
+  uint8_t reserved[7];
+  uint64_t pairs[kFallbackMaxHistory]; // (guess << 8) | feedback, ascending
+  uint64_t guess;
+};
+static_assert(sizeof(FallbackOverlayRecord) == 64,
+              "FallbackOverlayRecord must be 64 bytes");
+
+constexpr uint32_t kFallbackOverlayVersion = 1;
+
+void update_max(std::atomic<uint64_t> &max, uint64_t value) {
+  uint64_t seen = max.load(std::memory_order_relaxed);
+  while (value > seen &&
+         !max.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+  }
+}
+
+} // namespace
+
+size_t EntropyFallback::KeyHash::operator()(const Key &key) const {
+  uint64_t h = 0x9E3779B97F4A7C15ull ^ key.count;
+  for (size_t i = 0; i < key.count; ++i) {
+    h ^= key.pairs[i] + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+  }
+  return static_cast<size_t>(h);
+}
+
+EntropyFallback::EntropyFallback(const std::vector<encoded_word> &words,
+                                 const std::vector<encoded_word> &answers,
+                                 const FeedbackTable *feedback_table,
+                                 const LookupTables &lookups,
+                                 std::chrono::microseconds budget)
+    : words_(words), answers_(answers),
+      feedback_table_(feedback_table && feedback_table->loaded()
+                          ? feedback_table
+                          : nullptr),
+      lookups_(lookups), budget_(budget) {}
+
+EntropyFallback::~EntropyFallback() {
+  {
+    std::lock_guard<std::mutex> lock(refine_mutex_);
+    stopping_.store(true, std::memory_order_relaxed);
+  }
+  refine_ready_.notify_all();
+  if (refiner_.joinable()) {
+    refiner_.join();
+  }
+}
+
+bool EntropyFallback::make_key(const SolutionStep *history, size_t count,
+                               Key &key) {
+  if (count > kFallbackMaxHistory) {
+    return false;
+  }
+  key.count = static_cast<uint8_t>(count);
+  for (size_t i = 0; i < count; ++i) {
+    key.pairs[i] = (static_cast<uint64_t>(history[i].guess) << 8) |
+                   static_cast<uint64_t>(history[i].feedback);
+  }
+  std::sort(key.pairs.begin(), key.pairs.begin() + count);
+  return true;
+}
+
+encoded_word EntropyFallback::next_guess(const SolutionStep *history,
+                                         size_t count, bool final_turn) {
+  Key key;
+  if (!make_key(history, count, key)) {
+    return 0;
+  }
+  if (!final_turn) {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    const auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return it->second.guess;
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  GuessSearchBudget budget{start + budget_};
+  const encoded_word guess = compute(key, final_turn, budget);
+  const bool expired = budget.expired;
+  const uint64_t ns = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+  computed_.fetch_add(1, std::memory_order_relaxed);
+  compute_ns_total_.fetch_add(ns, std::memory_order_relaxed);
+  update_max(compute_ns_max_, ns);
+  if (expired) {
+    budget_expired_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // Final-turn picks and dead ends are cheap to redo and not worth a slot.
+  if (guess == 0 || final_turn) {
+    return guess;
+  }
+  // A truncated guess is served as is until the refiner replaces it; it
+  // depends on this run's budget and load, so it is never persisted.
+  bool inserted = false;
+  bool upgraded = false;
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    const auto [it, added] = entries_.emplace(key, Entry{guess, !expired});
+    // A concurrent miss may have left a provisional entry; a complete
+    // result replaces it.
+    if (!added && !expired && !it->second.complete) {
+      it->second = Entry{guess, true};
+      upgraded = true;
+    }
+    inserted = added || upgraded;
+  }
+  if (inserted) {
+    if (expired) {
+      schedule_refinement(key);
+    } else {
+      append_overlay(key, guess);
+    }
+  }
+  return guess;
+}
+
+void EntropyFallback::schedule_refinement(const Key &key) {
+  std::lock_guard<std::mutex> lock(refine_mutex_);
+  if (stopping_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  refine_queue_.push_back(key);
+  if (!refiner_.joinable()) {
+    refiner_ = std::thread([this] { refine_loop(); });
+  }
+  refine_ready_.notify_one();
+}
+
+void EntropyFallback::refine_loop() {
+  while (true) {
+    Key key;
+    {
+      std::unique_lock<std::mutex> lock(refine_mutex_);
+      refine_ready_.wait(lock, [this] {
+        return stopping_.load(std::memory_order_relaxed) ||
+               !refine_queue_.empty();
+      });
+      if (stopping_.load(std::memory_order_relaxed)) {
+        return;
+      }
+      key = refine_queue_.front();
+      refine_queue_.pop_front();
+    }
+    const auto is_complete = [&] {
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      const auto it = entries_.find(key);
+      return it == entries_.end() || it->second.complete;
+    };
+    if (is_complete()) {
+      continue;
+    }
+    // No deadline: the search only stops early when the fallback is torn
+    // down, and then its result is dropped.
+    GuessSearchBudget budget{std::chrono::steady_clock::time_point::max()};
+    budget.cancel = &stopping_;
+    const encoded_word guess = compute(key, false, budget);
+    if (budget.expired || guess == 0) {
+      continue;
+    }
+    {
+      std::unique_lock<std::shared_mutex> lock(mutex_);
+      Entry &entry = entries_[key];
+      if (entry.complete) {
+        continue;
+      }
+      entry = Entry{guess, true};
+    }
+    refined_.fetch_add(1, std::memory_order_relaxed);
+    append_overlay(key, guess);
+  }
+}
+
+encoded_word EntropyFallback::compute(const Key &key, bool final_turn,
+                                      GuessSearchBudget &budget) {
+  std::vector<size_t> candidates(answers_.size());
+  std::iota(candidates.begin(), candidates.end(), 0);
+  for (size_t i = 0; i < key.count && !candidates.empty(); ++i) {
+    const size_t guess_index = lookups_.word_index.find(
+        static_cast<encoded_word>(key.pairs[i] >> 8));
+    if (guess_index == kNoWordIndex) {
+      return 0;
+    }
+    candidates = filter_candidate_indices(
+        candidates, guess_index,
+        static_cast<feedback_int>(key.pairs[i] & 0xFF), feedback_table_,
+        words_, answers_);
+  }
+  if (candidates.empty()) {
+    return 0;
+  }
+  // With two candidates left no guess beats playing one of them.
+  if (final_turn || candidates.size() <= 2) {
+    return answers_[candidates.front()];
+  }
+  std::vector<uint32_t> distinct_guesses;
+  const bool reduced =
+      distinct_guess_indices(candidates, words_, answers_, distinct_guesses);
+  const size_t guess = find_best_guess_index(
+      candidates, words_, answers_, feedback_table_, nullptr, &budget, nullptr,
+      reduced ? &distinct_guesses : nullptr);
+  return guess != kNoWordIndex ? words_[guess] : answers_[candidates.front()];
+}
+
+bool EntropyFallback::open_overlay(const std::string &path) {
+  FallbackOverlayHeader expected{};
+  std::memcpy(expected.magic, "FBOV", 4);
+  expected.version = kFallbackOverlayVersion;
+  expected.word_count = static_cast<uint32_t>(words_.size());
+  expected.answer_count = static_cast<uint32_t>(answers_.size());
+  expected.word_hash = hash_word_list(words_);
+  expected.answer_hash = hash_word_list(answers_);
+
+  size_t loaded = 0;
+  std::streamoff valid = 0;
+  {
+    std::ifstream in(path, std::ios::binary);
+    FallbackOverlayHeader header{};
+    if (in.read(reinterpret_cast<char *>(&header), sizeof(header)) &&
+        std::memcmp(&header, &expected, sizeof(header)) == 0) {
+      valid = sizeof(header);
+      FallbackOverlayRecord record{};
+      std::unique_lock<std::shared_mutex> lock(mutex_);
+      while (in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+        if (record.count > kFallbackMaxHistory)
+          break;
+        Key key;
+        key.count = record.count;
+        std::copy(record.pairs, record.pairs + record.count,
+                  key.pairs.begin());
+        entries_[key] = Entry{static_cast<encoded_word>(record.guess), true};
+        ++loaded;
+        valid += sizeof(record);
+      }
+    } else if (in.is_open() && in.gcount() > 0) {
+      std::cerr << "Fallback cache '" << path
+                << "' was built for a different word list; starting over.\n";
+    }
+  }
+
+  std::error_code ec;
+  if (valid > 0) {
+    // Drop a torn final record before appending after it.
+    std::filesystem::resize_file(path, static_cast<uintmax_t>(valid), ec);
+  }
+  std::lock_guard<std::mutex> lock(overlay_mutex_);
+  if (valid > 0 && !ec) {
+    overlay_.open(path, std::ios::binary | std::ios::app);
+  } else {
+    overlay_.open(path, std::ios::binary | std::ios::trunc);
+    overlay_.write(reinterpret_cast<const char *>(&expected),
+                   sizeof(expected));
+    overlay_.flush();
+  }
+  if (!overlay_) {
+    std::cerr << "Failed to open fallback cache '" << path
+              << "' for writing.\n";
+    return false;
+  }
+  if (loaded > 0) {
+    std::cerr << "[fallback] loaded " << loaded << " cached states from '"
+              << path << "'.\n";
+  }
+  return true;
+}
+
+void EntropyFallback::append_overlay(const Key &key, encoded_word guess) {
+  std::lock_guard<std::mutex> lock(overlay_mutex_);
+  if (!overlay_.is_open()) {
+    return;
+  }
+  FallbackOverlayRecord record{};
+  record.count = key.count;
+  std::copy(key.pairs.begin(), key.pairs.begin() + key.count, record.pairs);
+  record.guess = guess;
+  overlay_.write(reinterpret_cast<const char *>(&record), sizeof(record));
+  overlay_.flush();
+}
+
+EntropyFallbackStats EntropyFallback::stats() const {
+  EntropyFallbackStats s;
+  s.hits = hits_.load(std::memory_order_relaxed);
+  s.computed = computed_.load(std::memory_order_relaxed);
+  s.budget_expired = budget_expired_.load(std::memory_order_relaxed);
+  s.refined = refined_.load(std::memory_order_relaxed);
+  s.compute_ns_total = compute_ns_total_.load(std::memory_order_relaxed);
+  s.compute_ns_max = compute_ns_max_.load(std::memory_order_relaxed);
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  s.entries = entries_.size();
+  return s;
+}
+
+std::string EntropyFallback::stats_summary() const {
+  const EntropyFallbackStats s = stats();
+  std::ostringstream out;
+  out << "fallback_hits=" << s.hits << " fallback_computed=" << s.computed
+      << " fallback_budget_expired=" << s.budget_expired
+      << " fallback_refined=" << s.refined
+      << " fallback_entries=" << s.entries << " fallback_mean_us="
+      << (s.computed ? static_cast<double>(s.compute_ns_total) / 1000.0 /
+                           static_cast<double>(s.computed)
+                     : 0.0)
+      << " fallback_max_us=" << static_cast<double>(s.compute_ns_max) / 1000.0;
+  return out.str();
+}
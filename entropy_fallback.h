@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "feedback_cache.h"
+#include "solver_core.h"
+#include "solver_runtime.h"
+#include "words_data.h"
+
+// Longest history the fallback accepts (one Wordle game).
+inline constexpr size_t kFallbackMaxHistory = 6;
+
+struct EntropyFallbackStats {
+  uint64_t hits = 0;
+  uint64_t computed = 0;
+  uint64_t budget_expired = 0; // computed with a truncated guess search
+  uint64_t refined = 0; // provisional entries replaced by a full search
+  uint64_t compute_ns_total = 0;
+  uint64_t compute_ns_max = 0;
+  size_t entries = 0;
+};
+
+// Next guesses for states the lookup tree does not cover, computed live
+// with find_best_guess_index and remembered in an overlay so a repeated
+// state costs one hash lookup. The candidates left by a history depend only
+// on its set of (guess, feedback) pairs, so entries are keyed on the sorted
+// pairs and histories that differ only in order share one entry.
+//
+// Each search is capped at `budget`. When it expires, the best guess scored
+// so far is played and kept as a provisional entry, which later requests for
+// the state are served from. A background thread then re-runs the search
+// without a deadline and upgrades the entry. Only complete results are
+// written to the overlay, an append-only file that can be shared across
+// runs; see DESIGN.md. Safe to call from any thread.
+class EntropyFallback {
+public:
+  // All references must outlive the fallback. `answers` are the candidate
+  // answers, `words` the allowed guesses; `feedback_table` may be null.
+  EntropyFallback(const std::vector<encoded_word> &words,
+                  const std::vector<encoded_word> &answers,
+                  const FeedbackTable *feedback_table,
+                  const LookupTables &lookups,
+                  std::chrono::microseconds budget);
+  EntropyFallback(const EntropyFallback &) = delete;
+  EntropyFallback &operator=(const EntropyFallback &) = delete;
+  // Abandons any refinement still queued or running.
+  ~EntropyFallback();
+
+  // Loads the entries in `path` (created if missing, discarded if it was
+  // written for other word lists) and appends new entries to it.
+  bool open_overlay(const std::string &path);
+
+  // Guess to play after `history`, or 0 if no answer is consistent with it.
+  // `final_turn` plays the first remaining candidate (lowest answer index)
+  // instead of the best splitter: nothing is learned after the last guess,
+  // and every candidate is equally likely to be the answer.
+  encoded_word next_guess(const SolutionStep *history, size_t count,
+                          bool final_turn);
+
+  EntropyFallbackStats stats() const;
+  // Space-separated key=value form of stats(), as printed by the CLI.
+  std::string stats_summary() const;
+
+private:
+  struct Key {
+    std::array<uint64_t, kFallbackMaxHistory> pairs{};
+    uint8_t count = 0;
+    bool operator==(const Key &other) const {
+      return count == other.count && pairs == other.pairs;
+    }
+  };
+  struct KeyHash {
+    size_t operator()(const Key &key) const;
+  };
+  struct Entry {
+    encoded_word guess = 0;
+    bool complete = true; // false while a truncated result awaits refinement
+  };
+
+  static bool make_key(const SolutionStep *history, size_t count, Key &key);
+  encoded_word compute(const Key &key, bool final_turn,
+                       GuessSearchBudget &budget);
+  void append_overlay(const Key &key, encoded_word guess);
+  // Queues `key` for a full search, starting the refiner on first use.
+  void schedule_refinement(const Key &key);
+  void refine_loop();
+
+  const std::vector<encoded_word> &words_;
+  const std::vector<encoded_word> &answers_;
+  const FeedbackTable *feedback_table_;
+  const LookupTables &lookups_;
+  const std::chrono::microseconds budget_;
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+
+  // Provisional keys waiting for the refiner, guarded by refine_mutex_.
+  std::mutex refine_mutex_;
+  std::condition_variable refine_ready_;
+  std::deque<Key> refine_queue_;
+  std::atomic<bool> stopping_{false};
+  std::thread refiner_;
+
+  std::mutex overlay_mutex_;
+  std::ofstream overlay_;
+
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> computed_{0};
+  std::atomic<uint64_t> budget_expired_{0};
+  std::atomic<uint64_t> refined_{0};
+  std::atomic<uint64_t> compute_ns_total_{0};
+  std::atomic<uint64_t> compute_ns_max_{0};
+};
@@ -1,18 +1,353 @@
 #include "feedback_cache.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 #if defined(__unix__) || defined(__APPLE__)
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "solver_core.h"
+#include "thread_pool.h"
 #include "words_data.h"
 
+// Rows of a lazy table live in fixed slots of answer_count bytes, found
+// through slot_of_row_. Readers never take the mutex:
+// - row() pins its slot until the thread's next call, and a pinned slot is
+//   never evicted;
+// - the search reads resident rows inside a FeedbackRowScope, an epoch
+//   section opened once per block of guesses. Evicted slots are retired and
+//   only reused two epochs later, once every scope that might have seen
+//   them has closed.
+// Misses take the mutex only to claim a slot and compute the row after it
+// is released.
+class FeedbackRowCache
+    : public std::enable_shared_from_this<FeedbackRowCache> {
+public:
+  // Rows' worth of live feedback a guess must cost before the search
+  // admits its row.
+  static constexpr uint64_t kAdmitRows = 2;
+
+  FeedbackRowCache(const std::vector<encoded_word> &guesses,
+                   const std::vector<encoded_word> &answers, size_t slots)
+      : guesses_(guesses), answers_(answers), row_bytes_(answers.size()),
+        slot_count_(slots), rows_(slots * answers.size()),
+        slot_of_row_(new std::atomic<int32_t>[guesses.size()]),
+        live_work_(new std::atomic<uint32_t>[guesses.size()]),
+        pins_(new std::atomic<uint32_t>[slots]),
+        referenced_(new std::atomic<uint8_t>[slots]), owner_(slots, -1),
+        live_(slots, 0) {
+    for (size_t g = 0; g < guesses.size(); ++g) {
+      slot_of_row_[g].store(-1, std::memory_order_relaxed);
+      live_work_[g].store(0, std::memory_order_relaxed);
+    }
+    for (size_t s = 0; s < slots; ++s) {
+      pins_[s].store(0, std::memory_order_relaxed);
+      referenced_[s].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  const uint8_t *row(size_t guess_idx);
+  void note_live_work(size_t guess_idx, size_t pairs);
+  FeedbackRowCacheStats stats() const;
+
+  void unpin(int32_t slot) {
+    pins_[slot].fetch_sub(1, std::memory_order_seq_cst);
+  }
+
+  uint64_t enter_scope() {
+    while (true) {
+      const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+      active_[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+      if (epoch_.load(std::memory_order_seq_cst) == epoch) {
+        return epoch;
+      }
+      active_[epoch & 1].fetch_sub(1, std::memory_order_seq_cst);
+    }
+  }
+  void exit_scope(uint64_t epoch, uint64_t hits) {
+    active_[epoch & 1].fetch_sub(1, std::memory_order_seq_cst);
+    scope_hits_.fetch_add(hits, std::memory_order_relaxed);
+  }
+  // Only valid inside a scope.
+  const uint8_t *scoped_row(size_t guess_idx) {
+    const int32_t slot = slot_of_row_[guess_idx].load(std::memory_order_acquire);
+    if (slot < 0) {
+      return nullptr;
+    }
+    if (!referenced_[slot].load(std::memory_order_relaxed)) {
+      referenced_[slot].store(1, std::memory_order_relaxed);
+    }
+    return slot_data(slot);
+  }
+
+private:
+  int32_t pin_resident(size_t guess_idx);
+  int32_t claim_slot(size_t guess_idx);
+  void evict_one();
+  void retire(int32_t slot);
+  uint8_t *slot_data(int32_t slot) {
+    return rows_.data() + static_cast<size_t>(slot) * row_bytes_;
+  }
+
+  const std::vector<encoded_word> &guesses_;
+  const std::vector<encoded_word> &answers_;
+  const size_t row_bytes_;
+  const size_t slot_count_;
+  std::vector<uint8_t> rows_;
+  std::unique_ptr<std::atomic<int32_t>[]> slot_of_row_; // -1 = not cached
+  // Feedback computed live per guess since its row was last admitted.
+  std::unique_ptr<std::atomic<uint32_t>[]> live_work_;
+  std::unique_ptr<std::atomic<uint32_t>[]> pins_;
+  std::unique_ptr<std::atomic<uint8_t>[]> referenced_;
+
+  std::atomic<uint64_t> epoch_{2};
+  std::atomic<uint64_t> active_[2] = {}; // open scopes per epoch parity
+
+  std::mutex mutex_; // guards everything below
+  std::vector<int64_t> owner_; // row each slot was last filled with
+  std::vector<uint8_t> live_;  // slot holds (or is filling) owner_'s row
+  std::deque<std::pair<int32_t, uint64_t>> retired_; // slot, epoch retired
+  size_t hand_ = 0;
+  size_t used_ = 0;
+
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> scope_hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> evictions_{0};
+  std::atomic<uint64_t> uncached_{0};
+};
+
+namespace {
+
+// The slot whose pointer this thread was last handed by row(). It is
+// released on the thread's next row() call, or when the thread exits.
+struct RowPin {
+  std::weak_ptr<FeedbackRowCache> cache;
+  const FeedbackRowCache *raw = nullptr;
+  int32_t slot = -1;
+  std::vector<uint8_t> scratch; // rows computed with no slot to spare
+
+  void release(FeedbackRowCache *current) {
+    if (slot < 0) {
+      return;
+    }
+    if (raw == current && !cache.expired()) {
+      current->unpin(slot);
+    } else if (const auto other = cache.lock()) {
+      other->unpin(slot);
+    }
+    slot = -1;
+  }
+  ~RowPin() { release(nullptr); }
+};
+
+thread_local RowPin t_row_pin;
+
+} // namespace
+
+int32_t FeedbackRowCache::pin_resident(size_t guess_idx) {
+  const int32_t slot = slot_of_row_[guess_idx].load(std::memory_order_seq_cst);
+  if (slot < 0) {
+    return -1;
+  }
+  // Pairs with the unpublish-then-check in evict_one: either this load sees
+  // the row gone, or the evictor sees the pin.
+  pins_[slot].fetch_add(1, std::memory_order_seq_cst);
+  if (slot_of_row_[guess_idx].load(std::memory_order_seq_cst) != slot) {
+    unpin(slot);
+    return -1;
+  }
+  referenced_[slot].store(1, std::memory_order_relaxed);
+  return slot;
+}
+
+void FeedbackRowCache::retire(int32_t slot) {
+  live_[slot] = 0;
+  retired_.emplace_back(slot, epoch_.load(std::memory_order_seq_cst));
+}
+
+// Retires the CLOCK victim: the first unpinned slot whose second chance is
+// used up. Called with mutex_ held.
+void FeedbackRowCache::evict_one() {
+  for (size_t step = 0; step < 2 * slot_count_; ++step) {
+    const auto s = static_cast<int32_t>(hand_);
+    hand_ = (hand_ + 1) % slot_count_;
+    if (!live_[s] || pins_[s].load(std::memory_order_seq_cst) != 0 ||
+        referenced_[s].exchange(0, std::memory_order_relaxed)) {
+      continue;
+    }
+    const int64_t row = owner_[s];
+    slot_of_row_[row].store(-1, std::memory_order_seq_cst);
+    if (pins_[s].load(std::memory_order_seq_cst) != 0) {
+      slot_of_row_[row].store(s, std::memory_order_seq_cst);
+      continue;
+    }
+    evictions_.fetch_add(1, std::memory_order_relaxed);
+    retire(s);
+    return;
+  }
+}
+
+// Returns a pinned slot for `guess_idx`, or -1 when none can be reused yet.
+int32_t FeedbackRowCache::claim_slot(size_t guess_idx) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int32_t slot = -1;
+  if (used_ < slot_count_) {
+    slot = static_cast<int32_t>(used_++);
+  } else {
+    auto ready = [&]() {
+      return !retired_.empty() &&
+             retired_.front().second + 2 <= epoch_.load() &&
+             pins_[retired_.front().first].load() == 0;
+    };
+    if (!ready() && retired_.size() < std::max<size_t>(1, slot_count_ / 8)) {
+      evict_one();
+    }
+    // Advance past epochs with no open scopes left.
+    for (int i = 0; i < 2 && !ready(); ++i) {
+      const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+      if (active_[(epoch + 1) & 1].load(std::memory_order_seq_cst) != 0) {
+        break;
+      }
+      epoch_.store(epoch + 1, std::memory_order_seq_cst);
+    }
+    if (!ready()) {
+      return -1;
+    }
+    slot = retired_.front().first;
+    retired_.pop_front();
+  }
+  owner_[slot] = static_cast<int64_t>(guess_idx);
+  live_[slot] = 1;
+  pins_[slot].fetch_add(1, std::memory_order_seq_cst);
+  return slot;
+}
+
+const uint8_t *FeedbackRowCache::row(size_t guess_idx) {
+  RowPin &pin = t_row_pin;
+  pin.release(this);
+  if (pin.raw != this || pin.cache.expired()) {
+    pin.cache = weak_from_this();
+    pin.raw = this;
+  }
+
+  int32_t slot = pin_resident(guess_idx);
+  if (slot >= 0) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    pin.slot = slot;
+    return slot_data(slot);
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  slot = claim_slot(guess_idx);
+  if (slot < 0) {
+    uncached_.fetch_add(1, std::memory_order_relaxed);
+    pin.scratch.resize(row_bytes_);
+    calculate_feedback_batch(guesses_[guess_idx], answers_.data(),
+                             answers_.size(), pin.scratch.data());
+    return pin.scratch.data();
+  }
+  calculate_feedback_batch(guesses_[guess_idx], answers_.data(),
+                           answers_.size(), slot_data(slot));
+  int32_t expected = -1;
+  if (!slot_of_row_[guess_idx].compare_exchange_strong(
+          expected, slot, std::memory_order_seq_cst)) {
+    // Another thread published the same row first; this copy goes back
+    // once our pin is released.
+    std::lock_guard<std::mutex> lock(mutex_);
+    retire(slot);
+  }
+  pin.slot = slot;
+  return slot_data(slot);
+}
+
+// Once live scoring has cost a guess as much as its row would, the row is
+// computed into a free or reclaimable slot, so guesses the search keeps
+// coming back to end up resident. When no slot can be had the work keeps
+// counting and the row is tried again later; it is never computed into
+// scratch, which would only repeat the live work.
+void FeedbackRowCache::note_live_work(size_t guess_idx, size_t pairs) {
+  const uint64_t total =
+      live_work_[guess_idx].fetch_add(static_cast<uint32_t>(pairs),
+                                      std::memory_order_relaxed) +
+      pairs;
+  if (total < kAdmitRows * row_bytes_ ||
+      slot_of_row_[guess_idx].load(std::memory_order_relaxed) >= 0) {
+    return;
+  }
+  const int32_t slot = claim_slot(guess_idx);
+  if (slot < 0) {
+    return;
+  }
+  live_work_[guess_idx].store(0, std::memory_order_relaxed);
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  calculate_feedback_batch(guesses_[guess_idx], answers_.data(),
+                           answers_.size(), slot_data(slot));
+  int32_t expected = -1;
+  const bool published = slot_of_row_[guess_idx].compare_exchange_strong(
+      expected, slot, std::memory_order_seq_cst);
+  unpin(slot);
+  if (!published) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retire(slot);
+  }
+}
+
+FeedbackRowCacheStats FeedbackRowCache::stats() const {
+  FeedbackRowCacheStats s;
+  s.hits = hits_.load(std::memory_order_relaxed) +
+           scope_hits_.load(std::memory_order_relaxed);
+  s.misses = misses_.load(std::memory_order_relaxed);
+  s.evictions = evictions_.load(std::memory_order_relaxed);
+  s.uncached = uncached_.load(std::memory_order_relaxed);
+  s.slots = slot_count_;
+  return s;
+}
+
+FeedbackRowScope::FeedbackRowScope(const FeedbackTable *table) {
+  if (!table || !table->loaded()) {
+    return;
+  }
+  cache_ = table->row_cache.get();
+  if (cache_) {
+    epoch_ = cache_->enter_scope();
+  } else {
+    data_ = table->data();
+    row_bytes_ = table->answer_count;
+  }
+}
+
+FeedbackRowScope::~FeedbackRowScope() {
+  if (cache_) {
+    cache_->exit_scope(epoch_, hits_);
+  }
+}
+
+const uint8_t *FeedbackRowScope::lazy_row(size_t guess_idx) {
+  const uint8_t *row = cache_->scoped_row(guess_idx);
+  hits_ += row != nullptr;
+  return row;
+}
+
 FeedbackTable::FeedbackTable() = default;
 
 FeedbackTable::FeedbackTable(FeedbackTable &&other) noexcept {
@@ -27,8 +362,15 @@ FeedbackTable &FeedbackTable::operator=(FeedbackTable &&other) noexcept {
     owned_data = std::move(other.owned_data);
     mapped_data = other.mapped_data;
     mapping_length = other.mapping_length;
+    data_offset = other.data_offset;
+    row_cache = std::move(other.row_cache);
+    copies = std::move(other.copies);
+    copy_of_cpu = std::move(other.copy_of_cpu);
+    load_stats = other.load_stats;
+    other.copies.clear();
     other.mapped_data = nullptr;
     other.mapping_length = 0;
+    other.data_offset = 0;
     other.guess_count = 0;
     other.answer_count = 0;
   }
@@ -37,88 +379,637 @@ FeedbackTable &FeedbackTable::operator=(FeedbackTable &&other) noexcept {
 
 FeedbackTable::~FeedbackTable() { release(); }
 
-bool FeedbackTable::loaded() const { return mapped_data || !owned_data.empty(); }
+bool FeedbackTable::loaded() const {
+  return mapped_data || !owned_data.empty() || row_cache || !copies.empty();
+}
 
 const uint8_t *FeedbackTable::data() const {
+  if (row_cache) {
+    return nullptr;
+  }
+  if (!copies.empty()) {
+    size_t copy = 0;
+#if defined(__linux__)
+    if (copies.size() > 1) {
+      const int cpu = sched_getcpu();
+      if (cpu >= 0 && static_cast<size_t>(cpu) < copy_of_cpu.size()) {
+        copy = copy_of_cpu[cpu];
+      }
+    }
+#endif
+    return copies[copy].first;
+  }
   return mapped_data ? mapped_data : owned_data.data();
 }
 
 const uint8_t *FeedbackTable::row(size_t guess_idx) const {
+  if (row_cache) {
+    return row_cache->row(guess_idx);
+  }
   return data() + guess_idx * answer_count;
 }
 
+void FeedbackTable::note_live_work(size_t guess_idx, size_t pairs) const {
+  if (row_cache) {
+    row_cache->note_live_work(guess_idx, pairs);
+  }
+}
+
+FeedbackRowCacheStats FeedbackTable::row_cache_stats() const {
+  return row_cache ? row_cache->stats() : FeedbackRowCacheStats{};
+}
+
+void FeedbackTable::release_copies() {
+#if defined(__unix__) || defined(__APPLE__)
+  for (const auto &copy : copies) {
+    munmap(copy.first, copy.second);
+  }
+#endif
+  copies.clear();
+  copy_of_cpu.clear();
+}
+
 void FeedbackTable::release() {
 #if defined(__unix__) || defined(__APPLE__)
   if (mapped_data) {
-    munmap(const_cast<uint8_t *>(mapped_data), mapping_length);
+    munmap(const_cast<uint8_t *>(mapped_data - data_offset), mapping_length);
   }
 #endif
+  release_copies();
   mapped_data = nullptr;
   mapping_length = 0;
+  data_offset = 0;
+  row_cache.reset();
   guess_count = 0;
   answer_count = 0;
 }
 
+namespace {
+
+// Validates the file prefix and returns the byte offset of the matrix, or
+// SIZE_MAX if the file cannot be used for this guess/answer pair.
+size_t feedback_data_offset(const uint8_t *prefix, size_t prefix_size,
+                            size_t file_size,
+                            const std::vector<encoded_word> &guesses,
+                            const std::vector<encoded_word> &answers,
+                            const std::string &path) {
+  const size_t matrix_size = guesses.size() * answers.size();
+  FeedbackTableHeader header{};
+  if (prefix_size >= sizeof(header)) {
+    std::memcpy(&header, prefix, sizeof(header));
+  }
+  if (prefix_size < sizeof(header) ||
+      std::memcmp(header.magic, "FBTB", 4) != 0) {
+    return guesses == answers && file_size == matrix_size ? 0 : SIZE_MAX;
+  }
+  if (header.version != kFeedbackTableVersion) {
+    std::cerr << "Feedback table '" << path << "' has unsupported version "
+              << header.version << ".\n";
+    return SIZE_MAX;
+  }
+  if (header.guess_count != guesses.size() ||
+      header.answer_count != answers.size() ||
+      header.guess_hash != hash_word_list(guesses) ||
+      header.answer_hash != hash_word_list(answers)) {
+    std::cerr << "Feedback table '" << path
+              << "' was built for a different word list.\n";
+    return SIZE_MAX;
+  }
+  if (file_size != sizeof(header) + matrix_size) {
+    std::cerr << "Feedback table '" << path << "' is truncated.\n";
+    return SIZE_MAX;
+  }
+  return sizeof(header);
+}
+
+} // namespace
+
+namespace {
+
+constexpr size_t kHugePageBytes = size_t{2} << 20;
+
+#if defined(__unix__) || defined(__APPLE__)
+// Anonymous memory for `bytes`, on huge pages when `mode` asks for them.
+// `mode` is lowered to what was granted: explicit pages fall back to
+// transparent ones when none are reserved. Returns null on failure.
+uint8_t *map_anonymous(size_t bytes, FeedbackHugePages &mode,
+                       size_t &length) {
+  const size_t rounded =
+      (bytes + kHugePageBytes - 1) / kHugePageBytes * kHugePageBytes;
+  if (mode == FeedbackHugePages::kExplicit) {
+#if defined(MAP_HUGETLB)
+    void *mapping = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED) {
+      length = rounded;
+      return static_cast<uint8_t *>(mapping);
+    }
+#endif
+    std::cerr << "Warning: no explicit huge pages available (see "
+                 "vm.nr_hugepages); using transparent huge pages.\n";
+    mode = FeedbackHugePages::kTransparent;
+  }
+  if (mode == FeedbackHugePages::kOff) {
+    void *mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    length = bytes;
+    return mapping == MAP_FAILED ? nullptr : static_cast<uint8_t *>(mapping);
+  }
+  // Transparent huge pages only back 2 MB-aligned ranges: map one spare
+  // huge page and trim the ends.
+  const size_t padded = rounded + kHugePageBytes;
+  void *mapping = mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    return nullptr;
+  }
+  auto *raw = static_cast<uint8_t *>(mapping);
+  const uintptr_t address = reinterpret_cast<uintptr_t>(raw);
+  auto *aligned = reinterpret_cast<uint8_t *>(
+      (address + kHugePageBytes - 1) & ~(uintptr_t{kHugePageBytes} - 1));
+  if (aligned != raw) {
+    munmap(raw, static_cast<size_t>(aligned - raw));
+  }
+  const size_t tail = static_cast<size_t>((raw + padded) - (aligned + rounded));
+  if (tail != 0) {
+    munmap(aligned + rounded, tail);
+  }
+#if defined(MADV_HUGEPAGE)
+  madvise(aligned, rounded, MADV_HUGEPAGE);
+#else
+  std::cerr << "Warning: transparent huge pages are not supported here.\n";
+  mode = FeedbackHugePages::kOff;
+#endif
+  length = rounded;
+  return aligned;
+}
+#endif
+
+// Parses a sysfs list such as "0-3,8,10-11".
+std::vector<int> parse_id_list(const std::string &text) {
+  std::vector<int> ids;
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t next = text.find(',', pos);
+    if (next == std::string::npos) {
+      next = text.size();
+    }
+    const std::string item = text.substr(pos, next - pos);
+    const size_t dash = item.find('-');
+    try {
+      const int first = std::stoi(item.substr(0, dash));
+      const int last =
+          dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+      for (int id = first; id <= last; ++id) {
+        ids.push_back(id);
+      }
+    } catch (const std::exception &) {
+      return {};
+    }
+    pos = next + 1;
+  }
+  return ids;
+}
+
+// CPUs of every online NUMA node that has any. Empty when the topology is
+// unknown.
+std::vector<std::vector<int>> numa_node_cpus() {
+  std::vector<std::vector<int>> nodes;
+#if defined(__linux__)
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string text;
+  if (!std::getline(online, text)) {
+    return nodes;
+  }
+  for (const int node : parse_id_list(text)) {
+    std::ifstream list("/sys/devices/system/node/node" +
+                       std::to_string(node) + "/cpulist");
+    std::string cpus;
+    if (std::getline(list, cpus)) {
+      std::vector<int> ids = parse_id_list(cpus);
+      if (!ids.empty()) {
+        nodes.push_back(std::move(ids));
+      }
+    }
+  }
+#endif
+  return nodes;
+}
+
+// Copies the matrix at `source` into table.copies: one copy per NUMA node
+// when replicating, each written by a thread bound to that node so its
+// pages are allocated there, or a single copy otherwise.
+bool copy_feedback_matrix(FeedbackTable &table, const uint8_t *source,
+                          size_t bytes, const FeedbackLoadOptions &options) {
+#if defined(__unix__) || defined(__APPLE__)
+  std::vector<std::vector<int>> nodes;
+  if (options.numa_replicate) {
+    nodes = numa_node_cpus();
+    if (nodes.size() < 2) {
+      std::cerr << "Warning: only one NUMA node; the feedback table is not "
+                   "replicated.\n";
+      nodes.clear();
+    }
+  }
+  const size_t count = std::max<size_t>(1, nodes.size());
+  FeedbackHugePages mode = options.huge_pages;
+  for (size_t i = 0; i < count; ++i) {
+    size_t length = 0;
+    uint8_t *copy = map_anonymous(bytes, mode, length);
+    if (!copy) {
+      return false;
+    }
+    table.copies.emplace_back(copy, length);
+  }
+
+  if (nodes.empty()) {
+    std::memcpy(table.copies[0].first, source, bytes);
+  } else {
+    std::vector<std::thread> fillers;
+    for (size_t i = 0; i < count; ++i) {
+      fillers.emplace_back([&, i]() {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const int cpu : nodes[i]) {
+          if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+          }
+        }
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+        std::memcpy(table.copies[i].first, source, bytes);
+      });
+    }
+    for (auto &filler : fillers) {
+      filler.join();
+    }
+    for (size_t i = 0; i < count; ++i) {
+      for (const int cpu : nodes[i]) {
+        if (static_cast<size_t>(cpu) >= table.copy_of_cpu.size()) {
+          table.copy_of_cpu.resize(static_cast<size_t>(cpu) + 1, 0);
+        }
+        table.copy_of_cpu[cpu] = static_cast<uint16_t>(i);
+      }
+    }
+  }
+  for (const auto &copy : table.copies) {
+    mprotect(copy.first, copy.second, PROT_READ);
+  }
+  table.load_stats.backing =
+      mode == FeedbackHugePages::kExplicit ? "hugetlb" : "anonymous";
+  table.load_stats.huge_pages = mode;
+  table.load_stats.replicas = count;
+  table.load_stats.prefaulted = true;
+  return true;
+#else
+  (void)table;
+  (void)source;
+  (void)bytes;
+  (void)options;
+  return false;
+#endif
+}
+
+} // namespace
+
+PageFaultCounts process_page_faults() {
+  PageFaultCounts counts;
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    counts.minor = static_cast<uint64_t>(usage.ru_minflt);
+    counts.major = static_cast<uint64_t>(usage.ru_majflt);
+  }
+#endif
+  return counts;
+}
+
+const char *feedback_huge_pages_name(FeedbackHugePages mode) {
+  switch (mode) {
+  case FeedbackHugePages::kTransparent:
+    return "transparent";
+  case FeedbackHugePages::kExplicit:
+    return "explicit";
+  default:
+    return "off";
+  }
+}
+
+bool parse_feedback_huge_pages(const std::string &text,
+                               FeedbackHugePages &mode) {
+  if (text == "off") {
+    mode = FeedbackHugePages::kOff;
+  } else if (text == "transparent") {
+    mode = FeedbackHugePages::kTransparent;
+  } else if (text == "explicit") {
+    mode = FeedbackHugePages::kExplicit;
+  } else {
+    return false;
+  }
+  return true;
+}
+
 FeedbackTable load_feedback_table(const std::string &path,
-                                  size_t word_count) {
+                                  const std::vector<encoded_word> &guesses,
+                                  const std::vector<encoded_word> &answers,
+                                  const FeedbackLoadOptions &options) {
+  const auto started = std::chrono::steady_clock::now();
+  const PageFaultCounts faults_before = process_page_faults();
   FeedbackTable table;
+  const auto finish = [&]() {
+    const PageFaultCounts faults = process_page_faults();
+    table.load_stats.load_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - started)
+            .count());
+    table.load_stats.minor_faults = faults.minor - faults_before.minor;
+    table.load_stats.major_faults = faults.major - faults_before.major;
+    return std::move(table);
+  };
 #if defined(__unix__) || defined(__APPLE__)
-  const size_t expected_size = word_count * word_count;
+  const bool copy = options.numa_replicate ||
+                    options.huge_pages != FeedbackHugePages::kOff;
   int fd = ::open(path.c_str(), O_RDONLY);
   if (fd >= 0) {
     struct stat st {};
-    if (fstat(fd, &st) == 0 &&
-        static_cast<size_t>(st.st_size) == expected_size) {
-      void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
-      if (mapping != MAP_FAILED) {
-        table.mapped_data = static_cast<const uint8_t *>(mapping);
-        table.mapping_length = static_cast<size_t>(st.st_size);
-        table.guess_count = word_count;
-        table.answer_count = word_count;
-        ::close(fd);
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      const size_t file_size = static_cast<size_t>(st.st_size);
+      int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+      if (options.prefault && !copy) {
+        flags |= MAP_POPULATE;
+      }
+#endif
+      void *mapping = mmap(nullptr, file_size, PROT_READ, flags, fd, 0);
+      ::close(fd);
+      if (mapping == MAP_FAILED) {
+        return table;
+      }
+      const auto *base = static_cast<const uint8_t *>(mapping);
+      const size_t offset =
+          feedback_data_offset(base, file_size, file_size, guesses,
+                               answers, path);
+      if (offset == SIZE_MAX) {
+        munmap(mapping, file_size);
         return table;
       }
+      table.guess_count = guesses.size();
+      table.answer_count = answers.size();
+      if (copy) {
+        if (copy_feedback_matrix(table, base + offset,
+                                 guesses.size() * answers.size(), options)) {
+          munmap(mapping, file_size);
+          return finish();
+        }
+        std::cerr << "Warning: could not copy the feedback table; using the "
+                     "file mapping.\n";
+        table.release_copies();
+      }
+#if !defined(MAP_POPULATE)
+      if (options.prefault) {
+        madvise(mapping, file_size, MADV_WILLNEED);
+      }
+#endif
+      table.mapped_data = base + offset;
+      table.mapping_length = file_size;
+      table.data_offset = offset;
+      table.load_stats.backing = "mmap";
+      table.load_stats.prefaulted = options.prefault;
+      table.load_stats.replicas = 1;
+      return finish();
     }
     ::close(fd);
   }
 #endif
-  std::ifstream file(path, std::ios::binary);
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
   if (!file.is_open()) {
     return table;
   }
-  table.owned_data.resize(word_count * word_count);
+  const size_t file_size = static_cast<size_t>(file.tellg());
+  file.seekg(0);
+  uint8_t prefix[sizeof(FeedbackTableHeader)] = {};
+  const size_t prefix_size = std::min(file_size, sizeof(prefix));
+  file.read(reinterpret_cast<char *>(prefix),
+            static_cast<std::streamsize>(prefix_size));
+  const size_t offset =
+      feedback_data_offset(prefix, prefix_size, file_size, guesses, answers,
+                           path);
+  if (!file || offset == SIZE_MAX) {
+    return table;
+  }
+  file.seekg(static_cast<std::streamoff>(offset));
+  table.owned_data.resize(guesses.size() * answers.size());
   if (!file.read(reinterpret_cast<char *>(table.owned_data.data()),
                  static_cast<std::streamsize>(table.owned_data.size()))) {
     table.owned_data.clear();
     return table;
   }
-  table.guess_count = word_count;
-  table.answer_count = word_count;
+  table.guess_count = guesses.size();
+  table.answer_count = answers.size();
+  table.load_stats.backing = "read";
+  table.load_stats.prefaulted = true;
+  table.load_stats.replicas = 1;
+  return finish();
+}
+
+FeedbackTable make_lazy_feedback_table(const std::vector<encoded_word> &guesses,
+                                       const std::vector<encoded_word> &answers,
+                                       size_t budget_bytes) {
+  FeedbackTable table;
+  if (guesses.empty() || answers.empty()) {
+    return table;
+  }
+  const size_t slots =
+      std::min(guesses.size(), std::max<size_t>(1, budget_bytes / answers.size()));
+  table.row_cache =
+      std::make_shared<FeedbackRowCache>(guesses, answers, slots);
+  table.guess_count = guesses.size();
+  table.answer_count = answers.size();
   return table;
 }
 
-bool build_feedback_table_file(const std::string &path,
-                               const std::vector<encoded_word> &words) {
-  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+namespace {
+
+// Rows computed per task. Each round fills one block per pool thread, then
+// the blocks are written in order with a single large write each.
+constexpr size_t kFeedbackRowsPerBlock = 64;
+
+void fill_feedback_rows(const std::vector<encoded_word> &guesses,
+                        const std::vector<encoded_word> &answers,
+                        size_t first_row, size_t row_count, uint8_t *out) {
+  const size_t answer_count = answers.size();
+  for (size_t r = 0; r < row_count; ++r) {
+    calculate_feedback_batch(guesses[first_row + r], answers.data(),
+                             answer_count, out + r * answer_count);
+  }
+}
+
+// Writes the header and then the matrix, one round of row blocks at a time.
+// `fill_rows(first_row, row_count, out)` produces consecutive rows and may
+// run concurrently for different blocks.
+using FillRows = std::function<void(size_t, size_t, uint8_t *)>;
+
+bool write_feedback_table(const std::string &path,
+                          const std::vector<encoded_word> &guesses,
+                          const std::vector<encoded_word> &answers,
+                          const FillRows &fill_rows) {
+  // Build next to the destination and rename over it once complete, so
+  // readers (including processes that already mapped the old table) never
+  // observe a partially written file.
+  const std::string temp_path = path + ".tmp";
+  std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
   if (!file.is_open()) {
-    std::cerr << "Failed to open '" << path << "' for writing.\n";
+    std::cerr << "Failed to open '" << temp_path << "' for writing.\n";
     return false;
   }
+
+  FeedbackTableHeader header{};
+  std::memcpy(header.magic, "FBTB", 4);
+  header.version = kFeedbackTableVersion;
+  header.guess_count = static_cast<uint32_t>(guesses.size());
+  header.answer_count = static_cast<uint32_t>(answers.size());
+  header.guess_hash = hash_word_list(guesses);
+  header.answer_hash = hash_word_list(answers);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  ThreadPool &pool = ThreadPool::instance();
+  const size_t blocks_per_round = pool.concurrency();
+  const size_t row_count = guesses.size();
+  const size_t block_bytes = kFeedbackRowsPerBlock * answers.size();
+  std::vector<std::vector<uint8_t>> blocks(blocks_per_round);
+  for (auto &block : blocks) {
+    block.resize(block_bytes);
+  }
+
   size_t written = 0;
-  for (const auto &guess : words) {
-    for (const auto &answer : words) {
-      const uint8_t feedback =
-          static_cast<uint8_t>(calculate_feedback_encoded(guess, answer));
-      file.put(static_cast<char>(feedback));
-      ++written;
+  for (size_t round_start = 0; round_start < row_count && file;
+       round_start += kFeedbackRowsPerBlock * blocks_per_round) {
+    const size_t round_rows = std::min(kFeedbackRowsPerBlock * blocks_per_round,
+                                       row_count - round_start);
+    const size_t round_blocks =
+        (round_rows + kFeedbackRowsPerBlock - 1) / kFeedbackRowsPerBlock;
+    pool.parallel_for(0, round_blocks, 1,
+                      [&](size_t begin, size_t end, unsigned int) {
+                        for (size_t b = begin; b < end; ++b) {
+                          const size_t first =
+                              round_start + b * kFeedbackRowsPerBlock;
+                          fill_rows(first,
+                                    std::min(kFeedbackRowsPerBlock,
+                                             row_count - first),
+                                    blocks[b].data());
+                        }
+                      });
+    for (size_t b = 0; b < round_blocks; ++b) {
+      const size_t first = round_start + b * kFeedbackRowsPerBlock;
+      const size_t bytes =
+          std::min(kFeedbackRowsPerBlock, row_count - first) * answers.size();
+      file.write(reinterpret_cast<const char *>(blocks[b].data()),
+                 static_cast<std::streamsize>(bytes));
+      written += bytes;
     }
   }
-  file.flush();
+  file.close();
   if (!file) {
-    std::cerr << "Error writing feedback table to '" << path << "'.\n";
+    std::cerr << "Error writing feedback table to '" << temp_path << "'.\n";
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    std::cerr << "Failed to move '" << temp_path << "' to '" << path
+              << "'.\n";
+    std::remove(temp_path.c_str());
     return false;
   }
   std::cout << "Wrote " << written << " feedback entries to '" << path
             << "'.\n";
   return true;
 }
+
+// Position of each word of `words` in `previous`, or -1 if it is new.
+std::vector<int64_t> previous_positions(
+    const std::vector<encoded_word> &words,
+    const std::vector<encoded_word> &previous) {
+  std::unordered_map<encoded_word, int64_t> index;
+  index.reserve(previous.size());
+  for (size_t i = 0; i < previous.size(); ++i) {
+    index.emplace(previous[i], static_cast<int64_t>(i));
+  }
+  std::vector<int64_t> positions(words.size(), -1);
+  for (size_t i = 0; i < words.size(); ++i) {
+    const auto it = index.find(words[i]);
+    if (it != index.end()) {
+      positions[i] = it->second;
+    }
+  }
+  return positions;
+}
+
+} // namespace
+
+bool build_feedback_table_file(const std::string &path,
+                               const std::vector<encoded_word> &guesses,
+                               const std::vector<encoded_word> &answers) {
+  return write_feedback_table(
+      path, guesses, answers,
+      [&](size_t first_row, size_t row_count, uint8_t *out) {
+        fill_feedback_rows(guesses, answers, first_row, row_count, out);
+      });
+}
+
+bool update_feedback_table_file(
+    const std::string &path, const FeedbackTable &previous,
+    const std::vector<encoded_word> &previous_guesses,
+    const std::vector<encoded_word> &previous_answers,
+    const std::vector<encoded_word> &guesses,
+    const std::vector<encoded_word> &answers) {
+  if (!previous.loaded() || previous.guess_count != previous_guesses.size() ||
+      previous.answer_count != previous_answers.size()) {
+    std::cerr << "Previous feedback table does not match its word lists.\n";
+    return false;
+  }
+  const auto row_source = previous_positions(guesses, previous_guesses);
+  const auto column_source = previous_positions(answers, previous_answers);
+  // Columns for answers the previous table lacks are computed together.
+  std::vector<size_t> new_columns;
+  std::vector<encoded_word> new_answers;
+  for (size_t c = 0; c < answers.size(); ++c) {
+    if (column_source[c] < 0) {
+      new_columns.push_back(c);
+      new_answers.push_back(answers[c]);
+    }
+  }
+  const size_t new_rows = static_cast<size_t>(
+      std::count(row_source.begin(), row_source.end(), int64_t{-1}));
+  std::cout << "Reusing " << guesses.size() - new_rows << " of "
+            << guesses.size() << " feedback rows and "
+            << answers.size() - new_columns.size() << " of " << answers.size()
+            << " columns from the previous table.\n";
+
+  return write_feedback_table(
+      path, guesses, answers,
+      [&](size_t first_row, size_t row_count, uint8_t *out) {
+        std::vector<uint8_t> fresh(new_answers.size());
+        for (size_t r = 0; r < row_count; ++r) {
+          const size_t g = first_row + r;
+          uint8_t *row = out + r * answers.size();
+          if (row_source[g] < 0) {
+            calculate_feedback_batch(guesses[g], answers.data(),
+                                     answers.size(), row);
+            continue;
+          }
+          const uint8_t *old_row =
+              previous.row(static_cast<size_t>(row_source[g]));
+          for (size_t c = 0; c < answers.size(); ++c) {
+            if (column_source[c] >= 0) {
+              row[c] = old_row[column_source[c]];
+            }
+          }
+          calculate_feedback_batch(guesses[g], new_answers.data(),
+                                   new_answers.size(), fresh.data());
+          for (size_t i = 0; i < new_columns.size(); ++i) {
+            row[new_columns[i]] = fresh[i];
+          }
+        }
+      });
+}
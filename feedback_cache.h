@@ -2,17 +2,90 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "solver_types.h"
 
+// On-disk header for feedback_table.bin. Row-major uint8 feedback codes follow
+// at `sizeof(FeedbackTableHeader)`. Files without this header are the legacy
+// headerless `word_count * word_count` layout and are still accepted.
+struct FeedbackTableHeader {
+  char magic[4];        // "FBTB"
+  uint32_t version;     // kFeedbackTableVersion
+  uint32_t guess_count; // rows
+  uint32_t answer_count; // bytes per row
+  uint64_t guess_hash;  // hash_word_list() of the row vocabulary
+  uint64_t answer_hash; // hash_word_list() of the column vocabulary
+  char reserved[32];
+};
+static_assert(sizeof(FeedbackTableHeader) == 64,
+              "FeedbackTableHeader must be 64 bytes");
+
+inline constexpr uint32_t kFeedbackTableVersion = 1;
+
+class FeedbackRowCache;
+
+struct FeedbackRowCacheStats {
+  uint64_t hits = 0;      // row() calls served from the cache
+  uint64_t misses = 0;    // row() calls that computed the row
+  uint64_t evictions = 0;
+  uint64_t uncached = 0;  // misses with every slot in use, computed per thread
+  size_t slots = 0;       // rows the budget holds
+};
+
+enum class FeedbackHugePages { kOff, kTransparent, kExplicit };
+
+// How load_feedback_table places a full table in memory. The defaults map
+// the file and let pages fault in on first use. Huge pages and NUMA
+// replication copy the matrix into anonymous memory instead.
+struct FeedbackLoadOptions {
+  bool prefault = false; // fault every page in during the load
+  FeedbackHugePages huge_pages = FeedbackHugePages::kOff;
+  bool numa_replicate = false; // one copy per NUMA node, read by its CPUs
+};
+
+struct FeedbackLoadStats {
+  const char *backing = "none"; // "mmap", "read", "anonymous" or "hugetlb"
+  FeedbackHugePages huge_pages = FeedbackHugePages::kOff; // as granted
+  bool prefaulted = false;
+  size_t replicas = 0;
+  uint64_t load_ns = 0;
+  uint64_t minor_faults = 0; // taken by the whole process during the load
+  uint64_t major_faults = 0;
+};
+
+struct PageFaultCounts {
+  uint64_t minor = 0;
+  uint64_t major = 0;
+};
+
+// Page faults the process has taken so far (zero where unsupported).
+PageFaultCounts process_page_faults();
+const char *feedback_huge_pages_name(FeedbackHugePages mode);
+// Parses "off", "transparent" or "explicit".
+bool parse_feedback_huge_pages(const std::string &text,
+                               FeedbackHugePages &mode);
+
+// Either the whole matrix (mapped or read from feedback_table.bin) or, for a
+// table from make_lazy_feedback_table, a bounded cache of rows computed on
+// first use. Both answer row() the same way.
 struct FeedbackTable {
   size_t guess_count = 0;
   size_t answer_count = 0;
   std::vector<uint8_t> owned_data;
   const uint8_t *mapped_data = nullptr;
   size_t mapping_length = 0;
+  size_t data_offset = 0; // header bytes preceding mapped_data in the mapping
+  std::shared_ptr<FeedbackRowCache> row_cache; // set for lazy tables only
+  // Anonymous copies (start, mapping length) that replace the file mapping
+  // when huge pages or NUMA replication were requested. A thread reads
+  // copies[copy_of_cpu[cpu]] for the CPU it is running on.
+  std::vector<std::pair<uint8_t *, size_t>> copies;
+  std::vector<uint16_t> copy_of_cpu;
+  FeedbackLoadStats load_stats;
 
   FeedbackTable();
   FeedbackTable(const FeedbackTable &) = delete;
@@ -22,14 +95,80 @@ struct FeedbackTable {
   ~FeedbackTable();
 
   bool loaded() const;
+  bool lazy() const { return row_cache != nullptr; }
+  // The full matrix (the copy local to the calling thread's NUMA node when
+  // replicated); null for lazy tables.
   const uint8_t *data() const;
+  // Feedback of guess `guess_idx` against every answer. A lazy table
+  // computes a missing row with the batch kernel. Its pointer stays valid
+  // until the calling thread's next row() call on any lazy table, so use
+  // one row at a time per thread.
   const uint8_t *row(size_t guess_idx) const;
+  // Tells a lazy table that `pairs` feedbacks of this guess were computed
+  // live because its row was not resident; enough of them admit the row.
+  void note_live_work(size_t guess_idx, size_t pairs) const;
+  FeedbackRowCacheStats row_cache_stats() const;
+
+  // Drops the anonymous copies, leaving any file mapping in place.
+  void release_copies();
 
 private:
   void release();
 };
 
+// Loads a table with one row per word in `guesses` and one column per word in
+// `answers` (pass the same list twice for the square table). Headered files
+// must match both lists' sizes and hashes; legacy headerless files are only
+// accepted for square tables of the right size.
 FeedbackTable load_feedback_table(const std::string &path,
-                                  size_t word_count);
+                                  const std::vector<encoded_word> &guesses,
+                                  const std::vector<encoded_word> &answers,
+                                  const FeedbackLoadOptions &options = {});
+// Read access for hot loops that only want rows already at hand: row()
+// never computes, and returns null when a lazy table does not hold the row.
+// Rows stay valid until the scope ends. Opening one costs a few atomic
+// operations on a lazy table and nothing on a full one, so hold it over a
+// block of lookups rather than one.
+class FeedbackRowScope {
+public:
+  explicit FeedbackRowScope(const FeedbackTable *table);
+  ~FeedbackRowScope();
+  FeedbackRowScope(const FeedbackRowScope &) = delete;
+  FeedbackRowScope &operator=(const FeedbackRowScope &) = delete;
+
+  const uint8_t *row(size_t guess_idx) {
+    if (cache_) {
+      return lazy_row(guess_idx);
+    }
+    return data_ ? data_ + guess_idx * row_bytes_ : nullptr;
+  }
+
+private:
+  const uint8_t *lazy_row(size_t guess_idx);
+
+  FeedbackRowCache *cache_ = nullptr;
+  const uint8_t *data_ = nullptr;
+  size_t row_bytes_ = 0;
+  uint64_t epoch_ = 0;
+  uint64_t hits_ = 0;
+};
+
+// A table over `guesses` x `answers` (both must outlive it) that computes
+// rows on demand and keeps up to `budget_bytes` of them. Eviction is CLOCK
+// (second chance), which approximates LRU without locking cache hits.
+FeedbackTable make_lazy_feedback_table(const std::vector<encoded_word> &guesses,
+                                       const std::vector<encoded_word> &answers,
+                                       size_t budget_bytes);
 bool build_feedback_table_file(const std::string &path,
-                               const std::vector<encoded_word> &words);
+                               const std::vector<encoded_word> &guesses,
+                               const std::vector<encoded_word> &answers);
+// Writes the table for `guesses` x `answers` into `path`, copying every cell
+// whose guess and answer both appear in `previous` (built over
+// `previous_guesses` x `previous_answers`) and computing only the rows and
+// columns of words that are new.
+bool update_feedback_table_file(
+    const std::string &path, const FeedbackTable &previous,
+    const std::vector<encoded_word> &previous_guesses,
+    const std::vector<encoded_word> &previous_answers,
+    const std::vector<encoded_word> &guesses,
+    const std::vector<encoded_word> &answers);
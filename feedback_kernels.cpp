@@ -0,0 +1,213 @@
+#include "solver_core.h"
+
+#include <cstring>
+
+#include "words_data.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define WORDLE_HAVE_AVX2_KERNEL 1
+#endif
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define WORDLE_HAVE_NEON_KERNEL 1
+#endif
+
+// All vector kernels use the same branch-free formulation of the two-pass
+// scoring in calculate_feedback_encoded. With a_k the answer letters, g_i the
+// guess letters and green_k = (a_k == g_k):
+//
+//   remaining(L) = #{k : a_k == L && !green_k}
+//   prior_i      = #{j < i : g_j == g_i && !green_j}
+//   yellow_i     = !green_i && remaining(g_i) > prior_i
+//
+// which is exactly the number of unmatched copies of g_i still available when
+// the left-to-right yellow pass reaches position i. The guess is fixed for a
+// whole batch, so which j contribute to prior_i is known up front.
+//
+// Answers are loaded straight into 32-bit lanes, 8 per AVX2 step and 4 per
+// NEON one.
+static_assert(sizeof(encoded_word) == 4, "kernels load 32-bit words");
+
+namespace {
+
+struct GuessPlan {
+  uint32_t letters[5];
+  // same_before[i] has bit j set when j < i and g_j == g_i.
+  uint8_t same_before[5];
+};
+
+GuessPlan make_guess_plan(encoded_word guess) {
+  GuessPlan plan{};
+  for (int i = 0; i < 5; ++i) {
+    plan.letters[i] = get_char_code_at(guess, i);
+    for (int j = 0; j < i; ++j) {
+      if (plan.letters[j] == plan.letters[i])
+        plan.same_before[i] |= static_cast<uint8_t>(1u << j);
+    }
+  }
+  return plan;
+}
+
+void feedback_batch_scalar(encoded_word guess, const encoded_word *answers,
+                           size_t n, uint8_t *out) {
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = static_cast<uint8_t>(calculate_feedback_encoded(guess, answers[i]));
+  }
+}
+
+#if defined(WORDLE_HAVE_AVX2_KERNEL)
+
+__attribute__((target("avx2"))) void
+feedback_batch_avx2(encoded_word guess, const encoded_word *answers, size_t n,
+                    uint8_t *out) {
+  const GuessPlan plan = make_guess_plan(guess);
+  __m256i g[5];
+  for (int i = 0; i < 5; ++i) {
+    g[i] = _mm256_set1_epi32(static_cast<int>(plan.letters[i]));
+  }
+  const __m256i mask5 = _mm256_set1_epi32(0x1F);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i two = _mm256_set1_epi32(2);
+  // Collects byte 0 of every dword into the low 4 bytes of each 128-bit lane.
+  const __m256i byte_idx = _mm256_setr_epi8(
+      0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 4, 8, 12,
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+  size_t idx = 0;
+  for (; idx + 8 <= n; idx += 8) {
+    const __m256i word =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(answers + idx));
+
+    __m256i a[5];
+    __m256i not_green[5];
+    for (int k = 0; k < 5; ++k) {
+      a[k] = _mm256_and_si256(_mm256_srli_epi32(word, 5 * (4 - k)), mask5);
+      // All-ones where the position is not green.
+      not_green[k] = _mm256_xor_si256(_mm256_cmpeq_epi32(a[k], g[k]),
+                                      _mm256_set1_epi32(-1));
+    }
+
+    __m256i feedback = _mm256_setzero_si256();
+    for (int i = 0; i < 5; ++i) {
+      __m256i remaining = _mm256_setzero_si256();
+      for (int k = 0; k < 5; ++k) {
+        remaining = _mm256_sub_epi32(
+            remaining,
+            _mm256_and_si256(_mm256_cmpeq_epi32(a[k], g[i]), not_green[k]));
+      }
+      __m256i prior = _mm256_setzero_si256();
+      for (int j = 0; j < i; ++j) {
+        if (plan.same_before[i] & (1u << j))
+          prior = _mm256_sub_epi32(prior, not_green[j]);
+      }
+      const __m256i yellow = _mm256_and_si256(
+          not_green[i], _mm256_cmpgt_epi32(remaining, prior));
+      const __m256i code =
+          _mm256_or_si256(_mm256_andnot_si256(not_green[i], two),
+                          _mm256_and_si256(yellow, one));
+      feedback = _mm256_add_epi32(
+          _mm256_add_epi32(feedback, _mm256_slli_epi32(feedback, 1)), code);
+    }
+
+    const __m256i bytes = _mm256_shuffle_epi8(feedback, byte_idx);
+    const uint32_t low = static_cast<uint32_t>(_mm256_extract_epi32(bytes, 0));
+    const uint32_t high = static_cast<uint32_t>(_mm256_extract_epi32(bytes, 4));
+    std::memcpy(out + idx, &low, sizeof(low));
+    std::memcpy(out + idx + 4, &high, sizeof(high));
+  }
+  feedback_batch_scalar(guess, answers + idx, n - idx, out + idx);
+}
+
+#endif
+
+#if defined(WORDLE_HAVE_NEON_KERNEL)
+
+void feedback_batch_neon(encoded_word guess, const encoded_word *answers,
+                         size_t n, uint8_t *out) {
+  const GuessPlan plan = make_guess_plan(guess);
+  uint32x4_t g[5];
+  for (int i = 0; i < 5; ++i) {
+    g[i] = vdupq_n_u32(plan.letters[i]);
+  }
+  const uint32x4_t mask5 = vdupq_n_u32(0x1F);
+  const uint32x4_t one = vdupq_n_u32(1);
+  const uint32x4_t two = vdupq_n_u32(2);
+
+  auto lanes = [&](const encoded_word *src) {
+    const uint32x4_t word = vld1q_u32(src);
+    uint32x4_t a[5];
+    uint32x4_t not_green[5];
+    for (int k = 0; k < 5; ++k) {
+      a[k] = vandq_u32(vshlq_u32(word, vdupq_n_s32(-5 * (4 - k))), mask5);
+      not_green[k] = vmvnq_u32(vceqq_u32(a[k], g[k]));
+    }
+    uint32x4_t feedback = vdupq_n_u32(0);
+    for (int i = 0; i < 5; ++i) {
+      uint32x4_t remaining = vdupq_n_u32(0);
+      for (int k = 0; k < 5; ++k) {
+        remaining = vsubq_u32(remaining,
+                              vandq_u32(vceqq_u32(a[k], g[i]), not_green[k]));
+      }
+      uint32x4_t prior = vdupq_n_u32(0);
+      for (int j = 0; j < i; ++j) {
+        if (plan.same_before[i] & (1u << j))
+          prior = vsubq_u32(prior, not_green[j]);
+      }
+      const uint32x4_t yellow =
+          vandq_u32(not_green[i], vcgtq_u32(remaining, prior));
+      const uint32x4_t code =
+          vorrq_u32(vbicq_u32(two, not_green[i]), vandq_u32(yellow, one));
+      feedback = vaddq_u32(vmulq_n_u32(feedback, 3), code);
+    }
+    return vmovn_u32(feedback);
+  };
+
+  size_t idx = 0;
+  for (; idx + 8 <= n; idx += 8) {
+    const uint16x8_t wide =
+        vcombine_u16(lanes(answers + idx), lanes(answers + idx + 4));
+    vst1_u8(out + idx, vmovn_u16(wide));
+  }
+  feedback_batch_scalar(guess, answers + idx, n - idx, out + idx);
+}
+
+#endif
+
+using FeedbackBatchFn = void (*)(encoded_word, const encoded_word *, size_t,
+                                 uint8_t *);
+
+FeedbackBatchFn select_feedback_batch() {
+#if defined(WORDLE_HAVE_NEON_KERNEL)
+  return feedback_batch_neon;
+#elif defined(WORDLE_HAVE_AVX2_KERNEL)
+  if (__builtin_cpu_supports("avx2"))
+    return feedback_batch_avx2;
+  return feedback_batch_scalar;
+#else
+  return feedback_batch_scalar;
+#endif
+}
+
+FeedbackBatchFn feedback_batch_kernel() {
+  static const FeedbackBatchFn kernel = select_feedback_batch();
+  return kernel;
+}
+
+} // namespace
+
+void calculate_feedback_batch(encoded_word guess, const encoded_word *answers,
+                              size_t n, uint8_t *out) {
+  feedback_batch_kernel()(guess, answers, n, out);
+}
+
+const char *feedback_batch_kernel_name() {
+#if defined(WORDLE_HAVE_NEON_KERNEL)
+  return "neon";
+#elif defined(WORDLE_HAVE_AVX2_KERNEL)
+  return feedback_batch_kernel() == feedback_batch_avx2 ? "avx2" : "scalar";
+#else
+  return "scalar";
+#endif
+}
@@ -2,270 +2,1276 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
-#include <numeric>
-#include <unordered_set>
+#include <mutex>
+#include <new>
+#include <unordered_map>
 #include <vector>
 
+#include "candidate_set.h"
 #include "solver_core.h"
 #include "solver_runtime.h"
+#include "thread_pool.h"
 #include "words_data.h"
 
 namespace {
 
+// Subtrees are shared between every edge whose state was served from the
+// memo, so the tree is a DAG. Nodes and their edge arrays live in a
+// TreeArena and are only released together, when generation ends.
+struct TreeNode;
+
 struct TreeEdge {
   uint16_t feedback = 0;
   encoded_word next_guess = 0;
-  std::unique_ptr<struct TreeNode> child;
+  const TreeNode *child = nullptr;
 };
 
 struct TreeNode {
   encoded_word guess = 0;
-  std::vector<TreeEdge> edges;
+  uint32_t edge_count = 0;
+  TreeEdge *edges = nullptr;
+
+  const TreeEdge *begin() const { return edges; }
+  const TreeEdge *end() const { return edges + edge_count; }
 };
 
+// Bump allocator for nodes, each followed by its edge array. Nodes built for
+// abandoned guess attempts are not reclaimed individually; they stay until
+// the arena is destroyed with the rest of the tree.
+class TreeArena {
+public:
+  TreeNode *make_node(encoded_word guess, size_t edge_count) {
+    static_assert(sizeof(TreeNode) % alignof(TreeEdge) == 0,
+                  "edges must directly follow their node");
+    const size_t bytes = sizeof(TreeNode) + edge_count * sizeof(TreeEdge);
+    uint8_t *memory = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (chunks_.empty() || used_ + bytes > kChunkSize) {
+        chunks_.emplace_back(new uint8_t[std::max(kChunkSize, bytes)]);
+        used_ = 0;
+      }
+      memory = chunks_.back().get() + used_;
+      used_ += bytes;
+      bytes_ += bytes;
+    }
+    auto *node = new (memory) TreeNode;
+    node->guess = guess;
+    node->edge_count = static_cast<uint32_t>(edge_count);
+    node->edges = new (memory + sizeof(TreeNode)) TreeEdge[edge_count];
+    return node;
+  }
+
+  size_t bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+  }
+
+private:
+  static constexpr size_t kChunkSize = size_t{1} << 20;
+
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<uint8_t[]>> chunks_;
+  size_t used_ = 0;
+  size_t bytes_ = 0;
+};
+
+// Depths past this share the last DepthStats slot.
+constexpr size_t kStatsMaxDepth = 16;
+// Partition sizes are histogrammed into power-of-two buckets: bucket b
+// counts children of [2^b, 2^(b+1)) candidates, the last one everything
+// larger.
+constexpr size_t kPartitionBuckets = 16;
+// How often a running generation rewrites its --stats-json report.
+constexpr auto kStatsJsonInterval = std::chrono::seconds(5);
+
+// Work done in solve_state at one depth, excluding its subtrees.
+struct DepthStats {
+  std::atomic<uint64_t> states{0};
+  std::atomic<uint64_t> candidates{0};
+  std::atomic<uint64_t> guesses_tried{0};
+  std::atomic<uint64_t> backtracks{0};
+  std::atomic<uint64_t> search_ns{0};
+  std::atomic<uint64_t> partition_ns{0};
+};
+
+// Shared by every subtree task; counters are only ever incremented.
 struct ProgressStats {
-  size_t states_completed = 0;
-  size_t guesses_tried = 0;
-  size_t backtracks = 0;
-  uint32_t max_depth = 0;
-  std::chrono::steady_clock::time_point last_log =
+  std::atomic<size_t> states_completed{0};
+  std::atomic<size_t> guesses_tried{0};
+  std::atomic<size_t> backtracks{0};
+  std::atomic<uint32_t> max_depth{0};
+  std::atomic<size_t> memo_hits{0};
+  std::atomic<size_t> memo_failure_hits{0};
+  std::atomic<size_t> memo_misses{0};
+  std::atomic<size_t> memo_evictions{0};
+  std::array<DepthStats, kStatsMaxDepth> depths;
+  std::array<std::atomic<uint64_t>, kPartitionBuckets> partition_sizes{};
+  std::atomic<uint64_t> table_partitions{0};
+  std::atomic<uint64_t> live_partitions{0};
+  GuessSearchStats search;
+  // Held only while a progress line (and stats JSON) is written.
+  std::mutex log_mutex;
+  const std::chrono::steady_clock::time_point started =
       std::chrono::steady_clock::now();
+  // When the last progress line was printed, in ns since `started`.
+  std::atomic<uint64_t> last_log_ns{0};
+  // --stats-json destination; empty when no report was requested.
+  std::string json_path;
+  bool table_loaded = false;
+  // Suppresses the progress and summary lines; errors are still printed.
+  bool quiet = false;
+  std::chrono::steady_clock::time_point last_json = started;
 };
 
-void log_progress(ProgressStats &stats, bool force = false) {
-  auto now = std::chrono::steady_clock::now();
-  if (!force && stats.states_completed == 0) {
-    return;
+uint64_t elapsed_ns(std::chrono::steady_clock::time_point since) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - since)
+          .count());
+}
+
+double ns_to_ms(uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+// Writes the --stats-json report through a temporary file, so a reader
+// polling it during the run never sees a partial document. `status` is
+// "running", "done" or "failed".
+void write_stats_json(const ProgressStats &stats, const char *status) {
+  const std::string temp_path = stats.json_path + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::trunc);
+    if (!out) {
+      return;
+    }
+    const uint64_t wall_ns = elapsed_ns(stats.started);
+    const unsigned int threads = ThreadPool::instance().concurrency();
+    const GuessSearchStats &search = stats.search;
+    const uint64_t scored = search.guesses_scored.load();
+    const uint64_t pruned = search.guesses_pruned.load();
+    uint64_t partition_ns = 0;
+    for (const DepthStats &depth : stats.depths) {
+      partition_ns += depth.partition_ns.load();
+    }
+    const uint64_t busy_ns = search.busy_ns.load() + partition_ns;
+
+    out << "{\"schema\":1,\"status\":\"" << status
+        << "\",\"elapsed_ms\":" << ns_to_ms(wall_ns)
+        << ",\"threads\":" << threads << ",\"feedback_source\":\""
+        << (stats.table_loaded ? "table" : "live") << "\""
+        << ",\"states\":" << stats.states_completed.load()
+        << ",\"guesses_tried\":" << stats.guesses_tried.load()
+        << ",\"backtracks\":" << stats.backtracks.load()
+        << ",\"max_depth\":" << stats.max_depth.load()
+        << ",\n \"memo\":{\"hits\":" << stats.memo_hits.load()
+        << ",\"failure_hits\":" << stats.memo_failure_hits.load()
+        << ",\"misses\":" << stats.memo_misses.load()
+        << ",\"evictions\":" << stats.memo_evictions.load() << "}"
+        << ",\n \"search\":{\"calls\":" << search.searches.load()
+        << ",\"table_calls\":" << search.table_searches.load()
+        << ",\"guesses_scored\":" << scored
+        << ",\"guesses_pruned\":" << pruned
+        << ",\"guesses_merged\":" << search.guesses_merged.load()
+        << ",\"prune_rate\":"
+        << (scored + pruned ? static_cast<double>(pruned) /
+                                  static_cast<double>(scored + pruned)
+                            : 0.0)
+        << ",\"feedback_evaluated\":" << search.feedback_evaluated.load()
+        << ",\"busy_ms\":" << ns_to_ms(search.busy_ns.load()) << "}"
+        << ",\n \"partitions\":{\"table\":" << stats.table_partitions.load()
+        << ",\"live\":" << stats.live_partitions.load()
+        << ",\"size_histogram\":[";
+    for (size_t b = 0; b < kPartitionBuckets; ++b) {
+      out << (b ? "," : "") << "{\"min\":" << (uint64_t{1} << b)
+          << ",\"count\":" << stats.partition_sizes[b].load() << "}";
+    }
+    out << "]},\n \"utilization\":"
+        << (wall_ns ? static_cast<double>(busy_ns) /
+                          (static_cast<double>(wall_ns) * threads)
+                    : 0.0)
+        << ",\n \"depths\":[";
+    bool first = true;
+    for (size_t d = 0; d < kStatsMaxDepth; ++d) {
+      const DepthStats &depth = stats.depths[d];
+      if (depth.states.load() == 0)
+        continue;
+      out << (first ? "" : ",") << "\n  {\"depth\":" << d + 1
+          << ",\"states\":" << depth.states.load()
+          << ",\"candidates\":" << depth.candidates.load()
+          << ",\"guesses_tried\":" << depth.guesses_tried.load()
+          << ",\"backtracks\":" << depth.backtracks.load()
+          << ",\"search_ms\":" << ns_to_ms(depth.search_ns.load())
+          << ",\"partition_ms\":" << ns_to_ms(depth.partition_ns.load())
+          << "}";
+      first = false;
+    }
+    out << "\n]}\n";
   }
-  if (!force && stats.states_completed % 100 != 0 &&
-      now - stats.last_log < std::chrono::seconds(2)) {
+  std::error_code ec;
+  std::filesystem::rename(temp_path, stats.json_path, ec);
+}
+
+void note_depth(ProgressStats &stats, uint32_t depth) {
+  uint32_t seen = stats.max_depth.load(std::memory_order_relaxed);
+  while (depth > seen &&
+         !stats.max_depth.compare_exchange_weak(seen, depth,
+                                                std::memory_order_relaxed)) {
+  }
+}
+
+// `completed` is the states_completed value this call just produced, or 0
+// for a forced summary line.
+void log_progress(ProgressStats &stats, size_t completed, bool force = false) {
+  if (!force && completed == 0) {
     return;
   }
-  stats.last_log = now;
-  std::cerr << "\r[generate] states=" << stats.states_completed
-            << " guesses=" << stats.guesses_tried
-            << " backtracks=" << stats.backtracks
-            << " max_depth=" << stats.max_depth << std::flush;
-  if (force) {
-    std::cerr << std::endl;
+  // Decide without the lock: most finished states print nothing, and
+  // sibling builds would otherwise all queue on it just to find that out.
+  // When the 2 s throttle lapses, the thread that advances last_log_ns
+  // prints and the rest skip.
+  constexpr uint64_t kLogIntervalNs = 2'000'000'000;
+  const uint64_t now_ns = elapsed_ns(stats.started);
+  if (!force && completed % 100 != 0) {
+    uint64_t last = stats.last_log_ns.load(std::memory_order_relaxed);
+    if (now_ns - last < kLogIntervalNs ||
+        !stats.last_log_ns.compare_exchange_strong(
+            last, now_ns, std::memory_order_relaxed)) {
+      return;
+    }
+  } else {
+    stats.last_log_ns.store(now_ns, std::memory_order_relaxed);
+  }
+  std::lock_guard<std::mutex> lock(stats.log_mutex);
+  const auto now = std::chrono::steady_clock::now();
+  if (!stats.quiet) {
+    std::cerr << "\r[generate] states=" << stats.states_completed.load()
+              << " guesses=" << stats.guesses_tried.load()
+              << " backtracks=" << stats.backtracks.load()
+              << " max_depth=" << stats.max_depth.load() << std::flush;
+    if (force) {
+      std::cerr << std::endl;
+    }
+  }
+  if (!force && !stats.json_path.empty() &&
+      now - stats.last_json >= kStatsJsonInterval) {
+    stats.last_json = now;
+    write_stats_json(stats, "running");
   }
 }
 
-void partition_indices(const std::vector<size_t> &indices, encoded_word guess,
-                       const std::vector<encoded_word> &words,
-                       const FeedbackTable *feedback_table,
-                       const LookupTables &lookups,
-                       std::array<std::vector<size_t>, 243> &partitions) {
-  for (auto &bucket : partitions) {
-    bucket.clear();
+// Upper bound on answer indices held by the memo (about 64 MB). Once it is
+// reached the cache is flushed; the subtrees themselves stay in the arena.
+constexpr size_t kSubtreeMemoMaxMembers = size_t{1} << 24;
+
+// Solved and proven-unsolvable states keyed by (candidate set, depth
+// remaining). build_subtree's result depends on nothing else, so a hit is
+// exactly what re-solving the state would produce. The search behind a
+// failure tries every guess, so a state that fails with r turns left also
+// fails with fewer, and failure entries answer those lookups too.
+class SubtreeMemo {
+public:
+  static uint64_t hash(const CandidateSet &set) {
+    uint64_t h = 0x9E3779B97F4A7C15ull;
+    set.for_each([&](size_t idx) {
+      h ^= idx + 0x9E3779B97F4A7C15ull + (h << 6) + (h >> 2);
+    });
+    return h;
   }
-  if (feedback_table && feedback_table->loaded()) {
-    const auto it = lookups.word_index.find(guess);
-    if (it != lookups.word_index.end()) {
-      const uint8_t *row = feedback_table->row(it->second);
-      for (const auto idx : indices) {
-        partitions[row[idx]].push_back(idx);
+
+  // On a hit stores the cached subtree in `node` (null for a proven failure).
+  bool find(uint64_t key, const CandidateSet &set, uint32_t depth_remaining,
+            const TreeNode *&node) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto range = entries_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      const Entry &entry = it->second;
+      const bool usable = entry.node
+                              ? entry.depth_remaining == depth_remaining
+                              : entry.depth_remaining >= depth_remaining;
+      if (usable && same_members(entry.members, set)) {
+        node = entry.node;
+        return true;
       }
-      return;
     }
+    return false;
   }
-  for (const auto idx : indices) {
-    const feedback_int fb =
-        calculate_feedback_encoded(guess, words[idx]);
-    partitions[fb].push_back(idx);
+
+  void insert(uint64_t key, const CandidateSet &set, uint32_t depth_remaining,
+              const TreeNode *node, ProgressStats &stats) {
+    Entry entry;
+    entry.depth_remaining = depth_remaining;
+    entry.members.reserve(set.size());
+    set.for_each([&](size_t idx) {
+      entry.members.push_back(static_cast<uint32_t>(idx));
+    });
+    entry.node = node;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stored_members_ + set.size() > kSubtreeMemoMaxMembers) {
+      entries_.clear();
+      stored_members_ = 0;
+      stats.memo_evictions++;
+    }
+    stored_members_ += set.size();
+    entries_.emplace(key, std::move(entry));
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
   }
+
+private:
+  struct Entry {
+    uint32_t depth_remaining = 0;
+    std::vector<uint32_t> members;
+    const TreeNode *node = nullptr;
+  };
+
+  static bool same_members(const std::vector<uint32_t> &members,
+                           const CandidateSet &set) {
+    if (members.size() != set.size())
+      return false;
+    size_t i = 0;
+    bool same = true;
+    set.for_each([&](size_t idx) { same = same && members[i++] == idx; });
+    return same;
+  }
+
+  mutable std::mutex mutex_;
+  std::unordered_multimap<uint64_t, Entry> entries_;
+  size_t stored_members_ = 0;
+};
+
+void log_memo_stats(const ProgressStats &stats, const SubtreeMemo &memo) {
+  if (stats.quiet) {
+    return;
+  }
+  std::cerr << "[generate] memo hits=" << stats.memo_hits.load()
+            << " failure_hits=" << stats.memo_failure_hits.load()
+            << " misses=" << stats.memo_misses.load()
+            << " entries=" << memo.size()
+            << " evictions=" << stats.memo_evictions.load() << std::endl;
 }
 
-bool build_subtree(TreeNode &node, const std::vector<size_t> &indices,
-                   uint32_t depth_remaining, uint32_t total_depth,
-                   const std::vector<encoded_word> &words,
-                   const std::vector<uint32_t> &weights,
-                   const FeedbackTable *feedback_table,
-                   const LookupTables &lookups,
-                   ProgressStats &stats, encoded_word forced_guess = 0) {
-  if (indices.empty()) {
+// Raised on an attempt once one of its branches fails. Subtree builds check
+// the whole chain, so cancelling an attempt stops everything below it.
+struct CancelToken {
+  const CancelToken *parent = nullptr;
+  std::atomic<bool> cancelled{false};
+
+  bool stop_requested() const {
+    for (const CancelToken *t = this; t; t = t->parent) {
+      if (t->cancelled.load(std::memory_order_relaxed))
+        return true;
+    }
     return false;
   }
-  if (indices.size() == 1) {
-    node.guess = words[indices.front()];
-    node.edges.clear();
+};
+
+// Nodes with fewer candidates build their branches inline; their subtrees
+// are too small to repay a fan-out.
+constexpr size_t kParallelSubtreeMinCandidates = 64;
+
+template <typename T> void append_value(std::vector<uint8_t> &buffer, T value) {
+  buffer.insert(buffer.end(), reinterpret_cast<const uint8_t *>(&value),
+                reinterpret_cast<const uint8_t *>(&value) + sizeof(value));
+}
+
+// Append-only log of every state the memo learns, written next to the
+// output as `<output>.ckpt`. Records are appended in completion order, and a
+// node's branches always complete before it, so a record only refers to
+// earlier ones. Resuming replays the log into the memo, and finished
+// subtrees (and proven failures) are then skipped.
+struct CheckpointHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t word_count;
+  uint32_t answer_count;
+  uint64_t word_hash;
+  uint64_t answer_hash;
+};
+static_assert(sizeof(CheckpointHeader) == 32, "CheckpointHeader must be 32 bytes");
+
+struct CheckpointRecord {
+  uint32_t member_count;
+  uint8_t kind;
+  uint8_t depth_remaining;
+  uint16_t edge_count;
+  uint64_t guess; // encoded_word
+};
+static_assert(sizeof(CheckpointRecord) == 16, "CheckpointRecord must be 16 bytes");
+
+// Followed by uint32 members[member_count] and, for solved states,
+// CheckpointEdge[edge_count]. child is a 1-based record number, 0 = leaf.
+struct CheckpointEdge {
+  uint16_t feedback;
+  uint16_t reserved;
+  uint32_t child;
+  uint64_t next_guess; // encoded_word
+};
+static_assert(sizeof(CheckpointEdge) == 16, "CheckpointEdge must be 16 bytes");
+
+constexpr uint32_t kCheckpointVersion = 1;
+constexpr uint8_t kCheckpointSolved = 1;
+constexpr uint8_t kCheckpointFailed = 2;
+// Pending records are written out at least this often (or once 1 MB has
+// accumulated), so an interrupted run loses only the last few seconds.
+constexpr auto kCheckpointFlushInterval = std::chrono::seconds(2);
+constexpr size_t kCheckpointFlushBytes = size_t{1} << 20;
+
+class GenerationCheckpoint {
+public:
+  // Replays an existing checkpoint when `resume` is set, then opens the file
+  // for appending (truncating any torn tail or, without `resume`, the whole
+  // file).
+  bool open(const std::string &path, const std::vector<encoded_word> &words,
+            const std::vector<encoded_word> &answers, bool resume,
+            TreeArena &tree, SubtreeMemo &memo, ProgressStats &stats) {
+    path_ = path;
+    CheckpointHeader header{};
+    std::memcpy(header.magic, "GCKP", 4);
+    header.version = kCheckpointVersion;
+    header.word_count = static_cast<uint32_t>(words.size());
+    header.answer_count = static_cast<uint32_t>(answers.size());
+    header.word_hash = hash_word_list(words);
+    header.answer_hash = hash_word_list(answers);
+
+    std::streamoff valid = 0;
+    if (resume) {
+      valid = replay(header, answers.size(), tree, memo, stats);
+    }
+    if (valid == 0) {
+      std::ofstream fresh(path_, std::ios::binary | std::ios::trunc);
+      fresh.write(reinterpret_cast<const char *>(&header), sizeof(header));
+      if (!fresh) {
+        std::cerr << "Failed to create checkpoint '" << path_ << "'.\n";
+        return false;
+      }
+    } else {
+      std::error_code ec;
+      std::filesystem::resize_file(path_, static_cast<uintmax_t>(valid), ec);
+      if (ec) {
+        std::cerr << "Failed to truncate checkpoint '" << path_
+                  << "': " << ec.message() << "\n";
+        return false;
+      }
+    }
+    out_.open(path_, std::ios::binary | std::ios::app);
+    if (!out_) {
+      std::cerr << "Failed to open checkpoint '" << path_ << "'.\n";
+      return false;
+    }
+    last_flush_ = std::chrono::steady_clock::now();
     return true;
   }
+
+  // `node` is null for a proven failure. Every subtree below `node` must
+  // already have been recorded.
+  void record(const CandidateSet &set, uint32_t depth_remaining,
+              const TreeNode *node) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (node && ids_.count(node))
+      return;
+    CheckpointRecord rec{};
+    rec.member_count = static_cast<uint32_t>(set.size());
+    rec.kind = node ? kCheckpointSolved : kCheckpointFailed;
+    rec.depth_remaining = static_cast<uint8_t>(depth_remaining);
+    rec.edge_count = node ? static_cast<uint16_t>(node->edge_count) : 0;
+    rec.guess = node ? node->guess : 0;
+    append_value(pending_, rec);
+    set.for_each([&](size_t idx) {
+      append_value(pending_, static_cast<uint32_t>(idx));
+    });
+    if (node) {
+      for (const auto &edge : *node) {
+        CheckpointEdge ce{};
+        ce.feedback = edge.feedback;
+        ce.child = edge.child ? ids_.at(edge.child) : 0;
+        ce.next_guess = edge.next_guess;
+        append_value(pending_, ce);
+      }
+      ids_.emplace(node, next_id_);
+    }
+    ++next_id_;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (pending_.size() >= kCheckpointFlushBytes ||
+        now - last_flush_ >= kCheckpointFlushInterval) {
+      flush_locked();
+      last_flush_ = now;
+    }
+  }
+
+  bool close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flush_locked();
+    out_.close();
+    return static_cast<bool>(out_);
+  }
+
+private:
+  void flush_locked() {
+    out_.write(reinterpret_cast<const char *>(pending_.data()),
+               static_cast<std::streamsize>(pending_.size()));
+    out_.flush();
+    pending_.clear();
+  }
+
+  // Loads every complete record and returns the byte length they span, or
+  // 0 when the file is missing or belongs to a different word list.
+  std::streamoff replay(const CheckpointHeader &expected, size_t answer_count,
+                        TreeArena &tree, SubtreeMemo &memo,
+                        ProgressStats &stats) {
+    std::ifstream in(path_, std::ios::binary);
+    if (!in) {
+      std::cerr << "[generate] no checkpoint at '" << path_
+                << "'; starting fresh.\n";
+      return 0;
+    }
+    CheckpointHeader header{};
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, expected.magic, 4) != 0 ||
+        header.version != expected.version ||
+        header.word_count != expected.word_count ||
+        header.answer_count != expected.answer_count ||
+        header.word_hash != expected.word_hash ||
+        header.answer_hash != expected.answer_hash) {
+      std::cerr << "[generate] checkpoint '" << path_
+                << "' was written for a different word list; starting "
+                   "fresh.\n";
+      return 0;
+    }
+
+    std::vector<uint64_t> bits(candidate_words_for(answer_count), 0);
+    std::vector<uint32_t> members;
+    std::vector<CheckpointEdge> edges;
+    std::vector<const TreeNode *> nodes{nullptr};
+    std::streamoff valid = sizeof(header);
+    size_t solved = 0;
+    size_t failed = 0;
+    CheckpointRecord rec{};
+    while (in.read(reinterpret_cast<char *>(&rec), sizeof(rec))) {
+      if ((rec.kind != kCheckpointSolved && rec.kind != kCheckpointFailed) ||
+          rec.member_count < 2 || rec.member_count > answer_count ||
+          rec.edge_count > 243) {
+        break;
+      }
+      members.resize(rec.member_count);
+      edges.resize(rec.kind == kCheckpointSolved ? rec.edge_count : 0);
+      if (!in.read(reinterpret_cast<char *>(members.data()),
+                   static_cast<std::streamsize>(members.size() *
+                                                sizeof(uint32_t))) ||
+          !in.read(reinterpret_cast<char *>(edges.data()),
+                   static_cast<std::streamsize>(edges.size() *
+                                                sizeof(CheckpointEdge)))) {
+        break;
+      }
+      bool ok = true;
+      CandidateSet set;
+      set.bits = bits.data();
+      for (size_t i = 0; i < members.size() && ok; ++i) {
+        ok = members[i] < answer_count && (i == 0 || members[i] > members[i - 1]);
+        if (ok)
+          set.push_back(members[i]);
+      }
+      for (const auto &edge : edges) {
+        ok = ok && edge.feedback < 243 && edge.child < nodes.size() &&
+             (edge.child == 0 || nodes[edge.child]);
+      }
+      if (!ok) {
+        set.clear();
+        break;
+      }
+
+      const TreeNode *node = nullptr;
+      if (rec.kind == kCheckpointSolved) {
+        TreeNode *built = tree.make_node(rec.guess, edges.size());
+        for (size_t i = 0; i < edges.size(); ++i) {
+          built->edges[i].feedback = edges[i].feedback;
+          built->edges[i].next_guess = edges[i].next_guess;
+          built->edges[i].child = nodes[edges[i].child];
+        }
+        node = built;
+        ids_.emplace(node, next_id_);
+        ++solved;
+      } else {
+        ++failed;
+      }
+      memo.insert(SubtreeMemo::hash(set), set, rec.depth_remaining, node,
+                  stats);
+      set.clear();
+      nodes.push_back(node);
+      ++next_id_;
+      valid = in.tellg();
+    }
+    std::cerr << "[generate] resumed " << solved << " solved and " << failed
+              << " failed states from '" << path_ << "'.\n";
+    return valid;
+  }
+
+  std::string path_;
+  std::mutex mutex_;
+  std::ofstream out_;
+  std::vector<uint8_t> pending_;
+  std::unordered_map<const TreeNode *, uint32_t> ids_;
+  uint32_t next_id_ = 1;
+  std::chrono::steady_clock::time_point last_flush_;
+};
+
+// Everything build_subtree needs besides the state itself.
+struct GeneratorContext {
+  const std::vector<encoded_word> &words;
+  const std::vector<encoded_word> &answers;
+  const FeedbackTable *feedback_table;
+  const LookupTables &lookups;
+  uint32_t total_depth;
+  PartitionArenaPool &arenas;
+  TreeArena &tree;
+  SubtreeMemo &memo;
+  GenerationCheckpoint &checkpoint;
+  ProgressStats &stats;
+};
+
+// Splits `parent` into arena children by feedback against
+// words[guess_index]. Members are visited in ascending order, so every child
+// is filled in order too.
+void partition_candidates(const CandidateSet &parent, size_t guess_index,
+                          const std::vector<encoded_word> &words,
+                          const std::vector<encoded_word> &answers,
+                          const FeedbackTable *feedback_table,
+                          PartitionArena &arena) {
+  arena.reset();
+  if (feedback_table && feedback_table->loaded()) {
+    const uint8_t *row = feedback_table->row(guess_index);
+    parent.for_each([&](size_t idx) { arena.child(row[idx]).push_back(idx); });
+    return;
+  }
+  const encoded_word guess = words[guess_index];
+  constexpr size_t kBlock = 64;
+  std::array<size_t, kBlock> block_indices;
+  std::array<encoded_word, kBlock> block_words;
+  std::array<uint8_t, kBlock> block_feedback;
+  size_t len = 0;
+  auto flush = [&]() {
+    calculate_feedback_batch(guess, block_words.data(), len,
+                             block_feedback.data());
+    for (size_t i = 0; i < len; ++i) {
+      arena.child(block_feedback[i]).push_back(block_indices[i]);
+    }
+    len = 0;
+  };
+  parent.for_each([&](size_t idx) {
+    block_indices[len] = idx;
+    block_words[len] = answers[idx];
+    if (++len == kBlock)
+      flush();
+  });
+  if (len > 0)
+    flush();
+}
+
+const TreeNode *solve_state(const CandidateSet &candidates,
+                            uint32_t depth_remaining, GeneratorContext &ctx,
+                            const CancelToken &cancel,
+                            encoded_word forced_guess);
+
+// Returns the subtree for `candidates`, or null when no guess resolves every
+// branch within `depth_remaining` turns or `cancel` was raised. The forced
+// root guess bypasses the memo; every other state is looked up first and
+// recorded once solved. Cancelled builds are never recorded.
+const TreeNode *build_subtree(const CandidateSet &candidates,
+                              uint32_t depth_remaining, GeneratorContext &ctx,
+                              const CancelToken &cancel,
+                              encoded_word forced_guess = 0) {
+  if (forced_guess != 0 || candidates.size() <= 1 || depth_remaining == 0) {
+    return solve_state(candidates, depth_remaining, ctx, cancel, forced_guess);
+  }
+  const uint64_t key = SubtreeMemo::hash(candidates);
+  const TreeNode *node = nullptr;
+  if (ctx.memo.find(key, candidates, depth_remaining, node)) {
+    if (node) {
+      ctx.stats.memo_hits++;
+    } else {
+      ctx.stats.memo_failure_hits++;
+    }
+    return node;
+  }
+  ctx.stats.memo_misses++;
+  node = solve_state(candidates, depth_remaining, ctx, cancel, 0);
+  if (node || !cancel.stop_requested()) {
+    ctx.memo.insert(key, candidates, depth_remaining, node, ctx.stats);
+    ctx.checkpoint.record(candidates, depth_remaining, node);
+  }
+  return node;
+}
+
+// Sibling branches are independent, so large nodes build them as pool tasks.
+// Each result lands in its feedback slot and edges are assembled in feedback
+// order, and every state's result is a pure function of the state, so the
+// tree matches a serial build exactly. The first failing branch cancels the
+// rest of the attempt.
+const TreeNode *solve_state(const CandidateSet &candidates,
+                            uint32_t depth_remaining, GeneratorContext &ctx,
+                            const CancelToken &cancel,
+                            encoded_word forced_guess) {
+  if (candidates.empty()) {
+    return nullptr;
+  }
+  if (candidates.size() == 1) {
+    return ctx.tree.make_node(ctx.answers[candidates.first()], 0);
+  }
   if (depth_remaining == 0) {
-    return false;
+    return nullptr;
   }
 
-  const uint32_t current_depth = total_depth - depth_remaining + 1;
-  stats.max_depth = std::max(stats.max_depth, current_depth);
+  ProgressStats &stats = ctx.stats;
+  const uint32_t current_depth = ctx.total_depth - depth_remaining + 1;
+  note_depth(stats, current_depth);
+  DepthStats &depth_stats =
+      stats.depths[std::min<size_t>(current_depth, kStatsMaxDepth) - 1];
+  depth_stats.states.fetch_add(1, std::memory_order_relaxed);
+  depth_stats.candidates.fetch_add(candidates.size(),
+                                   std::memory_order_relaxed);
+  const auto lease = ctx.arenas.acquire();
+  PartitionArena &arena = *lease;
+  auto &indices = arena.indices;
+  indices.clear();
+  candidates.for_each([&](size_t idx) { indices.push_back(idx); });
+  const bool parallel = candidates.size() >= kParallelSubtreeMinCandidates;
 
-  std::unordered_set<encoded_word> banned;
-  bool use_forced = forced_guess != 0;
+  // Guesses already tried for this state. Most states succeed first time,
+  // so the per-word mask is only allocated for a retry.
+  size_t first_tried = kNoWordIndex;
+  std::vector<uint8_t> banned;
+  const size_t forced_index = forced_guess != 0
+                                  ? ctx.lookups.word_index.find(forced_guess)
+                                  : kNoWordIndex;
+  bool use_forced = forced_index != kNoWordIndex;
+  // Every retry searches the same state, so its guess classes are found
+  // once. Searches only return class representatives, so banning one bans
+  // its class: the others give the same partition and would fail the same
+  // way.
+  std::vector<uint32_t> distinct_guesses;
+  bool classes_found = false;
+  bool reduced = false;
+  std::vector<uint16_t> branch_feedback;
+  std::vector<const TreeNode *> branches;
 
   while (true) {
-    encoded_word guess = 0;
+    if (cancel.stop_requested()) {
+      return nullptr;
+    }
+    size_t guess_index = kNoWordIndex;
     if (use_forced) {
-      guess = forced_guess;
+      guess_index = forced_index;
       use_forced = false;
     } else {
-      guess = find_best_guess_encoded(indices, words, feedback_table, lookups,
-                                      weights, &banned);
+      if (first_tried != kNoWordIndex && banned.empty()) {
+        banned.assign(ctx.words.size(), 0);
+        banned[first_tried] = 1;
+      }
+      const auto search_start = std::chrono::steady_clock::now();
+      if (!classes_found) {
+        reduced = distinct_guess_indices(indices, ctx.words, ctx.answers,
+                                         distinct_guesses);
+        classes_found = true;
+      }
+      guess_index = find_best_guess_index(
+          indices, ctx.words, ctx.answers, ctx.feedback_table,
+          banned.empty() ? nullptr : &banned, nullptr, &stats.search,
+          reduced ? &distinct_guesses : nullptr);
+      depth_stats.search_ns.fetch_add(elapsed_ns(search_start),
+                                      std::memory_order_relaxed);
     }
 
-    if (guess == 0) {
+    if (guess_index == kNoWordIndex) {
       stats.backtracks++;
-      return false;
+      depth_stats.backtracks.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
     }
 
-    if (!use_forced) {
-      banned.insert(guess);
+    if (first_tried == kNoWordIndex) {
+      first_tried = guess_index;
+    } else {
+      banned[guess_index] = 1;
     }
+    const encoded_word guess = ctx.words[guess_index];
 
     stats.guesses_tried++;
-    node.guess = guess;
-    std::array<std::vector<size_t>, 243> partitions;
-    partition_indices(indices, guess, words, feedback_table, lookups,
-                      partitions);
+    depth_stats.guesses_tried.fetch_add(1, std::memory_order_relaxed);
+    const auto partition_start = std::chrono::steady_clock::now();
+    partition_candidates(candidates, guess_index, ctx.words, ctx.answers,
+                         ctx.feedback_table, arena);
+    depth_stats.partition_ns.fetch_add(elapsed_ns(partition_start),
+                                       std::memory_order_relaxed);
+    (stats.table_loaded ? stats.table_partitions : stats.live_partitions)
+        .fetch_add(1, std::memory_order_relaxed);
+
+    branch_feedback.clear();
+    size_t edge_count = 0;
+    std::array<uint32_t, kPartitionBuckets> size_counts{};
+    for (uint16_t fb = 0; fb < 243; ++fb) {
+      const size_t size = arena.child(fb).size();
+      if (size == 0)
+        continue;
+      ++edge_count;
+      if (size > 1) {
+        branch_feedback.push_back(fb);
+      }
+      size_t bucket = 0;
+      while (bucket + 1 < kPartitionBuckets && (size >> (bucket + 1)) != 0) {
+        ++bucket;
+      }
+      ++size_counts[bucket];
+    }
+    for (size_t b = 0; b < kPartitionBuckets; ++b) {
+      if (size_counts[b] != 0) {
+        stats.partition_sizes[b].fetch_add(size_counts[b],
+                                           std::memory_order_relaxed);
+      }
+    }
+    branches.assign(branch_feedback.size(), nullptr);
+
+    CancelToken attempt;
+    attempt.parent = &cancel;
+    auto build_branch = [&](size_t i) {
+      if (attempt.stop_requested())
+        return;
+      branches[i] = build_subtree(arena.child(branch_feedback[i]),
+                                  depth_remaining - 1, ctx, attempt);
+      if (!branches[i]) {
+        attempt.cancelled.store(true, std::memory_order_relaxed);
+      }
+    };
+    if (parallel && branch_feedback.size() > 1) {
+      ThreadPool::instance().parallel_for(
+          0, branch_feedback.size(), 1,
+          [&](size_t begin, size_t end, unsigned int) {
+            for (size_t i = begin; i < end; ++i) {
+              build_branch(i);
+            }
+          });
+    } else {
+      for (size_t i = 0; i < branch_feedback.size() && !attempt.stop_requested();
+           ++i) {
+        build_branch(i);
+      }
+    }
+
+    if (!attempt.cancelled.load()) {
+      TreeNode *node = ctx.tree.make_node(guess, edge_count);
+      TreeEdge *edge = node->edges;
+      size_t next_branch = 0;
+      for (uint16_t fb = 0; fb < 243; ++fb) {
+        const CandidateSet &subset = arena.child(fb);
+        if (subset.empty())
+          continue;
+        edge->feedback = fb;
+        if (subset.size() == 1) {
+          edge->next_guess = ctx.answers[subset.first()];
+        } else {
+          edge->child = branches[next_branch++];
+          edge->next_guess = edge->child->guess;
+        }
+        ++edge;
+      }
+      log_progress(stats, ++stats.states_completed);
+      return node;
+    }
 
-    bool success = true;
-    std::vector<TreeEdge> edges;
-    edges.reserve(243);
+    stats.backtracks++;
+    depth_stats.backtracks.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// Replays a previous lookup tree into the memo. A file node is reused for
+// the state it reaches under the new answer list only if that state still
+// has exactly the members it had when the file was built: every edge must
+// match a non-empty subset, leaf edges must name that subset's single
+// answer, and internal edges must recurse successfully. The guesses must
+// also still be in the vocabulary. Reused subtrees are not re-optimised for
+// guesses added since, so the result can differ from a full regeneration
+// wherever one of them would now score better.
+class PreviousTreeSeeder {
+public:
+  PreviousTreeSeeder(const PrecomputedLookup &previous, GeneratorContext &ctx)
+      : previous_(previous), ctx_(ctx) {}
 
+  const TreeNode *seed(const uint8_t *file_node, encoded_word guess,
+                       const CandidateSet &candidates,
+                       uint32_t depth_remaining) {
+    const size_t guess_index = ctx_.lookups.word_index.find(guess);
+    if (depth_remaining == 0 || candidates.size() <= 1 ||
+        guess_index == kNoWordIndex) {
+      return nullptr;
+    }
+    const uint64_t key = SubtreeMemo::hash(candidates);
+    const TreeNode *node = nullptr;
+    if (ctx_.memo.find(key, candidates, depth_remaining, node)) {
+      return node;
+    }
+
+    const auto lease = ctx_.arenas.acquire();
+    PartitionArena &arena = *lease;
+    partition_candidates(candidates, guess_index, ctx_.words, ctx_.answers,
+                         ctx_.feedback_table, arena);
+    // Keep walking after a mismatch: unchanged siblings are still reusable
+    // even though this node is not.
+    std::array<const TreeNode *, 243> children{};
+    std::array<encoded_word, 243> next_guesses{};
+    size_t edge_count = 0;
+    bool unchanged = true;
     for (uint16_t fb = 0; fb < 243; ++fb) {
-      auto &subset = partitions[fb];
-      if (subset.empty())
+      const CandidateSet &subset = arena.child(fb);
+      encoded_word next_guess = 0;
+      const uint8_t *child = previous_.find_child(file_node, fb, next_guess);
+      if (next_guess == 0 || subset.empty()) {
+        unchanged = unchanged && next_guess == 0 && subset.empty();
         continue;
-      TreeEdge edge;
-      edge.feedback = fb;
-      if (subset.size() == 1) {
-        edge.next_guess = words[subset[0]];
+      }
+      if (!child) {
+        unchanged = unchanged && subset.size() == 1 &&
+                    ctx_.answers[subset.first()] == next_guess;
       } else {
-        auto child = std::make_unique<TreeNode>();
-        if (!build_subtree(*child, subset, depth_remaining - 1, total_depth,
-                           words, weights, feedback_table, lookups, stats)) {
-          success = false;
-          break;
-        }
-        edge.next_guess = child->guess;
-        edge.child = std::move(child);
+        children[fb] = seed(child, next_guess, subset, depth_remaining - 1);
+        unchanged = unchanged && children[fb];
       }
-      edges.push_back(std::move(edge));
+      next_guesses[fb] = next_guess;
+      ++edge_count;
+    }
+    if (!unchanged) {
+      return nullptr;
     }
 
-    if (success) {
-      std::sort(edges.begin(), edges.end(),
-                [](const TreeEdge &a, const TreeEdge &b) {
-                  return a.feedback < b.feedback;
-                });
-      node.edges = std::move(edges);
-      stats.states_completed++;
-      log_progress(stats);
-      return true;
+    TreeNode *built = ctx_.tree.make_node(guess, edge_count);
+    TreeEdge *edge = built->edges;
+    for (uint16_t fb = 0; fb < 243; ++fb) {
+      if (next_guesses[fb] == 0)
+        continue;
+      edge->feedback = fb;
+      edge->next_guess = next_guesses[fb];
+      edge->child = children[fb];
+      ++edge;
     }
+    ctx_.memo.insert(key, candidates, depth_remaining, built, ctx_.stats);
+    ctx_.checkpoint.record(candidates, depth_remaining, built);
+    ++reused_;
+    return built;
+  }
 
-    stats.backtracks++;
+  size_t reused() const { return reused_; }
+
+private:
+  const PrecomputedLookup &previous_;
+  GeneratorContext &ctx_;
+  size_t reused_ = 0;
+};
+
+// Write order plus every node's absolute file offset. Offsets are fixed
+// before the first node is written, so each node streams out as one record
+// with its child offsets already filled in.
+struct TreeLayout {
+  std::vector<const TreeNode *> order;
+  std::unordered_map<const TreeNode *, uint32_t> offsets;
+};
+
+// v1/v2 keep the historical depth-first pre-order. Shared subtrees are
+// placed at their first visit and reused by later edges.
+void collect_preorder(const TreeNode &node, TreeLayout &layout) {
+  layout.order.push_back(&node);
+  layout.offsets.emplace(&node, 0);
+  for (const auto &edge : node) {
+    if (edge.child && !layout.offsets.count(edge.child)) {
+      collect_preorder(*edge.child, layout);
+    }
+  }
+}
+
+size_t linear_node_size(const TreeNode &node, uint32_t version) {
+  const size_t prefix = version == kLookupVersionBitmap
+                            ? kLookupBitmapNodeHeaderSize
+                            : sizeof(uint32_t);
+  return prefix + node.edge_count * kLookupEntrySize;
+}
+
+size_t compact_node_size(const TreeNode &node) {
+  const size_t count = node.edge_count;
+  size_t internal = 0;
+  for (const auto &edge : node) {
+    if (edge.child)
+      ++internal;
   }
+  const size_t feedback_bytes = count > kCompactSmallNodeLimit
+                                    ? 4 + 4 * sizeof(uint64_t)
+                                    : count;
+  return 2 + feedback_bytes + count * (sizeof(uint16_t) + 1) +
+         internal * sizeof(uint32_t);
 }
 
-uint32_t serialize_node(const TreeNode &node, std::vector<uint8_t> &buffer) {
-  const uint32_t offset = static_cast<uint32_t>(buffer.size());
-  const uint32_t count = static_cast<uint32_t>(node.edges.size());
-  buffer.insert(buffer.end(), reinterpret_cast<const uint8_t *>(&count),
-                reinterpret_cast<const uint8_t *>(&count) + sizeof(count));
-
-  std::vector<size_t> child_positions;
-  child_positions.reserve(node.edges.size());
-
-  for (const auto &edge : node.edges) {
-    buffer.insert(buffer.end(), reinterpret_cast<const uint8_t *>(&edge.feedback),
-                  reinterpret_cast<const uint8_t *>(&edge.feedback) +
-                      sizeof(edge.feedback));
-    const uint16_t reserved = 0;
-    buffer.insert(buffer.end(), reinterpret_cast<const uint8_t *>(&reserved),
-                  reinterpret_cast<const uint8_t *>(&reserved) +
-                      sizeof(reserved));
-    buffer.insert(buffer.end(),
-                  reinterpret_cast<const uint8_t *>(&edge.next_guess),
-                  reinterpret_cast<const uint8_t *>(&edge.next_guess) +
-                      sizeof(edge.next_guess));
-    child_positions.push_back(buffer.size());
-    const uint32_t placeholder = 0;
-    buffer.insert(buffer.end(),
-                  reinterpret_cast<const uint8_t *>(&placeholder),
-                  reinterpret_cast<const uint8_t *>(&placeholder) +
-                      sizeof(placeholder));
-  }
-
-  for (size_t i = 0; i < node.edges.size(); ++i) {
-    if (node.edges[i].child) {
-      const uint32_t child_offset =
-          sizeof(LookupHeader) +
-          serialize_node(*node.edges[i].child, buffer);
-      std::memcpy(buffer.data() + child_positions[i], &child_offset,
-                  sizeof(child_offset));
-    }
-  }
-
-  return offset;
+// Assigns offsets from `base_offset` in layout order; fails if the file
+// would outgrow 32-bit offsets.
+bool assign_offsets(TreeLayout &layout, uint32_t base_offset,
+                    const std::function<size_t(const TreeNode &)> &node_size) {
+  uint64_t offset = base_offset;
+  for (const TreeNode *node : layout.order) {
+    if (offset > std::numeric_limits<uint32_t>::max()) {
+      std::cerr << "Lookup tree exceeds the 4 GB offset range.\n";
+      return false;
+    }
+    layout.offsets[node] = static_cast<uint32_t>(offset);
+    offset += node_size(*node);
+  }
+  return true;
+}
+
+void append_presence(const TreeNode &node, std::vector<uint8_t> &record) {
+  // Edges are sorted by feedback, so the dense entry array is already in
+  // rank order; record the presence bitmap and per-word rank bases.
+  std::array<uint64_t, 4> presence{};
+  for (const auto &edge : node) {
+    presence[edge.feedback >> 6] |= uint64_t{1} << (edge.feedback & 63);
+  }
+  uint8_t rank = 0;
+  for (const uint64_t word : presence) {
+    append_value(record, rank);
+    for (uint64_t bits = word; bits; bits &= bits - 1)
+      ++rank;
+  }
+  for (const uint64_t word : presence) {
+    append_value(record, word);
+  }
+}
+
+void write_record(std::ostream &out, const std::vector<uint8_t> &record) {
+  out.write(reinterpret_cast<const char *>(record.data()),
+            static_cast<std::streamsize>(record.size()));
+}
+
+bool write_linear_tree(std::ostream &out, const TreeNode &root,
+                       uint32_t version, uint32_t base_offset) {
+  TreeLayout layout;
+  collect_preorder(root, layout);
+  if (!assign_offsets(layout, base_offset, [&](const TreeNode &node) {
+        return linear_node_size(node, version);
+      })) {
+    return false;
+  }
+  std::vector<uint8_t> record;
+  for (const TreeNode *node : layout.order) {
+    record.clear();
+    append_value(record, node->edge_count);
+    if (version == kLookupVersionBitmap) {
+      append_presence(*node, record);
+    }
+    for (const auto &edge : *node) {
+      append_value(record, edge.feedback);
+      append_value(record, uint16_t{0});
+      append_value(record, uint64_t{edge.next_guess});
+      append_value(record, edge.child ? layout.offsets[edge.child] : 0u);
+    }
+    write_record(out, record);
+  }
+  return true;
+}
+
+// Emits the v3 layout: nodes are numbered breadth-first so every node's
+// children (and therefore the first few turns) sit next to each other.
+bool write_compact_tree(std::ostream &out, const TreeNode &root,
+                        uint32_t base_offset, const LookupTables &lookups) {
+  TreeLayout layout;
+  layout.order.push_back(&root);
+  layout.offsets.emplace(&root, 0);
+  // Shared subtrees get one breadth-first position, at their first edge.
+  for (size_t i = 0; i < layout.order.size(); ++i) {
+    for (const auto &edge : *layout.order[i]) {
+      if (edge.child && layout.offsets.emplace(edge.child, 0).second) {
+        layout.order.push_back(edge.child);
+      }
+    }
+  }
+  if (!assign_offsets(layout, base_offset, compact_node_size)) {
+    return false;
+  }
+
+  std::vector<uint8_t> record;
+  for (const TreeNode *node : layout.order) {
+    const size_t count = node->edge_count;
+    if (count == 0 || count > 243) {
+      std::cerr << "Compact lookup nodes need 1..243 entries.\n";
+      return false;
+    }
+    record.clear();
+    append_value(record, static_cast<uint8_t>(count));
+    if (count > kCompactSmallNodeLimit) {
+      append_value(record, kCompactNodeBitmap);
+      append_presence(*node, record);
+    } else {
+      append_value(record, uint8_t{0});
+      for (const auto &edge : *node) {
+        append_value(record, static_cast<uint8_t>(edge.feedback));
+      }
+    }
+    for (const auto &edge : *node) {
+      const size_t index = lookups.word_index.find(edge.next_guess);
+      if (index == kNoWordIndex) {
+        std::cerr << "Compact lookup guess '" << decode_word(edge.next_guess)
+                  << "' is not in the word list.\n";
+        return false;
+      }
+      append_value(record, static_cast<uint16_t>(index));
+    }
+    uint8_t slot = 0;
+    for (const auto &edge : *node) {
+      append_value(record, edge.child ? slot++ : kCompactLeafSlot);
+    }
+    for (const auto &edge : *node) {
+      if (edge.child) {
+        append_value(record, layout.offsets[edge.child]);
+      }
+    }
+    write_record(out, record);
+  }
+  return true;
 }
 
 } // namespace
 
 bool generate_lookup_table(const std::string &path,
                            const std::vector<encoded_word> &words,
+                           const std::vector<encoded_word> &answers,
                            encoded_word start, uint32_t depth,
                            const FeedbackTable *feedback_table,
-                           const LookupTables &lookups) {
-  if (depth < 1) {
-    std::cerr << "Lookup depth must be at least 1.\n";
+                           const LookupTables &lookups, uint32_t version,
+                           bool resume, const PrecomputedLookup *previous,
+                           const std::string &stats_json_path, bool quiet) {
+  if (depth < 1 || depth > 255) {
+    std::cerr << "Lookup depth must be between 1 and 255.\n";
+    return false;
+  }
+  if (version != kLookupVersionLinear && version != kLookupVersionBitmap &&
+      version != kLookupVersionCompact) {
+    std::cerr << "Unsupported lookup format version " << version << ".\n";
+    return false;
+  }
+  if (version == kLookupVersionCompact && words.size() > kCompactMaxWords) {
+    std::cerr << "Compact lookup files support at most " << kCompactMaxWords
+              << " words.\n";
     return false;
   }
 
-  const auto weights = compute_word_weights(words);
-  TreeNode root;
-  std::vector<size_t> root_indices(words.size());
-  std::iota(root_indices.begin(), root_indices.end(), 0);
+  std::vector<uint64_t> root_bits(candidate_words_for(answers.size()), 0);
+  CandidateSet root_set;
+  root_set.bits = root_bits.data();
+  for (size_t i = 0; i < answers.size(); ++i) {
+    root_set.push_back(i);
+  }
+  PartitionArenaPool arenas(answers.size());
+  TreeArena tree;
 
   ProgressStats stats;
+  stats.json_path = stats_json_path;
+  stats.quiet = quiet;
+  stats.table_loaded = feedback_table && feedback_table->loaded();
+  SubtreeMemo memo;
+  GenerationCheckpoint checkpoint;
+  const std::string checkpoint_path = path + ".ckpt";
+  if (!checkpoint.open(checkpoint_path, words, answers, resume, tree, memo,
+                       stats)) {
+    return false;
+  }
+  GeneratorContext ctx{words, answers, feedback_table, lookups, depth,
+                       arenas, tree,    memo,           checkpoint, stats};
+
+  if (previous) {
+    PreviousTreeSeeder seeder(*previous, ctx);
+    seeder.seed(previous->root(), start, root_set, depth);
+    if (!quiet) {
+      std::cerr << "[generate] reused " << seeder.reused()
+                << " unchanged states from the previous lookup table.\n";
+    }
+  }
 
-  if (!build_subtree(root, root_indices, depth, depth, words, weights,
-                     feedback_table, lookups, stats, start)) {
+  const CancelToken root_cancel;
+  const TreeNode *root = build_subtree(root_set, depth, ctx, root_cancel, start);
+  log_progress(stats, 0, true);
+  log_memo_stats(stats, memo);
+  if (!stats.json_path.empty()) {
+    write_stats_json(stats, root ? "done" : "failed");
+  }
+  if (!checkpoint.close()) {
+    std::cerr << "Warning: failed to write checkpoint '" << checkpoint_path
+              << "'.\n";
+  }
+  if (!root) {
     std::cerr << "Failed to generate lookup table: depth limit too small.\n";
     return false;
   }
 
-  std::vector<uint8_t> buffer;
-  buffer.reserve(1 << 20);
-  const uint32_t root_offset = serialize_node(root, buffer);
-
-  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  // Stream the nodes straight to a temporary file next to the destination
+  // and rename it into place, so a failed write never leaves a torn table.
+  const std::string temp_path = path + ".tmp";
+  std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
   if (!out) {
-    std::cerr << "Failed to open '" << path << "' for writing.\n";
+    std::cerr << "Failed to open '" << temp_path << "' for writing.\n";
     return false;
   }
 
   LookupHeader header{};
   std::memcpy(header.magic, "PLUT", 4);
-  header.version = 1;
+  header.version = version;
   header.depth = depth;
-  header.root_offset = sizeof(LookupHeader) + root_offset;
   header.start_encoded = start;
   std::string start_word = decode_word(start);
   std::memcpy(header.start_word, start_word.c_str(),
               std::min<size_t>(5, start_word.size()));
 
-  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
-  out.write(reinterpret_cast<const char *>(buffer.data()),
-            static_cast<std::streamsize>(buffer.size()));
-  log_progress(stats, true);
-  std::cout << "Wrote lookup table '" << path << "' (" << buffer.size()
-            << " bytes, states=" << stats.states_completed
-            << ", backtracks=" << stats.backtracks << ")\n";
+  bool written = false;
+  if (version == kLookupVersionCompact) {
+    LookupWordList info{};
+    info.word_count = static_cast<uint32_t>(words.size());
+    info.word_hash = hash_word_list(words);
+    header.root_offset = sizeof(LookupHeader) + sizeof(info);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(&info), sizeof(info));
+    written = write_compact_tree(out, *root, header.root_offset, lookups);
+  } else {
+    header.root_offset = sizeof(LookupHeader);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    written = write_linear_tree(out, *root, version, header.root_offset);
+  }
+  const std::streamoff file_size = out.tellp();
+  out.close();
+  if (!written || !out) {
+    if (written) {
+      std::cerr << "Error writing lookup table to '" << temp_path << "'.\n";
+    }
+    std::remove(temp_path.c_str());
+    return false;
+  }
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    std::cerr << "Failed to move '" << temp_path << "' to '" << path
+              << "'.\n";
+    std::remove(temp_path.c_str());
+    return false;
+  }
+
+  // The finished table supersedes the checkpoint.
+  std::remove(checkpoint_path.c_str());
+
+  if (!quiet) {
+    std::cout << "Wrote lookup table '" << path << "' ("
+              << file_size - static_cast<std::streamoff>(sizeof(header))
+              << " bytes, states=" << stats.states_completed.load()
+              << ", backtracks=" << stats.backtracks.load() << ")\n";
+  }
   return true;
 }
@@ -5,10 +5,27 @@
 
 #include "feedback_cache.h"
 #include "solver_core.h"
+#include "solver_runtime.h"
 #include "words_data.h"
 
+// Builds the lookup tree for `start`, choosing guesses from `words` to split
+// the `answers` (which must be a subset of `words`; pass `words` again to
+// cover the whole vocabulary). Progress is logged to `<path>.ckpt` while the
+// tree is built and removed once `path` is written; `resume` replays an
+// existing checkpoint first. `previous`, a table built for an earlier
+// vocabulary, seeds every state whose candidate set is unchanged so only the
+// branches the vocabulary change touched are searched again.
+// `stats_json_path`, when set, receives a JSON profile of the run (see
+// DESIGN.md), rewritten every few seconds while generation is in progress.
+// `quiet` drops the progress and summary lines but still reports errors.
 bool generate_lookup_table(const std::string &path,
                            const std::vector<encoded_word> &words,
+                           const std::vector<encoded_word> &answers,
                            encoded_word start, uint32_t depth,
                            const FeedbackTable *feedback_table,
-                           const LookupTables &lookups);
+                           const LookupTables &lookups,
+                           uint32_t version = kLookupVersionCompact,
+                           bool resume = false,
+                           const PrecomputedLookup *previous = nullptr,
+                           const std::string &stats_json_path = std::string(),
+                           bool quiet = false);
@@ -0,0 +1,107 @@
+#include "lookup_registry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <utility>
+
+LookupRegistry::LookupRegistry(std::string directory, size_t budget_bytes,
+                               const std::vector<encoded_word> &words)
+    : directory_(std::move(directory)), budget_bytes_(budget_bytes),
+      words_(words) {}
+
+std::string LookupRegistry::path_for(const std::string &directory,
+                                     encoded_word start) {
+  std::string path = directory.empty() ? std::string(".") : directory;
+  if (path.back() != '/')
+    path += '/';
+  return path + "lookup_" + decode_word(start) + ".bin";
+}
+
+void LookupRegistry::pin(std::shared_ptr<const PrecomputedLookup> tree) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const encoded_word start = tree->start_word();
+  pinned_[start] = std::move(tree);
+}
+
+std::shared_ptr<const PrecomputedLookup>
+LookupRegistry::acquire(encoded_word start) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto pinned = pinned_.find(start);
+    if (pinned != pinned_.end()) {
+      ++stats_.hits;
+      return pinned->second;
+    }
+    const auto it = entries_.find(start);
+    if (it != entries_.end()) {
+      ++stats_.hits;
+      recency_.splice(recency_.begin(), recency_, it->second.position);
+      return it->second.tree;
+    }
+    ++stats_.misses;
+  }
+
+  // Load without holding the lock so a cold opener never stalls lookups of
+  // resident ones. Two threads missing on the same opener both load it; the
+  // first to finish is kept.
+  const auto load_start = std::chrono::steady_clock::now();
+  auto tree = std::make_shared<PrecomputedLookup>();
+  const bool loaded = tree->load(path_for(directory_, start), start, words_);
+  const uint64_t load_ns = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - load_start)
+          .count());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!loaded) {
+    ++stats_.load_failures;
+    return nullptr;
+  }
+  stats_.load_ns_total += load_ns;
+  stats_.load_ns_max = std::max(stats_.load_ns_max, load_ns);
+  auto it = entries_.find(start);
+  if (it == entries_.end()) {
+    recency_.push_front(start);
+    it = entries_.emplace(start, Entry{std::move(tree), recency_.begin()}).first;
+    stats_.resident_bytes += it->second.tree->size_bytes();
+    ++stats_.resident_trees;
+    evict_over_budget(start);
+  } else {
+    recency_.splice(recency_.begin(), recency_, it->second.position);
+  }
+  return it->second.tree;
+}
+
+void LookupRegistry::evict_over_budget(encoded_word keep) {
+  while (stats_.resident_bytes > budget_bytes_ && !recency_.empty() &&
+         recency_.back() != keep) {
+    const auto it = entries_.find(recency_.back());
+    stats_.resident_bytes -= it->second.tree->size_bytes();
+    --stats_.resident_trees;
+    ++stats_.evictions;
+    entries_.erase(it);
+    recency_.pop_back();
+  }
+}
+
+LookupRegistryStats LookupRegistry::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+std::string LookupRegistry::stats_summary() const {
+  const LookupRegistryStats s = stats();
+  const uint64_t loads = s.misses - s.load_failures;
+  std::ostringstream out;
+  out << "tree_hits=" << s.hits << " tree_misses=" << s.misses
+      << " tree_load_failures=" << s.load_failures
+      << " tree_evictions=" << s.evictions
+      << " trees_resident=" << s.resident_trees
+      << " tree_bytes=" << s.resident_bytes << " tree_load_mean_us="
+      << (loads ? static_cast<double>(s.load_ns_total) / 1000.0 /
+                      static_cast<double>(loads)
+                : 0.0)
+      << " tree_load_max_us=" << static_cast<double>(s.load_ns_max) / 1000.0;
+  return out.str();
+}
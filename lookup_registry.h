@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "solver_runtime.h"
+#include "words_data.h"
+
+struct LookupRegistryStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;        // lookups that had to load a file
+  uint64_t load_failures = 0; // misses whose file was absent or invalid
+  uint64_t evictions = 0;
+  uint64_t load_ns_total = 0; // across successful loads
+  uint64_t load_ns_max = 0;
+  size_t resident_trees = 0;
+  size_t resident_bytes = 0;
+};
+
+// Lookup trees for many opening words, loaded from
+// `<directory>/lookup_<start>.bin` the first time each opener is asked for
+// and evicted least-recently-used first once their combined file size
+// exceeds the budget. Trees are handed out as shared pointers, so an
+// evicted tree stays valid for callers still walking it and is unmapped
+// when the last of them lets go. Safe to call from any thread.
+class LookupRegistry {
+public:
+  // `words` resolves v3 guess indices and must outlive the registry.
+  LookupRegistry(std::string directory, size_t budget_bytes,
+                 const std::vector<encoded_word> &words = load_words());
+
+  static std::string path_for(const std::string &directory,
+                              encoded_word start);
+
+  // Serves `tree` for its opener ahead of any file, never evicted and not
+  // counted against the budget. Used for the tree compiled into the binary.
+  void pin(std::shared_ptr<const PrecomputedLookup> tree);
+
+  // The tree rooted at `start`, or null if its file is missing, invalid, or
+  // rooted elsewhere. The most recently loaded tree is kept even when it
+  // alone exceeds the budget.
+  std::shared_ptr<const PrecomputedLookup> acquire(encoded_word start);
+
+  LookupRegistryStats stats() const;
+  // Space-separated key=value form of stats(), as printed by the CLI.
+  std::string stats_summary() const;
+
+private:
+  struct Entry {
+    std::shared_ptr<const PrecomputedLookup> tree;
+    std::list<encoded_word>::iterator position; // in recency_
+  };
+
+  void evict_over_budget(encoded_word keep);
+
+  const std::string directory_;
+  const size_t budget_bytes_;
+  const std::vector<encoded_word> &words_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<encoded_word, Entry> entries_;
+  std::unordered_map<encoded_word, std::shared_ptr<const PrecomputedLookup>>
+      pinned_;
+  std::list<encoded_word> recency_; // most recently used first
+  LookupRegistryStats stats_;
+};
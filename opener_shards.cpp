@@ -0,0 +1,371 @@
+#include "opener_shards.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+#include "lookup_generator.h"
+#include "lookup_registry.h"
+#include "solver_runtime.h"
+#include "solver_session.h"
+#include "thread_pool.h"
+
+namespace {
+
+constexpr uint32_t kShardFileVersion = 1;
+
+enum ShardKind : uint16_t {
+  kShardOpenerScores = 1, // start: one partition score per opener
+  kShardTreeCosts = 2,    // generate: one full-tree cost per opener
+};
+
+struct ShardHeader {
+  char magic[4];
+  uint32_t version;
+  uint16_t kind;
+  uint16_t depth; // generate only
+  uint32_t shard_index;
+  uint32_t shard_count;
+  uint32_t opener_count; // records a complete shard holds
+  uint32_t word_count;
+  uint32_t answer_count;
+  uint64_t word_hash;
+  uint64_t answer_hash;
+};
+static_assert(sizeof(ShardHeader) == 48, "ShardHeader must be 48 bytes");
+
+struct ShardRecord {
+  uint32_t word; // encoded opener
+  uint8_t solved; // generate: every answer solved within the depth
+  uint8_t max_guesses;
+  uint16_t reserved;
+  uint64_t value; // start: partition score; generate: total guesses
+};
+static_assert(sizeof(ShardRecord) == 16, "ShardRecord must be 16 bytes");
+
+ShardHeader make_header(ShardKind kind, uint32_t depth, const ShardSpec &spec,
+                        const std::vector<encoded_word> &words,
+                        const std::vector<encoded_word> &answers) {
+  ShardHeader header{};
+  std::memcpy(header.magic, "SHRD", 4);
+  header.version = kShardFileVersion;
+  header.kind = kind;
+  header.depth = static_cast<uint16_t>(depth);
+  header.shard_index = spec.index;
+  header.shard_count = spec.count;
+  header.opener_count = static_cast<uint32_t>(
+      words.size() > spec.index
+          ? (words.size() - spec.index + spec.count - 1) / spec.count
+          : 0);
+  header.word_count = static_cast<uint32_t>(words.size());
+  header.answer_count = static_cast<uint32_t>(answers.size());
+  header.word_hash = hash_word_list(words);
+  header.answer_hash = hash_word_list(answers);
+  return header;
+}
+
+// Reads a shard file; a torn final record is dropped.
+bool read_shard_file(const std::string &path, ShardHeader &header,
+                     std::vector<ShardRecord> &records) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      std::memcmp(header.magic, "SHRD", 4) != 0 ||
+      header.version != kShardFileVersion ||
+      header.shard_index >= header.shard_count) {
+    return false;
+  }
+  records.clear();
+  ShardRecord record{};
+  while (in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+    records.push_back(record);
+  }
+  return true;
+}
+
+// Opens `path` for appending results under `expected`. With `resume`, a
+// file written for the same shard keeps its records, which are returned in
+// `done`; anything else is started over.
+bool open_shard_output(const std::string &path, const ShardHeader &expected,
+                       bool resume, std::vector<ShardRecord> &done,
+                       std::ofstream &out) {
+  done.clear();
+  ShardHeader header{};
+  if (resume && read_shard_file(path, header, done)) {
+    if (std::memcmp(&header, &expected, sizeof(header)) == 0) {
+      std::error_code ec;
+      std::filesystem::resize_file(
+          path, sizeof(header) + done.size() * sizeof(ShardRecord), ec);
+      if (!ec) {
+        out.open(path, std::ios::binary | std::ios::app);
+        if (!out) {
+          std::cerr << "Failed to open shard output '" << path << "'.\n";
+          return false;
+        }
+        std::cerr << "[shard] resuming with " << done.size() << " of "
+                  << expected.opener_count << " openers done.\n";
+        return true;
+      }
+    } else {
+      std::cerr << "Shard output '" << path
+                << "' belongs to a different run; starting over.\n";
+    }
+    done.clear();
+  }
+  out.open(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(&expected), sizeof(expected));
+  out.flush();
+  if (!out) {
+    std::cerr << "Failed to open shard output '" << path << "'.\n";
+    return false;
+  }
+  return true;
+}
+
+std::vector<size_t> shard_openers(const ShardSpec &spec, size_t word_count) {
+  std::vector<size_t> openers;
+  for (size_t g = spec.index; g < word_count; g += spec.count) {
+    openers.push_back(g);
+  }
+  return openers;
+}
+
+// Plays every answer through `tree`; false if any is left unsolved.
+bool measure_tree(const PrecomputedLookup &tree,
+                  const std::vector<encoded_word> &answers, uint64_t &total,
+                  uint8_t &max_guesses) {
+  total = 0;
+  max_guesses = 0;
+  SolverSession session(tree);
+  for (const encoded_word answer : answers) {
+    session.reset();
+    while (session.status() == SessionStatus::kInProgress) {
+      session.apply_feedback(
+          calculate_feedback_encoded(session.next_guess(), answer));
+    }
+    if (session.status() != SessionStatus::kSolved) {
+      return false;
+    }
+    total += session.turns();
+    max_guesses = std::max(max_guesses, static_cast<uint8_t>(session.turns()));
+  }
+  return true;
+}
+
+// Ranking order: solved trees first, then lower value, then fewer worst-case
+// guesses; ties go to the alphabetically first opener.
+bool record_before(const ShardRecord &a, const ShardRecord &b) {
+  if (a.solved != b.solved)
+    return a.solved > b.solved;
+  if (a.value != b.value)
+    return a.value < b.value;
+  if (a.max_guesses != b.max_guesses)
+    return a.max_guesses < b.max_guesses;
+  return a.word < b.word;
+}
+
+} // namespace
+
+bool parse_shard_spec(const std::string &text, ShardSpec &spec) {
+  const size_t slash = text.find('/');
+  if (slash == std::string::npos || slash == 0 || slash + 1 == text.size() ||
+      text.find_first_not_of("0123456789/") != std::string::npos ||
+      text.find('/', slash + 1) != std::string::npos) {
+    return false;
+  }
+  try {
+    const unsigned long index = std::stoul(text.substr(0, slash));
+    const unsigned long count = std::stoul(text.substr(slash + 1));
+    if (count == 0 || index >= count || count > UINT32_MAX) {
+      return false;
+    }
+    spec.index = static_cast<uint32_t>(index);
+    spec.count = static_cast<uint32_t>(count);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return true;
+}
+
+std::string default_shard_output(const std::string &mode,
+                                 const ShardSpec &spec) {
+  return mode + "_shard_" + std::to_string(spec.index) + "_of_" +
+         std::to_string(spec.count) + ".bin";
+}
+
+bool run_start_shard(const std::string &output, const ShardSpec &spec,
+                     const std::vector<encoded_word> &words,
+                     const std::vector<encoded_word> &answers,
+                     const FeedbackTable *feedback_table) {
+  const ShardHeader header =
+      make_header(kShardOpenerScores, 0, spec, words, answers);
+  std::vector<ShardRecord> done;
+  std::ofstream out;
+  if (!open_shard_output(output, header, false, done, out)) {
+    return false;
+  }
+
+  const std::vector<size_t> openers = shard_openers(spec, words.size());
+  std::vector<size_t> candidates(answers.size());
+  std::iota(candidates.begin(), candidates.end(), 0);
+  std::vector<ShardRecord> records(openers.size());
+  ThreadPool::instance().parallel_for(
+      0, openers.size(), 16, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i) {
+          ShardRecord &record = records[i];
+          record.word = static_cast<uint32_t>(words[openers[i]]);
+          record.solved = 1;
+          record.value = score_guess_index(candidates, openers[i], words,
+                                           answers, feedback_table);
+        }
+      });
+  out.write(reinterpret_cast<const char *>(records.data()),
+            static_cast<std::streamsize>(records.size() * sizeof(ShardRecord)));
+  out.close();
+  if (!out) {
+    std::cerr << "Error writing shard output '" << output << "'.\n";
+    return false;
+  }
+  std::cout << "Wrote " << records.size() << " opener scores for shard "
+            << spec.index << "/" << spec.count << " to '" << output << "'.\n";
+  return true;
+}
+
+bool run_generate_shard(const std::string &output, const ShardSpec &spec,
+                        const std::vector<encoded_word> &words,
+                        const std::vector<encoded_word> &answers,
+                        const FeedbackTable *feedback_table,
+                        const LookupTables &lookups, uint32_t depth,
+                        uint32_t version, const std::string &lookup_dir,
+                        bool resume) {
+  if (depth < 1 || depth > 255) {
+    std::cerr << "Lookup depth must be between 1 and 255.\n";
+    return false;
+  }
+  const ShardHeader header =
+      make_header(kShardTreeCosts, depth, spec, words, answers);
+  std::vector<ShardRecord> done;
+  std::ofstream out;
+  if (!open_shard_output(output, header, resume, done, out)) {
+    return false;
+  }
+  std::vector<uint8_t> finished(words.size(), 0);
+  for (const ShardRecord &record : done) {
+    const size_t idx = lookups.word_index.find(record.word);
+    if (idx != kNoWordIndex) {
+      finished[idx] = 1;
+    }
+  }
+
+  const std::vector<size_t> openers = shard_openers(spec, words.size());
+  size_t completed = done.size();
+  for (const size_t opener : openers) {
+    if (finished[opener]) {
+      continue;
+    }
+    const encoded_word start = words[opener];
+    const std::string tree_path = LookupRegistry::path_for(lookup_dir, start);
+    std::cerr << "[shard] opener " << decode_word(start) << " ("
+              << completed + 1 << "/" << openers.size() << ")\n";
+
+    ShardRecord record{};
+    record.word = static_cast<uint32_t>(start);
+    if (generate_lookup_table(tree_path, words, answers, start, depth,
+                              feedback_table, lookups, version, resume)) {
+      PrecomputedLookup tree;
+      uint64_t total = 0;
+      uint8_t max_guesses = 0;
+      if (tree.load(tree_path, start, words) &&
+          measure_tree(tree, answers, total, max_guesses)) {
+        record.solved = 1;
+        record.value = total;
+        record.max_guesses = max_guesses;
+      }
+    }
+    out.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    out.flush();
+    if (!out) {
+      std::cerr << "Error writing shard output '" << output << "'.\n";
+      return false;
+    }
+    ++completed;
+  }
+  std::cout << "Wrote " << completed << " opener tree costs for shard "
+            << spec.index << "/" << spec.count << " to '" << output << "'.\n";
+  return true;
+}
+
+bool merge_shard_files(const std::vector<std::string> &paths,
+                       std::ostream &out) {
+  if (paths.empty()) {
+    std::cerr << "merge requires at least one shard file.\n";
+    return false;
+  }
+  ShardHeader first{};
+  std::vector<uint8_t> seen;
+  std::vector<ShardRecord> merged;
+  for (const std::string &path : paths) {
+    ShardHeader header{};
+    std::vector<ShardRecord> records;
+    if (!read_shard_file(path, header, records)) {
+      std::cerr << "'" << path << "' is not a shard result file.\n";
+      return false;
+    }
+    if (seen.empty()) {
+      first = header;
+      seen.assign(header.shard_count, 0);
+    } else if (header.kind != first.kind || header.depth != first.depth ||
+               header.shard_count != first.shard_count ||
+               header.word_count != first.word_count ||
+               header.answer_count != first.answer_count ||
+               header.word_hash != first.word_hash ||
+               header.answer_hash != first.answer_hash) {
+      std::cerr << "'" << path << "' belongs to a different run than '"
+                << paths.front() << "'.\n";
+      return false;
+    }
+    if (seen[header.shard_index]) {
+      std::cerr << "Shard " << header.shard_index << "/" << header.shard_count
+                << " is given more than once.\n";
+      return false;
+    }
+    seen[header.shard_index] = 1;
+    if (records.size() != header.opener_count) {
+      std::cerr << "Shard " << header.shard_index << "/" << header.shard_count
+                << " ('" << path << "') is incomplete: " << records.size()
+                << " of " << header.opener_count << " openers.\n";
+      return false;
+    }
+    merged.insert(merged.end(), records.begin(), records.end());
+  }
+  for (uint32_t i = 0; i < first.shard_count; ++i) {
+    if (!seen[i]) {
+      std::cerr << "Shard " << i << "/" << first.shard_count
+                << " is missing.\n";
+      return false;
+    }
+  }
+
+  std::sort(merged.begin(), merged.end(), record_before);
+  const double answers = std::max<double>(1.0, first.answer_count);
+  size_t rank = 0;
+  for (const ShardRecord &record : merged) {
+    out << ++rank << " " << decode_word(record.word) << " ";
+    if (first.kind == kShardOpenerScores) {
+      // Mean number of candidates left after the opener.
+      out << record.value << " " << static_cast<double>(record.value) / answers;
+    } else if (record.solved) {
+      out << static_cast<double>(record.value) / answers << " "
+          << static_cast<unsigned>(record.max_guesses);
+    } else {
+      out << "FAIL";
+    }
+    out << "\n";
+  }
+  std::cerr << "Merged " << paths.size() << " shard(s): " << merged.size()
+            << " openers.\n";
+  return true;
+}
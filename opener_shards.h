@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "feedback_cache.h"
+#include "solver_core.h"
+#include "words_data.h"
+
+// `--shard i/N`: the openers whose word index is i modulo N. Round-robin
+// keeps each shard's slice spread over the alphabet, so shards take about
+// the same time.
+struct ShardSpec {
+  uint32_t index = 0;
+  uint32_t count = 1;
+
+  bool owns(size_t word_index) const { return word_index % count == index; }
+};
+
+// Parses "i/N" with 0 <= i < N.
+bool parse_shard_spec(const std::string &text, ShardSpec &spec);
+
+// Default result file for a shard of `mode` ("start" or "generate").
+std::string default_shard_output(const std::string &mode,
+                                 const ShardSpec &spec);
+
+// start --shard: scores every opener in the shard against all `answers`
+// (sum of squared partition sizes, as find_best_guess_index ranks them) and
+// writes the results to `output`.
+bool run_start_shard(const std::string &output, const ShardSpec &spec,
+                     const std::vector<encoded_word> &words,
+                     const std::vector<encoded_word> &answers,
+                     const FeedbackTable *feedback_table);
+
+// generate --shard: builds the depth-`depth` tree of every opener in the
+// shard into `lookup_dir`, walks it over every answer and records its total
+// and worst-case guess count. Each opener's result is appended as soon as it
+// is known; `resume` keeps the openers an interrupted run already finished.
+bool run_generate_shard(const std::string &output, const ShardSpec &spec,
+                        const std::vector<encoded_word> &words,
+                        const std::vector<encoded_word> &answers,
+                        const FeedbackTable *feedback_table,
+                        const LookupTables &lookups, uint32_t depth,
+                        uint32_t version, const std::string &lookup_dir,
+                        bool resume);
+
+// merge: checks that `paths` are the complete, matching shards of one run
+// and writes the combined opener ranking to `out`, best first. The order
+// depends only on the results, never on the file order.
+bool merge_shard_files(const std::vector<std::string> &paths,
+                       std::ostream &out);
@@ -0,0 +1,124 @@
+#include "solver_core.h"
+
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define WORDLE_HAVE_AVX2_KERNEL 1
+#endif
+
+// Scoring a guess is one histogram increment per candidate followed, once
+// per block, by a sum of squares over the 243 feedback codes. The
+// increments are scalar (AVX2 has no conflict detection for scattered
+// adds), but four lanes give them four independent dependency chains, and
+// the sum folds the lanes and squares 16 codes per AVX2 step.
+
+void PartitionHistogram::clear() { std::memset(counts, 0, sizeof(counts)); }
+
+void PartitionHistogram::add(const uint8_t *codes, size_t n) {
+  size_t i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    ++counts[0][codes[i]];
+    ++counts[1][codes[i + 1]];
+    ++counts[2][codes[i + 2]];
+    ++counts[3][codes[i + 3]];
+  }
+  for (; i < n; ++i) {
+    ++counts[i % kLanes][codes[i]];
+  }
+}
+
+void PartitionHistogram::add_gathered(const uint8_t *row,
+                                      const uint16_t *columns, size_t n) {
+  size_t i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    ++counts[0][row[columns[i]]];
+    ++counts[1][row[columns[i + 1]]];
+    ++counts[2][row[columns[i + 2]]];
+    ++counts[3][row[columns[i + 3]]];
+  }
+  for (; i < n; ++i) {
+    ++counts[i % kLanes][row[columns[i]]];
+  }
+}
+
+namespace {
+
+static_assert(PartitionHistogram::kLanes == 4, "kernels fold four lanes");
+
+uint64_t sum_of_squares_scalar(const PartitionHistogram &histogram) {
+  uint64_t sum = 0;
+  for (size_t code = 0; code < 243; ++code) {
+    const uint64_t count = uint64_t{histogram.counts[0][code]} +
+                           histogram.counts[1][code] +
+                           histogram.counts[2][code] +
+                           histogram.counts[3][code];
+    sum += count * count;
+  }
+  return sum;
+}
+
+#if defined(WORDLE_HAVE_AVX2_KERNEL)
+
+__attribute__((target("avx2"))) uint64_t
+sum_of_squares_avx2(const PartitionHistogram &histogram) {
+  __m256i sum = _mm256_setzero_si256();
+  const __m256i zero = _mm256_setzero_si256();
+  for (size_t code = 0; code < 256; code += 16) {
+    __m256i lanes[PartitionHistogram::kLanes];
+    for (size_t lane = 0; lane < PartitionHistogram::kLanes; ++lane)
+      lanes[lane] = _mm256_load_si256(
+          reinterpret_cast<const __m256i *>(histogram.counts[lane] + code));
+    // Merged counts fit 16 bits (kMaxCandidates).
+    const __m256i count = _mm256_add_epi16(_mm256_add_epi16(lanes[0], lanes[1]),
+                                           _mm256_add_epi16(lanes[2], lanes[3]));
+    // Squares need 32 bits: widen each half before multiplying.
+    const __m256i lo = _mm256_unpacklo_epi16(count, zero);
+    const __m256i hi = _mm256_unpackhi_epi16(count, zero);
+    const __m256i squares =
+        _mm256_add_epi64(_mm256_mul_epu32(lo, lo),
+                         _mm256_mul_epu32(_mm256_srli_epi64(lo, 32),
+                                          _mm256_srli_epi64(lo, 32)));
+    const __m256i squares_hi =
+        _mm256_add_epi64(_mm256_mul_epu32(hi, hi),
+                         _mm256_mul_epu32(_mm256_srli_epi64(hi, 32),
+                                          _mm256_srli_epi64(hi, 32)));
+    sum = _mm256_add_epi64(sum, _mm256_add_epi64(squares, squares_hi));
+  }
+  const __m128i folded = _mm_add_epi64(_mm256_castsi256_si128(sum),
+                                       _mm256_extracti128_si256(sum, 1));
+  return static_cast<uint64_t>(_mm_cvtsi128_si64(folded)) +
+         static_cast<uint64_t>(_mm_extract_epi64(folded, 1));
+}
+
+#endif
+
+using SumOfSquaresFn = uint64_t (*)(const PartitionHistogram &);
+
+SumOfSquaresFn select_sum_of_squares() {
+#if defined(WORDLE_HAVE_AVX2_KERNEL)
+  if (__builtin_cpu_supports("avx2"))
+    return sum_of_squares_avx2;
+#endif
+  return sum_of_squares_scalar;
+}
+
+SumOfSquaresFn sum_of_squares_kernel() {
+  static const SumOfSquaresFn kernel = select_sum_of_squares();
+  return kernel;
+}
+
+} // namespace
+
+uint64_t partition_sum_of_squares(const PartitionHistogram &histogram) {
+  return sum_of_squares_kernel()(histogram);
+}
+
+const char *partition_kernel_name() {
+#if defined(WORDLE_HAVE_AVX2_KERNEL)
+  return sum_of_squares_kernel() == sum_of_squares_avx2 ? "avx2" : "scalar";
+#else
+  return "scalar";
+#endif
+}
@@ -0,0 +1,401 @@
+// solver_bench: in-process microbenchmarks for the solver's hot paths. Each
+// benchmark is timed in several samples of a calibrated iteration count and
+// the whole run is written to stdout as one JSON document (see DESIGN.md),
+// so results can be stored and diffed across commits.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "feedback_cache.h"
+#include "lookup_generator.h"
+#include "solver_core.h"
+#include "solver_runtime.h"
+#include "solver_session.h"
+#include "thread_pool.h"
+#include "tree_verifier.h"
+#include "words_data.h"
+
+namespace {
+
+struct BenchOptions {
+  std::string filter;
+  double min_time_ms = 200.0;
+  unsigned int repeat = 5;
+  unsigned int threads = 0;
+  bool threads_set = false;
+  std::string feedback_table_path{kFeedbackTablePath};
+  std::string lookup_path = "lookup_roate.bin";
+  std::string generate_words = "test_subset.txt";
+};
+
+struct BenchResult {
+  std::string name;
+  uint64_t ops = 0;        // operations per iteration
+  uint64_t iterations = 0; // iterations per sample
+  std::vector<double> ns_per_op;
+  uint64_t checksum = 0;
+};
+
+// One iteration of a benchmark. The returned value is folded into the
+// checksum, which keeps the work observable and doubles as a cheap check
+// that two builds computed the same results.
+using BenchBody = std::function<uint64_t()>;
+
+class BenchRunner {
+public:
+  explicit BenchRunner(const BenchOptions &options) : options_(options) {}
+
+  bool wanted(const std::string &name) const {
+    return options_.filter.empty() ||
+           name.find(options_.filter) != std::string::npos;
+  }
+
+  void run(const std::string &name, uint64_t ops, const BenchBody &body) {
+    if (!wanted(name))
+      return;
+    using clock = std::chrono::steady_clock;
+    BenchResult result;
+    result.name = name;
+    result.ops = ops;
+
+    // The warm-up iteration also sizes the samples.
+    auto start = clock::now();
+    result.checksum = body();
+    const double once_ns =
+        std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    const double target_ns = options_.min_time_ms * 1e6;
+    result.iterations = std::max<uint64_t>(
+        1, static_cast<uint64_t>(target_ns / std::max(once_ns, 1.0)));
+
+    for (unsigned int sample = 0; sample < options_.repeat; ++sample) {
+      uint64_t checksum = 0;
+      start = clock::now();
+      for (uint64_t i = 0; i < result.iterations; ++i) {
+        checksum = body();
+      }
+      const double ns =
+          std::chrono::duration<double, std::nano>(clock::now() - start)
+              .count();
+      result.ns_per_op.push_back(
+          ns / static_cast<double>(result.iterations *
+                                   std::max<uint64_t>(ops, 1)));
+      if (checksum != result.checksum) {
+        std::cerr << "[bench] " << name
+                  << ": checksum changed between iterations.\n";
+      }
+    }
+    std::sort(result.ns_per_op.begin(), result.ns_per_op.end());
+    std::cerr << "[bench] " << name << " "
+              << result.ns_per_op[result.ns_per_op.size() / 2]
+              << " ns/op\n";
+    results_.push_back(std::move(result));
+  }
+
+  void skip(const std::string &name, const std::string &reason) {
+    if (!wanted(name))
+      return;
+    std::cerr << "[bench] skipping " << name << ": " << reason << "\n";
+    skipped_.push_back({name, reason});
+  }
+
+  void write_json(std::ostream &out) const {
+    out << "{\"schema\":1,\"feedback_kernel\":\""
+        << feedback_batch_kernel_name() << "\",\"partition_kernel\":\""
+        << partition_kernel_name()
+        << "\",\"threads\":" << ThreadPool::instance().concurrency()
+        << ",\"min_time_ms\":" << options_.min_time_ms
+        << ",\"repeat\":" << options_.repeat << ",\"benchmarks\":[";
+    for (size_t i = 0; i < results_.size(); ++i) {
+      const BenchResult &r = results_[i];
+      out << (i ? "," : "") << "\n  {\"name\":";
+      write_json_string(out, r.name);
+      out << ",\"ops\":" << r.ops << ",\"iterations\":" << r.iterations
+          << ",\"ns_per_op\":{\"median\":"
+          << r.ns_per_op[r.ns_per_op.size() / 2]
+          << ",\"min\":" << r.ns_per_op.front()
+          << ",\"max\":" << r.ns_per_op.back()
+          << "},\"checksum\":" << r.checksum << "}";
+    }
+    out << "\n],\"skipped\":[";
+    for (size_t i = 0; i < skipped_.size(); ++i) {
+      out << (i ? "," : "") << "\n  {\"name\":";
+      write_json_string(out, skipped_[i].first);
+      out << ",\"reason\":";
+      write_json_string(out, skipped_[i].second);
+      out << "}";
+    }
+    out << "\n]}\n";
+  }
+
+private:
+  const BenchOptions &options_;
+  std::vector<BenchResult> results_;
+  std::vector<std::pair<std::string, std::string>> skipped_;
+};
+
+// SplitMix64: a fixed-seed generator so every run benchmarks the same data.
+struct SplitMix64 {
+  uint64_t state;
+  uint64_t next() {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+};
+
+// `count` distinct indices below `n`, ascending like real candidate lists.
+std::vector<size_t> sample_indices(size_t n, size_t count, uint64_t seed) {
+  std::vector<size_t> all(n);
+  std::iota(all.begin(), all.end(), 0);
+  count = std::min(count, n);
+  SplitMix64 rng{seed};
+  for (size_t i = 0; i < count; ++i) {
+    std::swap(all[i], all[i + rng.next() % (n - i)]);
+  }
+  all.resize(count);
+  std::sort(all.begin(), all.end());
+  return all;
+}
+
+void bench_feedback(BenchRunner &runner,
+                    const std::vector<encoded_word> &words) {
+  constexpr size_t kPairs = 4096;
+  SplitMix64 rng{1};
+  std::vector<std::pair<encoded_word, encoded_word>> pairs(kPairs);
+  for (auto &pair : pairs) {
+    pair = {words[rng.next() % words.size()], words[rng.next() % words.size()]};
+  }
+  runner.run("feedback/encoded", kPairs, [&]() {
+    uint64_t sum = 0;
+    for (const auto &pair : pairs) {
+      sum += static_cast<uint64_t>(
+          calculate_feedback_encoded(pair.first, pair.second));
+    }
+    return sum;
+  });
+
+  std::vector<uint8_t> out(words.size());
+  runner.run("feedback/batch", words.size(), [&]() {
+    calculate_feedback_batch(kInitialGuess, words.data(), words.size(),
+                             out.data());
+    return std::accumulate(out.begin(), out.end(), uint64_t{0});
+  });
+}
+
+void bench_search(BenchRunner &runner, const std::vector<encoded_word> &words,
+                  const FeedbackTable *table, const LookupTables &lookups) {
+  const size_t guess = lookups.word_index.find(kInitialGuess);
+  const std::vector<size_t> sizes = {words.size(), 1000, 100, 10};
+
+  for (const bool use_table : {true, false}) {
+    const char *kind = use_table ? "table" : "live";
+    const FeedbackTable *source = use_table ? table : nullptr;
+    for (const size_t size : sizes) {
+      const std::string suffix =
+          std::string(kind) + "/n=" + std::to_string(size);
+      if (use_table && !table) {
+        runner.skip("filter/" + suffix, "no usable feedback table");
+        runner.skip("best_guess/" + suffix, "no usable feedback table");
+        continue;
+      }
+      const std::vector<size_t> candidates =
+          sample_indices(words.size(), size, size);
+      // Filter on the feedback of the first candidate so the result is
+      // never empty.
+      const feedback_int feedback =
+          calculate_feedback_encoded(kInitialGuess, words[candidates.front()]);
+      runner.run("filter/" + suffix, size, [&]() {
+        return static_cast<uint64_t>(
+            filter_candidate_indices(candidates, guess, feedback, source,
+                                     words, words)
+                .size());
+      });
+      // One live search over the whole vocabulary scores ~170M pairs.
+      if (!use_table && size == words.size()) {
+        runner.skip("best_guess/" + suffix, "too slow without a table");
+        continue;
+      }
+      runner.run("best_guess/" + suffix, words.size(), [&]() {
+        return static_cast<uint64_t>(find_best_guess_index(
+            candidates, words, words, source));
+      });
+    }
+  }
+}
+
+void bench_lookup(BenchRunner &runner, const BenchOptions &options,
+                  const std::vector<encoded_word> &words) {
+  PrecomputedLookup tree;
+  if (!tree.load(options.lookup_path, kInitialGuess, words)) {
+    runner.skip("lookup/find_child", "cannot load " + options.lookup_path);
+    runner.skip("lookup/solve_all", "cannot load " + options.lookup_path);
+    runner.skip("lookup/verify", "cannot load " + options.lookup_path);
+    return;
+  }
+
+  // Every (node, feedback) probe met while solving a fixed sample of
+  // answers, replayed in that order.
+  struct Probe {
+    const uint8_t *node;
+    uint16_t feedback;
+  };
+  std::vector<Probe> probes;
+  for (const size_t answer : sample_indices(words.size(), 1024, 7)) {
+    const uint8_t *node = tree.root();
+    encoded_word guess = tree.start_word();
+    while (node) {
+      const auto fb = static_cast<uint16_t>(
+          calculate_feedback_encoded(guess, words[answer]));
+      if (fb == 242)
+        break;
+      probes.push_back({node, fb});
+      encoded_word next = 0;
+      node = tree.find_child(node, fb, next);
+      guess = next;
+    }
+  }
+  runner.run("lookup/find_child", probes.size(), [&]() {
+    uint64_t sum = 0;
+    for (const Probe &probe : probes) {
+      encoded_word next = 0;
+      tree.find_child(probe.node, probe.feedback, next);
+      sum += next;
+    }
+    return sum;
+  });
+
+  runner.run("lookup/solve_all", words.size(), [&]() {
+    uint64_t turns = 0;
+    SolverSession session(tree);
+    for (const encoded_word answer : words) {
+      session.reset();
+      while (session.status() == SessionStatus::kInProgress) {
+        session.apply_feedback(
+            calculate_feedback_encoded(session.next_guess(), answer));
+      }
+      turns += session.turns();
+    }
+    return turns;
+  });
+
+  runner.run("lookup/verify", words.size(), [&]() {
+    return static_cast<uint64_t>(
+        verify_tree(tree, words, options.threads).total_guesses);
+  });
+}
+
+void bench_generate(BenchRunner &runner, const BenchOptions &options) {
+  const std::string name =
+      "generate/" +
+      std::filesystem::path(options.generate_words).stem().string();
+  if (!runner.wanted(name))
+    return;
+  const std::vector<encoded_word> subset =
+      load_words_from_file(options.generate_words);
+  if (subset.empty()) {
+    runner.skip(name, "cannot read " + options.generate_words);
+    return;
+  }
+  const LookupTables lookups = build_lookup_tables_from_words(subset);
+  const encoded_word start =
+      lookups.word_index.contains(kInitialGuess) ? kInitialGuess : subset[0];
+  const std::string output =
+      (std::filesystem::temp_directory_path() / "solver_bench_lookup.bin")
+          .string();
+  runner.run(name, 1, [&]() {
+    // Quiet: the generator's progress lines would interleave with the
+    // bench output.
+    const bool ok = generate_lookup_table(
+        output, subset, subset, start, 6, nullptr, lookups,
+        kLookupVersionCompact, false, nullptr, std::string(), true);
+    return ok ? static_cast<uint64_t>(std::filesystem::file_size(output))
+              : uint64_t{0};
+  });
+  std::error_code ec;
+  std::filesystem::remove(output, ec);
+}
+
+void print_usage(const char *prog_name) {
+  std::cout
+      << "Usage: " << prog_name << " [flags]\n\n"
+      << "Runs the microbenchmarks and prints JSON results to stdout.\n\n"
+      << "Flags:\n"
+      << "  --filter TEXT         Only run benchmarks whose name contains "
+         "TEXT.\n"
+      << "  --min-time-ms N       Target duration of each sample "
+         "(default: 200).\n"
+      << "  --repeat N            Samples per benchmark (default: 5).\n"
+      << "  --threads N           Thread pool size (default: all cores).\n"
+      << "  --feedback-table-path FILE  Table for the table-backed "
+         "benchmarks\n"
+         "                        (default: feedback_table.bin).\n"
+      << "  --lookup FILE         Tree for the lookup benchmarks (default: "
+         "lookup_roate.bin).\n"
+      << "  --generate-words FILE Word list for the generate benchmark "
+         "(default:\n"
+         "                        test_subset.txt).\n"
+      << "  --help                Show this summary.\n";
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  BenchOptions options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      print_usage(argv[0]);
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      std::cerr << arg << " requires a value.\n";
+      return 1;
+    }
+    const std::string value = argv[++i];
+    if (arg == "--filter") {
+      options.filter = value;
+    } else if (arg == "--min-time-ms") {
+      options.min_time_ms = std::stod(value);
+    } else if (arg == "--repeat") {
+      options.repeat =
+          std::max(1u, static_cast<unsigned int>(std::stoul(value)));
+    } else if (arg == "--threads") {
+      options.threads = static_cast<unsigned int>(std::stoul(value));
+      options.threads_set = true;
+    } else if (arg == "--feedback-table-path") {
+      options.feedback_table_path = value;
+    } else if (arg == "--lookup") {
+      options.lookup_path = value;
+    } else if (arg == "--generate-words") {
+      options.generate_words = value;
+    } else {
+      std::cerr << "Unknown flag '" << arg << "'.\n";
+      print_usage(argv[0]);
+      return 1;
+    }
+  }
+  if (options.threads_set) {
+    ThreadPool::set_default_concurrency(options.threads);
+  }
+
+  const std::vector<encoded_word> &words = load_words();
+  const LookupTables &lookups = load_lookup_tables();
+  const FeedbackTable table =
+      load_feedback_table(options.feedback_table_path, words, words);
+
+  BenchRunner runner(options);
+  bench_feedback(runner, words);
+  bench_search(runner, words, table.loaded() ? &table : nullptr, lookups);
+  bench_lookup(runner, options, words);
+  bench_generate(runner, options);
+  runner.write_json(std::cout);
+  return 0;
+}
@@ -2,14 +2,61 @@
 
 #include <algorithm>
 #include <array>
-#include <future>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <numeric>
-#include <thread>
 
 #include "feedback_cache.h"
+#include "thread_pool.h"
 #include "words_data.h"
 
+namespace {
+
+// Candidates are scored through calculate_feedback_batch in blocks this size
+// when no feedback table is loaded; small enough that a pruned guess wastes
+// little work.
+constexpr size_t kFeedbackBlock = 64;
+
+// Guesses handed to a pool participant at a time.
+constexpr size_t kGuessGrain = 64;
+
+// Candidate sets at least this large are scored with PartitionHistogram, a
+// block of kScoreBlock candidates at a time, checking the pruning bound
+// after each block. Smaller sets keep the per-candidate loop: most guesses
+// there lose within the first few hundred candidates, and checking the
+// bound after every one drops them sooner than a block would.
+constexpr size_t kBlockedScoringMin = 2048;
+constexpr size_t kScoreBlock = 512;
+static_assert(kScoreBlock >= kFeedbackBlock, "state.block serves both paths");
+
+void gather_words(const std::vector<size_t> &indices,
+                  const std::vector<encoded_word> &words,
+                  std::vector<encoded_word> &gathered) {
+  gathered.resize(indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    gathered[i] = words[indices[i]];
+  }
+}
+
+// Search scratch is per thread and reused across calls, so a search only
+// allocates when it needs more room than any before it on that thread. Pool
+// threads never pick up other work while waiting on a parallel_for, so a
+// thread is the caller of at most one search at a time, and a worker runs
+// one find_best_guess_range at a time.
+struct GuessSearchScratch {
+  std::vector<encoded_word> candidate_words;
+  std::vector<uint16_t> candidate_columns;
+  std::vector<uint32_t> guess_classes; // distinct_guess_indices' hash set
+};
+
+GuessSearchScratch &search_scratch() {
+  thread_local GuessSearchScratch scratch;
+  return scratch;
+}
+
+} // namespace
+
 feedback_int calculate_feedback_encoded(encoded_word guess_encoded,
                                         encoded_word answer_encoded) {
   uint8_t guess_codes[5];
@@ -40,18 +87,54 @@ feedback_int calculate_feedback_encoded(encoded_word guess_encoded,
 
   feedback_int final_feedback = 0;
   for (int i = 0; i < 5; ++i) {
-    final_feedback = final_feedback * 3 + feedback_codes[i];
+    final_feedback =
+        static_cast<feedback_int>(final_feedback * 3 + feedback_codes[i]);
   }
   return final_feedback;
 }
 
+WordIndex WordIndex::for_words(const std::vector<encoded_word> &words) {
+  WordIndex index;
+  index.count_ = words.size();
+  if (std::adjacent_find(words.begin(), words.end(),
+                         std::greater_equal<encoded_word>()) == words.end()) {
+    index.view_ = words.data();
+    return index;
+  }
+  std::vector<uint32_t> order(words.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+    return words[a] < words[b];
+  });
+  order.erase(std::unique(order.begin(), order.end(),
+                          [&](uint32_t a, uint32_t b) {
+                            return words[a] == words[b];
+                          }),
+              order.end());
+  index.count_ = order.size();
+  index.owned_.reserve(order.size());
+  for (const uint32_t position : order) {
+    index.owned_.push_back(words[position]);
+  }
+  index.positions_ = std::move(order);
+  return index;
+}
+
+size_t WordIndex::find(encoded_word word) const {
+  const encoded_word *begin = sorted();
+  const encoded_word *end = begin + count_;
+  const encoded_word *it = std::lower_bound(begin, end, word);
+  if (it == end || *it != word) {
+    return kNoWordIndex;
+  }
+  const size_t slot = static_cast<size_t>(it - begin);
+  return positions_.empty() ? slot : positions_[slot];
+}
+
 LookupTables build_lookup_tables_from_words(
     const std::vector<encoded_word> &words) {
   LookupTables tables;
-  tables.word_index.reserve(words.size());
-  for (size_t i = 0; i < words.size(); ++i) {
-    tables.word_index.emplace(words[i], i);
-  }
+  tables.word_index = WordIndex::for_words(words);
   return tables;
 }
 
@@ -62,17 +145,14 @@ const LookupTables &load_lookup_tables() {
 }
 
 std::vector<size_t> filter_candidate_indices(
-    const std::vector<size_t> &indices, encoded_word guess,
+    const std::vector<size_t> &indices, size_t guess_index,
     feedback_int feedback, const FeedbackTable *feedback_table,
-    const LookupTables &lookups, const std::vector<encoded_word> &words) {
+    const std::vector<encoded_word> &words,
+    const std::vector<encoded_word> &answers) {
   std::vector<size_t> new_indices;
   if (feedback_table && feedback_table->loaded()) {
     new_indices.reserve(indices.size());
-    const auto guess_it = lookups.word_index.find(guess);
-    if (guess_it == lookups.word_index.end()) {
-      return new_indices;
-    }
-    const uint8_t *row = feedback_table->row(guess_it->second);
+    const uint8_t *row = feedback_table->row(guess_index);
     for (const auto idx : indices) {
       if (row[idx] == feedback) {
         new_indices.push_back(idx);
@@ -82,128 +162,349 @@ std::vector<size_t> filter_candidate_indices(
   }
 
   new_indices.reserve(indices.size() / 2);
-  for (const auto idx : indices) {
-    if (calculate_feedback_encoded(guess, words[idx]) == feedback) {
-      new_indices.push_back(idx);
+  std::array<encoded_word, kFeedbackBlock> block_words;
+  std::array<uint8_t, kFeedbackBlock> block_feedback;
+  for (size_t start = 0; start < indices.size(); start += kFeedbackBlock) {
+    const size_t len = std::min(kFeedbackBlock, indices.size() - start);
+    for (size_t i = 0; i < len; ++i) {
+      block_words[i] = answers[indices[start + i]];
+    }
+    calculate_feedback_batch(words[guess_index], block_words.data(), len,
+                             block_feedback.data());
+    for (size_t i = 0; i < len; ++i) {
+      if (block_feedback[i] == feedback) {
+        new_indices.push_back(indices[start + i]);
+      }
     }
   }
   return new_indices;
 }
 
-std::pair<encoded_word, double>
-find_best_guess_worker(const std::vector<size_t> &possible_indices,
-                       const std::vector<encoded_word> &guess_subset,
-                       const FeedbackTable *feedback_table,
-                       const LookupTables &lookups,
-                       const std::vector<encoded_word> &words,
-                       const std::vector<uint32_t> &weights) {
-  encoded_word local_best_guess = 0;
-  double local_min_score = std::numeric_limits<double>::max();
-  uint32_t local_best_weight = 0;
-
-  for (const auto &guess : guess_subset) {
-    std::array<int, 243> feedback_groups{};
-    double current_score = 0.0;
+uint64_t score_guess_index(const std::vector<size_t> &possible_indices,
+                           size_t guess_index,
+                           const std::vector<encoded_word> &words,
+                           const std::vector<encoded_word> &answers,
+                           const FeedbackTable *feedback_table) {
+  std::array<uint32_t, 243> groups{};
+  uint64_t score = 0;
+  auto add = [&](uint8_t fb) {
+    score += 2 * static_cast<uint64_t>(groups[fb]) + 1;
+    ++groups[fb];
+  };
+  if (feedback_table && feedback_table->loaded()) {
+    const uint8_t *row = feedback_table->row(guess_index);
+    for (const auto idx : possible_indices) {
+      add(row[idx]);
+    }
+    return score;
+  }
+
+  std::array<encoded_word, kFeedbackBlock> block_words;
+  std::array<uint8_t, kFeedbackBlock> block_feedback;
+  for (size_t start = 0; start < possible_indices.size();
+       start += kFeedbackBlock) {
+    const size_t len =
+        std::min(kFeedbackBlock, possible_indices.size() - start);
+    for (size_t i = 0; i < len; ++i) {
+      block_words[i] = answers[possible_indices[start + i]];
+    }
+    calculate_feedback_batch(words[guess_index], block_words.data(), len,
+                             block_feedback.data());
+    for (size_t i = 0; i < len; ++i) {
+      add(block_feedback[i]);
+    }
+  }
+  return score;
+}
+
+namespace {
+
+// Guesses are ranked by (score, word index); both fit one 64-bit key, so the
+// best-so-far across all workers is a single atomic minimum.
+inline uint64_t guess_key(uint64_t score, size_t guess_idx) {
+  return (score << 32) | static_cast<uint64_t>(guess_idx);
+}
+
+constexpr uint64_t kNoGuessKey = std::numeric_limits<uint64_t>::max();
+
+struct alignas(64) GuessSearchState {
+  PartitionHistogram histogram;
+  std::array<int, 243> feedback_groups;
+  std::array<uint8_t, kScoreBlock> block;
+};
+
+// What every worker of one search reads besides the guess list.
+struct GuessSearchInput {
+  const std::vector<size_t> &possible_indices;
+  // candidate_words[i] is the answer behind possible_indices[i]; gathered
+  // when feedback may be computed live.
+  const std::vector<encoded_word> &candidate_words;
+  // possible_indices as 16-bit table columns, when scoring is blocked.
+  const std::vector<uint16_t> &candidate_columns;
+  bool blocked = false;
+  // Word indices to search, or null for every word.
+  const std::vector<uint32_t> *guesses = nullptr;
+};
+
+// Scores one guess a block at a time, stopping after the first block that
+// brings the score to `limit`. Returns the score and sets `examined` to the
+// candidates counted.
+uint64_t score_guess_blocked(encoded_word guess, const uint8_t *row,
+                             const GuessSearchInput &input, uint64_t limit,
+                             GuessSearchState &state, size_t &examined) {
+  PartitionHistogram &histogram = state.histogram;
+  histogram.clear();
+  const size_t count = input.possible_indices.size();
+  uint64_t score = 0;
+  for (size_t start = 0; start < count; start += kScoreBlock) {
+    const size_t len = std::min(kScoreBlock, count - start);
+    if (row) {
+      histogram.add_gathered(row, input.candidate_columns.data() + start, len);
+    } else {
+      calculate_feedback_batch(guess, input.candidate_words.data() + start,
+                               len, state.block.data());
+      histogram.add(state.block.data(), len);
+    }
+    score = partition_sum_of_squares(histogram);
+    if (score >= limit) {
+      examined = start + len;
+      return score;
+    }
+  }
+  examined = count;
+  return score;
+}
+
+// Scores guesses [begin, end). Partial scores only grow, so a guess is
+// abandoned as soon as its key can no longer beat the shared best.
+void find_best_guess_range(size_t begin, size_t end,
+                           const GuessSearchInput &input,
+                           const std::vector<encoded_word> &words,
+                           const std::vector<uint8_t> *banned_mask,
+                           const FeedbackTable *feedback_table,
+                           std::atomic<uint64_t> &best_key,
+                           GuessSearchState &state, GuessSearchStats *stats) {
+  const bool use_table = feedback_table && feedback_table->loaded();
+  uint64_t local_key = best_key.load(std::memory_order_relaxed);
+  uint64_t scored = 0;
+  uint64_t pruned_count = 0;
+  uint64_t evaluated = 0;
+  FeedbackRowScope rows(use_table ? feedback_table : nullptr);
+  const std::vector<size_t> &possible_indices = input.possible_indices;
+  const std::vector<encoded_word> &candidate_words = input.candidate_words;
+
+  for (size_t position = begin; position < end; ++position) {
+    const size_t g = input.guesses ? (*input.guesses)[position] : position;
+    if (banned_mask && (*banned_mask)[g]) {
+      continue;
+    }
+    const uint64_t bound =
+        std::min(local_key, best_key.load(std::memory_order_relaxed));
+    // Prune once score reaches limit: ties lose to lower word indices.
+    const uint64_t limit =
+        (bound >> 32) + ((g < (bound & 0xFFFFFFFFu)) ? 1 : 0);
+
+    uint64_t current_score = 0;
     bool pruned = false;
-    if (feedback_table && feedback_table->loaded()) {
-      const auto guess_it = lookups.word_index.find(guess);
-      if (guess_it == lookups.word_index.end()) {
-        continue;
-      }
-      const uint8_t *row = feedback_table->row(guess_it->second);
-      for (const auto idx : possible_indices) {
-        const uint8_t fb = row[idx];
+    size_t examined = possible_indices.size();
+    // A lazy table only lends the rows it already holds; computing a full
+    // row for a guess that is about to be pruned would cost more than
+    // scoring it live.
+    const uint8_t *row = rows.row(g);
+    auto &feedback_groups = state.feedback_groups;
+    if (input.blocked) {
+      current_score =
+          score_guess_blocked(words[g], row, input, limit, state, examined);
+      pruned = current_score >= limit;
+    } else if (row) {
+      feedback_groups.fill(0);
+      for (size_t i = 0; i < possible_indices.size(); ++i) {
+        const uint8_t fb = row[possible_indices[i]];
         const int count_before = feedback_groups[fb];
-        current_score += static_cast<double>(2 * count_before + 1);
+        current_score += static_cast<uint64_t>(2 * count_before + 1);
         feedback_groups[fb] = count_before + 1;
-        if (current_score >= local_min_score) {
+        if (current_score >= limit) {
           pruned = true;
+          examined = i + 1;
           break;
         }
       }
     } else {
-      for (const auto idx : possible_indices) {
-        const feedback_int fb =
-            calculate_feedback_encoded(guess, words[idx]);
-        const int count_before = feedback_groups[fb];
-        current_score += static_cast<double>(2 * count_before + 1);
-        feedback_groups[fb] = count_before + 1;
-        if (current_score >= local_min_score) {
-          pruned = true;
-          break;
+      feedback_groups.fill(0);
+      for (size_t start = 0; start < candidate_words.size() && !pruned;
+           start += kFeedbackBlock) {
+        const size_t len =
+            std::min(kFeedbackBlock, candidate_words.size() - start);
+        calculate_feedback_batch(words[g], candidate_words.data() + start, len,
+                                 state.block.data());
+        for (size_t i = 0; i < len; ++i) {
+          const uint8_t fb = state.block[i];
+          const int count_before = feedback_groups[fb];
+          current_score += static_cast<uint64_t>(2 * count_before + 1);
+          feedback_groups[fb] = count_before + 1;
+          if (current_score >= limit) {
+            pruned = true;
+            examined = start + i + 1;
+            break;
+          }
         }
       }
     }
+    evaluated += examined;
+    if (!row && use_table) {
+      feedback_table->note_live_work(g, examined);
+    }
 
-    if (!pruned) {
-      uint32_t guess_weight = 0;
-      const auto weight_it = lookups.word_index.find(guess);
-      if (weight_it != lookups.word_index.end()) {
-        guess_weight = weights[weight_it->second];
-      }
-      if (current_score < local_min_score ||
-          (current_score == local_min_score &&
-           guess_weight > local_best_weight)) {
-        local_min_score = current_score;
-        local_best_guess = guess;
-        local_best_weight = guess_weight;
+    if (pruned) {
+      ++pruned_count;
+    } else {
+      ++scored;
+      local_key = guess_key(current_score, g);
+      uint64_t seen = best_key.load(std::memory_order_relaxed);
+      while (local_key < seen &&
+             !best_key.compare_exchange_weak(seen, local_key,
+                                             std::memory_order_relaxed)) {
       }
     }
   }
-  return {local_best_guess, local_min_score};
-}
-
-encoded_word find_best_guess_encoded(
-    const std::vector<size_t> &possible_indices,
-    const std::vector<encoded_word> &words,
-    const FeedbackTable *feedback_table, const LookupTables &lookups,
-    const std::vector<uint32_t> &weights,
-    const std::unordered_set<encoded_word> *banned_guesses) {
-  if (possible_indices.empty()) {
-    return 0;
+  if (stats) {
+    stats->guesses_scored.fetch_add(scored, std::memory_order_relaxed);
+    stats->guesses_pruned.fetch_add(pruned_count, std::memory_order_relaxed);
+    stats->feedback_evaluated.fetch_add(evaluated, std::memory_order_relaxed);
   }
+}
 
-  const std::vector<encoded_word> *guesses_to_check = &words;
-  unsigned int num_threads = std::thread::hardware_concurrency();
-  if (num_threads == 0)
-    num_threads = 4;
+} // namespace
 
-  std::vector<std::vector<encoded_word>> word_chunks(num_threads);
-  for (size_t i = 0; i < guesses_to_check->size(); ++i) {
-    word_chunks[i % num_threads].push_back((*guesses_to_check)[i]);
+bool distinct_guess_indices(const std::vector<size_t> &possible_indices,
+                            const std::vector<encoded_word> &words,
+                            const std::vector<encoded_word> &answers,
+                            std::vector<uint32_t> &representatives) {
+  representatives.clear();
+  // Bit c is set when some candidate contains letter code c (1-26).
+  uint32_t live = 0;
+  for (const size_t idx : possible_indices) {
+    const encoded_word answer = answers[idx];
+    for (int pos = 0; pos < 5; ++pos) {
+      live |= uint32_t{1} << get_char_code_at(answer, pos);
+    }
+  }
+  constexpr uint32_t kAllLetters = ((uint32_t{1} << 26) - 1) << 1;
+  if (live == kAllLetters) {
+    return false;
   }
 
-  if (banned_guesses && !banned_guesses->empty()) {
-    for (auto &chunk : word_chunks) {
-      chunk.erase(std::remove_if(chunk.begin(), chunk.end(),
-                                 [&](encoded_word guess) {
-                                   return banned_guesses->count(guess) > 0;
-                                 }),
-                  chunk.end());
+  // A guess's class is the word with its dead letters zeroed. Classes are
+  // deduplicated in an open-addressed set sized for every word at most half
+  // full; words are visited in index order, so the first member seen is
+  // the lowest.
+  int bits = 6;
+  while ((size_t{1} << bits) < words.size() * 2) {
+    ++bits;
+  }
+  const size_t capacity = size_t{1} << bits;
+  constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> &seen = search_scratch().guess_classes;
+  seen.assign(capacity, kEmpty);
+  representatives.reserve(words.size());
+  for (size_t g = 0; g < words.size(); ++g) {
+    uint32_t key = 0;
+    for (int pos = 0; pos < 5; ++pos) {
+      const uint32_t code = get_char_code_at(words[g], pos);
+      key = (key << 5) | ((live >> code) & 1 ? code : 0);
+    }
+    size_t slot = (key * 0x9E3779B1u) >> (32 - bits);
+    while (seen[slot] != kEmpty && seen[slot] != key) {
+      slot = (slot + 1) & (capacity - 1);
+    }
+    if (seen[slot] == kEmpty) {
+      seen[slot] = key;
+      representatives.push_back(static_cast<uint32_t>(g));
     }
   }
+  return true;
+}
 
-  std::vector<std::future<std::pair<encoded_word, double>>> futures;
-  for (unsigned int i = 0; i < num_threads; ++i) {
-    if (!word_chunks[i].empty()) {
-      futures.push_back(std::async(std::launch::async, find_best_guess_worker,
-                                   std::cref(possible_indices),
-                                   std::cref(word_chunks[i]), feedback_table,
-                                   std::cref(lookups), std::cref(words),
-                                   std::cref(weights)));
+size_t find_best_guess_index(const std::vector<size_t> &possible_indices,
+                             const std::vector<encoded_word> &words,
+                             const std::vector<encoded_word> &answers,
+                             const FeedbackTable *feedback_table,
+                             const std::vector<uint8_t> *banned,
+                             GuessSearchBudget *budget,
+                             GuessSearchStats *stats,
+                             const std::vector<uint32_t> *guesses) {
+  if (possible_indices.empty()) {
+    return kNoWordIndex;
+  }
+  const bool use_table = feedback_table && feedback_table->loaded();
+  if (stats) {
+    stats->searches.fetch_add(1, std::memory_order_relaxed);
+    if (use_table) {
+      stats->table_searches.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (guesses) {
+      stats->guesses_merged.fetch_add(words.size() - guesses->size(),
+                                      std::memory_order_relaxed);
     }
   }
 
-  encoded_word best_guess = 0;
-  double min_overall_score = std::numeric_limits<double>::max();
-
-  for (auto &fut : futures) {
-    auto result = fut.get();
-    if (result.second < min_overall_score) {
-      min_overall_score = result.second;
-      best_guess = result.first;
-    }
+  // Without a full table workers compute feedback live; gather the
+  // candidates once so the batch kernel streams contiguous words.
+  GuessSearchScratch &scratch = search_scratch();
+  std::vector<encoded_word> &candidate_words = scratch.candidate_words;
+  candidate_words.clear();
+  if (!use_table || feedback_table->lazy()) {
+    gather_words(possible_indices, answers, candidate_words);
   }
+  const bool blocked =
+      possible_indices.size() >= kBlockedScoringMin &&
+      possible_indices.size() <= PartitionHistogram::kMaxCandidates &&
+      answers.size() <= size_t{0xFFFF} + 1;
+  std::vector<uint16_t> &candidate_columns = scratch.candidate_columns;
+  candidate_columns.clear();
+  if (blocked && use_table) {
+    candidate_columns.assign(possible_indices.begin(), possible_indices.end());
+  }
+  const GuessSearchInput input{possible_indices, candidate_words,
+                               candidate_columns, blocked, guesses};
 
-  return best_guess;
+  ThreadPool &pool = ThreadPool::instance();
+  std::atomic<uint64_t> best_key{kNoGuessKey};
+  std::atomic<bool> expired{false};
+  pool.parallel_for(
+      0, guesses ? guesses->size() : words.size(), kGuessGrain,
+      [&](size_t begin, size_t end, unsigned int) {
+        if (budget) {
+          if (expired.load(std::memory_order_relaxed) ||
+              (budget->cancel &&
+               budget->cancel->load(std::memory_order_relaxed)) ||
+              std::chrono::steady_clock::now() >= budget->deadline) {
+            expired.store(true, std::memory_order_relaxed);
+            return;
+          }
+        }
+        const auto start =
+            stats ? std::chrono::steady_clock::now()
+                  : std::chrono::steady_clock::time_point{};
+        thread_local GuessSearchState state;
+        find_best_guess_range(begin, end, input, words, banned,
+                              feedback_table, best_key, state, stats);
+        if (stats) {
+          stats->busy_ns.fetch_add(
+              static_cast<uint64_t>(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count()),
+              std::memory_order_relaxed);
+        }
+      });
+
+  if (budget && expired.load()) {
+    budget->expired = true;
+  }
+  const uint64_t best = best_key.load();
+  if (best == kNoGuessKey) {
+    return kNoWordIndex;
+  }
+  return static_cast<size_t>(best & 0xFFFFFFFFu);
 }
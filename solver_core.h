@@ -1,17 +1,48 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
-#include <unordered_map>
-#include <unordered_set>
-#include <utility>
+#include <cstdint>
 #include <vector>
 
 #include "solver_types.h"
 
 struct FeedbackTable;
 
+// Returned by index lookups and searches that find no word.
+inline constexpr size_t kNoWordIndex = static_cast<size_t>(-1);
+
+// Word -> position in the vocabulary it was built from, by binary search
+// over a sorted array. word_lists.h stores the embedded vocabulary in
+// ascending order (checked at compile time), so its index is a view of the
+// list itself and costs nothing to build. Other lists get a sorted copy
+// plus each word's original position; duplicates resolve to the first.
+class WordIndex {
+public:
+  WordIndex() = default;
+  // `words` must outlive the index when it is already strictly ascending.
+  static WordIndex for_words(const std::vector<encoded_word> &words);
+
+  size_t find(encoded_word word) const;
+  bool contains(encoded_word word) const { return find(word) != kNoWordIndex; }
+
+private:
+  const encoded_word *sorted() const {
+    return owned_.empty() ? view_ : owned_.data();
+  }
+
+  const encoded_word *view_ = nullptr;
+  size_t count_ = 0;
+  std::vector<encoded_word> owned_;
+  std::vector<uint32_t> positions_; // empty when sorted order is list order
+};
+
+// Encoded words only cross into the core routines at the CLI and protocol
+// boundary; `word_index` converts them once, and everything below takes
+// and returns indices.
 struct LookupTables {
-  std::unordered_map<encoded_word, size_t> word_index;
+  WordIndex word_index;
 };
 
 const LookupTables &load_lookup_tables();
@@ -20,14 +51,105 @@ LookupTables build_lookup_tables_from_words(const std::vector<encoded_word> &wor
 feedback_int calculate_feedback_encoded(encoded_word guess_encoded,
                                         encoded_word answer_encoded);
 
+// Writes calculate_feedback_encoded(guess, answers[i]) to out[i] for every
+// i < n, using the widest kernel the CPU supports (AVX2, NEON or scalar;
+// chosen once at first use).
+void calculate_feedback_batch(encoded_word guess, const encoded_word *answers,
+                              size_t n, uint8_t *out);
+const char *feedback_batch_kernel_name();
+
+// Feedback histogram of one guess, kept as kLanes interleaved counter sets:
+// consecutive candidates land in different lanes, so runs of one feedback
+// code do not serialize on a single counter. Scores are the sum of squared
+// partition sizes, which is also what find_best_guess_index minimises.
+struct alignas(64) PartitionHistogram {
+  static constexpr size_t kLanes = 4;
+  // Largest candidate count a histogram may hold: every merged count must
+  // fit a uint16_t.
+  static constexpr size_t kMaxCandidates = 0xFFFF;
+
+  uint16_t counts[kLanes][256];
+
+  void clear();
+  // Counts codes[0..n).
+  void add(const uint8_t *codes, size_t n);
+  // Counts row[columns[0..n)], the table row's feedback for each candidate.
+  void add_gathered(const uint8_t *row, const uint16_t *columns, size_t n);
+};
+
+// Sum over feedback codes of the squared merged count, using the widest
+// kernel the CPU supports (AVX2 or scalar; chosen once at first use).
+uint64_t partition_sum_of_squares(const PartitionHistogram &histogram);
+const char *partition_kernel_name();
+
+// Candidate indices always refer to `answers` (the feedback table's column
+// axis); guess indices refer to `words` (its row axis). Both vectors are the
+// same list unless a separate answer vocabulary is used.
 std::vector<size_t> filter_candidate_indices(
-    const std::vector<size_t> &indices, encoded_word guess,
+    const std::vector<size_t> &indices, size_t guess_index,
     feedback_int feedback, const FeedbackTable *feedback_table,
-    const LookupTables &lookups, const std::vector<encoded_word> &words);
-
-encoded_word find_best_guess_encoded(
-    const std::vector<size_t> &possible_indices,
     const std::vector<encoded_word> &words,
-    const FeedbackTable *feedback_table, const LookupTables &lookups,
-    const std::vector<uint32_t> &weights,
-    const std::unordered_set<encoded_word> *banned_guesses = nullptr);
+    const std::vector<encoded_word> &answers);
+
+// Sum of squared partition sizes of `possible_indices` under
+// words[guess_index]: the score find_best_guess_index minimises.
+uint64_t score_guess_index(const std::vector<size_t> &possible_indices,
+                           size_t guess_index,
+                           const std::vector<encoded_word> &words,
+                           const std::vector<encoded_word> &answers,
+                           const FeedbackTable *feedback_table);
+
+// Wall-clock cap on one find_best_guess_index call. Blocks of guesses
+// that start after `deadline` are skipped and `expired` is set, so the
+// result is the best guess among those scored in time. Raising `cancel`,
+// when given, ends the search the same way.
+struct GuessSearchBudget {
+  std::chrono::steady_clock::time_point deadline;
+  bool expired = false;
+  const std::atomic<bool> *cancel = nullptr;
+};
+
+// Optional counters for profiling find_best_guess_index. Searches only add
+// to them, so one instance can accumulate over many calls and threads.
+struct GuessSearchStats {
+  std::atomic<uint64_t> searches{0};
+  std::atomic<uint64_t> table_searches{0}; // read the feedback table
+  std::atomic<uint64_t> guesses_scored{0}; // scored over every candidate
+  std::atomic<uint64_t> guesses_pruned{0}; // dropped once they could not win
+  // Left out as equivalent to a lower-indexed guess (see
+  // distinct_guess_indices).
+  std::atomic<uint64_t> guesses_merged{0};
+  std::atomic<uint64_t> feedback_evaluated{0}; // (guess, candidate) pairs
+  std::atomic<uint64_t> busy_ns{0}; // summed over the pool participants
+};
+
+// Guess equivalence for one state. A letter no candidate contains is grey
+// wherever a guess places it and never changes another letter's colour, so
+// two guesses that agree on every position holding a letter the candidates
+// do contain give every candidate the same feedback. Fills `representatives`
+// with the lowest word index of each such class, ascending, and returns
+// true; returns false, leaving it empty, when the candidates use all 26
+// letters and every guess is its own class. Searching only the
+// representatives picks the same guess as searching every word.
+bool distinct_guess_indices(const std::vector<size_t> &possible_indices,
+                            const std::vector<encoded_word> &words,
+                            const std::vector<encoded_word> &answers,
+                            std::vector<uint32_t> &representatives);
+
+// Returns the index into `words` of the guess minimising the sum of squared
+// partition sizes over `possible_indices`, or kNoWordIndex if every guess is
+// banned (or none was scored within `budget`). `banned`, when given, holds
+// one byte per word; non-zero bytes are skipped. Ties go to the lowest word
+// index, so without a budget the result does not depend on the thread
+// count. The search runs on ThreadPool::instance() and shares its pruning
+// bound across workers. `stats`, when given, is added to. `guesses`, when
+// given, restricts the search to those ascending word indices, such as the
+// representatives from distinct_guess_indices.
+size_t find_best_guess_index(const std::vector<size_t> &possible_indices,
+                             const std::vector<encoded_word> &words,
+                             const std::vector<encoded_word> &answers,
+                             const FeedbackTable *feedback_table,
+                             const std::vector<uint8_t> *banned = nullptr,
+                             GuessSearchBudget *budget = nullptr,
+                             GuessSearchStats *stats = nullptr,
+                             const std::vector<uint32_t> *guesses = nullptr);
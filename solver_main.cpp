@@ -1,42 +1,145 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
+#include "embedded_lookup.h"
+#include "entropy_fallback.h"
 #include "feedback_cache.h"
 #include "lookup_generator.h"
+#include "lookup_registry.h"
+#include "opener_shards.h"
 #include "solver_core.h"
 #include "solver_runtime.h"
+#include "solver_server.h"
+#include "thread_pool.h"
+#include "tree_verifier.h"
 #include "words_data.h"
 
 void print_usage(const char *prog_name) {
   std::cout
       << "Usage:\n"
-      << "  " << prog_name << " solve <word> [--debug]\n"
-      << "  " << prog_name << " start [--debug]\n"
+      << "  " << prog_name << " solve <word> [--debug] [--lookup-start WORD]\n"
+         "         [--fallback] [--fallback-budget-ms N]\n"
+      << "  " << prog_name
+      << " solve-batch [FILE|-] [--threads N] [--dump-json] "
+         "[--lookup-start WORD]\n"
+         "         [--fallback] [--fallback-cache FILE] "
+         "[--fallback-budget-ms N]\n"
+      << "  " << prog_name
+      << " verify [FILE|-] [--threads N] [--lookup-start WORD] "
+         "[--lookup-dir DIR]\n"
+      << "  " << prog_name
+      << " start [--answer-list FILE] [--debug] [--shard I/N]\n"
+         "         [--shard-output FILE]\n"
+      << "  " << prog_name
+      << " serve [--socket PATH | --port N] [--lookup-start WORD]\n"
+         "         [--lookup-dir DIR] [--lookup-cache-mb N] [--fallback]\n"
+         "         [--fallback-cache FILE] [--fallback-budget-ms N]\n"
       << "  " << prog_name
       << " generate [--lookup-depth N] [--lookup-output FILE]\n"
-         "         [--lookup-start WORD] [--feedback-table]\n"
-         "         [--word-list FILE]\n"
+         "         [--lookup-start WORD] [--lookup-version N] "
+         "[--feedback-table]\n"
+         "         [--feedback-table-path FILE] [--feedback-row-cache-mb N]\n"
+         "         [--word-list FILE] [--answer-list FILE] [--threads N]\n"
+         "         [--resume] [--stats-json FILE] [--shard I/N]\n"
+         "         [--shard-output FILE] [--lookup-dir DIR]\n"
+         "         [--previous-lookup FILE] [--previous-word-list FILE]\n"
+         "         [--previous-answer-list FILE] "
+         "[--previous-feedback-table FILE]\n"
+      << "  " << prog_name << " merge FILE...\n"
       << "  " << prog_name << " help\n\n"
       << "Flags:\n"
       << "  --debug           Verbose turn-by-turn output plus lookup "
          "diagnostics.\n"
-      << "  --dump-json       Emit a JSON trace for solve mode instead of "
-         "text.\n"
+      << "  --dump-json       Emit a JSON trace for solve mode (JSON lines for "
+         "solve-batch) instead of text.\n"
+      << "  --threads N       Worker threads for solve-batch (default: 1, 0 = "
+         "all cores);\n"
+         "                    caps the pool for start/generate (default: "
+         "all cores).\n"
       << "  --lookup-depth N  Depth for lookup generation (default: 6).\n"
       << "  --lookup-output FILE  Output path for lookup table (default: "
          "lookup_<word>.bin).\n"
-      << "  --lookup-start WORD   Start word when generating lookups "
+      << "  --lookup-start WORD   Opener whose tree to generate or solve with "
          "(default: roate).\n"
+      << "  --lookup-dir DIR  Where solve/solve-batch/serve find "
+         "lookup_<word>.bin (default: .).\n"
+      << "  --lookup-cache-mb N   Resident tree budget for serve; "
+         "least recently used\n"
+         "                        trees are dropped beyond it (default: "
+         "256).\n"
+      << "  --fallback        Compute guesses live for states the lookup "
+         "tree lacks\n"
+         "                    (solve/solve-batch/serve) instead of failing.\n"
+      << "  --fallback-cache FILE  Persist fallback guesses to FILE across "
+         "runs\n"
+         "                    (implies --fallback).\n"
+      << "  --fallback-budget-ms N  Time cap per fallback search; the best "
+         "guess so far\n"
+         "                    is used when it expires (default: 50).\n"
+      << "  --lookup-version N    Lookup file format to emit: 1 (linear), 2 "
+         "(bitmap) or 3\n"
+         "                        (compact, default).\n"
       << "  --feedback-table  Rebuild feedback_table.bin before running.\n"
+      << "  --feedback-table-path FILE  Feedback cache to load/rebuild "
+         "(default:\n"
+         "                    feedback_table.bin). Use one per word list.\n"
+      << "  --feedback-row-cache-mb N  Compute feedback rows on first use "
+         "and keep up to\n"
+         "                    N MB of them instead of loading the table.\n"
+      << "  --feedback-prefault  Fault the whole feedback table in while "
+         "loading it.\n"
+      << "  --feedback-huge-pages MODE  Copy the table onto huge pages: off "
+         "(default),\n"
+         "                    transparent or explicit (needs "
+         "vm.nr_hugepages).\n"
+      << "  --feedback-numa-replicate  Keep one copy of the table per NUMA "
+         "node; each\n"
+         "                    thread reads its node's copy.\n"
       << "  --word-list FILE  Override the word list (generate mode only, for "
          "experiments).\n"
+      << "  --answer-list FILE  Restrict candidate answers to FILE (a subset of "
+         "the word\n"
+         "                    list) for start/generate; the feedback table "
+         "becomes\n"
+         "                    guesses x answers.\n"
+      << "  --resume          Continue an interrupted generate run from "
+         "<output>.ckpt.\n"
+      << "  --stats-json FILE Write a JSON profile of the generate run "
+         "(per-depth time,\n"
+         "                    pruning, partition sizes), refreshed while it "
+         "runs.\n"
+      << "  --shard I/N       Only the openers whose word index is I mod N: "
+         "start scores\n"
+         "                    them, generate builds and measures each one's "
+         "tree.\n"
+      << "  --shard-output FILE  Shard result file (default: "
+         "<mode>_shard_<I>_of_<N>.bin).\n"
+      << "  --previous-lookup FILE  Regenerate incrementally: reuse every "
+         "state of FILE\n"
+         "                    whose candidates the vocabulary change left "
+         "untouched.\n"
+      << "  --previous-word-list FILE  Word list FILE was built from "
+         "(default: embedded).\n"
+      << "  --previous-answer-list FILE  Answer list FILE was built from "
+         "(default: the\n"
+         "                    previous word list).\n"
+      << "  --previous-feedback-table FILE  Table for the previous lists; "
+         "rewrites\n"
+         "                    --feedback-table-path computing only new rows "
+         "and columns.\n"
+      << "  --socket PATH     Unix socket for serve mode (default: "
+         "solver.sock).\n"
+      << "  --port N          Serve over TCP on 127.0.0.1:N instead of a "
+         "Unix socket.\n"
       << "  --help            Show this summary.\n";
 }
 
@@ -48,10 +151,35 @@ int main(int argc, char *argv[]) {
   bool dump_json = false;
   bool disable_lookup = false;
   bool rebuild_feedback_table = false;
+  bool resume_generate = false;
+  std::string feedback_table_path(kFeedbackTablePath);
+  size_t feedback_row_cache_mb = 0;
+  FeedbackLoadOptions feedback_load_options;
+  bool feedback_load_options_set = false;
   std::string word_list_override;
+  std::string answer_list_path;
+  std::string lookup_dir = ".";
+  size_t lookup_cache_mb = 256;
+  bool use_fallback = false;
+  std::string fallback_cache_path;
+  uint64_t fallback_budget_ms = 50;
+  ServerOptions server_options;
+  bool server_endpoint_set = false;
+  std::string stats_json_path;
+  bool sharded = false;
+  ShardSpec shard;
+  std::string shard_output;
+  std::string previous_lookup_path;
+  std::string previous_word_list_path;
+  std::string previous_answer_list_path;
+  std::string previous_feedback_table_path;
   uint32_t lookup_depth = 6;
+  uint32_t lookup_version = kLookupVersionCompact;
+  unsigned int batch_threads = 1;
+  bool threads_set = false;
   std::string lookup_output;
   encoded_word lookup_start = kInitialGuess;
+  bool lookup_start_set = false;
 
   std::string mode;
   std::vector<std::string> positional;
@@ -66,6 +194,10 @@ int main(int argc, char *argv[]) {
       debug_flag = true;
       continue;
     }
+    if (arg == "--resume") {
+      resume_generate = true;
+      continue;
+    }
     if (arg == "--disable-lookup") {
       disable_lookup = true;
       continue;
@@ -82,6 +214,23 @@ int main(int argc, char *argv[]) {
       lookup_depth = static_cast<uint32_t>(std::stoul(argv[++i]));
       continue;
     }
+    if (arg == "--threads") {
+      if (i + 1 >= argc) {
+        std::cerr << "--threads requires a value.\n";
+        return 1;
+      }
+      batch_threads = static_cast<unsigned int>(std::stoul(argv[++i]));
+      threads_set = true;
+      continue;
+    }
+    if (arg == "--lookup-version") {
+      if (i + 1 >= argc) {
+        std::cerr << "--lookup-version requires a value.\n";
+        return 1;
+      }
+      lookup_version = static_cast<uint32_t>(std::stoul(argv[++i]));
+      continue;
+    }
     if (arg == "--lookup-output") {
       if (i + 1 >= argc) {
         std::cerr << "--lookup-output requires a path.\n";
@@ -98,6 +247,131 @@ int main(int argc, char *argv[]) {
       word_list_override = argv[++i];
       continue;
     }
+    if (arg == "--answer-list") {
+      if (i + 1 >= argc) {
+        std::cerr << "--answer-list requires a path.\n";
+        return 1;
+      }
+      answer_list_path = argv[++i];
+      continue;
+    }
+    if (arg == "--lookup-dir") {
+      if (i + 1 >= argc) {
+        std::cerr << "--lookup-dir requires a path.\n";
+        return 1;
+      }
+      lookup_dir = argv[++i];
+      continue;
+    }
+    if (arg == "--lookup-cache-mb") {
+      if (i + 1 >= argc) {
+        std::cerr << "--lookup-cache-mb requires a value.\n";
+        return 1;
+      }
+      lookup_cache_mb = static_cast<size_t>(std::stoul(argv[++i]));
+      continue;
+    }
+    if (arg == "--fallback") {
+      use_fallback = true;
+      continue;
+    }
+    if (arg == "--fallback-cache") {
+      if (i + 1 >= argc) {
+        std::cerr << "--fallback-cache requires a path.\n";
+        return 1;
+      }
+      fallback_cache_path = argv[++i];
+      use_fallback = true;
+      continue;
+    }
+    if (arg == "--fallback-budget-ms") {
+      if (i + 1 >= argc) {
+        std::cerr << "--fallback-budget-ms requires a value.\n";
+        return 1;
+      }
+      fallback_budget_ms = std::stoull(argv[++i]);
+      continue;
+    }
+    if (arg == "--socket") {
+      if (i + 1 >= argc) {
+        std::cerr << "--socket requires a path.\n";
+        return 1;
+      }
+      server_options.socket_path = argv[++i];
+      server_endpoint_set = true;
+      continue;
+    }
+    if (arg == "--port") {
+      if (i + 1 >= argc) {
+        std::cerr << "--port requires a value.\n";
+        return 1;
+      }
+      const unsigned long port = std::stoul(argv[++i]);
+      if (port == 0 || port > 65535) {
+        std::cerr << "--port must be between 1 and 65535.\n";
+        return 1;
+      }
+      server_options.port = static_cast<uint16_t>(port);
+      server_endpoint_set = true;
+      continue;
+    }
+    if (arg == "--previous-lookup") {
+      if (i + 1 >= argc) {
+        std::cerr << "--previous-lookup requires a path.\n";
+        return 1;
+      }
+      previous_lookup_path = argv[++i];
+      continue;
+    }
+    if (arg == "--previous-word-list") {
+      if (i + 1 >= argc) {
+        std::cerr << "--previous-word-list requires a path.\n";
+        return 1;
+      }
+      previous_word_list_path = argv[++i];
+      continue;
+    }
+    if (arg == "--previous-answer-list") {
+      if (i + 1 >= argc) {
+        std::cerr << "--previous-answer-list requires a path.\n";
+        return 1;
+      }
+      previous_answer_list_path = argv[++i];
+      continue;
+    }
+    if (arg == "--shard") {
+      if (i + 1 >= argc || !parse_shard_spec(argv[i + 1], shard)) {
+        std::cerr << "--shard requires I/N with 0 <= I < N.\n";
+        return 1;
+      }
+      ++i;
+      sharded = true;
+      continue;
+    }
+    if (arg == "--shard-output") {
+      if (i + 1 >= argc) {
+        std::cerr << "--shard-output requires a path.\n";
+        return 1;
+      }
+      shard_output = argv[++i];
+      continue;
+    }
+    if (arg == "--stats-json") {
+      if (i + 1 >= argc) {
+        std::cerr << "--stats-json requires a path.\n";
+        return 1;
+      }
+      stats_json_path = argv[++i];
+      continue;
+    }
+    if (arg == "--previous-feedback-table") {
+      if (i + 1 >= argc) {
+        std::cerr << "--previous-feedback-table requires a path.\n";
+        return 1;
+      }
+      previous_feedback_table_path = argv[++i];
+      continue;
+    }
     if (arg == "--lookup-start") {
       if (i + 1 >= argc) {
         std::cerr << "--lookup-start requires a word.\n";
@@ -109,13 +383,58 @@ int main(int argc, char *argv[]) {
         return 1;
       }
       lookup_start = encode_word(start_arg);
+      lookup_start_set = true;
+      continue;
+    }
+    if (arg == "--feedback-table-path") {
+      if (i + 1 >= argc) {
+        std::cerr << "--feedback-table-path requires a path.\n";
+        return 1;
+      }
+      feedback_table_path = argv[++i];
+      continue;
+    }
+    if (arg == "--feedback-row-cache-mb") {
+      if (i + 1 >= argc) {
+        std::cerr << "--feedback-row-cache-mb requires a value.\n";
+        return 1;
+      }
+      feedback_row_cache_mb = static_cast<size_t>(std::stoull(argv[++i]));
+      if (feedback_row_cache_mb == 0) {
+        std::cerr << "--feedback-row-cache-mb must be at least 1.\n";
+        return 1;
+      }
+      continue;
+    }
+    if (arg == "--feedback-prefault") {
+      feedback_load_options.prefault = true;
+      feedback_load_options_set = true;
+      continue;
+    }
+    if (arg == "--feedback-huge-pages") {
+      if (i + 1 >= argc) {
+        std::cerr << "--feedback-huge-pages requires a value.\n";
+        return 1;
+      }
+      if (!parse_feedback_huge_pages(argv[++i],
+                                     feedback_load_options.huge_pages)) {
+        std::cerr << "--feedback-huge-pages must be off, transparent or "
+                     "explicit.\n";
+        return 1;
+      }
+      feedback_load_options_set = true;
+      continue;
+    }
+    if (arg == "--feedback-numa-replicate") {
+      feedback_load_options.numa_replicate = true;
+      feedback_load_options_set = true;
       continue;
     }
     if (arg == "--feedback-table") {
       rebuild_feedback_table = true;
       continue;
     }
-    if (!arg.empty() && arg[0] == '-') {
+    if (!arg.empty() && arg[0] == '-' && arg != "-") {
       std::cerr << "Unknown flag: " << arg << "\n";
       return 1;
     }
@@ -143,17 +462,81 @@ int main(int argc, char *argv[]) {
   }
 
   const bool solve_mode = normalized_mode == "solve";
+  const bool batch_mode = normalized_mode == "solve-batch";
   const bool start_mode = normalized_mode == "start";
   const bool generate_mode = normalized_mode == "generate";
+  const bool serve_mode = normalized_mode == "serve";
+  const bool merge_mode = normalized_mode == "merge";
+  const bool verify_mode = normalized_mode == "verify";
 
-  if (!solve_mode && !start_mode && !generate_mode) {
+  if (!solve_mode && !batch_mode && !start_mode && !generate_mode &&
+      !serve_mode && !merge_mode && !verify_mode) {
     std::cerr << "Unknown mode '" << mode << "'.\n";
     print_usage(argv[0]);
     return 1;
   }
 
-  if (dump_json && !solve_mode) {
-    std::cerr << "--dump-json is only valid in solve mode.\n";
+  if (dump_json && !solve_mode && !batch_mode) {
+    std::cerr << "--dump-json is only valid in solve and solve-batch modes.\n";
+    return 1;
+  }
+  if (resume_generate && !generate_mode) {
+    std::cerr << "--resume is only valid in generate mode.\n";
+    return 1;
+  }
+  if ((sharded || !shard_output.empty()) && !start_mode && !generate_mode) {
+    std::cerr << "--shard and --shard-output are only valid in start and "
+                 "generate modes.\n";
+    return 1;
+  }
+  if (!shard_output.empty() && !sharded) {
+    std::cerr << "--shard-output requires --shard.\n";
+    return 1;
+  }
+  if (sharded && generate_mode &&
+      (lookup_start_set || !lookup_output.empty() ||
+       !previous_lookup_path.empty())) {
+    std::cerr << "generate --shard builds every opener in the shard; drop "
+                 "--lookup-start,\n--lookup-output and --previous-lookup.\n";
+    return 1;
+  }
+  if (merge_mode) {
+    return merge_shard_files(positional, std::cout) ? 0 : 1;
+  }
+  if (!stats_json_path.empty() && !generate_mode) {
+    std::cerr << "--stats-json is only valid in generate mode.\n";
+    return 1;
+  }
+  if (use_fallback && !solve_mode && !batch_mode && !serve_mode) {
+    std::cerr << "--fallback is only valid in solve, solve-batch and serve "
+                 "modes.\n";
+    return 1;
+  }
+  if (server_endpoint_set && !serve_mode) {
+    std::cerr << "--socket and --port are only valid in serve mode.\n";
+    return 1;
+  }
+  if (serve_mode && !server_options.socket_path.empty() &&
+      server_options.port != 0) {
+    std::cerr << "serve mode takes either --socket or --port, not both.\n";
+    return 1;
+  }
+  if (serve_mode && server_options.port == 0 &&
+      server_options.socket_path.empty()) {
+    server_options.socket_path = "solver.sock";
+  }
+  const bool incremental = !previous_lookup_path.empty() ||
+                           !previous_feedback_table_path.empty();
+  if (!generate_mode &&
+      (incremental || !previous_word_list_path.empty() ||
+       !previous_answer_list_path.empty())) {
+    std::cerr << "--previous-* flags are only valid in generate mode.\n";
+    return 1;
+  }
+  if (!incremental && (!previous_word_list_path.empty() ||
+                       !previous_answer_list_path.empty())) {
+    std::cerr << "--previous-word-list and --previous-answer-list require "
+                 "--previous-lookup or --previous-feedback-table.\n";
     return 1;
   }
   if (disable_lookup) {
@@ -161,9 +544,23 @@ int main(int argc, char *argv[]) {
                  "precomputed solver.\n";
     return 1;
   }
+  // start/generate use the whole pool by default; --threads caps it.
+  if ((start_mode || generate_mode) && threads_set) {
+    ThreadPool::set_default_concurrency(batch_threads);
+  }
 
   std::string word_to_solve;
-  if (solve_mode) {
+  std::string batch_input;
+  if (batch_mode || verify_mode) {
+    if (positional.size() > 1) {
+      std::cerr << normalized_mode << " accepts at most one input file.\n";
+      return 1;
+    }
+    if (!positional.empty()) {
+      batch_input = positional.front();
+      positional.clear();
+    }
+  } else if (solve_mode) {
     if (!positional.empty()) {
       word_to_solve = positional.front();
       positional.erase(positional.begin());
@@ -189,9 +586,6 @@ int main(int argc, char *argv[]) {
   std::unique_ptr<std::vector<encoded_word>> custom_words;
   std::unique_ptr<LookupTables> custom_lookup_tables;
 
-  const std::vector<uint32_t> *word_weights = &load_word_weights();
-  std::unique_ptr<std::vector<uint32_t>> custom_weights;
-
   if (!word_list_override.empty()) {
     if (!generate_mode) {
       std::cerr << "--word-list override currently supported only in generate mode.\n";
@@ -204,85 +598,361 @@ int main(int argc, char *argv[]) {
     }
     custom_lookup_tables = std::make_unique<LookupTables>(
         build_lookup_tables_from_words(*custom_words));
-    custom_weights = std::make_unique<std::vector<uint32_t>>(
-        compute_word_weights(*custom_words));
     words = custom_words.get();
     lookups = custom_lookup_tables.get();
-    word_weights = custom_weights.get();
   }
   if (words->empty()) {
     std::cerr << "Embedded word list is empty. Exiting.\n";
     return 1;
   }
 
+  // Candidate answers default to the full vocabulary; --answer-list narrows
+  // them (and the feedback table's columns) to a subset.
+  const std::vector<encoded_word> *answers = words;
+  std::unique_ptr<std::vector<encoded_word>> custom_answers;
+  if (!answer_list_path.empty()) {
+    if (!generate_mode && !start_mode) {
+      std::cerr << "--answer-list is only supported in start and generate "
+                   "modes.\n";
+      return 1;
+    }
+    custom_answers = std::make_unique<std::vector<encoded_word>>(
+        load_words_from_file(answer_list_path));
+    if (custom_answers->empty()) {
+      return 1;
+    }
+    for (const auto answer : *custom_answers) {
+      if (!lookups->word_index.contains(answer)) {
+        std::cerr << "Answer '" << decode_word(answer)
+                  << "' is not in the word list.\n";
+        return 1;
+      }
+    }
+    answers = custom_answers.get();
+  }
+
+  // The vocabulary generate last ran with; defaults to the embedded list.
+  const std::vector<encoded_word> *previous_words = &load_words();
+  const std::vector<encoded_word> *previous_answers = previous_words;
+  std::unique_ptr<std::vector<encoded_word>> custom_previous_words;
+  std::unique_ptr<std::vector<encoded_word>> custom_previous_answers;
+  if (incremental) {
+    if (!previous_word_list_path.empty()) {
+      custom_previous_words = std::make_unique<std::vector<encoded_word>>(
+          load_words_from_file(previous_word_list_path));
+      if (custom_previous_words->empty()) {
+        return 1;
+      }
+      previous_words = custom_previous_words.get();
+      previous_answers = previous_words;
+    }
+    if (!previous_answer_list_path.empty()) {
+      custom_previous_answers = std::make_unique<std::vector<encoded_word>>(
+          load_words_from_file(previous_answer_list_path));
+      if (custom_previous_answers->empty()) {
+        return 1;
+      }
+      previous_answers = custom_previous_answers.get();
+    }
+  }
+
   if (rebuild_feedback_table) {
-    if (!build_feedback_table_file(std::string(kFeedbackTablePath), *words)) {
+    if (!build_feedback_table_file(feedback_table_path, *words, *answers)) {
+      return 1;
+    }
+  } else if (!previous_feedback_table_path.empty()) {
+    const FeedbackTable previous_table = load_feedback_table(
+        previous_feedback_table_path, *previous_words, *previous_answers);
+    if (!previous_table.loaded()) {
+      std::cerr << "Previous feedback table '" << previous_feedback_table_path
+                << "' does not match the previous word lists.\n";
+      return 1;
+    }
+    if (!update_feedback_table_file(feedback_table_path, previous_table,
+                                    *previous_words, *previous_answers,
+                                    *words, *answers)) {
       return 1;
     }
   }
 
+  // Walking a tree never scores feedback in bulk, so plain solves skip the
+  // table (and the file access) entirely.
+  const bool needs_feedback_table =
+      start_mode || generate_mode || use_fallback || rebuild_feedback_table;
+  if (feedback_row_cache_mb != 0 && !needs_feedback_table) {
+    std::cerr << "--feedback-row-cache-mb is only valid in start and generate "
+                 "modes or with --fallback.\n";
+    return 1;
+  }
+  if (feedback_load_options_set && feedback_row_cache_mb != 0) {
+    std::cerr << "--feedback-prefault, --feedback-huge-pages and "
+                 "--feedback-numa-replicate place the full table and cannot "
+                 "be combined with --feedback-row-cache-mb.\n";
+    return 1;
+  }
   FeedbackTable feedback_table;
+  if (feedback_row_cache_mb != 0) {
+    feedback_table = make_lazy_feedback_table(*words, *answers,
+                                              feedback_row_cache_mb << 20);
+  } else if (needs_feedback_table) {
+    feedback_table = load_feedback_table(feedback_table_path, *words, *answers,
+                                         feedback_load_options);
+  }
+  const PageFaultCounts faults_after_load = process_page_faults();
+  const auto report_feedback_table = [&]() {
+    if (debug_flag && feedback_table.loaded() && !feedback_table.lazy()) {
+      const PageFaultCounts faults = process_page_faults();
+      std::cerr << "[feedback] page faults since load: minor="
+                << faults.minor - faults_after_load.minor
+                << " major=" << faults.major - faults_after_load.major << "\n";
+    }
+    if (!feedback_table.lazy()) {
+      return;
+    }
+    const FeedbackRowCacheStats s = feedback_table.row_cache_stats();
+    std::cerr << "[feedback] row cache hits=" << s.hits
+              << " misses=" << s.misses << " evictions=" << s.evictions
+              << " uncached=" << s.uncached << " slots=" << s.slots << "\n";
+  };
   const FeedbackTable *feedback_ptr = nullptr;
-  if (word_list_override.empty()) {
-    feedback_table =
-        load_feedback_table(std::string(kFeedbackTablePath), words->size());
-    if (feedback_table.loaded()) {
-      feedback_ptr = &feedback_table;
-    } else {
-      std::cerr << "Warning: feedback table not found at '"
-                << kFeedbackTablePath
-                << "'. Falling back to slower feedback calculation.\n";
+  if (debug_flag) {
+    std::cerr << "[feedback] batch kernel: " << feedback_batch_kernel_name()
+              << " partition kernel: " << partition_kernel_name() << "\n";
+    if (feedback_table.loaded() && !feedback_table.lazy()) {
+      const FeedbackLoadStats &s = feedback_table.load_stats;
+      std::cerr << "[feedback] table load: backing=" << s.backing
+                << " prefault=" << (s.prefaulted ? "yes" : "no")
+                << " huge_pages=" << feedback_huge_pages_name(s.huge_pages)
+                << " replicas=" << s.replicas
+                << " time_ms=" << s.load_ns / 1000000.0
+                << " minor_faults=" << s.minor_faults
+                << " major_faults=" << s.major_faults << "\n";
     }
   }
+  if (feedback_table.loaded()) {
+    feedback_ptr = &feedback_table;
+  } else if (needs_feedback_table) {
+    std::cerr << "Warning: no usable feedback table at '"
+              << feedback_table_path
+              << "'. Falling back to slower feedback calculation (or pass "
+                 "--feedback-row-cache-mb N).\n";
+  }
+
+  if (sharded) {
+    if (shard_output.empty()) {
+      shard_output = default_shard_output(normalized_mode, shard);
+    }
+    const bool ok =
+        start_mode
+            ? run_start_shard(shard_output, shard, *words, *answers,
+                              feedback_ptr)
+            : run_generate_shard(shard_output, shard, *words, *answers,
+                                 feedback_ptr, *lookups, lookup_depth,
+                                 lookup_version, lookup_dir, resume_generate);
+    report_feedback_table();
+    return ok ? 0 : 1;
+  }
 
   if (generate_mode) {
-    if (!lookups->word_index.count(lookup_start)) {
+    if (!lookups->word_index.contains(lookup_start)) {
       std::cerr << "Lookup start word must be in the allowed guess list.\n";
       return 1;
     }
     if (lookup_output.empty()) {
       lookup_output = "lookup_" + decode_word(lookup_start) + ".bin";
     }
-    if (!generate_lookup_table(lookup_output, *words, lookup_start, lookup_depth,
-                               feedback_ptr, *lookups)) {
+    PrecomputedLookup previous_lookup;
+    const PrecomputedLookup *previous_ptr = nullptr;
+    if (!previous_lookup_path.empty()) {
+      if (!previous_lookup.load(previous_lookup_path, lookup_start,
+                                *previous_words)) {
+        std::cerr << "Failed to load previous lookup table '"
+                  << previous_lookup_path << "'.\n";
+        return 1;
+      }
+      previous_ptr = &previous_lookup;
+    }
+    if (!generate_lookup_table(lookup_output, *words, *answers, lookup_start,
+                               lookup_depth, feedback_ptr, *lookups,
+                               lookup_version, resume_generate,
+                               previous_ptr, stats_json_path)) {
       return 1;
     }
+    report_feedback_table();
     return 0;
   }
 
-  PrecomputedLookup lookup_table;
-  const PrecomputedLookup *lookup_ptr = nullptr;
-  if (!disable_lookup &&
-      lookup_table.load("lookup_roate.bin", kInitialGuess)) {
-    lookup_ptr = &lookup_table;
+  // Trees are loaded through the registry so serve can switch openers per
+  // request; solve and solve-batch only ever ask for --lookup-start's.
+  LookupRegistry trees(lookup_dir, lookup_cache_mb << 20, *words);
+#if defined(SOLVER_EMBEDDED_LOOKUP)
+  // The compiled-in tree answers for its opener without touching the disk.
+  auto embedded_tree = std::make_shared<PrecomputedLookup>();
+  if (embedded_tree->attach(embedded_lookup_data(), embedded_lookup_size(),
+                            *words)) {
+    trees.pin(std::move(embedded_tree));
+  } else {
+    std::cerr << "Warning: the embedded lookup tree does not match the word "
+                 "list; using lookup files only.\n";
+  }
+#endif
+  std::unique_ptr<EntropyFallback> fallback;
+  if (use_fallback) {
+    fallback = std::make_unique<EntropyFallback>(
+        *words, *answers, feedback_ptr, *lookups,
+        std::chrono::milliseconds(fallback_budget_ms));
+    if (!fallback_cache_path.empty() &&
+        !fallback->open_overlay(fallback_cache_path)) {
+      return 1;
+    }
+  }
+  if (serve_mode) {
+    if (!trees.acquire(lookup_start)) {
+      std::cerr << "Lookup file '"
+                << LookupRegistry::path_for(lookup_dir, lookup_start)
+                << "' not found or not built for this word list.\n";
+      return 1;
+    }
+    return run_server(server_options, trees, lookup_start, fallback.get())
+               ? 0
+               : 1;
   }
-  if (solve_mode && !lookup_ptr) {
-    std::cerr << "Lookup file 'lookup_roate.bin' not found. Run `"
-              << "./build/solver generate --lookup-start roate --lookup-depth "
-                 "6 --lookup-output lookup_roate.bin` first.\n";
+  std::shared_ptr<const PrecomputedLookup> lookup_tree;
+  if ((solve_mode || batch_mode || verify_mode) && !disable_lookup) {
+    lookup_tree = trees.acquire(lookup_start);
+  }
+  const PrecomputedLookup *lookup_ptr = lookup_tree.get();
+  if ((solve_mode || batch_mode || verify_mode) && !lookup_ptr) {
+    const std::string start_word = decode_word(lookup_start);
+    std::cerr << "Lookup file '"
+              << LookupRegistry::path_for(lookup_dir, lookup_start)
+              << "' not found. Run `./build/solver generate --lookup-start "
+              << start_word << " --lookup-depth 6 --lookup-output lookup_"
+              << start_word << ".bin` first.\n";
     return 1;
   }
 
+  if (verify_mode) {
+    // Every word by default; a list checks just those targets.
+    std::vector<std::string> names;
+    std::vector<encoded_word> targets;
+    if (batch_input.empty()) {
+      for (const encoded_word word : *words) {
+        names.push_back(decode_word(word));
+        targets.push_back(word);
+      }
+    } else {
+      std::ifstream target_file;
+      std::istream *target_in = &std::cin;
+      if (batch_input != "-") {
+        target_file.open(batch_input);
+        if (!target_file.is_open()) {
+          std::cerr << "Failed to open target list '" << batch_input
+                    << "'.\n";
+          return 1;
+        }
+        target_in = &target_file;
+      }
+      std::string line;
+      while (std::getline(*target_in, line)) {
+        line.erase(std::remove_if(line.begin(), line.end(),
+                                  [](unsigned char c) {
+                                    return std::isspace(c);
+                                  }),
+                   line.end());
+        if (line.empty()) {
+          continue;
+        }
+        for (char &c : line) {
+          c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        const encoded_word target = encode_word(line);
+        const bool valid =
+            line.size() == 5 && lookups->word_index.contains(target);
+        targets.push_back(valid ? target : 0);
+        names.push_back(std::move(line));
+      }
+    }
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    const TreeVerifyReport report = verify_tree(
+        *lookup_ptr, targets, threads_set ? batch_threads : 0);
+    const auto end_time = std::chrono::high_resolution_clock::now();
+    const std::chrono::duration<double> elapsed = end_time - start_time;
+    write_verify_targets(std::cout, report, names);
+    std::cout.flush();
+    write_verify_summary(std::cerr, report);
+    std::cerr << "[verify] elapsed=" << elapsed.count() << "s\n";
+    return report.passed() ? 0 : 2;
+  }
+
   if (start_mode) {
-    std::vector<size_t> indices(words->size());
+    std::vector<size_t> indices(answers->size());
     std::iota(indices.begin(), indices.end(), 0);
     std::cout << "Calculating the best starting word across " << words->size()
-              << " valid words..." << std::endl;
+              << " valid words";
+    if (answers != words) {
+      std::cout << " against " << answers->size() << " answers";
+    }
+    std::cout << "..." << std::endl;
 
     const auto start_time = std::chrono::high_resolution_clock::now();
-    const encoded_word best_word =
-        find_best_guess_encoded(indices, *words, feedback_ptr, *lookups,
-                                *word_weights);
+    const encoded_word best_word = words->at(find_best_guess_index(
+        indices, *words, *answers, feedback_ptr));
     const auto end_time = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> elapsed = end_time - start_time;
 
     std::cout << "\nBest starting word: " << decode_word(best_word)
               << "\nCalculation time: " << elapsed.count() << " seconds.\n";
+    report_feedback_table();
     return 0;
   }
 
+  if (batch_mode) {
+    BatchSolveOptions options;
+    options.json = dump_json;
+    options.threads = batch_threads;
+    options.fallback = fallback.get();
+    if (options.threads == 0) {
+      options.threads = std::thread::hardware_concurrency();
+    }
+    std::ifstream batch_file;
+    std::istream *batch_in = &std::cin;
+    if (!batch_input.empty() && batch_input != "-") {
+      batch_file.open(batch_input);
+      if (!batch_file.is_open()) {
+        std::cerr << "Failed to open target list '" << batch_input << "'.\n";
+        return 1;
+      }
+      batch_in = &batch_file;
+    }
+
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    const BatchSolveSummary summary =
+        run_batch_solve(*batch_in, std::cout, *words, feedback_ptr, *lookups,
+                        lookup_ptr, options);
+    const auto end_time = std::chrono::high_resolution_clock::now();
+    const std::chrono::duration<double> elapsed = end_time - start_time;
+    if (debug_flag) {
+      const double average =
+          summary.solved ? static_cast<double>(summary.total_guesses) /
+                               static_cast<double>(summary.solved)
+                         : 0.0;
+      std::cerr << "[batch] targets=" << summary.targets
+                << " solved=" << summary.solved
+                << " failed=" << summary.failed
+                << " invalid=" << summary.invalid
+                << " avg_guesses=" << average
+                << " elapsed=" << elapsed.count() << "s\n";
+      if (fallback) {
+        std::cerr << "[batch] " << fallback->stats_summary() << "\n";
+      }
+    }
+    return summary.failed == 0 && summary.invalid == 0 ? 0 : 2;
+  }
+
   const encoded_word encoded_answer = encode_word(word_to_solve);
-  if (!lookups->word_index.count(encoded_answer)) {
+  if (!lookups->word_index.contains(encoded_answer)) {
     std::cerr << "Error: '" << word_to_solve
               << "' is not in the valid word list.\n";
     return 1;
@@ -290,18 +960,12 @@ int main(int argc, char *argv[]) {
 
   SolutionTrace trace;
   run_non_interactive(encoded_answer, *words, debug_flag, !dump_json, &trace,
-                      debug_flag, feedback_ptr, *lookups, lookup_ptr);
+                      debug_flag, feedback_ptr, *lookups, lookup_ptr,
+                      fallback.get());
 
   if (dump_json) {
-    std::cout << "[";
-    for (size_t i = 0; i < trace.steps.size(); ++i) {
-      const auto &step = trace.steps[i];
-      std::cout << "{\"guess\":\"" << decode_word(step.guess)
-                << "\",\"feedback\":" << step.feedback << "}";
-      if (i + 1 < trace.steps.size())
-        std::cout << ",";
-    }
-    std::cout << "]\n";
+    write_trace_json(std::cout, trace);
+    std::cout << "\n";
   } else if (!debug_flag) {
     for (const auto &step : trace.steps) {
       std::cout << decode_word(step.guess) << ' ';
@@ -1,12 +1,98 @@
 #include "solver_runtime.h"
 
+#include "entropy_fallback.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cctype>
 #include <chrono>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+PrecomputedLookup::PrecomputedLookup(PrecomputedLookup &&other) noexcept {
+  *this = std::move(other);
+}
+
+PrecomputedLookup &
+PrecomputedLookup::operator=(PrecomputedLookup &&other) noexcept {
+  if (this != &other) {
+    release();
+    buffer_ = std::move(other.buffer_);
+    mapped_data_ = other.mapped_data_;
+    mapping_length_ = other.mapping_length_;
+    borrowed_ = other.borrowed_;
+    root_ptr_ = other.root_ptr_;
+    depth_ = other.depth_;
+    version_ = other.version_;
+    start_word_ = other.start_word_;
+    words_ = other.words_;
+    word_count_ = other.word_count_;
+    other.mapped_data_ = nullptr;
+    other.mapping_length_ = 0;
+    other.borrowed_ = false;
+    other.root_ptr_ = nullptr;
+    other.depth_ = 0;
+    other.version_ = 0;
+    other.start_word_ = 0;
+    other.words_ = nullptr;
+    other.word_count_ = 0;
+  }
+  return *this;
+}
+
+PrecomputedLookup::~PrecomputedLookup() { release(); }
+
+void PrecomputedLookup::release() {
+#if defined(__unix__) || defined(__APPLE__)
+  if (mapped_data_ && !borrowed_) {
+    munmap(const_cast<uint8_t *>(mapped_data_), mapping_length_);
+  }
+#endif
+  mapped_data_ = nullptr;
+  mapping_length_ = 0;
+  borrowed_ = false;
+  buffer_.clear();
+  root_ptr_ = nullptr;
+  depth_ = 0;
+  version_ = 0;
+  start_word_ = 0;
+  words_ = nullptr;
+  word_count_ = 0;
+}
 
 bool PrecomputedLookup::load(const std::string &path,
-                             encoded_word expected_start) {
+                             encoded_word expected_start,
+                             const std::vector<encoded_word> &words) {
+  release();
+#if defined(__unix__) || defined(__APPLE__)
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat st {};
+    if (fstat(fd, &st) == 0 &&
+        static_cast<size_t>(st.st_size) >= sizeof(LookupHeader)) {
+      void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (mapping != MAP_FAILED) {
+        mapped_data_ = static_cast<const uint8_t *>(mapping);
+        mapping_length_ = static_cast<size_t>(st.st_size);
+        ::close(fd);
+        if (parse_header(expected_start, words))
+          return true;
+        release();
+        return false;
+      }
+    }
+    ::close(fd);
+  }
+#endif
   std::ifstream file(path, std::ios::binary | std::ios::ate);
   if (!file.is_open())
     return false;
@@ -17,58 +103,190 @@ bool PrecomputedLookup::load(const std::string &path,
     buffer_.clear();
     return false;
   }
-  if (buffer_.size() < sizeof(LookupHeader))
+  if (parse_header(expected_start, words))
+    return true;
+  release();
+  return false;
+}
+
+bool PrecomputedLookup::attach(const uint8_t *image, size_t length,
+                               const std::vector<encoded_word> &words) {
+  release();
+  if (!image || length < sizeof(LookupHeader))
+    return false;
+  mapped_data_ = image;
+  mapping_length_ = length;
+  borrowed_ = true;
+  LookupHeader header{};
+  std::memcpy(&header, image, sizeof(header));
+  if (parse_header(header.start_encoded, words))
+    return true;
+  release();
+  return false;
+}
+
+bool PrecomputedLookup::parse_header(encoded_word expected_start,
+                                     const std::vector<encoded_word> &words) {
+  if (size() < sizeof(LookupHeader))
     return false;
   LookupHeader header{};
-  std::memcpy(&header, buffer_.data(), sizeof(header));
+  std::memcpy(&header, data(), sizeof(header));
   if (std::memcmp(header.magic, "PLUT", 4) != 0)
     return false;
-  if (header.version != 1)
+  if (header.version != kLookupVersionLinear &&
+      header.version != kLookupVersionBitmap &&
+      header.version != kLookupVersionCompact)
     return false;
+  version_ = header.version;
   depth_ = header.depth;
-  start_word_ = header.start_encoded;
+  start_word_ = static_cast<encoded_word>(header.start_encoded);
   if (start_word_ != expected_start)
     return false;
-  if (header.root_offset >= buffer_.size())
+  if (header.root_offset >= size())
     return false;
-  root_ptr_ = buffer_.data() + header.root_offset;
+  if (header.version == kLookupVersionCompact) {
+    if (size() < sizeof(LookupHeader) + sizeof(LookupWordList))
+      return false;
+    LookupWordList info{};
+    std::memcpy(&info, data() + sizeof(LookupHeader), sizeof(info));
+    if (info.word_count != words.size() ||
+        info.word_hash != hash_word_list(words))
+      return false;
+    words_ = words.data();
+    word_count_ = words.size();
+  }
+  root_ptr_ = data() + header.root_offset;
   return true;
 }
 
+namespace {
+
+inline unsigned popcount64(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_popcountll(value));
+#else
+  unsigned count = 0;
+  for (; value; value &= value - 1)
+    ++count;
+  return count;
+#endif
+}
+
+} // namespace
+
+const uint8_t *
+PrecomputedLookup::find_compact_child(const uint8_t *node, uint16_t feedback,
+                                      encoded_word &guess_out) const {
+  // A damaged file must not send reads outside the image: every field is
+  // checked against its end (and guess indices against the word list), and
+  // a node that fails a check has no branches.
+  const uint8_t *const image_end = data() + size();
+  const auto fits = [&](const uint8_t *from, size_t bytes) {
+    return from <= image_end && bytes <= static_cast<size_t>(image_end - from);
+  };
+  if (!fits(node, 2))
+    return nullptr;
+  const uint32_t count = node[0];
+  const uint8_t flags = node[1];
+  const uint8_t *ptr = node + 2;
+  uint32_t rank = 0;
+  if (flags & kCompactNodeBitmap) {
+    if (feedback >= 243 || !fits(ptr, 4 + 4 * sizeof(uint64_t)))
+      return nullptr;
+    const unsigned word = feedback >> 6;
+    const uint64_t bit = uint64_t{1} << (feedback & 63);
+    uint64_t presence = 0;
+    std::memcpy(&presence, ptr + 4 + word * sizeof(uint64_t), sizeof(presence));
+    if (!(presence & bit))
+      return nullptr;
+    rank = ptr[word] + popcount64(presence & (bit - 1));
+    ptr += 4 + 4 * sizeof(uint64_t);
+  } else {
+    if (!fits(ptr, count))
+      return nullptr;
+    while (rank < count && ptr[rank] < feedback)
+      ++rank;
+    if (rank == count || ptr[rank] != feedback)
+      return nullptr;
+    ptr += count;
+  }
+  // Guess indices, then one child slot per entry.
+  if (rank >= count || !fits(ptr, count * (sizeof(uint16_t) + 1)))
+    return nullptr;
+  uint16_t guess_index = 0;
+  std::memcpy(&guess_index, ptr + rank * sizeof(uint16_t), sizeof(guess_index));
+  if (guess_index >= word_count_)
+    return nullptr;
+  ptr += count * sizeof(uint16_t);
+  const uint8_t slot = ptr[rank];
+  if (slot == kCompactLeafSlot) {
+    guess_out = words_[guess_index];
+    return nullptr;
+  }
+  ptr += count;
+  const uint8_t *const child_field = ptr + slot * sizeof(uint32_t);
+  if (!fits(child_field, sizeof(uint32_t)))
+    return nullptr;
+  uint32_t child = 0;
+  std::memcpy(&child, child_field, sizeof(child));
+  if (child == 0 || child >= size())
+    return nullptr;
+  guess_out = words_[guess_index];
+  return data() + child;
+}
+
 const uint8_t *PrecomputedLookup::find_child(const uint8_t *node,
                                              uint16_t feedback,
                                              encoded_word &guess_out) const {
   if (!node)
     return nullptr;
+  if (version_ == kLookupVersionCompact)
+    return find_compact_child(node, feedback, guess_out);
   uint32_t count = *reinterpret_cast<const uint32_t *>(node);
-  const uint8_t *ptr = node + 4;
-  for (uint32_t i = 0; i < count; ++i) {
-    uint16_t fb = *reinterpret_cast<const uint16_t *>(ptr);
-    ptr += 2;
-    ptr += 2;
-    encoded_word guess = *reinterpret_cast<const encoded_word *>(ptr);
-    ptr += sizeof(encoded_word);
-    uint32_t child = *reinterpret_cast<const uint32_t *>(ptr);
-    ptr += 4;
-    if (fb == feedback) {
-      guess_out = guess;
-      if (child == 0)
-        return nullptr;
-      return buffer_.data() + child;
-    }
-  }
-  return nullptr;
+  const uint8_t *entry = nullptr;
+  if (version_ == kLookupVersionBitmap) {
+    if (feedback >= 243)
+      return nullptr;
+    const unsigned word = feedback >> 6;
+    const uint64_t bit = uint64_t{1} << (feedback & 63);
+    const uint8_t *rank_base = node + 4;
+    const uint64_t presence =
+        reinterpret_cast<const uint64_t *>(node + 8)[word];
+    if (!(presence & bit))
+      return nullptr;
+    const unsigned rank = rank_base[word] + popcount64(presence & (bit - 1));
+    if (rank >= count)
+      return nullptr;
+    entry = node + kLookupBitmapNodeHeaderSize + rank * kLookupEntrySize;
+  } else {
+    const uint8_t *ptr = node + 4;
+    for (uint32_t i = 0; i < count; ++i, ptr += kLookupEntrySize) {
+      if (*reinterpret_cast<const uint16_t *>(ptr) == feedback) {
+        entry = ptr;
+        break;
+      }
+    }
+    if (!entry)
+      return nullptr;
+  }
+  guess_out = static_cast<encoded_word>(
+      *reinterpret_cast<const uint64_t *>(entry + 4));
+  uint32_t child = *reinterpret_cast<const uint32_t *>(entry + 12);
+  if (child == 0)
+    return nullptr;
+  return data() + child;
 }
 
-void run_non_interactive(encoded_word answer,
+bool run_non_interactive(encoded_word answer,
                          const std::vector<encoded_word> &words,
                          bool verbose, bool print_output, SolutionTrace *trace,
                          bool debug_lookup, const FeedbackTable *,
-                         const LookupTables &, const PrecomputedLookup *tree) {
+                         const LookupTables &, const PrecomputedLookup *tree,
+                         EntropyFallback *fallback) {
   (void)words;
   if (!tree || !tree->root()) {
     std::cerr << "Error: precomputed lookup table is required for solving.\n";
-    return;
+    return false;
   }
 
   const auto solve_start = std::chrono::high_resolution_clock::now();
@@ -82,8 +300,9 @@ void run_non_interactive(encoded_word answer,
   };
 
   int turn = 1;
-  encoded_word guess = kInitialGuess;
+  encoded_word guess = tree->start_word();
   const uint8_t *node = tree->root();
+  SolutionStep history[6];
 
   if (verbose && print_output) {
     std::cout << "Solving for: " << decode_word(answer) << std::endl;
@@ -114,38 +333,60 @@ void run_non_interactive(encoded_word answer,
     if (trace) {
       trace->steps.push_back({guess, feedback_val});
     }
+    history[turn - 1] = {guess, feedback_val};
 
     if (feedback_val == 242) {
       if (print_output) {
         std::cout << "\nSolved in " << turn << " guesses!" << std::endl;
       }
+      if (trace) {
+        trace->solved = true;
+      }
       log_duration("solved");
-      return;
+      return true;
     }
 
     if (turn == 6) {
-      std::cout << "Solver failed to find the word. Last guess was '"
-                << decode_word(guess) << "'.\n";
+      if (print_output) {
+        std::cout << "Solver failed to find the word. Last guess was '"
+                  << decode_word(guess) << "'.\n";
+      }
       log_duration("failed-depth");
-      return;
+      return false;
     }
 
-    if (!node) {
-      std::cout << "Solver failed: lookup table missing entries.\n";
+    encoded_word next_guess = 0;
+    const uint8_t *next_node = nullptr;
+    if (node) {
+      next_node = tree->find_child(node, static_cast<uint16_t>(feedback_val),
+                                   next_guess);
+    }
+    const bool from_tree = next_guess != 0;
+    if (!from_tree && fallback) {
+      next_guess = fallback->next_guess(history, static_cast<size_t>(turn),
+                                        turn + 1 == 6);
+      if (debug_lookup && next_guess != 0) {
+        std::cerr << "[fallback] depth=" << (turn + 1)
+                  << " guess=" << decode_word(next_guess) << "\n";
+        log_duration("fallback");
+      }
+    }
+    if (next_guess == 0 && !node) {
+      if (print_output) {
+        std::cout << "Solver failed: lookup table missing entries.\n";
+      }
       log_duration("failed-missing-node");
-      return;
+      return false;
     }
-
-    encoded_word next_guess = 0;
-    const uint8_t *next_node =
-        tree->find_child(node, static_cast<uint16_t>(feedback_val), next_guess);
     if (next_guess == 0) {
-      std::cout << "Solver failed: lookup tree has no entry for feedback '"
-                << feedback_str << "' on turn " << turn << ".\n";
+      if (print_output) {
+        std::cout << "Solver failed: lookup tree has no entry for feedback '"
+                  << feedback_str << "' on turn " << turn << ".\n";
+      }
       log_duration("failed-branch");
-      return;
+      return false;
     }
-    if (debug_lookup) {
+    if (debug_lookup && from_tree) {
       std::cerr << "[lookup] depth=" << (turn + 1)
                 << " guess=" << decode_word(next_guess) << "\n";
     }
@@ -154,7 +395,161 @@ void run_non_interactive(encoded_word answer,
     ++turn;
   }
 
-  std::cerr << "Solver failed to find the word. Last guess was '"
-            << decode_word(guess) << "'.\n";
+  if (print_output) {
+    std::cerr << "Solver failed to find the word. Last guess was '"
+              << decode_word(guess) << "'.\n";
+  }
   log_duration("failed-depth");
+  return false;
+}
+
+void write_json_string(std::ostream &out, std::string_view value) {
+  static constexpr char kHex[] = "0123456789abcdef";
+  out << '"';
+  for (const char c : value) {
+    const auto byte = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (byte < 0x20) {
+      out << "\\u00" << kHex[byte >> 4] << kHex[byte & 0xf];
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+void write_trace_json(std::ostream &out, const SolutionTrace &trace) {
+  out << "[";
+  for (size_t i = 0; i < trace.steps.size(); ++i) {
+    const auto &step = trace.steps[i];
+    out << "{\"guess\":\"" << decode_word(step.guess)
+        << "\",\"feedback\":" << static_cast<int>(step.feedback) << "}";
+    if (i + 1 < trace.steps.size())
+      out << ",";
+  }
+  out << "]";
+}
+
+namespace {
+
+// Targets are solved in blocks so output can stream in input order while
+// pool threads share each block.
+constexpr size_t kBatchBlockSize = 4096;
+
+struct BatchResult {
+  std::string target;
+  bool valid = false;
+  SolutionTrace trace;
+};
+
+void solve_batch_target(BatchResult &result,
+                        const std::vector<encoded_word> &words,
+                        const FeedbackTable *feedback_table,
+                        const LookupTables &lookups,
+                        const PrecomputedLookup *tree,
+                        EntropyFallback *fallback) {
+  const encoded_word target = encode_word(result.target);
+  result.valid =
+      result.target.size() == 5 && lookups.word_index.contains(target);
+  if (!result.valid)
+    return;
+  run_non_interactive(target, words, false, false, &result.trace, false,
+                      feedback_table, lookups, tree, fallback);
+}
+
+void write_batch_result(std::ostream &out, const BatchResult &result,
+                        bool json) {
+  if (json) {
+    out << "{\"target\":";
+    write_json_string(out, result.target);
+    if (!result.valid) {
+      out << ",\"error\":\"not in word list\"}\n";
+      return;
+    }
+    out << ",\"solved\":" << (result.trace.solved ? "true" : "false")
+        << ",\"guesses\":" << result.trace.steps.size() << ",\"trace\":";
+    write_trace_json(out, result.trace);
+    out << "}\n";
+    return;
+  }
+  out << result.target;
+  if (!result.valid) {
+    out << " INVALID\n";
+    return;
+  }
+  if (result.trace.solved) {
+    out << ' ' << result.trace.steps.size();
+  } else {
+    out << " FAIL";
+  }
+  for (const auto &step : result.trace.steps) {
+    out << ' ' << decode_word(step.guess);
+  }
+  out << '\n';
+}
+
+} // namespace
+
+BatchSolveSummary run_batch_solve(std::istream &in, std::ostream &out,
+                                  const std::vector<encoded_word> &words,
+                                  const FeedbackTable *feedback_table,
+                                  const LookupTables &lookups,
+                                  const PrecomputedLookup *tree,
+                                  const BatchSolveOptions &options) {
+  BatchSolveSummary summary;
+  const unsigned int num_threads = std::max(1u, options.threads);
+  // A single worker has nothing to share, so emit each line as soon as it is
+  // solved; this keeps interactive pipes responsive.
+  const size_t block_limit = num_threads == 1 ? 1 : kBatchBlockSize;
+  std::vector<BatchResult> block;
+  block.reserve(block_limit);
+
+  auto flush_block = [&]() {
+    if (block.empty())
+      return;
+    ThreadPool::instance().parallel_for(
+        0, block.size(), 1,
+        [&](size_t begin, size_t end, unsigned int) {
+          for (size_t i = begin; i < end; ++i) {
+            solve_batch_target(block[i], words, feedback_table, lookups, tree,
+                               options.fallback);
+          }
+        },
+        num_threads);
+    for (const auto &result : block) {
+      summary.targets++;
+      if (!result.valid) {
+        summary.invalid++;
+      } else if (result.trace.solved) {
+        summary.solved++;
+        summary.total_guesses += result.trace.steps.size();
+      } else {
+        summary.failed++;
+      }
+      write_batch_result(out, result, options.json);
+    }
+    out.flush();
+    block.clear();
+  };
+
+  std::string line;
+  while (std::getline(in, line)) {
+    line.erase(std::remove_if(line.begin(), line.end(),
+                              [](unsigned char c) { return std::isspace(c); }),
+               line.end());
+    if (line.empty())
+      continue;
+    for (char &c : line) {
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    BatchResult result;
+    result.target = std::move(line);
+    block.push_back(std::move(result));
+    if (block.size() >= block_limit) {
+      flush_block();
+    }
+  }
+  flush_block();
+  return summary;
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <iosfwd>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "feedback_cache.h"
@@ -15,6 +17,7 @@ struct SolutionStep {
 
 struct SolutionTrace {
   std::vector<SolutionStep> steps;
+  bool solved = false;
 };
 
 struct LookupHeader {
@@ -22,31 +25,139 @@ struct LookupHeader {
   uint32_t version;
   uint32_t depth;
   uint32_t root_offset;
-  encoded_word start_encoded;
+  uint64_t start_encoded; // encoded_word, stored 64-bit
   char start_word[5];
   char reserved[3];
 };
 static_assert(sizeof(LookupHeader) == 32, "LookupHeader must be 32 bytes");
 
+// Node layouts (see DESIGN.md). Every entry is kLookupEntrySize bytes:
+// uint16 feedback, uint16 reserved, uint64 guess (an encoded_word),
+// uint32 child_offset.
+// v1 nodes are a uint32 count followed by the entries, scanned linearly.
+// v2 nodes prefix the entries with a 243-bit presence bitmap so a child is
+// found with one popcount: uint32 count, uint8 rank_base[4] (entries before
+// each bitmap word), uint64 presence[4], then the dense entries.
+//
+// v3 ("compact") files store guesses as uint16 indices into the word list,
+// pack each node into parallel byte arrays, and lay nodes out breadth-first
+// so the first turns' nodes are contiguous. A LookupWordList block follows
+// the header; see DESIGN.md for the node layout.
+inline constexpr uint32_t kLookupVersionLinear = 1;
+inline constexpr uint32_t kLookupVersionBitmap = 2;
+inline constexpr uint32_t kLookupVersionCompact = 3;
+inline constexpr size_t kLookupEntrySize = 16;
+inline constexpr size_t kLookupBitmapNodeHeaderSize = 40;
+
+// v3 nodes with more than this many entries use a presence bitmap instead of
+// a scanned feedback array.
+inline constexpr uint32_t kCompactSmallNodeLimit = 16;
+inline constexpr uint8_t kCompactNodeBitmap = 0x1;
+inline constexpr uint8_t kCompactLeafSlot = 0xFF;
+inline constexpr size_t kCompactMaxWords = 0xFFFF;
+
+struct LookupWordList {
+  uint32_t word_count;
+  uint32_t reserved;
+  uint64_t word_hash; // hash_word_list() of the vocabulary
+};
+static_assert(sizeof(LookupWordList) == 16, "LookupWordList must be 16 bytes");
+
+// Read-only view of a lookup_<start>.bin tree. The file is memory-mapped
+// (MAP_SHARED) where available so processes share one page-cache copy and a
+// solve only faults in the nodes it walks; otherwise it is read into an owned
+// buffer. attach() instead views an image already in memory, such as the
+// tree compiled into the binary.
 class PrecomputedLookup {
 public:
-  bool load(const std::string &path, encoded_word expected_start);
+  PrecomputedLookup() = default;
+  PrecomputedLookup(const PrecomputedLookup &) = delete;
+  PrecomputedLookup &operator=(const PrecomputedLookup &) = delete;
+  PrecomputedLookup(PrecomputedLookup &&other) noexcept;
+  PrecomputedLookup &operator=(PrecomputedLookup &&other) noexcept;
+  ~PrecomputedLookup();
+
+  // `words` resolves guess indices in v3 files and must outlive the lookup.
+  bool load(const std::string &path, encoded_word expected_start,
+            const std::vector<encoded_word> &words = load_words());
+  // Views `length` bytes at `image` in place; the image must outlive the
+  // lookup and may be rooted at any opener (see start_word()).
+  bool attach(const uint8_t *image, size_t length,
+              const std::vector<encoded_word> &words = load_words());
   const uint8_t *root() const { return root_ptr_; }
   uint32_t depth() const { return depth_; }
+  uint32_t version() const { return version_; }
+  encoded_word start_word() const { return start_word_; }
+  bool mapped() const { return mapped_data_ != nullptr; }
+  // Bytes of the file image, mapped or owned.
+  size_t size_bytes() const { return size(); }
 
   const uint8_t *find_child(const uint8_t *node, uint16_t feedback,
                             encoded_word &guess_out) const;
 
 private:
+  const uint8_t *data() const {
+    return mapped_data_ ? mapped_data_ : buffer_.data();
+  }
+  size_t size() const { return mapped_data_ ? mapping_length_ : buffer_.size(); }
+  const uint8_t *find_compact_child(const uint8_t *node, uint16_t feedback,
+                                    encoded_word &guess_out) const;
+  bool parse_header(encoded_word expected_start,
+                    const std::vector<encoded_word> &words);
+  void release();
+
   std::vector<uint8_t> buffer_;
+  const uint8_t *mapped_data_ = nullptr;
+  size_t mapping_length_ = 0;
+  bool borrowed_ = false; // mapped_data_ came from attach(), not mmap
   const uint8_t *root_ptr_ = nullptr;
   uint32_t depth_ = 0;
+  uint32_t version_ = 0;
   encoded_word start_word_ = 0;
+  const encoded_word *words_ = nullptr;
+  size_t word_count_ = 0; // entries in words_ (v3 only)
 };
 
-void run_non_interactive(encoded_word answer,
+class EntropyFallback;
+
+// Plays `answer` against `tree`. With a `fallback`, turns the tree does not
+// cover are played on live-computed guesses instead of failing.
+bool run_non_interactive(encoded_word answer,
                          const std::vector<encoded_word> &words,
                          bool verbose, bool print_output, SolutionTrace *trace,
                          bool debug_lookup, const FeedbackTable *feedback_table,
                          const LookupTables &lookups,
-                         const PrecomputedLookup *tree);
+                         const PrecomputedLookup *tree,
+                         EntropyFallback *fallback = nullptr);
+
+// Writes the `--dump-json` trace array (no trailing newline).
+void write_trace_json(std::ostream &out, const SolutionTrace &trace);
+
+// Writes `value` as a quoted JSON string, escaping quotes, backslashes and
+// control characters.
+void write_json_string(std::ostream &out, std::string_view value);
+
+struct BatchSolveOptions {
+  unsigned int threads = 1;
+  bool json = false;
+  EntropyFallback *fallback = nullptr; // shared by all workers
+};
+
+struct BatchSolveSummary {
+  size_t targets = 0;
+  size_t solved = 0;
+  size_t failed = 0;
+  size_t invalid = 0;
+  size_t total_guesses = 0;
+};
+
+// Solves every five-letter target read from `in` (one per line) against a
+// single loaded tree and streams one result line per target to `out`, in
+// input order. Text lines are `<target> <guesses|FAIL> <guess...>`; JSON
+// lines wrap the `--dump-json` trace as `{"target":..,"trace":[..]}`.
+BatchSolveSummary run_batch_solve(std::istream &in, std::ostream &out,
+                                  const std::vector<encoded_word> &words,
+                                  const FeedbackTable *feedback_table,
+                                  const LookupTables &lookups,
+                                  const PrecomputedLookup *tree,
+                                  const BatchSolveOptions &options);
@@ -0,0 +1,434 @@
+#include "solver_server.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "entropy_fallback.h"
+#include "solver_session.h"
+
+namespace {
+
+// Longest request line accepted; six (guess, feedback) pairs need 71 bytes.
+constexpr size_t kMaxRequestLine = 4096;
+
+// How often blocked accept/read loops wake to notice a shutdown request.
+constexpr int kPollIntervalMs = 250;
+
+encoded_word parse_word(std::string_view token) {
+  if (token.size() != 5)
+    return 0;
+  char lower[5];
+  for (size_t i = 0; i < 5; ++i) {
+    const char c =
+        static_cast<char>(std::tolower(static_cast<unsigned char>(token[i])));
+    if (c < 'a' || c > 'z')
+      return 0;
+    lower[i] = c;
+  }
+  return encode_word(std::string_view(lower, 5));
+}
+
+// "g" green, "y" yellow, and any of "b_-.x" grey, one letter per position.
+int parse_feedback(std::string_view token) {
+  if (token.size() != 5)
+    return -1;
+  int value = 0;
+  for (const char raw : token) {
+    const char c =
+        static_cast<char>(std::tolower(static_cast<unsigned char>(raw)));
+    int code = 0;
+    if (c == 'g') {
+      code = 2;
+    } else if (c == 'y') {
+      code = 1;
+    } else if (!std::strchr("b_-.x", c)) {
+      return -1;
+    }
+    value = value * 3 + code;
+  }
+  return value;
+}
+
+std::vector<std::string_view> split_tokens(std::string_view line) {
+  std::vector<std::string_view> tokens;
+  size_t pos = 0;
+  while (pos < line.size()) {
+    while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t'))
+      ++pos;
+    const size_t start = pos;
+    while (pos < line.size() && line[pos] != ' ' && line[pos] != '\t')
+      ++pos;
+    if (pos > start)
+      tokens.push_back(line.substr(start, pos - start));
+  }
+  return tokens;
+}
+
+// Request latencies in power-of-two nanosecond buckets. Every counter is a
+// relaxed atomic so connection threads never contend on a lock.
+class LatencyStats {
+public:
+  void record(std::chrono::nanoseconds elapsed, bool error) {
+    const uint64_t ns = static_cast<uint64_t>(elapsed.count());
+    size_t bucket = 0;
+    while (bucket + 1 < kBuckets && (uint64_t{2} << bucket) <= ns)
+      ++bucket;
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    requests_.fetch_add(1, std::memory_order_relaxed);
+    if (error)
+      errors_.fetch_add(1, std::memory_order_relaxed);
+    total_ns_.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t seen = max_ns_.load(std::memory_order_relaxed);
+    while (ns > seen &&
+           !max_ns_.compare_exchange_weak(seen, ns, std::memory_order_relaxed)) {
+    }
+  }
+
+  // Percentiles report their bucket's upper bound (capped at the maximum),
+  // so they are within 2x.
+  std::string summary() const {
+    std::array<uint64_t, kBuckets> counts;
+    uint64_t requests = 0;
+    for (size_t b = 0; b < kBuckets; ++b) {
+      counts[b] = buckets_[b].load(std::memory_order_relaxed);
+      requests += counts[b];
+    }
+    const uint64_t max_ns = max_ns_.load(std::memory_order_relaxed);
+    auto percentile_us = [&](double fraction) {
+      const uint64_t rank = static_cast<uint64_t>(fraction * requests);
+      uint64_t seen = 0;
+      for (size_t b = 0; b < kBuckets; ++b) {
+        seen += counts[b];
+        if (seen > rank)
+          return static_cast<double>(std::min(uint64_t{2} << b, max_ns)) /
+                 1000.0;
+      }
+      return 0.0;
+    };
+    std::ostringstream out;
+    out << "requests=" << requests
+        << " errors=" << errors_.load(std::memory_order_relaxed)
+        << " mean_us="
+        << (requests ? static_cast<double>(total_ns_.load()) / 1000.0 /
+                           static_cast<double>(requests)
+                     : 0.0)
+        << " p50_us=" << (requests ? percentile_us(0.50) : 0.0)
+        << " p99_us=" << (requests ? percentile_us(0.99) : 0.0)
+        << " max_us=" << static_cast<double>(max_ns) / 1000.0;
+    return out.str();
+  }
+
+private:
+  static constexpr size_t kBuckets = 40;
+  std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+  std::atomic<uint64_t> requests_{0};
+  std::atomic<uint64_t> errors_{0};
+  std::atomic<uint64_t> total_ns_{0};
+  std::atomic<uint64_t> max_ns_{0};
+};
+
+} // namespace
+
+std::string answer_next_guess_request(std::string_view line,
+                                      LookupRegistry &trees,
+                                      encoded_word default_start,
+                                      EntropyFallback *fallback) {
+  const auto tokens = split_tokens(line);
+  if (tokens.size() % 2 != 0) {
+    return "ERR expected GUESS FEEDBACK pairs";
+  }
+  const encoded_word opener =
+      tokens.empty() ? default_start : parse_word(tokens[0]);
+  if (opener == 0) {
+    return "ERR invalid guess '" + std::string(tokens[0]) + "'";
+  }
+  auto tree = trees.acquire(opener);
+  if (!tree && fallback && opener != default_start) {
+    // Any tree will do: the opener leaves it on the first guess and the
+    // game is played off-tree from there.
+    tree = trees.acquire(default_start);
+  }
+  if (!tree) {
+    return "ERR no lookup tree for opener " + decode_word(opener);
+  }
+  SolverSession session(*tree, fallback);
+  for (size_t i = 0; i < tokens.size(); i += 2) {
+    const encoded_word guess = parse_word(tokens[i]);
+    const int feedback = parse_feedback(tokens[i + 1]);
+    if (guess == 0) {
+      return "ERR invalid guess '" + std::string(tokens[i]) + "'";
+    }
+    if (feedback < 0) {
+      return "ERR invalid feedback '" + std::string(tokens[i + 1]) + "'";
+    }
+    if (session.status() == SessionStatus::kSolved) {
+      return "ERR history continues after a solve";
+    }
+    if (!fallback && guess != session.next_guess()) {
+      return "ERR guess " + std::to_string(i / 2 + 1) + " leaves the lookup "
+             "tree (expected " + decode_word(session.next_guess()) + ")";
+    }
+    switch (session.apply_feedback(guess, static_cast<feedback_int>(feedback))) {
+    case SessionStatus::kInProgress:
+    case SessionStatus::kSolved:
+      break;
+    case SessionStatus::kOutOfTurns:
+      return "ERR out of turns";
+    case SessionStatus::kMissingNode:
+    case SessionStatus::kMissingBranch:
+      return "ERR no lookup entry for feedback on guess " +
+             std::to_string(i / 2 + 1);
+    }
+  }
+  if (session.status() == SessionStatus::kSolved) {
+    return "SOLVED";
+  }
+  // Off the tree only this final state is searched; the replayed turns
+  // already carry their guesses.
+  const encoded_word next = session.next_guess();
+  if (next == 0) {
+    return "ERR no answer is consistent with the history";
+  }
+  return "OK " + decode_word(next);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+namespace {
+
+std::atomic<bool> g_stop_requested{false};
+
+extern "C" void request_server_stop(int) {
+  g_stop_requested.store(true, std::memory_order_relaxed);
+}
+
+bool write_fully(int fd, const std::string &data) {
+  size_t sent = 0;
+  while (sent < data.size()) {
+    const ssize_t n = ::write(fd, data.data() + sent, data.size() - sent);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    sent += static_cast<size_t>(n);
+  }
+  return true;
+}
+
+// Serves one client. Every complete line already received is answered
+// before the replies go out in one write, so pipelined requests cost one
+// syscall pair per read rather than per request.
+void serve_connection(int fd, LookupRegistry &trees,
+                      encoded_word default_start, EntropyFallback *fallback,
+                      LatencyStats &stats) {
+  std::string pending;
+  std::string replies;
+  char buffer[16384];
+  bool open = true;
+  while (open && !g_stop_requested.load(std::memory_order_relaxed)) {
+    pollfd pfd{fd, POLLIN, 0};
+    const int ready = ::poll(&pfd, 1, kPollIntervalMs);
+    if (ready < 0 && errno != EINTR)
+      break;
+    if (ready <= 0)
+      continue;
+    const ssize_t n = ::read(fd, buffer, sizeof(buffer));
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      break;
+    pending.append(buffer, static_cast<size_t>(n));
+
+    size_t consumed = 0;
+    for (size_t newline = pending.find('\n', consumed);
+         newline != std::string::npos;
+         newline = pending.find('\n', consumed)) {
+      std::string_view line(pending.data() + consumed, newline - consumed);
+      consumed = newline + 1;
+      if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
+      if (line == "STATS") {
+        replies += "STATS " + stats.summary() + " " + trees.stats_summary();
+        if (fallback) {
+          replies += " " + fallback->stats_summary();
+        }
+        replies += "\n";
+        continue;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      const std::string reply =
+          answer_next_guess_request(line, trees, default_start, fallback);
+      stats.record(std::chrono::steady_clock::now() - start,
+                   reply.compare(0, 3, "ERR") == 0);
+      replies += reply;
+      replies += '\n';
+    }
+    pending.erase(0, consumed);
+    if (pending.size() > kMaxRequestLine) {
+      replies += "ERR request line too long\n";
+      open = false;
+    }
+    if (!replies.empty()) {
+      open = write_fully(fd, replies) && open;
+      replies.clear();
+    }
+  }
+  ::close(fd);
+}
+
+int open_listener(const ServerOptions &options) {
+  if (!options.socket_path.empty()) {
+    sockaddr_un addr{};
+    if (options.socket_path.size() >= sizeof(addr.sun_path)) {
+      std::cerr << "Socket path '" << options.socket_path << "' is too long.\n";
+      return -1;
+    }
+    // Replace a stale socket from an earlier run, but never a regular file.
+    struct stat st;
+    if (::stat(options.socket_path.c_str(), &st) == 0) {
+      if (!S_ISSOCK(st.st_mode)) {
+        std::cerr << "'" << options.socket_path
+                  << "' exists and is not a socket.\n";
+        return -1;
+      }
+      ::unlink(options.socket_path.c_str());
+    }
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+      std::cerr << "Failed to create socket: " << std::strerror(errno) << "\n";
+      return -1;
+    }
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, options.socket_path.c_str(),
+                options.socket_path.size());
+    if (::bind(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) !=
+            0 ||
+        ::listen(fd, SOMAXCONN) != 0) {
+      std::cerr << "Failed to listen on '" << options.socket_path
+                << "': " << std::strerror(errno) << "\n";
+      ::close(fd);
+      return -1;
+    }
+    return fd;
+  }
+
+  const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) {
+    std::cerr << "Failed to create socket: " << std::strerror(errno) << "\n";
+    return -1;
+  }
+  const int one = 1;
+  ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(options.port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (::bind(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) !=
+          0 ||
+      ::listen(fd, SOMAXCONN) != 0) {
+    std::cerr << "Failed to listen on 127.0.0.1:" << options.port << ": "
+              << std::strerror(errno) << "\n";
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+struct Connection {
+  std::thread thread;
+  std::atomic<bool> done{false};
+};
+
+} // namespace
+
+bool run_server(const ServerOptions &options, LookupRegistry &trees,
+                encoded_word default_start, EntropyFallback *fallback) {
+  const int listener = open_listener(options);
+  if (listener < 0) {
+    return false;
+  }
+  const bool tcp = options.socket_path.empty();
+  std::signal(SIGPIPE, SIG_IGN);
+  std::signal(SIGINT, request_server_stop);
+  std::signal(SIGTERM, request_server_stop);
+  if (tcp) {
+    std::cerr << "[serve] listening on 127.0.0.1:" << options.port << "\n";
+  } else {
+    std::cerr << "[serve] listening on " << options.socket_path << "\n";
+  }
+
+  LatencyStats stats;
+  std::list<Connection> connections;
+  while (!g_stop_requested.load(std::memory_order_relaxed)) {
+    for (auto it = connections.begin(); it != connections.end();) {
+      if (it->done.load()) {
+        it->thread.join();
+        it = connections.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    pollfd pfd{listener, POLLIN, 0};
+    if (::poll(&pfd, 1, kPollIntervalMs) <= 0)
+      continue;
+    const int client = ::accept(listener, nullptr, nullptr);
+    if (client < 0)
+      continue;
+    if (tcp) {
+      const int one = 1;
+      ::setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    Connection &conn = connections.emplace_back();
+    conn.thread = std::thread(
+        [client, &trees, default_start, fallback, &stats, &conn]() {
+          serve_connection(client, trees, default_start, fallback, stats);
+          conn.done.store(true);
+        });
+  }
+
+  for (auto &conn : connections) {
+    conn.thread.join();
+  }
+  ::close(listener);
+  if (!tcp) {
+    ::unlink(options.socket_path.c_str());
+  }
+  std::cerr << "[serve] " << stats.summary() << "\n[serve] "
+            << trees.stats_summary() << "\n";
+  if (fallback) {
+    std::cerr << "[serve] " << fallback->stats_summary() << "\n";
+  }
+  return true;
+}
+
+#else
+
+bool run_server(const ServerOptions &, LookupRegistry &, encoded_word,
+                EntropyFallback *) {
+  std::cerr << "serve mode requires a POSIX socket API.\n";
+  return false;
+}
+
+#endif
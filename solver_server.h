@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "entropy_fallback.h"
+#include "lookup_registry.h"
+#include "words_data.h"
+
+// `serve` mode: answers "what is the next guess" for a game in progress by
+// walking the lookup tree for the game's opener, loaded on demand through a
+// LookupRegistry. See DESIGN.md for the line protocol.
+struct ServerOptions {
+  std::string socket_path; // Unix domain socket; used when non-empty
+  uint16_t port = 0;       // otherwise TCP on 127.0.0.1:port
+};
+
+// Resolves one request line and returns the response line without its
+// newline: "OK <guess>", "SOLVED", or "ERR <reason>". The first guess of the
+// history selects the tree; an empty history gets `default_start`. With a
+// `fallback`, histories that leave the tree (or open with a word that has no
+// tree) are answered with live-computed guesses instead of an error.
+std::string answer_next_guess_request(std::string_view line,
+                                      LookupRegistry &trees,
+                                      encoded_word default_start,
+                                      EntropyFallback *fallback = nullptr);
+
+// Accepts connections until SIGINT/SIGTERM, one thread per connection, and
+// prints the latency and tree-cache summary on the way out. Returns false if
+// the listening socket could not be set up.
+bool run_server(const ServerOptions &options, LookupRegistry &trees,
+                encoded_word default_start,
+                EntropyFallback *fallback = nullptr);
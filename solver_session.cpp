@@ -0,0 +1,95 @@
+#include "solver_session.h"
+
+#include "entropy_fallback.h"
+
+namespace {
+
+constexpr feedback_int kAllGreen = 242;
+
+} // namespace
+
+SolverSession::SolverSession(const PrecomputedLookup &tree,
+                             EntropyFallback *fallback)
+    : tree_(&tree), fallback_(fallback) {
+  reset();
+}
+
+void SolverSession::reset() {
+  node_ = tree_->root();
+  guess_ = tree_->start_word();
+  status_ = SessionStatus::kInProgress;
+  on_tree_ = true;
+  guess_pending_ = false;
+  turns_ = 0;
+}
+
+encoded_word SolverSession::next_guess() {
+  if (status_ != SessionStatus::kInProgress) {
+    return 0;
+  }
+  if (guess_pending_) {
+    guess_pending_ = false;
+    guess_ = fallback_->next_guess(history_.data(), turns_,
+                                   turns_ + 1 == kMaxTurns);
+    if (guess_ == 0) {
+      status_ = left_as_;
+    }
+  }
+  return guess_;
+}
+
+SessionStatus SolverSession::apply_feedback(feedback_int feedback) {
+  return apply_feedback(next_guess(), feedback);
+}
+
+SessionStatus SolverSession::apply_feedback(encoded_word played,
+                                            feedback_int feedback) {
+  if (status_ != SessionStatus::kInProgress) {
+    return status_;
+  }
+  if (on_tree_ && played != guess_) {
+    if (!fallback_) {
+      status_ = SessionStatus::kMissingBranch;
+      return status_;
+    }
+    on_tree_ = false;
+  }
+  history_[turns_++] = {played, feedback};
+  if (feedback == kAllGreen) {
+    status_ = SessionStatus::kSolved;
+    return status_;
+  }
+  if (turns_ == kMaxTurns) {
+    status_ = SessionStatus::kOutOfTurns;
+    return status_;
+  }
+  if (!on_tree_) {
+    return leave_tree(SessionStatus::kMissingBranch);
+  }
+  if (!node_) {
+    return leave_tree(SessionStatus::kMissingNode);
+  }
+  encoded_word next_guess = 0;
+  const uint8_t *child =
+      tree_->find_child(node_, static_cast<uint16_t>(feedback), next_guess);
+  if (next_guess == 0) {
+    return leave_tree(SessionStatus::kMissingBranch);
+  }
+  guess_ = next_guess;
+  node_ = child;
+  return status_;
+}
+
+SessionStatus SolverSession::leave_tree(SessionStatus missing) {
+  on_tree_ = false;
+  node_ = nullptr;
+  guess_ = 0;
+  if (!fallback_) {
+    status_ = missing;
+    return status_;
+  }
+  // Deferred to next_guess(): a replayed history plays its own guess next.
+  guess_pending_ = true;
+  left_as_ = missing;
+  return status_;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "solver_runtime.h"
+#include "solver_types.h"
+
+class EntropyFallback;
+
+// One game played against a loaded lookup tree, for embedding the solver in
+// other programs. A session is a few pointers plus a fixed-size history:
+// stepping it never allocates or prints, and any number of sessions may
+// walk the same PrecomputedLookup from different threads, since the tree is
+// only read after load().
+//
+// With an EntropyFallback attached, a game the tree does not cover (a missing
+// branch, a wrong leaf, or a guess other than the one suggested) continues
+// off-tree on guesses from the fallback instead of ending; those turns may
+// allocate. Off the tree a guess is only computed when next_guess() asks
+// for it, so replaying a recorded history with apply_feedback(played, fb)
+// runs no searches for turns whose guess was already chosen.
+//
+//   SolverSession session(tree);
+//   while (session.status() == SessionStatus::kInProgress) {
+//     const encoded_word guess = session.next_guess();
+//     session.apply_feedback(score(guess));
+//   }
+enum class SessionStatus : uint8_t {
+  kInProgress,
+  kSolved,
+  kOutOfTurns,    // the last allowed guess was not the answer
+  kMissingNode,   // the tree ended in a leaf but the guess was not green
+  kMissingBranch, // the tree has no branch for the reported feedback
+};
+
+class SolverSession {
+public:
+  static constexpr uint32_t kMaxTurns = 6;
+
+  // `tree` must be loaded and must outlive the session, as must `fallback`
+  // when given.
+  explicit SolverSession(const PrecomputedLookup &tree,
+                         EntropyFallback *fallback = nullptr);
+
+  // Starts a new game at the tree's opening guess.
+  void reset();
+
+  // The guess to play this turn, or 0 once the game is over. Off the tree
+  // the first call asks the fallback; if no answer fits the history the
+  // game ends there with the status the tree left it with.
+  encoded_word next_guess();
+
+  // Records the feedback for next_guess() and advances to the next turn.
+  // Ignored once the game is over; returns the resulting status.
+  SessionStatus apply_feedback(feedback_int feedback);
+  // Same, for a turn where `played` was guessed instead. Without a fallback a
+  // different guess ends the game as kMissingBranch.
+  SessionStatus apply_feedback(encoded_word played, feedback_int feedback);
+
+  // Off the tree a game whose history no answer fits still reads
+  // kInProgress until next_guess() finds that out.
+  SessionStatus status() const { return status_; }
+  // Guesses played so far (the current turn number once a guess is scored).
+  size_t turns() const { return turns_; }
+  const SolutionStep &step(size_t turn) const { return history_[turn]; }
+  // False once the game has left the tree and is following the fallback.
+  bool on_tree() const { return on_tree_; }
+
+private:
+  SessionStatus leave_tree(SessionStatus missing);
+
+  const PrecomputedLookup *tree_;
+  EntropyFallback *fallback_;
+  const uint8_t *node_ = nullptr;
+  encoded_word guess_ = 0;
+  SessionStatus status_ = SessionStatus::kInProgress;
+  bool on_tree_ = true;
+  // Off-tree guess_ still has to be asked of the fallback; `left_as` is the
+  // status to end with if it has none.
+  bool guess_pending_ = false;
+  SessionStatus left_as_ = SessionStatus::kMissingBranch;
+  size_t turns_ = 0;
+  std::array<SolutionStep, kMaxTurns> history_{};
+};
@@ -2,5 +2,7 @@
 
 #include <cstdint>
 
-using encoded_word = uint64_t;
-using feedback_int = int;
+// A word in 25 bits (5 per letter); see encode_word.
+using encoded_word = uint32_t;
+// Base-3 feedback code, 0..242 (242 = all green).
+using feedback_int = uint8_t;
@@ -0,0 +1,189 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace {
+
+// Each participant's remaining share is one atomic word (end << 32 | begin,
+// relative to the job's base) so owners and thieves claim work with a CAS.
+inline uint64_t pack_range(uint64_t begin, uint64_t end) {
+  return (end << 32) | begin;
+}
+inline uint32_t range_begin(uint64_t packed) {
+  return static_cast<uint32_t>(packed);
+}
+inline uint32_t range_end(uint64_t packed) {
+  return static_cast<uint32_t>(packed >> 32);
+}
+
+std::atomic<unsigned int> g_default_concurrency{0};
+
+} // namespace
+
+struct ThreadPool::Job {
+  const RangeBody *body = nullptr;
+  size_t base = 0;
+  size_t grain = 1;
+  unsigned int slot_count = 0;
+  std::unique_ptr<std::atomic<uint64_t>[]> slots;
+
+  // Guarded by the pool mutex; the caller is participant 0.
+  unsigned int next_participant = 1;
+
+  std::mutex done_mutex;
+  std::condition_variable done;
+  unsigned int active = 0;
+};
+
+void ThreadPool::set_default_concurrency(unsigned int threads) {
+  g_default_concurrency.store(threads);
+}
+
+ThreadPool &ThreadPool::instance() {
+  static ThreadPool pool([] {
+    const unsigned int requested = g_default_concurrency.load();
+    if (requested != 0)
+      return requested - 1;
+    const unsigned int hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 3u : hw - 1;
+  }());
+  return pool;
+}
+
+ThreadPool::ThreadPool(unsigned int threads) {
+  workers_.reserve(threads);
+  for (unsigned int i = 0; i < threads; ++i) {
+    workers_.emplace_back([this] { worker_loop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_ready_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::worker_loop() {
+  while (true) {
+    std::shared_ptr<Job> job;
+    unsigned int participant = 0;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_ready_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+      if (jobs_.empty())
+        return;
+      job = jobs_.front();
+      participant = job->next_participant++;
+      if (job->next_participant >= job->slot_count) {
+        jobs_.pop_front();
+      }
+      std::lock_guard<std::mutex> job_lock(job->done_mutex);
+      job->active++;
+    }
+    run_participant(*job, participant);
+    std::lock_guard<std::mutex> job_lock(job->done_mutex);
+    if (--job->active == 0) {
+      job->done.notify_all();
+    }
+  }
+}
+
+void ThreadPool::run_participant(Job &job, unsigned int participant) {
+  std::atomic<uint64_t> &own = job.slots[participant];
+  while (true) {
+    uint64_t current = own.load(std::memory_order_acquire);
+    while (range_begin(current) < range_end(current)) {
+      const uint32_t begin = range_begin(current);
+      const uint32_t end = range_end(current);
+      const uint32_t next =
+          static_cast<uint32_t>(std::min<size_t>(end, begin + job.grain));
+      if (own.compare_exchange_weak(current, pack_range(next, end),
+                                    std::memory_order_acq_rel)) {
+        (*job.body)(job.base + begin, job.base + next, participant);
+        current = own.load(std::memory_order_acquire);
+      }
+    }
+
+    bool stole = false;
+    for (unsigned int k = 1; k < job.slot_count && !stole; ++k) {
+      std::atomic<uint64_t> &victim =
+          job.slots[(participant + k) % job.slot_count];
+      uint64_t seen = victim.load(std::memory_order_acquire);
+      while (range_begin(seen) < range_end(seen)) {
+        const uint32_t begin = range_begin(seen);
+        const uint32_t end = range_end(seen);
+        // Take the upper half, or everything if only one chunk is left.
+        const uint32_t split =
+            end - begin <= job.grain ? begin : begin + (end - begin) / 2;
+        if (victim.compare_exchange_weak(seen, pack_range(begin, split),
+                                         std::memory_order_acq_rel)) {
+          own.store(pack_range(split, end), std::memory_order_release);
+          stole = true;
+          break;
+        }
+      }
+    }
+    if (!stole)
+      return;
+  }
+}
+
+void ThreadPool::parallel_for(size_t begin, size_t end, size_t grain,
+                              const RangeBody &body,
+                              unsigned int max_participants) {
+  if (begin >= end)
+    return;
+  grain = std::max<size_t>(grain, 1);
+  const size_t count = end - begin;
+  const size_t chunks = (count + grain - 1) / grain;
+  unsigned int participants =
+      max_participants == 0 ? concurrency()
+                            : std::min(max_participants, concurrency());
+  participants =
+      static_cast<unsigned int>(std::min<size_t>(participants, chunks));
+
+  if (participants <= 1 || count > UINT32_MAX) {
+    for (size_t start = begin; start < end; start += grain) {
+      body(start, std::min(end, start + grain), 0);
+    }
+    return;
+  }
+
+  auto job = std::make_shared<Job>();
+  job->body = &body;
+  job->base = begin;
+  job->grain = grain;
+  job->slot_count = participants;
+  job->slots.reset(new std::atomic<uint64_t>[participants]);
+  for (unsigned int p = 0; p < participants; ++p) {
+    const uint64_t share_begin = count * p / participants;
+    const uint64_t share_end = count * (p + 1) / participants;
+    job->slots[p].store(pack_range(share_begin, share_end),
+                        std::memory_order_relaxed);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(job);
+  }
+  work_ready_.notify_all();
+
+  run_participant(*job, 0);
+
+  // No new participant may join once the job leaves the queue; wait for the
+  // ones still finishing their last chunk.
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(jobs_.begin(), jobs_.end(), job);
+    if (it != jobs_.end()) {
+      jobs_.erase(it);
+    }
+  }
+  std::unique_lock<std::mutex> job_lock(job->done_mutex);
+  job->done.wait(job_lock, [&] { return job->active == 0; });
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Process-wide pool of worker threads shared by the entropy search, the
+// generator, feedback-table builds and batch solves. Threads are started once
+// and reused, so fan-out costs a wakeup instead of a thread launch.
+class ThreadPool {
+public:
+  // (begin, end, participant) – `participant` is unique among the threads
+  // running one parallel_for call and is < its participant count.
+  using RangeBody = std::function<void(size_t, size_t, unsigned int)>;
+
+  static ThreadPool &instance();
+
+  // Total threads (workers + caller) instance() will use; 0 = one per core.
+  // Only takes effect if called before the first instance().
+  static void set_default_concurrency(unsigned int threads);
+
+  explicit ThreadPool(unsigned int threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  // Worker threads plus the calling thread.
+  unsigned int concurrency() const {
+    return static_cast<unsigned int>(workers_.size()) + 1;
+  }
+
+  // Runs body over [begin, end) in chunks of at most `grain` indices. Each
+  // participant starts on its own contiguous share of the range and, once
+  // that is exhausted, steals the upper half of another participant's
+  // remaining share. The caller participates and the call returns once every
+  // index has been processed. Nested calls from inside a body are allowed.
+  // `max_participants` (0 = concurrency()) caps how many threads join.
+  void parallel_for(size_t begin, size_t end, size_t grain,
+                    const RangeBody &body, unsigned int max_participants = 0);
+
+private:
+  struct Job;
+
+  void worker_loop();
+  static void run_participant(Job &job, unsigned int participant);
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable work_ready_;
+  std::deque<std::shared_ptr<Job>> jobs_;
+  bool stopping_ = false;
+};
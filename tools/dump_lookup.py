@@ -8,7 +8,14 @@ import struct
 from pathlib import Path
 
 ENTRY_STRUCT = struct.Struct("<H H Q I")
-HEADER_STRUCT = struct.Struct("<4sIIQ5s3sI")
+HEADER_STRUCT = struct.Struct("<4sIIIQ5s3s")
+# v2 node prefix: count, rank_base[4], presence[4].
+BITMAP_NODE_STRUCT = struct.Struct("<I4B4Q")
+# v3 word-list block that follows the header: word_count, reserved, word_hash.
+WORD_LIST_STRUCT = struct.Struct("<IIQ")
+COMPACT_BITMAP_STRUCT = struct.Struct("<4B4Q")
+COMPACT_NODE_BITMAP = 0x1
+COMPACT_LEAF_SLOT = 0xFF
 
 
 def decode_word(value: int) -> str:
@@ -20,10 +27,78 @@ def decode_word(value: int) -> str:
     return "".join(reversed(letters))
 
 
-def walk(buffer: bytes, offset: int, depth: int, prefix: list[int]) -> None:
+def node_entries(buffer: bytes, offset: int, version: int) -> tuple[int, int]:
+    """Return (entry count, offset of the first entry) for a node."""
+    if version == 2:
+        fields = BITMAP_NODE_STRUCT.unpack_from(buffer, offset)
+        count, presence = fields[0], fields[5:]
+        present = sum(bin(word).count("1") for word in presence)
+        if present != count:
+            raise ValueError(
+                f"node@{offset}: bitmap has {present} bits but count={count}"
+            )
+        return count, offset + BITMAP_NODE_STRUCT.size
     count = struct.unpack_from("<I", buffer, offset)[0]
+    return count, offset + 4
+
+
+def hash_word_list(codes: list[int]) -> int:
+    value = 0xCBF29CE484222325
+    for code in codes:
+        for byte in code.to_bytes(4, "little"):
+            value = ((value ^ byte) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+
+def encode_word(word: str) -> int:
+    value = 0
+    for ch in word:
+        value = (value << 5) | (ord(ch) - 96)
+    return value
+
+
+def compact_entries(buffer: bytes, offset: int) -> list[tuple[int, int, int]]:
+    """Return (feedback, word index, child offset) triples for a v3 node."""
+    count, flags = buffer[offset], buffer[offset + 1]
+    cursor = offset + 2
+    if flags & COMPACT_NODE_BITMAP:
+        presence = COMPACT_BITMAP_STRUCT.unpack_from(buffer, cursor)[4:]
+        feedbacks = [
+            word * 64 + bit
+            for word, bits in enumerate(presence)
+            for bit in range(64)
+            if bits >> bit & 1
+        ]
+        cursor += COMPACT_BITMAP_STRUCT.size
+    else:
+        feedbacks = list(buffer[cursor : cursor + count])
+        cursor += count
+    if len(feedbacks) != count:
+        raise ValueError(f"node@{offset}: {len(feedbacks)} feedbacks but count={count}")
+    guesses = struct.unpack_from(f"<{count}H", buffer, cursor)
+    cursor += 2 * count
+    slots = buffer[cursor : cursor + count]
+    cursor += count
+    internal = sum(1 for slot in slots if slot != COMPACT_LEAF_SLOT)
+    children = struct.unpack_from(f"<{internal}I", buffer, cursor)
+    return [
+        (fb, guess, 0 if slot == COMPACT_LEAF_SLOT else children[slot])
+        for fb, guess, slot in zip(feedbacks, guesses, slots)
+    ]
+
+
+def walk_compact(buffer: bytes, offset: int, depth: int, words: list[str]) -> None:
+    entries = compact_entries(buffer, offset)
+    print("  " * depth + f"node@{offset}: entries={len(entries)}")
+    for feedback, guess, child in entries:
+        print("  " * (depth + 1) + f"fb={feedback:03} guess={words[guess]} child={child}")
+        if child:
+            walk_compact(buffer, child, depth + 2, words)
+
+
+def walk(buffer: bytes, offset: int, depth: int, version: int) -> None:
+    count, cursor = node_entries(buffer, offset, version)
     print("  " * depth + f"node@{offset}: entries={count}")
-    cursor = offset + 4
     for _ in range(count):
         feedback, _, guess, child = ENTRY_STRUCT.unpack_from(buffer, cursor)
         cursor += ENTRY_STRUCT.size
@@ -32,22 +107,39 @@ def walk(buffer: bytes, offset: int, depth: int, prefix: list[int]) -> None:
             + f"fb={feedback:03} guess={decode_word(guess)} child={child}"
         )
         if child:
-            walk(buffer, child, depth + 2, prefix + [feedback])
+            walk(buffer, child, depth + 2, version)
 
 
 def main() -> None:
     parser = argparse.ArgumentParser(description=__doc__)
     parser.add_argument("path", help="lookup binary file", default="lookup_roate.bin")
+    parser.add_argument(
+        "--words",
+        default="words.txt",
+        help="word list the file was generated from (needed for version 3 files)",
+    )
     args = parser.parse_args()
 
     data = Path(args.path).read_bytes()
-    magic, version, depth, start_enc, start_str, _, root_off = HEADER_STRUCT.unpack(
+    magic, version, depth, root_off, start_enc, start_str, _ = HEADER_STRUCT.unpack(
         data[: HEADER_STRUCT.size]
     )
+    if magic != b"PLUT" or version not in (1, 2, 3):
+        raise SystemExit(f"unsupported lookup file (magic={magic!r} version={version})")
     print(
         f"magic={magic.decode()} version={version} depth={depth} start={start_str.decode()} root={root_off}"
     )
-    walk(data, root_off, 0, [])
+    if version == 3:
+        with open(args.words) as fh:
+            words = [line.strip().lower() for line in fh if len(line.strip()) == 5]
+        word_count, _, word_hash = WORD_LIST_STRUCT.unpack_from(data, HEADER_STRUCT.size)
+        if word_count != len(words) or word_hash != hash_word_list(
+            [encode_word(w) for w in words]
+        ):
+            raise SystemExit(f"{args.words} does not match the vocabulary in {args.path}")
+        walk_compact(data, root_off, 0, words)
+    else:
+        walk(data, root_off, 0, version)
 
 
 if __name__ == "__main__":
@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 import argparse
+import json
 import subprocess
 import tempfile
 from pathlib import Path
@@ -33,17 +34,32 @@ def build_subset(words, size, pinned):
 
 def run_generate(binary, subset_file, start_word, depth, timeout):
     output_file = subset_file.with_suffix('.bin')
+    stats_file = subset_file.with_suffix('.json')
     cmd = [binary, 'generate', '--word-list', str(subset_file),
            '--lookup-start', start_word, '--lookup-depth', str(depth),
-           '--lookup-output', str(output_file)]
+           '--lookup-output', str(output_file), '--stats-json', str(stats_file)]
     start = time.perf_counter()
-    proc = subprocess.run(cmd, capture_output=True, text=True, timeout=timeout)
+    subprocess.run(cmd, capture_output=True, text=True, timeout=timeout)
     duration = time.perf_counter() - start
-    summary = None
-    for line in (proc.stdout + '\n' + proc.stderr).splitlines():
-        if line.startswith('Wrote lookup table'):
-            summary = line.strip()
-    return duration, summary
+    stats = None
+    try:
+        stats = json.loads(stats_file.read_text())
+    except (OSError, ValueError):
+        pass
+    for path in (output_file, stats_file):
+        path.unlink(missing_ok=True)
+    return duration, stats
+
+def describe(stats):
+    if stats is None:
+        return 'no stats'
+    search = stats['search']
+    depths = ' '.join(f"d{d['depth']}={d['search_ms']:.0f}ms"
+                      for d in stats['depths'])
+    return (f"status={stats['status']} states={stats['states']} "
+            f"backtracks={stats['backtracks']} "
+            f"prune_rate={search['prune_rate']:.3f} "
+            f"utilization={stats['utilization']:.2f} {depths}")
 
 def main():
     parser = argparse.ArgumentParser(description='Profile lookup generator over subsets')
@@ -66,8 +82,8 @@ def main():
                 tmp.write(w + '\n')
             tmp_path = Path(tmp.name)
         try:
-            duration, summary = run_generate(args.solver, tmp_path, args.start, args.depth, args.timeout)
-            print(f"subset={size} time={duration:.2f}s summary={summary}")
+            duration, stats = run_generate(args.solver, tmp_path, args.start, args.depth, args.timeout)
+            print(f"subset={size} time={duration:.2f}s {describe(stats)}")
         finally:
             tmp_path.unlink(missing_ok=True)
     
@@ -0,0 +1,290 @@
+#include "tree_verifier.h"
+
+#include <algorithm>
+
+#include "solver_core.h"
+#include "thread_pool.h"
+
+namespace {
+
+constexpr feedback_int kAllGreen = 242;
+constexpr size_t kFeedbackCodes = 243;
+constexpr size_t kSmallBranch = 32;
+
+// A node reached by the targets in order[begin, end).
+struct Branch {
+  const uint8_t *node = nullptr;
+  encoded_word guess = 0;
+  uint32_t turn = 0;
+  uint32_t begin = 0;
+  uint32_t end = 0;
+};
+
+// The targets still travelling down the tree, grouped so that every branch
+// owns one contiguous range. Splitting a branch permutes its range in place
+// into the ranges of its children, so disjoint branches never touch the
+// same entries and root subtrees can be walked concurrently.
+struct VerifyOrder {
+  std::vector<uint32_t> targets;   // indices into the report
+  std::vector<encoded_word> words; // words[i] is the word of targets[i]
+};
+
+// One worker's buffers, sized for the largest branch it will split.
+struct VerifyScratch {
+  std::vector<feedback_int> feedback;
+  std::vector<feedback_int> sorted;
+  std::vector<uint32_t> targets;
+  std::vector<encoded_word> words;
+  std::vector<Branch> pending;
+
+  explicit VerifyScratch(size_t capacity)
+      : feedback(capacity), sorted(capacity), targets(capacity),
+        words(capacity) {}
+};
+
+// Plays `branch.guess` against every member: solved members are recorded,
+// the rest are grouped by feedback and each group is followed into the
+// tree. Groups that can continue are appended to `next`. Most branches hold
+// a few targets, so they are sorted by feedback directly; only larger ones
+// pay for a counting sort over every code.
+void split_branch(const PrecomputedLookup &tree, const Branch &branch,
+                  VerifyOrder &order, VerifyScratch &scratch,
+                  std::vector<VerifyTarget> &targets,
+                  std::vector<Branch> &next) {
+  const size_t count = branch.end - branch.begin;
+  uint32_t *members = order.targets.data() + branch.begin;
+  encoded_word *words = order.words.data() + branch.begin;
+  feedback_int *feedback = scratch.feedback.data();
+  calculate_feedback_batch(branch.guess, words, count, feedback);
+
+  if (count <= kSmallBranch) {
+    for (size_t i = 1; i < count; ++i) {
+      const feedback_int fb = feedback[i];
+      const uint32_t member = members[i];
+      const encoded_word word = words[i];
+      size_t j = i;
+      for (; j > 0 && feedback[j - 1] > fb; --j) {
+        feedback[j] = feedback[j - 1];
+        members[j] = members[j - 1];
+        words[j] = words[j - 1];
+      }
+      feedback[j] = fb;
+      members[j] = member;
+      words[j] = word;
+    }
+  } else {
+    std::array<uint32_t, kFeedbackCodes> fill{};
+    for (size_t i = 0; i < count; ++i) {
+      ++fill[feedback[i]];
+    }
+    uint32_t offset = 0;
+    for (uint32_t &slot : fill) {
+      const uint32_t size = slot;
+      slot = offset;
+      offset += size;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      const uint32_t slot = fill[feedback[i]]++;
+      scratch.sorted[slot] = feedback[i];
+      scratch.targets[slot] = members[i];
+      scratch.words[slot] = words[i];
+    }
+    std::copy_n(scratch.sorted.data(), count, feedback);
+    std::copy_n(scratch.targets.data(), count, members);
+    std::copy_n(scratch.words.data(), count, words);
+  }
+
+  for (uint32_t begin = 0, end = 0; begin < count; begin = end) {
+    const feedback_int fb = feedback[begin];
+    end = begin + 1;
+    while (end < count && feedback[end] == fb) {
+      ++end;
+    }
+    const auto settle = [&](VerifyOutcome outcome) {
+      for (uint32_t i = begin; i < end; ++i) {
+        VerifyTarget &target = targets[members[i]];
+        target.outcome = outcome;
+        target.guesses = static_cast<uint8_t>(branch.turn);
+      }
+    };
+    if (fb == kAllGreen) {
+      settle(VerifyOutcome::kSolved);
+      continue;
+    }
+    if (branch.turn == kVerifyMaxGuesses) {
+      settle(VerifyOutcome::kTooDeep);
+      continue;
+    }
+    Branch child;
+    child.node = tree.find_child(branch.node, fb, child.guess);
+    if (!child.guess) {
+      settle(VerifyOutcome::kMissingBranch);
+      continue;
+    }
+    child.turn = branch.turn + 1;
+    // A lone target whose next guess is itself is solved on that turn;
+    // settling it here saves a branch per leaf.
+    if (end - begin == 1 && child.guess == words[begin]) {
+      targets[members[begin]].outcome = VerifyOutcome::kSolved;
+      targets[members[begin]].guesses = static_cast<uint8_t>(child.turn);
+      continue;
+    }
+    child.begin = branch.begin + begin;
+    child.end = branch.begin + end;
+    next.push_back(child);
+  }
+}
+
+// Walks the subtree below `root` depth-first.
+void walk_subtree(const PrecomputedLookup &tree, const Branch &root,
+                  VerifyOrder &order, VerifyScratch &scratch,
+                  std::vector<VerifyTarget> &targets) {
+  std::vector<Branch> &pending = scratch.pending;
+  pending.clear();
+  pending.push_back(root);
+  while (!pending.empty()) {
+    const Branch branch = pending.back();
+    pending.pop_back();
+    split_branch(tree, branch, order, scratch, targets, pending);
+  }
+}
+
+const char *outcome_reason(VerifyOutcome outcome) {
+  switch (outcome) {
+  case VerifyOutcome::kMissingBranch:
+    return "missing-branch";
+  case VerifyOutcome::kTooDeep:
+    return "too-deep";
+  case VerifyOutcome::kInvalid:
+    return "invalid";
+  default:
+    return "solved";
+  }
+}
+
+} // namespace
+
+TreeVerifyReport verify_tree(const PrecomputedLookup &tree,
+                             const std::vector<encoded_word> &targets,
+                             unsigned int threads) {
+  TreeVerifyReport report;
+  report.targets.resize(targets.size());
+  VerifyOrder order;
+  for (size_t i = 0; i < targets.size(); ++i) {
+    report.targets[i].word = targets[i];
+    if (targets[i] != 0) {
+      order.targets.push_back(static_cast<uint32_t>(i));
+      order.words.push_back(targets[i]);
+    }
+  }
+  Branch root;
+  root.node = tree.root();
+  root.guess = tree.start_word();
+  root.turn = 1;
+  root.end = static_cast<uint32_t>(order.targets.size());
+
+  // The opener's feedback groups are the root subtrees. They own disjoint
+  // ranges of `order` and share no targets, so workers write disjoint
+  // entries. No branch below a root subtree is larger than the subtree.
+  std::vector<Branch> subtrees;
+  size_t largest = 0;
+  if (root.node && root.end != 0) {
+    VerifyScratch scratch(root.end);
+    split_branch(tree, root, order, scratch, report.targets, subtrees);
+    for (const Branch &subtree : subtrees) {
+      largest = std::max<size_t>(largest, subtree.end - subtree.begin);
+    }
+  }
+  ThreadPool &pool = ThreadPool::instance();
+  std::vector<VerifyScratch> scratch(pool.concurrency(),
+                                     VerifyScratch(largest));
+  pool.parallel_for(
+      0, subtrees.size(), 1,
+      [&](size_t begin, size_t end, unsigned int participant) {
+        for (size_t i = begin; i < end; ++i) {
+          walk_subtree(tree, subtrees[i], order, scratch[participant],
+                       report.targets);
+        }
+      },
+      threads);
+
+  for (const VerifyTarget &target : report.targets) {
+    switch (target.outcome) {
+    case VerifyOutcome::kSolved:
+      ++report.solved;
+      ++report.histogram[target.guesses];
+      report.total_guesses += target.guesses;
+      report.worst = std::max<uint32_t>(report.worst, target.guesses);
+      break;
+    case VerifyOutcome::kMissingBranch:
+      ++report.missing_branch;
+      break;
+    case VerifyOutcome::kTooDeep:
+      ++report.too_deep;
+      break;
+    case VerifyOutcome::kInvalid:
+      ++report.invalid;
+      break;
+    }
+  }
+  return report;
+}
+
+void write_verify_targets(std::ostream &out, const TreeVerifyReport &report,
+                          const std::vector<std::string> &names) {
+  for (size_t i = 0; i < report.targets.size(); ++i) {
+    const VerifyTarget &target = report.targets[i];
+    out << names[i];
+    switch (target.outcome) {
+    case VerifyOutcome::kSolved:
+      out << ' ' << static_cast<int>(target.guesses);
+      break;
+    case VerifyOutcome::kMissingBranch:
+      out << " FAIL missing-branch " << static_cast<int>(target.guesses);
+      break;
+    case VerifyOutcome::kTooDeep:
+      out << " FAIL too-deep";
+      break;
+    case VerifyOutcome::kInvalid:
+      out << " INVALID";
+      break;
+    }
+    out << '\n';
+  }
+}
+
+void write_verify_summary(std::ostream &out, const TreeVerifyReport &report) {
+  constexpr size_t kListedFailures = 20;
+  out << "[verify] targets=" << report.targets.size()
+      << " solved=" << report.solved
+      << " missing_branch=" << report.missing_branch
+      << " too_deep=" << report.too_deep << " invalid=" << report.invalid
+      << "\n[verify] guesses";
+  for (size_t n = 1; n < report.histogram.size(); ++n) {
+    out << ' ' << n << ':' << report.histogram[n];
+  }
+  const double average =
+      report.solved ? static_cast<double>(report.total_guesses) /
+                          static_cast<double>(report.solved)
+                    : 0.0;
+  out << "\n[verify] avg_guesses=" << average << " worst=" << report.worst
+      << " (" << (report.worst ? report.histogram[report.worst] : 0)
+      << " targets)\n";
+  size_t listed = 0;
+  for (const VerifyTarget &target : report.targets) {
+    if (target.outcome == VerifyOutcome::kSolved ||
+        target.outcome == VerifyOutcome::kInvalid) {
+      continue;
+    }
+    if (listed == kListedFailures) {
+      out << "[verify] ... "
+          << report.missing_branch + report.too_deep - listed
+          << " more failures\n";
+      break;
+    }
+    out << "[verify] failed " << decode_word(target.word) << ' '
+        << outcome_reason(target.outcome) << " after "
+        << static_cast<int>(target.guesses) << " guesses\n";
+    ++listed;
+  }
+}
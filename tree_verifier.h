@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "solver_runtime.h"
+#include "words_data.h"
+
+// Guesses a game allows; targets the tree cannot solve within them fail.
+inline constexpr uint32_t kVerifyMaxGuesses = 6;
+
+enum class VerifyOutcome : uint8_t {
+  kSolved,
+  kMissingBranch, // the tree has no entry for the feedback after `guesses`
+  kTooDeep,       // still unsolved after kVerifyMaxGuesses guesses
+  kInvalid,       // not in the word list (passed as 0)
+};
+
+struct VerifyTarget {
+  encoded_word word = 0;
+  VerifyOutcome outcome = VerifyOutcome::kInvalid;
+  uint8_t guesses = 0; // guesses played, including the solving one
+};
+
+struct TreeVerifyReport {
+  std::vector<VerifyTarget> targets; // in input order
+  // histogram[n] counts the targets solved in n guesses.
+  std::array<size_t, kVerifyMaxGuesses + 1> histogram{};
+  size_t solved = 0;
+  size_t missing_branch = 0;
+  size_t too_deep = 0;
+  size_t invalid = 0;
+  size_t total_guesses = 0; // over solved targets
+  uint32_t worst = 0;       // most guesses a solved target needed
+
+  bool passed() const {
+    return missing_branch == 0 && too_deep == 0 && invalid == 0;
+  }
+};
+
+// Plays every target against `tree` in one walk: the targets still
+// consistent with a node travel down together and are split by the
+// feedback of its guess, so each node is visited once rather than once per
+// target. Root subtrees are walked in parallel on up to `threads` pool
+// threads (0 = all). The result for each target matches what
+// run_non_interactive reports for it without a fallback. Targets of 0 are
+// reported as invalid.
+TreeVerifyReport verify_tree(const PrecomputedLookup &tree,
+                             const std::vector<encoded_word> &targets,
+                             unsigned int threads);
+
+// One line per target, in input order: `<target> <guesses>`,
+// `<target> FAIL missing-branch <turn>`, `<target> FAIL too-deep` or
+// `<target> INVALID`. `names` holds the target words as given.
+void write_verify_targets(std::ostream &out, const TreeVerifyReport &report,
+                          const std::vector<std::string> &names);
+
+// `[verify]` summary lines: counts, guess histogram, average and worst
+// case, and the first failing targets.
+void write_verify_summary(std::ostream &out, const TreeVerifyReport &report);
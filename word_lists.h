@@ -3,12952 +3,12952 @@
 #include <cstdint>
 
 constexpr std::size_t kWordsCount = 12947;
-constexpr uint64_t kEncodedWords[kWordsCount] = {
-    0x000000000010A0A4ULL,
-    0x000000000010B129ULL,
-    0x000000000010C8E8ULL,
-    0x000000000010CA89ULL,
-    0x0000000000110461ULL,
-    0x0000000000110469ULL,
-    0x000000000011046BULL,
-    0x0000000000110473ULL,
-    0x00000000001104D4ULL,
-    0x0000000000110561ULL,
-    0x00000000001105B0ULL,
-    0x00000000001105C4ULL,
-    0x0000000000110665ULL,
-    0x0000000000110668ULL,
-    0x000000000011066BULL,
-    0x0000000000110685ULL,
-    0x0000000000110721ULL,
-    0x0000000000110833ULL,
-    0x00000000001108A4ULL,
-    0x00000000001108B3ULL,
-    0x00000000001108B9ULL,
-    0x00000000001109F4ULL,
-    0x0000000000110CA5ULL,
-    0x000000000011142DULL,
-    0x0000000000111432ULL,
-    0x0000000000111585ULL,
-    0x0000000000111653ULL,
-    0x0000000000111693ULL,
-    0x00000000001121F2ULL,
-    0x0000000000112485ULL,
-    0x00000000001124B3ULL,
-    0x00000000001130A4ULL,
-    0x00000000001130B2ULL,
-    0x00000000001130B3ULL,
-    0x00000000001130B4ULL,
-    0x00000000001131F7ULL,
-    0x000000000011350FULL,
-    0x0000000000113C85ULL,
-    0x0000000000113D0DULL,
-    0x0000000000113D2CULL,
-    0x0000000000113DA1ULL,
-    0x0000000000113DEEULL,
-    0x0000000000113E44ULL,
-    0x0000000000113E45ULL,
-    0x0000000000113E54ULL,
-    0x0000000000113EB4ULL,
-    0x0000000000113EC5ULL,
-    0x000000000011482DULL,
-    0x0000000000114839ULL,
-    0x000000000011492DULL,
-    0x000000000011492EULL,
-    0x0000000000114933ULL,
-    0x0000000000114CB9ULL,
-    0x0000000000114D34ULL,
-    0x00000000001155C1ULL,
-    0x00000000001155C5ULL,
-    0x0000000000115665ULL,
-    0x0000000000115693ULL,
-    0x000000000011575AULL,
-    0x00000000001164B3ULL,
-    0x000000000011666DULL,
-    0x0000000000116673ULL,
-    0x0000000000118533ULL,
-    0x0000000000118649ULL,
-    0x0000000000118C33ULL,
-    0x0000000000118DF9ULL,
-    0x0000000000119642ULL,
-    0x0000000000119653ULL,
-    0x0000000000119681ULL,
-    0x000000000011A032ULL,
-    0x000000000011A0A4ULL,
-    0x000000000011A0B3ULL,
-    0x000000000011A1EFULL,
-    0x000000000011A493ULL,
-    0x000000000011A499ULL,
-    0x000000000011A5C7ULL,
-    0x000000000011A5C9ULL,
-    0x000000000011ACA5ULL,
-    0x000000000011ACB2ULL,
-    0x000000000011B4B3ULL,
-    0x000000000011B523ULL,
-    0x000000000011B8A4ULL,
-    0x000000000011B8B3ULL,
-    0x000000000011BC6BULL,
-    0x000000000011BD84ULL,
-    0x000000000011BE4EULL,
-    0x000000000011C8A4ULL,
-    0x000000000011C8B3ULL,
-    0x000000000011C924ULL,
-    0x000000000011C9F3ULL,
-    0x000000000011D0A4ULL,
-    0x000000000011D12EULL,
-    0x000000000011D1EEULL,
-    0x000000000011D1F2ULL,
-    0x000000000011D685ULL,
-    0x000000000011E593ULL,
-    0x00000000001204E5ULL,
-    0x0000000000120614ULL,
-    0x00000000001206F3ULL,
-    0x0000000000120733ULL,
-    0x00000000001209F4ULL,
-    0x0000000000121038ULL,
-    0x00000000001210A4ULL,
-    0x00000000001210B2ULL,
-    0x000000000012112FULL,
-    0x0000000000121185ULL,
-    0x00000000001214ADULL,
-    0x0000000000121614ULL,
-    0x000000000012202EULL,
-    0x00000000001224B5ULL,
-    0x00000000001225F3ULL,
-    0x0000000000122693ULL,
-    0x000000000012342EULL,
-    0x00000000001234AEULL,
-    0x000000000012352EULL,
-    0x0000000000123534ULL,
-    0x0000000000123538ULL,
-    0x0000000000123C45ULL,
-    0x0000000000123C4FULL,
-    0x0000000000123E14ULL,
-    0x0000000000123E45ULL,
-    0x0000000000123E4EULL,
-    0x0000000000123EEEULL,
-    0x0000000000123F45ULL,
-    0x0000000000124824ULL,
-    0x00000000001248A4ULL,
-    0x0000000000124EADULL,
-    0x0000000000125569ULL,
-    0x0000000000125594ULL,
-    0x00000000001255C3ULL,
-    0x0000000000125674ULL,
-    0x00000000001258B7ULL,
-    0x0000000000126681ULL,
-    0x00000000001268A4ULL,
-    0x00000000001268B3ULL,
-    0x0000000000128D21ULL,
-    0x00000000001290B3ULL,
-    0x0000000000129D33ULL,
-    0x000000000012BDD3ULL,
-    0x000000000012C925ULL,
-    0x000000000012C9F3ULL,
-    0x000000000012CD32ULL,
-    0x0000000000130584ULL,
-    0x0000000000130641ULL,
-    0x0000000000130653ULL,
-    0x0000000000131432ULL,
-    0x0000000000131938ULL,
-    0x0000000000132645ULL,
-    0x000000000013302AULL,
-    0x0000000000133DF4ULL,
-    0x0000000000133E45ULL,
-    0x0000000000133EACULL,
-    0x0000000000134934ULL,
-    0x00000000001349F3ULL,
-    0x00000000001350B2ULL,
-    0x000000000013852EULL,
-    0x00000000001385A1ULL,
-    0x00000000001385A9ULL,
-    0x0000000000138605ULL,
-    0x0000000000138653ULL,
-    0x0000000000138674ULL,
-    0x0000000000138685ULL,
-    0x00000000001386C5ULL,
-    0x0000000000138745ULL,
-    0x00000000001395C5ULL,
-    0x00000000001395D4ULL,
-    0x0000000000139653ULL,
-    0x0000000000139CB2ULL,
-    0x0000000000139D25ULL,
-    0x0000000000139E49ULL,
-    0x0000000000139E4FULL,
-    0x0000000000139E59ULL,
-    0x000000000013A033ULL,
-    0x000000000013A581ULL,
-    0x000000000013A585ULL,
-    0x000000000013A5C7ULL,
-    0x000000000013A5F3ULL,
-    0x000000000013A66DULL,
-    0x000000000013A674ULL,
-    0x000000000013A681ULL,
-    0x000000000013B0A5ULL,
-    0x000000000013B0B4ULL,
-    0x000000000013B0B9ULL,
-    0x000000000013B1EFULL,
-    0x000000000013B1F7ULL,
-    0x000000000013B2B3ULL,
-    0x000000000013B433ULL,
-    0x000000000013BCE5ULL,
-    0x000000000013BDC5ULL,
-    0x000000000013BDD3ULL,
-    0x000000000013BDD9ULL,
-    0x000000000013BDE4ULL,
-    0x000000000013C8A5ULL,
-    0x000000000013C921ULL,
-    0x000000000013C92EULL,
-    0x000000000013C9F3ULL,
-    0x000000000013D4A4ULL,
-    0x000000000013D4B3ULL,
-    0x000000000013D5C1ULL,
-    0x000000000013D689ULL,
-    0x0000000000141424ULL,
-    0x0000000000141430ULL,
-    0x00000000001415D4ULL,
-    0x00000000001424E8ULL,
-    0x00000000001425C4ULL,
-    0x00000000001425C7ULL,
-    0x00000000001425D4ULL,
-    0x0000000000143D84ULL,
-    0x000000000014558CULL,
-    0x0000000000145655ULL,
-    0x0000000000149033ULL,
-    0x00000000001490A4ULL,
-    0x00000000001490B2ULL,
-    0x00000000001490B3ULL,
-    0x00000000001491E9ULL,
-    0x00000000001491F3ULL,
-    0x0000000000149659ULL,
-    0x0000000000149C33ULL,
-    0x0000000000149D14ULL,
-    0x000000000014B0A4ULL,
-    0x000000000014B4A4ULL,
-    0x000000000014B4B2ULL,
-    0x000000000014B8A5ULL,
-    0x000000000014B8E1ULL,
-    0x000000000014BD89ULL,
-    0x000000000014C8A4ULL,
-    0x000000000014C8B2ULL,
-    0x000000000014C9D3ULL,
-    0x000000000014CA88ULL,
-    0x000000000014CA93ULL,
-    0x000000000014CD85ULL,
-    0x000000000014D068ULL,
-    0x000000000014D2B3ULL,
-    0x000000000014D8B2ULL,
-    0x000000000014E4A5ULL,
-    0x000000000014E985ULL,
-    0x00000000001524B3ULL,
-    0x00000000001526C1ULL,
-    0x00000000001554E1ULL,
-    0x0000000000155C2EULL,
-    0x00000000001594B3ULL,
-    0x0000000000159581ULL,
-    0x00000000001595C5ULL,
-    0x000000000015A5C7ULL,
-    0x000000000015A681ULL,
-    0x000000000015AC33ULL,
-    0x0000000000160430ULL,
-    0x000000000016046BULL,
-    0x00000000001605AFULL,
-    0x00000000001605C4ULL,
-    0x00000000001605C5ULL,
-    0x00000000001605C7ULL,
-    0x00000000001605D3ULL,
-    0x00000000001605D4ULL,
-    0x0000000000160601ULL,
-    0x0000000000160613ULL,
-    0x000000000016064DULL,
-    0x0000000000160659ULL,
-    0x0000000000160685ULL,
-    0x0000000000160733ULL,
-    0x0000000000160833ULL,
-    0x00000000001608A5ULL,
-    0x0000000000160AADULL,
-    0x0000000000160D24ULL,
-    0x0000000000160DF3ULL,
-    0x00000000001610A1ULL,
-    0x00000000001610B2ULL,
-    0x00000000001611ECULL,
-    0x000000000016146BULL,
-    0x0000000000161473ULL,
-    0x00000000001614D3ULL,
-    0x00000000001614D4ULL,
-    0x0000000000161608ULL,
-    0x0000000000161654ULL,
-    0x00000000001616F3ULL,
-    0x0000000000161725ULL,
-    0x0000000000161833ULL,
-    0x0000000000161C25ULL,
-    0x0000000000161C2CULL,
-    0x0000000000161C33ULL,
-    0x0000000000161D24ULL,
-    0x0000000000161D2EULL,
-    0x0000000000161DF2ULL,
-    0x0000000000161EADULL,
-    0x0000000000162433ULL,
-    0x0000000000162449ULL,
-    0x00000000001624AEULL,
-    0x00000000001624D3ULL,
-    0x00000000001624EEULL,
-    0x0000000000162565ULL,
-    0x00000000001625C5ULL,
-    0x0000000000162674ULL,
-    0x00000000001626C5ULL,
-    0x0000000000162721ULL,
-    0x0000000000162D25ULL,
-    0x0000000000162DF3ULL,
-    0x0000000000162F24ULL,
-    0x0000000000162F2CULL,
-    0x0000000000163039ULL,
-    0x00000000001630A5ULL,
-    0x00000000001630ACULL,
-    0x00000000001630B9ULL,
-    0x0000000000163133ULL,
-    0x00000000001631E4ULL,
-    0x00000000001631F4ULL,
-    0x00000000001631F7ULL,
-    0x00000000001631F9ULL,
-    0x000000000016332CULL,
-    0x0000000000163428ULL,
-    0x0000000000163433ULL,
-    0x00000000001634A8ULL,
-    0x00000000001634B3ULL,
-    0x00000000001636A4ULL,
-    0x00000000001636A7ULL,
-    0x0000000000163C93ULL,
-    0x0000000000163CA4ULL,
-    0x0000000000163CB3ULL,
-    0x0000000000163CD4ULL,
-    0x0000000000163D01ULL,
-    0x0000000000163D2EULL,
-    0x0000000000163DC5ULL,
-    0x0000000000163DC7ULL,
-    0x0000000000163DE6ULL,
-    0x0000000000163DF3ULL,
-    0x0000000000163EA4ULL,
-    0x0000000000163EE5ULL,
-    0x0000000000164101ULL,
-    0x0000000000165032ULL,
-    0x00000000001650B2ULL,
-    0x000000000016510FULL,
-    0x00000000001651F3ULL,
-    0x0000000000165581ULL,
-    0x00000000001655B3ULL,
-    0x0000000000165645ULL,
-    0x0000000000165832ULL,
-    0x0000000000165C39ULL,
-    0x0000000000168513ULL,
-    0x000000000016852EULL,
-    0x0000000000168673ULL,
-    0x0000000000168685ULL,
-    0x00000000001686B4ULL,
-    0x0000000000168745ULL,
-    0x000000000016882EULL,
-    0x00000000001688B2ULL,
-    0x0000000000168934ULL,
-    0x0000000000168985ULL,
-    0x00000000001689F3ULL,
-    0x0000000000168A59ULL,
-    0x0000000000169441ULL,
-    0x00000000001694B2ULL,
-    0x00000000001695C4ULL,
-    0x00000000001695C5ULL,
-    0x00000000001695D3ULL,
-    0x00000000001695D4ULL,
-    0x000000000016A433ULL,
-    0x000000000016A465ULL,
-    0x000000000016A469ULL,
-    0x000000000016A485ULL,
-    0x000000000016A48FULL,
-    0x000000000016A493ULL,
-    0x000000000016A4B3ULL,
-    0x000000000016A4E1ULL,
-    0x000000000016A4EFULL,
-    0x000000000016A5C5ULL,
-    0x000000000016A5CFULL,
-    0x000000000016A5D3ULL,
-    0x000000000016A653ULL,
-    0x000000000016A673ULL,
-    0x000000000016A699ULL,
-    0x000000000016B033ULL,
-    0x000000000016B42EULL,
-    0x000000000016B5EEULL,
-    0x000000000016B5F3ULL,
-    0x000000000016B921ULL,
-    0x000000000016B923ULL,
-    0x000000000016B92FULL,
-    0x000000000016BD73ULL,
-    0x000000000016BD85ULL,
-    0x000000000016BDC7ULL,
-    0x000000000016BE54ULL,
-    0x000000000016BEB2ULL,
-    0x000000000016BEC5ULL,
-    0x000000000016BEF4ULL,
-    0x000000000016C0A4ULL,
-    0x000000000016C185ULL,
-    0x000000000016C199ULL,
-    0x000000000016C2ACULL,
-    0x000000000016C934ULL,
-    0x000000000016D46BULL,
-    0x000000000016D665ULL,
-    0x000000000016E593ULL,
-    0x00000000001705C1ULL,
-    0x0000000000170681ULL,
-    0x0000000000170D0FULL,
-    0x0000000000170D85ULL,
-    0x0000000000170DEEULL,
-    0x000000000017124FULL,
-    0x0000000000171432ULL,
-    0x0000000000171585ULL,
-    0x00000000001715D4ULL,
-    0x0000000000171C33ULL,
-    0x0000000000171CACULL,
-    0x0000000000171CB2ULL,
-    0x0000000000171D85ULL,
-    0x0000000000171D8FULL,
-    0x0000000000171E59ULL,
-    0x0000000000171E74ULL,
-    0x00000000001724E8ULL,
-    0x0000000000172585ULL,
-    0x0000000000172593ULL,
-    0x00000000001725A1ULL,
-    0x00000000001725A5ULL,
-    0x00000000001725A9ULL,
-    0x00000000001725EEULL,
-    0x0000000000172665ULL,
-    0x0000000000172CB2ULL,
-    0x0000000000172D13ULL,
-    0x0000000000172D85ULL,
-    0x0000000000172EB3ULL,
-    0x0000000000173033ULL,
-    0x000000000017382CULL,
-    0x0000000000173833ULL,
-    0x0000000000173834ULL,
-    0x00000000001738B8ULL,
-    0x00000000001739F9ULL,
-    0x0000000000173AACULL,
-    0x0000000000173C33ULL,
-    0x0000000000173C85ULL,
-    0x0000000000173D85ULL,
-    0x0000000000173DB9ULL,
-    0x0000000000174C25ULL,
-    0x0000000000175025ULL,
-    0x0000000000175032ULL,
-    0x0000000000175033ULL,
-    0x00000000001750A4ULL,
-    0x00000000001750B3ULL,
-    0x0000000000175123ULL,
-    0x0000000000175133ULL,
-    0x0000000000175241ULL,
-    0x0000000000175245ULL,
-    0x0000000000175279ULL,
-    0x0000000000175641ULL,
-    0x000000000017592CULL,
-    0x00000000001765EEULL,
-    0x000000000017CA81ULL,
-    0x0000000000180465ULL,
-    0x00000000001804E5ULL,
-    0x0000000000180524ULL,
-    0x0000000000180654ULL,
-    0x0000000000180724ULL,
-    0x0000000000180733ULL,
-    0x000000000018142BULL,
-    0x00000000001814ABULL,
-    0x0000000000181653ULL,
-    0x0000000000181654ULL,
-    0x0000000000181659ULL,
-    0x0000000000181C32ULL,
-    0x0000000000182124ULL,
-    0x0000000000182133ULL,
-    0x000000000018242EULL,
-    0x00000000001825C7ULL,
-    0x00000000001825ECULL,
-    0x0000000000182668ULL,
-    0x000000000018266DULL,
-    0x00000000001838A1ULL,
-    0x0000000000183C85ULL,
-    0x0000000000183C93ULL,
-    0x0000000000183DF0ULL,
-    0x0000000000183E54ULL,
-    0x000000000018402CULL,
-    0x0000000000184039ULL,
-    0x00000000001840ACULL,
-    0x0000000000184185ULL,
-    0x0000000000184199ULL,
-    0x000000000018424FULL,
-    0x00000000001842A9ULL,
-    0x00000000001842B9ULL,
-    0x00000000001848B3ULL,
-    0x00000000001849EEULL,
-    0x0000000000184CB3ULL,
-    0x0000000000184D33ULL,
-    0x0000000000184DF3ULL,
-    0x00000000001850A4ULL,
-    0x00000000001850B2ULL,
-    0x0000000000185199ULL,
-    0x000000000018D425ULL,
-    0x000000000018D433ULL,
-    0x0000000000190441ULL,
-    0x0000000000190573ULL,
-    0x00000000001905A5ULL,
-    0x0000000000190653ULL,
-    0x0000000000190833ULL,
-    0x00000000001909F2ULL,
-    0x0000000000190CA4ULL,
-    0x0000000000190D09ULL,
-    0x0000000000190DF3ULL,
-    0x0000000000190EB3ULL,
-    0x00000000001910A2ULL,
-    0x00000000001911F2ULL,
-    0x0000000000191249ULL,
-    0x0000000000191424ULL,
-    0x0000000000191425ULL,
-    0x000000000019142CULL,
-    0x0000000000191432ULL,
-    0x0000000000191433ULL,
-    0x0000000000191461ULL,
-    0x0000000000191484ULL,
-    0x0000000000191485ULL,
-    0x00000000001914D9ULL,
-    0x0000000000191523ULL,
-    0x00000000001915C1ULL,
-    0x00000000001915C5ULL,
-    0x0000000000191601ULL,
-    0x0000000000191645ULL,
-    0x0000000000191685ULL,
-    0x0000000000191693ULL,
-    0x0000000000191694ULL,
-    0x0000000000191C2CULL,
-    0x0000000000191C2EULL,
-    0x0000000000191D2CULL,
-    0x0000000000191D85ULL,
-    0x0000000000191DECULL,
-    0x0000000000191DEEULL,
-    0x0000000000191DF4ULL,
-    0x0000000000191EA5ULL,
-    0x0000000000191EB3ULL,
-    0x0000000000192034ULL,
-    0x0000000000192433ULL,
-    0x00000000001924ACULL,
-    0x0000000000192569ULL,
-    0x0000000000192593ULL,
-    0x00000000001925F4ULL,
-    0x0000000000192665ULL,
-    0x0000000000192668ULL,
-    0x0000000000192CA4ULL,
-    0x00000000001930A4ULL,
-    0x00000000001930B3ULL,
-    0x00000000001934A4ULL,
-    0x00000000001934B2ULL,
-    0x00000000001934B4ULL,
-    0x000000000019352CULL,
-    0x00000000001935F2ULL,
-    0x0000000000193833ULL,
-    0x0000000000193AB4ULL,
-    0x0000000000193C41ULL,
-    0x0000000000193D01ULL,
-    0x0000000000193D24ULL,
-    0x0000000000193DA1ULL,
-    0x0000000000193E65ULL,
-    0x0000000000194033ULL,
-    0x00000000001940AEULL,
-    0x0000000000194828ULL,
-    0x0000000000194833ULL,
-    0x0000000000194839ULL,
-    0x00000000001948B4ULL,
-    0x0000000000194933ULL,
-    0x00000000001949F7ULL,
-    0x00000000001949FAULL,
-    0x0000000000194CA4ULL,
-    0x0000000000194CB3ULL,
-    0x0000000000194CB9ULL,
-    0x0000000000194D33ULL,
-    0x0000000000194DEEULL,
-    0x000000000019502CULL,
-    0x00000000001950ACULL,
-    0x0000000000195123ULL,
-    0x0000000000195133ULL,
-    0x0000000000195279ULL,
-    0x0000000000195505ULL,
-    0x00000000001955B3ULL,
-    0x000000000019582CULL,
-    0x00000000001958A5ULL,
-    0x00000000001959F3ULL,
-    0x0000000000196593ULL,
-    0x00000000001985C1ULL,
-    0x0000000000198DEEULL,
-    0x0000000000198DF4ULL,
-    0x0000000000198EB3ULL,
-    0x0000000000199123ULL,
-    0x000000000019A0A4ULL,
-    0x000000000019A0AEULL,
-    0x000000000019A0B3ULL,
-    0x000000000019A0B4ULL,
-    0x000000000019A485ULL,
-    0x000000000019ACA4ULL,
-    0x000000000019ACB2ULL,
-    0x000000000019ACB7ULL,
-    0x000000000019ADE9ULL,
-    0x000000000019ADF3ULL,
-    0x000000000019C0AEULL,
-    0x000000000019C0B2ULL,
-    0x000000000019C123ULL,
-    0x000000000019C125ULL,
-    0x000000000019C133ULL,
-    0x000000000019C24FULL,
-    0x000000000019CC29ULL,
-    0x000000000019CC2DULL,
-    0x000000000019CC39ULL,
-    0x000000000019CCB3ULL,
-    0x000000000019CCB4ULL,
-    0x000000000019CCBAULL,
-    0x000000000019CDF4ULL,
-    0x000000000019D0B2ULL,
-    0x000000000019D132ULL,
-    0x000000000019D2AEULL,
-    0x000000000019D641ULL,
-    0x000000000019DC39ULL,
-    0x000000000019DD2DULL,
-    0x000000000019E581ULL,
-    0x00000000001A0613ULL,
-    0x00000000001A0719ULL,
-    0x00000000001A24E9ULL,
-    0x00000000001A2594ULL,
-    0x00000000001A25B9ULL,
-    0x00000000001A3033ULL,
-    0x00000000001A342EULL,
-    0x00000000001A3433ULL,
-    0x00000000001A35F3ULL,
-    0x00000000001A3C73ULL,
-    0x00000000001A3D65ULL,
-    0x00000000001A3D73ULL,
-    0x00000000001A3D8CULL,
-    0x00000000001A3DB3ULL,
-    0x00000000001A3DB9ULL,
-    0x00000000001A3DC5ULL,
-    0x00000000001A3DD9ULL,
-    0x00000000001A3E19ULL,
-    0x00000000001A4921ULL,
-    0x00000000001A4930ULL,
-    0x00000000001A5030ULL,
-    0x00000000001A5032ULL,
-    0x00000000001A5123ULL,
-    0x00000000001A5433ULL,
-    0x00000000001A9024ULL,
-    0x00000000001A912FULL,
-    0x00000000001A9134ULL,
-    0x00000000001A9CB2ULL,
-    0x00000000001A9D14ULL,
-    0x00000000001A9EB2ULL,
-    0x00000000001AB033ULL,
-    0x00000000001AB123ULL,
-    0x00000000001AB1E9ULL,
-    0x00000000001AB1F3ULL,
-    0x00000000001AB52CULL,
-    0x00000000001AB8B3ULL,
-    0x00000000001ABA93ULL,
-    0x00000000001ABA99ULL,
-    0x00000000001AC825ULL,
-    0x00000000001AC82CULL,
-    0x00000000001AC832ULL,
-    0x00000000001AC833ULL,
-    0x00000000001AC8A9ULL,
-    0x00000000001AC8B3ULL,
-    0x00000000001AC923ULL,
-    0x00000000001AC933ULL,
-    0x00000000001ACAADULL,
-    0x00000000001AD1F3ULL,
-    0x00000000001AE12EULL,
-    0x00000000001B052CULL,
-    0x00000000001B0585ULL,
-    0x00000000001B05D4ULL,
-    0x00000000001B0674ULL,
-    0x00000000001B1593ULL,
-    0x00000000001B15D3ULL,
-    0x00000000001B1653ULL,
-    0x00000000001B1654ULL,
-    0x00000000001B1C33ULL,
-    0x00000000001B242EULL,
-    0x00000000001B25C5ULL,
-    0x00000000001B25EEULL,
-    0x00000000001B2665ULL,
-    0x00000000001B266FULL,
-    0x00000000001B2745ULL,
-    0x00000000001B3D24ULL,
-    0x00000000001B3EF3ULL,
-    0x00000000001B6745ULL,
-    0x00000000001B8534ULL,
-    0x00000000001B8565ULL,
-    0x00000000001B8644ULL,
-    0x00000000001B8645ULL,
-    0x00000000001B864EULL,
-    0x00000000001B8668ULL,
-    0x00000000001B868FULL,
-    0x00000000001B86C5ULL,
-    0x00000000001B8733ULL,
-    0x00000000001B9193ULL,
-    0x00000000001B94ACULL,
-    0x00000000001B968FULL,
-    0x00000000001B9AACULL,
-    0x00000000001BA5C7ULL,
-    0x00000000001BB659ULL,
-    0x00000000001BB8A4ULL,
-    0x00000000001BB8B2ULL,
-    0x00000000001BBD65ULL,
-    0x00000000001BBD93ULL,
-    0x00000000001BBE4BULL,
-    0x00000000001C1593ULL,
-    0x00000000001C242CULL,
-    0x00000000001C2585ULL,
-    0x00000000001C2593ULL,
-    0x00000000001C25C7ULL,
-    0x00000000001C25EDULL,
-    0x00000000001C25EEULL,
-    0x00000000001C2685ULL,
-    0x00000000001C30A4ULL,
-    0x00000000001C30B3ULL,
-    0x00000000001C342EULL,
-    0x00000000001C34AEULL,
-    0x00000000001C3D24ULL,
-    0x00000000001C3DC5ULL,
-    0x00000000001C3DD3ULL,
-    0x00000000001C8513ULL,
-    0x00000000001C8721ULL,
-    0x00000000001C9590ULL,
-    0x00000000001C9E45ULL,
-    0x00000000001CA5D3ULL,
-    0x00000000001CBDD4ULL,
-    0x00000000001CC8B3ULL,
-    0x00000000001CC925ULL,
-    0x00000000001D05D3ULL,
-    0x00000000001D2485ULL,
-    0x00000000001D248FULL,
-    0x00000000001D25C5ULL,
-    0x00000000001D31EEULL,
-    0x00000000001D3D23ULL,
-    0x00000000001D3D85ULL,
-    0x00000000001D3DD3ULL,
-    0x00000000001D3E85ULL,
-    0x00000000001D3E88ULL,
-    0x00000000001D5569ULL,
-    0x00000000001D5645ULL,
-    0x00000000001D564EULL,
-    0x00000000001D5659ULL,
-    0x00000000001D64F9ULL,
-    0x00000000001D65A5ULL,
-    0x00000000001D65B3ULL,
-    0x00000000002084A4ULL,
-    0x0000000000208593ULL,
-    0x0000000000208833ULL,
-    0x00000000002088ACULL,
-    0x00000000002088B3ULL,
-    0x0000000000208961ULL,
-    0x00000000002089EFULL,
-    0x0000000000208AACULL,
-    0x0000000000208AB3ULL,
-    0x0000000000208C61ULL,
-    0x0000000000208C6FULL,
-    0x0000000000208C79ULL,
-    0x0000000000208D01ULL,
-    0x0000000000208D13ULL,
-    0x0000000000208D73ULL,
-    0x0000000000208DEEULL,
-    0x0000000000209099ULL,
-    0x00000000002090E5ULL,
-    0x0000000000209199ULL,
-    0x0000000000209593ULL,
-    0x00000000002098D3ULL,
-    0x00000000002098D9ULL,
-    0x0000000000209A93ULL,
-    0x0000000000209CACULL,
-    0x0000000000209CF9ULL,
-    0x0000000000209D13ULL,
-    0x0000000000209D25ULL,
-    0x000000000020A293ULL,
-    0x000000000020A2B3ULL,
-    0x000000000020A2B4ULL,
-    0x000000000020A593ULL,
-    0x000000000020A64EULL,
-    0x000000000020A661ULL,
-    0x000000000020A688ULL,
-    0x000000000020A693ULL,
-    0x000000000020A741ULL,
-    0x000000000020A745ULL,
-    0x000000000020A82EULL,
-    0x000000000020AA41ULL,
-    0x000000000020AA49ULL,
-    0x000000000020AAB3ULL,
-    0x000000000020ACA4ULL,
-    0x000000000020ACAEULL,
-    0x000000000020ACB2ULL,
-    0x000000000020ACB3ULL,
-    0x000000000020AE41ULL,
-    0x000000000020B033ULL,
-    0x000000000020B093ULL,
-    0x000000000020B099ULL,
-    0x000000000020B0A4ULL,
-    0x000000000020B0B2ULL,
-    0x000000000020B0B3ULL,
-    0x000000000020B173ULL,
-    0x000000000020B179ULL,
-    0x000000000020B193ULL,
-    0x000000000020B199ULL,
-    0x000000000020B1B3ULL,
-    0x000000000020B1B9ULL,
-    0x000000000020B1EFULL,
-    0x000000000020B261ULL,
-    0x000000000020B289ULL,
-    0x000000000020B2AEULL,
-    0x000000000020B2B3ULL,
-    0x000000000020B449ULL,
-    0x000000000020B82BULL,
-    0x000000000020B82CULL,
-    0x000000000020B86FULL,
-    0x000000000020B873ULL,
-    0x000000000020B881ULL,
-    0x000000000020B888ULL,
-    0x000000000020B893ULL,
-    0x000000000020B899ULL,
-    0x000000000020B8A4ULL,
-    0x000000000020B8B3ULL,
-    0x000000000020B8F3ULL,
-    0x000000000020B921ULL,
-    0x000000000020B94FULL,
-    0x000000000020B973ULL,
-    0x000000000020B9D3ULL,
-    0x000000000020BA93ULL,
-    0x000000000020BA95ULL,
-    0x000000000020BA99ULL,
-    0x000000000020BB21ULL,
-    0x000000000020C2B3ULL,
-    0x000000000020C845ULL,
-    0x000000000020C853ULL,
-    0x000000000020C859ULL,
-    0x000000000020C861ULL,
-    0x000000000020C885ULL,
-    0x000000000020C88FULL,
-    0x000000000020C893ULL,
-    0x000000000020C899ULL,
-    0x000000000020C8A4ULL,
-    0x000000000020C8B2ULL,
-    0x000000000020C8B3ULL,
-    0x000000000020C8C9ULL,
-    0x000000000020C8D3ULL,
-    0x000000000020C8E5ULL,
-    0x000000000020C923ULL,
-    0x000000000020C973ULL,
-    0x000000000020C979ULL,
-    0x000000000020C9B3ULL,
-    0x000000000020C9B9ULL,
-    0x000000000020C9D3ULL,
-    0x000000000020C9D9ULL,
-    0x000000000020C9EEULL,
-    0x000000000020CA13ULL,
-    0x000000000020CA41ULL,
-    0x000000000020CA45ULL,
-    0x000000000020CA4FULL,
-    0x000000000020CA59ULL,
-    0x000000000020CB25ULL,
-    0x000000000020CC2CULL,
-    0x000000000020CC2EULL,
-    0x000000000020CCA4ULL,
-    0x000000000020CCAEULL,
-    0x000000000020CCB2ULL,
-    0x000000000020CCB3ULL,
-    0x000000000020CD0FULL,
-    0x000000000020CD23ULL,
-    0x000000000020CD2AULL,
-    0x000000000020CD2CULL,
-    0x000000000020CD2EULL,
-    0x000000000020CD33ULL,
-    0x000000000020CD73ULL,
-    0x000000000020CDEEULL,
-    0x000000000020CE65ULL,
-    0x000000000020CE69ULL,
-    0x000000000020CE6FULL,
-    0x000000000020CE79ULL,
-    0x000000000020CE81ULL,
-    0x000000000020CE85ULL,
-    0x000000000020CE89ULL,
-    0x000000000020CE8FULL,
-    0x000000000020CE93ULL,
-    0x000000000020D068ULL,
-    0x000000000020D0A4ULL,
-    0x000000000020D0B3ULL,
-    0x000000000020D105ULL,
-    0x000000000020D113ULL,
-    0x000000000020D12BULL,
-    0x000000000020D1EEULL,
-    0x000000000020D281ULL,
-    0x000000000020D293ULL,
-    0x000000000020D295ULL,
-    0x000000000020D299ULL,
-    0x000000000020D493ULL,
-    0x000000000020D573ULL,
-    0x000000000020D58BULL,
-    0x000000000020D653ULL,
-    0x000000000020D92EULL,
-    0x000000000020DC93ULL,
-    0x000000000020DC99ULL,
-    0x000000000020DD73ULL,
-    0x000000000020DD93ULL,
-    0x000000000020DDD3ULL,
-    0x000000000020DE53ULL,
-    0x000000000020DE99ULL,
-    0x000000000020E4A4ULL,
-    0x000000000020E4B2ULL,
-    0x000000000020E4B3ULL,
-    0x000000000020E585ULL,
-    0x000000000020E5F5ULL,
-    0x000000000020E693ULL,
-    0x000000000020E832ULL,
-    0x000000000020E9EFULL,
-    0x0000000000228468ULL,
-    0x0000000000228493ULL,
-    0x0000000000228499ULL,
-    0x0000000000228573ULL,
-    0x0000000000228579ULL,
-    0x0000000000228593ULL,
-    0x00000000002285B3ULL,
-    0x00000000002285B9ULL,
-    0x00000000002285CFULL,
-    0x00000000002285D3ULL,
-    0x00000000002285D9ULL,
-    0x0000000000228644ULL,
-    0x0000000000228645ULL,
-    0x0000000000228653ULL,
-    0x0000000000228674ULL,
-    0x0000000000228688ULL,
-    0x0000000000228693ULL,
-    0x0000000000228699ULL,
-    0x00000000002286B3ULL,
-    0x00000000002286B4ULL,
-    0x00000000002286B8ULL,
-    0x00000000002289F0ULL,
-    0x0000000000228C30ULL,
-    0x0000000000228D65ULL,
-    0x0000000000228D73ULL,
-    0x0000000000229024ULL,
-    0x00000000002290ACULL,
-    0x00000000002290B3ULL,
-    0x00000000002290B7ULL,
-    0x000000000022912DULL,
-    0x0000000000229325ULL,
-    0x0000000000229468ULL,
-    0x0000000000229489ULL,
-    0x00000000002294D3ULL,
-    0x00000000002294D9ULL,
-    0x0000000000229613ULL,
-    0x0000000000229653ULL,
-    0x0000000000229659ULL,
-    0x0000000000229693ULL,
-    0x0000000000229934ULL,
-    0x00000000002299E7ULL,
-    0x0000000000229C24ULL,
-    0x0000000000229C2EULL,
-    0x0000000000229C32ULL,
-    0x0000000000229C34ULL,
-    0x0000000000229CADULL,
-    0x0000000000229CB4ULL,
-    0x0000000000229D2EULL,
-    0x0000000000229DF4ULL,
-    0x0000000000229EADULL,
-    0x0000000000229EAEULL,
-    0x000000000022A4E5ULL,
-    0x000000000022A4F9ULL,
-    0x000000000022A5C7ULL,
-    0x000000000022A5D3ULL,
-    0x000000000022AC28ULL,
-    0x000000000022B028ULL,
-    0x000000000022B032ULL,
-    0x000000000022B039ULL,
-    0x000000000022B068ULL,
-    0x000000000022B0A5ULL,
-    0x000000000022B0E1ULL,
-    0x000000000022B125ULL,
-    0x000000000022B185ULL,
-    0x000000000022B193ULL,
-    0x000000000022B199ULL,
-    0x000000000022B1EEULL,
-    0x000000000022B1F7ULL,
-    0x000000000022B293ULL,
-    0x000000000022B424ULL,
-    0x000000000022B433ULL,
-    0x000000000022B538ULL,
-    0x000000000022B6A4ULL,
-    0x000000000022B868ULL,
-    0x000000000022B893ULL,
-    0x000000000022B899ULL,
-    0x000000000022B8B3ULL,
-    0x000000000022B8B4ULL,
-    0x000000000022B8E1ULL,
-    0x000000000022B933ULL,
-    0x000000000022B9C5ULL,
-    0x000000000022B9C9ULL,
-    0x000000000022B9D9ULL,
-    0x000000000022BA8FULL,
-    0x000000000022BA93ULL,
-    0x000000000022BA99ULL,
-    0x000000000022C034ULL,
-    0x000000000022C839ULL,
-    0x000000000022C8B3ULL,
-    0x000000000022C8B4ULL,
-    0x000000000022C8F3ULL,
-    0x000000000022C96FULL,
-    0x000000000022C973ULL,
-    0x000000000022C9A5ULL,
-    0x000000000022C9B3ULL,
-    0x000000000022C9E2ULL,
-    0x000000000022CA59ULL,
-    0x000000000022CA88ULL,
-    0x000000000022CB2CULL,
-    0x000000000022CC34ULL,
-    0x000000000022CC37ULL,
-    0x000000000022CCA5ULL,
-    0x000000000022CCB3ULL,
-    0x000000000022CCB4ULL,
-    0x000000000022CD34ULL,
-    0x000000000022CDEDULL,
-    0x000000000022CDF4ULL,
-    0x000000000022CE89ULL,
-    0x000000000022CE93ULL,
-    0x000000000022D033ULL,
-    0x000000000022D0A4ULL,
-    0x000000000022D0ACULL,
-    0x000000000022D0B3ULL,
-    0x000000000022D113ULL,
-    0x000000000022D124ULL,
-    0x000000000022D1EEULL,
-    0x000000000022D281ULL,
-    0x000000000022D299ULL,
-    0x000000000022D8ACULL,
-    0x000000000022D8B2ULL,
-    0x000000000022D9F2ULL,
-    0x000000000022DAA5ULL,
-    0x000000000022DAD9ULL,
-    0x000000000022DCB4ULL,
-    0x000000000022DD27ULL,
-    0x000000000022E8ACULL,
-    0x000000000022E8B3ULL,
-    0x000000000022E92CULL,
-    0x000000000022EB59ULL,
-    0x0000000000240533ULL,
-    0x0000000000240549ULL,
-    0x00000000002405C7ULL,
-    0x0000000000240693ULL,
-    0x0000000000241593ULL,
-    0x0000000000243DF4ULL,
-    0x00000000002455C1ULL,
-    0x0000000000245693ULL,
-    0x0000000000248468ULL,
-    0x0000000000248589ULL,
-    0x0000000000248599ULL,
-    0x0000000000248853ULL,
-    0x00000000002488B3ULL,
-    0x0000000000248985ULL,
-    0x0000000000248C79ULL,
-    0x0000000000248CB0ULL,
-    0x0000000000248CB3ULL,
-    0x0000000000249099ULL,
-    0x00000000002490A4ULL,
-    0x00000000002490B2ULL,
-    0x00000000002490B3ULL,
-    0x00000000002490B4ULL,
-    0x0000000000249133ULL,
-    0x00000000002491EEULL,
-    0x0000000000249584ULL,
-    0x0000000000249653ULL,
-    0x00000000002498CFULL,
-    0x00000000002498D3ULL,
-    0x00000000002498D9ULL,
-    0x0000000000249924ULL,
-    0x0000000000249C25ULL,
-    0x0000000000249CF3ULL,
-    0x0000000000249CF9ULL,
-    0x0000000000249D01ULL,
-    0x0000000000249D14ULL,
-    0x0000000000249D99ULL,
-    0x0000000000249DF3ULL,
-    0x0000000000249DF4ULL,
-    0x000000000024A9F5ULL,
-    0x000000000024ACA4ULL,
-    0x000000000024ACB2ULL,
-    0x000000000024ACB3ULL,
-    0x000000000024AD25ULL,
-    0x000000000024B04FULL,
-    0x000000000024B059ULL,
-    0x000000000024B0A4ULL,
-    0x000000000024B0B3ULL,
-    0x000000000024B0E5ULL,
-    0x000000000024B0F9ULL,
-    0x000000000024B173ULL,
-    0x000000000024B193ULL,
-    0x000000000024B199ULL,
-    0x000000000024B428ULL,
-    0x000000000024B433ULL,
-    0x000000000024B44FULL,
-    0x000000000024B82CULL,
-    0x000000000024B889ULL,
-    0x000000000024B893ULL,
-    0x000000000024B8B2ULL,
-    0x000000000024B8B3ULL,
-    0x000000000024B8E5ULL,
-    0x000000000024B8EFULL,
-    0x000000000024B8F3ULL,
-    0x000000000024B8F9ULL,
-    0x000000000024B934ULL,
-    0x000000000024B973ULL,
-    0x000000000024BA93ULL,
-    0x000000000024BCF3ULL,
-    0x000000000024BDA5ULL,
-    0x000000000024BDD4ULL,
-    0x000000000024BE81ULL,
-    0x000000000024C0A4ULL,
-    0x000000000024C1E4ULL,
-    0x000000000024C868ULL,
-    0x000000000024C893ULL,
-    0x000000000024C973ULL,
-    0x000000000024C985ULL,
-    0x000000000024C993ULL,
-    0x000000000024C9F3ULL,
-    0x000000000024CA53ULL,
-    0x000000000024CA65ULL,
-    0x000000000024CA79ULL,
-    0x000000000024CA88ULL,
-    0x000000000024CCB3ULL,
-    0x000000000024CD73ULL,
-    0x000000000024CDEDULL,
-    0x000000000024CDEEULL,
-    0x000000000024D0B2ULL,
-    0x000000000024D0B3ULL,
-    0x000000000024D1F3ULL,
-    0x000000000024D1F5ULL,
-    0x000000000024D279ULL,
-    0x000000000024D285ULL,
-    0x000000000024D293ULL,
-    0x000000000024D299ULL,
-    0x000000000024D921ULL,
-    0x000000000024DAD9ULL,
-    0x000000000024E8B3ULL,
-    0x000000000024EB4FULL,
-    0x000000000024EB59ULL,
-    0x0000000000260453ULL,
-    0x000000000026046BULL,
-    0x0000000000260485ULL,
-    0x0000000000260493ULL,
-    0x0000000000260499ULL,
-    0x00000000002604B2ULL,
-    0x00000000002604B3ULL,
-    0x00000000002604C6ULL,
-    0x00000000002604F3ULL,
-    0x0000000000260513ULL,
-    0x000000000026052EULL,
-    0x00000000002605A5ULL,
-    0x00000000002605B3ULL,
-    0x00000000002605C4ULL,
-    0x00000000002605CBULL,
-    0x0000000000260645ULL,
-    0x0000000000260654ULL,
-    0x0000000000260665ULL,
-    0x0000000000260668ULL,
-    0x0000000000260674ULL,
-    0x0000000000260685ULL,
-    0x0000000000260693ULL,
-    0x0000000000260694ULL,
-    0x00000000002606A4ULL,
-    0x00000000002606EEULL,
-    0x00000000002606F3ULL,
-    0x0000000000260733ULL,
-    0x0000000000260745ULL,
-    0x000000000026142BULL,
-    0x0000000000261432ULL,
-    0x0000000000261434ULL,
-    0x0000000000261453ULL,
-    0x0000000000261468ULL,
-    0x00000000002614A4ULL,
-    0x00000000002614B0ULL,
-    0x00000000002614B3ULL,
-    0x00000000002615C4ULL,
-    0x00000000002615D4ULL,
-    0x0000000000261654ULL,
-    0x0000000000261673ULL,
-    0x0000000000261674ULL,
-    0x0000000000261693ULL,
-    0x0000000000261733ULL,
-    0x00000000002625B0ULL,
-    0x00000000002625B9ULL,
-    0x00000000002625C4ULL,
-    0x00000000002625C7ULL,
-    0x00000000002625C9ULL,
-    0x00000000002625CBULL,
-    0x00000000002625D3ULL,
-    0x00000000002625D9ULL,
-    0x0000000000262613ULL,
-    0x0000000000262673ULL,
-    0x0000000000262674ULL,
-    0x0000000000262685ULL,
-    0x0000000000262693ULL,
-    0x000000000026269AULL,
-    0x00000000002626C5ULL,
-    0x0000000000263C34ULL,
-    0x0000000000263C53ULL,
-    0x0000000000263C6BULL,
-    0x0000000000263C73ULL,
-    0x0000000000263CF3ULL,
-    0x0000000000263D65ULL,
-    0x0000000000263DC4ULL,
-    0x0000000000263DE4ULL,
-    0x0000000000263DEBULL,
-    0x0000000000263DEDULL,
-    0x0000000000263DF0ULL,
-    0x0000000000263E45ULL,
-    0x0000000000263E93ULL,
-    0x0000000000263EEEULL,
-    0x0000000000263EF3ULL,
-    0x0000000000263EF9ULL,
-    0x0000000000265453ULL,
-    0x0000000000265485ULL,
-    0x0000000000265493ULL,
-    0x0000000000265499ULL,
-    0x00000000002654A4ULL,
-    0x00000000002654B2ULL,
-    0x00000000002654B3ULL,
-    0x00000000002654B4ULL,
-    0x00000000002654B9ULL,
-    0x00000000002654C6ULL,
-    0x0000000000265524ULL,
-    0x00000000002655A5ULL,
-    0x00000000002655CBULL,
-    0x00000000002655D4ULL,
-    0x0000000000265642ULL,
-    0x0000000000265653ULL,
-    0x0000000000265654ULL,
-    0x0000000000265668ULL,
-    0x0000000000266605ULL,
-    0x0000000000278453ULL,
-    0x0000000000278573ULL,
-    0x0000000000278644ULL,
-    0x0000000000278653ULL,
-    0x0000000000278654ULL,
-    0x0000000000278674ULL,
-    0x0000000000278693ULL,
-    0x0000000000278823ULL,
-    0x000000000027882BULL,
-    0x0000000000278833ULL,
-    0x0000000000278859ULL,
-    0x00000000002789ECULL,
-    0x00000000002789F3ULL,
-    0x0000000000278C61ULL,
-    0x0000000000278C65ULL,
-    0x0000000000278C69ULL,
-    0x0000000000278D05ULL,
-    0x0000000000278D73ULL,
-    0x00000000002790A4ULL,
-    0x00000000002790B3ULL,
-    0x00000000002790E5ULL,
-    0x0000000000279109ULL,
-    0x0000000000279185ULL,
-    0x0000000000279613ULL,
-    0x0000000000279693ULL,
-    0x00000000002796A6ULL,
-    0x00000000002798CFULL,
-    0x00000000002798D3ULL,
-    0x0000000000279C2EULL,
-    0x0000000000279CB9ULL,
-    0x0000000000279CF9ULL,
-    0x0000000000279D25ULL,
-    0x0000000000279D85ULL,
-    0x0000000000279EA5ULL,
-    0x0000000000279EB3ULL,
-    0x000000000027A0A1ULL,
-    0x000000000027A1F3ULL,
-    0x000000000027A593ULL,
-    0x000000000027A5C7ULL,
-    0x000000000027A5CBULL,
-    0x000000000027A685ULL,
-    0x000000000027ACA4ULL,
-    0x000000000027ACA8ULL,
-    0x000000000027ACB3ULL,
-    0x000000000027ADF3ULL,
-    0x000000000027B032ULL,
-    0x000000000027B033ULL,
-    0x000000000027B093ULL,
-    0x000000000027B0B3ULL,
-    0x000000000027B138ULL,
-    0x000000000027B193ULL,
-    0x000000000027B1F3ULL,
-    0x000000000027B293ULL,
-    0x000000000027B2B3ULL,
-    0x000000000027B433ULL,
-    0x000000000027B445ULL,
-    0x000000000027B44FULL,
-    0x000000000027B453ULL,
-    0x000000000027B865ULL,
-    0x000000000027B893ULL,
-    0x000000000027B8A4ULL,
-    0x000000000027B8B2ULL,
-    0x000000000027B8B3ULL,
-    0x000000000027B8B9ULL,
-    0x000000000027B8EFULL,
-    0x000000000027B8F3ULL,
-    0x000000000027B925ULL,
-    0x000000000027B973ULL,
-    0x000000000027B9C5ULL,
-    0x000000000027B9D9ULL,
-    0x000000000027BAB3ULL,
-    0x000000000027BB41ULL,
-    0x000000000027BB45ULL,
-    0x000000000027BC29ULL,
-    0x000000000027BC39ULL,
-    0x000000000027BC53ULL,
-    0x000000000027BC59ULL,
-    0x000000000027BC99ULL,
-    0x000000000027BCA4ULL,
-    0x000000000027BCD9ULL,
-    0x000000000027BCF9ULL,
-    0x000000000027BD13ULL,
-    0x000000000027BD73ULL,
-    0x000000000027BD79ULL,
-    0x000000000027BD93ULL,
-    0x000000000027BDB3ULL,
-    0x000000000027BDB9ULL,
-    0x000000000027BDC7ULL,
-    0x000000000027BDD3ULL,
-    0x000000000027BE44ULL,
-    0x000000000027BE53ULL,
-    0x000000000027BE65ULL,
-    0x000000000027BE74ULL,
-    0x000000000027BE88ULL,
-    0x000000000027BE93ULL,
-    0x000000000027BE99ULL,
-    0x000000000027BF45ULL,
-    0x000000000027BF59ULL,
-    0x000000000027C219ULL,
-    0x000000000027C82BULL,
-    0x000000000027C82CULL,
-    0x000000000027C833ULL,
-    0x000000000027C838ULL,
-    0x000000000027C885ULL,
-    0x000000000027C893ULL,
-    0x000000000027C8A4ULL,
-    0x000000000027C8A5ULL,
-    0x000000000027C8ACULL,
-    0x000000000027C8B2ULL,
-    0x000000000027C8B3ULL,
-    0x000000000027C8EFULL,
-    0x000000000027C923ULL,
-    0x000000000027C973ULL,
-    0x000000000027C9B3ULL,
-    0x000000000027C9C1ULL,
-    0x000000000027C9C5ULL,
-    0x000000000027C9EEULL,
-    0x000000000027CA93ULL,
-    0x000000000027CA99ULL,
-    0x000000000027CA9AULL,
-    0x000000000027CD25ULL,
-    0x000000000027CD73ULL,
-    0x000000000027CD79ULL,
-    0x000000000027CDEDULL,
-    0x000000000027CDEEULL,
-    0x000000000027CE79ULL,
-    0x000000000027CEAEULL,
-    0x000000000027D033ULL,
-    0x000000000027D068ULL,
-    0x000000000027D0ACULL,
-    0x000000000027D0B3ULL,
-    0x000000000027D119ULL,
-    0x000000000027D285ULL,
-    0x000000000027D293ULL,
-    0x000000000027D299ULL,
-    0x000000000027D4E5ULL,
-    0x000000000027D4E8ULL,
-    0x000000000027D573ULL,
-    0x000000000027D585ULL,
-    0x000000000027D594ULL,
-    0x000000000027D5C4ULL,
-    0x000000000027D5D3ULL,
-    0x000000000027D644ULL,
-    0x000000000027D647ULL,
-    0x000000000027D64EULL,
-    0x000000000027D665ULL,
-    0x000000000027D679ULL,
-    0x000000000027D693ULL,
-    0x000000000027D924ULL,
-    0x000000000027DC34ULL,
-    0x000000000027DCA4ULL,
-    0x000000000027DCACULL,
-    0x000000000027DCB2ULL,
-    0x000000000027DCB3ULL,
-    0x000000000027DCB4ULL,
-    0x000000000027DD25ULL,
-    0x000000000027DD93ULL,
-    0x000000000027DDC5ULL,
-    0x000000000027DE53ULL,
-    0x000000000027DE65ULL,
-    0x000000000027E0A4ULL,
-    0x000000000027E0AEULL,
-    0x000000000027E0B2ULL,
-    0x000000000027E0B3ULL,
-    0x000000000027E181ULL,
-    0x000000000027E299ULL,
-    0x000000000027E432ULL,
-    0x000000000027E435ULL,
-    0x000000000027E4A4ULL,
-    0x000000000027E4D3ULL,
-    0x000000000027E4F3ULL,
-    0x000000000027E581ULL,
-    0x000000000027E5F3ULL,
-    0x000000000027E679ULL,
-    0x000000000027E9F3ULL,
-    0x0000000000290429ULL,
-    0x0000000000290465ULL,
-    0x0000000000290468ULL,
-    0x000000000029046BULL,
-    0x0000000000290474ULL,
-    0x0000000000290493ULL,
-    0x00000000002904B3ULL,
-    0x00000000002904F3ULL,
-    0x0000000000290524ULL,
-    0x000000000029052CULL,
-    0x000000000029052EULL,
-    0x0000000000290565ULL,
-    0x0000000000290573ULL,
-    0x0000000000290579ULL,
-    0x00000000002905A5ULL,
-    0x00000000002905C4ULL,
-    0x00000000002905C5ULL,
-    0x00000000002905CBULL,
-    0x00000000002905D3ULL,
-    0x00000000002905D4ULL,
-    0x0000000000290668ULL,
-    0x0000000000290673ULL,
-    0x0000000000290674ULL,
-    0x0000000000290693ULL,
-    0x00000000002906C1ULL,
-    0x00000000002906C5ULL,
-    0x00000000002906C9ULL,
-    0x00000000002906CFULL,
-    0x00000000002906ECULL,
-    0x00000000002906EEULL,
-    0x00000000002906F3ULL,
-    0x0000000000290719ULL,
-    0x0000000000290733ULL,
-    0x0000000000290741ULL,
-    0x0000000000290745ULL,
-    0x0000000000291424ULL,
-    0x000000000029142BULL,
-    0x000000000029142DULL,
-    0x0000000000291485ULL,
-    0x0000000000291493ULL,
-    0x00000000002914A4ULL,
-    0x00000000002914ADULL,
-    0x00000000002914B2ULL,
-    0x00000000002914B3ULL,
-    0x0000000000291524ULL,
-    0x0000000000291533ULL,
-    0x00000000002915A5ULL,
-    0x00000000002915D3ULL,
-    0x00000000002915D4ULL,
-    0x0000000000291645ULL,
-    0x0000000000291653ULL,
-    0x00000000002916C5ULL,
-    0x00000000002916F3ULL,
-    0x0000000000291733ULL,
-    0x0000000000292432ULL,
-    0x0000000000292445ULL,
-    0x000000000029246BULL,
-    0x0000000000292485ULL,
-    0x00000000002924A6ULL,
-    0x00000000002924B2ULL,
-    0x00000000002924B3ULL,
-    0x00000000002924F3ULL,
-    0x0000000000292569ULL,
-    0x0000000000292573ULL,
-    0x000000000029258CULL,
-    0x00000000002925B3ULL,
-    0x00000000002925C5ULL,
-    0x00000000002925C7ULL,
-    0x00000000002925CBULL,
-    0x00000000002925D3ULL,
-    0x00000000002925D9ULL,
-    0x00000000002925F3ULL,
-    0x0000000000292665ULL,
-    0x000000000029266BULL,
-    0x0000000000292673ULL,
-    0x0000000000292688ULL,
-    0x0000000000292693ULL,
-    0x0000000000292694ULL,
-    0x0000000000292745ULL,
-    0x0000000000293C24ULL,
-    0x0000000000293C68ULL,
-    0x0000000000293C6BULL,
-    0x0000000000293C93ULL,
-    0x0000000000293CE8ULL,
-    0x0000000000293CF3ULL,
-    0x0000000000293D2CULL,
-    0x0000000000293D65ULL,
-    0x0000000000293DA5ULL,
-    0x0000000000293DAFULL,
-    0x0000000000293DC3ULL,
-    0x0000000000293DC4ULL,
-    0x0000000000293DE4ULL,
-    0x0000000000293DEBULL,
-    0x0000000000293DECULL,
-    0x0000000000293DEDULL,
-    0x0000000000293DF3ULL,
-    0x0000000000293E65ULL,
-    0x0000000000293E79ULL,
-    0x0000000000293E88ULL,
-    0x0000000000293EEEULL,
-    0x0000000000293EF3ULL,
-    0x00000000002954E8ULL,
-    0x000000000029552EULL,
-    0x0000000000295534ULL,
-    0x0000000000295585ULL,
-    0x00000000002955A5ULL,
-    0x00000000002955C7ULL,
-    0x00000000002955D4ULL,
-    0x0000000000295668ULL,
-    0x000000000029566BULL,
-    0x0000000000295674ULL,
-    0x0000000000295685ULL,
-    0x0000000000295693ULL,
-    0x00000000002A8693ULL,
-    0x00000000002A8745ULL,
-    0x00000000002A882CULL,
-    0x00000000002A8833ULL,
-    0x00000000002A8841ULL,
-    0x00000000002A8845ULL,
-    0x00000000002A8859ULL,
-    0x00000000002A8AB3ULL,
-    0x00000000002A8D15ULL,
-    0x00000000002A8D6FULL,
-    0x00000000002A8D73ULL,
-    0x00000000002A8D75ULL,
-    0x00000000002A9033ULL,
-    0x00000000002A9099ULL,
-    0x00000000002A90E5ULL,
-    0x00000000002A9133ULL,
-    0x00000000002A91F3ULL,
-    0x00000000002A98C1ULL,
-    0x00000000002A98C5ULL,
-    0x00000000002A98C9ULL,
-    0x00000000002A98CFULL,
-    0x00000000002A98D3ULL,
-    0x00000000002A98D9ULL,
-    0x00000000002A99F3ULL,
-    0x00000000002A9A99ULL,
-    0x00000000002A9CF9ULL,
-    0x00000000002A9D85ULL,
-    0x00000000002AA193ULL,
-    0x00000000002AA253ULL,
-    0x00000000002AA573ULL,
-    0x00000000002AA584ULL,
-    0x00000000002AA594ULL,
-    0x00000000002AA674ULL,
-    0x00000000002AACB3ULL,
-    0x00000000002AB053ULL,
-    0x00000000002AB0E5ULL,
-    0x00000000002AB0F9ULL,
-    0x00000000002AB173ULL,
-    0x00000000002AB179ULL,
-    0x00000000002AB181ULL,
-    0x00000000002AB193ULL,
-    0x00000000002AB199ULL,
-    0x00000000002AB265ULL,
-    0x00000000002AB44FULL,
-    0x00000000002AB4D3ULL,
-    0x00000000002AB608ULL,
-    0x00000000002AB613ULL,
-    0x00000000002AB619ULL,
-    0x00000000002AB833ULL,
-    0x00000000002AB865ULL,
-    0x00000000002AB868ULL,
-    0x00000000002AB86FULL,
-    0x00000000002AB885ULL,
-    0x00000000002AB888ULL,
-    0x00000000002AB893ULL,
-    0x00000000002AB894ULL,
-    0x00000000002AB895ULL,
-    0x00000000002AB899ULL,
-    0x00000000002AB8F3ULL,
-    0x00000000002AB8F9ULL,
-    0x00000000002AB921ULL,
-    0x00000000002AB945ULL,
-    0x00000000002AB959ULL,
-    0x00000000002AB96FULL,
-    0x00000000002AB973ULL,
-    0x00000000002AB9D3ULL,
-    0x00000000002AB9D9ULL,
-    0x00000000002ABA93ULL,
-    0x00000000002ABA99ULL,
-    0x00000000002ABB21ULL,
-    0x00000000002ABF33ULL,
-    0x00000000002AC219ULL,
-    0x00000000002AC82EULL,
-    0x00000000002AC833ULL,
-    0x00000000002AC853ULL,
-    0x00000000002AC893ULL,
-    0x00000000002AC8B4ULL,
-    0x00000000002AC8C9ULL,
-    0x00000000002AC8E8ULL,
-    0x00000000002AC8F3ULL,
-    0x00000000002AC92EULL,
-    0x00000000002AC961ULL,
-    0x00000000002AC965ULL,
-    0x00000000002AC973ULL,
-    0x00000000002AC993ULL,
-    0x00000000002AC999ULL,
-    0x00000000002AC9D3ULL,
-    0x00000000002AC9D4ULL,
-    0x00000000002AC9EFULL,
-    0x00000000002ACA13ULL,
-    0x00000000002ACA21ULL,
-    0x00000000002ACA4FULL,
-    0x00000000002ACA53ULL,
-    0x00000000002ACA59ULL,
-    0x00000000002ACA61ULL,
-    0x00000000002ACA65ULL,
-    0x00000000002ACA74ULL,
-    0x00000000002ACC59ULL,
-    0x00000000002ACCA4ULL,
-    0x00000000002ACCB3ULL,
-    0x00000000002ACD19ULL,
-    0x00000000002ACD73ULL,
-    0x00000000002ACD79ULL,
-    0x00000000002ACE75ULL,
-    0x00000000002ACE89ULL,
-    0x00000000002ACE93ULL,
-    0x00000000002ACE99ULL,
-    0x00000000002AD068ULL,
-    0x00000000002AD0AFULL,
-    0x00000000002AD0B3ULL,
-    0x00000000002AD185ULL,
-    0x00000000002AD1E8ULL,
-    0x00000000002AD285ULL,
-    0x00000000002AD293ULL,
-    0x00000000002AD299ULL,
-    0x00000000002AD2B4ULL,
-    0x00000000002AD32CULL,
-    0x00000000002AE1EDULL,
-    0x00000000002AE4B2ULL,
-    0x00000000002AEB59ULL,
-    0x00000000002B85C1ULL,
-    0x00000000002B8749ULL,
-    0x00000000002C90A4ULL,
-    0x00000000002C90B3ULL,
-    0x00000000002CACA4ULL,
-    0x00000000002CACB3ULL,
-    0x00000000002CB037ULL,
-    0x00000000002CC8B3ULL,
-    0x00000000002CC993ULL,
-    0x00000000002CCE69ULL,
-    0x00000000002CD0B3ULL,
-    0x00000000002CDC39ULL,
-    0x00000000003084A4ULL,
-    0x000000000030882CULL,
-    0x0000000000308833ULL,
-    0x0000000000308859ULL,
-    0x00000000003088B2ULL,
-    0x000000000030892EULL,
-    0x0000000000308985ULL,
-    0x00000000003089E2ULL,
-    0x00000000003089E3ULL,
-    0x0000000000308A45ULL,
-    0x0000000000308C2FULL,
-    0x0000000000308C33ULL,
-    0x0000000000308D05ULL,
-    0x0000000000308D73ULL,
-    0x0000000000308D79ULL,
-    0x0000000000308E89ULL,
-    0x0000000000309099ULL,
-    0x00000000003090A5ULL,
-    0x00000000003090B3ULL,
-    0x00000000003090B4ULL,
-    0x00000000003090E5ULL,
-    0x00000000003090F9ULL,
-    0x0000000000309125ULL,
-    0x0000000000309133ULL,
-    0x0000000000309245ULL,
-    0x0000000000309461ULL,
-    0x0000000000309665ULL,
-    0x00000000003098B3ULL,
-    0x00000000003098D3ULL,
-    0x0000000000309CA4ULL,
-    0x0000000000309CB2ULL,
-    0x0000000000309CB3ULL,
-    0x0000000000309CB9ULL,
-    0x0000000000309DF4ULL,
-    0x000000000030A1F7ULL,
-    0x000000000030A493ULL,
-    0x000000000030A5D3ULL,
-    0x000000000030A644ULL,
-    0x000000000030A64EULL,
-    0x000000000030A9EEULL,
-    0x000000000030AAAEULL,
-    0x000000000030ACA4ULL,
-    0x000000000030ACB3ULL,
-    0x000000000030ACB9ULL,
-    0x000000000030B0D3ULL,
-    0x000000000030B124ULL,
-    0x000000000030B126ULL,
-    0x000000000030B138ULL,
-    0x000000000030B173ULL,
-    0x000000000030B181ULL,
-    0x000000000030B193ULL,
-    0x000000000030B1B3ULL,
-    0x000000000030B1B9ULL,
-    0x000000000030B1F3ULL,
-    0x000000000030B201ULL,
-    0x000000000030B213ULL,
-    0x000000000030B2C5ULL,
-    0x000000000030B338ULL,
-    0x000000000030B42EULL,
-    0x000000000030B433ULL,
-    0x000000000030B4ACULL,
-    0x000000000030B4AFULL,
-    0x000000000030B4B3ULL,
-    0x000000000030B533ULL,
-    0x000000000030B5F3ULL,
-    0x000000000030B609ULL,
-    0x000000000030B60FULL,
-    0x000000000030B613ULL,
-    0x000000000030B619ULL,
-    0x000000000030B6B3ULL,
-    0x000000000030B82CULL,
-    0x000000000030B899ULL,
-    0x000000000030B8A4ULL,
-    0x000000000030B8A8ULL,
-    0x000000000030B8B2ULL,
-    0x000000000030B8B3ULL,
-    0x000000000030B8F3ULL,
-    0x000000000030B924ULL,
-    0x000000000030B9C1ULL,
-    0x000000000030B9D3ULL,
-    0x000000000030B9D9ULL,
-    0x000000000030B9E5ULL,
-    0x000000000030B9EEULL,
-    0x000000000030BA6FULL,
-    0x000000000030BA74ULL,
-    0x000000000030BA8FULL,
-    0x000000000030BA93ULL,
-    0x000000000030BA99ULL,
-    0x000000000030C033ULL,
-    0x000000000030C0A4ULL,
-    0x000000000030C0B2ULL,
-    0x000000000030C0B3ULL,
-    0x000000000030C0B8ULL,
-    0x000000000030C113ULL,
-    0x000000000030C13AULL,
-    0x000000000030C185ULL,
-    0x000000000030C1EEULL,
-    0x000000000030C1F3ULL,
-    0x000000000030C1F4ULL,
-    0x000000000030C249ULL,
-    0x000000000030C2ACULL,
-    0x000000000030C2B4ULL,
-    0x000000000030C830ULL,
-    0x000000000030C834ULL,
-    0x000000000030C84FULL,
-    0x000000000030C853ULL,
-    0x000000000030C859ULL,
-    0x000000000030C889ULL,
-    0x000000000030C893ULL,
-    0x000000000030C899ULL,
-    0x000000000030C8A4ULL,
-    0x000000000030C8B2ULL,
-    0x000000000030C8B3ULL,
-    0x000000000030C8B4ULL,
-    0x000000000030C8B8ULL,
-    0x000000000030C8EFULL,
-    0x000000000030C973ULL,
-    0x000000000030C985ULL,
-    0x000000000030C993ULL,
-    0x000000000030C9D3ULL,
-    0x000000000030C9D9ULL,
-    0x000000000030C9E2ULL,
-    0x000000000030C9ECULL,
-    0x000000000030C9EDULL,
-    0x000000000030C9EEULL,
-    0x000000000030CA09ULL,
-    0x000000000030CA13ULL,
-    0x000000000030CA53ULL,
-    0x000000000030CA59ULL,
-    0x000000000030CA65ULL,
-    0x000000000030CA81ULL,
-    0x000000000030CA85ULL,
-    0x000000000030CA93ULL,
-    0x000000000030CAC5ULL,
-    0x000000000030CAD9ULL,
-    0x000000000030CC33ULL,
-    0x000000000030CC6FULL,
-    0x000000000030CCA4ULL,
-    0x000000000030CCB3ULL,
-    0x000000000030CD73ULL,
-    0x000000000030CD79ULL,
-    0x000000000030CE85ULL,
-    0x000000000030CE93ULL,
-    0x000000000030CEB3ULL,
-    0x000000000030D068ULL,
-    0x000000000030D0B2ULL,
-    0x000000000030D0B3ULL,
-    0x000000000030D299ULL,
-    0x000000000030D481ULL,
-    0x000000000030D573ULL,
-    0x000000000030D584ULL,
-    0x000000000030D58BULL,
-    0x000000000030D593ULL,
-    0x000000000030D5B3ULL,
-    0x000000000030D613ULL,
-    0x000000000030D649ULL,
-    0x000000000030D661ULL,
-    0x000000000030D665ULL,
-    0x000000000030D833ULL,
-    0x000000000030D8A4ULL,
-    0x000000000030D8ACULL,
-    0x000000000030D8B2ULL,
-    0x000000000030D8B3ULL,
-    0x000000000030D925ULL,
-    0x000000000030D92CULL,
-    0x000000000030DCA4ULL,
-    0x000000000030DD73ULL,
-    0x000000000030E1EEULL,
-    0x0000000000328665ULL,
-    0x0000000000328745ULL,
-    0x0000000000328924ULL,
-    0x0000000000328C2CULL,
-    0x0000000000328EADULL,
-    0x0000000000329032ULL,
-    0x00000000003290A4ULL,
-    0x00000000003290B2ULL,
-    0x00000000003290B3ULL,
-    0x0000000000329133ULL,
-    0x000000000032A441ULL,
-    0x000000000032A589ULL,
-    0x000000000032A593ULL,
-    0x000000000032B0A2ULL,
-    0x000000000032B181ULL,
-    0x000000000032B189ULL,
-    0x000000000032B18FULL,
-    0x000000000032B193ULL,
-    0x000000000032B1EDULL,
-    0x000000000032B293ULL,
-    0x000000000032BA65ULL,
-    0x000000000032BA8FULL,
-    0x000000000032BA93ULL,
-    0x000000000032BA95ULL,
-    0x000000000032BE4CULL,
-    0x000000000032C0B3ULL,
-    0x000000000032C869ULL,
-    0x000000000032C8A4ULL,
-    0x000000000032C8B3ULL,
-    0x000000000032C8E5ULL,
-    0x000000000032C921ULL,
-    0x000000000032C923ULL,
-    0x000000000032C9C5ULL,
-    0x000000000032C9E3ULL,
-    0x000000000032C9F3ULL,
-    0x000000000032CA93ULL,
-    0x000000000032CA99ULL,
-    0x000000000032CE65ULL,
-    0x000000000032CE81ULL,
-    0x000000000032CE89ULL,
-    0x000000000032D0B3ULL,
-    0x000000000032D32CULL,
-    0x000000000032EAC5ULL,
-    0x0000000000340465ULL,
-    0x000000000034046BULL,
-    0x000000000034046FULL,
-    0x000000000034048FULL,
-    0x0000000000340493ULL,
-    0x00000000003404C5ULL,
-    0x00000000003404C6ULL,
-    0x00000000003404D4ULL,
-    0x000000000034052EULL,
-    0x0000000000340532ULL,
-    0x0000000000340533ULL,
-    0x000000000034058BULL,
-    0x0000000000340593ULL,
-    0x00000000003405B0ULL,
-    0x00000000003405B3ULL,
-    0x00000000003405C1ULL,
-    0x00000000003405C7ULL,
-    0x00000000003405CBULL,
-    0x00000000003405D4ULL,
-    0x00000000003405F3ULL,
-    0x0000000000340605ULL,
-    0x0000000000340613ULL,
-    0x0000000000340614ULL,
-    0x0000000000340641ULL,
-    0x0000000000340644ULL,
-    0x0000000000340645ULL,
-    0x000000000034064BULL,
-    0x000000000034064DULL,
-    0x0000000000340652ULL,
-    0x0000000000340653ULL,
-    0x0000000000340654ULL,
-    0x0000000000340659ULL,
-    0x0000000000340665ULL,
-    0x000000000034066DULL,
-    0x0000000000340693ULL,
-    0x00000000003406C5ULL,
-    0x00000000003406D3ULL,
-    0x00000000003406EBULL,
-    0x00000000003406F3ULL,
-    0x0000000000340721ULL,
-    0x0000000000340733ULL,
-    0x0000000000341430ULL,
-    0x0000000000341434ULL,
-    0x000000000034146BULL,
-    0x00000000003414ABULL,
-    0x00000000003414B0ULL,
-    0x00000000003414B2ULL,
-    0x00000000003414D3ULL,
-    0x0000000000341561ULL,
-    0x0000000000341581ULL,
-    0x0000000000341590ULL,
-    0x00000000003415AFULL,
-    0x00000000003415B3ULL,
-    0x0000000000341645ULL,
-    0x0000000000341654ULL,
-    0x0000000000341673ULL,
-    0x0000000000341674ULL,
-    0x0000000000341688ULL,
-    0x00000000003416D9ULL,
-    0x00000000003416F3ULL,
-    0x00000000003416F9ULL,
-    0x000000000034242FULL,
-    0x0000000000342433ULL,
-    0x0000000000342453ULL,
-    0x0000000000342461ULL,
-    0x0000000000342468ULL,
-    0x000000000034246BULL,
-    0x000000000034246FULL,
-    0x0000000000342473ULL,
-    0x0000000000342485ULL,
-    0x00000000003424A6ULL,
-    0x00000000003424ACULL,
-    0x0000000000342573ULL,
-    0x0000000000342584ULL,
-    0x0000000000342585ULL,
-    0x0000000000342589ULL,
-    0x000000000034258CULL,
-    0x00000000003425A2ULL,
-    0x00000000003425A5ULL,
-    0x00000000003425AFULL,
-    0x00000000003425B0ULL,
-    0x00000000003425C1ULL,
-    0x00000000003425C5ULL,
-    0x00000000003425C7ULL,
-    0x00000000003425CFULL,
-    0x00000000003425D3ULL,
-    0x0000000000342613ULL,
-    0x000000000034264BULL,
-    0x000000000034264CULL,
-    0x000000000034264DULL,
-    0x000000000034264FULL,
-    0x0000000000342650ULL,
-    0x0000000000342652ULL,
-    0x0000000000342654ULL,
-    0x0000000000342655ULL,
-    0x0000000000342693ULL,
-    0x00000000003426C5ULL,
-    0x00000000003426D3ULL,
-    0x00000000003426D9ULL,
-    0x000000000034275AULL,
-    0x0000000000343C6BULL,
-    0x0000000000343C6FULL,
-    0x0000000000343C73ULL,
-    0x0000000000343C85ULL,
-    0x0000000000343CF3ULL,
-    0x0000000000343D2CULL,
-    0x0000000000343D32ULL,
-    0x0000000000343D65ULL,
-    0x0000000000343D6FULL,
-    0x0000000000343D79ULL,
-    0x0000000000343D81ULL,
-    0x0000000000343D89ULL,
-    0x0000000000343D8FULL,
-    0x0000000000343DB0ULL,
-    0x0000000000343DD3ULL,
-    0x0000000000343DE6ULL,
-    0x0000000000343DEBULL,
-    0x0000000000343DEDULL,
-    0x0000000000343DEEULL,
-    0x0000000000343E13ULL,
-    0x0000000000343E44ULL,
-    0x0000000000343E45ULL,
-    0x0000000000343E65ULL,
-    0x0000000000343E81ULL,
-    0x0000000000343E94ULL,
-    0x0000000000343EB4ULL,
-    0x0000000000343EB8ULL,
-    0x0000000000343EEBULL,
-    0x0000000000343EF3ULL,
-    0x0000000000345453ULL,
-    0x000000000034546BULL,
-    0x00000000003454C1ULL,
-    0x00000000003454C6ULL,
-    0x00000000003454F3ULL,
-    0x00000000003455B0ULL,
-    0x00000000003455B3ULL,
-    0x00000000003455CBULL,
-    0x000000000034564CULL,
-    0x000000000034564EULL,
-    0x0000000000345652ULL,
-    0x0000000000345665ULL,
-    0x0000000000345685ULL,
-    0x0000000000345693ULL,
-    0x0000000000346585ULL,
-    0x00000000003465A5ULL,
-    0x00000000003465C4ULL,
-    0x00000000003489ECULL,
-    0x00000000003490A4ULL,
-    0x00000000003490B2ULL,
-    0x00000000003490B3ULL,
-    0x0000000000349593ULL,
-    0x0000000000349C32ULL,
-    0x0000000000349CF9ULL,
-    0x000000000034B121ULL,
-    0x000000000034B193ULL,
-    0x000000000034B432ULL,
-    0x000000000034B4B8ULL,
-    0x000000000034B868ULL,
-    0x000000000034B874ULL,
-    0x000000000034B8B3ULL,
-    0x000000000034BA33ULL,
-    0x000000000034BDD3ULL,
-    0x000000000034C209ULL,
-    0x000000000034C861ULL,
-    0x000000000034C873ULL,
-    0x000000000034C8B3ULL,
-    0x000000000034C993ULL,
-    0x000000000034CA49ULL,
-    0x000000000034CC6FULL,
-    0x000000000034CE79ULL,
-    0x000000000034CE93ULL,
-    0x000000000034D02CULL,
-    0x000000000034D0A4ULL,
-    0x000000000034D0B2ULL,
-    0x000000000034D0B3ULL,
-    0x000000000034D8B3ULL,
-    0x000000000034D8B4ULL,
-    0x000000000034D923ULL,
-    0x000000000034D925ULL,
-    0x000000000034D92CULL,
-    0x000000000034DAD9ULL,
-    0x0000000000360468ULL,
-    0x000000000036046BULL,
-    0x0000000000360485ULL,
-    0x0000000000360493ULL,
-    0x00000000003604B3ULL,
-    0x00000000003604F3ULL,
-    0x000000000036052DULL,
-    0x00000000003605A5ULL,
-    0x00000000003605B0ULL,
-    0x00000000003605B3ULL,
-    0x00000000003605C7ULL,
-    0x00000000003605CBULL,
-    0x00000000003605D3ULL,
-    0x0000000000360613ULL,
-    0x0000000000360614ULL,
-    0x000000000036064FULL,
-    0x0000000000360654ULL,
-    0x0000000000360659ULL,
-    0x0000000000360668ULL,
-    0x0000000000360670ULL,
-    0x0000000000360673ULL,
-    0x0000000000360674ULL,
-    0x0000000000360693ULL,
-    0x00000000003606B4ULL,
-    0x00000000003606C5ULL,
-    0x00000000003606C9ULL,
-    0x00000000003606F3ULL,
-    0x0000000000360733ULL,
-    0x000000000036142EULL,
-    0x0000000000361432ULL,
-    0x0000000000361434ULL,
-    0x000000000036146BULL,
-    0x00000000003614ABULL,
-    0x00000000003614B0ULL,
-    0x00000000003614D3ULL,
-    0x00000000003614D4ULL,
-    0x00000000003614F3ULL,
-    0x000000000036152BULL,
-    0x00000000003615B3ULL,
-    0x0000000000361605ULL,
-    0x0000000000361614ULL,
-    0x000000000036164BULL,
-    0x00000000003616C5ULL,
-    0x00000000003616F3ULL,
-    0x000000000036246BULL,
-    0x00000000003624A4ULL,
-    0x00000000003624B3ULL,
-    0x00000000003624C6ULL,
-    0x00000000003624D4ULL,
-    0x00000000003625A2ULL,
-    0x00000000003625A5ULL,
-    0x00000000003625C5ULL,
-    0x00000000003625C7ULL,
-    0x00000000003625CBULL,
-    0x00000000003625D4ULL,
-    0x0000000000362605ULL,
-    0x0000000000362613ULL,
-    0x0000000000362614ULL,
-    0x0000000000362693ULL,
-    0x0000000000363C2BULL,
-    0x0000000000363C2DULL,
-    0x0000000000363C6BULL,
-    0x0000000000363C93ULL,
-    0x0000000000363CC6ULL,
-    0x0000000000363CF3ULL,
-    0x0000000000363D65ULL,
-    0x0000000000363DA2ULL,
-    0x0000000000363DB0ULL,
-    0x0000000000363DC5ULL,
-    0x0000000000363DCBULL,
-    0x0000000000363DD3ULL,
-    0x0000000000363DF0ULL,
-    0x0000000000363DF4ULL,
-    0x0000000000363E13ULL,
-    0x0000000000363E65ULL,
-    0x0000000000363E85ULL,
-    0x0000000000363E88ULL,
-    0x0000000000363E93ULL,
-    0x0000000000363EA4ULL,
-    0x0000000000363EB2ULL,
-    0x0000000000363EB3ULL,
-    0x0000000000363EB4ULL,
-    0x0000000000363EC5ULL,
-    0x0000000000363EEEULL,
-    0x0000000000363EF3ULL,
-    0x0000000000363F25ULL,
-    0x0000000000363F33ULL,
-    0x0000000000363F45ULL,
-    0x0000000000365453ULL,
-    0x000000000036546BULL,
-    0x00000000003654A4ULL,
-    0x00000000003654B3ULL,
-    0x00000000003654B9ULL,
-    0x00000000003655B0ULL,
-    0x00000000003655C7ULL,
-    0x00000000003655CBULL,
-    0x0000000000366605ULL,
-    0x0000000000372481ULL,
-    0x0000000000378468ULL,
-    0x0000000000378474ULL,
-    0x0000000000378499ULL,
-    0x0000000000378581ULL,
-    0x0000000000378593ULL,
-    0x0000000000378599ULL,
-    0x0000000000378614ULL,
-    0x0000000000378642ULL,
-    0x0000000000378674ULL,
-    0x0000000000378685ULL,
-    0x0000000000378689ULL,
-    0x0000000000378693ULL,
-    0x0000000000378853ULL,
-    0x0000000000378859ULL,
-    0x0000000000378921ULL,
-    0x0000000000378985ULL,
-    0x0000000000378A41ULL,
-    0x0000000000378B41ULL,
-    0x0000000000378C33ULL,
-    0x0000000000378C69ULL,
-    0x0000000000378C6FULL,
-    0x0000000000378D73ULL,
-    0x0000000000378D79ULL,
-    0x0000000000378DE1ULL,
-    0x0000000000378DF3ULL,
-    0x0000000000379033ULL,
-    0x00000000003790A3ULL,
-    0x00000000003790A4ULL,
-    0x00000000003790AEULL,
-    0x00000000003790B2ULL,
-    0x00000000003790B3ULL,
-    0x00000000003790B8ULL,
-    0x00000000003791EEULL,
-    0x0000000000379493ULL,
-    0x00000000003798D3ULL,
-    0x0000000000379D25ULL,
-    0x0000000000379DEEULL,
-    0x0000000000379EA5ULL,
-    0x000000000037A022ULL,
-    0x000000000037A0AEULL,
-    0x000000000037A1E5ULL,
-    0x000000000037A1E7ULL,
-    0x000000000037A1F3ULL,
-    0x000000000037A4D3ULL,
-    0x000000000037A4EEULL,
-    0x000000000037A593ULL,
-    0x000000000037A5D3ULL,
-    0x000000000037A653ULL,
-    0x000000000037A693ULL,
-    0x000000000037ACA4ULL,
-    0x000000000037ACB3ULL,
-    0x000000000037B033ULL,
-    0x000000000037B059ULL,
-    0x000000000037B093ULL,
-    0x000000000037B0A4ULL,
-    0x000000000037B0B3ULL,
-    0x000000000037B0B9ULL,
-    0x000000000037B123ULL,
-    0x000000000037B12EULL,
-    0x000000000037B193ULL,
-    0x000000000037B199ULL,
-    0x000000000037B1E7ULL,
-    0x000000000037B1EEULL,
-    0x000000000037B1F2ULL,
-    0x000000000037B293ULL,
-    0x000000000037B341ULL,
-    0x000000000037B425ULL,
-    0x000000000037B42CULL,
-    0x000000000037B433ULL,
-    0x000000000037B445ULL,
-    0x000000000037B449ULL,
-    0x000000000037B44FULL,
-    0x000000000037B453ULL,
-    0x000000000037B459ULL,
-    0x000000000037B4B2ULL,
-    0x000000000037B4B3ULL,
-    0x000000000037B4B4ULL,
-    0x000000000037B4D9ULL,
-    0x000000000037B523ULL,
-    0x000000000037B538ULL,
-    0x000000000037B5A1ULL,
-    0x000000000037B5AFULL,
-    0x000000000037B5B3ULL,
-    0x000000000037B5B9ULL,
-    0x000000000037B60FULL,
-    0x000000000037B613ULL,
-    0x000000000037B614ULL,
-    0x000000000037B685ULL,
-    0x000000000037B6B3ULL,
-    0x000000000037B868ULL,
-    0x000000000037B88FULL,
-    0x000000000037B8A4ULL,
-    0x000000000037B8B3ULL,
-    0x000000000037B8B9ULL,
-    0x000000000037B8D3ULL,
-    0x000000000037B8E1ULL,
-    0x000000000037B8E5ULL,
-    0x000000000037B8EFULL,
-    0x000000000037B921ULL,
-    0x000000000037B923ULL,
-    0x000000000037B92EULL,
-    0x000000000037B973ULL,
-    0x000000000037B979ULL,
-    0x000000000037B9C5ULL,
-    0x000000000037B9D3ULL,
-    0x000000000037BA85ULL,
-    0x000000000037BA8FULL,
-    0x000000000037BAB3ULL,
-    0x000000000037BACFULL,
-    0x000000000037BC68ULL,
-    0x000000000037BCA4ULL,
-    0x000000000037BCA5ULL,
-    0x000000000037BCB2ULL,
-    0x000000000037BCB9ULL,
-    0x000000000037BCD3ULL,
-    0x000000000037BD73ULL,
-    0x000000000037BD79ULL,
-    0x000000000037BD93ULL,
-    0x000000000037BD99ULL,
-    0x000000000037BDA2ULL,
-    0x000000000037BDB3ULL,
-    0x000000000037BDB9ULL,
-    0x000000000037BE13ULL,
-    0x000000000037BE14ULL,
-    0x000000000037BE74ULL,
-    0x000000000037BE93ULL,
-    0x000000000037BF45ULL,
-    0x000000000037C02CULL,
-    0x000000000037C039ULL,
-    0x000000000037C0A4ULL,
-    0x000000000037C0AEULL,
-    0x000000000037C0B2ULL,
-    0x000000000037C0B3ULL,
-    0x000000000037C219ULL,
-    0x000000000037C241ULL,
-    0x000000000037C265ULL,
-    0x000000000037C279ULL,
-    0x000000000037C6A9ULL,
-    0x000000000037C82CULL,
-    0x000000000037C82DULL,
-    0x000000000037C845ULL,
-    0x000000000037C859ULL,
-    0x000000000037C893ULL,
-    0x000000000037C8A4ULL,
-    0x000000000037C8B2ULL,
-    0x000000000037C8B3ULL,
-    0x000000000037C8B9ULL,
-    0x000000000037C8E9ULL,
-    0x000000000037C921ULL,
-    0x000000000037C973ULL,
-    0x000000000037C979ULL,
-    0x000000000037C9B3ULL,
-    0x000000000037C9C9ULL,
-    0x000000000037C9CFULL,
-    0x000000000037C9D3ULL,
-    0x000000000037C9D5ULL,
-    0x000000000037C9D9ULL,
-    0x000000000037CA13ULL,
-    0x000000000037CA65ULL,
-    0x000000000037CA6FULL,
-    0x000000000037CCA3ULL,
-    0x000000000037CCA4ULL,
-    0x000000000037CCB3ULL,
-    0x000000000037CCB4ULL,
-    0x000000000037CCB9ULL,
-    0x000000000037CD25ULL,
-    0x000000000037CE81ULL,
-    0x000000000037CE85ULL,
-    0x000000000037CE93ULL,
-    0x000000000037D02EULL,
-    0x000000000037D0A4ULL,
-    0x000000000037D0B3ULL,
-    0x000000000037D113ULL,
-    0x000000000037D281ULL,
-    0x000000000037D293ULL,
-    0x000000000037D468ULL,
-    0x000000000037D485ULL,
-    0x000000000037D4E8ULL,
-    0x000000000037D584ULL,
-    0x000000000037D5D4ULL,
-    0x000000000037D605ULL,
-    0x000000000037D613ULL,
-    0x000000000037D642ULL,
-    0x000000000037D644ULL,
-    0x000000000037D645ULL,
-    0x000000000037D653ULL,
-    0x000000000037D654ULL,
-    0x000000000037D681ULL,
-    0x000000000037D688ULL,
-    0x000000000037D8A4ULL,
-    0x000000000037D8AEULL,
-    0x000000000037D8B2ULL,
-    0x000000000037D8B3ULL,
-    0x000000000037D8B4ULL,
-    0x000000000037D8B9ULL,
-    0x000000000037D92EULL,
-    0x000000000037DC2CULL,
-    0x000000000037DC2EULL,
-    0x000000000037DCA4ULL,
-    0x000000000037DCB2ULL,
-    0x000000000037DD73ULL,
-    0x000000000037DD93ULL,
-    0x000000000037DE13ULL,
-    0x000000000037DE59ULL,
-    0x000000000037E025ULL,
-    0x000000000037E02CULL,
-    0x000000000037E0A4ULL,
-    0x000000000037E0B3ULL,
-    0x000000000037E122ULL,
-    0x000000000037E435ULL,
-    0x000000000037E4A4ULL,
-    0x000000000037E4B2ULL,
-    0x000000000037E599ULL,
-    0x000000000037E615ULL,
-    0x000000000037E8A4ULL,
-    0x000000000037E8AEULL,
-    0x000000000037E8B3ULL,
-    0x000000000037E8B9ULL,
-    0x000000000037E925ULL,
-    0x000000000039042CULL,
-    0x0000000000390453ULL,
-    0x000000000039046BULL,
-    0x00000000003904D4ULL,
-    0x00000000003904F3ULL,
-    0x0000000000390523ULL,
-    0x0000000000390527ULL,
-    0x0000000000390565ULL,
-    0x00000000003905A5ULL,
-    0x00000000003905B0ULL,
-    0x00000000003905B3ULL,
-    0x00000000003905C5ULL,
-    0x00000000003905CBULL,
-    0x00000000003905D3ULL,
-    0x0000000000390605ULL,
-    0x0000000000390613ULL,
-    0x0000000000390619ULL,
-    0x0000000000390645ULL,
-    0x0000000000390668ULL,
-    0x0000000000390673ULL,
-    0x0000000000390685ULL,
-    0x00000000003906C5ULL,
-    0x00000000003906ECULL,
-    0x00000000003906F3ULL,
-    0x0000000000390733ULL,
-    0x0000000000390745ULL,
-    0x0000000000390759ULL,
-    0x000000000039142BULL,
-    0x000000000039142DULL,
-    0x000000000039148FULL,
-    0x0000000000391493ULL,
-    0x00000000003914A4ULL,
-    0x00000000003914ABULL,
-    0x00000000003914ACULL,
-    0x00000000003914B0ULL,
-    0x00000000003914B3ULL,
-    0x00000000003915A5ULL,
-    0x00000000003915B3ULL,
-    0x00000000003915C1ULL,
-    0x0000000000391605ULL,
-    0x0000000000391613ULL,
-    0x0000000000391614ULL,
-    0x0000000000391619ULL,
-    0x0000000000391673ULL,
-    0x0000000000391674ULL,
-    0x00000000003916E5ULL,
-    0x00000000003916F3ULL,
-    0x0000000000392433ULL,
-    0x0000000000392453ULL,
-    0x000000000039246BULL,
-    0x00000000003924A4ULL,
-    0x00000000003924B2ULL,
-    0x00000000003924B3ULL,
-    0x00000000003925A5ULL,
-    0x00000000003925B0ULL,
-    0x00000000003925B3ULL,
-    0x00000000003925C5ULL,
-    0x00000000003925F3ULL,
-    0x0000000000392605ULL,
-    0x0000000000392613ULL,
-    0x0000000000392665ULL,
-    0x0000000000392670ULL,
-    0x0000000000392688ULL,
-    0x0000000000392693ULL,
-    0x0000000000393C2BULL,
-    0x0000000000393C69ULL,
-    0x0000000000393C6BULL,
-    0x0000000000393C73ULL,
-    0x0000000000393CD4ULL,
-    0x0000000000393CF3ULL,
-    0x0000000000393DA2ULL,
-    0x0000000000393DA5ULL,
-    0x0000000000393DC5ULL,
-    0x0000000000393DCBULL,
-    0x0000000000393DD3ULL,
-    0x0000000000393DD9ULL,
-    0x0000000000393DEBULL,
-    0x0000000000393DECULL,
-    0x0000000000393DEEULL,
-    0x0000000000393E13ULL,
-    0x0000000000393E45ULL,
-    0x0000000000393E73ULL,
-    0x0000000000393E74ULL,
-    0x0000000000393EB0ULL,
-    0x0000000000393EB4ULL,
-    0x0000000000393EE4ULL,
-    0x0000000000393EEEULL,
-    0x0000000000393EF3ULL,
-    0x0000000000393F45ULL,
-    0x000000000039546BULL,
-    0x0000000000395485ULL,
-    0x000000000039548FULL,
-    0x0000000000395493ULL,
-    0x0000000000395499ULL,
-    0x00000000003954ACULL,
-    0x00000000003954B3ULL,
-    0x00000000003954B4ULL,
-    0x00000000003954D4ULL,
-    0x00000000003955A2ULL,
-    0x00000000003955B0ULL,
-    0x00000000003955CBULL,
-    0x00000000003955F2ULL,
-    0x0000000000395641ULL,
-    0x0000000000395665ULL,
-    0x0000000000395668ULL,
-    0x0000000000395674ULL,
-    0x0000000000395679ULL,
-    0x00000000003956C5ULL,
-    0x0000000000395E88ULL,
-    0x00000000003964B2ULL,
-    0x0000000000396614ULL,
-    0x00000000003A15C5ULL,
-    0x00000000003A8859ULL,
-    0x00000000003A88A2ULL,
-    0x00000000003A88A4ULL,
-    0x00000000003A88B2ULL,
-    0x00000000003A88B3ULL,
-    0x00000000003A8923ULL,
-    0x00000000003A8934ULL,
-    0x00000000003A9099ULL,
-    0x00000000003A98CFULL,
-    0x00000000003A98D3ULL,
-    0x00000000003AA4D3ULL,
-    0x00000000003AA5C7ULL,
-    0x00000000003AA668ULL,
-    0x00000000003AA693ULL,
-    0x00000000003AACB3ULL,
-    0x00000000003AB068ULL,
-    0x00000000003AB0B4ULL,
-    0x00000000003AB0B8ULL,
-    0x00000000003AB193ULL,
-    0x00000000003AB199ULL,
-    0x00000000003AB1B3ULL,
-    0x00000000003AB201ULL,
-    0x00000000003AB289ULL,
-    0x00000000003AB293ULL,
-    0x00000000003AB299ULL,
-    0x00000000003AB4A3ULL,
-    0x00000000003AB52EULL,
-    0x00000000003AB899ULL,
-    0x00000000003AB8A9ULL,
-    0x00000000003AB934ULL,
-    0x00000000003ABA93ULL,
-    0x00000000003AC0ACULL,
-    0x00000000003AC124ULL,
-    0x00000000003AC201ULL,
-    0x00000000003AC219ULL,
-    0x00000000003AC834ULL,
-    0x00000000003AC853ULL,
-    0x00000000003AC868ULL,
-    0x00000000003AC893ULL,
-    0x00000000003AC899ULL,
-    0x00000000003AC8A4ULL,
-    0x00000000003AC8B2ULL,
-    0x00000000003AC8B3ULL,
-    0x00000000003AC8B4ULL,
-    0x00000000003AC8D3ULL,
-    0x00000000003AC921ULL,
-    0x00000000003AC925ULL,
-    0x00000000003AC92FULL,
-    0x00000000003AC989ULL,
-    0x00000000003AC993ULL,
-    0x00000000003AC999ULL,
-    0x00000000003AC9D3ULL,
-    0x00000000003AC9D9ULL,
-    0x00000000003ACA53ULL,
-    0x00000000003ACA59ULL,
-    0x00000000003ACA65ULL,
-    0x00000000003ACA69ULL,
-    0x00000000003ACA74ULL,
-    0x00000000003ACAC5ULL,
-    0x00000000003ACAD9ULL,
-    0x00000000003ACCA3ULL,
-    0x00000000003ACD19ULL,
-    0x00000000003ACD73ULL,
-    0x00000000003ACE13ULL,
-    0x00000000003ACE19ULL,
-    0x00000000003ACE6FULL,
-    0x00000000003ACEADULL,
-    0x00000000003AD068ULL,
-    0x00000000003AD0B2ULL,
-    0x00000000003AD0B3ULL,
-    0x00000000003AD0B9ULL,
-    0x00000000003AD125ULL,
-    0x00000000003AD12EULL,
-    0x00000000003AD133ULL,
-    0x00000000003AD28FULL,
-    0x00000000003AD299ULL,
-    0x00000000003AD2B0ULL,
-    0x00000000003AD8A5ULL,
-    0x00000000003AE8B3ULL,
-    0x00000000003BD068ULL,
-    0x00000000003C85CFULL,
-    0x00000000003C85D3ULL,
-    0x00000000003C88B2ULL,
-    0x00000000003C8C24ULL,
-    0x00000000003C8C33ULL,
-    0x00000000003C8D85ULL,
-    0x00000000003C8D8FULL,
-    0x00000000003C90B2ULL,
-    0x00000000003CB138ULL,
-    0x00000000003CB425ULL,
-    0x00000000003CB432ULL,
-    0x00000000003CB433ULL,
-    0x00000000003CB4B3ULL,
-    0x00000000003CB5ECULL,
-    0x00000000003CB923ULL,
-    0x00000000003CCE93ULL,
-    0x00000000003CD0B3ULL,
-    0x00000000003CD1EEULL,
-    0x00000000003D0653ULL,
-    0x0000000000408593ULL,
-    0x0000000000408841ULL,
-    0x0000000000408CB3ULL,
-    0x0000000000408D01ULL,
-    0x0000000000408D73ULL,
-    0x0000000000409028ULL,
-    0x0000000000409033ULL,
-    0x0000000000409099ULL,
-    0x00000000004091F3ULL,
-    0x00000000004098D3ULL,
-    0x00000000004098D9ULL,
-    0x0000000000409CE1ULL,
-    0x0000000000409CF9ULL,
-    0x0000000000409DF3ULL,
-    0x000000000040A193ULL,
-    0x000000000040A56FULL,
-    0x000000000040A599ULL,
-    0x000000000040A5C5ULL,
-    0x000000000040A5D4ULL,
-    0x000000000040A659ULL,
-    0x000000000040A679ULL,
-    0x000000000040ACB2ULL,
-    0x000000000040B0A4ULL,
-    0x000000000040B0B3ULL,
-    0x000000000040B133ULL,
-    0x000000000040B185ULL,
-    0x000000000040B199ULL,
-    0x000000000040B293ULL,
-    0x000000000040B42EULL,
-    0x000000000040B432ULL,
-    0x000000000040B4B3ULL,
-    0x000000000040B5A5ULL,
-    0x000000000040B5D3ULL,
-    0x000000000040B613ULL,
-    0x000000000040B619ULL,
-    0x000000000040B865ULL,
-    0x000000000040B879ULL,
-    0x000000000040B899ULL,
-    0x000000000040B8F3ULL,
-    0x000000000040B92FULL,
-    0x000000000040B973ULL,
-    0x000000000040B9D9ULL,
-    0x000000000040BA93ULL,
-    0x000000000040C826ULL,
-    0x000000000040C853ULL,
-    0x000000000040C879ULL,
-    0x000000000040C8A4ULL,
-    0x000000000040C8B2ULL,
-    0x000000000040C8B3ULL,
-    0x000000000040C8E1ULL,
-    0x000000000040C8F3ULL,
-    0x000000000040C923ULL,
-    0x000000000040C933ULL,
-    0x000000000040C973ULL,
-    0x000000000040C9D3ULL,
-    0x000000000040CA45ULL,
-    0x000000000040CA93ULL,
-    0x000000000040CB49ULL,
-    0x000000000040CD09ULL,
-    0x000000000040CD19ULL,
-    0x000000000040D02CULL,
-    0x000000000040D0A4ULL,
-    0x000000000040D0B2ULL,
-    0x000000000040D0B3ULL,
-    0x000000000040D1F3ULL,
-    0x000000000040D28FULL,
-    0x000000000040D2ADULL,
-    0x000000000040D445ULL,
-    0x000000000040D453ULL,
-    0x000000000040D459ULL,
-    0x000000000040D493ULL,
-    0x000000000040D594ULL,
-    0x000000000040D5D4ULL,
-    0x000000000040D653ULL,
-    0x000000000040D693ULL,
-    0x000000000040D8AEULL,
-    0x000000000040D934ULL,
-    0x000000000040DC28ULL,
-    0x000000000040DC93ULL,
-    0x000000000040DCA4ULL,
-    0x000000000040DCAEULL,
-    0x000000000040DD73ULL,
-    0x000000000040DDD3ULL,
-    0x000000000040DE93ULL,
-    0x000000000040E42EULL,
-    0x000000000040E468ULL,
-    0x000000000040E5D4ULL,
-    0x000000000040E8A4ULL,
-    0x000000000040E8B2ULL,
-    0x000000000040E8B3ULL,
-    0x0000000000428493ULL,
-    0x0000000000428532ULL,
-    0x0000000000428593ULL,
-    0x0000000000428594ULL,
-    0x00000000004285D3ULL,
-    0x0000000000428645ULL,
-    0x000000000042864EULL,
-    0x0000000000428653ULL,
-    0x0000000000428659ULL,
-    0x0000000000428668ULL,
-    0x0000000000428688ULL,
-    0x00000000004286C5ULL,
-    0x00000000004286F3ULL,
-    0x00000000004286F9ULL,
-    0x0000000000428827ULL,
-    0x0000000000428832ULL,
-    0x0000000000428859ULL,
-    0x00000000004288ACULL,
-    0x00000000004288B3ULL,
-    0x0000000000428934ULL,
-    0x0000000000428A93ULL,
-    0x0000000000428AA4ULL,
-    0x0000000000428AA7ULL,
-    0x0000000000428AB2ULL,
-    0x0000000000428AB3ULL,
-    0x0000000000428AB4ULL,
-    0x0000000000428B25ULL,
-    0x0000000000428C24ULL,
-    0x0000000000428C26ULL,
-    0x0000000000428C2CULL,
-    0x0000000000428C2EULL,
-    0x0000000000428C39ULL,
-    0x0000000000428D6FULL,
-    0x0000000000428D73ULL,
-    0x0000000000428DF2ULL,
-    0x0000000000428DF3ULL,
-    0x0000000000428DF9ULL,
-    0x0000000000428E59ULL,
-    0x000000000042902CULL,
-    0x0000000000429493ULL,
-    0x0000000000429499ULL,
-    0x0000000000429599ULL,
-    0x00000000004295B3ULL,
-    0x00000000004295D3ULL,
-    0x0000000000429613ULL,
-    0x0000000000429645ULL,
-    0x0000000000429653ULL,
-    0x0000000000429693ULL,
-    0x00000000004296C5ULL,
-    0x00000000004296D3ULL,
-    0x0000000000429834ULL,
-    0x00000000004298B2ULL,
-    0x00000000004298CFULL,
-    0x0000000000429933ULL,
-    0x00000000004299E7ULL,
-    0x0000000000429C33ULL,
-    0x0000000000429EADULL,
-    0x0000000000429EB3ULL,
-    0x000000000042A465ULL,
-    0x000000000042A493ULL,
-    0x000000000042A4D9ULL,
-    0x000000000042A4EEULL,
-    0x000000000042A593ULL,
-    0x000000000042A66DULL,
-    0x000000000042A674ULL,
-    0x000000000042A699ULL,
-    0x000000000042ACA4ULL,
-    0x000000000042ACB3ULL,
-    0x000000000042AD6FULL,
-    0x000000000042B039ULL,
-    0x000000000042B0A4ULL,
-    0x000000000042B0B3ULL,
-    0x000000000042B0D3ULL,
-    0x000000000042B0D4ULL,
-    0x000000000042B133ULL,
-    0x000000000042B193ULL,
-    0x000000000042B199ULL,
-    0x000000000042B1F3ULL,
-    0x000000000042B208ULL,
-    0x000000000042B281ULL,
-    0x000000000042B293ULL,
-    0x000000000042B2C5ULL,
-    0x000000000042B42EULL,
-    0x000000000042B4B3ULL,
-    0x000000000042B523ULL,
-    0x000000000042B534ULL,
-    0x000000000042B5E2ULL,
-    0x000000000042B5E9ULL,
-    0x000000000042B5EEULL,
-    0x000000000042B5F3ULL,
-    0x000000000042B614ULL,
-    0x000000000042B6B2ULL,
-    0x000000000042B832ULL,
-    0x000000000042B839ULL,
-    0x000000000042B868ULL,
-    0x000000000042B8B3ULL,
-    0x000000000042B8B4ULL,
-    0x000000000042B92DULL,
-    0x000000000042B933ULL,
-    0x000000000042BA65ULL,
-    0x000000000042BA93ULL,
-    0x000000000042BF19ULL,
-    0x000000000042C1F4ULL,
-    0x000000000042C288ULL,
-    0x000000000042C834ULL,
-    0x000000000042C839ULL,
-    0x000000000042C859ULL,
-    0x000000000042C8A4ULL,
-    0x000000000042C8B3ULL,
-    0x000000000042C927ULL,
-    0x000000000042C9A1ULL,
-    0x000000000042C9B3ULL,
-    0x000000000042C9D3ULL,
-    0x000000000042C9D9ULL,
-    0x000000000042C9F3ULL,
-    0x000000000042CA4FULL,
-    0x000000000042CA59ULL,
-    0x000000000042CA88ULL,
-    0x000000000042CAD3ULL,
-    0x000000000042CCB8ULL,
-    0x000000000042CD09ULL,
-    0x000000000042CD33ULL,
-    0x000000000042CD73ULL,
-    0x000000000042CE65ULL,
-    0x000000000042D0B2ULL,
-    0x000000000042D1F8ULL,
-    0x000000000042D465ULL,
-    0x000000000042D833ULL,
-    0x000000000042D8ACULL,
-    0x000000000042D92CULL,
-    0x000000000042D933ULL,
-    0x000000000042D9EEULL,
-    0x000000000042D9F3ULL,
-    0x000000000042D9F4ULL,
-    0x000000000042DC2EULL,
-    0x000000000042DC32ULL,
-    0x000000000042DC38ULL,
-    0x000000000042DCA4ULL,
-    0x000000000042E0B3ULL,
-    0x000000000042E125ULL,
-    0x0000000000440441ULL,
-    0x0000000000440573ULL,
-    0x0000000000440593ULL,
-    0x0000000000442572ULL,
-    0x0000000000443C49ULL,
-    0x0000000000443D85ULL,
-    0x0000000000443D8CULL,
-    0x0000000000443D93ULL,
-    0x0000000000443E89ULL,
-    0x0000000000443EF3ULL,
-    0x0000000000445689ULL,
-    0x0000000000448474ULL,
-    0x0000000000448593ULL,
-    0x00000000004485C5ULL,
-    0x0000000000448659ULL,
-    0x000000000044874FULL,
-    0x0000000000448853ULL,
-    0x0000000000448CA4ULL,
-    0x0000000000448CB2ULL,
-    0x0000000000448CB3ULL,
-    0x0000000000448CB9ULL,
-    0x0000000000448D14ULL,
-    0x0000000000448D73ULL,
-    0x0000000000448D79ULL,
-    0x0000000000448DF4ULL,
-    0x0000000000448E81ULL,
-    0x0000000000448E93ULL,
-    0x0000000000448E99ULL,
-    0x0000000000449099ULL,
-    0x0000000000449125ULL,
-    0x00000000004491F3ULL,
-    0x0000000000449274ULL,
-    0x0000000000449453ULL,
-    0x0000000000449593ULL,
-    0x00000000004495C5ULL,
-    0x0000000000449693ULL,
-    0x00000000004498D3ULL,
-    0x0000000000449D14ULL,
-    0x0000000000449D34ULL,
-    0x000000000044AC33ULL,
-    0x000000000044ACA4ULL,
-    0x000000000044ACB2ULL,
-    0x000000000044ACB3ULL,
-    0x000000000044ACB9ULL,
-    0x000000000044B08FULL,
-    0x000000000044B189ULL,
-    0x000000000044B193ULL,
-    0x000000000044B199ULL,
-    0x000000000044B44FULL,
-    0x000000000044B4B2ULL,
-    0x000000000044B4B3ULL,
-    0x000000000044B599ULL,
-    0x000000000044B613ULL,
-    0x000000000044B832ULL,
-    0x000000000044B8A4ULL,
-    0x000000000044B8B2ULL,
-    0x000000000044B8B3ULL,
-    0x000000000044B8E5ULL,
-    0x000000000044B8EFULL,
-    0x000000000044B8F3ULL,
-    0x000000000044B8F9ULL,
-    0x000000000044B923ULL,
-    0x000000000044B973ULL,
-    0x000000000044B979ULL,
-    0x000000000044B9C1ULL,
-    0x000000000044B9F3ULL,
-    0x000000000044BA93ULL,
-    0x000000000044BC85ULL,
-    0x000000000044BD93ULL,
-    0x000000000044BE81ULL,
-    0x000000000044C219ULL,
-    0x000000000044C26FULL,
-    0x000000000044C82DULL,
-    0x000000000044C8B2ULL,
-    0x000000000044C8E5ULL,
-    0x000000000044C965ULL,
-    0x000000000044C973ULL,
-    0x000000000044C993ULL,
-    0x000000000044CA93ULL,
-    0x000000000044CA99ULL,
-    0x000000000044CC33ULL,
-    0x000000000044CC69ULL,
-    0x000000000044CC6FULL,
-    0x000000000044CC73ULL,
-    0x000000000044CD19ULL,
-    0x000000000044CD73ULL,
-    0x000000000044CDA5ULL,
-    0x000000000044D02CULL,
-    0x000000000044D033ULL,
-    0x000000000044D068ULL,
-    0x000000000044D0A4ULL,
-    0x000000000044D0B3ULL,
-    0x000000000044D279ULL,
-    0x000000000044D28FULL,
-    0x000000000044D293ULL,
-    0x000000000044D299ULL,
-    0x000000000044D359ULL,
-    0x000000000044D82EULL,
-    0x000000000044D833ULL,
-    0x000000000044D8A4ULL,
-    0x000000000044D8B2ULL,
-    0x000000000044D8B3ULL,
-    0x000000000044D933ULL,
-    0x000000000044D9C1ULL,
-    0x000000000044D9F3ULL,
-    0x000000000044D9F4ULL,
-    0x000000000044DAD9ULL,
-    0x000000000044DC2EULL,
-    0x000000000044E125ULL,
-    0x000000000044E134ULL,
-    0x000000000044E433ULL,
-    0x000000000044E8AEULL,
-    0x000000000044EB59ULL,
-    0x00000000004525CEULL,
-    0x00000000004525D3ULL,
-    0x0000000000478453ULL,
-    0x0000000000478693ULL,
-    0x0000000000478859ULL,
-    0x00000000004788B3ULL,
-    0x0000000000478925ULL,
-    0x0000000000478981ULL,
-    0x0000000000478A41ULL,
-    0x0000000000478A4FULL,
-    0x0000000000478D14ULL,
-    0x0000000000478D73ULL,
-    0x0000000000478DF3ULL,
-    0x0000000000478EB3ULL,
-    0x0000000000479099ULL,
-    0x00000000004790E5ULL,
-    0x00000000004790F9ULL,
-    0x00000000004791F3ULL,
-    0x0000000000479573ULL,
-    0x0000000000479653ULL,
-    0x0000000000479674ULL,
-    0x0000000000479688ULL,
-    0x00000000004798D3ULL,
-    0x0000000000479C2EULL,
-    0x0000000000479CB3ULL,
-    0x0000000000479CB9ULL,
-    0x0000000000479CEFULL,
-    0x0000000000479CF9ULL,
-    0x0000000000479D25ULL,
-    0x0000000000479DA1ULL,
-    0x000000000047A32FULL,
-    0x000000000047A594ULL,
-    0x000000000047A599ULL,
-    0x000000000047A5C7ULL,
-    0x000000000047A693ULL,
-    0x000000000047A9F3ULL,
-    0x000000000047B065ULL,
-    0x000000000047B069ULL,
-    0x000000000047B0A4ULL,
-    0x000000000047B0B3ULL,
-    0x000000000047B121ULL,
-    0x000000000047B193ULL,
-    0x000000000047B199ULL,
-    0x000000000047B1A1ULL,
-    0x000000000047B1F2ULL,
-    0x000000000047B1F3ULL,
-    0x000000000047B293ULL,
-    0x000000000047B42CULL,
-    0x000000000047B4A4ULL,
-    0x000000000047B4B3ULL,
-    0x000000000047B523ULL,
-    0x000000000047B828ULL,
-    0x000000000047B833ULL,
-    0x000000000047B8A5ULL,
-    0x000000000047B8B2ULL,
-    0x000000000047B8E1ULL,
-    0x000000000047B8F3ULL,
-    0x000000000047B96FULL,
-    0x000000000047B9C1ULL,
-    0x000000000047B9C5ULL,
-    0x000000000047B9D9ULL,
-    0x000000000047B9F2ULL,
-    0x000000000047BA79ULL,
-    0x000000000047BAB4ULL,
-    0x000000000047BC53ULL,
-    0x000000000047BC65ULL,
-    0x000000000047BC99ULL,
-    0x000000000047BD73ULL,
-    0x000000000047BD85ULL,
-    0x000000000047BD93ULL,
-    0x000000000047BD99ULL,
-    0x000000000047BDB3ULL,
-    0x000000000047BDB9ULL,
-    0x000000000047BDC1ULL,
-    0x000000000047BE4EULL,
-    0x000000000047BE53ULL,
-    0x000000000047BF59ULL,
-    0x000000000047C033ULL,
-    0x000000000047C0A4ULL,
-    0x000000000047C0B2ULL,
-    0x000000000047C0B3ULL,
-    0x000000000047C0B9ULL,
-    0x000000000047C824ULL,
-    0x000000000047C841ULL,
-    0x000000000047C853ULL,
-    0x000000000047C8A5ULL,
-    0x000000000047C8B3ULL,
-    0x000000000047C923ULL,
-    0x000000000047C933ULL,
-    0x000000000047C973ULL,
-    0x000000000047C979ULL,
-    0x000000000047C9B3ULL,
-    0x000000000047C9B9ULL,
-    0x000000000047CA13ULL,
-    0x000000000047CA53ULL,
-    0x000000000047CA61ULL,
-    0x000000000047CA65ULL,
-    0x000000000047CA93ULL,
-    0x000000000047CA99ULL,
-    0x000000000047CC29ULL,
-    0x000000000047CC33ULL,
-    0x000000000047CCA4ULL,
-    0x000000000047CCA8ULL,
-    0x000000000047CCB2ULL,
-    0x000000000047CCB3ULL,
-    0x000000000047CD01ULL,
-    0x000000000047D02CULL,
-    0x000000000047D0A4ULL,
-    0x000000000047D0B2ULL,
-    0x000000000047D0B3ULL,
-    0x000000000047D299ULL,
-    0x000000000047D432ULL,
-    0x000000000047D454ULL,
-    0x000000000047D465ULL,
-    0x000000000047D473ULL,
-    0x000000000047D4E8ULL,
-    0x000000000047D573ULL,
-    0x000000000047D581ULL,
-    0x000000000047D5A1ULL,
-    0x000000000047D5B3ULL,
-    0x000000000047D613ULL,
-    0x000000000047D641ULL,
-    0x000000000047D665ULL,
-    0x000000000047D693ULL,
-    0x000000000047D8A4ULL,
-    0x000000000047D8AEULL,
-    0x000000000047D8B2ULL,
-    0x000000000047D8B3ULL,
-    0x000000000047D925ULL,
-    0x000000000047DC32ULL,
-    0x000000000047DC93ULL,
-    0x000000000047DC99ULL,
-    0x000000000047DCA4ULL,
-    0x000000000047DCACULL,
-    0x000000000047DCB2ULL,
-    0x000000000047DD25ULL,
-    0x000000000047DD85ULL,
-    0x000000000047DD93ULL,
-    0x000000000047DD99ULL,
-    0x000000000047DDC1ULL,
-    0x000000000047DDD3ULL,
-    0x000000000047DDD9ULL,
-    0x000000000047DE13ULL,
-    0x000000000047DE59ULL,
-    0x000000000047DE65ULL,
-    0x000000000047DE93ULL,
-    0x000000000047E0A4ULL,
-    0x000000000047E0B3ULL,
-    0x000000000047E125ULL,
-    0x000000000047E4AEULL,
-    0x000000000047E599ULL,
-    0x000000000047E8A4ULL,
-    0x000000000047E8AEULL,
-    0x000000000047E8B2ULL,
-    0x000000000047E8B3ULL,
-    0x0000000000490453ULL,
-    0x000000000049046BULL,
-    0x000000000049046FULL,
-    0x00000000004904C6ULL,
-    0x00000000004904D4ULL,
-    0x00000000004904F3ULL,
-    0x000000000049052CULL,
-    0x000000000049052EULL,
-    0x0000000000490565ULL,
-    0x00000000004905A1ULL,
-    0x00000000004905B3ULL,
-    0x00000000004905CBULL,
-    0x00000000004905D4ULL,
-    0x0000000000490605ULL,
-    0x0000000000490613ULL,
-    0x0000000000490693ULL,
-    0x00000000004906C5ULL,
-    0x00000000004906ECULL,
-    0x00000000004906EEULL,
-    0x00000000004906F3ULL,
-    0x0000000000490733ULL,
-    0x0000000000491424ULL,
-    0x000000000049142DULL,
-    0x0000000000491432ULL,
-    0x000000000049146BULL,
-    0x00000000004914A4ULL,
-    0x00000000004914B2ULL,
-    0x00000000004914B3ULL,
-    0x00000000004914F3ULL,
-    0x0000000000491573ULL,
-    0x00000000004915D4ULL,
-    0x0000000000491645ULL,
-    0x0000000000491673ULL,
-    0x0000000000491674ULL,
-    0x0000000000491733ULL,
-    0x0000000000492453ULL,
-    0x0000000000492465ULL,
-    0x00000000004924A4ULL,
-    0x00000000004924B2ULL,
-    0x00000000004924B3ULL,
-    0x00000000004924D4ULL,
-    0x000000000049258CULL,
-    0x0000000000492599ULL,
-    0x00000000004925CBULL,
-    0x0000000000492613ULL,
-    0x0000000000492614ULL,
-    0x00000000004926C5ULL,
-    0x0000000000493D24ULL,
-    0x0000000000493D2CULL,
-    0x0000000000493D34ULL,
-    0x0000000000493D65ULL,
-    0x0000000000493D85ULL,
-    0x0000000000493D8CULL,
-    0x0000000000493DA5ULL,
-    0x0000000000493DC5ULL,
-    0x0000000000493DD9ULL,
-    0x0000000000493DE2ULL,
-    0x0000000000493DE7ULL,
-    0x0000000000493DEBULL,
-    0x0000000000493DECULL,
-    0x0000000000493DF0ULL,
-    0x0000000000493E13ULL,
-    0x0000000000493E14ULL,
-    0x0000000000493E73ULL,
-    0x0000000000493EABULL,
-    0x0000000000493EC5ULL,
-    0x0000000000493EEEULL,
-    0x0000000000493EF3ULL,
-    0x0000000000495453ULL,
-    0x00000000004954F3ULL,
-    0x0000000000495524ULL,
-    0x00000000004955B3ULL,
-    0x00000000004955CBULL,
-    0x0000000000495605ULL,
-    0x0000000000495665ULL,
-    0x0000000000495679ULL,
-    0x0000000000495719ULL,
-    0x0000000000496424ULL,
-    0x0000000000496433ULL,
-    0x00000000004964B2ULL,
-    0x0000000000496599ULL,
-    0x000000000049BC4FULL,
-    0x000000000049BDAFULL,
-    0x00000000004A8493ULL,
-    0x00000000004A8593ULL,
-    0x00000000004A85D3ULL,
-    0x00000000004A8653ULL,
-    0x00000000004A884FULL,
-    0x00000000004A8C2CULL,
-    0x00000000004A8C34ULL,
-    0x00000000004A8CB3ULL,
-    0x00000000004A8D19ULL,
-    0x00000000004A8D73ULL,
-    0x00000000004A8D79ULL,
-    0x00000000004A8E93ULL,
-    0x00000000004A9099ULL,
-    0x00000000004A90A4ULL,
-    0x00000000004A90B3ULL,
-    0x00000000004A9593ULL,
-    0x00000000004A9693ULL,
-    0x00000000004A9694ULL,
-    0x00000000004A98D3ULL,
-    0x00000000004A9AB3ULL,
-    0x00000000004AA5C7ULL,
-    0x00000000004AA693ULL,
-    0x00000000004AAC33ULL,
-    0x00000000004AACA4ULL,
-    0x00000000004AACB3ULL,
-    0x00000000004AAD61ULL,
-    0x00000000004AB065ULL,
-    0x00000000004AB0B3ULL,
-    0x00000000004AB121ULL,
-    0x00000000004AB193ULL,
-    0x00000000004AB199ULL,
-    0x00000000004AB265ULL,
-    0x00000000004AB433ULL,
-    0x00000000004AB44FULL,
-    0x00000000004AB453ULL,
-    0x00000000004AB561ULL,
-    0x00000000004AB579ULL,
-    0x00000000004AB5B9ULL,
-    0x00000000004AB613ULL,
-    0x00000000004AB619ULL,
-    0x00000000004AB82DULL,
-    0x00000000004AB865ULL,
-    0x00000000004AB868ULL,
-    0x00000000004AB8B3ULL,
-    0x00000000004AB8F3ULL,
-    0x00000000004AB8F9ULL,
-    0x00000000004AB973ULL,
-    0x00000000004AB9CFULL,
-    0x00000000004AB9D9ULL,
-    0x00000000004ABA68ULL,
-    0x00000000004ABA93ULL,
-    0x00000000004ABDA9ULL,
-    0x00000000004ABDAFULL,
-    0x00000000004AC0A4ULL,
-    0x00000000004AC0B2ULL,
-    0x00000000004AC0B3ULL,
-    0x00000000004AC185ULL,
-    0x00000000004AC199ULL,
-    0x00000000004AC219ULL,
-    0x00000000004AC82CULL,
-    0x00000000004AC833ULL,
-    0x00000000004AC8A4ULL,
-    0x00000000004AC8B3ULL,
-    0x00000000004AC8F9ULL,
-    0x00000000004AC9D3ULL,
-    0x00000000004AC9E3ULL,
-    0x00000000004AC9F3ULL,
-    0x00000000004AC9F9ULL,
-    0x00000000004ACA41ULL,
-    0x00000000004ACA53ULL,
-    0x00000000004ACA59ULL,
-    0x00000000004ACA74ULL,
-    0x00000000004ACAADULL,
-    0x00000000004ACB49ULL,
-    0x00000000004ACD73ULL,
-    0x00000000004ACD79ULL,
-    0x00000000004ACE93ULL,
-    0x00000000004ACE99ULL,
-    0x00000000004AD068ULL,
-    0x00000000004AD8B4ULL,
-    0x00000000004AE0B3ULL,
-    0x00000000004B842CULL,
-    0x00000000004B8585ULL,
-    0x00000000004B858DULL,
-    0x00000000004B85B3ULL,
-    0x00000000004B85C7ULL,
-    0x00000000004B8646ULL,
-    0x00000000004B86ADULL,
-    0x00000000004B94A2ULL,
-    0x00000000004B958CULL,
-    0x00000000004B9594ULL,
-    0x00000000004BA585ULL,
-    0x00000000004BA5C5ULL,
-    0x00000000004C8493ULL,
-    0x00000000004C9653ULL,
-    0x00000000004CA5C7ULL,
-    0x00000000004CADEEULL,
-    0x00000000004CB8ACULL,
-    0x00000000004CB8B3ULL,
-    0x00000000004D21F3ULL,
-    0x0000000000509CB2ULL,
-    0x0000000000509D85ULL,
-    0x0000000000509E45ULL,
-    0x000000000050B0A4ULL,
-    0x000000000050B0B3ULL,
-    0x000000000050B8A4ULL,
-    0x000000000050C893ULL,
-    0x000000000050C8A4ULL,
-    0x000000000050C993ULL,
-    0x000000000050C999ULL,
-    0x000000000050C9D3ULL,
-    0x000000000050C9D4ULL,
-    0x000000000050CA74ULL,
-    0x000000000050CA88ULL,
-    0x000000000050CCA4ULL,
-    0x000000000050CCACULL,
-    0x000000000050CCB2ULL,
-    0x000000000050CCB3ULL,
-    0x000000000050CD85ULL,
-    0x000000000050CE93ULL,
-    0x000000000050D0AEULL,
-    0x000000000050D0B2ULL,
-    0x000000000050D105ULL,
-    0x000000000050D8A4ULL,
-    0x000000000050D8B3ULL,
-    0x00000000005108A4ULL,
-    0x00000000005108B4ULL,
-    0x0000000000513DD3ULL,
-    0x0000000000513DD9ULL,
-    0x0000000000513DEBULL,
-    0x0000000000518493ULL,
-    0x000000000051A0A4ULL,
-    0x000000000051A0B3ULL,
-    0x000000000051A1F3ULL,
-    0x000000000051B034ULL,
-    0x000000000051CAB3ULL,
-    0x00000000005215A1ULL,
-    0x0000000000521CA4ULL,
-    0x0000000000521CB2ULL,
-    0x0000000000521CB3ULL,
-    0x0000000000522474ULL,
-    0x00000000005224D9ULL,
-    0x0000000000522585ULL,
-    0x0000000000522693ULL,
-    0x0000000000525465ULL,
-    0x0000000000525474ULL,
-    0x000000000052A934ULL,
-    0x000000000052BA79ULL,
-    0x000000000052C925ULL,
-    0x000000000052D8AEULL,
-    0x000000000052D9D3ULL,
-    0x00000000005318A4ULL,
-    0x0000000000538493ULL,
-    0x0000000000539653ULL,
-    0x0000000000539674ULL,
-    0x0000000000539C32ULL,
-    0x0000000000539CA4ULL,
-    0x0000000000539CB2ULL,
-    0x000000000053B433ULL,
-    0x000000000053C8B4ULL,
-    0x00000000005425C7ULL,
-    0x00000000005490B2ULL,
-    0x00000000005491F3ULL,
-    0x0000000000549D14ULL,
-    0x0000000000549DC5ULL,
-    0x000000000054ACA4ULL,
-    0x000000000054ADEEULL,
-    0x000000000054B093ULL,
-    0x000000000054CCACULL,
-    0x0000000000551474ULL,
-    0x000000000055248FULL,
-    0x000000000055A5C7ULL,
-    0x000000000055AC33ULL,
-    0x000000000056052EULL,
-    0x00000000005605C4ULL,
-    0x00000000005605D3ULL,
-    0x0000000000560685ULL,
-    0x00000000005609F7ULL,
-    0x0000000000560D09ULL,
-    0x00000000005610B2ULL,
-    0x000000000056112EULL,
-    0x0000000000561474ULL,
-    0x00000000005614F9ULL,
-    0x00000000005615A9ULL,
-    0x00000000005618A4ULL,
-    0x000000000056192EULL,
-    0x0000000000562424ULL,
-    0x0000000000562485ULL,
-    0x00000000005625D4ULL,
-    0x0000000000562685ULL,
-    0x00000000005634AEULL,
-    0x0000000000563CE5ULL,
-    0x0000000000563CF9ULL,
-    0x0000000000563D2EULL,
-    0x0000000000563E05ULL,
-    0x0000000000563E13ULL,
-    0x00000000005640A5ULL,
-    0x0000000000564D2EULL,
-    0x0000000000565485ULL,
-    0x0000000000565685ULL,
-    0x000000000056582EULL,
-    0x00000000005658AEULL,
-    0x00000000005658B2ULL,
-    0x00000000005658B3ULL,
-    0x0000000000568473ULL,
-    0x000000000056852CULL,
-    0x0000000000568832ULL,
-    0x0000000000568839ULL,
-    0x00000000005688A4ULL,
-    0x00000000005688B2ULL,
-    0x00000000005689E7ULL,
-    0x00000000005689F7ULL,
-    0x00000000005689F8ULL,
-    0x0000000000568AB3ULL,
-    0x0000000000568CA5ULL,
-    0x00000000005694B2ULL,
-    0x00000000005695C4ULL,
-    0x0000000000569647ULL,
-    0x0000000000569659ULL,
-    0x00000000005696B3ULL,
-    0x000000000056A473ULL,
-    0x000000000056A653ULL,
-    0x000000000056A693ULL,
-    0x000000000056B433ULL,
-    0x000000000056B4B2ULL,
-    0x000000000056B4B4ULL,
-    0x000000000056B4B7ULL,
-    0x000000000056B733ULL,
-    0x000000000056BD49ULL,
-    0x000000000056BDC7ULL,
-    0x000000000056BE85ULL,
-    0x000000000056BEC5ULL,
-    0x000000000056C293ULL,
-    0x000000000056C299ULL,
-    0x000000000056D585ULL,
-    0x000000000056D645ULL,
-    0x000000000056E485ULL,
-    0x000000000056E493ULL,
-    0x0000000000570474ULL,
-    0x000000000057064DULL,
-    0x0000000000570685ULL,
-    0x00000000005710A4ULL,
-    0x00000000005710B2ULL,
-    0x00000000005710B7ULL,
-    0x00000000005711F7ULL,
-    0x00000000005712A5ULL,
-    0x00000000005715A1ULL,
-    0x00000000005715B9ULL,
-    0x00000000005716F3ULL,
-    0x0000000000571938ULL,
-    0x0000000000572423ULL,
-    0x00000000005729F9ULL,
-    0x0000000000573134ULL,
-    0x00000000005734B7ULL,
-    0x00000000005739E7ULL,
-    0x0000000000573AA9ULL,
-    0x0000000000573D69ULL,
-    0x0000000000573D93ULL,
-    0x0000000000573E4DULL,
-    0x0000000000573EF3ULL,
-    0x00000000005749ECULL,
-    0x0000000000574CB7ULL,
-    0x0000000000574D79ULL,
-    0x0000000000574EA5ULL,
-    0x00000000005750B2ULL,
-    0x0000000000575121ULL,
-    0x0000000000575259ULL,
-    0x0000000000575645ULL,
-    0x000000000057564EULL,
-    0x00000000005759E9ULL,
-    0x00000000005759F9ULL,
-    0x0000000000576B2DULL,
-    0x000000000057C993ULL,
-    0x000000000057CD2EULL,
-    0x0000000000580474ULL,
-    0x00000000005814B3ULL,
-    0x0000000000582028ULL,
-    0x0000000000582033ULL,
-    0x00000000005821E4ULL,
-    0x00000000005821F2ULL,
-    0x0000000000582473ULL,
-    0x0000000000583C68ULL,
-    0x0000000000583C85ULL,
-    0x0000000000583E14ULL,
-    0x0000000000583F19ULL,
-    0x0000000000584933ULL,
-    0x000000000058D42CULL,
-    0x000000000058D4B3ULL,
-    0x000000000058D524ULL,
-    0x000000000058D530ULL,
-    0x0000000000590665ULL,
-    0x0000000000590921ULL,
-    0x0000000000591474ULL,
-    0x00000000005916D3ULL,
-    0x0000000000591DEEULL,
-    0x0000000000591DF3ULL,
-    0x0000000000591DF4ULL,
-    0x00000000005922B3ULL,
-    0x0000000000592461ULL,
-    0x000000000059246BULL,
-    0x0000000000592473ULL,
-    0x00000000005925C7ULL,
-    0x00000000005938A4ULL,
-    0x00000000005938B3ULL,
-    0x0000000000593C85ULL,
-    0x0000000000593E65ULL,
-    0x00000000005948A4ULL,
-    0x00000000005949F2ULL,
-    0x0000000000594CB3ULL,
-    0x0000000000595474ULL,
-    0x00000000005954EFULL,
-    0x0000000000595614ULL,
-    0x00000000005956D3ULL,
-    0x00000000005958AEULL,
-    0x000000000059592CULL,
-    0x0000000000598C32ULL,
-    0x0000000000598DF4ULL,
-    0x000000000059A585ULL,
-    0x000000000059AC32ULL,
-    0x000000000059ACB2ULL,
-    0x000000000059B8B3ULL,
-    0x000000000059CC39ULL,
-    0x000000000059CCB3ULL,
-    0x000000000059D0B2ULL,
-    0x000000000059D1E3ULL,
-    0x000000000059D1F0ULL,
-    0x000000000059D24FULL,
-    0x00000000005A04E5ULL,
-    0x00000000005A0605ULL,
-    0x00000000005A0693ULL,
-    0x00000000005A15D3ULL,
-    0x00000000005A202CULL,
-    0x00000000005A20B2ULL,
-    0x00000000005A2123ULL,
-    0x00000000005A21C5ULL,
-    0x00000000005A21F3ULL,
-    0x00000000005A232CULL,
-    0x00000000005A2473ULL,
-    0x00000000005A3833ULL,
-    0x00000000005A512EULL,
-    0x00000000005A5185ULL,
-    0x00000000005A5485ULL,
-    0x00000000005A5533ULL,
-    0x00000000005A5CA5ULL,
-    0x00000000005A65A1ULL,
-    0x00000000005A9D13ULL,
-    0x00000000005AACA4ULL,
-    0x00000000005AC024ULL,
-    0x00000000005AC9F3ULL,
-    0x00000000005ACDECULL,
-    0x00000000005B0485ULL,
-    0x00000000005B15D3ULL,
-    0x00000000005B15D4ULL,
-    0x00000000005B1654ULL,
-    0x00000000005B1659ULL,
-    0x00000000005B1693ULL,
-    0x00000000005B21E5ULL,
-    0x00000000005B2474ULL,
-    0x00000000005B2593ULL,
-    0x00000000005B2685ULL,
-    0x00000000005B3D05ULL,
-    0x00000000005B3D65ULL,
-    0x00000000005B9653ULL,
-    0x00000000005B9674ULL,
-    0x00000000005BA1F7ULL,
-    0x00000000005BACA4ULL,
-    0x00000000005C0474ULL,
-    0x00000000005C0594ULL,
-    0x00000000005C05B3ULL,
-    0x00000000005C0CACULL,
-    0x00000000005C1434ULL,
-    0x00000000005C1473ULL,
-    0x00000000005C14ADULL,
-    0x00000000005C15A5ULL,
-    0x00000000005C1654ULL,
-    0x00000000005C192CULL,
-    0x00000000005C24B3ULL,
-    0x00000000005C2585ULL,
-    0x00000000005C25C5ULL,
-    0x00000000005C25C7ULL,
-    0x00000000005C2674ULL,
-    0x00000000005C2693ULL,
-    0x00000000005C3C85ULL,
-    0x00000000005C3DA5ULL,
-    0x00000000005C3DD3ULL,
-    0x00000000005C4034ULL,
-    0x00000000005C40ACULL,
-    0x00000000005C41F3ULL,
-    0x00000000005C51ECULL,
-    0x00000000005C5241ULL,
-    0x00000000005C5485ULL,
-    0x00000000005C5593ULL,
-    0x00000000005C5594ULL,
-    0x00000000005C5642ULL,
-    0x00000000005C8673ULL,
-    0x00000000005C9653ULL,
-    0x00000000005CA5C7ULL,
-    0x00000000005CBE93ULL,
-    0x00000000005CC833ULL,
-    0x00000000005CC8B3ULL,
-    0x00000000005CC925ULL,
-    0x00000000005CC932ULL,
-    0x00000000005D25C5ULL,
-    0x0000000000608859ULL,
-    0x0000000000608985ULL,
-    0x0000000000608CA4ULL,
-    0x0000000000608CB2ULL,
-    0x0000000000608CB3ULL,
-    0x0000000000608CB4ULL,
-    0x0000000000608D21ULL,
-    0x0000000000608E81ULL,
-    0x0000000000608E93ULL,
-    0x0000000000609099ULL,
-    0x00000000006090A4ULL,
-    0x00000000006090B2ULL,
-    0x00000000006090B3ULL,
-    0x00000000006090E5ULL,
-    0x00000000006091F3ULL,
-    0x00000000006095C1ULL,
-    0x0000000000609659ULL,
-    0x00000000006098D3ULL,
-    0x00000000006098D9ULL,
-    0x0000000000609D2EULL,
-    0x000000000060A573ULL,
-    0x000000000060A593ULL,
-    0x000000000060A5C5ULL,
-    0x000000000060A5D3ULL,
-    0x000000000060A5D4ULL,
-    0x000000000060A653ULL,
-    0x000000000060A659ULL,
-    0x000000000060A688ULL,
-    0x000000000060ACA4ULL,
-    0x000000000060ACB2ULL,
-    0x000000000060ACB3ULL,
-    0x000000000060ACB9ULL,
-    0x000000000060AD25ULL,
-    0x000000000060AD32ULL,
-    0x000000000060B02AULL,
-    0x000000000060B193ULL,
-    0x000000000060B265ULL,
-    0x000000000060B4A4ULL,
-    0x000000000060B4B3ULL,
-    0x000000000060B82CULL,
-    0x000000000060B879ULL,
-    0x000000000060B893ULL,
-    0x000000000060B8B3ULL,
-    0x000000000060B8E1ULL,
-    0x000000000060B8EFULL,
-    0x000000000060B8F3ULL,
-    0x000000000060B973ULL,
-    0x000000000060B9D9ULL,
-    0x000000000060B9EEULL,
-    0x000000000060B9F3ULL,
-    0x000000000060BAADULL,
-    0x000000000060C532ULL,
-    0x000000000060C824ULL,
-    0x000000000060C865ULL,
-    0x000000000060C869ULL,
-    0x000000000060C879ULL,
-    0x000000000060C893ULL,
-    0x000000000060C8A4ULL,
-    0x000000000060C8B2ULL,
-    0x000000000060C8B3ULL,
-    0x000000000060C985ULL,
-    0x000000000060C993ULL,
-    0x000000000060C9B3ULL,
-    0x000000000060C9F3ULL,
-    0x000000000060CA4FULL,
-    0x000000000060CA65ULL,
-    0x000000000060CA93ULL,
-    0x000000000060CC69ULL,
-    0x000000000060CE89ULL,
-    0x000000000060CE93ULL,
-    0x000000000060D02CULL,
-    0x000000000060D0A4ULL,
-    0x000000000060D0B3ULL,
-    0x000000000060D199ULL,
-    0x000000000060D26FULL,
-    0x000000000060D299ULL,
-    0x000000000060D2E1ULL,
-    0x000000000060D4E8ULL,
-    0x000000000060D584ULL,
-    0x000000000060D594ULL,
-    0x000000000060D5C1ULL,
-    0x000000000060D5D3ULL,
-    0x000000000060D644ULL,
-    0x000000000060D693ULL,
-    0x000000000060D6C5ULL,
-    0x000000000060D833ULL,
-    0x000000000060D8ACULL,
-    0x000000000060D8B2ULL,
-    0x000000000060D8B3ULL,
-    0x000000000060D9F2ULL,
-    0x000000000060DAB3ULL,
-    0x000000000060DDD3ULL,
-    0x000000000060DDD9ULL,
-    0x000000000060E0A4ULL,
-    0x000000000060E0B3ULL,
-    0x000000000060E4A4ULL,
-    0x000000000060E4B2ULL,
-    0x000000000060E5C5ULL,
-    0x000000000060E645ULL,
-    0x000000000060E8A4ULL,
-    0x000000000060E8B3ULL,
-    0x0000000000628593ULL,
-    0x0000000000628645ULL,
-    0x0000000000628653ULL,
-    0x0000000000628654ULL,
-    0x0000000000628665ULL,
-    0x0000000000628674ULL,
-    0x0000000000628693ULL,
-    0x0000000000628745ULL,
-    0x0000000000628C2CULL,
-    0x0000000000628CB3ULL,
-    0x0000000000628D14ULL,
-    0x0000000000628D34ULL,
-    0x0000000000628D73ULL,
-    0x00000000006290B8ULL,
-    0x0000000000629453ULL,
-    0x0000000000629493ULL,
-    0x0000000000629593ULL,
-    0x00000000006295D3ULL,
-    0x0000000000629653ULL,
-    0x0000000000629665ULL,
-    0x0000000000629745ULL,
-    0x000000000062A1A5ULL,
-    0x000000000062A4EEULL,
-    0x000000000062A5D4ULL,
-    0x000000000062A674ULL,
-    0x000000000062B068ULL,
-    0x000000000062B124ULL,
-    0x000000000062B181ULL,
-    0x000000000062B193ULL,
-    0x000000000062B199ULL,
-    0x000000000062B1EEULL,
-    0x000000000062B293ULL,
-    0x000000000062B299ULL,
-    0x000000000062B42CULL,
-    0x000000000062B4B3ULL,
-    0x000000000062B5A5ULL,
-    0x000000000062B5B9ULL,
-    0x000000000062B6B2ULL,
-    0x000000000062B865ULL,
-    0x000000000062B893ULL,
-    0x000000000062B899ULL,
-    0x000000000062B933ULL,
-    0x000000000062B973ULL,
-    0x000000000062B9D9ULL,
-    0x000000000062BA93ULL,
-    0x000000000062BC93ULL,
-    0x000000000062BCC6ULL,
-    0x000000000062C82CULL,
-    0x000000000062C8B2ULL,
-    0x000000000062C8B3ULL,
-    0x000000000062C921ULL,
-    0x000000000062C999ULL,
-    0x000000000062C9A9ULL,
-    0x000000000062C9B3ULL,
-    0x000000000062C9D3ULL,
-    0x000000000062C9D9ULL,
-    0x000000000062CA59ULL,
-    0x000000000062CE65ULL,
-    0x000000000062CE81ULL,
-    0x000000000062CE93ULL,
-    0x000000000062CE99ULL,
-    0x000000000062D02CULL,
-    0x000000000062D033ULL,
-    0x000000000062D068ULL,
-    0x000000000062D0A4ULL,
-    0x000000000062D0B3ULL,
-    0x000000000062D124ULL,
-    0x000000000062D1F2ULL,
-    0x000000000062D281ULL,
-    0x000000000062D293ULL,
-    0x000000000062D2B3ULL,
-    0x000000000062D2E1ULL,
-    0x000000000062D432ULL,
-    0x000000000062D493ULL,
-    0x000000000062D4A4ULL,
-    0x000000000062D8B2ULL,
-    0x000000000062DCB2ULL,
-    0x000000000062E4A4ULL,
-    0x000000000062E4B2ULL,
-    0x000000000062E599ULL,
-    0x000000000062E8B3ULL,
-    0x000000000062EB59ULL,
-    0x0000000000648653ULL,
-    0x0000000000648693ULL,
-    0x00000000006488B2ULL,
-    0x0000000000648A4FULL,
-    0x0000000000648CB3ULL,
-    0x0000000000648D05ULL,
-    0x0000000000648D15ULL,
-    0x0000000000648D2EULL,
-    0x0000000000648DF3ULL,
-    0x0000000000648EB3ULL,
-    0x00000000006490B3ULL,
-    0x00000000006490E5ULL,
-    0x00000000006491F3ULL,
-    0x00000000006494D3ULL,
-    0x0000000000649584ULL,
-    0x00000000006495C4ULL,
-    0x00000000006495D4ULL,
-    0x0000000000649645ULL,
-    0x0000000000649653ULL,
-    0x0000000000649659ULL,
-    0x0000000000649674ULL,
-    0x00000000006498A4ULL,
-    0x00000000006498B2ULL,
-    0x00000000006498B3ULL,
-    0x0000000000649933ULL,
-    0x0000000000649A88ULL,
-    0x0000000000649A99ULL,
-    0x0000000000649CF9ULL,
-    0x0000000000649D14ULL,
-    0x0000000000649DF3ULL,
-    0x000000000064ACA4ULL,
-    0x000000000064ACB3ULL,
-    0x000000000064B032ULL,
-    0x000000000064B068ULL,
-    0x000000000064B0A4ULL,
-    0x000000000064B0B2ULL,
-    0x000000000064B0B3ULL,
-    0x000000000064B0B4ULL,
-    0x000000000064B129ULL,
-    0x000000000064B173ULL,
-    0x000000000064B185ULL,
-    0x000000000064B18FULL,
-    0x000000000064B193ULL,
-    0x000000000064B199ULL,
-    0x000000000064B1A9ULL,
-    0x000000000064B1B3ULL,
-    0x000000000064B1B9ULL,
-    0x000000000064B1F3ULL,
-    0x000000000064B288ULL,
-    0x000000000064B2ADULL,
-    0x000000000064B82CULL,
-    0x000000000064B861ULL,
-    0x000000000064B868ULL,
-    0x000000000064B893ULL,
-    0x000000000064B8A4ULL,
-    0x000000000064B8B2ULL,
-    0x000000000064B8B3ULL,
-    0x000000000064B933ULL,
-    0x000000000064B973ULL,
-    0x000000000064B9D9ULL,
-    0x000000000064B9F3ULL,
-    0x000000000064BE44ULL,
-    0x000000000064C513ULL,
-    0x000000000064C6A5ULL,
-    0x000000000064C8A4ULL,
-    0x000000000064C8B2ULL,
-    0x000000000064C8B3ULL,
-    0x000000000064C925ULL,
-    0x000000000064C973ULL,
-    0x000000000064C9B3ULL,
-    0x000000000064C9D3ULL,
-    0x000000000064CA59ULL,
-    0x000000000064CA74ULL,
-    0x000000000064CA88ULL,
-    0x000000000064CC73ULL,
-    0x000000000064CD19ULL,
-    0x000000000064CD73ULL,
-    0x000000000064CE93ULL,
-    0x000000000064CE99ULL,
-    0x000000000064D068ULL,
-    0x000000000064D199ULL,
-    0x000000000064D1C1ULL,
-    0x000000000064D285ULL,
-    0x000000000064D293ULL,
-    0x000000000064D8B2ULL,
-    0x000000000064D8B3ULL,
-    0x000000000064E0A4ULL,
-    0x000000000064E0B2ULL,
-    0x000000000064E0B3ULL,
-    0x000000000064E134ULL,
-    0x000000000064EB59ULL,
-    0x0000000000651584ULL,
-    0x0000000000653E44ULL,
-    0x0000000000660453ULL,
-    0x000000000066046BULL,
-    0x00000000006604C6ULL,
-    0x00000000006604F3ULL,
-    0x000000000066052CULL,
-    0x0000000000660532ULL,
-    0x0000000000660565ULL,
-    0x0000000000660573ULL,
-    0x0000000000660579ULL,
-    0x00000000006605A5ULL,
-    0x00000000006605ADULL,
-    0x00000000006605B3ULL,
-    0x00000000006605B9ULL,
-    0x00000000006605C5ULL,
-    0x00000000006605CBULL,
-    0x00000000006605D3ULL,
-    0x0000000000660613ULL,
-    0x0000000000660645ULL,
-    0x0000000000660659ULL,
-    0x0000000000660668ULL,
-    0x000000000066066BULL,
-    0x0000000000660693ULL,
-    0x00000000006606C1ULL,
-    0x00000000006606EEULL,
-    0x00000000006606F3ULL,
-    0x00000000006606F9ULL,
-    0x0000000000660719ULL,
-    0x0000000000660733ULL,
-    0x000000000066142DULL,
-    0x0000000000661433ULL,
-    0x000000000066146BULL,
-    0x00000000006614ABULL,
-    0x00000000006614B2ULL,
-    0x00000000006614B3ULL,
-    0x00000000006614B4ULL,
-    0x00000000006614F3ULL,
-    0x00000000006615A5ULL,
-    0x0000000000661668ULL,
-    0x00000000006616B2ULL,
-    0x00000000006616F3ULL,
-    0x0000000000661709ULL,
-    0x000000000066170FULL,
-    0x0000000000661733ULL,
-    0x000000000066246BULL,
-    0x0000000000662473ULL,
-    0x00000000006624A4ULL,
-    0x00000000006624B2ULL,
-    0x00000000006624B3ULL,
-    0x00000000006625B0ULL,
-    0x00000000006625B3ULL,
-    0x00000000006625C7ULL,
-    0x00000000006625D4ULL,
-    0x0000000000662613ULL,
-    0x0000000000662653ULL,
-    0x0000000000662654ULL,
-    0x000000000066266BULL,
-    0x0000000000662685ULL,
-    0x0000000000662693ULL,
-    0x0000000000662694ULL,
-    0x0000000000663C34ULL,
-    0x0000000000663C53ULL,
-    0x0000000000663C6BULL,
-    0x0000000000663C73ULL,
-    0x0000000000663CB3ULL,
-    0x0000000000663CF3ULL,
-    0x0000000000663DC7ULL,
-    0x0000000000663DE4ULL,
-    0x0000000000663DF2ULL,
-    0x0000000000663E13ULL,
-    0x0000000000663E41ULL,
-    0x0000000000663E53ULL,
-    0x0000000000663E59ULL,
-    0x0000000000663E68ULL,
-    0x0000000000663E73ULL,
-    0x0000000000663E81ULL,
-    0x0000000000663E85ULL,
-    0x0000000000663EB2ULL,
-    0x0000000000663EB4ULL,
-    0x0000000000663EEEULL,
-    0x0000000000663EF3ULL,
-    0x0000000000665453ULL,
-    0x00000000006654A4ULL,
-    0x00000000006654B3ULL,
-    0x00000000006654B9ULL,
-    0x00000000006654C6ULL,
-    0x0000000000665524ULL,
-    0x0000000000665565ULL,
-    0x0000000000665579ULL,
-    0x00000000006655A5ULL,
-    0x00000000006655B0ULL,
-    0x00000000006655C7ULL,
-    0x00000000006655CBULL,
-    0x00000000006655F2ULL,
-    0x0000000000665652ULL,
-    0x0000000000665668ULL,
-    0x0000000000665685ULL,
-    0x0000000000665699ULL,
-    0x0000000000665734ULL,
-    0x0000000000666459ULL,
-    0x00000000006664B2ULL,
-    0x0000000000666605ULL,
-    0x0000000000666685ULL,
-    0x0000000000678593ULL,
-    0x00000000006785B3ULL,
-    0x00000000006785B9ULL,
-    0x0000000000678C2CULL,
-    0x0000000000678EB3ULL,
-    0x000000000067950EULL,
-    0x0000000000679CB9ULL,
-    0x0000000000679CF9ULL,
-    0x0000000000679D25ULL,
-    0x0000000000679D85ULL,
-    0x0000000000679DF5ULL,
-    0x000000000067A1D3ULL,
-    0x000000000067A493ULL,
-    0x000000000067A593ULL,
-    0x000000000067A5D3ULL,
-    0x000000000067A674ULL,
-    0x000000000067B093ULL,
-    0x000000000067B0B9ULL,
-    0x000000000067B121ULL,
-    0x000000000067B123ULL,
-    0x000000000067B125ULL,
-    0x000000000067B12FULL,
-    0x000000000067B173ULL,
-    0x000000000067B179ULL,
-    0x000000000067B199ULL,
-    0x000000000067B4B3ULL,
-    0x000000000067B881ULL,
-    0x000000000067B893ULL,
-    0x000000000067B895ULL,
-    0x000000000067B8B3ULL,
-    0x000000000067B999ULL,
-    0x000000000067BA93ULL,
-    0x000000000067BC93ULL,
-    0x000000000067BC99ULL,
-    0x000000000067BD93ULL,
-    0x000000000067BE93ULL,
-    0x000000000067BE99ULL,
-    0x000000000067C82DULL,
-    0x000000000067C839ULL,
-    0x000000000067C853ULL,
-    0x000000000067C859ULL,
-    0x000000000067C865ULL,
-    0x000000000067C88FULL,
-    0x000000000067C893ULL,
-    0x000000000067C8ACULL,
-    0x000000000067C8B3ULL,
-    0x000000000067C8B8ULL,
-    0x000000000067C8E5ULL,
-    0x000000000067C8EFULL,
-    0x000000000067C973ULL,
-    0x000000000067C979ULL,
-    0x000000000067C9A5ULL,
-    0x000000000067C9B3ULL,
-    0x000000000067CA85ULL,
-    0x000000000067CA88ULL,
-    0x000000000067CA93ULL,
-    0x000000000067CA99ULL,
-    0x000000000067CAADULL,
-    0x000000000067CB41ULL,
-    0x000000000067CB45ULL,
-    0x000000000067CE61ULL,
-    0x000000000067CE65ULL,
-    0x000000000067D434ULL,
-    0x000000000067D493ULL,
-    0x000000000067D4B2ULL,
-    0x000000000067D4B4ULL,
-    0x000000000067D585ULL,
-    0x000000000067D593ULL,
-    0x000000000067D5C4ULL,
-    0x000000000067D5D4ULL,
-    0x000000000067D653ULL,
-    0x000000000067D688ULL,
-    0x000000000067D8A1ULL,
-    0x000000000067DD93ULL,
-    0x000000000067DE88ULL,
-    0x000000000067E0A4ULL,
-    0x000000000067E0B3ULL,
-    0x000000000067E125ULL,
-    0x000000000067E4B2ULL,
-    0x000000000067E585ULL,
-    0x000000000067E5C5ULL,
-    0x0000000000690453ULL,
-    0x000000000069046BULL,
-    0x0000000000690474ULL,
-    0x00000000006904F3ULL,
-    0x000000000069052CULL,
-    0x000000000069052DULL,
-    0x00000000006905A5ULL,
-    0x00000000006905C3ULL,
-    0x00000000006905CBULL,
-    0x0000000000690605ULL,
-    0x0000000000690613ULL,
-    0x0000000000690673ULL,
-    0x0000000000690685ULL,
-    0x0000000000690689ULL,
-    0x0000000000690693ULL,
-    0x00000000006906A4ULL,
-    0x00000000006906B3ULL,
-    0x0000000000690733ULL,
-    0x000000000069142BULL,
-    0x00000000006914A4ULL,
-    0x00000000006914B2ULL,
-    0x00000000006914B3ULL,
-    0x00000000006914B4ULL,
-    0x0000000000691534ULL,
-    0x00000000006915A4ULL,
-    0x00000000006915C1ULL,
-    0x00000000006915EEULL,
-    0x0000000000691645ULL,
-    0x0000000000691668ULL,
-    0x0000000000691693ULL,
-    0x0000000000692432ULL,
-    0x0000000000692453ULL,
-    0x00000000006924A4ULL,
-    0x00000000006924B2ULL,
-    0x00000000006924B3ULL,
-    0x00000000006924F3ULL,
-    0x000000000069258CULL,
-    0x0000000000692665ULL,
-    0x000000000069266BULL,
-    0x0000000000692674ULL,
-    0x0000000000692688ULL,
-    0x0000000000692693ULL,
-    0x0000000000692694ULL,
-    0x000000000069269AULL,
-    0x0000000000692745ULL,
-    0x000000000069275AULL,
-    0x0000000000693C6BULL,
-    0x0000000000693CB3ULL,
-    0x0000000000693CF3ULL,
-    0x0000000000693DC4ULL,
-    0x0000000000693DD3ULL,
-    0x0000000000693DD4ULL,
-    0x0000000000693E45ULL,
-    0x0000000000693E4EULL,
-    0x0000000000693E59ULL,
-    0x0000000000693E68ULL,
-    0x0000000000693E74ULL,
-    0x0000000000693E88ULL,
-    0x0000000000693EEEULL,
-    0x0000000000693EF3ULL,
-    0x0000000000693EF9ULL,
-    0x0000000000693F45ULL,
-    0x00000000006954F3ULL,
-    0x0000000000695534ULL,
-    0x00000000006955B0ULL,
-    0x0000000000695668ULL,
-    0x0000000000695674ULL,
-    0x00000000006964B2ULL,
-    0x00000000006A8832ULL,
-    0x00000000006A8859ULL,
-    0x00000000006A8A79ULL,
-    0x00000000006A8D73ULL,
-    0x00000000006A8EB3ULL,
-    0x00000000006A9099ULL,
-    0x00000000006A90E5ULL,
-    0x00000000006A90F9ULL,
-    0x00000000006A9593ULL,
-    0x00000000006A964FULL,
-    0x00000000006A98D3ULL,
-    0x00000000006A98D9ULL,
-    0x00000000006A9C2CULL,
-    0x00000000006A9CF9ULL,
-    0x00000000006A9D25ULL,
-    0x00000000006A9D2FULL,
-    0x00000000006A9D85ULL,
-    0x00000000006A9D99ULL,
-    0x00000000006A9EA5ULL,
-    0x00000000006A9EB3ULL,
-    0x00000000006AA933ULL,
-    0x00000000006AB193ULL,
-    0x00000000006AB199ULL,
-    0x00000000006AB4A4ULL,
-    0x00000000006AB4B2ULL,
-    0x00000000006AB4B3ULL,
-    0x00000000006AB4B4ULL,
-    0x00000000006AB889ULL,
-    0x00000000006AB893ULL,
-    0x00000000006AB899ULL,
-    0x00000000006AB8E9ULL,
-    0x00000000006AB8EFULL,
-    0x00000000006AB8F3ULL,
-    0x00000000006AB973ULL,
-    0x00000000006AB979ULL,
-    0x00000000006AB9D9ULL,
-    0x00000000006AC82CULL,
-    0x00000000006AC82EULL,
-    0x00000000006AC861ULL,
-    0x00000000006AC993ULL,
-    0x00000000006AC9ECULL,
-    0x00000000006AC9F2ULL,
-    0x00000000006ACA53ULL,
-    0x00000000006ACA59ULL,
-    0x00000000006ACA88ULL,
-    0x00000000006ACB45ULL,
-    0x00000000006ACB59ULL,
-    0x00000000006ACCA4ULL,
-    0x00000000006ACCA5ULL,
-    0x00000000006ACCACULL,
-    0x00000000006ACCB3ULL,
-    0x00000000006ACD2CULL,
-    0x00000000006ACD73ULL,
-    0x00000000006ACE79ULL,
-    0x00000000006ACE93ULL,
-    0x00000000006ACE99ULL,
-    0x00000000006AD1EEULL,
-    0x00000000006AE8A4ULL,
-    0x00000000006AE8A5ULL,
-    0x00000000006AE8B3ULL,
-    0x00000000006AE92CULL,
-    0x00000000006AEB59ULL,
-    0x00000000006C8CB3ULL,
-    0x00000000006CACA4ULL,
-    0x00000000006CACB3ULL,
-    0x00000000006CB0B3ULL,
-    0x00000000006CC893ULL,
-    0x00000000006CD285ULL,
-    0x0000000000708841ULL,
-    0x0000000000708859ULL,
-    0x0000000000708985ULL,
-    0x0000000000709089ULL,
-    0x00000000007090B3ULL,
-    0x00000000007090E5ULL,
-    0x0000000000709124ULL,
-    0x0000000000709133ULL,
-    0x0000000000709145ULL,
-    0x000000000070914FULL,
-    0x000000000070926FULL,
-    0x00000000007098C5ULL,
-    0x00000000007098D3ULL,
-    0x0000000000709CA4ULL,
-    0x0000000000709CB2ULL,
-    0x0000000000709CB3ULL,
-    0x000000000070A493ULL,
-    0x000000000070A599ULL,
-    0x000000000070A5D3ULL,
-    0x000000000070A653ULL,
-    0x000000000070A681ULL,
-    0x000000000070A693ULL,
-    0x000000000070A694ULL,
-    0x000000000070A9F3ULL,
-    0x000000000070B028ULL,
-    0x000000000070B033ULL,
-    0x000000000070B038ULL,
-    0x000000000070B0A1ULL,
-    0x000000000070B0A4ULL,
-    0x000000000070B0B3ULL,
-    0x000000000070B193ULL,
-    0x000000000070B199ULL,
-    0x000000000070B1F0ULL,
-    0x000000000070B2B4ULL,
-    0x000000000070B2CFULL,
-    0x000000000070B433ULL,
-    0x000000000070B439ULL,
-    0x000000000070B441ULL,
-    0x000000000070B445ULL,
-    0x000000000070B44FULL,
-    0x000000000070B453ULL,
-    0x000000000070B4A4ULL,
-    0x000000000070B4B2ULL,
-    0x000000000070B4B3ULL,
-    0x000000000070B4B9ULL,
-    0x000000000070B523ULL,
-    0x000000000070B52EULL,
-    0x000000000070B5A1ULL,
-    0x000000000070B5A5ULL,
-    0x000000000070B5B9ULL,
-    0x000000000070B613ULL,
-    0x000000000070B6B4ULL,
-    0x000000000070B868ULL,
-    0x000000000070B899ULL,
-    0x000000000070B8A6ULL,
-    0x000000000070B8B6ULL,
-    0x000000000070B8F3ULL,
-    0x000000000070B941ULL,
-    0x000000000070B9E6ULL,
-    0x000000000070BA93ULL,
-    0x000000000070BD93ULL,
-    0x000000000070C0A4ULL,
-    0x000000000070C0B2ULL,
-    0x000000000070C0B3ULL,
-    0x000000000070C1F3ULL,
-    0x000000000070C219ULL,
-    0x000000000070C845ULL,
-    0x000000000070C84FULL,
-    0x000000000070C853ULL,
-    0x000000000070C881ULL,
-    0x000000000070C8B3ULL,
-    0x000000000070C933ULL,
-    0x000000000070C9B3ULL,
-    0x000000000070C9C9ULL,
-    0x000000000070CA45ULL,
-    0x000000000070CA88ULL,
-    0x000000000070CAADULL,
-    0x000000000070CCB3ULL,
-    0x000000000070CE13ULL,
-    0x000000000070CE19ULL,
-    0x000000000070CE79ULL,
-    0x000000000070CE93ULL,
-    0x000000000070D068ULL,
-    0x000000000070D0A4ULL,
-    0x000000000070D0B2ULL,
-    0x000000000070D0B3ULL,
-    0x000000000070D113ULL,
-    0x000000000070D1F2ULL,
-    0x000000000070D468ULL,
-    0x000000000070D479ULL,
-    0x000000000070D493ULL,
-    0x000000000070D499ULL,
-    0x000000000070D4E5ULL,
-    0x000000000070D545ULL,
-    0x000000000070D594ULL,
-    0x000000000070D5B3ULL,
-    0x000000000070D5B9ULL,
-    0x000000000070D5D4ULL,
-    0x000000000070D613ULL,
-    0x000000000070D653ULL,
-    0x000000000070D673ULL,
-    0x000000000070D745ULL,
-    0x000000000070D759ULL,
-    0x000000000070D8ACULL,
-    0x000000000070D9F4ULL,
-    0x000000000070DC79ULL,
-    0x000000000070DC93ULL,
-    0x000000000070DD73ULL,
-    0x000000000070DD79ULL,
-    0x000000000070DE13ULL,
-    0x000000000070DE79ULL,
-    0x000000000070E42CULL,
-    0x000000000070E4B2ULL,
-    0x000000000070E599ULL,
-    0x000000000070E82CULL,
-    0x000000000070E832ULL,
-    0x000000000070E8A4ULL,
-    0x000000000070E8B2ULL,
-    0x000000000070E8B3ULL,
-    0x000000000070E9EEULL,
-    0x000000000070E9EFULL,
-    0x0000000000728593ULL,
-    0x00000000007285D3ULL,
-    0x0000000000728645ULL,
-    0x0000000000728653ULL,
-    0x0000000000728693ULL,
-    0x0000000000728AB2ULL,
-    0x0000000000728D6FULL,
-    0x0000000000728D73ULL,
-    0x0000000000729573ULL,
-    0x0000000000729579ULL,
-    0x0000000000729613ULL,
-    0x0000000000729665ULL,
-    0x0000000000729674ULL,
-    0x000000000072A674ULL,
-    0x000000000072A693ULL,
-    0x000000000072B093ULL,
-    0x000000000072B0A5ULL,
-    0x000000000072B124ULL,
-    0x000000000072B199ULL,
-    0x000000000072B293ULL,
-    0x000000000072B4ACULL,
-    0x000000000072B5A1ULL,
-    0x000000000072B5B9ULL,
-    0x000000000072B5F4ULL,
-    0x000000000072B82CULL,
-    0x000000000072B833ULL,
-    0x000000000072B8B3ULL,
-    0x000000000072B8B4ULL,
-    0x000000000072B923ULL,
-    0x000000000072B925ULL,
-    0x000000000072B929ULL,
-    0x000000000072B930ULL,
-    0x000000000072B9D9ULL,
-    0x000000000072B9E1ULL,
-    0x000000000072B9EDULL,
-    0x000000000072BA45ULL,
-    0x000000000072BA4FULL,
-    0x000000000072BA93ULL,
-    0x000000000072BA99ULL,
-    0x000000000072BAA1ULL,
-    0x000000000072BAB3ULL,
-    0x000000000072BC85ULL,
-    0x000000000072BD24ULL,
-    0x000000000072C828ULL,
-    0x000000000072C845ULL,
-    0x000000000072C8B3ULL,
-    0x000000000072C985ULL,
-    0x000000000072C9B3ULL,
-    0x000000000072C9B9ULL,
-    0x000000000072C9C5ULL,
-    0x000000000072CE65ULL,
-    0x000000000072CE6FULL,
-    0x000000000072CE85ULL,
-    0x000000000072CE93ULL,
-    0x000000000072D033ULL,
-    0x000000000072D2B0ULL,
-    0x000000000072D5B3ULL,
-    0x000000000072E42EULL,
-    0x000000000072E4B2ULL,
-    0x0000000000740674ULL,
-    0x0000000000740693ULL,
-    0x00000000007406B4ULL,
-    0x0000000000740749ULL,
-    0x00000000007414B3ULL,
-    0x0000000000741674ULL,
-    0x0000000000743E74ULL,
-    0x0000000000743EACULL,
-    0x000000000074658CULL,
-    0x00000000007485D4ULL,
-    0x00000000007488A4ULL,
-    0x00000000007488ACULL,
-    0x00000000007488B2ULL,
-    0x00000000007488B3ULL,
-    0x0000000000748989ULL,
-    0x0000000000748AB3ULL,
-    0x0000000000749099ULL,
-    0x0000000000749A93ULL,
-    0x0000000000749C33ULL,
-    0x0000000000749D05ULL,
-    0x0000000000749DF4ULL,
-    0x0000000000749EA5ULL,
-    0x000000000074B033ULL,
-    0x000000000074B093ULL,
-    0x000000000074B0B4ULL,
-    0x000000000074B193ULL,
-    0x000000000074B199ULL,
-    0x000000000074B219ULL,
-    0x000000000074B293ULL,
-    0x000000000074B4ACULL,
-    0x000000000074B5A5ULL,
-    0x000000000074B613ULL,
-    0x000000000074B619ULL,
-    0x000000000074B868ULL,
-    0x000000000074B8E5ULL,
-    0x000000000074B8F3ULL,
-    0x000000000074B973ULL,
-    0x000000000074B9D9ULL,
-    0x000000000074BB4FULL,
-    0x000000000074C1EEULL,
-    0x000000000074C20FULL,
-    0x000000000074C219ULL,
-    0x000000000074C279ULL,
-    0x000000000074C893ULL,
-    0x000000000074C993ULL,
-    0x000000000074C999ULL,
-    0x000000000074C9D3ULL,
-    0x000000000074C9EEULL,
-    0x000000000074C9F3ULL,
-    0x000000000074CA53ULL,
-    0x000000000074CA68ULL,
-    0x000000000074CA88ULL,
-    0x000000000074CA93ULL,
-    0x000000000074CDAFULL,
-    0x000000000074CDB3ULL,
-    0x000000000074CE93ULL,
-    0x000000000074D068ULL,
-    0x000000000074D0B3ULL,
-    0x000000000074D674ULL,
-    0x000000000074D8A4ULL,
-    0x000000000074D8AEULL,
-    0x000000000074D8B2ULL,
-    0x000000000074D8B3ULL,
-    0x000000000074E9AFULL,
-    0x0000000000760465ULL,
-    0x0000000000760485ULL,
-    0x0000000000760493ULL,
-    0x0000000000760499ULL,
-    0x000000000076052BULL,
-    0x0000000000760532ULL,
-    0x00000000007605B3ULL,
-    0x00000000007605C4ULL,
-    0x00000000007605D3ULL,
-    0x0000000000760645ULL,
-    0x0000000000760659ULL,
-    0x0000000000760673ULL,
-    0x00000000007606ADULL,
-    0x00000000007606B2ULL,
-    0x0000000000760745ULL,
-    0x0000000000760759ULL,
-    0x000000000076142DULL,
-    0x000000000076142EULL,
-    0x0000000000761441ULL,
-    0x0000000000761445ULL,
-    0x0000000000761459ULL,
-    0x0000000000761485ULL,
-    0x0000000000761493ULL,
-    0x00000000007614A4ULL,
-    0x00000000007614ABULL,
-    0x00000000007614B3ULL,
-    0x00000000007614B4ULL,
-    0x0000000000761533ULL,
-    0x00000000007615D3ULL,
-    0x00000000007615D4ULL,
-    0x0000000000761733ULL,
-    0x000000000076242CULL,
-    0x0000000000762433ULL,
-    0x0000000000762453ULL,
-    0x0000000000762485ULL,
-    0x00000000007624C6ULL,
-    0x00000000007624D4ULL,
-    0x0000000000762565ULL,
-    0x00000000007625A5ULL,
-    0x00000000007625B3ULL,
-    0x00000000007625D4ULL,
-    0x000000000076266BULL,
-    0x0000000000762693ULL,
-    0x000000000076269AULL,
-    0x0000000000763C2DULL,
-    0x0000000000763C34ULL,
-    0x0000000000763C45ULL,
-    0x0000000000763C49ULL,
-    0x0000000000763C53ULL,
-    0x0000000000763C59ULL,
-    0x0000000000763C85ULL,
-    0x0000000000763CE7ULL,
-    0x0000000000763DB3ULL,
-    0x0000000000763DEDULL,
-    0x0000000000763DF0ULL,
-    0x0000000000763E13ULL,
-    0x0000000000763E59ULL,
-    0x0000000000763E73ULL,
-    0x0000000000763E74ULL,
-    0x0000000000763EB4ULL,
-    0x0000000000763EC5ULL,
-    0x0000000000763EF3ULL,
-    0x0000000000763F45ULL,
-    0x00000000007654A4ULL,
-    0x00000000007654B2ULL,
-    0x00000000007654B3ULL,
-    0x00000000007654B9ULL,
-    0x00000000007654F3ULL,
-    0x00000000007655A5ULL,
-    0x00000000007655B3ULL,
-    0x00000000007655EEULL,
-    0x0000000000765685ULL,
-    0x0000000000765693ULL,
-    0x0000000000766608ULL,
-    0x000000000077064CULL,
-    0x0000000000770652ULL,
-    0x0000000000770653ULL,
-    0x0000000000770668ULL,
-    0x0000000000770693ULL,
-    0x00000000007706EEULL,
-    0x00000000007706F3ULL,
-    0x0000000000773DA5ULL,
-    0x0000000000773EF3ULL,
-    0x0000000000778493ULL,
-    0x00000000007784D3ULL,
-    0x0000000000778593ULL,
-    0x0000000000778659ULL,
-    0x0000000000778693ULL,
-    0x0000000000778699ULL,
-    0x000000000077882EULL,
-    0x0000000000778832ULL,
-    0x0000000000778849ULL,
-    0x000000000077884FULL,
-    0x0000000000778859ULL,
-    0x0000000000778933ULL,
-    0x00000000007789F3ULL,
-    0x00000000007790B4ULL,
-    0x0000000000779199ULL,
-    0x000000000077926FULL,
-    0x0000000000779593ULL,
-    0x0000000000779653ULL,
-    0x0000000000779674ULL,
-    0x0000000000779688ULL,
-    0x0000000000779699ULL,
-    0x00000000007798B2ULL,
-    0x00000000007798D3ULL,
-    0x0000000000779CE1ULL,
-    0x0000000000779DF3ULL,
-    0x000000000077A4B2ULL,
-    0x000000000077A5C7ULL,
-    0x000000000077A933ULL,
-    0x000000000077B093ULL,
-    0x000000000077B099ULL,
-    0x000000000077B0ADULL,
-    0x000000000077B0B3ULL,
-    0x000000000077B0D3ULL,
-    0x000000000077B199ULL,
-    0x000000000077B205ULL,
-    0x000000000077B213ULL,
-    0x000000000077B44FULL,
-    0x000000000077B4B2ULL,
-    0x000000000077B601ULL,
-    0x000000000077B824ULL,
-    0x000000000077B868ULL,
-    0x000000000077B8A6ULL,
-    0x000000000077B8B2ULL,
-    0x000000000077B8F3ULL,
-    0x000000000077B921ULL,
-    0x000000000077B926ULL,
-    0x000000000077B973ULL,
-    0x000000000077B9C1ULL,
-    0x000000000077B9E6ULL,
-    0x000000000077BB33ULL,
-    0x000000000077BB4FULL,
-    0x000000000077BC59ULL,
-    0x000000000077BC93ULL,
-    0x000000000077BC99ULL,
-    0x000000000077BCB9ULL,
-    0x000000000077BCD3ULL,
-    0x000000000077BCD9ULL,
-    0x000000000077BCF3ULL,
-    0x000000000077BD79ULL,
-    0x000000000077BD84ULL,
-    0x000000000077BD93ULL,
-    0x000000000077BD99ULL,
-    0x000000000077BDD3ULL,
-    0x000000000077BDD9ULL,
-    0x000000000077BE13ULL,
-    0x000000000077BE19ULL,
-    0x000000000077BE53ULL,
-    0x000000000077BE59ULL,
-    0x000000000077BE65ULL,
-    0x000000000077BE79ULL,
-    0x000000000077C02BULL,
-    0x000000000077C12BULL,
-    0x000000000077C82CULL,
-    0x000000000077C833ULL,
-    0x000000000077C8A4ULL,
-    0x000000000077C8B3ULL,
-    0x000000000077C8E5ULL,
-    0x000000000077C933ULL,
-    0x000000000077C9B3ULL,
-    0x000000000077C9B9ULL,
-    0x000000000077CA13ULL,
-    0x000000000077CA65ULL,
-    0x000000000077CA79ULL,
-    0x000000000077CD14ULL,
-    0x000000000077CE65ULL,
-    0x000000000077D068ULL,
-    0x000000000077D113ULL,
-    0x000000000077D119ULL,
-    0x000000000077D281ULL,
-    0x000000000077D468ULL,
-    0x000000000077D4E5ULL,
-    0x000000000077D573ULL,
-    0x000000000077D641ULL,
-    0x000000000077D644ULL,
-    0x000000000077D693ULL,
-    0x000000000077D699ULL,
-    0x000000000077DC2EULL,
-    0x000000000077DC93ULL,
-    0x000000000077DCD3ULL,
-    0x000000000077DD73ULL,
-    0x000000000077DD93ULL,
-    0x000000000077DDD3ULL,
-    0x000000000077E0B3ULL,
-    0x000000000077E52DULL,
-    0x000000000077E585ULL,
-    0x000000000079042CULL,
-    0x0000000000790453ULL,
-    0x0000000000790465ULL,
-    0x0000000000790485ULL,
-    0x0000000000790493ULL,
-    0x00000000007904C6ULL,
-    0x00000000007904D4ULL,
-    0x000000000079052CULL,
-    0x000000000079052EULL,
-    0x0000000000790530ULL,
-    0x00000000007905A1ULL,
-    0x00000000007905A5ULL,
-    0x00000000007905B0ULL,
-    0x00000000007905B3ULL,
-    0x00000000007905C1ULL,
-    0x00000000007905C4ULL,
-    0x00000000007905D3ULL,
-    0x00000000007905D4ULL,
-    0x0000000000790605ULL,
-    0x0000000000790608ULL,
-    0x0000000000790619ULL,
-    0x0000000000790670ULL,
-    0x0000000000790673ULL,
-    0x0000000000790685ULL,
-    0x00000000007906C5ULL,
-    0x00000000007906D3ULL,
-    0x00000000007906D9ULL,
-    0x0000000000790733ULL,
-    0x0000000000790745ULL,
-    0x0000000000791434ULL,
-    0x0000000000791445ULL,
-    0x000000000079144FULL,
-    0x0000000000791465ULL,
-    0x00000000007914A4ULL,
-    0x00000000007914ABULL,
-    0x00000000007914AEULL,
-    0x00000000007914B3ULL,
-    0x00000000007914B4ULL,
-    0x00000000007914E5ULL,
-    0x00000000007914EFULL,
-    0x000000000079152EULL,
-    0x00000000007915D3ULL,
-    0x0000000000791665ULL,
-    0x00000000007916C5ULL,
-    0x00000000007916F3ULL,
-    0x0000000000791733ULL,
-    0x0000000000792465ULL,
-    0x0000000000792485ULL,
-    0x0000000000792493ULL,
-    0x00000000007924A6ULL,
-    0x00000000007924C6ULL,
-    0x00000000007924D4ULL,
-    0x00000000007924F3ULL,
-    0x0000000000792565ULL,
-    0x000000000079258CULL,
-    0x00000000007925A5ULL,
-    0x00000000007925B9ULL,
-    0x00000000007925C4ULL,
-    0x00000000007925D3ULL,
-    0x00000000007925F4ULL,
-    0x0000000000792605ULL,
-    0x0000000000792613ULL,
-    0x0000000000792614ULL,
-    0x0000000000792619ULL,
-    0x0000000000792665ULL,
-    0x0000000000792674ULL,
-    0x0000000000792679ULL,
-    0x0000000000792688ULL,
-    0x0000000000792693ULL,
-    0x0000000000792745ULL,
-    0x0000000000793C2EULL,
-    0x0000000000793C34ULL,
-    0x0000000000793C99ULL,
-    0x0000000000793CF3ULL,
-    0x0000000000793D2EULL,
-    0x0000000000793D73ULL,
-    0x0000000000793DA1ULL,
-    0x0000000000793DC5ULL,
-    0x0000000000793DE6ULL,
-    0x0000000000793DEDULL,
-    0x0000000000793E05ULL,
-    0x0000000000793E73ULL,
-    0x0000000000793E7AULL,
-    0x0000000000793E93ULL,
-    0x0000000000793EA6ULL,
-    0x0000000000793EB0ULL,
-    0x0000000000793EB4ULL,
-    0x0000000000793EC5ULL,
-    0x0000000000793ED9ULL,
-    0x0000000000793EECULL,
-    0x0000000000793EEEULL,
-    0x0000000000793EF3ULL,
-    0x0000000000794993ULL,
-    0x0000000000794A4CULL,
-    0x0000000000795453ULL,
-    0x00000000007954A4ULL,
-    0x00000000007954ACULL,
-    0x00000000007954B3ULL,
-    0x00000000007954C5ULL,
-    0x00000000007954C6ULL,
-    0x00000000007955A5ULL,
-    0x00000000007955B0ULL,
-    0x00000000007955C4ULL,
-    0x00000000007955D4ULL,
-    0x0000000000796465ULL,
-    0x0000000000796485ULL,
-    0x0000000000796565ULL,
-    0x0000000000796605ULL,
-    0x0000000000796614ULL,
-    0x00000000007A846FULL,
-    0x00000000007A85C1ULL,
-    0x00000000007A85CFULL,
-    0x00000000007A85D3ULL,
-    0x00000000007A8644ULL,
-    0x00000000007A8653ULL,
-    0x00000000007A86C1ULL,
-    0x00000000007A8D73ULL,
-    0x00000000007A8D79ULL,
-    0x00000000007A90B3ULL,
-    0x00000000007A9673ULL,
-    0x00000000007A9674ULL,
-    0x00000000007A98D3ULL,
-    0x00000000007A9C33ULL,
-    0x00000000007AA485ULL,
-    0x00000000007AA493ULL,
-    0x00000000007AA584ULL,
-    0x00000000007AA585ULL,
-    0x00000000007AA594ULL,
-    0x00000000007AA5B0ULL,
-    0x00000000007AA64FULL,
-    0x00000000007AA665ULL,
-    0x00000000007AB027ULL,
-    0x00000000007AB032ULL,
-    0x00000000007AB033ULL,
-    0x00000000007AB068ULL,
-    0x00000000007AB0B3ULL,
-    0x00000000007AB0B4ULL,
-    0x00000000007AB0D3ULL,
-    0x00000000007AB0D9ULL,
-    0x00000000007AB193ULL,
-    0x00000000007AB199ULL,
-    0x00000000007AB208ULL,
-    0x00000000007AB213ULL,
-    0x00000000007AB219ULL,
-    0x00000000007AB44FULL,
-    0x00000000007AB5A1ULL,
-    0x00000000007AB5A9ULL,
-    0x00000000007AB5B9ULL,
-    0x00000000007AB613ULL,
-    0x00000000007AB899ULL,
-    0x00000000007AB8E5ULL,
-    0x00000000007AB8F9ULL,
-    0x00000000007AB973ULL,
-    0x00000000007AB979ULL,
-    0x00000000007AB9D9ULL,
-    0x00000000007AC219ULL,
-    0x00000000007AC52EULL,
-    0x00000000007AC899ULL,
-    0x00000000007AC8E5ULL,
-    0x00000000007AC993ULL,
-    0x00000000007AC999ULL,
-    0x00000000007AC9D3ULL,
-    0x00000000007ACA59ULL,
-    0x00000000007ACA68ULL,
-    0x00000000007ACAB3ULL,
-    0x00000000007ACD19ULL,
-    0x00000000007ACD81ULL,
-    0x00000000007ACD85ULL,
-    0x00000000007ACD89ULL,
-    0x00000000007ACE79ULL,
-    0x00000000007ACE8FULL,
-    0x00000000007ACE93ULL,
-    0x00000000007ACE99ULL,
-    0x00000000007AD279ULL,
-    0x00000000007AD281ULL,
-    0x00000000007AD299ULL,
-    0x00000000007AE4A4ULL,
-    0x00000000007AE585ULL,
-    0x00000000007AE5F4ULL,
-    0x00000000007AE665ULL,
-    0x00000000007BA5C5ULL,
-    0x00000000007C8593ULL,
-    0x00000000007C85D3ULL,
-    0x00000000007C88A4ULL,
-    0x00000000007C88B3ULL,
-    0x00000000007C9584ULL,
-    0x00000000007CB613ULL,
-    0x00000000007CB825ULL,
-    0x00000000007CB925ULL,
-    0x00000000007CB9D9ULL,
-    0x00000000007CB9F3ULL,
-    0x00000000007CBF41ULL,
-    0x00000000007CC1F3ULL,
-    0x00000000007CC20FULL,
-    0x00000000007CC219ULL,
-    0x00000000007CC279ULL,
-    0x00000000007CC82CULL,
-    0x00000000007CC8A4ULL,
-    0x00000000007CC8B3ULL,
-    0x00000000007CC9EEULL,
-    0x00000000007CC9F3ULL,
-    0x00000000007CCAB3ULL,
-    0x00000000007CD0B3ULL,
-    0x00000000007CD8A4ULL,
-    0x00000000007CD8B3ULL,
-    0x00000000008084D3ULL,
-    0x0000000000808653ULL,
-    0x0000000000808934ULL,
-    0x0000000000808985ULL,
-    0x0000000000808AB3ULL,
-    0x0000000000808CABULL,
-    0x0000000000808D73ULL,
-    0x000000000080902CULL,
-    0x00000000008090A4ULL,
-    0x00000000008090B3ULL,
-    0x0000000000809149ULL,
-    0x0000000000809274ULL,
-    0x00000000008095B3ULL,
-    0x0000000000809693ULL,
-    0x00000000008098D3ULL,
-    0x000000000080993AULL,
-    0x0000000000809A93ULL,
-    0x0000000000809CF3ULL,
-    0x000000000080A033ULL,
-    0x000000000080A46BULL,
-    0x000000000080A561ULL,
-    0x000000000080A573ULL,
-    0x000000000080A575ULL,
-    0x000000000080A593ULL,
-    0x000000000080A599ULL,
-    0x000000000080A5D3ULL,
-    0x000000000080A5D4ULL,
-    0x000000000080A653ULL,
-    0x000000000080A659ULL,
-    0x000000000080A688ULL,
-    0x000000000080A8B3ULL,
-    0x000000000080A933ULL,
-    0x000000000080A949ULL,
-    0x000000000080AC2DULL,
-    0x000000000080AC33ULL,
-    0x000000000080ACA1ULL,
-    0x000000000080ACB3ULL,
-    0x000000000080AD2DULL,
-    0x000000000080AEB3ULL,
-    0x000000000080B02CULL,
-    0x000000000080B0A4ULL,
-    0x000000000080B0B2ULL,
-    0x000000000080B0B3ULL,
-    0x000000000080B0C1ULL,
-    0x000000000080B0D3ULL,
-    0x000000000080B124ULL,
-    0x000000000080B18FULL,
-    0x000000000080B193ULL,
-    0x000000000080B1A1ULL,
-    0x000000000080B1B3ULL,
-    0x000000000080B1EEULL,
-    0x000000000080B1F3ULL,
-    0x000000000080B265ULL,
-    0x000000000080B293ULL,
-    0x000000000080B2C1ULL,
-    0x000000000080B2C5ULL,
-    0x000000000080B2E1ULL,
-    0x000000000080B42CULL,
-    0x000000000080B441ULL,
-    0x000000000080B4A4ULL,
-    0x000000000080B4B3ULL,
-    0x000000000080B5B9ULL,
-    0x000000000080B741ULL,
-    0x000000000080B830ULL,
-    0x000000000080B865ULL,
-    0x000000000080B868ULL,
-    0x000000000080B893ULL,
-    0x000000000080B899ULL,
-    0x000000000080B8E9ULL,
-    0x000000000080B8F3ULL,
-    0x000000000080B973ULL,
-    0x000000000080B979ULL,
-    0x000000000080BA61ULL,
-    0x000000000080BA65ULL,
-    0x000000000080BA93ULL,
-    0x000000000080BD85ULL,
-    0x000000000080BDA1ULL,
-    0x000000000080C038ULL,
-    0x000000000080C199ULL,
-    0x000000000080C209ULL,
-    0x000000000080C219ULL,
-    0x000000000080C2B3ULL,
-    0x000000000080C82DULL,
-    0x000000000080C893ULL,
-    0x000000000080C899ULL,
-    0x000000000080C8A4ULL,
-    0x000000000080C8ADULL,
-    0x000000000080C8B3ULL,
-    0x000000000080C92DULL,
-    0x000000000080C973ULL,
-    0x000000000080C993ULL,
-    0x000000000080C9B3ULL,
-    0x000000000080C9D3ULL,
-    0x000000000080C9F3ULL,
-    0x000000000080CA13ULL,
-    0x000000000080CA19ULL,
-    0x000000000080CA59ULL,
-    0x000000000080CA68ULL,
-    0x000000000080CA93ULL,
-    0x000000000080CD19ULL,
-    0x000000000080CD73ULL,
-    0x000000000080CE13ULL,
-    0x000000000080CE81ULL,
-    0x000000000080CE85ULL,
-    0x000000000080CE99ULL,
-    0x000000000080D068ULL,
-    0x000000000080D0A4ULL,
-    0x000000000080D0B2ULL,
-    0x000000000080D0B3ULL,
-    0x000000000080D101ULL,
-    0x000000000080D493ULL,
-    0x000000000080D4D3ULL,
-    0x000000000080D4E8ULL,
-    0x000000000080D584ULL,
-    0x000000000080D58DULL,
-    0x000000000080D593ULL,
-    0x000000000080D594ULL,
-    0x000000000080D5D3ULL,
-    0x000000000080D5D4ULL,
-    0x000000000080D665ULL,
-    0x000000000080D685ULL,
-    0x000000000080D8AEULL,
-    0x000000000080D8B2ULL,
-    0x000000000080D8B3ULL,
-    0x000000000080D9E3ULL,
-    0x000000000080DCA4ULL,
-    0x000000000080DD73ULL,
-    0x000000000080DDB3ULL,
-    0x000000000080DE65ULL,
-    0x000000000080E4A4ULL,
-    0x000000000080E4B2ULL,
-    0x000000000080E4B9ULL,
-    0x000000000080E585ULL,
-    0x000000000080E82EULL,
-    0x000000000080E8A4ULL,
-    0x000000000080E8ACULL,
-    0x000000000080E8B2ULL,
-    0x000000000080E8B3ULL,
-    0x0000000000828493ULL,
-    0x0000000000828499ULL,
-    0x0000000000828584ULL,
-    0x0000000000828593ULL,
-    0x00000000008285A5ULL,
-    0x0000000000828613ULL,
-    0x0000000000828619ULL,
-    0x0000000000828644ULL,
-    0x0000000000828645ULL,
-    0x0000000000828653ULL,
-    0x0000000000828654ULL,
-    0x0000000000828674ULL,
-    0x0000000000828688ULL,
-    0x0000000000828693ULL,
-    0x00000000008286C5ULL,
-    0x00000000008286D9ULL,
-    0x00000000008288AEULL,
-    0x00000000008288B3ULL,
-    0x0000000000828D14ULL,
-    0x0000000000828D73ULL,
-    0x00000000008290B2ULL,
-    0x00000000008290E5ULL,
-    0x00000000008290F9ULL,
-    0x0000000000829493ULL,
-    0x0000000000829499ULL,
-    0x0000000000829593ULL,
-    0x0000000000829745ULL,
-    0x0000000000829A85ULL,
-    0x0000000000829A93ULL,
-    0x0000000000829A99ULL,
-    0x000000000082A493ULL,
-    0x000000000082A4E8ULL,
-    0x000000000082A593ULL,
-    0x000000000082A653ULL,
-    0x000000000082A674ULL,
-    0x000000000082A822ULL,
-    0x000000000082AA41ULL,
-    0x000000000082B0A4ULL,
-    0x000000000082B0B3ULL,
-    0x000000000082B12FULL,
-    0x000000000082B138ULL,
-    0x000000000082B18FULL,
-    0x000000000082B193ULL,
-    0x000000000082B1B3ULL,
-    0x000000000082B1F3ULL,
-    0x000000000082B1F4ULL,
-    0x000000000082B213ULL,
-    0x000000000082B2C5ULL,
-    0x000000000082B42CULL,
-    0x000000000082B4B3ULL,
-    0x000000000082B523ULL,
-    0x000000000082B52EULL,
-    0x000000000082B613ULL,
-    0x000000000082B619ULL,
-    0x000000000082B865ULL,
-    0x000000000082B868ULL,
-    0x000000000082B893ULL,
-    0x000000000082B8E5ULL,
-    0x000000000082B9C1ULL,
-    0x000000000082B9D9ULL,
-    0x000000000082BA59ULL,
-    0x000000000082BA93ULL,
-    0x000000000082C032ULL,
-    0x000000000082C853ULL,
-    0x000000000082C859ULL,
-    0x000000000082C893ULL,
-    0x000000000082C8B3ULL,
-    0x000000000082C993ULL,
-    0x000000000082C9A1ULL,
-    0x000000000082C9B3ULL,
-    0x000000000082C9D3ULL,
-    0x000000000082C9EEULL,
-    0x000000000082C9F3ULL,
-    0x000000000082CA59ULL,
-    0x000000000082CA65ULL,
-    0x000000000082CA9AULL,
-    0x000000000082CB25ULL,
-    0x000000000082CE13ULL,
-    0x000000000082CE93ULL,
-    0x000000000082D0B3ULL,
-    0x000000000082D113ULL,
-    0x000000000082D468ULL,
-    0x000000000082D4E8ULL,
-    0x000000000082D8A1ULL,
-    0x000000000082DCA4ULL,
-    0x000000000082DCB2ULL,
-    0x000000000082DCE8ULL,
-    0x000000000082E024ULL,
-    0x000000000082E0A4ULL,
-    0x000000000082E0B2ULL,
-    0x000000000082E0B3ULL,
-    0x000000000082E32CULL,
-    0x000000000082E4A4ULL,
-    0x00000000008485D4ULL,
-    0x0000000000848D73ULL,
-    0x00000000008490A4ULL,
-    0x00000000008490B2ULL,
-    0x00000000008490B3ULL,
-    0x00000000008495B3ULL,
-    0x0000000000849D13ULL,
-    0x0000000000849D14ULL,
-    0x000000000084A822ULL,
-    0x000000000084AA41ULL,
-    0x000000000084ACA4ULL,
-    0x000000000084ACB2ULL,
-    0x000000000084ACB3ULL,
-    0x000000000084ADE9ULL,
-    0x000000000084B032ULL,
-    0x000000000084B068ULL,
-    0x000000000084B18FULL,
-    0x000000000084B193ULL,
-    0x000000000084B199ULL,
-    0x000000000084B293ULL,
-    0x000000000084B2ADULL,
-    0x000000000084B2B3ULL,
-    0x000000000084B44FULL,
-    0x000000000084B835ULL,
-    0x000000000084B893ULL,
-    0x000000000084B8E5ULL,
-    0x000000000084B8F3ULL,
-    0x000000000084B979ULL,
-    0x000000000084B9D9ULL,
-    0x000000000084BA93ULL,
-    0x000000000084BD33ULL,
-    0x000000000084C199ULL,
-    0x000000000084C20FULL,
-    0x000000000084C219ULL,
-    0x000000000084C8A4ULL,
-    0x000000000084C8A5ULL,
-    0x000000000084C8B2ULL,
-    0x000000000084C8B3ULL,
-    0x000000000084CE79ULL,
-    0x000000000084CE93ULL,
-    0x000000000084D068ULL,
-    0x000000000084D105ULL,
-    0x000000000084D8A4ULL,
-    0x000000000084D8B2ULL,
-    0x000000000084D8B3ULL,
-    0x000000000084E8AEULL,
-    0x00000000008784A4ULL,
-    0x00000000008784F9ULL,
-    0x0000000000878644ULL,
-    0x0000000000878653ULL,
-    0x0000000000878659ULL,
-    0x0000000000878674ULL,
-    0x0000000000878859ULL,
-    0x00000000008789F3ULL,
-    0x0000000000878D73ULL,
-    0x0000000000878EB3ULL,
-    0x0000000000879024ULL,
-    0x0000000000879141ULL,
-    0x0000000000879653ULL,
-    0x0000000000879C2EULL,
-    0x0000000000879CAEULL,
-    0x0000000000879CF3ULL,
-    0x0000000000879D13ULL,
-    0x000000000087A0A4ULL,
-    0x000000000087A46BULL,
-    0x000000000087A4A4ULL,
-    0x000000000087A573ULL,
-    0x000000000087A5C7ULL,
-    0x000000000087A665ULL,
-    0x000000000087A674ULL,
-    0x000000000087AC33ULL,
-    0x000000000087ACA4ULL,
-    0x000000000087ACB3ULL,
-    0x000000000087ACB9ULL,
-    0x000000000087AD33ULL,
-    0x000000000087AD75ULL,
-    0x000000000087AEADULL,
-    0x000000000087B093ULL,
-    0x000000000087B0A4ULL,
-    0x000000000087B0B3ULL,
-    0x000000000087B0B9ULL,
-    0x000000000087B173ULL,
-    0x000000000087B181ULL,
-    0x000000000087B18FULL,
-    0x000000000087B199ULL,
-    0x000000000087B1A5ULL,
-    0x000000000087B1B3ULL,
-    0x000000000087B1EEULL,
-    0x000000000087B1F3ULL,
-    0x000000000087B293ULL,
-    0x000000000087B433ULL,
-    0x000000000087B4A4ULL,
-    0x000000000087B4B2ULL,
-    0x000000000087B4B3ULL,
-    0x000000000087B4B9ULL,
-    0x000000000087B525ULL,
-    0x000000000087B5A5ULL,
-    0x000000000087B82EULL,
-    0x000000000087B881ULL,
-    0x000000000087B893ULL,
-    0x000000000087B8A4ULL,
-    0x000000000087B8B2ULL,
-    0x000000000087B8B3ULL,
-    0x000000000087B8B9ULL,
-    0x000000000087B8E9ULL,
-    0x000000000087B8F3ULL,
-    0x000000000087B973ULL,
-    0x000000000087B979ULL,
-    0x000000000087B9F2ULL,
-    0x000000000087BC68ULL,
-    0x000000000087BC93ULL,
-    0x000000000087BC99ULL,
-    0x000000000087BCB9ULL,
-    0x000000000087BCD3ULL,
-    0x000000000087BD61ULL,
-    0x000000000087BD73ULL,
-    0x000000000087BD79ULL,
-    0x000000000087BD99ULL,
-    0x000000000087BDD3ULL,
-    0x000000000087BE13ULL,
-    0x000000000087BE44ULL,
-    0x000000000087BE53ULL,
-    0x000000000087BE68ULL,
-    0x000000000087BE93ULL,
-    0x000000000087BE99ULL,
-    0x000000000087BEC5ULL,
-    0x000000000087C02BULL,
-    0x000000000087C0A4ULL,
-    0x000000000087C0B2ULL,
-    0x000000000087C0B3ULL,
-    0x000000000087C219ULL,
-    0x000000000087C828ULL,
-    0x000000000087C82CULL,
-    0x000000000087C833ULL,
-    0x000000000087C885ULL,
-    0x000000000087C933ULL,
-    0x000000000087C973ULL,
-    0x000000000087C9A5ULL,
-    0x000000000087C9D3ULL,
-    0x000000000087C9D9ULL,
-    0x000000000087CA65ULL,
-    0x000000000087CA74ULL,
-    0x000000000087CA79ULL,
-    0x000000000087CCA4ULL,
-    0x000000000087CCACULL,
-    0x000000000087CCAEULL,
-    0x000000000087CCB2ULL,
-    0x000000000087CCB3ULL,
-    0x000000000087CCB9ULL,
-    0x000000000087CE81ULL,
-    0x000000000087CE93ULL,
-    0x000000000087D068ULL,
-    0x000000000087D0ACULL,
-    0x000000000087D0AEULL,
-    0x000000000087D199ULL,
-    0x000000000087D299ULL,
-    0x000000000087D4C6ULL,
-    0x000000000087D4D3ULL,
-    0x000000000087D4E8ULL,
-    0x000000000087D5C4ULL,
-    0x000000000087D649ULL,
-    0x000000000087D653ULL,
-    0x000000000087D665ULL,
-    0x000000000087D693ULL,
-    0x000000000087D8A1ULL,
-    0x000000000087D8A4ULL,
-    0x000000000087D8ACULL,
-    0x000000000087D8AEULL,
-    0x000000000087D8B2ULL,
-    0x000000000087D8B3ULL,
-    0x000000000087DC45ULL,
-    0x000000000087DC99ULL,
-    0x000000000087DCB3ULL,
-    0x000000000087DCC6ULL,
-    0x000000000087DCD3ULL,
-    0x000000000087DD73ULL,
-    0x000000000087DD93ULL,
-    0x000000000087DE45ULL,
-    0x000000000087DE6FULL,
-    0x000000000087E0A4ULL,
-    0x000000000087E0B3ULL,
-    0x000000000087E433ULL,
-    0x000000000087E4A4ULL,
-    0x000000000087E585ULL,
-    0x00000000008A8859ULL,
-    0x00000000008A8D73ULL,
-    0x00000000008A91C1ULL,
-    0x00000000008A92A4ULL,
-    0x00000000008A9653ULL,
-    0x00000000008A98D3ULL,
-    0x00000000008A98D9ULL,
-    0x00000000008A9CB2ULL,
-    0x00000000008A9CF9ULL,
-    0x00000000008AA2B3ULL,
-    0x00000000008AA433ULL,
-    0x00000000008AB033ULL,
-    0x00000000008AB0B3ULL,
-    0x00000000008AB173ULL,
-    0x00000000008AB179ULL,
-    0x00000000008AB18FULL,
-    0x00000000008AB193ULL,
-    0x00000000008AB199ULL,
-    0x00000000008AB42EULL,
-    0x00000000008AB433ULL,
-    0x00000000008AB4D3ULL,
-    0x00000000008AB523ULL,
-    0x00000000008AB524ULL,
-    0x00000000008AB5F2ULL,
-    0x00000000008AB608ULL,
-    0x00000000008AB613ULL,
-    0x00000000008AB619ULL,
-    0x00000000008AB6B3ULL,
-    0x00000000008AB868ULL,
-    0x00000000008AB973ULL,
-    0x00000000008AB979ULL,
-    0x00000000008ABA93ULL,
-    0x00000000008AC893ULL,
-    0x00000000008AC993ULL,
-    0x00000000008AC999ULL,
-    0x00000000008ACA41ULL,
-    0x00000000008ACA59ULL,
-    0x00000000008ACA74ULL,
-    0x00000000008ACA93ULL,
-    0x00000000008ACD19ULL,
-    0x00000000008ACD73ULL,
-    0x00000000008ACD79ULL,
-    0x00000000008ACDF3ULL,
-    0x00000000008ACE79ULL,
-    0x00000000008AD068ULL,
-    0x00000000008AD121ULL,
-    0x00000000008AEB41ULL,
-    0x00000000008AEB59ULL,
-    0x00000000008BE593ULL,
-    0x00000000008C9241ULL,
-    0x00000000008C924FULL,
-    0x00000000008C95C1ULL,
-    0x00000000008C95D3ULL,
-    0x00000000008C9CE5ULL,
-    0x00000000008CA5C7ULL,
-    0x00000000008CACB3ULL,
-    0x00000000008CB033ULL,
-    0x00000000008CB0A7ULL,
-    0x00000000008CB0B3ULL,
-    0x00000000008CB123ULL,
-    0x00000000008CB4AEULL,
-    0x00000000008CB5D3ULL,
-    0x00000000008CB885ULL,
-    0x00000000008CBD24ULL,
-    0x00000000008CC0A4ULL,
-    0x00000000008CC0B2ULL,
-    0x00000000008CC0B3ULL,
-    0x00000000008CC101ULL,
-    0x00000000008CC119ULL,
-    0x00000000008CC1F3ULL,
-    0x00000000008CC838ULL,
-    0x00000000008CCDEEULL,
-    0x00000000008CD105ULL,
-    0x000000000090B449ULL,
-    0x000000000090B453ULL,
-    0x000000000091492BULL,
-    0x0000000000919653ULL,
-    0x000000000091A0A4ULL,
-    0x000000000091A0B3ULL,
-    0x000000000091A1F2ULL,
-    0x000000000091A4B2ULL,
-    0x000000000091A599ULL,
-    0x000000000091A5C7ULL,
-    0x000000000091ACB2ULL,
-    0x000000000091AD85ULL,
-    0x000000000091BDD3ULL,
-    0x000000000091D02CULL,
-    0x000000000091D123ULL,
-    0x000000000091D2B3ULL,
-    0x00000000009205D4ULL,
-    0x000000000092142CULL,
-    0x0000000000921433ULL,
-    0x00000000009214B3ULL,
-    0x00000000009215D4ULL,
-    0x00000000009225EDULL,
-    0x00000000009225F4ULL,
-    0x00000000009230A4ULL,
-    0x00000000009230B2ULL,
-    0x00000000009230B3ULL,
-    0x0000000000923D81ULL,
-    0x0000000000923D93ULL,
-    0x000000000092658CULL,
-    0x0000000000926593ULL,
-    0x0000000000935032ULL,
-    0x000000000093860FULL,
-    0x0000000000939CA4ULL,
-    0x000000000093B1EFULL,
-    0x000000000093B2B3ULL,
-    0x000000000094482DULL,
-    0x00000000009585D3ULL,
-    0x0000000000958693ULL,
-    0x000000000095BDD3ULL,
-    0x0000000000961423ULL,
-    0x000000000096142CULL,
-    0x00000000009616ADULL,
-    0x00000000009616B3ULL,
-    0x0000000000962423ULL,
-    0x0000000000962424ULL,
-    0x000000000096242CULL,
-    0x00000000009626ADULL,
-    0x00000000009630B2ULL,
-    0x0000000000963288ULL,
-    0x00000000009684E5ULL,
-    0x00000000009684EFULL,
-    0x00000000009685B3ULL,
-    0x0000000000968649ULL,
-    0x00000000009686ADULL,
-    0x0000000000968832ULL,
-    0x00000000009688A4ULL,
-    0x0000000000968AA5ULL,
-    0x000000000096A485ULL,
-    0x000000000096A48FULL,
-    0x000000000096A493ULL,
-    0x000000000096A5C5ULL,
-    0x000000000096A5CFULL,
-    0x000000000096B4B7ULL,
-    0x000000000096B534ULL,
-    0x000000000096B538ULL,
-    0x000000000096C0A4ULL,
-    0x000000000096C0ACULL,
-    0x000000000096C133ULL,
-    0x000000000096C199ULL,
-    0x000000000096C1F4ULL,
-    0x000000000096C24FULL,
-    0x000000000096CD09ULL,
-    0x000000000096CD19ULL,
-    0x00000000009705C5ULL,
-    0x0000000000970614ULL,
-    0x000000000097064DULL,
-    0x00000000009709F8ULL,
-    0x0000000000970B25ULL,
-    0x0000000000970CACULL,
-    0x0000000000970D85ULL,
-    0x0000000000970DE7ULL,
-    0x0000000000970EB2ULL,
-    0x0000000000970EB3ULL,
-    0x0000000000970EB4ULL,
-    0x00000000009710B7ULL,
-    0x00000000009710B8ULL,
-    0x0000000000971121ULL,
-    0x0000000000971125ULL,
-    0x00000000009711ECULL,
-    0x00000000009711F7ULL,
-    0x0000000000971249ULL,
-    0x00000000009712A5ULL,
-    0x0000000000971614ULL,
-    0x000000000097164DULL,
-    0x0000000000971654ULL,
-    0x00000000009718B2ULL,
-    0x0000000000971938ULL,
-    0x00000000009719F3ULL,
-    0x0000000000971A41ULL,
-    0x0000000000971C2EULL,
-    0x0000000000971D85ULL,
-    0x0000000000971DF4ULL,
-    0x00000000009725EEULL,
-    0x0000000000972CA4ULL,
-    0x0000000000972CB2ULL,
-    0x0000000000972D85ULL,
-    0x0000000000973039ULL,
-    0x00000000009730B4ULL,
-    0x00000000009738A4ULL,
-    0x00000000009738B2ULL,
-    0x0000000000973934ULL,
-    0x0000000000973E42ULL,
-    0x00000000009742B4ULL,
-    0x0000000000974AAEULL,
-    0x0000000000974CB4ULL,
-    0x0000000000974E0FULL,
-    0x00000000009750ACULL,
-    0x00000000009750B2ULL,
-    0x000000000097512CULL,
-    0x0000000000975133ULL,
-    0x0000000000975241ULL,
-    0x000000000097524FULL,
-    0x0000000000975581ULL,
-    0x0000000000975645ULL,
-    0x000000000097564EULL,
-    0x0000000000975674ULL,
-    0x0000000000975832ULL,
-    0x0000000000975D34ULL,
-    0x0000000000979123ULL,
-    0x0000000000979124ULL,
-    0x000000000097912EULL,
-    0x000000000097B923ULL,
-    0x000000000097D033ULL,
-    0x00000000009841EEULL,
-    0x0000000000990485ULL,
-    0x0000000000990685ULL,
-    0x0000000000992493ULL,
-    0x00000000009925C7ULL,
-    0x0000000000992CA4ULL,
-    0x0000000000993D6FULL,
-    0x0000000000993DC5ULL,
-    0x0000000000993DD3ULL,
-    0x0000000000993DD9ULL,
-    0x0000000000998833ULL,
-    0x000000000099A0B3ULL,
-    0x000000000099B0A4ULL,
-    0x000000000099B0B3ULL,
-    0x000000000099B0B4ULL,
-    0x000000000099B825ULL,
-    0x000000000099CCA9ULL,
-    0x000000000099CEA5ULL,
-    0x000000000099D185ULL,
-    0x00000000009A0D19ULL,
-    0x00000000009A15B3ULL,
-    0x00000000009A20B2ULL,
-    0x00000000009B24A4ULL,
-    0x00000000009B24B3ULL,
-    0x00000000009B3E59ULL,
-    0x00000000009C2433ULL,
-    0x00000000009C3839ULL,
-    0x00000000009C3E41ULL,
-    0x00000000009C5185ULL,
-    0x00000000009D0644ULL,
-    0x00000000009D0653ULL,
-    0x00000000009D6834ULL,
-    0x0000000000A08613ULL,
-    0x0000000000A089F4ULL,
-    0x0000000000A08C2CULL,
-    0x0000000000A08D73ULL,
-    0x0000000000A08D79ULL,
-    0x0000000000A090A4ULL,
-    0x0000000000A090B3ULL,
-    0x0000000000A09833ULL,
-    0x0000000000A098C1ULL,
-    0x0000000000A09C33ULL,
-    0x0000000000A09CB2ULL,
-    0x0000000000A09CF3ULL,
-    0x0000000000A09CF9ULL,
-    0x0000000000A09D32ULL,
-    0x0000000000A09E41ULL,
-    0x0000000000A0A593ULL,
-    0x0000000000A0ACB2ULL,
-    0x0000000000A0ACB3ULL,
-    0x0000000000A0ACB9ULL,
-    0x0000000000A0B030ULL,
-    0x0000000000A0B1F0ULL,
-    0x0000000000A0B445ULL,
-    0x0000000000A0B44FULL,
-    0x0000000000A0B453ULL,
-    0x0000000000A0B455ULL,
-    0x0000000000A0B4B3ULL,
-    0x0000000000A0B5B9ULL,
-    0x0000000000A0B5EEULL,
-    0x0000000000A0B8B3ULL,
-    0x0000000000A0B9D3ULL,
-    0x0000000000A0B9D9ULL,
-    0x0000000000A0BA99ULL,
-    0x0000000000A0C02EULL,
-    0x0000000000A0C0A4ULL,
-    0x0000000000A0C0B2ULL,
-    0x0000000000A0C0B3ULL,
-    0x0000000000A0C973ULL,
-    0x0000000000A0C993ULL,
-    0x0000000000A0CA13ULL,
-    0x0000000000A0CA81ULL,
-    0x0000000000A0CAACULL,
-    0x0000000000A0CCB9ULL,
-    0x0000000000A0CE05ULL,
-    0x0000000000A0CE13ULL,
-    0x0000000000A0D1F3ULL,
-    0x0000000000A0D573ULL,
-    0x0000000000A0D5D4ULL,
-    0x0000000000A0D613ULL,
-    0x0000000000A0D833ULL,
-    0x0000000000A0D8ACULL,
-    0x0000000000A0DC2EULL,
-    0x0000000000A0DCA4ULL,
-    0x0000000000A0E125ULL,
-    0x0000000000A0EB59ULL,
-    0x0000000000A285D3ULL,
-    0x0000000000A28693ULL,
-    0x0000000000A288ACULL,
-    0x0000000000A29133ULL,
-    0x0000000000A29593ULL,
-    0x0000000000A29599ULL,
-    0x0000000000A29613ULL,
-    0x0000000000A29653ULL,
-    0x0000000000A29745ULL,
-    0x0000000000A298B3ULL,
-    0x0000000000A298D3ULL,
-    0x0000000000A2A024ULL,
-    0x0000000000A2A2B3ULL,
-    0x0000000000A2B022ULL,
-    0x0000000000A2B18FULL,
-    0x0000000000A2B193ULL,
-    0x0000000000A2B199ULL,
-    0x0000000000A2B445ULL,
-    0x0000000000A2B5B9ULL,
-    0x0000000000A2B9D9ULL,
-    0x0000000000A2BDD3ULL,
-    0x0000000000A2C924ULL,
-    0x0000000000A2C973ULL,
-    0x0000000000A2C979ULL,
-    0x0000000000A2CA59ULL,
-    0x0000000000A2CE65ULL,
-    0x0000000000A2CE93ULL,
-    0x0000000000A2CEB3ULL,
-    0x0000000000A2D0B3ULL,
-    0x0000000000A2D1EEULL,
-    0x0000000000A2D299ULL,
-    0x0000000000A2D5C5ULL,
-    0x0000000000A2DCA4ULL,
-    0x0000000000A2DCACULL,
-    0x0000000000A2DD25ULL,
-    0x0000000000A40581ULL,
-    0x0000000000A485F3ULL,
-    0x0000000000A48841ULL,
-    0x0000000000A48853ULL,
-    0x0000000000A488A4ULL,
-    0x0000000000A488B2ULL,
-    0x0000000000A488B3ULL,
-    0x0000000000A498D3ULL,
-    0x0000000000A498D9ULL,
-    0x0000000000A49CF9ULL,
-    0x0000000000A49DF4ULL,
-    0x0000000000A4A024ULL,
-    0x0000000000A4B193ULL,
-    0x0000000000A4B293ULL,
-    0x0000000000A4B5B9ULL,
-    0x0000000000A4B619ULL,
-    0x0000000000A4B8EFULL,
-    0x0000000000A4B973ULL,
-    0x0000000000A4B9C5ULL,
-    0x0000000000A4B9C9ULL,
-    0x0000000000A4B9D3ULL,
-    0x0000000000A4C893ULL,
-    0x0000000000A4C8E1ULL,
-    0x0000000000A4CA45ULL,
-    0x0000000000A4CDB3ULL,
-    0x0000000000A4D8A4ULL,
-    0x0000000000A4D8B2ULL,
-    0x0000000000A4D8B3ULL,
-    0x0000000000A4D8B9ULL,
-    0x0000000000A705C1ULL,
-    0x0000000000A788A4ULL,
-    0x0000000000A788B3ULL,
-    0x0000000000A78D6FULL,
-    0x0000000000A78D73ULL,
-    0x0000000000A78D79ULL,
-    0x0000000000A78DF3ULL,
-    0x0000000000A790ACULL,
-    0x0000000000A79733ULL,
-    0x0000000000A7A1D3ULL,
-    0x0000000000A7A5D3ULL,
-    0x0000000000A7A5D4ULL,
-    0x0000000000A7A674ULL,
-    0x0000000000A7ACA4ULL,
-    0x0000000000A7ACB2ULL,
-    0x0000000000A7ACB3ULL,
-    0x0000000000A7ACB9ULL,
-    0x0000000000A7ADECULL,
-    0x0000000000A7B0A4ULL,
-    0x0000000000A7B0B3ULL,
-    0x0000000000A7B193ULL,
-    0x0000000000A7B199ULL,
-    0x0000000000A7B293ULL,
-    0x0000000000A7B299ULL,
-    0x0000000000A7B5EEULL,
-    0x0000000000A7B5F3ULL,
-    0x0000000000A7B8B3ULL,
-    0x0000000000A7B8F3ULL,
-    0x0000000000A7BA99ULL,
-    0x0000000000A7BD73ULL,
-    0x0000000000A7C82DULL,
-    0x0000000000A7CAADULL,
-    0x0000000000A7D033ULL,
-    0x0000000000A7D299ULL,
-    0x0000000000A7D2AEULL,
-    0x0000000000A7D42CULL,
-    0x0000000000A7D4F3ULL,
-    0x0000000000A7D573ULL,
-    0x0000000000A7D585ULL,
-    0x0000000000A7D653ULL,
-    0x0000000000A7D674ULL,
-    0x0000000000A7DC32ULL,
-    0x0000000000A7DCA4ULL,
-    0x0000000000A7DD93ULL,
-    0x0000000000A7DD99ULL,
-    0x0000000000A7E4A4ULL,
-    0x0000000000AA8833ULL,
-    0x0000000000AA88B3ULL,
-    0x0000000000AA8DF3ULL,
-    0x0000000000AA9033ULL,
-    0x0000000000AA90E5ULL,
-    0x0000000000AA90F9ULL,
-    0x0000000000AA91F3ULL,
-    0x0000000000AA9C2CULL,
-    0x0000000000AA9EADULL,
-    0x0000000000AAA465ULL,
-    0x0000000000AAA479ULL,
-    0x0000000000AAAAB3ULL,
-    0x0000000000AAACA4ULL,
-    0x0000000000AAACB3ULL,
-    0x0000000000AAAEB3ULL,
-    0x0000000000AAB0B0ULL,
-    0x0000000000AAB432ULL,
-    0x0000000000AAB44FULL,
-    0x0000000000AAB459ULL,
-    0x0000000000AAB613ULL,
-    0x0000000000AAB619ULL,
-    0x0000000000AAB86FULL,
-    0x0000000000AAB973ULL,
-    0x0000000000AAB979ULL,
-    0x0000000000AABA81ULL,
-    0x0000000000AABA8FULL,
-    0x0000000000AAC0B3ULL,
-    0x0000000000AAC1EEULL,
-    0x0000000000AAC82CULL,
-    0x0000000000AAC834ULL,
-    0x0000000000AAC8ACULL,
-    0x0000000000AAC8B3ULL,
-    0x0000000000AAC9F2ULL,
-    0x0000000000AACE93ULL,
-    0x0000000000AAD0B3ULL,
-    0x0000000000AAD299ULL,
-    0x0000000000AAD8B3ULL,
-    0x0000000000AAD925ULL,
-    0x0000000000B085A1ULL,
-    0x0000000000B08822ULL,
-    0x0000000000B08832ULL,
-    0x0000000000B089E2ULL,
-    0x0000000000B08D01ULL,
-    0x0000000000B08D73ULL,
-    0x0000000000B09029ULL,
-    0x0000000000B090B3ULL,
-    0x0000000000B09133ULL,
-    0x0000000000B09932ULL,
-    0x0000000000B09DF3ULL,
-    0x0000000000B09EB3ULL,
-    0x0000000000B0A02CULL,
-    0x0000000000B0A42BULL,
-    0x0000000000B0A493ULL,
-    0x0000000000B0A4B3ULL,
-    0x0000000000B0A4D3ULL,
-    0x0000000000B0A561ULL,
-    0x0000000000B0A573ULL,
-    0x0000000000B0A593ULL,
-    0x0000000000B0A5B3ULL,
-    0x0000000000B0A5C7ULL,
-    0x0000000000B0A5D3ULL,
-    0x0000000000B0AC33ULL,
-    0x0000000000B0AD33ULL,
-    0x0000000000B0B02DULL,
-    0x0000000000B0B0B3ULL,
-    0x0000000000B0B126ULL,
-    0x0000000000B0B133ULL,
-    0x0000000000B0B201ULL,
-    0x0000000000B0B433ULL,
-    0x0000000000B0B4B3ULL,
-    0x0000000000B0B52BULL,
-    0x0000000000B0B533ULL,
-    0x0000000000B0B5A5ULL,
-    0x0000000000B0B825ULL,
-    0x0000000000B0B833ULL,
-    0x0000000000B0B899ULL,
-    0x0000000000B0B8A8ULL,
-    0x0000000000B0B8B3ULL,
-    0x0000000000B0B8E1ULL,
-    0x0000000000B0B8F3ULL,
-    0x0000000000B0B949ULL,
-    0x0000000000B0BA93ULL,
-    0x0000000000B0BB55ULL,
-    0x0000000000B0BDD3ULL,
-    0x0000000000B0C033ULL,
-    0x0000000000B0C113ULL,
-    0x0000000000B0C1EBULL,
-    0x0000000000B0C1F7ULL,
-    0x0000000000B0C201ULL,
-    0x0000000000B0C2B3ULL,
-    0x0000000000B0C2B4ULL,
-    0x0000000000B0C833ULL,
-    0x0000000000B0C834ULL,
-    0x0000000000B0C973ULL,
-    0x0000000000B0C9A1ULL,
-    0x0000000000B0C9D3ULL,
-    0x0000000000B0C9EFULL,
-    0x0000000000B0C9F3ULL,
-    0x0000000000B0CA49ULL,
-    0x0000000000B0CA74ULL,
-    0x0000000000B0CA79ULL,
-    0x0000000000B0CA93ULL,
-    0x0000000000B0CB59ULL,
-    0x0000000000B0CD01ULL,
-    0x0000000000B0CDA5ULL,
-    0x0000000000B0D02CULL,
-    0x0000000000B0D033ULL,
-    0x0000000000B0D133ULL,
-    0x0000000000B0D289ULL,
-    0x0000000000B0D4E8ULL,
-    0x0000000000B0D649ULL,
-    0x0000000000B0D655ULL,
-    0x0000000000B0D659ULL,
-    0x0000000000B0D82CULL,
-    0x0000000000B0D833ULL,
-    0x0000000000B0DC33ULL,
-    0x0000000000B0DC35ULL,
-    0x0000000000B0DCA4ULL,
-    0x0000000000B0E42BULL,
-    0x0000000000B0E585ULL,
-    0x0000000000B0E5F3ULL,
-    0x0000000000B0E933ULL,
-    0x0000000000B0E9EFULL,
-    0x0000000000B10653ULL,
-    0x0000000000B28822ULL,
-    0x0000000000B28832ULL,
-    0x0000000000B289E2ULL,
-    0x0000000000B28D73ULL,
-    0x0000000000B290E5ULL,
-    0x0000000000B290F9ULL,
-    0x0000000000B29468ULL,
-    0x0000000000B294D3ULL,
-    0x0000000000B29573ULL,
-    0x0000000000B29593ULL,
-    0x0000000000B295A1ULL,
-    0x0000000000B295CFULL,
-    0x0000000000B295D3ULL,
-    0x0000000000B29613ULL,
-    0x0000000000B29693ULL,
-    0x0000000000B296C5ULL,
-    0x0000000000B29932ULL,
-    0x0000000000B2A2A1ULL,
-    0x0000000000B2A653ULL,
-    0x0000000000B2B0B0ULL,
-    0x0000000000B2B12DULL,
-    0x0000000000B2B193ULL,
-    0x0000000000B2B199ULL,
-    0x0000000000B2B213ULL,
-    0x0000000000B2B219ULL,
-    0x0000000000B2B293ULL,
-    0x0000000000B2B299ULL,
-    0x0000000000B2B44FULL,
-    0x0000000000B2B453ULL,
-    0x0000000000B2B613ULL,
-    0x0000000000B2B614ULL,
-    0x0000000000B2B619ULL,
-    0x0000000000B2B826ULL,
-    0x0000000000B2B868ULL,
-    0x0000000000B2B88FULL,
-    0x0000000000B2B9F3ULL,
-    0x0000000000B2BA85ULL,
-    0x0000000000B2BA93ULL,
-    0x0000000000B2C133ULL,
-    0x0000000000B2C853ULL,
-    0x0000000000B2C8ACULL,
-    0x0000000000B2C8D3ULL,
-    0x0000000000B2C979ULL,
-    0x0000000000B2C9A1ULL,
-    0x0000000000B2C9C5ULL,
-    0x0000000000B2C9D3ULL,
-    0x0000000000B2C9F3ULL,
-    0x0000000000B2CA59ULL,
-    0x0000000000B2CAC5ULL,
-    0x0000000000B2CC32ULL,
-    0x0000000000B2CE93ULL,
-    0x0000000000B2D033ULL,
-    0x0000000000B2D068ULL,
-    0x0000000000B2D0B3ULL,
-    0x0000000000B2D1ECULL,
-    0x0000000000B2D8ACULL,
-    0x0000000000B2D92CULL,
-    0x0000000000B2E0B3ULL,
-    0x0000000000B2E4A4ULL,
-    0x0000000000B2E4B2ULL,
-    0x0000000000B40489ULL,
-    0x0000000000B404D3ULL,
-    0x0000000000B40569ULL,
-    0x0000000000B405D3ULL,
-    0x0000000000B40608ULL,
-    0x0000000000B40693ULL,
-    0x0000000000B40721ULL,
-    0x0000000000B40749ULL,
-    0x0000000000B41481ULL,
-    0x0000000000B41688ULL,
-    0x0000000000B41693ULL,
-    0x0000000000B43D41ULL,
-    0x0000000000B43E53ULL,
-    0x0000000000B43EADULL,
-    0x0000000000B45493ULL,
-    0x0000000000B48434ULL,
-    0x0000000000B4846BULL,
-    0x0000000000B485C7ULL,
-    0x0000000000B48845ULL,
-    0x0000000000B48849ULL,
-    0x0000000000B488A9ULL,
-    0x0000000000B488B3ULL,
-    0x0000000000B48981ULL,
-    0x0000000000B48D73ULL,
-    0x0000000000B48D79ULL,
-    0x0000000000B4908FULL,
-    0x0000000000B49099ULL,
-    0x0000000000B490ACULL,
-    0x0000000000B490E5ULL,
-    0x0000000000B494D3ULL,
-    0x0000000000B49653ULL,
-    0x0000000000B496C5ULL,
-    0x0000000000B496D3ULL,
-    0x0000000000B49D14ULL,
-    0x0000000000B4ADE9ULL,
-    0x0000000000B4B0B9ULL,
-    0x0000000000B4B12DULL,
-    0x0000000000B4B193ULL,
-    0x0000000000B4B1D3ULL,
-    0x0000000000B4B1F3ULL,
-    0x0000000000B4B213ULL,
-    0x0000000000B4B293ULL,
-    0x0000000000B4B299ULL,
-    0x0000000000B4B44FULL,
-    0x0000000000B4B833ULL,
-    0x0000000000B4B881ULL,
-    0x0000000000B4B893ULL,
-    0x0000000000B4B899ULL,
-    0x0000000000B4B8B3ULL,
-    0x0000000000B4B8F3ULL,
-    0x0000000000B4B92EULL,
-    0x0000000000B4B973ULL,
-    0x0000000000B4B979ULL,
-    0x0000000000B4B9F3ULL,
-    0x0000000000B4BE45ULL,
-    0x0000000000B4BE6BULL,
-    0x0000000000B4C0B3ULL,
-    0x0000000000B4C201ULL,
-    0x0000000000B4C213ULL,
-    0x0000000000B4C859ULL,
-    0x0000000000B4C973ULL,
-    0x0000000000B4C9D3ULL,
-    0x0000000000B4CA49ULL,
-    0x0000000000B4CC2EULL,
-    0x0000000000B4CE79ULL,
-    0x0000000000B4CE93ULL,
-    0x0000000000B4D0A4ULL,
-    0x0000000000B4D0B2ULL,
-    0x0000000000B4D0B3ULL,
-    0x0000000000B4D105ULL,
-    0x0000000000B4D113ULL,
-    0x0000000000B4D299ULL,
-    0x0000000000B4D2ACULL,
-    0x0000000000B4D833ULL,
-    0x0000000000B4DD33ULL,
-    0x0000000000B605C7ULL,
-    0x0000000000B60613ULL,
-    0x0000000000B61694ULL,
-    0x0000000000B6246BULL,
-    0x0000000000B624A7ULL,
-    0x0000000000B62573ULL,
-    0x0000000000B63DC7ULL,
-    0x0000000000B63DE6ULL,
-    0x0000000000B654E5ULL,
-    0x0000000000B6569AULL,
-    0x0000000000B7046BULL,
-    0x0000000000B704F3ULL,
-    0x0000000000B70613ULL,
-    0x0000000000B7064CULL,
-    0x0000000000B70653ULL,
-    0x0000000000B706B2ULL,
-    0x0000000000B706C5ULL,
-    0x0000000000B706E5ULL,
-    0x0000000000B71424ULL,
-    0x0000000000B714A4ULL,
-    0x0000000000B714ACULL,
-    0x0000000000B714B3ULL,
-    0x0000000000B7158CULL,
-    0x0000000000B71594ULL,
-    0x0000000000B724C5ULL,
-    0x0000000000B72668ULL,
-    0x0000000000B72693ULL,
-    0x0000000000B726C5ULL,
-    0x0000000000B73C53ULL,
-    0x0000000000B73C6BULL,
-    0x0000000000B73D8CULL,
-    0x0000000000B73E13ULL,
-    0x0000000000B73E70ULL,
-    0x0000000000B73E93ULL,
-    0x0000000000B73EB4ULL,
-    0x0000000000B73EE5ULL,
-    0x0000000000B73EEEULL,
-    0x0000000000B73EF3ULL,
-    0x0000000000B75453ULL,
-    0x0000000000B7564CULL,
-    0x0000000000B75652ULL,
-    0x0000000000B75653ULL,
-    0x0000000000B75693ULL,
-    0x0000000000B78581ULL,
-    0x0000000000B785D3ULL,
-    0x0000000000B78613ULL,
-    0x0000000000B7882EULL,
-    0x0000000000B789F3ULL,
-    0x0000000000B79593ULL,
-    0x0000000000B798D3ULL,
-    0x0000000000B79A81ULL,
-    0x0000000000B79C2CULL,
-    0x0000000000B7A033ULL,
-    0x0000000000B7A0AEULL,
-    0x0000000000B7A193ULL,
-    0x0000000000B7A5C5ULL,
-    0x0000000000B7A933ULL,
-    0x0000000000B7AC2DULL,
-    0x0000000000B7AC33ULL,
-    0x0000000000B7ACB2ULL,
-    0x0000000000B7AE41ULL,
-    0x0000000000B7AEADULL,
-    0x0000000000B7B033ULL,
-    0x0000000000B7B1F3ULL,
-    0x0000000000B7B455ULL,
-    0x0000000000B7B855ULL,
-    0x0000000000B7B88FULL,
-    0x0000000000B7B973ULL,
-    0x0000000000B7BD73ULL,
-    0x0000000000B7BD79ULL,
-    0x0000000000B7BE49ULL,
-    0x0000000000B7C0ABULL,
-    0x0000000000B7C113ULL,
-    0x0000000000B7C145ULL,
-    0x0000000000B7C201ULL,
-    0x0000000000B7C829ULL,
-    0x0000000000B7C833ULL,
-    0x0000000000B7C834ULL,
-    0x0000000000B7C8B3ULL,
-    0x0000000000B7C9A1ULL,
-    0x0000000000B7C9F3ULL,
-    0x0000000000B7CAAEULL,
-    0x0000000000B7CAB3ULL,
-    0x0000000000B7CCB3ULL,
-    0x0000000000B7D068ULL,
-    0x0000000000B7D1F3ULL,
-    0x0000000000B7D1F7ULL,
-    0x0000000000B7D641ULL,
-    0x0000000000B9042CULL,
-    0x0000000000B90453ULL,
-    0x0000000000B904D4ULL,
-    0x0000000000B90533ULL,
-    0x0000000000B90534ULL,
-    0x0000000000B905C7ULL,
-    0x0000000000B905D3ULL,
-    0x0000000000B905DAULL,
-    0x0000000000B906B4ULL,
-    0x0000000000B90733ULL,
-    0x0000000000B914B0ULL,
-    0x0000000000B915C7ULL,
-    0x0000000000B916E5ULL,
-    0x0000000000B9258CULL,
-    0x0000000000B93DC1ULL,
-    0x0000000000B93DC5ULL,
-    0x0000000000B93DEEULL,
-    0x0000000000B95449ULL,
-    0x0000000000B955CBULL,
-    0x0000000000B98653ULL,
-    0x0000000000BA8925ULL,
-    0x0000000000BA91F3ULL,
-    0x0000000000BA92B3ULL,
-    0x0000000000BA9355ULL,
-    0x0000000000BA9933ULL,
-    0x0000000000BA9CACULL,
-    0x0000000000BAA433ULL,
-    0x0000000000BAAE49ULL,
-    0x0000000000BAAEB3ULL,
-    0x0000000000BAB02BULL,
-    0x0000000000BAB02EULL,
-    0x0000000000BAB033ULL,
-    0x0000000000BAB0C9ULL,
-    0x0000000000BAB533ULL,
-    0x0000000000BAB733ULL,
-    0x0000000000BAC933ULL,
-    0x0000000000BACA45ULL,
-    0x0000000000BACA81ULL,
-    0x0000000000BACAB3ULL,
-    0x0000000000BACE6FULL,
-    0x0000000000BAD033ULL,
-    0x0000000000BAD068ULL,
-    0x0000000000BAD133ULL,
-    0x0000000000BAD2B3ULL,
-    0x0000000000BAEAB3ULL,
-    0x0000000000BB0673ULL,
-    0x0000000000BB158CULL,
-    0x0000000000BB9581ULL,
-    0x0000000000BC846BULL,
-    0x0000000000BC8573ULL,
-    0x0000000000BC85C7ULL,
-    0x0000000000BC8653ULL,
-    0x0000000000BC8693ULL,
-    0x0000000000BC89F3ULL,
-    0x0000000000BC9274ULL,
-    0x0000000000BCB0B3ULL,
-    0x0000000000BCB125ULL,
-    0x0000000000BCB12EULL,
-    0x0000000000BCB138ULL,
-    0x0000000000BCB1E5ULL,
-    0x0000000000BCB885ULL,
-    0x0000000000BCB893ULL,
-    0x0000000000BCC0B3ULL,
-    0x0000000000BCC925ULL,
-    0x0000000000BCD0B3ULL,
-    0x0000000000BCD105ULL,
-    0x0000000000C08649ULL,
-    0x0000000000C08881ULL,
-    0x0000000000C088ACULL,
-    0x0000000000C08921ULL,
-    0x0000000000C08933ULL,
-    0x0000000000C089F2ULL,
-    0x0000000000C08A41ULL,
-    0x0000000000C08CA4ULL,
-    0x0000000000C08CB2ULL,
-    0x0000000000C08CB3ULL,
-    0x0000000000C08CB4ULL,
-    0x0000000000C08CB9ULL,
-    0x0000000000C08D73ULL,
-    0x0000000000C09099ULL,
-    0x0000000000C090A4ULL,
-    0x0000000000C090AEULL,
-    0x0000000000C090B2ULL,
-    0x0000000000C090B3ULL,
-    0x0000000000C09185ULL,
-    0x0000000000C09653ULL,
-    0x0000000000C096CFULL,
-    0x0000000000C09C2EULL,
-    0x0000000000C09CB2ULL,
-    0x0000000000C0A02CULL,
-    0x0000000000C0A032ULL,
-    0x0000000000C0A468ULL,
-    0x0000000000C0A473ULL,
-    0x0000000000C0A493ULL,
-    0x0000000000C0A4E8ULL,
-    0x0000000000C0A561ULL,
-    0x0000000000C0A573ULL,
-    0x0000000000C0A644ULL,
-    0x0000000000C0A653ULL,
-    0x0000000000C0A659ULL,
-    0x0000000000C0A688ULL,
-    0x0000000000C0A699ULL,
-    0x0000000000C0ACA4ULL,
-    0x0000000000C0ACB2ULL,
-    0x0000000000C0ACB3ULL,
-    0x0000000000C0AD13ULL,
-    0x0000000000C0AD2EULL,
-    0x0000000000C0AE61ULL,
-    0x0000000000C0B099ULL,
-    0x0000000000C0B193ULL,
-    0x0000000000C0B433ULL,
-    0x0000000000C0B453ULL,
-    0x0000000000C0B459ULL,
-    0x0000000000C0B4A4ULL,
-    0x0000000000C0B4B2ULL,
-    0x0000000000C0B4B3ULL,
-    0x0000000000C0B521ULL,
-    0x0000000000C0B5B9ULL,
-    0x0000000000C0B613ULL,
-    0x0000000000C0B829ULL,
-    0x0000000000C0B833ULL,
-    0x0000000000C0B865ULL,
-    0x0000000000C0B868ULL,
-    0x0000000000C0B885ULL,
-    0x0000000000C0B893ULL,
-    0x0000000000C0B8B3ULL,
-    0x0000000000C0B973ULL,
-    0x0000000000C0B979ULL,
-    0x0000000000C0BA93ULL,
-    0x0000000000C0C0ACULL,
-    0x0000000000C0C12EULL,
-    0x0000000000C0C133ULL,
-    0x0000000000C0C145ULL,
-    0x0000000000C0C265ULL,
-    0x0000000000C0C868ULL,
-    0x0000000000C0C893ULL,
-    0x0000000000C0C899ULL,
-    0x0000000000C0C8A5ULL,
-    0x0000000000C0C8B3ULL,
-    0x0000000000C0C8E5ULL,
-    0x0000000000C0C8EFULL,
-    0x0000000000C0C933ULL,
-    0x0000000000C0C973ULL,
-    0x0000000000C0C979ULL,
-    0x0000000000C0C9D3ULL,
-    0x0000000000C0C9D4ULL,
-    0x0000000000C0CAADULL,
-    0x0000000000C0CAC1ULL,
-    0x0000000000C0CCA4ULL,
-    0x0000000000C0CCB2ULL,
-    0x0000000000C0CCB3ULL,
-    0x0000000000C0CE69ULL,
-    0x0000000000C0CE6FULL,
-    0x0000000000C0CE75ULL,
-    0x0000000000C0CE79ULL,
-    0x0000000000C0CE93ULL,
-    0x0000000000C0D028ULL,
-    0x0000000000C0D068ULL,
-    0x0000000000C0D0A4ULL,
-    0x0000000000C0D0AEULL,
-    0x0000000000C0D0B2ULL,
-    0x0000000000C0D0B8ULL,
-    0x0000000000C0D105ULL,
-    0x0000000000C0D109ULL,
-    0x0000000000C0D113ULL,
-    0x0000000000C0D119ULL,
-    0x0000000000C0D165ULL,
-    0x0000000000C0D285ULL,
-    0x0000000000C0D2B3ULL,
-    0x0000000000C0D42EULL,
-    0x0000000000C0D468ULL,
-    0x0000000000C0D493ULL,
-    0x0000000000C0D4D3ULL,
-    0x0000000000C0D4E8ULL,
-    0x0000000000C0D5C4ULL,
-    0x0000000000C0D641ULL,
-    0x0000000000C0D82CULL,
-    0x0000000000C0D833ULL,
-    0x0000000000C0D8A4ULL,
-    0x0000000000C0D8B2ULL,
-    0x0000000000C0D8B3ULL,
-    0x0000000000C0DA41ULL,
-    0x0000000000C0DAD9ULL,
-    0x0000000000C0DCA4ULL,
-    0x0000000000C0DCB2ULL,
-    0x0000000000C0DD2EULL,
-    0x0000000000C0DD73ULL,
-    0x0000000000C0DDD3ULL,
-    0x0000000000C0DDD9ULL,
-    0x0000000000C0E0A4ULL,
-    0x0000000000C0E0B2ULL,
-    0x0000000000C0E0B3ULL,
-    0x0000000000C0E199ULL,
-    0x0000000000C0E4A4ULL,
-    0x0000000000C0E4B2ULL,
-    0x0000000000C0E52EULL,
-    0x0000000000C0E6B0ULL,
-    0x0000000000C0E832ULL,
-    0x0000000000C0E8A4ULL,
-    0x0000000000C0E8B3ULL,
-    0x0000000000C0E9F3ULL,
-    0x0000000000C0EB49ULL,
-    0x0000000000C0EB4FULL,
-    0x0000000000C28468ULL,
-    0x0000000000C28493ULL,
-    0x0000000000C28499ULL,
-    0x0000000000C284D3ULL,
-    0x0000000000C284D9ULL,
-    0x0000000000C28573ULL,
-    0x0000000000C28579ULL,
-    0x0000000000C285B3ULL,
-    0x0000000000C285D3ULL,
-    0x0000000000C285D4ULL,
-    0x0000000000C285D9ULL,
-    0x0000000000C28613ULL,
-    0x0000000000C28614ULL,
-    0x0000000000C28645ULL,
-    0x0000000000C2864EULL,
-    0x0000000000C28653ULL,
-    0x0000000000C28659ULL,
-    0x0000000000C28665ULL,
-    0x0000000000C28668ULL,
-    0x0000000000C28674ULL,
-    0x0000000000C28693ULL,
-    0x0000000000C286C5ULL,
-    0x0000000000C286D9ULL,
-    0x0000000000C28745ULL,
-    0x0000000000C288AEULL,
-    0x0000000000C28C79ULL,
-    0x0000000000C290B3ULL,
-    0x0000000000C290E5ULL,
-    0x0000000000C290F9ULL,
-    0x0000000000C292ADULL,
-    0x0000000000C29432ULL,
-    0x0000000000C29468ULL,
-    0x0000000000C29573ULL,
-    0x0000000000C29613ULL,
-    0x0000000000C29653ULL,
-    0x0000000000C29659ULL,
-    0x0000000000C29665ULL,
-    0x0000000000C29693ULL,
-    0x0000000000C29745ULL,
-    0x0000000000C29A85ULL,
-    0x0000000000C29A93ULL,
-    0x0000000000C29A99ULL,
-    0x0000000000C29C2CULL,
-    0x0000000000C29CB2ULL,
-    0x0000000000C29CB3ULL,
-    0x0000000000C29CE5ULL,
-    0x0000000000C29CEFULL,
-    0x0000000000C29CF9ULL,
-    0x0000000000C29D34ULL,
-    0x0000000000C2A253ULL,
-    0x0000000000C2A2A1ULL,
-    0x0000000000C2A653ULL,
-    0x0000000000C2A668ULL,
-    0x0000000000C2B42EULL,
-    0x0000000000C2B4A4ULL,
-    0x0000000000C2B4ACULL,
-    0x0000000000C2B4B3ULL,
-    0x0000000000C2B5A1ULL,
-    0x0000000000C2B5A5ULL,
-    0x0000000000C2B5EEULL,
-    0x0000000000C2B6B2ULL,
-    0x0000000000C2B893ULL,
-    0x0000000000C2B8B3ULL,
-    0x0000000000C2B8F3ULL,
-    0x0000000000C2B933ULL,
-    0x0000000000C2B9F3ULL,
-    0x0000000000C2BA65ULL,
-    0x0000000000C2BA89ULL,
-    0x0000000000C2BA8FULL,
-    0x0000000000C2BDC5ULL,
-    0x0000000000C2C0B2ULL,
-    0x0000000000C2C124ULL,
-    0x0000000000C2C241ULL,
-    0x0000000000C2C281ULL,
-    0x0000000000C2C8A4ULL,
-    0x0000000000C2C8B3ULL,
-    0x0000000000C2CA13ULL,
-    0x0000000000C2CCB3ULL,
-    0x0000000000C2CE93ULL,
-    0x0000000000C2D068ULL,
-    0x0000000000C2D105ULL,
-    0x0000000000C2D2B0ULL,
-    0x0000000000C2D468ULL,
-    0x0000000000C2D46FULL,
-    0x0000000000C2D493ULL,
-    0x0000000000C2D4E8ULL,
-    0x0000000000C2D833ULL,
-    0x0000000000C2D8A5ULL,
-    0x0000000000C2D8ACULL,
-    0x0000000000C2D8B2ULL,
-    0x0000000000C2D8B3ULL,
-    0x0000000000C2D92EULL,
-    0x0000000000C2D933ULL,
-    0x0000000000C2DD33ULL,
-    0x0000000000C2E0B3ULL,
-    0x0000000000C2E133ULL,
-    0x0000000000C2E8B3ULL,
-    0x0000000000C2EB41ULL,
-    0x0000000000C2EB59ULL,
-    0x0000000000C485C1ULL,
-    0x0000000000C485C5ULL,
-    0x0000000000C485C7ULL,
-    0x0000000000C48644ULL,
-    0x0000000000C48653ULL,
-    0x0000000000C48654ULL,
-    0x0000000000C488ACULL,
-    0x0000000000C488B2ULL,
-    0x0000000000C48A41ULL,
-    0x0000000000C48A49ULL,
-    0x0000000000C48D09ULL,
-    0x0000000000C48D14ULL,
-    0x0000000000C48D34ULL,
-    0x0000000000C48D73ULL,
-    0x0000000000C49032ULL,
-    0x0000000000C491F3ULL,
-    0x0000000000C494D3ULL,
-    0x0000000000C494E5ULL,
-    0x0000000000C495D3ULL,
-    0x0000000000C49653ULL,
-    0x0000000000C496B3ULL,
-    0x0000000000C496C5ULL,
-    0x0000000000C498B2ULL,
-    0x0000000000C498B3ULL,
-    0x0000000000C49A93ULL,
-    0x0000000000C49C2EULL,
-    0x0000000000C49CB2ULL,
-    0x0000000000C49CE5ULL,
-    0x0000000000C49D14ULL,
-    0x0000000000C49DC5ULL,
-    0x0000000000C4ACA4ULL,
-    0x0000000000C4ACAEULL,
-    0x0000000000C4ACB2ULL,
-    0x0000000000C4ACB3ULL,
-    0x0000000000C4AD2EULL,
-    0x0000000000C4B023ULL,
-    0x0000000000C4B193ULL,
-    0x0000000000C4B1F3ULL,
-    0x0000000000C4B293ULL,
-    0x0000000000C4B42EULL,
-    0x0000000000C4B433ULL,
-    0x0000000000C4B438ULL,
-    0x0000000000C4B441ULL,
-    0x0000000000C4B449ULL,
-    0x0000000000C4B44FULL,
-    0x0000000000C4B453ULL,
-    0x0000000000C4B459ULL,
-    0x0000000000C4B4A4ULL,
-    0x0000000000C4B4AEULL,
-    0x0000000000C4B4B3ULL,
-    0x0000000000C4B4B9ULL,
-    0x0000000000C4B534ULL,
-    0x0000000000C4B5A1ULL,
-    0x0000000000C4B5D3ULL,
-    0x0000000000C4B5F3ULL,
-    0x0000000000C4B601ULL,
-    0x0000000000C4B613ULL,
-    0x0000000000C4B823ULL,
-    0x0000000000C4B868ULL,
-    0x0000000000C4B893ULL,
-    0x0000000000C4B899ULL,
-    0x0000000000C4B8A4ULL,
-    0x0000000000C4B8AEULL,
-    0x0000000000C4B8B2ULL,
-    0x0000000000C4B8B3ULL,
-    0x0000000000C4B8B9ULL,
-    0x0000000000C4B8E1ULL,
-    0x0000000000C4B8EFULL,
-    0x0000000000C4B8F3ULL,
-    0x0000000000C4B8F9ULL,
-    0x0000000000C4B92EULL,
-    0x0000000000C4B973ULL,
-    0x0000000000C4B979ULL,
-    0x0000000000C4B9D3ULL,
-    0x0000000000C4B9D9ULL,
-    0x0000000000C4B9F3ULL,
-    0x0000000000C4BA93ULL,
-    0x0000000000C4BA99ULL,
-    0x0000000000C4BAADULL,
-    0x0000000000C4BAB8ULL,
-    0x0000000000C4BDD3ULL,
-    0x0000000000C4C033ULL,
-    0x0000000000C4C0B3ULL,
-    0x0000000000C4C124ULL,
-    0x0000000000C4C12EULL,
-    0x0000000000C4C1F3ULL,
-    0x0000000000C4C219ULL,
-    0x0000000000C4C833ULL,
-    0x0000000000C4C973ULL,
-    0x0000000000C4C9F4ULL,
-    0x0000000000C4CD73ULL,
-    0x0000000000C4CD85ULL,
-    0x0000000000C4CE13ULL,
-    0x0000000000C4CE93ULL,
-    0x0000000000C4D029ULL,
-    0x0000000000C4D033ULL,
-    0x0000000000C4D0A4ULL,
-    0x0000000000C4D0B2ULL,
-    0x0000000000C4D0B3ULL,
-    0x0000000000C4D105ULL,
-    0x0000000000C4D10FULL,
-    0x0000000000C4D113ULL,
-    0x0000000000C4D245ULL,
-    0x0000000000C4D8A4ULL,
-    0x0000000000C4D8AEULL,
-    0x0000000000C4D8B2ULL,
-    0x0000000000C4D8B3ULL,
-    0x0000000000C4D924ULL,
-    0x0000000000C4D9F2ULL,
-    0x0000000000C4DA45ULL,
-    0x0000000000C605A1ULL,
-    0x0000000000C605CFULL,
-    0x0000000000C78468ULL,
-    0x0000000000C78493ULL,
-    0x0000000000C784D3ULL,
-    0x0000000000C785B3ULL,
-    0x0000000000C785B9ULL,
-    0x0000000000C785D3ULL,
-    0x0000000000C78674ULL,
-    0x0000000000C78688ULL,
-    0x0000000000C786C5ULL,
-    0x0000000000C78832ULL,
-    0x0000000000C78859ULL,
-    0x0000000000C788A4ULL,
-    0x0000000000C788B3ULL,
-    0x0000000000C789F3ULL,
-    0x0000000000C78AB3ULL,
-    0x0000000000C78C2CULL,
-    0x0000000000C78D05ULL,
-    0x0000000000C78D13ULL,
-    0x0000000000C78D25ULL,
-    0x0000000000C78D33ULL,
-    0x0000000000C78D73ULL,
-    0x0000000000C78DF3ULL,
-    0x0000000000C78EADULL,
-    0x0000000000C78EB3ULL,
-    0x0000000000C790AEULL,
-    0x0000000000C790B3ULL,
-    0x0000000000C790E5ULL,
-    0x0000000000C79673ULL,
-    0x0000000000C79A93ULL,
-    0x0000000000C79A99ULL,
-    0x0000000000C79C2EULL,
-    0x0000000000C79CB3ULL,
-    0x0000000000C79CF9ULL,
-    0x0000000000C79D21ULL,
-    0x0000000000C79D23ULL,
-    0x0000000000C79D25ULL,
-    0x0000000000C79D2EULL,
-    0x0000000000C79DE9ULL,
-    0x0000000000C79DEEULL,
-    0x0000000000C79DF3ULL,
-    0x0000000000C7A02EULL,
-    0x0000000000C7A493ULL,
-    0x0000000000C7A5D3ULL,
-    0x0000000000C7A605ULL,
-    0x0000000000C7A653ULL,
-    0x0000000000C7ACB3ULL,
-    0x0000000000C7B193ULL,
-    0x0000000000C7B199ULL,
-    0x0000000000C7B1E7ULL,
-    0x0000000000C7B433ULL,
-    0x0000000000C7B4A4ULL,
-    0x0000000000C7B4B3ULL,
-    0x0000000000C7B8B2ULL,
-    0x0000000000C7B8E1ULL,
-    0x0000000000C7B8E5ULL,
-    0x0000000000C7B8F3ULL,
-    0x0000000000C7BC59ULL,
-    0x0000000000C7BCA4ULL,
-    0x0000000000C7BCB9ULL,
-    0x0000000000C7BCC1ULL,
-    0x0000000000C7BCD3ULL,
-    0x0000000000C7BD25ULL,
-    0x0000000000C7BD73ULL,
-    0x0000000000C7BD79ULL,
-    0x0000000000C7BDB3ULL,
-    0x0000000000C7BDD3ULL,
-    0x0000000000C7BDD9ULL,
-    0x0000000000C7BE13ULL,
-    0x0000000000C7BE19ULL,
-    0x0000000000C7BE44ULL,
-    0x0000000000C7BE65ULL,
-    0x0000000000C7BE93ULL,
-    0x0000000000C7C0A4ULL,
-    0x0000000000C7C0B2ULL,
-    0x0000000000C7C0B3ULL,
-    0x0000000000C7C219ULL,
-    0x0000000000C7C82CULL,
-    0x0000000000C7C82EULL,
-    0x0000000000C7C893ULL,
-    0x0000000000C7C899ULL,
-    0x0000000000C7C8ACULL,
-    0x0000000000C7C8B3ULL,
-    0x0000000000C7C923ULL,
-    0x0000000000C7C933ULL,
-    0x0000000000C7CA59ULL,
-    0x0000000000C7CCA4ULL,
-    0x0000000000C7CCACULL,
-    0x0000000000C7CCAEULL,
-    0x0000000000C7CCB2ULL,
-    0x0000000000C7CCB3ULL,
-    0x0000000000C7CE79ULL,
-    0x0000000000C7D028ULL,
-    0x0000000000C7D033ULL,
-    0x0000000000C7D0B3ULL,
-    0x0000000000C7D123ULL,
-    0x0000000000C7D1F3ULL,
-    0x0000000000C7D261ULL,
-    0x0000000000C7D281ULL,
-    0x0000000000C7D285ULL,
-    0x0000000000C7D28FULL,
-    0x0000000000C7D2B3ULL,
-    0x0000000000C7D4A4ULL,
-    0x0000000000C7D4E8ULL,
-    0x0000000000C7D525ULL,
-    0x0000000000C7D533ULL,
-    0x0000000000C7D5A1ULL,
-    0x0000000000C7D5C4ULL,
-    0x0000000000C7D5D3ULL,
-    0x0000000000C7D605ULL,
-    0x0000000000C7D613ULL,
-    0x0000000000C7D645ULL,
-    0x0000000000C7D653ULL,
-    0x0000000000C7D659ULL,
-    0x0000000000C7D665ULL,
-    0x0000000000C7D679ULL,
-    0x0000000000C7D693ULL,
-    0x0000000000C7D834ULL,
-    0x0000000000C7D8A4ULL,
-    0x0000000000C7D8B2ULL,
-    0x0000000000C7D8B3ULL,
-    0x0000000000C7D8B9ULL,
-    0x0000000000C7D925ULL,
-    0x0000000000C7DC2EULL,
-    0x0000000000C7DCA4ULL,
-    0x0000000000C7DCB2ULL,
-    0x0000000000C7DCB3ULL,
-    0x0000000000C7DD99ULL,
-    0x0000000000C7DDC4ULL,
-    0x0000000000C7DDC5ULL,
-    0x0000000000C7DDD3ULL,
-    0x0000000000C7DE13ULL,
-    0x0000000000C7DE59ULL,
-    0x0000000000C7DE65ULL,
-    0x0000000000C7DE93ULL,
-    0x0000000000C7E0A4ULL,
-    0x0000000000C7E0B3ULL,
-    0x0000000000C7E42CULL,
-    0x0000000000C7E8AEULL,
-    0x0000000000CA8468ULL,
-    0x0000000000CA86B3ULL,
-    0x0000000000CA88A4ULL,
-    0x0000000000CA88B3ULL,
-    0x0000000000CA8A41ULL,
-    0x0000000000CA8CB3ULL,
-    0x0000000000CA8D24ULL,
-    0x0000000000CA8D73ULL,
-    0x0000000000CA8D79ULL,
-    0x0000000000CA8E45ULL,
-    0x0000000000CA90B3ULL,
-    0x0000000000CA9123ULL,
-    0x0000000000CA91F3ULL,
-    0x0000000000CA98C1ULL,
-    0x0000000000CA98D3ULL,
-    0x0000000000CA9CA4ULL,
-    0x0000000000CA9CB2ULL,
-    0x0000000000CA9CB3ULL,
-    0x0000000000CAB193ULL,
-    0x0000000000CAB2B3ULL,
-    0x0000000000CAB433ULL,
-    0x0000000000CAB449ULL,
-    0x0000000000CAB4AEULL,
-    0x0000000000CAB5A5ULL,
-    0x0000000000CAB5B9ULL,
-    0x0000000000CAB613ULL,
-    0x0000000000CAB619ULL,
-    0x0000000000CAB832ULL,
-    0x0000000000CAB833ULL,
-    0x0000000000CAB868ULL,
-    0x0000000000CAB8B3ULL,
-    0x0000000000CAB8B4ULL,
-    0x0000000000CAB8E5ULL,
-    0x0000000000CAB8E9ULL,
-    0x0000000000CAB8F3ULL,
-    0x0000000000CAB973ULL,
-    0x0000000000CABA93ULL,
-    0x0000000000CAC12EULL,
-    0x0000000000CAC2B3ULL,
-    0x0000000000CAC868ULL,
-    0x0000000000CAC8A4ULL,
-    0x0000000000CAC8B2ULL,
-    0x0000000000CAC8B3ULL,
-    0x0000000000CAC8B8ULL,
-    0x0000000000CAC8E9ULL,
-    0x0000000000CAC8F9ULL,
-    0x0000000000CAC924ULL,
-    0x0000000000CAC973ULL,
-    0x0000000000CACA59ULL,
-    0x0000000000CACAC5ULL,
-    0x0000000000CACCB2ULL,
-    0x0000000000CACD19ULL,
-    0x0000000000CACD73ULL,
-    0x0000000000CACE93ULL,
-    0x0000000000CACE99ULL,
-    0x0000000000CACEB3ULL,
-    0x0000000000CAD0A1ULL,
-    0x0000000000CAD0A4ULL,
-    0x0000000000CAD0B2ULL,
-    0x0000000000CAD0B3ULL,
-    0x0000000000CADAD9ULL,
-    0x0000000000CAE0A4ULL,
-    0x0000000000CAE0B2ULL,
-    0x0000000000CAE0B3ULL,
-    0x0000000000CB9533ULL,
-    0x0000000000CC85B3ULL,
-    0x0000000000CC8644ULL,
-    0x0000000000CC8654ULL,
-    0x0000000000CC8665ULL,
-    0x0000000000CC8CA1ULL,
-    0x0000000000CC8CA5ULL,
-    0x0000000000CC8E41ULL,
-    0x0000000000CCA5C7ULL,
-    0x0000000000CCB4B3ULL,
-    0x0000000000CCB608ULL,
-    0x0000000000CCB8B3ULL,
-    0x0000000000CCC8B3ULL,
-    0x0000000000CCC923ULL,
-    0x0000000000CCCCA4ULL,
-    0x0000000000CCCCB3ULL,
-    0x0000000000CCCD2EULL,
-    0x0000000000CCCD33ULL,
-    0x0000000000CCCDECULL,
-    0x0000000000CCCE61ULL,
-    0x0000000000CCD0A4ULL,
-    0x0000000000CCD0B3ULL,
-    0x0000000000CCD105ULL,
-    0x0000000000CCD123ULL,
-    0x0000000000CCD281ULL,
-    0x0000000000D084A4ULL,
-    0x0000000000D08645ULL,
-    0x0000000000D08653ULL,
-    0x0000000000D088B3ULL,
-    0x0000000000D08C33ULL,
-    0x0000000000D08C37ULL,
-    0x0000000000D08CA4ULL,
-    0x0000000000D08CB2ULL,
-    0x0000000000D08CB3ULL,
-    0x0000000000D08D05ULL,
-    0x0000000000D08D09ULL,
-    0x0000000000D08D0FULL,
-    0x0000000000D08D13ULL,
-    0x0000000000D08D73ULL,
-    0x0000000000D08D85ULL,
-    0x0000000000D08DEEULL,
-    0x0000000000D08E4FULL,
-    0x0000000000D0902DULL,
-    0x0000000000D090E5ULL,
-    0x0000000000D09124ULL,
-    0x0000000000D09199ULL,
-    0x0000000000D09245ULL,
-    0x0000000000D0964CULL,
-    0x0000000000D09921ULL,
-    0x0000000000D09923ULL,
-    0x0000000000D09CB3ULL,
-    0x0000000000D09CF3ULL,
-    0x0000000000D09D23ULL,
-    0x0000000000D09DA1ULL,
-    0x0000000000D09DF4ULL,
-    0x0000000000D09EB3ULL,
-    0x0000000000D0A1E5ULL,
-    0x0000000000D0A2A1ULL,
-    0x0000000000D0A2E1ULL,
-    0x0000000000D0A493ULL,
-    0x0000000000D0A56FULL,
-    0x0000000000D0A573ULL,
-    0x0000000000D0A585ULL,
-    0x0000000000D0A58CULL,
-    0x0000000000D0A593ULL,
-    0x0000000000D0A5B3ULL,
-    0x0000000000D0A5D3ULL,
-    0x0000000000D0A645ULL,
-    0x0000000000D0A653ULL,
-    0x0000000000D0A665ULL,
-    0x0000000000D0A674ULL,
-    0x0000000000D0A745ULL,
-    0x0000000000D0A9F2ULL,
-    0x0000000000D0AC32ULL,
-    0x0000000000D0ACB2ULL,
-    0x0000000000D0ACB3ULL,
-    0x0000000000D0AD33ULL,
-    0x0000000000D0ADF3ULL,
-    0x0000000000D0B02DULL,
-    0x0000000000D0B032ULL,
-    0x0000000000D0B033ULL,
-    0x0000000000D0B038ULL,
-    0x0000000000D0B0B3ULL,
-    0x0000000000D0B123ULL,
-    0x0000000000D0B12BULL,
-    0x0000000000D0B133ULL,
-    0x0000000000D0B193ULL,
-    0x0000000000D0B1B3ULL,
-    0x0000000000D0B1B9ULL,
-    0x0000000000D0B293ULL,
-    0x0000000000D0B299ULL,
-    0x0000000000D0B2B3ULL,
-    0x0000000000D0B2C1ULL,
-    0x0000000000D0B2E1ULL,
-    0x0000000000D0B433ULL,
-    0x0000000000D0B441ULL,
-    0x0000000000D0B44FULL,
-    0x0000000000D0B4A5ULL,
-    0x0000000000D0B4B9ULL,
-    0x0000000000D0B525ULL,
-    0x0000000000D0B5A1ULL,
-    0x0000000000D0B5B9ULL,
-    0x0000000000D0B833ULL,
-    0x0000000000D0B834ULL,
-    0x0000000000D0B889ULL,
-    0x0000000000D0B8A2ULL,
-    0x0000000000D0B8A4ULL,
-    0x0000000000D0B8A8ULL,
-    0x0000000000D0B8B3ULL,
-    0x0000000000D0B8B4ULL,
-    0x0000000000D0B8E1ULL,
-    0x0000000000D0B8E5ULL,
-    0x0000000000D0B8EFULL,
-    0x0000000000D0B8F3ULL,
-    0x0000000000D0B8F9ULL,
-    0x0000000000D0B921ULL,
-    0x0000000000D0B923ULL,
-    0x0000000000D0B933ULL,
-    0x0000000000D0B979ULL,
-    0x0000000000D0B999ULL,
-    0x0000000000D0B9C1ULL,
-    0x0000000000D0B9F2ULL,
-    0x0000000000D0B9F3ULL,
-    0x0000000000D0BA65ULL,
-    0x0000000000D0BA81ULL,
-    0x0000000000D0BA8FULL,
-    0x0000000000D0BA99ULL,
-    0x0000000000D0BAACULL,
-    0x0000000000D0BAB3ULL,
-    0x0000000000D0C035ULL,
-    0x0000000000D0C185ULL,
-    0x0000000000D0C6A9ULL,
-    0x0000000000D0C825ULL,
-    0x0000000000D0C828ULL,
-    0x0000000000D0C833ULL,
-    0x0000000000D0C868ULL,
-    0x0000000000D0C873ULL,
-    0x0000000000D0C899ULL,
-    0x0000000000D0C8B3ULL,
-    0x0000000000D0C8E5ULL,
-    0x0000000000D0C8F3ULL,
-    0x0000000000D0C921ULL,
-    0x0000000000D0C924ULL,
-    0x0000000000D0C961ULL,
-    0x0000000000D0C973ULL,
-    0x0000000000D0C985ULL,
-    0x0000000000D0C993ULL,
-    0x0000000000D0C999ULL,
-    0x0000000000D0C9B3ULL,
-    0x0000000000D0C9EEULL,
-    0x0000000000D0C9F2ULL,
-    0x0000000000D0CA41ULL,
-    0x0000000000D0CA49ULL,
-    0x0000000000D0CA59ULL,
-    0x0000000000D0CA65ULL,
-    0x0000000000D0CA68ULL,
-    0x0000000000D0CA93ULL,
-    0x0000000000D0CAD9ULL,
-    0x0000000000D0CC33ULL,
-    0x0000000000D0CCA4ULL,
-    0x0000000000D0CCB2ULL,
-    0x0000000000D0CCB3ULL,
-    0x0000000000D0CD19ULL,
-    0x0000000000D0CD73ULL,
-    0x0000000000D0CDEEULL,
-    0x0000000000D0CE61ULL,
-    0x0000000000D0CE65ULL,
-    0x0000000000D0CE79ULL,
-    0x0000000000D0CE93ULL,
-    0x0000000000D0CE99ULL,
-    0x0000000000D0CEB3ULL,
-    0x0000000000D0D029ULL,
-    0x0000000000D0D068ULL,
-    0x0000000000D0D0A4ULL,
-    0x0000000000D0D0B2ULL,
-    0x0000000000D0D0B3ULL,
-    0x0000000000D0D0B9ULL,
-    0x0000000000D0D113ULL,
-    0x0000000000D0D12EULL,
-    0x0000000000D0D18FULL,
-    0x0000000000D0D285ULL,
-    0x0000000000D0D293ULL,
-    0x0000000000D0D341ULL,
-    0x0000000000D0D34FULL,
-    0x0000000000D0D459ULL,
-    0x0000000000D0D493ULL,
-    0x0000000000D0D593ULL,
-    0x0000000000D0D5C4ULL,
-    0x0000000000D0D649ULL,
-    0x0000000000D0D679ULL,
-    0x0000000000D0D693ULL,
-    0x0000000000D0D6C5ULL,
-    0x0000000000D0D759ULL,
-    0x0000000000D0D8AEULL,
-    0x0000000000D0D925ULL,
-    0x0000000000D0D92EULL,
-    0x0000000000D0D933ULL,
-    0x0000000000D0DCA4ULL,
-    0x0000000000D0DD73ULL,
-    0x0000000000D0DD79ULL,
-    0x0000000000D0DDD3ULL,
-    0x0000000000D0DE53ULL,
-    0x0000000000D0E0A4ULL,
-    0x0000000000D0E0B3ULL,
-    0x0000000000D0E12DULL,
-    0x0000000000D0E133ULL,
-    0x0000000000D0E42EULL,
-    0x0000000000D0E433ULL,
-    0x0000000000D0E445ULL,
-    0x0000000000D0E4A4ULL,
-    0x0000000000D0E5F2ULL,
-    0x0000000000D0E5F3ULL,
-    0x0000000000D0E674ULL,
-    0x0000000000D0E8A4ULL,
-    0x0000000000D0E8B2ULL,
-    0x0000000000D0E8B3ULL,
-    0x0000000000D0E8B9ULL,
-    0x0000000000D0EAB4ULL,
-    0x0000000000D12641ULL,
-    0x0000000000D28493ULL,
-    0x0000000000D28593ULL,
-    0x0000000000D28599ULL,
-    0x0000000000D285C5ULL,
-    0x0000000000D285D3ULL,
-    0x0000000000D285D4ULL,
-    0x0000000000D285D9ULL,
-    0x0000000000D28645ULL,
-    0x0000000000D28665ULL,
-    0x0000000000D28688ULL,
-    0x0000000000D28693ULL,
-    0x0000000000D28699ULL,
-    0x0000000000D289F3ULL,
-    0x0000000000D28C61ULL,
-    0x0000000000D28D13ULL,
-    0x0000000000D28D73ULL,
-    0x0000000000D2902CULL,
-    0x0000000000D29121ULL,
-    0x0000000000D29123ULL,
-    0x0000000000D29129ULL,
-    0x0000000000D29185ULL,
-    0x0000000000D29493ULL,
-    0x0000000000D29653ULL,
-    0x0000000000D29693ULL,
-    0x0000000000D298D3ULL,
-    0x0000000000D2A5D3ULL,
-    0x0000000000D2A5D4ULL,
-    0x0000000000D2A5D9ULL,
-    0x0000000000D2A688ULL,
-    0x0000000000D2AD61ULL,
-    0x0000000000D2B033ULL,
-    0x0000000000D2B041ULL,
-    0x0000000000D2B093ULL,
-    0x0000000000D2B0A5ULL,
-    0x0000000000D2B123ULL,
-    0x0000000000D2B12BULL,
-    0x0000000000D2B193ULL,
-    0x0000000000D2B1EEULL,
-    0x0000000000D2B293ULL,
-    0x0000000000D2B299ULL,
-    0x0000000000D2B4B3ULL,
-    0x0000000000D2B5F3ULL,
-    0x0000000000D2B824ULL,
-    0x0000000000D2B893ULL,
-    0x0000000000D2B8A4ULL,
-    0x0000000000D2B8B3ULL,
-    0x0000000000D2B8E5ULL,
-    0x0000000000D2B8F3ULL,
-    0x0000000000D2BA61ULL,
-    0x0000000000D2BA65ULL,
-    0x0000000000D2BA68ULL,
-    0x0000000000D2BA81ULL,
-    0x0000000000D2BA8FULL,
-    0x0000000000D2BAB3ULL,
-    0x0000000000D2BEB3ULL,
-    0x0000000000D2BEF3ULL,
-    0x0000000000D2C868ULL,
-    0x0000000000D2C873ULL,
-    0x0000000000D2C879ULL,
-    0x0000000000D2C885ULL,
-    0x0000000000D2C8A4ULL,
-    0x0000000000D2C8ACULL,
-    0x0000000000D2C8B2ULL,
-    0x0000000000D2C8B3ULL,
-    0x0000000000D2C8E5ULL,
-    0x0000000000D2C92CULL,
-    0x0000000000D2C933ULL,
-    0x0000000000D2C934ULL,
-    0x0000000000D2C973ULL,
-    0x0000000000D2C985ULL,
-    0x0000000000D2C993ULL,
-    0x0000000000D2CA59ULL,
-    0x0000000000D2CA65ULL,
-    0x0000000000D2CC2CULL,
-    0x0000000000D2CC33ULL,
-    0x0000000000D2CCACULL,
-    0x0000000000D2CCB3ULL,
-    0x0000000000D2CD19ULL,
-    0x0000000000D2CD23ULL,
-    0x0000000000D2CDC5ULL,
-    0x0000000000D2CDEEULL,
-    0x0000000000D2CE79ULL,
-    0x0000000000D2CE8FULL,
-    0x0000000000D2D02CULL,
-    0x0000000000D2D0A4ULL,
-    0x0000000000D2D0B2ULL,
-    0x0000000000D2D0B3ULL,
-    0x0000000000D2D10FULL,
-    0x0000000000D2D113ULL,
-    0x0000000000D2D123ULL,
-    0x0000000000D2D126ULL,
-    0x0000000000D2D133ULL,
-    0x0000000000D2D1ECULL,
-    0x0000000000D2D245ULL,
-    0x0000000000D2D24FULL,
-    0x0000000000D2D665ULL,
-    0x0000000000D2D8A4ULL,
-    0x0000000000D2D8B3ULL,
-    0x0000000000D2DCA4ULL,
-    0x0000000000D2DD93ULL,
-    0x0000000000D2E5D4ULL,
-    0x0000000000D2E8B3ULL,
-    0x0000000000D2EB45ULL,
-    0x0000000000D2EB4FULL,
-    0x0000000000D43E52ULL,
-    0x0000000000D485F5ULL,
-    0x0000000000D485F7ULL,
-    0x0000000000D4866DULL,
-    0x0000000000D486ACULL,
-    0x0000000000D48C33ULL,
-    0x0000000000D48D05ULL,
-    0x0000000000D48D14ULL,
-    0x0000000000D48D73ULL,
-    0x0000000000D48D79ULL,
-    0x0000000000D48DF3ULL,
-    0x0000000000D48E41ULL,
-    0x0000000000D48E4FULL,
-    0x0000000000D49099ULL,
-    0x0000000000D490E5ULL,
-    0x0000000000D490F9ULL,
-    0x0000000000D49133ULL,
-    0x0000000000D49274ULL,
-    0x0000000000D495D3ULL,
-    0x0000000000D496C5ULL,
-    0x0000000000D498D3ULL,
-    0x0000000000D498D9ULL,
-    0x0000000000D49A99ULL,
-    0x0000000000D49CF3ULL,
-    0x0000000000D49D14ULL,
-    0x0000000000D4A033ULL,
-    0x0000000000D4A133ULL,
-    0x0000000000D4ACA4ULL,
-    0x0000000000D4ACB3ULL,
-    0x0000000000D4AE41ULL,
-    0x0000000000D4AEC1ULL,
-    0x0000000000D4B068ULL,
-    0x0000000000D4B093ULL,
-    0x0000000000D4B0B2ULL,
-    0x0000000000D4B0B3ULL,
-    0x0000000000D4B0D3ULL,
-    0x0000000000D4B121ULL,
-    0x0000000000D4B16FULL,
-    0x0000000000D4B173ULL,
-    0x0000000000D4B179ULL,
-    0x0000000000D4B185ULL,
-    0x0000000000D4B193ULL,
-    0x0000000000D4B1F2ULL,
-    0x0000000000D4B1F3ULL,
-    0x0000000000D4B201ULL,
-    0x0000000000D4B293ULL,
-    0x0000000000D4B299ULL,
-    0x0000000000D4B29AULL,
-    0x0000000000D4B4A4ULL,
-    0x0000000000D4B4AFULL,
-    0x0000000000D4B4B2ULL,
-    0x0000000000D4B4B3ULL,
-    0x0000000000D4B523ULL,
-    0x0000000000D4B679ULL,
-    0x0000000000D4B825ULL,
-    0x0000000000D4B832ULL,
-    0x0000000000D4B833ULL,
-    0x0000000000D4B865ULL,
-    0x0000000000D4B879ULL,
-    0x0000000000D4B893ULL,
-    0x0000000000D4B8A4ULL,
-    0x0000000000D4B8B2ULL,
-    0x0000000000D4B8B3ULL,
-    0x0000000000D4B8E5ULL,
-    0x0000000000D4B8F3ULL,
-    0x0000000000D4B8F9ULL,
-    0x0000000000D4B92DULL,
-    0x0000000000D4B933ULL,
-    0x0000000000D4B965ULL,
-    0x0000000000D4B973ULL,
-    0x0000000000D4B9D9ULL,
-    0x0000000000D4B9F2ULL,
-    0x0000000000D4B9F3ULL,
-    0x0000000000D4BA93ULL,
-    0x0000000000D4BA99ULL,
-    0x0000000000D4BAB3ULL,
-    0x0000000000D4C8A4ULL,
-    0x0000000000D4C8B3ULL,
-    0x0000000000D4C8B8ULL,
-    0x0000000000D4C924ULL,
-    0x0000000000D4C92EULL,
-    0x0000000000D4C973ULL,
-    0x0000000000D4C979ULL,
-    0x0000000000D4C999ULL,
-    0x0000000000D4C9F3ULL,
-    0x0000000000D4CA88ULL,
-    0x0000000000D4CAD3ULL,
-    0x0000000000D4CB41ULL,
-    0x0000000000D4CC68ULL,
-    0x0000000000D4CC8FULL,
-    0x0000000000D4CCB2ULL,
-    0x0000000000D4CCB3ULL,
-    0x0000000000D4CCEFULL,
-    0x0000000000D4CDF3ULL,
-    0x0000000000D4CE61ULL,
-    0x0000000000D4CE79ULL,
-    0x0000000000D4CE93ULL,
-    0x0000000000D4CE99ULL,
-    0x0000000000D4D068ULL,
-    0x0000000000D4D0B2ULL,
-    0x0000000000D4D0B3ULL,
-    0x0000000000D4D133ULL,
-    0x0000000000D4D245ULL,
-    0x0000000000D4D293ULL,
-    0x0000000000D4E0A4ULL,
-    0x0000000000D4E0AEULL,
-    0x0000000000D4E0B2ULL,
-    0x0000000000D4E0B3ULL,
-    0x0000000000D4E285ULL,
-    0x0000000000D4E2B0ULL,
-    0x0000000000D4E8AEULL,
-    0x0000000000D4EB59ULL,
-    0x0000000000D715A5ULL,
-    0x0000000000D785D3ULL,
-    0x0000000000D78693ULL,
-    0x0000000000D78859ULL,
-    0x0000000000D788B3ULL,
-    0x0000000000D788B9ULL,
-    0x0000000000D78925ULL,
-    0x0000000000D78985ULL,
-    0x0000000000D78D01ULL,
-    0x0000000000D78D09ULL,
-    0x0000000000D78D13ULL,
-    0x0000000000D78D19ULL,
-    0x0000000000D78D73ULL,
-    0x0000000000D7902CULL,
-    0x0000000000D790ACULL,
-    0x0000000000D790ADULL,
-    0x0000000000D790B2ULL,
-    0x0000000000D790B3ULL,
-    0x0000000000D790E5ULL,
-    0x0000000000D79129ULL,
-    0x0000000000D792B3ULL,
-    0x0000000000D79653ULL,
-    0x0000000000D799F3ULL,
-    0x0000000000D79CF9ULL,
-    0x0000000000D79EACULL,
-    0x0000000000D7A0ACULL,
-    0x0000000000D7A1F3ULL,
-    0x0000000000D7A253ULL,
-    0x0000000000D7A2A1ULL,
-    0x0000000000D7A2B2ULL,
-    0x0000000000D7A585ULL,
-    0x0000000000D7A593ULL,
-    0x0000000000D7A641ULL,
-    0x0000000000D7A645ULL,
-    0x0000000000D7A674ULL,
-    0x0000000000D7A693ULL,
-    0x0000000000D7A9F3ULL,
-    0x0000000000D7ACB3ULL,
-    0x0000000000D7AD33ULL,
-    0x0000000000D7ADF3ULL,
-    0x0000000000D7B02CULL,
-    0x0000000000D7B032ULL,
-    0x0000000000D7B033ULL,
-    0x0000000000D7B093ULL,
-    0x0000000000D7B099ULL,
-    0x0000000000D7B0A4ULL,
-    0x0000000000D7B0B3ULL,
-    0x0000000000D7B181ULL,
-    0x0000000000D7B193ULL,
-    0x0000000000D7B199ULL,
-    0x0000000000D7B28FULL,
-    0x0000000000D7B293ULL,
-    0x0000000000D7B333ULL,
-    0x0000000000D7B4B3ULL,
-    0x0000000000D7B5A1ULL,
-    0x0000000000D7B5B9ULL,
-    0x0000000000D7B6B3ULL,
-    0x0000000000D7B824ULL,
-    0x0000000000D7B82CULL,
-    0x0000000000D7B833ULL,
-    0x0000000000D7B885ULL,
-    0x0000000000D7B88FULL,
-    0x0000000000D7B8B2ULL,
-    0x0000000000D7B8B9ULL,
-    0x0000000000D7B8EFULL,
-    0x0000000000D7B8F3ULL,
-    0x0000000000D7B923ULL,
-    0x0000000000D7B925ULL,
-    0x0000000000D7B973ULL,
-    0x0000000000D7B9F3ULL,
-    0x0000000000D7BA85ULL,
-    0x0000000000D7BA88ULL,
-    0x0000000000D7BA99ULL,
-    0x0000000000D7BC53ULL,
-    0x0000000000D7BC68ULL,
-    0x0000000000D7BC93ULL,
-    0x0000000000D7BC99ULL,
-    0x0000000000D7BCA4ULL,
-    0x0000000000D7BD73ULL,
-    0x0000000000D7BD81ULL,
-    0x0000000000D7BD89ULL,
-    0x0000000000D7BD93ULL,
-    0x0000000000D7BD99ULL,
-    0x0000000000D7BDC7ULL,
-    0x0000000000D7BDD3ULL,
-    0x0000000000D7BDD9ULL,
-    0x0000000000D7BE13ULL,
-    0x0000000000D7BE53ULL,
-    0x0000000000D7BE59ULL,
-    0x0000000000D7BE65ULL,
-    0x0000000000D7BE93ULL,
-    0x0000000000D7BEC5ULL,
-    0x0000000000D7C0A4ULL,
-    0x0000000000D7C0B2ULL,
-    0x0000000000D7C0B3ULL,
-    0x0000000000D7C0B9ULL,
-    0x0000000000D7C219ULL,
-    0x0000000000D7C279ULL,
-    0x0000000000D7C2B3ULL,
-    0x0000000000D7C825ULL,
-    0x0000000000D7C82CULL,
-    0x0000000000D7C833ULL,
-    0x0000000000D7C834ULL,
-    0x0000000000D7C839ULL,
-    0x0000000000D7C8ACULL,
-    0x0000000000D7C8B3ULL,
-    0x0000000000D7C921ULL,
-    0x0000000000D7C9C5ULL,
-    0x0000000000D7C9D3ULL,
-    0x0000000000D7C9EEULL,
-    0x0000000000D7CA08ULL,
-    0x0000000000D7CA41ULL,
-    0x0000000000D7CA4FULL,
-    0x0000000000D7CA65ULL,
-    0x0000000000D7CA93ULL,
-    0x0000000000D7CCA4ULL,
-    0x0000000000D7CCB3ULL,
-    0x0000000000D7CCB9ULL,
-    0x0000000000D7CD73ULL,
-    0x0000000000D7CE6FULL,
-    0x0000000000D7CE79ULL,
-    0x0000000000D7CE85ULL,
-    0x0000000000D7CE93ULL,
-    0x0000000000D7D0A4ULL,
-    0x0000000000D7D0ACULL,
-    0x0000000000D7D0AEULL,
-    0x0000000000D7D0B3ULL,
-    0x0000000000D7D0B4ULL,
-    0x0000000000D7D0B9ULL,
-    0x0000000000D7D113ULL,
-    0x0000000000D7D119ULL,
-    0x0000000000D7D126ULL,
-    0x0000000000D7D133ULL,
-    0x0000000000D7D1F2ULL,
-    0x0000000000D7D285ULL,
-    0x0000000000D7D28FULL,
-    0x0000000000D7D293ULL,
-    0x0000000000D7D299ULL,
-    0x0000000000D7D2B3ULL,
-    0x0000000000D7D341ULL,
-    0x0000000000D7D468ULL,
-    0x0000000000D7D4B3ULL,
-    0x0000000000D7D584ULL,
-    0x0000000000D7D593ULL,
-    0x0000000000D7D594ULL,
-    0x0000000000D7D5C4ULL,
-    0x0000000000D7D5D4ULL,
-    0x0000000000D7D613ULL,
-    0x0000000000D7D64EULL,
-    0x0000000000D7D665ULL,
-    0x0000000000D7D674ULL,
-    0x0000000000D7D679ULL,
-    0x0000000000D7D688ULL,
-    0x0000000000D7D8A4ULL,
-    0x0000000000D7D8B2ULL,
-    0x0000000000D7D8B3ULL,
-    0x0000000000D7D925ULL,
-    0x0000000000D7DC33ULL,
-    0x0000000000D7DCA4ULL,
-    0x0000000000D7DCB2ULL,
-    0x0000000000D7DE41ULL,
-    0x0000000000D7E033ULL,
-    0x0000000000D7E125ULL,
-    0x0000000000D7E433ULL,
-    0x0000000000D7E585ULL,
-    0x0000000000D7E593ULL,
-    0x0000000000D7E8A4ULL,
-    0x0000000000D7E8B3ULL,
-    0x0000000000D7E9F3ULL,
-    0x0000000000D848B4ULL,
-    0x0000000000DA8D0FULL,
-    0x0000000000DA8D23ULL,
-    0x0000000000DA8D24ULL,
-    0x0000000000DA8D2EULL,
-    0x0000000000DA8D73ULL,
-    0x0000000000DA8D79ULL,
-    0x0000000000DA8DF2ULL,
-    0x0000000000DA8E4FULL,
-    0x0000000000DA8EB3ULL,
-    0x0000000000DA9099ULL,
-    0x0000000000DA90E5ULL,
-    0x0000000000DA9132ULL,
-    0x0000000000DA9241ULL,
-    0x0000000000DA98D3ULL,
-    0x0000000000DA9A89ULL,
-    0x0000000000DA9CE1ULL,
-    0x0000000000DA9CF3ULL,
-    0x0000000000DA9CF9ULL,
-    0x0000000000DAA199ULL,
-    0x0000000000DAA493ULL,
-    0x0000000000DAA593ULL,
-    0x0000000000DAA653ULL,
-    0x0000000000DAA674ULL,
-    0x0000000000DAA92BULL,
-    0x0000000000DAB068ULL,
-    0x0000000000DAB074ULL,
-    0x0000000000DAB0A4ULL,
-    0x0000000000DAB0B3ULL,
-    0x0000000000DAB0B9ULL,
-    0x0000000000DAB0E1ULL,
-    0x0000000000DAB125ULL,
-    0x0000000000DAB181ULL,
-    0x0000000000DAB193ULL,
-    0x0000000000DAB265ULL,
-    0x0000000000DAB268ULL,
-    0x0000000000DAB5B3ULL,
-    0x0000000000DAB5B9ULL,
-    0x0000000000DAB613ULL,
-    0x0000000000DAB679ULL,
-    0x0000000000DAB6B3ULL,
-    0x0000000000DAB868ULL,
-    0x0000000000DAB8E1ULL,
-    0x0000000000DAB8E5ULL,
-    0x0000000000DAB8EFULL,
-    0x0000000000DAB8F3ULL,
-    0x0000000000DAB933ULL,
-    0x0000000000DABA93ULL,
-    0x0000000000DABA95ULL,
-    0x0000000000DABDD3ULL,
-    0x0000000000DAC82CULL,
-    0x0000000000DAC833ULL,
-    0x0000000000DAC8A4ULL,
-    0x0000000000DAC8B3ULL,
-    0x0000000000DAC8B8ULL,
-    0x0000000000DAC924ULL,
-    0x0000000000DAC973ULL,
-    0x0000000000DAC979ULL,
-    0x0000000000DAC993ULL,
-    0x0000000000DAC999ULL,
-    0x0000000000DACA41ULL,
-    0x0000000000DACA45ULL,
-    0x0000000000DACA49ULL,
-    0x0000000000DACA53ULL,
-    0x0000000000DACA59ULL,
-    0x0000000000DACA89ULL,
-    0x0000000000DACAC1ULL,
-    0x0000000000DACC32ULL,
-    0x0000000000DACC61ULL,
-    0x0000000000DACCA4ULL,
-    0x0000000000DACCB2ULL,
-    0x0000000000DACCB3ULL,
-    0x0000000000DACCB4ULL,
-    0x0000000000DACD01ULL,
-    0x0000000000DACD19ULL,
-    0x0000000000DACD23ULL,
-    0x0000000000DACD34ULL,
-    0x0000000000DACD73ULL,
-    0x0000000000DACD79ULL,
-    0x0000000000DACDF3ULL,
-    0x0000000000DACE65ULL,
-    0x0000000000DACE79ULL,
-    0x0000000000DACE88ULL,
-    0x0000000000DACE93ULL,
-    0x0000000000DACE99ULL,
-    0x0000000000DAD068ULL,
-    0x0000000000DAD0A4ULL,
-    0x0000000000DAD0B2ULL,
-    0x0000000000DAD0B3ULL,
-    0x0000000000DAD101ULL,
-    0x0000000000DAD133ULL,
-    0x0000000000DAD1EEULL,
-    0x0000000000DAD293ULL,
-    0x0000000000DAE0A4ULL,
-    0x0000000000DAE0B3ULL,
-    0x0000000000DAE82BULL,
-    0x0000000000DAEB59ULL,
-    0x0000000000DB5585ULL,
-    0x0000000000DC858CULL,
-    0x0000000000DCB032ULL,
-    0x0000000000DCB828ULL,
-    0x0000000000DCB833ULL,
-    0x0000000000DCBD24ULL,
-    0x0000000000DCBDA1ULL,
-    0x0000000000DCBE05ULL,
-    0x0000000000DCBE13ULL,
-    0x0000000000DCBE19ULL,
-    0x0000000000DCCA48ULL,
-    0x0000000000DCCD24ULL,
-    0x0000000000DCD109ULL,
-    0x0000000000DCD113ULL,
-    0x0000000000DCD119ULL,
-    0x0000000000DCE1F3ULL,
-    0x0000000000DD14B3ULL,
-    0x0000000000E085B3ULL,
-    0x0000000000E085D3ULL,
-    0x0000000000E088B3ULL,
-    0x0000000000E08933ULL,
-    0x0000000000E08973ULL,
-    0x0000000000E08981ULL,
-    0x0000000000E089E2ULL,
-    0x0000000000E08D05ULL,
-    0x0000000000E08D0FULL,
-    0x0000000000E08E45ULL,
-    0x0000000000E09033ULL,
-    0x0000000000E09132ULL,
-    0x0000000000E096C5ULL,
-    0x0000000000E096C9ULL,
-    0x0000000000E098D3ULL,
-    0x0000000000E09C33ULL,
-    0x0000000000E09CF9ULL,
-    0x0000000000E09DF2ULL,
-    0x0000000000E0A02CULL,
-    0x0000000000E0A424ULL,
-    0x0000000000E0A4D3ULL,
-    0x0000000000E0A573ULL,
-    0x0000000000E0A593ULL,
-    0x0000000000E0A641ULL,
-    0x0000000000E0A655ULL,
-    0x0000000000E0A6C5ULL,
-    0x0000000000E0ACA4ULL,
-    0x0000000000E0ACB2ULL,
-    0x0000000000E0ACC1ULL,
-    0x0000000000E0B033ULL,
-    0x0000000000E0B0A4ULL,
-    0x0000000000E0B181ULL,
-    0x0000000000E0B4A4ULL,
-    0x0000000000E0B4B2ULL,
-    0x0000000000E0B4B3ULL,
-    0x0000000000E0B5A1ULL,
-    0x0000000000E0B6B3ULL,
-    0x0000000000E0B833ULL,
-    0x0000000000E0B865ULL,
-    0x0000000000E0B879ULL,
-    0x0000000000E0B895ULL,
-    0x0000000000E0B9C1ULL,
-    0x0000000000E0B9D9ULL,
-    0x0000000000E0B9F3ULL,
-    0x0000000000E0BAA1ULL,
-    0x0000000000E0C033ULL,
-    0x0000000000E0C0A4ULL,
-    0x0000000000E0C0B3ULL,
-    0x0000000000E0C1EFULL,
-    0x0000000000E0C201ULL,
-    0x0000000000E0C205ULL,
-    0x0000000000E0C219ULL,
-    0x0000000000E0C833ULL,
-    0x0000000000E0C86FULL,
-    0x0000000000E0C873ULL,
-    0x0000000000E0C893ULL,
-    0x0000000000E0C8B3ULL,
-    0x0000000000E0C923ULL,
-    0x0000000000E0C933ULL,
-    0x0000000000E0C973ULL,
-    0x0000000000E0C979ULL,
-    0x0000000000E0CA45ULL,
-    0x0000000000E0CC2CULL,
-    0x0000000000E0CD09ULL,
-    0x0000000000E0CE99ULL,
-    0x0000000000E0D02CULL,
-    0x0000000000E0D068ULL,
-    0x0000000000E0D0B3ULL,
-    0x0000000000E0D133ULL,
-    0x0000000000E0D299ULL,
-    0x0000000000E0D468ULL,
-    0x0000000000E0D5D4ULL,
-    0x0000000000E0D82CULL,
-    0x0000000000E0D832ULL,
-    0x0000000000E0D8ACULL,
-    0x0000000000E0D8B3ULL,
-    0x0000000000E0D8B7ULL,
-    0x0000000000E0DAD9ULL,
-    0x0000000000E0DC22ULL,
-    0x0000000000E0E8B3ULL,
-    0x0000000000E0E932ULL,
-    0x0000000000E0E933ULL,
-    0x0000000000E25541ULL,
-    0x0000000000E284C5ULL,
-    0x0000000000E28593ULL,
-    0x0000000000E28613ULL,
-    0x0000000000E28653ULL,
-    0x0000000000E28688ULL,
-    0x0000000000E28693ULL,
-    0x0000000000E288ABULL,
-    0x0000000000E288ACULL,
-    0x0000000000E28D73ULL,
-    0x0000000000E29099ULL,
-    0x0000000000E29493ULL,
-    0x0000000000E29499ULL,
-    0x0000000000E29584ULL,
-    0x0000000000E29585ULL,
-    0x0000000000E295A2ULL,
-    0x0000000000E295B3ULL,
-    0x0000000000E29613ULL,
-    0x0000000000E29665ULL,
-    0x0000000000E29745ULL,
-    0x0000000000E29E4FULL,
-    0x0000000000E29EB3ULL,
-    0x0000000000E2A4D3ULL,
-    0x0000000000E2A4E8ULL,
-    0x0000000000E2A674ULL,
-    0x0000000000E2A6C5ULL,
-    0x0000000000E2B133ULL,
-    0x0000000000E2B199ULL,
-    0x0000000000E2B433ULL,
-    0x0000000000E2B5D3ULL,
-    0x0000000000E2B614ULL,
-    0x0000000000E2B8B3ULL,
-    0x0000000000E2BDD3ULL,
-    0x0000000000E2C0B2ULL,
-    0x0000000000E2C134ULL,
-    0x0000000000E2C82CULL,
-    0x0000000000E2C893ULL,
-    0x0000000000E2C899ULL,
-    0x0000000000E2C961ULL,
-    0x0000000000E2C973ULL,
-    0x0000000000E2C9ECULL,
-    0x0000000000E2CA93ULL,
-    0x0000000000E2CA9AULL,
-    0x0000000000E2CAC5ULL,
-    0x0000000000E2CAD9ULL,
-    0x0000000000E2CE93ULL,
-    0x0000000000E2D0B3ULL,
-    0x0000000000E2D1F0ULL,
-    0x0000000000E2D293ULL,
-    0x0000000000E2D299ULL,
-    0x0000000000E2D573ULL,
-    0x0000000000E2D5A5ULL,
-    0x0000000000E2D5B3ULL,
-    0x0000000000E2D8ACULL,
-    0x0000000000E2D8B2ULL,
-    0x0000000000E2D8B3ULL,
-    0x0000000000E2DAB3ULL,
-    0x0000000000E2DC53ULL,
-    0x0000000000E2DCA4ULL,
-    0x0000000000E2DCACULL,
-    0x0000000000E2DCB2ULL,
-    0x0000000000E2DD25ULL,
-    0x0000000000E2DD99ULL,
-    0x0000000000E2DE79ULL,
-    0x0000000000E2DE93ULL,
-    0x0000000000E2E293ULL,
-    0x0000000000E2E2B3ULL,
-    0x0000000000E3852FULL,
-    0x0000000000E385C1ULL,
-    0x0000000000E38689ULL,
-    0x0000000000E3BDA1ULL,
-    0x0000000000E3DCA5ULL,
-    0x0000000000E48C24ULL,
-    0x0000000000E48CB2ULL,
-    0x0000000000E48D05ULL,
-    0x0000000000E48D14ULL,
-    0x0000000000E48D73ULL,
-    0x0000000000E48DECULL,
-    0x0000000000E4902CULL,
-    0x0000000000E490A4ULL,
-    0x0000000000E490B3ULL,
-    0x0000000000E491F2ULL,
-    0x0000000000E492B3ULL,
-    0x0000000000E49465ULL,
-    0x0000000000E494D3ULL,
-    0x0000000000E496C5ULL,
-    0x0000000000E498B3ULL,
-    0x0000000000E498D3ULL,
-    0x0000000000E498D9ULL,
-    0x0000000000E49A99ULL,
-    0x0000000000E49CB2ULL,
-    0x0000000000E49D13ULL,
-    0x0000000000E49D14ULL,
-    0x0000000000E4A12CULL,
-    0x0000000000E4AC22ULL,
-    0x0000000000E4AC28ULL,
-    0x0000000000E4AC35ULL,
-    0x0000000000E4B193ULL,
-    0x0000000000E4B449ULL,
-    0x0000000000E4B453ULL,
-    0x0000000000E4B613ULL,
-    0x0000000000E4B8B2ULL,
-    0x0000000000E4B8B3ULL,
-    0x0000000000E4B941ULL,
-    0x0000000000E4B9D9ULL,
-    0x0000000000E4B9EEULL,
-    0x0000000000E4BA88ULL,
-    0x0000000000E4C033ULL,
-    0x0000000000E4C219ULL,
-    0x0000000000E4C422ULL,
-    0x0000000000E4C993ULL,
-    0x0000000000E4C999ULL,
-    0x0000000000E4CCA9ULL,
-    0x0000000000E4CE65ULL,
-    0x0000000000E4CEB3ULL,
-    0x0000000000E4D0B2ULL,
-    0x0000000000E4D0B3ULL,
-    0x0000000000E4D124ULL,
-    0x0000000000E4D1EEULL,
-    0x0000000000E4D245ULL,
-    0x0000000000E4D24FULL,
-    0x0000000000E4D259ULL,
-    0x0000000000E4D299ULL,
-    0x0000000000E4D82CULL,
-    0x0000000000E4E0A4ULL,
-    0x0000000000E4E0B2ULL,
-    0x0000000000E4E0B3ULL,
-    0x0000000000E4E125ULL,
-    0x0000000000E4E82DULL,
-    0x0000000000E5BE69ULL,
-    0x0000000000E78513ULL,
-    0x0000000000E78859ULL,
-    0x0000000000E78985ULL,
-    0x0000000000E78999ULL,
-    0x0000000000E78D73ULL,
-    0x0000000000E7902CULL,
-    0x0000000000E79099ULL,
-    0x0000000000E790B3ULL,
-    0x0000000000E792B3ULL,
-    0x0000000000E79593ULL,
-    0x0000000000E79CF3ULL,
-    0x0000000000E7A1F7ULL,
-    0x0000000000E7A593ULL,
-    0x0000000000E7A599ULL,
-    0x0000000000E7A5D4ULL,
-    0x0000000000E7A653ULL,
-    0x0000000000E7A665ULL,
-    0x0000000000E7A679ULL,
-    0x0000000000E7B0B3ULL,
-    0x0000000000E7B193ULL,
-    0x0000000000E7B1F3ULL,
-    0x0000000000E7B424ULL,
-    0x0000000000E7B433ULL,
-    0x0000000000E7B4AEULL,
-    0x0000000000E7B4B3ULL,
-    0x0000000000E7B523ULL,
-    0x0000000000E7B5E9ULL,
-    0x0000000000E7B5F3ULL,
-    0x0000000000E7B833ULL,
-    0x0000000000E7B865ULL,
-    0x0000000000E7B8B3ULL,
-    0x0000000000E7B8B4ULL,
-    0x0000000000E7B8F3ULL,
-    0x0000000000E7B933ULL,
-    0x0000000000E7B9D9ULL,
-    0x0000000000E7BB2CULL,
-    0x0000000000E7BC53ULL,
-    0x0000000000E7BD34ULL,
-    0x0000000000E7BD73ULL,
-    0x0000000000E7BD79ULL,
-    0x0000000000E7BDD3ULL,
-    0x0000000000E7BE13ULL,
-    0x0000000000E7BE65ULL,
-    0x0000000000E7C02CULL,
-    0x0000000000E7C921ULL,
-    0x0000000000E7C933ULL,
-    0x0000000000E7C973ULL,
-    0x0000000000E7C9A1ULL,
-    0x0000000000E7C9B3ULL,
-    0x0000000000E7CA88ULL,
-    0x0000000000E7CCA4ULL,
-    0x0000000000E7CCB2ULL,
-    0x0000000000E7CCB3ULL,
-    0x0000000000E7CCB9ULL,
-    0x0000000000E7D02CULL,
-    0x0000000000E7D068ULL,
-    0x0000000000E7D0A4ULL,
-    0x0000000000E7D0B2ULL,
-    0x0000000000E7D0B3ULL,
-    0x0000000000E7D2ADULL,
-    0x0000000000E7D584ULL,
-    0x0000000000E7D585ULL,
-    0x0000000000E7D593ULL,
-    0x0000000000E7D5D3ULL,
-    0x0000000000E7D5D9ULL,
-    0x0000000000E7D613ULL,
-    0x0000000000E7D825ULL,
-    0x0000000000E7D833ULL,
-    0x0000000000E7D8ACULL,
-    0x0000000000E7DAADULL,
-    0x0000000000E7DC39ULL,
-    0x0000000000E7DCA4ULL,
-    0x0000000000E7DD93ULL,
-    0x0000000000E7DE93ULL,
-    0x0000000000E7DE99ULL,
-    0x0000000000E7E02CULL,
-    0x0000000000E7E0B3ULL,
-    0x0000000000E7E435ULL,
-    0x0000000000E7E4A4ULL,
-    0x0000000000E7E4B3ULL,
-    0x0000000000EA8859ULL,
-    0x0000000000EA8921ULL,
-    0x0000000000EA8D01ULL,
-    0x0000000000EA9099ULL,
-    0x0000000000EA90B2ULL,
-    0x0000000000EA90B3ULL,
-    0x0000000000EA90E5ULL,
-    0x0000000000EA9125ULL,
-    0x0000000000EA9348ULL,
-    0x0000000000EA98D3ULL,
-    0x0000000000EA9C25ULL,
-    0x0000000000EAACA4ULL,
-    0x0000000000EAACB3ULL,
-    0x0000000000EAB181ULL,
-    0x0000000000EAB193ULL,
-    0x0000000000EAB453ULL,
-    0x0000000000EAB4AEULL,
-    0x0000000000EAB5B9ULL,
-    0x0000000000EAB9D9ULL,
-    0x0000000000EAC893ULL,
-    0x0000000000EAC899ULL,
-    0x0000000000EAC993ULL,
-    0x0000000000EACA53ULL,
-    0x0000000000EACA65ULL,
-    0x0000000000EAD26FULL,
-    0x0000000000EAD279ULL,
-    0x0000000000EAD299ULL,
-    0x0000000000EC84C6ULL,
-    0x0000000000EC8581ULL,
-    0x0000000000ECA5C7ULL,
-    0x0000000000ECB1EEULL,
-    0x0000000000ECB608ULL,
-    0x0000000000ECCE61ULL,
-    0x0000000000F0ACA4ULL,
-    0x0000000000F0ACAEULL,
-    0x0000000000F0ACB2ULL,
-    0x0000000000F0AEADULL,
-    0x0000000000F0C8A4ULL,
-    0x0000000000F0CCB3ULL,
-    0x0000000000F0CD33ULL,
-    0x0000000000F0CE93ULL,
-    0x0000000000F0D0AEULL,
-    0x0000000000F0D0B2ULL,
-    0x0000000000F0D113ULL,
-    0x0000000000F0D8B3ULL,
-    0x0000000000F105C7ULL,
-    0x0000000000F11428ULL,
-    0x0000000000F11589ULL,
-    0x0000000000F11665ULL,
-    0x0000000000F11733ULL,
-    0x0000000000F12433ULL,
-    0x0000000000F124A4ULL,
-    0x0000000000F12534ULL,
-    0x0000000000F12693ULL,
-    0x0000000000F128B4ULL,
-    0x0000000000F13CB3ULL,
-    0x0000000000F13D85ULL,
-    0x0000000000F13D89ULL,
-    0x0000000000F13D93ULL,
-    0x0000000000F18C2DULL,
-    0x0000000000F18EB2ULL,
-    0x0000000000F1942EULL,
-    0x0000000000F1A0B2ULL,
-    0x0000000000F1A0B3ULL,
-    0x0000000000F1A245ULL,
-    0x0000000000F1A259ULL,
-    0x0000000000F1ACB2ULL,
-    0x0000000000F1C8A1ULL,
-    0x0000000000F1D024ULL,
-    0x0000000000F1D02CULL,
-    0x0000000000F1D02EULL,
-    0x0000000000F1D033ULL,
-    0x0000000000F1D0B4ULL,
-    0x0000000000F1D32CULL,
-    0x0000000000F1D589ULL,
-    0x0000000000F20513ULL,
-    0x0000000000F20593ULL,
-    0x0000000000F210B2ULL,
-    0x0000000000F21199ULL,
-    0x0000000000F215EEULL,
-    0x0000000000F216ADULL,
-    0x0000000000F2266DULL,
-    0x0000000000F22674ULL,
-    0x0000000000F226ADULL,
-    0x0000000000F23E53ULL,
-    0x0000000000F23EB2ULL,
-    0x0000000000F26585ULL,
-    0x0000000000F26593ULL,
-    0x0000000000F30733ULL,
-    0x0000000000F3182CULL,
-    0x0000000000F318A4ULL,
-    0x0000000000F318B2ULL,
-    0x0000000000F31925ULL,
-    0x0000000000F33027ULL,
-    0x0000000000F350AEULL,
-    0x0000000000F350B2ULL,
-    0x0000000000F385B3ULL,
-    0x0000000000F394A4ULL,
-    0x0000000000F394B3ULL,
-    0x0000000000F39D2EULL,
-    0x0000000000F3A02DULL,
-    0x0000000000F3A6C5ULL,
-    0x0000000000F3B0A4ULL,
-    0x0000000000F3B0B2ULL,
-    0x0000000000F3B0B3ULL,
-    0x0000000000F3B523ULL,
-    0x0000000000F3C8B3ULL,
-    0x0000000000F42433ULL,
-    0x0000000000F425C7ULL,
-    0x0000000000F43523ULL,
-    0x0000000000F43DC5ULL,
-    0x0000000000F49121ULL,
-    0x0000000000F4B0A4ULL,
-    0x0000000000F4B0B2ULL,
-    0x0000000000F4B973ULL,
-    0x0000000000F4BA93ULL,
-    0x0000000000F525A5ULL,
-    0x0000000000F58609ULL,
-    0x0000000000F58733ULL,
-    0x0000000000F59513ULL,
-    0x0000000000F5C833ULL,
-    0x0000000000F5D033ULL,
-    0x0000000000F610AEULL,
-    0x0000000000F610B2ULL,
-    0x0000000000F61125ULL,
-    0x0000000000F61523ULL,
-    0x0000000000F6152EULL,
-    0x0000000000F615D4ULL,
-    0x0000000000F615F3ULL,
-    0x0000000000F616ADULL,
-    0x0000000000F625F3ULL,
-    0x0000000000F626C5ULL,
-    0x0000000000F63033ULL,
-    0x0000000000F63036ULL,
-    0x0000000000F630B2ULL,
-    0x0000000000F63125ULL,
-    0x0000000000F63CF9ULL,
-    0x0000000000F64025ULL,
-    0x0000000000F640B3ULL,
-    0x0000000000F68661ULL,
-    0x0000000000F688B2ULL,
-    0x0000000000F68A45ULL,
-    0x0000000000F68AB3ULL,
-    0x0000000000F694E1ULL,
-    0x0000000000F695D3ULL,
-    0x0000000000F69653ULL,
-    0x0000000000F6A693ULL,
-    0x0000000000F6B028ULL,
-    0x0000000000F6BED3ULL,
-    0x0000000000F6C828ULL,
-    0x0000000000F70CB2ULL,
-    0x0000000000F70CB3ULL,
-    0x0000000000F70CB4ULL,
-    0x0000000000F70EB3ULL,
-    0x0000000000F71599ULL,
-    0x0000000000F71653ULL,
-    0x0000000000F71659ULL,
-    0x0000000000F725EEULL,
-    0x0000000000F726ADULL,
-    0x0000000000F72EB3ULL,
-    0x0000000000F73039ULL,
-    0x0000000000F738A4ULL,
-    0x0000000000F74CB4ULL,
-    0x0000000000F75123ULL,
-    0x0000000000F78934ULL,
-    0x0000000000F7A0A4ULL,
-    0x0000000000F7B608ULL,
-    0x0000000000F7BA93ULL,
-    0x0000000000F7C0A4ULL,
-    0x0000000000F7C925ULL,
-    0x0000000000F7CCB3ULL,
-    0x0000000000F7D124ULL,
-    0x0000000000F7E8A4ULL,
-    0x0000000000F7E8B3ULL,
-    0x0000000000F80513ULL,
-    0x0000000000F80593ULL,
-    0x0000000000F815D3ULL,
-    0x0000000000F81605ULL,
-    0x0000000000F81641ULL,
-    0x0000000000F825C5ULL,
-    0x0000000000F825C7ULL,
-    0x0000000000F826ADULL,
-    0x0000000000F841F3ULL,
-    0x0000000000F84D2EULL,
-    0x0000000000F850A4ULL,
-    0x0000000000F850B2ULL,
-    0x0000000000F85123ULL,
-    0x0000000000F90468ULL,
-    0x0000000000F90479ULL,
-    0x0000000000F90593ULL,
-    0x0000000000F905C7ULL,
-    0x0000000000F905D4ULL,
-    0x0000000000F90685ULL,
-    0x0000000000F908A4ULL,
-    0x0000000000F90934ULL,
-    0x0000000000F90C33ULL,
-    0x0000000000F90D2EULL,
-    0x0000000000F910B2ULL,
-    0x0000000000F911F3ULL,
-    0x0000000000F91424ULL,
-    0x0000000000F918B3ULL,
-    0x0000000000F91C2EULL,
-    0x0000000000F91D21ULL,
-    0x0000000000F91D23ULL,
-    0x0000000000F91EA5ULL,
-    0x0000000000F92449ULL,
-    0x0000000000F924ACULL,
-    0x0000000000F92701ULL,
-    0x0000000000F930B3ULL,
-    0x0000000000F931EEULL,
-    0x0000000000F931F0ULL,
-    0x0000000000F934B2ULL,
-    0x0000000000F93933ULL,
-    0x0000000000F9412EULL,
-    0x0000000000F94933ULL,
-    0x0000000000F9510FULL,
-    0x0000000000F9582CULL,
-    0x0000000000F969F3ULL,
-    0x0000000000F98C32ULL,
-    0x0000000000F9A023ULL,
-    0x0000000000F9A4B2ULL,
-    0x0000000000F9B523ULL,
-    0x0000000000F9B5ECULL,
-    0x0000000000F9CD21ULL,
-    0x0000000000F9D121ULL,
-    0x0000000000FA0575ULL,
-    0x0000000000FA0659ULL,
-    0x0000000000FA20B2ULL,
-    0x0000000000FA5032ULL,
-    0x0000000000FA50B2ULL,
-    0x0000000000FA51F3ULL,
-    0x0000000000FA8934ULL,
-    0x0000000000FA8D14ULL,
-    0x0000000000FA95D3ULL,
-    0x0000000000FA9D14ULL,
-    0x0000000000FAA541ULL,
-    0x0000000000FAB173ULL,
-    0x0000000000FAB433ULL,
-    0x0000000000FAB865ULL,
-    0x0000000000FAB899ULL,
-    0x0000000000FAC033ULL,
-    0x0000000000FAC0A4ULL,
-    0x0000000000FAC105ULL,
-    0x0000000000FAC113ULL,
-    0x0000000000FAC925ULL,
-    0x0000000000FACCACULL,
-    0x0000000000FACE93ULL,
-    0x0000000000FAD059ULL,
-    0x0000000000FAD08FULL,
-    0x0000000000FAD0A4ULL,
-    0x0000000000FAD0B2ULL,
-    0x0000000000FAD0EFULL,
-    0x0000000000FAD245ULL,
-    0x0000000000FAD24FULL,
-    0x0000000000FAD281ULL,
-    0x0000000000FAE8ACULL,
-    0x0000000000FAE9F3ULL,
-    0x0000000000FB0593ULL,
-    0x0000000000FB0659ULL,
-    0x0000000000FB0685ULL,
-    0x0000000000FB1593ULL,
-    0x0000000000FB15D3ULL,
-    0x0000000000FB1653ULL,
-    0x0000000000FB1654ULL,
-    0x0000000000FB25C5ULL,
-    0x0000000000FB2674ULL,
-    0x0000000000FB3D24ULL,
-    0x0000000000FB3D89ULL,
-    0x0000000000FB3D8FULL,
-    0x0000000000FB5585ULL,
-    0x0000000000FB8D05ULL,
-    0x0000000000FBA4B3ULL,
-    0x0000000000FBA5C7ULL,
-    0x0000000000FBB0A4ULL,
-    0x0000000000FBB0B2ULL,
-    0x0000000000FBB0B4ULL,
-    0x0000000000FBB8A4ULL,
-    0x0000000000FBB8B2ULL,
-    0x0000000000FBC8B3ULL,
-    0x0000000000FBC925ULL,
-    0x0000000000FBCCAEULL,
-    0x0000000000FC09F7ULL,
-    0x0000000000FC1653ULL,
-    0x0000000000FC1725ULL,
-    0x0000000000FC2485ULL,
-    0x0000000000FC2493ULL,
-    0x0000000000FC24B3ULL,
-    0x0000000000FC25A5ULL,
-    0x0000000000FC25B3ULL,
-    0x0000000000FC3130ULL,
-    0x0000000000FC50B2ULL,
-    0x0000000000FC9653ULL,
-    0x0000000000FD1569ULL,
-    0x0000000000FD3DC5ULL,
-    0x0000000000FD6925ULL,
-    0x0000000001008593ULL,
-    0x00000000010085D3ULL,
-    0x0000000001008C33ULL,
-    0x0000000001008CA4ULL,
-    0x0000000001008CB2ULL,
-    0x0000000001008CB3ULL,
-    0x0000000001008CB9ULL,
-    0x0000000001008D01ULL,
-    0x0000000001008D73ULL,
-    0x0000000001008DF3ULL,
-    0x0000000001008E81ULL,
-    0x0000000001008E93ULL,
-    0x0000000001009099ULL,
-    0x0000000001009133ULL,
-    0x0000000001009185ULL,
-    0x00000000010091A1ULL,
-    0x0000000001009245ULL,
-    0x0000000001009249ULL,
-    0x000000000100942EULL,
-    0x000000000100948FULL,
-    0x00000000010095EEULL,
-    0x0000000001009C2EULL,
-    0x0000000001009CA4ULL,
-    0x0000000001009CB2ULL,
-    0x0000000001009CB3ULL,
-    0x0000000001009D85ULL,
-    0x0000000001009DE4ULL,
-    0x0000000001009E49ULL,
-    0x000000000100A573ULL,
-    0x000000000100A593ULL,
-    0x000000000100A5D3ULL,
-    0x000000000100A5D4ULL,
-    0x000000000100A645ULL,
-    0x000000000100A653ULL,
-    0x000000000100A661ULL,
-    0x000000000100A665ULL,
-    0x000000000100AD61ULL,
-    0x000000000100B033ULL,
-    0x000000000100B039ULL,
-    0x000000000100B0A1ULL,
-    0x000000000100B0A4ULL,
-    0x000000000100B0B2ULL,
-    0x000000000100B0B3ULL,
-    0x000000000100B0B4ULL,
-    0x000000000100B133ULL,
-    0x000000000100B169ULL,
-    0x000000000100B181ULL,
-    0x000000000100B193ULL,
-    0x000000000100B199ULL,
-    0x000000000100B1B3ULL,
-    0x000000000100B1B9ULL,
-    0x000000000100B209ULL,
-    0x000000000100B213ULL,
-    0x000000000100B261ULL,
-    0x000000000100B279ULL,
-    0x000000000100B601ULL,
-    0x000000000100B838ULL,
-    0x000000000100B865ULL,
-    0x000000000100B881ULL,
-    0x000000000100B893ULL,
-    0x000000000100B899ULL,
-    0x000000000100B8A4ULL,
-    0x000000000100B8ACULL,
-    0x000000000100B8B3ULL,
-    0x000000000100B8E1ULL,
-    0x000000000100B8F3ULL,
-    0x000000000100B923ULL,
-    0x000000000100B92DULL,
-    0x000000000100B96FULL,
-    0x000000000100B9C5ULL,
-    0x000000000100B9C9ULL,
-    0x000000000100BA79ULL,
-    0x000000000100BA8FULL,
-    0x000000000100BA93ULL,
-    0x000000000100BA99ULL,
-    0x000000000100BD89ULL,
-    0x000000000100BD8FULL,
-    0x000000000100C02CULL,
-    0x000000000100C033ULL,
-    0x000000000100C037ULL,
-    0x000000000100C0B2ULL,
-    0x000000000100C0B3ULL,
-    0x000000000100C209ULL,
-    0x000000000100C219ULL,
-    0x000000000100C825ULL,
-    0x000000000100C833ULL,
-    0x000000000100C868ULL,
-    0x000000000100C889ULL,
-    0x000000000100C893ULL,
-    0x000000000100C899ULL,
-    0x000000000100C8A4ULL,
-    0x000000000100C8AEULL,
-    0x000000000100C8AFULL,
-    0x000000000100C8B2ULL,
-    0x000000000100C8B3ULL,
-    0x000000000100C8B5ULL,
-    0x000000000100C8B6ULL,
-    0x000000000100C8E5ULL,
-    0x000000000100C8EFULL,
-    0x000000000100C933ULL,
-    0x000000000100C961ULL,
-    0x000000000100C969ULL,
-    0x000000000100C973ULL,
-    0x000000000100C979ULL,
-    0x000000000100C985ULL,
-    0x000000000100C999ULL,
-    0x000000000100C9A1ULL,
-    0x000000000100C9ECULL,
-    0x000000000100CA13ULL,
-    0x000000000100CA41ULL,
-    0x000000000100CA53ULL,
-    0x000000000100CA59ULL,
-    0x000000000100CA65ULL,
-    0x000000000100CA89ULL,
-    0x000000000100CA93ULL,
-    0x000000000100CA99ULL,
-    0x000000000100CAC5ULL,
-    0x000000000100CACFULL,
-    0x000000000100CCAFULL,
-    0x000000000100CCB3ULL,
-    0x000000000100CD01ULL,
-    0x000000000100CD0DULL,
-    0x000000000100CD61ULL,
-    0x000000000100CE19ULL,
-    0x000000000100CE65ULL,
-    0x000000000100CE81ULL,
-    0x000000000100CE85ULL,
-    0x000000000100CE93ULL,
-    0x000000000100CE99ULL,
-    0x000000000100D068ULL,
-    0x000000000100D0A4ULL,
-    0x000000000100D0AEULL,
-    0x000000000100D0B2ULL,
-    0x000000000100D0B3ULL,
-    0x000000000100D113ULL,
-    0x000000000100D12EULL,
-    0x000000000100D12FULL,
-    0x000000000100D161ULL,
-    0x000000000100D199ULL,
-    0x000000000100D279ULL,
-    0x000000000100D285ULL,
-    0x000000000100D299ULL,
-    0x000000000100D2B3ULL,
-    0x000000000100D433ULL,
-    0x000000000100D593ULL,
-    0x000000000100D665ULL,
-    0x000000000100D82EULL,
-    0x000000000100D8A4ULL,
-    0x000000000100D8AEULL,
-    0x000000000100D8B2ULL,
-    0x000000000100D8B3ULL,
-    0x000000000100D924ULL,
-    0x000000000100D92EULL,
-    0x000000000100D933ULL,
-    0x000000000100DC33ULL,
-    0x000000000100DC37ULL,
-    0x000000000100DCA4ULL,
-    0x000000000100DCB2ULL,
-    0x000000000100DD73ULL,
-    0x000000000100DD79ULL,
-    0x000000000100DD93ULL,
-    0x000000000100DDD3ULL,
-    0x000000000100E0B3ULL,
-    0x000000000100E4A4ULL,
-    0x000000000100E4A5ULL,
-    0x000000000100E4B2ULL,
-    0x000000000100E5F2ULL,
-    0x000000000100E664ULL,
-    0x0000000001028465ULL,
-    0x0000000001028468ULL,
-    0x00000000010284E5ULL,
-    0x00000000010284F3ULL,
-    0x0000000001028573ULL,
-    0x0000000001028579ULL,
-    0x0000000001028593ULL,
-    0x00000000010285D3ULL,
-    0x0000000001028645ULL,
-    0x000000000102864CULL,
-    0x0000000001028653ULL,
-    0x0000000001028654ULL,
-    0x0000000001028665ULL,
-    0x0000000001028693ULL,
-    0x0000000001028699ULL,
-    0x00000000010286D9ULL,
-    0x0000000001028745ULL,
-    0x0000000001028833ULL,
-    0x0000000001028C2EULL,
-    0x0000000001028D13ULL,
-    0x0000000001028D65ULL,
-    0x0000000001028D73ULL,
-    0x0000000001028D79ULL,
-    0x000000000102902CULL,
-    0x00000000010290B3ULL,
-    0x0000000001029133ULL,
-    0x000000000102924FULL,
-    0x0000000001029465ULL,
-    0x0000000001029573ULL,
-    0x0000000001029593ULL,
-    0x00000000010295D3ULL,
-    0x00000000010295F9ULL,
-    0x0000000001029605ULL,
-    0x0000000001029613ULL,
-    0x0000000001029653ULL,
-    0x0000000001029659ULL,
-    0x00000000010296C5ULL,
-    0x0000000001029CF9ULL,
-    0x0000000001029D13ULL,
-    0x000000000102A5D3ULL,
-    0x000000000102A665ULL,
-    0x000000000102A745ULL,
-    0x000000000102AC2EULL,
-    0x000000000102ACB3ULL,
-    0x000000000102AD2EULL,
-    0x000000000102ADE5ULL,
-    0x000000000102B033ULL,
-    0x000000000102B035ULL,
-    0x000000000102B0B3ULL,
-    0x000000000102B0D3ULL,
-    0x000000000102B193ULL,
-    0x000000000102B1A1ULL,
-    0x000000000102B1EEULL,
-    0x000000000102B281ULL,
-    0x000000000102B293ULL,
-    0x000000000102B82CULL,
-    0x000000000102B865ULL,
-    0x000000000102B893ULL,
-    0x000000000102B895ULL,
-    0x000000000102B8A4ULL,
-    0x000000000102B8B3ULL,
-    0x000000000102B8EFULL,
-    0x000000000102B925ULL,
-    0x000000000102B933ULL,
-    0x000000000102B973ULL,
-    0x000000000102B9C1ULL,
-    0x000000000102B9C5ULL,
-    0x000000000102B9C9ULL,
-    0x000000000102B9D9ULL,
-    0x000000000102BA93ULL,
-    0x000000000102BDD3ULL,
-    0x000000000102BDD9ULL,
-    0x000000000102C181ULL,
-    0x000000000102C1F3ULL,
-    0x000000000102C219ULL,
-    0x000000000102C269ULL,
-    0x000000000102C829ULL,
-    0x000000000102C865ULL,
-    0x000000000102C868ULL,
-    0x000000000102C873ULL,
-    0x000000000102C895ULL,
-    0x000000000102C899ULL,
-    0x000000000102C8A1ULL,
-    0x000000000102C8B3ULL,
-    0x000000000102C92CULL,
-    0x000000000102C933ULL,
-    0x000000000102C973ULL,
-    0x000000000102C979ULL,
-    0x000000000102C9B3ULL,
-    0x000000000102C9D3ULL,
-    0x000000000102C9E7ULL,
-    0x000000000102CA13ULL,
-    0x000000000102CA59ULL,
-    0x000000000102CA65ULL,
-    0x000000000102CA74ULL,
-    0x000000000102CA93ULL,
-    0x000000000102CAC5ULL,
-    0x000000000102CACFULL,
-    0x000000000102CAD3ULL,
-    0x000000000102CAD9ULL,
-    0x000000000102CD79ULL,
-    0x000000000102CDF3ULL,
-    0x000000000102CE8FULL,
-    0x000000000102CE93ULL,
-    0x000000000102CE99ULL,
-    0x000000000102D02CULL,
-    0x000000000102D032ULL,
-    0x000000000102D0B2ULL,
-    0x000000000102D134ULL,
-    0x000000000102D245ULL,
-    0x000000000102D249ULL,
-    0x000000000102D289ULL,
-    0x000000000102D28FULL,
-    0x000000000102D299ULL,
-    0x000000000102DCA5ULL,
-    0x000000000102DD34ULL,
-    0x000000000102E665ULL,
-    0x00000000010404E5ULL,
-    0x00000000010405C7ULL,
-    0x0000000001040645ULL,
-    0x000000000104064DULL,
-    0x0000000001040665ULL,
-    0x00000000010414B2ULL,
-    0x00000000010415C5ULL,
-    0x00000000010415EEULL,
-    0x0000000001041665ULL,
-    0x000000000104242CULL,
-    0x0000000001042668ULL,
-    0x000000000104275AULL,
-    0x00000000010431F8ULL,
-    0x0000000001043C61ULL,
-    0x0000000001043DC5ULL,
-    0x0000000001043DCFULL,
-    0x0000000001043DD3ULL,
-    0x0000000001043DD9ULL,
-    0x0000000001043E8FULL,
-    0x0000000001043E93ULL,
-    0x0000000001044114ULL,
-    0x0000000001045693ULL,
-    0x0000000001046581ULL,
-    0x0000000001046585ULL,
-    0x00000000010485C9ULL,
-    0x00000000010485CFULL,
-    0x00000000010485D3ULL,
-    0x000000000104882CULL,
-    0x0000000001048C2CULL,
-    0x0000000001048C33ULL,
-    0x0000000001048C79ULL,
-    0x0000000001048D73ULL,
-    0x0000000001048D79ULL,
-    0x0000000001048DF4ULL,
-    0x0000000001048E41ULL,
-    0x0000000001048EACULL,
-    0x0000000001049465ULL,
-    0x00000000010495C4ULL,
-    0x0000000001049653ULL,
-    0x0000000001049654ULL,
-    0x0000000001049681ULL,
-    0x0000000001049693ULL,
-    0x0000000001049699ULL,
-    0x000000000104974FULL,
-    0x0000000001049CF9ULL,
-    0x0000000001049D14ULL,
-    0x0000000001049DB9ULL,
-    0x000000000104A5C7ULL,
-    0x000000000104AC33ULL,
-    0x000000000104AC35ULL,
-    0x000000000104ACA4ULL,
-    0x000000000104ACB2ULL,
-    0x000000000104ACB3ULL,
-    0x000000000104ACB9ULL,
-    0x000000000104AD33ULL,
-    0x000000000104AEACULL,
-    0x000000000104B025ULL,
-    0x000000000104B026ULL,
-    0x000000000104B02FULL,
-    0x000000000104B032ULL,
-    0x000000000104B035ULL,
-    0x000000000104B037ULL,
-    0x000000000104B068ULL,
-    0x000000000104B0A1ULL,
-    0x000000000104B0A4ULL,
-    0x000000000104B0A9ULL,
-    0x000000000104B0B2ULL,
-    0x000000000104B0B3ULL,
-    0x000000000104B133ULL,
-    0x000000000104B193ULL,
-    0x000000000104B1F4ULL,
-    0x000000000104B1F7ULL,
-    0x000000000104B2ADULL,
-    0x000000000104B2B3ULL,
-    0x000000000104B433ULL,
-    0x000000000104B613ULL,
-    0x000000000104B833ULL,
-    0x000000000104B868ULL,
-    0x000000000104B8A4ULL,
-    0x000000000104B8B3ULL,
-    0x000000000104B8B9ULL,
-    0x000000000104B8EFULL,
-    0x000000000104B8F3ULL,
-    0x000000000104B96FULL,
-    0x000000000104B973ULL,
-    0x000000000104B979ULL,
-    0x000000000104B9C1ULL,
-    0x000000000104B9D9ULL,
-    0x000000000104B9EEULL,
-    0x000000000104B9F4ULL,
-    0x000000000104BA81ULL,
-    0x000000000104BA8FULL,
-    0x000000000104BA93ULL,
-    0x000000000104BAB0ULL,
-    0x000000000104BDD3ULL,
-    0x000000000104BDD9ULL,
-    0x000000000104BEB3ULL,
-    0x000000000104BF25ULL,
-    0x000000000104BF33ULL,
-    0x000000000104C02CULL,
-    0x000000000104C033ULL,
-    0x000000000104C0A4ULL,
-    0x000000000104C0B2ULL,
-    0x000000000104C0B3ULL,
-    0x000000000104C0B4ULL,
-    0x000000000104C133ULL,
-    0x000000000104C134ULL,
-    0x000000000104C219ULL,
-    0x000000000104C2ACULL,
-    0x000000000104C6A5ULL,
-    0x000000000104C829ULL,
-    0x000000000104C993ULL,
-    0x000000000104C9D3ULL,
-    0x000000000104C9E7ULL,
-    0x000000000104CC6FULL,
-    0x000000000104CCB3ULL,
-    0x000000000104CD79ULL,
-    0x000000000104CDF3ULL,
-    0x000000000104CE79ULL,
-    0x000000000104CE85ULL,
-    0x000000000104D033ULL,
-    0x000000000104D068ULL,
-    0x000000000104D113ULL,
-    0x000000000104D119ULL,
-    0x000000000104D1EEULL,
-    0x000000000104D1F4ULL,
-    0x000000000104D281ULL,
-    0x000000000104D5B3ULL,
-    0x000000000104D9F4ULL,
-    0x000000000104E0ACULL,
-    0x000000000104E0B3ULL,
-    0x000000000104E125ULL,
-    0x000000000104E8A4ULL,
-    0x000000000104E8B3ULL,
-    0x000000000104EB41ULL,
-    0x0000000001060433ULL,
-    0x0000000001060465ULL,
-    0x000000000106046BULL,
-    0x00000000010604E5ULL,
-    0x0000000001060524ULL,
-    0x000000000106052EULL,
-    0x0000000001060534ULL,
-    0x00000000010605C5ULL,
-    0x00000000010605CBULL,
-    0x00000000010605D3ULL,
-    0x00000000010605D4ULL,
-    0x0000000001060613ULL,
-    0x0000000001060668ULL,
-    0x000000000106066DULL,
-    0x0000000001060674ULL,
-    0x0000000001060685ULL,
-    0x0000000001060693ULL,
-    0x0000000001060694ULL,
-    0x0000000001060699ULL,
-    0x0000000001060721ULL,
-    0x0000000001060733ULL,
-    0x0000000001060741ULL,
-    0x0000000001061424ULL,
-    0x0000000001061433ULL,
-    0x0000000001061434ULL,
-    0x0000000001061445ULL,
-    0x0000000001061453ULL,
-    0x00000000010615C1ULL,
-    0x00000000010615EEULL,
-    0x0000000001061668ULL,
-    0x00000000010616F3ULL,
-    0x0000000001062461ULL,
-    0x00000000010624A4ULL,
-    0x00000000010624B2ULL,
-    0x00000000010624B3ULL,
-    0x00000000010625B3ULL,
-    0x00000000010625C7ULL,
-    0x00000000010625CBULL,
-    0x0000000001063C34ULL,
-    0x0000000001063C93ULL,
-    0x0000000001063DC7ULL,
-    0x0000000001063DCBULL,
-    0x0000000001063DEBULL,
-    0x0000000001063E13ULL,
-    0x0000000001063E93ULL,
-    0x0000000001063E9AULL,
-    0x0000000001063EABULL,
-    0x0000000001063EF3ULL,
-    0x0000000001063F25ULL,
-    0x0000000001063F33ULL,
-    0x000000000106546BULL,
-    0x00000000010654B3ULL,
-    0x00000000010654C6ULL,
-    0x00000000010654F3ULL,
-    0x00000000010655A2ULL,
-    0x00000000010655A5ULL,
-    0x00000000010655B0ULL,
-    0x00000000010655B3ULL,
-    0x00000000010655B9ULL,
-    0x00000000010655CBULL,
-    0x00000000010655F4ULL,
-    0x0000000001065668ULL,
-    0x000000000106568FULL,
-    0x00000000010664B2ULL,
-    0x0000000001078468ULL,
-    0x0000000001078561ULL,
-    0x0000000001078565ULL,
-    0x00000000010789F9ULL,
-    0x0000000001078D73ULL,
-    0x0000000001078D79ULL,
-    0x000000000107902CULL,
-    0x0000000001079099ULL,
-    0x00000000010790B8ULL,
-    0x00000000010790E5ULL,
-    0x00000000010790F9ULL,
-    0x0000000001079121ULL,
-    0x00000000010795B3ULL,
-    0x0000000001079613ULL,
-    0x0000000001079679ULL,
-    0x0000000001079693ULL,
-    0x0000000001079CB9ULL,
-    0x0000000001079CE5ULL,
-    0x0000000001079DF3ULL,
-    0x000000000107A0A4ULL,
-    0x000000000107A595ULL,
-    0x000000000107A5C4ULL,
-    0x000000000107A5D4ULL,
-    0x000000000107A665ULL,
-    0x000000000107AC2CULL,
-    0x000000000107ACA4ULL,
-    0x000000000107ACB2ULL,
-    0x000000000107ACB3ULL,
-    0x000000000107ACB9ULL,
-    0x000000000107AD25ULL,
-    0x000000000107B032ULL,
-    0x000000000107B0A4ULL,
-    0x000000000107B0B2ULL,
-    0x000000000107B0B3ULL,
-    0x000000000107B0B9ULL,
-    0x000000000107B12FULL,
-    0x000000000107B133ULL,
-    0x000000000107B145ULL,
-    0x000000000107B161ULL,
-    0x000000000107B173ULL,
-    0x000000000107B193ULL,
-    0x000000000107B199ULL,
-    0x000000000107B1F3ULL,
-    0x000000000107B293ULL,
-    0x000000000107B330ULL,
-    0x000000000107B333ULL,
-    0x000000000107B445ULL,
-    0x000000000107B4B3ULL,
-    0x000000000107B5B9ULL,
-    0x000000000107B5F3ULL,
-    0x000000000107B613ULL,
-    0x000000000107B865ULL,
-    0x000000000107B879ULL,
-    0x000000000107B893ULL,
-    0x000000000107B8B3ULL,
-    0x000000000107B8B9ULL,
-    0x000000000107B8E1ULL,
-    0x000000000107B8EFULL,
-    0x000000000107B8F3ULL,
-    0x000000000107B8F9ULL,
-    0x000000000107B973ULL,
-    0x000000000107BA93ULL,
-    0x000000000107BA99ULL,
-    0x000000000107BB55ULL,
-    0x000000000107BC68ULL,
-    0x000000000107BC93ULL,
-    0x000000000107BCA4ULL,
-    0x000000000107BCD3ULL,
-    0x000000000107BCD9ULL,
-    0x000000000107BD13ULL,
-    0x000000000107BD41ULL,
-    0x000000000107BD61ULL,
-    0x000000000107BD73ULL,
-    0x000000000107BD93ULL,
-    0x000000000107BDD3ULL,
-    0x000000000107BE13ULL,
-    0x000000000107BE19ULL,
-    0x000000000107BE49ULL,
-    0x000000000107BE54ULL,
-    0x000000000107BE93ULL,
-    0x000000000107BEC5ULL,
-    0x000000000107BED9ULL,
-    0x000000000107C0B3ULL,
-    0x000000000107C201ULL,
-    0x000000000107C219ULL,
-    0x000000000107C279ULL,
-    0x000000000107C825ULL,
-    0x000000000107C82CULL,
-    0x000000000107C868ULL,
-    0x000000000107C8A4ULL,
-    0x000000000107C8B2ULL,
-    0x000000000107C8B3ULL,
-    0x000000000107C8E5ULL,
-    0x000000000107C8F9ULL,
-    0x000000000107C92EULL,
-    0x000000000107C973ULL,
-    0x000000000107C979ULL,
-    0x000000000107C9CFULL,
-    0x000000000107C9D3ULL,
-    0x000000000107C9D9ULL,
-    0x000000000107CA81ULL,
-    0x000000000107CA93ULL,
-    0x000000000107CA99ULL,
-    0x000000000107CCA4ULL,
-    0x000000000107CCB2ULL,
-    0x000000000107CCB3ULL,
-    0x000000000107CCB9ULL,
-    0x000000000107CD0FULL,
-    0x000000000107CD34ULL,
-    0x000000000107CE65ULL,
-    0x000000000107CE93ULL,
-    0x000000000107D025ULL,
-    0x000000000107D068ULL,
-    0x000000000107D0A4ULL,
-    0x000000000107D0B3ULL,
-    0x000000000107D12EULL,
-    0x000000000107D1EFULL,
-    0x000000000107D279ULL,
-    0x000000000107D28FULL,
-    0x000000000107D293ULL,
-    0x000000000107D299ULL,
-    0x000000000107D468ULL,
-    0x000000000107D4C6ULL,
-    0x000000000107D4D3ULL,
-    0x000000000107D565ULL,
-    0x000000000107D573ULL,
-    0x000000000107D585ULL,
-    0x000000000107D590ULL,
-    0x000000000107D594ULL,
-    0x000000000107D5C4ULL,
-    0x000000000107D605ULL,
-    0x000000000107D614ULL,
-    0x000000000107D653ULL,
-    0x000000000107D693ULL,
-    0x000000000107D699ULL,
-    0x000000000107DC2EULL,
-    0x000000000107DCB2ULL,
-    0x000000000107DD2EULL,
-    0x000000000107DDC4ULL,
-    0x000000000107DDD3ULL,
-    0x000000000107DDD9ULL,
-    0x000000000107DE45ULL,
-    0x000000000107E0A4ULL,
-    0x000000000107E0B3ULL,
-    0x000000000107E5D4ULL,
-    0x000000000107E5F5ULL,
-    0x000000000107E665ULL,
-    0x000000000107EB59ULL,
-    0x000000000109042DULL,
-    0x0000000001090493ULL,
-    0x0000000001090515ULL,
-    0x00000000010905B3ULL,
-    0x00000000010905C1ULL,
-    0x00000000010905C7ULL,
-    0x00000000010905CBULL,
-    0x00000000010905F3ULL,
-    0x0000000001090665ULL,
-    0x0000000001090685ULL,
-    0x0000000001090693ULL,
-    0x0000000001090694ULL,
-    0x0000000001090699ULL,
-    0x00000000010906B3ULL,
-    0x00000000010906EEULL,
-    0x0000000001090733ULL,
-    0x0000000001091499ULL,
-    0x00000000010914A4ULL,
-    0x00000000010914AEULL,
-    0x00000000010914B3ULL,
-    0x0000000001091526ULL,
-    0x00000000010915B3ULL,
-    0x00000000010915B9ULL,
-    0x00000000010915D4ULL,
-    0x00000000010915EEULL,
-    0x00000000010915F0ULL,
-    0x0000000001091613ULL,
-    0x0000000001091661ULL,
-    0x0000000001091665ULL,
-    0x0000000001091673ULL,
-    0x0000000001091674ULL,
-    0x00000000010916C5ULL,
-    0x0000000001091719ULL,
-    0x0000000001091733ULL,
-    0x000000000109242CULL,
-    0x0000000001092465ULL,
-    0x000000000109246BULL,
-    0x0000000001092479ULL,
-    0x0000000001092485ULL,
-    0x00000000010924A4ULL,
-    0x00000000010924A6ULL,
-    0x00000000010924B2ULL,
-    0x00000000010924B3ULL,
-    0x00000000010924F3ULL,
-    0x000000000109258CULL,
-    0x00000000010925A1ULL,
-    0x00000000010925A5ULL,
-    0x00000000010925A9ULL,
-    0x00000000010925AFULL,
-    0x00000000010925B0ULL,
-    0x00000000010925B3ULL,
-    0x00000000010925B9ULL,
-    0x00000000010925CBULL,
-    0x00000000010925D4ULL,
-    0x00000000010925EEULL,
-    0x00000000010925F2ULL,
-    0x0000000001092665ULL,
-    0x000000000109266DULL,
-    0x0000000001092673ULL,
-    0x00000000010926D9ULL,
-    0x0000000001092745ULL,
-    0x0000000001093C33ULL,
-    0x0000000001093C45ULL,
-    0x0000000001093C53ULL,
-    0x0000000001093C93ULL,
-    0x0000000001093CADULL,
-    0x0000000001093CD3ULL,
-    0x0000000001093CF3ULL,
-    0x0000000001093D2EULL,
-    0x0000000001093D65ULL,
-    0x0000000001093D85ULL,
-    0x0000000001093D8CULL,
-    0x0000000001093DAFULL,
-    0x0000000001093DB3ULL,
-    0x0000000001093DC5ULL,
-    0x0000000001093DC7ULL,
-    0x0000000001093DCBULL,
-    0x0000000001093DE6ULL,
-    0x0000000001093E13ULL,
-    0x0000000001093E45ULL,
-    0x0000000001093E65ULL,
-    0x0000000001093E6FULL,
-    0x0000000001093E73ULL,
-    0x0000000001093E74ULL,
-    0x0000000001093E79ULL,
-    0x0000000001093E8FULL,
-    0x0000000001093EA4ULL,
-    0x0000000001093EACULL,
-    0x0000000001093EC5ULL,
-    0x0000000001093EECULL,
-    0x0000000001093EF3ULL,
-    0x0000000001093F19ULL,
-    0x0000000001093F2EULL,
-    0x0000000001095485ULL,
-    0x00000000010955C5ULL,
-    0x00000000010955D4ULL,
-    0x0000000001095681ULL,
-    0x00000000010964B2ULL,
-    0x0000000001096665ULL,
-    0x000000000109858DULL,
-    0x00000000010996A4ULL,
-    0x000000000109A037ULL,
-    0x000000000109A5EEULL,
-    0x000000000109BC25ULL,
-    0x000000000109BC29ULL,
-    0x000000000109BC33ULL,
-    0x000000000109BE41ULL,
-    0x000000000109E468ULL,
-    0x000000000109E5F0ULL,
-    0x00000000010A886FULL,
-    0x00000000010A88B3ULL,
-    0x00000000010A8923ULL,
-    0x00000000010A8933ULL,
-    0x00000000010A8C2EULL,
-    0x00000000010A8CB2ULL,
-    0x00000000010A8CB3ULL,
-    0x00000000010A8D61ULL,
-    0x00000000010A8D73ULL,
-    0x00000000010A9099ULL,
-    0x00000000010A90E5ULL,
-    0x00000000010A90F9ULL,
-    0x00000000010A9123ULL,
-    0x00000000010A91F2ULL,
-    0x00000000010A9279ULL,
-    0x00000000010A92B3ULL,
-    0x00000000010A9653ULL,
-    0x00000000010A98C1ULL,
-    0x00000000010A98D3ULL,
-    0x00000000010A98D9ULL,
-    0x00000000010A9CF9ULL,
-    0x00000000010A9D2CULL,
-    0x00000000010AA033ULL,
-    0x00000000010AA828ULL,
-    0x00000000010AA833ULL,
-    0x00000000010AAC33ULL,
-    0x00000000010AACA4ULL,
-    0x00000000010AACB2ULL,
-    0x00000000010AACB3ULL,
-    0x00000000010AACB9ULL,
-    0x00000000010AAD61ULL,
-    0x00000000010AAEB3ULL,
-    0x00000000010AB02FULL,
-    0x00000000010AB033ULL,
-    0x00000000010AB0A4ULL,
-    0x00000000010AB0B2ULL,
-    0x00000000010AB0B3ULL,
-    0x00000000010AB12BULL,
-    0x00000000010AB133ULL,
-    0x00000000010AB161ULL,
-    0x00000000010AB173ULL,
-    0x00000000010AB189ULL,
-    0x00000000010AB193ULL,
-    0x00000000010AB199ULL,
-    0x00000000010AB1AFULL,
-    0x00000000010AB213ULL,
-    0x00000000010AB219ULL,
-    0x00000000010AB265ULL,
-    0x00000000010AB2B3ULL,
-    0x00000000010AB433ULL,
-    0x00000000010AB525ULL,
-    0x00000000010AB613ULL,
-    0x00000000010AB833ULL,
-    0x00000000010AB865ULL,
-    0x00000000010AB868ULL,
-    0x00000000010AB8E1ULL,
-    0x00000000010AB8F3ULL,
-    0x00000000010AB949ULL,
-    0x00000000010AB961ULL,
-    0x00000000010AB973ULL,
-    0x00000000010AB979ULL,
-    0x00000000010AB9D9ULL,
-    0x00000000010ABA8FULL,
-    0x00000000010ABA93ULL,
-    0x00000000010ABA99ULL,
-    0x00000000010AC025ULL,
-    0x00000000010AC033ULL,
-    0x00000000010AC12CULL,
-    0x00000000010AC219ULL,
-    0x00000000010AC2B3ULL,
-    0x00000000010AC881ULL,
-    0x00000000010AC8A4ULL,
-    0x00000000010AC8A5ULL,
-    0x00000000010AC8B2ULL,
-    0x00000000010AC8B3ULL,
-    0x00000000010AC8E5ULL,
-    0x00000000010AC92EULL,
-    0x00000000010AC933ULL,
-    0x00000000010AC993ULL,
-    0x00000000010ACA19ULL,
-    0x00000000010ACA53ULL,
-    0x00000000010ACA65ULL,
-    0x00000000010ACA79ULL,
-    0x00000000010ACA99ULL,
-    0x00000000010ACCB3ULL,
-    0x00000000010ACD19ULL,
-    0x00000000010ACD85ULL,
-    0x00000000010AD124ULL,
-    0x00000000010AD1EEULL,
-    0x00000000010AD289ULL,
-    0x00000000010AD28FULL,
-    0x00000000010AD293ULL,
-    0x00000000010AD299ULL,
-    0x00000000010AE8ACULL,
-    0x00000000010BB8A4ULL,
-    0x00000000010C8693ULL,
-    0x00000000010C9693ULL,
-    0x00000000010C9C2CULL,
-    0x00000000010C9DB9ULL,
-    0x00000000010CA5D3ULL,
-    0x00000000010CB1EEULL,
-    0x00000000010CB8A4ULL,
-    0x00000000010CB8B3ULL,
-    0x00000000010CBD24ULL,
-    0x00000000010CBE93ULL,
-    0x00000000010CC82CULL,
-    0x00000000010CC82EULL,
-    0x00000000010CC8B3ULL,
-    0x00000000010CC8B8ULL,
-    0x00000000010CC923ULL,
-    0x00000000010CC9F3ULL,
-    0x00000000010CE0A4ULL,
-    0x00000000010CE0B3ULL,
-    0x00000000010CE125ULL,
-    0x00000000010CE133ULL,
-    0x00000000010D075AULL,
-    0x0000000001109133ULL,
-    0x000000000110A493ULL,
-    0x000000000110A831ULL,
-    0x000000000110B834ULL,
-    0x000000000110C12BULL,
-    0x0000000001148981ULL,
-    0x000000000117C113ULL,
-    0x000000000117C9A1ULL,
-    0x00000000011A846BULL,
-    0x00000000011A8493ULL,
-    0x00000000011A84C6ULL,
-    0x00000000011A84F3ULL,
-    0x00000000011A852CULL,
-    0x00000000011A8532ULL,
-    0x00000000011A8533ULL,
-    0x00000000011A8565ULL,
-    0x00000000011A8579ULL,
-    0x00000000011A8585ULL,
-    0x00000000011A858DULL,
-    0x00000000011A85D4ULL,
-    0x00000000011A8645ULL,
-    0x00000000011A864BULL,
-    0x00000000011A8654ULL,
-    0x00000000011A8668ULL,
-    0x00000000011A8669ULL,
-    0x00000000011A8673ULL,
-    0x00000000011A8685ULL,
-    0x00000000011A8693ULL,
-    0x00000000011A8724ULL,
-    0x00000000011A8733ULL,
-    0x00000000011A8934ULL,
-    0x00000000011A942EULL,
-    0x00000000011A94AEULL,
-    0x00000000011A94B2ULL,
-    0x00000000011A958CULL,
-    0x00000000011A95A5ULL,
-    0x00000000011A95C1ULL,
-    0x00000000011A964EULL,
-    0x00000000011A9659ULL,
-    0x00000000011A9674ULL,
-    0x00000000011A96A5ULL,
-    0x00000000011A972EULL,
-    0x00000000011A9733ULL,
-    0x00000000011AA468ULL,
-    0x00000000011AA46BULL,
-    0x00000000011AA493ULL,
-    0x00000000011AA4B4ULL,
-    0x00000000011AA4C6ULL,
-    0x00000000011AA58CULL,
-    0x00000000011AA594ULL,
-    0x00000000011AA5B3ULL,
-    0x00000000011AA5C1ULL,
-    0x00000000011AA5C5ULL,
-    0x00000000011AA5CFULL,
-    0x00000000011AA5D3ULL,
-    0x00000000011AA5D4ULL,
-    0x00000000011AA60FULL,
-    0x00000000011AA613ULL,
-    0x00000000011AA615ULL,
-    0x00000000011AA645ULL,
-    0x00000000011AA64BULL,
-    0x00000000011AA654ULL,
-    0x00000000011AA674ULL,
-    0x00000000011AA685ULL,
-    0x00000000011AA693ULL,
-    0x00000000011ABC24ULL,
-    0x00000000011ABC93ULL,
-    0x00000000011ABD26ULL,
-    0x00000000011ABD2EULL,
-    0x00000000011ABD34ULL,
-    0x00000000011ABD8CULL,
-    0x00000000011ABDCBULL,
-    0x00000000011ABE13ULL,
-    0x00000000011ABE81ULL,
-    0x00000000011ABE85ULL,
-    0x00000000011ABE88ULL,
-    0x00000000011ACA68ULL,
-    0x00000000011AE685ULL,
-    0x0000000001208834ULL,
-    0x0000000001208849ULL,
-    0x0000000001208923ULL,
-    0x0000000001208924ULL,
-    0x0000000001208933ULL,
-    0x0000000001208CA4ULL,
-    0x0000000001208CB2ULL,
-    0x0000000001208CB3ULL,
-    0x0000000001208D05ULL,
-    0x0000000001208D73ULL,
-    0x0000000001208DEEULL,
-    0x0000000001209032ULL,
-    0x00000000012090E5ULL,
-    0x0000000001209129ULL,
-    0x000000000120912FULL,
-    0x0000000001209138ULL,
-    0x00000000012091EEULL,
-    0x00000000012098D3ULL,
-    0x0000000001209A93ULL,
-    0x0000000001209C33ULL,
-    0x0000000001209C85ULL,
-    0x0000000001209CA4ULL,
-    0x0000000001209CA5ULL,
-    0x0000000001209CB2ULL,
-    0x0000000001209CB3ULL,
-    0x0000000001209CE1ULL,
-    0x0000000001209CF3ULL,
-    0x0000000001209CF9ULL,
-    0x0000000001209D33ULL,
-    0x0000000001209EB3ULL,
-    0x000000000120A0A4ULL,
-    0x000000000120A2A9ULL,
-    0x000000000120A433ULL,
-    0x000000000120A493ULL,
-    0x000000000120A573ULL,
-    0x000000000120A585ULL,
-    0x000000000120A593ULL,
-    0x000000000120A5C5ULL,
-    0x000000000120A5D3ULL,
-    0x000000000120A5D9ULL,
-    0x000000000120A644ULL,
-    0x000000000120A665ULL,
-    0x000000000120A681ULL,
-    0x000000000120A693ULL,
-    0x000000000120A828ULL,
-    0x000000000120A833ULL,
-    0x000000000120A8B3ULL,
-    0x000000000120ACA4ULL,
-    0x000000000120ACA5ULL,
-    0x000000000120ACB2ULL,
-    0x000000000120ACB3ULL,
-    0x000000000120AD21ULL,
-    0x000000000120AD33ULL,
-    0x000000000120AEB3ULL,
-    0x000000000120B0B3ULL,
-    0x000000000120B199ULL,
-    0x000000000120B208ULL,
-    0x000000000120B42CULL,
-    0x000000000120B4A5ULL,
-    0x000000000120B4AEULL,
-    0x000000000120B4B4ULL,
-    0x000000000120B525ULL,
-    0x000000000120B52EULL,
-    0x000000000120B533ULL,
-    0x000000000120B5B9ULL,
-    0x000000000120B613ULL,
-    0x000000000120B6B3ULL,
-    0x000000000120B833ULL,
-    0x000000000120B865ULL,
-    0x000000000120B868ULL,
-    0x000000000120B893ULL,
-    0x000000000120B899ULL,
-    0x000000000120B8A5ULL,
-    0x000000000120B8E1ULL,
-    0x000000000120B8E5ULL,
-    0x000000000120B8E9ULL,
-    0x000000000120B8F3ULL,
-    0x000000000120B8F9ULL,
-    0x000000000120B924ULL,
-    0x000000000120B933ULL,
-    0x000000000120B965ULL,
-    0x000000000120B973ULL,
-    0x000000000120BA93ULL,
-    0x000000000120C0A4ULL,
-    0x000000000120C0B2ULL,
-    0x000000000120C0B3ULL,
-    0x000000000120C105ULL,
-    0x000000000120C124ULL,
-    0x000000000120C205ULL,
-    0x000000000120C8A4ULL,
-    0x000000000120C8A5ULL,
-    0x000000000120C8B2ULL,
-    0x000000000120C8B3ULL,
-    0x000000000120C973ULL,
-    0x000000000120CCA4ULL,
-    0x000000000120CCB2ULL,
-    0x000000000120CCB3ULL,
-    0x000000000120CE13ULL,
-    0x000000000120CE19ULL,
-    0x000000000120CE65ULL,
-    0x000000000120CE81ULL,
-    0x000000000120D02CULL,
-    0x000000000120D02EULL,
-    0x000000000120D033ULL,
-    0x000000000120D068ULL,
-    0x000000000120D0A4ULL,
-    0x000000000120D0ACULL,
-    0x000000000120D0B2ULL,
-    0x000000000120D0B3ULL,
-    0x000000000120D101ULL,
-    0x000000000120D105ULL,
-    0x000000000120D113ULL,
-    0x000000000120D12FULL,
-    0x000000000120D1EFULL,
-    0x000000000120D1F3ULL,
-    0x000000000120D299ULL,
-    0x000000000120D2B3ULL,
-    0x000000000120D5D3ULL,
-    0x000000000120D60FULL,
-    0x000000000120D8A4ULL,
-    0x000000000120D8ACULL,
-    0x000000000120D8AEULL,
-    0x000000000120D8B2ULL,
-    0x000000000120D8B3ULL,
-    0x000000000120D8B9ULL,
-    0x000000000120D92EULL,
-    0x000000000120DCB2ULL,
-    0x000000000120DD2EULL,
-    0x000000000120DD99ULL,
-    0x000000000120DDD3ULL,
-    0x000000000120E0A4ULL,
-    0x000000000120E0B3ULL,
-    0x000000000120E428ULL,
-    0x000000000120E433ULL,
-    0x000000000120E4A4ULL,
-    0x000000000120E585ULL,
-    0x000000000120E5C5ULL,
-    0x000000000120E5EEULL,
-    0x000000000120E8A4ULL,
-    0x000000000120E8A5ULL,
-    0x000000000120E8B2ULL,
-    0x000000000120E8B3ULL,
-    0x000000000120E9EFULL,
-    0x000000000120E9F2ULL,
-    0x0000000001228468ULL,
-    0x0000000001228474ULL,
-    0x0000000001228484ULL,
-    0x0000000001228493ULL,
-    0x0000000001228499ULL,
-    0x0000000001228533ULL,
-    0x0000000001228573ULL,
-    0x000000000122858DULL,
-    0x000000000122858FULL,
-    0x0000000001228593ULL,
-    0x00000000012285A5ULL,
-    0x00000000012285B3ULL,
-    0x00000000012285B9ULL,
-    0x00000000012285D3ULL,
-    0x0000000001228613ULL,
-    0x000000000122864DULL,
-    0x0000000001228653ULL,
-    0x0000000001228674ULL,
-    0x0000000001228681ULL,
-    0x0000000001228685ULL,
-    0x00000000012286C5ULL,
-    0x0000000001228832ULL,
-    0x0000000001228845ULL,
-    0x00000000012288A3ULL,
-    0x00000000012288ACULL,
-    0x0000000001228924ULL,
-    0x0000000001228934ULL,
-    0x00000000012289F0ULL,
-    0x0000000001228AB3ULL,
-    0x0000000001228AB4ULL,
-    0x0000000001228AB9ULL,
-    0x0000000001228C2CULL,
-    0x0000000001228C30ULL,
-    0x0000000001228C65ULL,
-    0x0000000001228C6FULL,
-    0x0000000001228C79ULL,
-    0x0000000001228D34ULL,
-    0x0000000001228D73ULL,
-    0x0000000001228DEEULL,
-    0x0000000001228E81ULL,
-    0x0000000001228E89ULL,
-    0x0000000001228E8FULL,
-    0x0000000001228EB2ULL,
-    0x0000000001228EB4ULL,
-    0x000000000122902EULL,
-    0x0000000001229093ULL,
-    0x0000000001229099ULL,
-    0x00000000012290A4ULL,
-    0x00000000012290B3ULL,
-    0x0000000001229121ULL,
-    0x0000000001229124ULL,
-    0x0000000001229130ULL,
-    0x0000000001229199ULL,
-    0x00000000012291EEULL,
-    0x00000000012291F3ULL,
-    0x00000000012291F8ULL,
-    0x0000000001229259ULL,
-    0x00000000012292A2ULL,
-    0x00000000012292B8ULL,
-    0x0000000001229325ULL,
-    0x0000000001229468ULL,
-    0x0000000001229485ULL,
-    0x0000000001229493ULL,
-    0x0000000001229499ULL,
-    0x00000000012294D3ULL,
-    0x00000000012294D9ULL,
-    0x0000000001229573ULL,
-    0x0000000001229579ULL,
-    0x0000000001229593ULL,
-    0x00000000012295D3ULL,
-    0x0000000001229674ULL,
-    0x00000000012296C5ULL,
-    0x00000000012298A4ULL,
-    0x00000000012298ACULL,
-    0x00000000012298B2ULL,
-    0x00000000012298CFULL,
-    0x0000000001229933ULL,
-    0x0000000001229934ULL,
-    0x0000000001229938ULL,
-    0x0000000001229999ULL,
-    0x0000000001229A59ULL,
-    0x0000000001229C2CULL,
-    0x0000000001229C32ULL,
-    0x0000000001229CB3ULL,
-    0x0000000001229CEFULL,
-    0x0000000001229D25ULL,
-    0x0000000001229DA1ULL,
-    0x0000000001229DC1ULL,
-    0x0000000001229DF3ULL,
-    0x0000000001229EB2ULL,
-    0x000000000122A022ULL,
-    0x000000000122A0ADULL,
-    0x000000000122A4D3ULL,
-    0x000000000122A4D9ULL,
-    0x000000000122A4EEULL,
-    0x000000000122A569ULL,
-    0x000000000122A573ULL,
-    0x000000000122A5CBULL,
-    0x000000000122A5D3ULL,
-    0x000000000122A644ULL,
-    0x000000000122A674ULL,
-    0x000000000122A6C5ULL,
-    0x000000000122A927ULL,
-    0x000000000122A9EEULL,
-    0x000000000122ACA4ULL,
-    0x000000000122ACB3ULL,
-    0x000000000122ACB9ULL,
-    0x000000000122B038ULL,
-    0x000000000122B039ULL,
-    0x000000000122B0B4ULL,
-    0x000000000122B123ULL,
-    0x000000000122B125ULL,
-    0x000000000122B134ULL,
-    0x000000000122B18FULL,
-    0x000000000122B42EULL,
-    0x000000000122B430ULL,
-    0x000000000122B4AEULL,
-    0x000000000122B4B4ULL,
-    0x000000000122B4B8ULL,
-    0x000000000122B534ULL,
-    0x000000000122B538ULL,
-    0x000000000122B82CULL,
-    0x000000000122B839ULL,
-    0x000000000122B893ULL,
-    0x000000000122B8B7ULL,
-    0x000000000122B8B9ULL,
-    0x000000000122B8E1ULL,
-    0x000000000122B927ULL,
-    0x000000000122B92EULL,
-    0x000000000122B9C5ULL,
-    0x000000000122B9F3ULL,
-    0x000000000122BA85ULL,
-    0x000000000122BA93ULL,
-    0x000000000122BD2CULL,
-    0x000000000122BE47ULL,
-    0x000000000122C039ULL,
-    0x000000000122C0A7ULL,
-    0x000000000122C0ACULL,
-    0x000000000122C12EULL,
-    0x000000000122C181ULL,
-    0x000000000122C199ULL,
-    0x000000000122C1F3ULL,
-    0x000000000122C1F4ULL,
-    0x000000000122C213ULL,
-    0x000000000122C24FULL,
-    0x000000000122C82EULL,
-    0x000000000122C927ULL,
-    0x000000000122CAAEULL,
-    0x000000000122CC34ULL,
-    0x000000000122CC37ULL,
-    0x000000000122CC39ULL,
-    0x000000000122CCA5ULL,
-    0x000000000122CCB3ULL,
-    0x000000000122CCB4ULL,
-    0x000000000122CCB7ULL,
-    0x000000000122CD24ULL,
-    0x000000000122CD2EULL,
-    0x000000000122CD34ULL,
-    0x000000000122CDE4ULL,
-    0x000000000122CDF7ULL,
-    0x000000000122CE8FULL,
-    0x000000000122CE93ULL,
-    0x000000000122CE99ULL,
-    0x000000000122CEB3ULL,
-    0x000000000122D027ULL,
-    0x000000000122D038ULL,
-    0x000000000122D068ULL,
-    0x000000000122D0ADULL,
-    0x000000000122D121ULL,
-    0x000000000122D125ULL,
-    0x000000000122D1F8ULL,
-    0x000000000122D24FULL,
-    0x000000000122D259ULL,
-    0x000000000122D665ULL,
-    0x000000000122D8ACULL,
-    0x000000000122D8B4ULL,
-    0x000000000122D925ULL,
-    0x000000000122DAA5ULL,
-    0x000000000122DC2EULL,
-    0x000000000122DC38ULL,
-    0x000000000122DCA4ULL,
-    0x000000000122DCB4ULL,
-    0x000000000122DD2EULL,
-    0x000000000122DDEEULL,
-    0x000000000122DE88ULL,
-    0x000000000122E0B3ULL,
-    0x000000000122E8B3ULL,
-    0x0000000001241433ULL,
-    0x00000000012415A5ULL,
-    0x00000000012416ADULL,
-    0x00000000012424B3ULL,
-    0x00000000012425A5ULL,
-    0x00000000012425C5ULL,
-    0x00000000012425CFULL,
-    0x0000000001243C99ULL,
-    0x0000000001243DA2ULL,
-    0x0000000001243DC5ULL,
-    0x00000000012455A2ULL,
-    0x00000000012465A5ULL,
-    0x00000000012465C5ULL,
-    0x0000000001246681ULL,
-    0x0000000001248493ULL,
-    0x0000000001248593ULL,
-    0x00000000012485D4ULL,
-    0x0000000001248681ULL,
-    0x0000000001248833ULL,
-    0x0000000001248859ULL,
-    0x00000000012488B3ULL,
-    0x0000000001248CA4ULL,
-    0x0000000001248CB2ULL,
-    0x0000000001248CB3ULL,
-    0x0000000001248CB9ULL,
-    0x0000000001248D14ULL,
-    0x0000000001248D2EULL,
-    0x0000000001248D73ULL,
-    0x00000000012490B2ULL,
-    0x00000000012490B3ULL,
-    0x00000000012490E5ULL,
-    0x00000000012490F9ULL,
-    0x0000000001249123ULL,
-    0x0000000001249593ULL,
-    0x00000000012495B3ULL,
-    0x00000000012496C5ULL,
-    0x00000000012498B2ULL,
-    0x00000000012498D3ULL,
-    0x0000000001249985ULL,
-    0x0000000001249A85ULL,
-    0x0000000001249A93ULL,
-    0x0000000001249A99ULL,
-    0x0000000001249CF3ULL,
-    0x0000000001249D14ULL,
-    0x0000000001249D24ULL,
-    0x0000000001249DECULL,
-    0x0000000001249DF2ULL,
-    0x000000000124B0A4ULL,
-    0x000000000124B0B3ULL,
-    0x000000000124B0B9ULL,
-    0x000000000124B185ULL,
-    0x000000000124B193ULL,
-    0x000000000124B425ULL,
-    0x000000000124B4A4ULL,
-    0x000000000124B4B2ULL,
-    0x000000000124B4B3ULL,
-    0x000000000124B6B3ULL,
-    0x000000000124B893ULL,
-    0x000000000124B899ULL,
-    0x000000000124B8B3ULL,
-    0x000000000124B8F3ULL,
-    0x000000000124B973ULL,
-    0x000000000124BA65ULL,
-    0x000000000124BD41ULL,
-    0x000000000124BE93ULL,
-    0x000000000124C0A4ULL,
-    0x000000000124C0AEULL,
-    0x000000000124C0B2ULL,
-    0x000000000124C0B3ULL,
-    0x000000000124C213ULL,
-    0x000000000124CCAEULL,
-    0x000000000124CCB2ULL,
-    0x000000000124CCB3ULL,
-    0x000000000124CD09ULL,
-    0x000000000124CD73ULL,
-    0x000000000124CD79ULL,
-    0x000000000124CE13ULL,
-    0x000000000124CEB3ULL,
-    0x000000000124D0B3ULL,
-    0x000000000124D293ULL,
-    0x000000000124D359ULL,
-    0x000000000124D82CULL,
-    0x000000000124D833ULL,
-    0x000000000124D8A4ULL,
-    0x000000000124D8ACULL,
-    0x000000000124D8AEULL,
-    0x000000000124D8B2ULL,
-    0x000000000124D8B3ULL,
-    0x000000000124D8B4ULL,
-    0x000000000124E42CULL,
-    0x000000000124E833ULL,
-    0x0000000001278468ULL,
-    0x0000000001278493ULL,
-    0x00000000012785B3ULL,
-    0x00000000012785D3ULL,
-    0x0000000001278653ULL,
-    0x0000000001278659ULL,
-    0x0000000001278674ULL,
-    0x0000000001278685ULL,
-    0x00000000012788A4ULL,
-    0x00000000012788B3ULL,
-    0x000000000127892EULL,
-    0x0000000001278985ULL,
-    0x00000000012789F4ULL,
-    0x0000000001278D73ULL,
-    0x0000000001278D79ULL,
-    0x00000000012790A4ULL,
-    0x00000000012790AFULL,
-    0x00000000012790B3ULL,
-    0x0000000001279CB2ULL,
-    0x0000000001279EA5ULL,
-    0x0000000001279EB9ULL,
-    0x000000000127A0B3ULL,
-    0x000000000127A493ULL,
-    0x000000000127A593ULL,
-    0x000000000127A599ULL,
-    0x000000000127A5D3ULL,
-    0x000000000127A674ULL,
-    0x000000000127A82BULL,
-    0x000000000127A933ULL,
-    0x000000000127ACA4ULL,
-    0x000000000127ACB2ULL,
-    0x000000000127ACB3ULL,
-    0x000000000127B027ULL,
-    0x000000000127B0B3ULL,
-    0x000000000127B0D3ULL,
-    0x000000000127B193ULL,
-    0x000000000127B42CULL,
-    0x000000000127B42EULL,
-    0x000000000127B4AFULL,
-    0x000000000127B613ULL,
-    0x000000000127B885ULL,
-    0x000000000127B88FULL,
-    0x000000000127B8AFULL,
-    0x000000000127B8B3ULL,
-    0x000000000127B92EULL,
-    0x000000000127B9C5ULL,
-    0x000000000127BA85ULL,
-    0x000000000127BA93ULL,
-    0x000000000127BC93ULL,
-    0x000000000127BCD3ULL,
-    0x000000000127BCD9ULL,
-    0x000000000127BD73ULL,
-    0x000000000127BD79ULL,
-    0x000000000127BDB3ULL,
-    0x000000000127BDB9ULL,
-    0x000000000127BDD3ULL,
-    0x000000000127BE13ULL,
-    0x000000000127BE19ULL,
-    0x000000000127BE61ULL,
-    0x000000000127BE65ULL,
-    0x000000000127BE74ULL,
-    0x000000000127BE93ULL,
-    0x000000000127BE99ULL,
-    0x000000000127C0A4ULL,
-    0x000000000127C0B2ULL,
-    0x000000000127C0B3ULL,
-    0x000000000127C0B9ULL,
-    0x000000000127C6A5ULL,
-    0x000000000127C82CULL,
-    0x000000000127C8B3ULL,
-    0x000000000127C923ULL,
-    0x000000000127C924ULL,
-    0x000000000127C925ULL,
-    0x000000000127CA93ULL,
-    0x000000000127CA99ULL,
-    0x000000000127CCA4ULL,
-    0x000000000127CCB3ULL,
-    0x000000000127CCB4ULL,
-    0x000000000127CD09ULL,
-    0x000000000127CD2EULL,
-    0x000000000127CD34ULL,
-    0x000000000127CE89ULL,
-    0x000000000127CE93ULL,
-    0x000000000127D02CULL,
-    0x000000000127D02EULL,
-    0x000000000127D033ULL,
-    0x000000000127D068ULL,
-    0x000000000127D0A4ULL,
-    0x000000000127D0B3ULL,
-    0x000000000127D133ULL,
-    0x000000000127D193ULL,
-    0x000000000127D1EEULL,
-    0x000000000127D1F2ULL,
-    0x000000000127D1F3ULL,
-    0x000000000127D285ULL,
-    0x000000000127D4AEULL,
-    0x000000000127D4B3ULL,
-    0x000000000127D4E5ULL,
-    0x000000000127D4E8ULL,
-    0x000000000127D585ULL,
-    0x000000000127D593ULL,
-    0x000000000127D5B3ULL,
-    0x000000000127D5C4ULL,
-    0x000000000127D613ULL,
-    0x000000000127D619ULL,
-    0x000000000127D665ULL,
-    0x000000000127D674ULL,
-    0x000000000127D685ULL,
-    0x000000000127D688ULL,
-    0x000000000127D693ULL,
-    0x000000000127D8A4ULL,
-    0x000000000127D8AEULL,
-    0x000000000127D8B2ULL,
-    0x000000000127D8B3ULL,
-    0x000000000127DC2EULL,
-    0x000000000127DC99ULL,
-    0x000000000127DCA4ULL,
-    0x000000000127DCACULL,
-    0x000000000127DCAEULL,
-    0x000000000127DCB2ULL,
-    0x000000000127DD25ULL,
-    0x000000000127DDA5ULL,
-    0x000000000127DDC4ULL,
-    0x000000000127DE88ULL,
-    0x000000000127DE93ULL,
-    0x000000000127E42CULL,
-    0x000000000127E5C5ULL,
-    0x000000000127E674ULL,
-    0x000000000127E8B4ULL,
-    0x000000000127E934ULL,
-    0x00000000012A85C1ULL,
-    0x00000000012A8829ULL,
-    0x00000000012A8859ULL,
-    0x00000000012A88ACULL,
-    0x00000000012A88B3ULL,
-    0x00000000012A892EULL,
-    0x00000000012A8985ULL,
-    0x00000000012A8989ULL,
-    0x00000000012A8AB3ULL,
-    0x00000000012A8D05ULL,
-    0x00000000012A8D73ULL,
-    0x00000000012A9033ULL,
-    0x00000000012A9093ULL,
-    0x00000000012A9099ULL,
-    0x00000000012A90B2ULL,
-    0x00000000012A90B3ULL,
-    0x00000000012A9125ULL,
-    0x00000000012A9133ULL,
-    0x00000000012A9481ULL,
-    0x00000000012A9653ULL,
-    0x00000000012A98C5ULL,
-    0x00000000012A98D3ULL,
-    0x00000000012A9C25ULL,
-    0x00000000012A9C2CULL,
-    0x00000000012A9C59ULL,
-    0x00000000012A9CF9ULL,
-    0x00000000012AA5C7ULL,
-    0x00000000012AA5D3ULL,
-    0x00000000012AAD13ULL,
-    0x00000000012AB0A4ULL,
-    0x00000000012AB0B2ULL,
-    0x00000000012AB0B3ULL,
-    0x00000000012AB42CULL,
-    0x00000000012AB441ULL,
-    0x00000000012AB44FULL,
-    0x00000000012AB4AEULL,
-    0x00000000012AB4B3ULL,
-    0x00000000012AB599ULL,
-    0x00000000012AB5B9ULL,
-    0x00000000012AB5F2ULL,
-    0x00000000012AB60FULL,
-    0x00000000012AB613ULL,
-    0x00000000012AB619ULL,
-    0x00000000012AB868ULL,
-    0x00000000012AB893ULL,
-    0x00000000012AB8A4ULL,
-    0x00000000012AB8B3ULL,
-    0x00000000012AB8F3ULL,
-    0x00000000012AB923ULL,
-    0x00000000012AB9D9ULL,
-    0x00000000012ABA93ULL,
-    0x00000000012ABA99ULL,
-    0x00000000012AC0A5ULL,
-    0x00000000012AC121ULL,
-    0x00000000012AC82CULL,
-    0x00000000012ACA13ULL,
-    0x00000000012ACAB3ULL,
-    0x00000000012ACC33ULL,
-    0x00000000012ACCB3ULL,
-    0x00000000012ACD19ULL,
-    0x00000000012ACD73ULL,
-    0x00000000012ACDA1ULL,
-    0x00000000012ACE65ULL,
-    0x00000000012ACE93ULL,
-    0x00000000012ACE99ULL,
-    0x00000000012AD113ULL,
-    0x00000000012AD12EULL,
-    0x00000000012AD299ULL,
-    0x00000000012C8593ULL,
-    0x00000000012C8834ULL,
-    0x00000000012CACA4ULL,
-    0x00000000012CACB3ULL,
-    0x00000000012CB5A5ULL,
-    0x00000000012CB893ULL,
-    0x00000000012CBE93ULL,
-    0x00000000012CC0B2ULL,
-    0x00000000013084F3ULL,
-    0x000000000130882CULL,
-    0x00000000013088A4ULL,
-    0x00000000013088B2ULL,
-    0x00000000013088B3ULL,
-    0x0000000001308901ULL,
-    0x000000000130892EULL,
-    0x0000000001308932ULL,
-    0x0000000001308985ULL,
-    0x00000000013089F4ULL,
-    0x0000000001308A41ULL,
-    0x0000000001308A45ULL,
-    0x0000000001308D73ULL,
-    0x0000000001308E41ULL,
-    0x000000000130908FULL,
-    0x00000000013090B3ULL,
-    0x0000000001309105ULL,
-    0x0000000001309115ULL,
-    0x0000000001309133ULL,
-    0x0000000001309199ULL,
-    0x00000000013091F3ULL,
-    0x0000000001309341ULL,
-    0x00000000013098A4ULL,
-    0x00000000013098B2ULL,
-    0x00000000013098B3ULL,
-    0x0000000001309C33ULL,
-    0x0000000001309CB2ULL,
-    0x0000000001309CB3ULL,
-    0x0000000001309CF9ULL,
-    0x0000000001309DF3ULL,
-    0x0000000001309EADULL,
-    0x000000000130A0A2ULL,
-    0x000000000130A122ULL,
-    0x000000000130A465ULL,
-    0x000000000130A46BULL,
-    0x000000000130A473ULL,
-    0x000000000130A493ULL,
-    0x000000000130A4E1ULL,
-    0x000000000130A593ULL,
-    0x000000000130A5B3ULL,
-    0x000000000130A5C5ULL,
-    0x000000000130A5D3ULL,
-    0x000000000130A5D4ULL,
-    0x000000000130A653ULL,
-    0x000000000130A674ULL,
-    0x000000000130A688ULL,
-    0x000000000130A9F5ULL,
-    0x000000000130AC29ULL,
-    0x000000000130ACB2ULL,
-    0x000000000130ACB3ULL,
-    0x000000000130AD21ULL,
-    0x000000000130AD33ULL,
-    0x000000000130AE89ULL,
-    0x000000000130B024ULL,
-    0x000000000130B02CULL,
-    0x000000000130B034ULL,
-    0x000000000130B0B0ULL,
-    0x000000000130B0B3ULL,
-    0x000000000130B0B4ULL,
-    0x000000000130B123ULL,
-    0x000000000130B138ULL,
-    0x000000000130B185ULL,
-    0x000000000130B199ULL,
-    0x000000000130B1A9ULL,
-    0x000000000130B1ECULL,
-    0x000000000130B1EEULL,
-    0x000000000130B1F0ULL,
-    0x000000000130B201ULL,
-    0x000000000130B213ULL,
-    0x000000000130B261ULL,
-    0x000000000130B265ULL,
-    0x000000000130B28FULL,
-    0x000000000130B293ULL,
-    0x000000000130B299ULL,
-    0x000000000130B2A5ULL,
-    0x000000000130B2B4ULL,
-    0x000000000130B2C5ULL,
-    0x000000000130B2CFULL,
-    0x000000000130B42EULL,
-    0x000000000130B433ULL,
-    0x000000000130B441ULL,
-    0x000000000130B44FULL,
-    0x000000000130B4ABULL,
-    0x000000000130B4ACULL,
-    0x000000000130B4AEULL,
-    0x000000000130B4B3ULL,
-    0x000000000130B4B9ULL,
-    0x000000000130B4D5ULL,
-    0x000000000130B5B9ULL,
-    0x000000000130B609ULL,
-    0x000000000130B613ULL,
-    0x000000000130B893ULL,
-    0x000000000130B899ULL,
-    0x000000000130B8A4ULL,
-    0x000000000130B8B2ULL,
-    0x000000000130B8B3ULL,
-    0x000000000130B8E1ULL,
-    0x000000000130B8E8ULL,
-    0x000000000130B8EFULL,
-    0x000000000130B8F3ULL,
-    0x000000000130B96FULL,
-    0x000000000130BA61ULL,
-    0x000000000130BA8FULL,
-    0x000000000130BA93ULL,
-    0x000000000130BD81ULL,
-    0x000000000130C02EULL,
-    0x000000000130C124ULL,
-    0x000000000130C1F2ULL,
-    0x000000000130C219ULL,
-    0x000000000130C82EULL,
-    0x000000000130C893ULL,
-    0x000000000130C8A4ULL,
-    0x000000000130C8A5ULL,
-    0x000000000130C8E5ULL,
-    0x000000000130C8EFULL,
-    0x000000000130C92EULL,
-    0x000000000130C933ULL,
-    0x000000000130C973ULL,
-    0x000000000130C979ULL,
-    0x000000000130C9E4ULL,
-    0x000000000130C9F3ULL,
-    0x000000000130CAB3ULL,
-    0x000000000130CCB2ULL,
-    0x000000000130CD2EULL,
-    0x000000000130CE65ULL,
-    0x000000000130CE79ULL,
-    0x000000000130D029ULL,
-    0x000000000130D039ULL,
-    0x000000000130D0A4ULL,
-    0x000000000130D0ADULL,
-    0x000000000130D0B3ULL,
-    0x000000000130D12EULL,
-    0x000000000130D133ULL,
-    0x000000000130D332ULL,
-    0x000000000130D441ULL,
-    0x000000000130D465ULL,
-    0x000000000130D468ULL,
-    0x000000000130D479ULL,
-    0x000000000130D4E8ULL,
-    0x000000000130D593ULL,
-    0x000000000130D594ULL,
-    0x000000000130D5C1ULL,
-    0x000000000130D5D4ULL,
-    0x000000000130D659ULL,
-    0x000000000130D685ULL,
-    0x000000000130D693ULL,
-    0x000000000130D8A4ULL,
-    0x000000000130D8B2ULL,
-    0x000000000130D8B3ULL,
-    0x000000000130D8B9ULL,
-    0x000000000130D92EULL,
-    0x000000000130D9F2ULL,
-    0x000000000130D9F9ULL,
-    0x000000000130DAD9ULL,
-    0x000000000130DC28ULL,
-    0x000000000130DCA4ULL,
-    0x000000000130DCB2ULL,
-    0x000000000130E0B3ULL,
-    0x000000000130E4A4ULL,
-    0x000000000130E4B2ULL,
-    0x000000000130E524ULL,
-    0x000000000130E5C5ULL,
-    0x000000000130E5EEULL,
-    0x000000000130E674ULL,
-    0x000000000130E8B3ULL,
-    0x0000000001318453ULL,
-    0x0000000001318493ULL,
-    0x00000000013184C6ULL,
-    0x00000000013184F3ULL,
-    0x000000000131852CULL,
-    0x0000000001318581ULL,
-    0x0000000001318584ULL,
-    0x0000000001318585ULL,
-    0x000000000131858CULL,
-    0x0000000001318590ULL,
-    0x0000000001318599ULL,
-    0x00000000013185B0ULL,
-    0x00000000013185B3ULL,
-    0x00000000013185C4ULL,
-    0x00000000013185D3ULL,
-    0x00000000013185D4ULL,
-    0x0000000001318601ULL,
-    0x0000000001318605ULL,
-    0x0000000001318609ULL,
-    0x0000000001318645ULL,
-    0x0000000001318646ULL,
-    0x0000000001318650ULL,
-    0x0000000001318653ULL,
-    0x0000000001318654ULL,
-    0x0000000001318659ULL,
-    0x0000000001318688ULL,
-    0x0000000001318693ULL,
-    0x0000000001318694ULL,
-    0x00000000013186A4ULL,
-    0x00000000013186B0ULL,
-    0x00000000013186B2ULL,
-    0x00000000013186F3ULL,
-    0x0000000001319434ULL,
-    0x00000000013195C1ULL,
-    0x00000000013195C4ULL,
-    0x00000000013195C5ULL,
-    0x00000000013195D4ULL,
-    0x000000000131A036ULL,
-    0x000000000131A1AFULL,
-    0x000000000131A2ACULL,
-    0x000000000131A2E1ULL,
-    0x000000000131A5EEULL,
-    0x000000000131B12DULL,
-    0x000000000131BC99ULL,
-    0x000000000131BCC6ULL,
-    0x000000000131BCF3ULL,
-    0x000000000131BD84ULL,
-    0x000000000131BDC5ULL,
-    0x000000000131BDE7ULL,
-    0x000000000131BDF0ULL,
-    0x000000000131BDF4ULL,
-    0x000000000131BE01ULL,
-    0x000000000131BE05ULL,
-    0x000000000131BE13ULL,
-    0x000000000131BE45ULL,
-    0x000000000131BE4EULL,
-    0x000000000131BE93ULL,
-    0x000000000131BEA7ULL,
-    0x000000000131BEB0ULL,
-    0x000000000131BEB2ULL,
-    0x000000000131BEB4ULL,
-    0x000000000131BEECULL,
-    0x000000000131BEF0ULL,
-    0x000000000131BEF3ULL,
-    0x000000000131C822ULL,
-    0x000000000131C825ULL,
-    0x000000000131C827ULL,
-    0x000000000131C82DULL,
-    0x000000000131C82EULL,
-    0x000000000131C830ULL,
-    0x000000000131C834ULL,
-    0x000000000131C837ULL,
-    0x000000000131C839ULL,
-    0x000000000131C8A5ULL,
-    0x000000000131C8B7ULL,
-    0x000000000131C92DULL,
-    0x000000000131C930ULL,
-    0x000000000131C9E2ULL,
-    0x000000000131C9E4ULL,
-    0x000000000131C9E7ULL,
-    0x000000000131C9F7ULL,
-    0x000000000131CAA2ULL,
-    0x000000000131CAADULL,
-    0x000000000131D441ULL,
-    0x000000000131D489ULL,
-    0x000000000131D48FULL,
-    0x000000000131D493ULL,
-    0x000000000131D4C6ULL,
-    0x000000000131D4D4ULL,
-    0x000000000131D4F3ULL,
-    0x000000000131D58BULL,
-    0x000000000131D58CULL,
-    0x000000000131D590ULL,
-    0x000000000131D593ULL,
-    0x000000000131D5B3ULL,
-    0x000000000131D613ULL,
-    0x000000000131D646ULL,
-    0x000000000131D653ULL,
-    0x000000000131D665ULL,
-    0x000000000131D681ULL,
-    0x000000000131D685ULL,
-    0x000000000131D693ULL,
-    0x000000000131D75AULL,
-    0x000000000131E4B3ULL,
-    0x000000000132072EULL,
-    0x000000000132152EULL,
-    0x0000000001328593ULL,
-    0x00000000013285A5ULL,
-    0x00000000013285B3ULL,
-    0x00000000013285B9ULL,
-    0x00000000013285D3ULL,
-    0x0000000001328645ULL,
-    0x0000000001328653ULL,
-    0x0000000001328665ULL,
-    0x0000000001328693ULL,
-    0x0000000001328745ULL,
-    0x0000000001328AADULL,
-    0x0000000001328C6FULL,
-    0x0000000001328D13ULL,
-    0x0000000001328E93ULL,
-    0x000000000132902EULL,
-    0x00000000013290B2ULL,
-    0x00000000013290B3ULL,
-    0x00000000013290E5ULL,
-    0x00000000013290F9ULL,
-    0x00000000013292ADULL,
-    0x0000000001329493ULL,
-    0x0000000001329499ULL,
-    0x0000000001329573ULL,
-    0x0000000001329584ULL,
-    0x0000000001329593ULL,
-    0x0000000001329599ULL,
-    0x00000000013295B3ULL,
-    0x0000000001329613ULL,
-    0x0000000001329619ULL,
-    0x0000000001329653ULL,
-    0x00000000013298B2ULL,
-    0x0000000001329C32ULL,
-    0x0000000001329DC9ULL,
-    0x0000000001329DCFULL,
-    0x0000000001329DECULL,
-    0x0000000001329DF3ULL,
-    0x0000000001329EA5ULL,
-    0x000000000132A249ULL,
-    0x000000000132A4D3ULL,
-    0x000000000132A593ULL,
-    0x000000000132A5C5ULL,
-    0x000000000132A653ULL,
-    0x000000000132A665ULL,
-    0x000000000132A66DULL,
-    0x000000000132A699ULL,
-    0x000000000132A741ULL,
-    0x000000000132A745ULL,
-    0x000000000132ADF3ULL,
-    0x000000000132AE93ULL,
-    0x000000000132B028ULL,
-    0x000000000132B0B3ULL,
-    0x000000000132B0D3ULL,
-    0x000000000132B181ULL,
-    0x000000000132B185ULL,
-    0x000000000132B193ULL,
-    0x000000000132B2C1ULL,
-    0x000000000132B4A5ULL,
-    0x000000000132B4AEULL,
-    0x000000000132B4B3ULL,
-    0x000000000132B525ULL,
-    0x000000000132B533ULL,
-    0x000000000132B833ULL,
-    0x000000000132B893ULL,
-    0x000000000132B8B3ULL,
-    0x000000000132B8E9ULL,
-    0x000000000132B9C1ULL,
-    0x000000000132B9F2ULL,
-    0x000000000132BA61ULL,
-    0x000000000132BA65ULL,
-    0x000000000132BA69ULL,
-    0x000000000132BA85ULL,
-    0x000000000132BA89ULL,
-    0x000000000132BA93ULL,
-    0x000000000132BAD9ULL,
-    0x000000000132BB41ULL,
-    0x000000000132C024ULL,
-    0x000000000132C02CULL,
-    0x000000000132C121ULL,
-    0x000000000132C123ULL,
-    0x000000000132C1F9ULL,
-    0x000000000132C281ULL,
-    0x000000000132C293ULL,
-    0x000000000132C823ULL,
-    0x000000000132C829ULL,
-    0x000000000132C82CULL,
-    0x000000000132C8A4ULL,
-    0x000000000132C8B2ULL,
-    0x000000000132C8B3ULL,
-    0x000000000132C8D3ULL,
-    0x000000000132C8E5ULL,
-    0x000000000132C923ULL,
-    0x000000000132C926ULL,
-    0x000000000132C92EULL,
-    0x000000000132C973ULL,
-    0x000000000132C9EEULL,
-    0x000000000132C9F7ULL,
-    0x000000000132CA41ULL,
-    0x000000000132CA45ULL,
-    0x000000000132CA53ULL,
-    0x000000000132CA59ULL,
-    0x000000000132CAADULL,
-    0x000000000132CAC5ULL,
-    0x000000000132CACFULL,
-    0x000000000132CCB9ULL,
-    0x000000000132CE61ULL,
-    0x000000000132D025ULL,
-    0x000000000132D02CULL,
-    0x000000000132D1EEULL,
-    0x000000000132D293ULL,
-    0x000000000132D2B0ULL,
-    0x000000000132D8AEULL,
-    0x000000000132D8B2ULL,
-    0x000000000132DC2EULL,
-    0x000000000132DC32ULL,
-    0x000000000132DCA4ULL,
-    0x000000000132DCACULL,
-    0x000000000132DCAEULL,
-    0x000000000132DCB2ULL,
-    0x000000000132DD2EULL,
-    0x000000000132E0A4ULL,
-    0x000000000132E0B2ULL,
-    0x000000000132E0B3ULL,
-    0x000000000132E28FULL,
-    0x000000000132E293ULL,
-    0x000000000132E4AEULL,
-    0x000000000134046BULL,
-    0x0000000001340485ULL,
-    0x0000000001340493ULL,
-    0x0000000001340499ULL,
-    0x00000000013404D4ULL,
-    0x00000000013404F3ULL,
-    0x0000000001340513ULL,
-    0x0000000001340565ULL,
-    0x000000000134056FULL,
-    0x0000000001340574ULL,
-    0x0000000001340579ULL,
-    0x0000000001340585ULL,
-    0x000000000134058CULL,
-    0x000000000134058DULL,
-    0x0000000001340594ULL,
-    0x0000000001340599ULL,
-    0x00000000013405A1ULL,
-    0x00000000013405A5ULL,
-    0x00000000013405B3ULL,
-    0x00000000013405C4ULL,
-    0x00000000013405CBULL,
-    0x00000000013405D3ULL,
-    0x0000000001340605ULL,
-    0x0000000001340613ULL,
-    0x0000000001340644ULL,
-    0x0000000001340645ULL,
-    0x000000000134064BULL,
-    0x000000000134064EULL,
-    0x0000000001340650ULL,
-    0x0000000001340668ULL,
-    0x00000000013406ACULL,
-    0x00000000013406C5ULL,
-    0x00000000013406ECULL,
-    0x00000000013406EDULL,
-    0x00000000013406EEULL,
-    0x00000000013406F3ULL,
-    0x0000000001340721ULL,
-    0x0000000001340733ULL,
-    0x0000000001340D09ULL,
-    0x0000000001341426ULL,
-    0x000000000134142CULL,
-    0x0000000001341432ULL,
-    0x0000000001341433ULL,
-    0x0000000001341493ULL,
-    0x00000000013414ACULL,
-    0x00000000013414AEULL,
-    0x00000000013414B0ULL,
-    0x00000000013414B2ULL,
-    0x00000000013414B4ULL,
-    0x000000000134152BULL,
-    0x0000000001341586ULL,
-    0x000000000134158CULL,
-    0x00000000013415C4ULL,
-    0x00000000013415D4ULL,
-    0x00000000013415ECULL,
-    0x0000000001341644ULL,
-    0x0000000001341645ULL,
-    0x000000000134164FULL,
-    0x0000000001341693ULL,
-    0x00000000013416C1ULL,
-    0x00000000013416EEULL,
-    0x00000000013416F3ULL,
-    0x0000000001342429ULL,
-    0x00000000013424A4ULL,
-    0x00000000013424ACULL,
-    0x00000000013424B2ULL,
-    0x00000000013424B3ULL,
-    0x00000000013424D4ULL,
-    0x000000000134258CULL,
-    0x0000000001342599ULL,
-    0x00000000013425B3ULL,
-    0x00000000013425C5ULL,
-    0x00000000013425D3ULL,
-    0x00000000013425D9ULL,
-    0x0000000001342613ULL,
-    0x0000000001342645ULL,
-    0x000000000134264BULL,
-    0x0000000001342652ULL,
-    0x0000000001342653ULL,
-    0x0000000001342654ULL,
-    0x0000000001342668ULL,
-    0x000000000134266FULL,
-    0x0000000001342674ULL,
-    0x0000000001342685ULL,
-    0x0000000001342693ULL,
-    0x00000000013426B2ULL,
-    0x00000000013426C1ULL,
-    0x00000000013426C5ULL,
-    0x00000000013426D3ULL,
-    0x00000000013430B0ULL,
-    0x00000000013432A2ULL,
-    0x00000000013434ABULL,
-    0x00000000013435E5ULL,
-    0x0000000001343C2CULL,
-    0x0000000001343C34ULL,
-    0x0000000001343C6BULL,
-    0x0000000001343CA4ULL,
-    0x0000000001343CB2ULL,
-    0x0000000001343CB3ULL,
-    0x0000000001343CE9ULL,
-    0x0000000001343CF3ULL,
-    0x0000000001343D49ULL,
-    0x0000000001343D4FULL,
-    0x0000000001343D81ULL,
-    0x0000000001343DC5ULL,
-    0x0000000001343DEBULL,
-    0x0000000001343DECULL,
-    0x0000000001343DEEULL,
-    0x0000000001343DF3ULL,
-    0x0000000001343DF4ULL,
-    0x0000000001343E05ULL,
-    0x0000000001343E13ULL,
-    0x0000000001343E45ULL,
-    0x0000000001343E4CULL,
-    0x0000000001343E4EULL,
-    0x0000000001343E54ULL,
-    0x0000000001343E85ULL,
-    0x0000000001343E93ULL,
-    0x0000000001343E94ULL,
-    0x0000000001343EB4ULL,
-    0x0000000001343EC5ULL,
-    0x0000000001343EE4ULL,
-    0x0000000001343EEEULL,
-    0x0000000001343EF3ULL,
-    0x0000000001343EF9ULL,
-    0x0000000001343F35ULL,
-    0x00000000013448A4ULL,
-    0x00000000013448B7ULL,
-    0x0000000001344933ULL,
-    0x00000000013449F7ULL,
-    0x0000000001344AA2ULL,
-    0x0000000001344AA7ULL,
-    0x000000000134512BULL,
-    0x00000000013452ADULL,
-    0x00000000013452B0ULL,
-    0x000000000134546BULL,
-    0x0000000001345585ULL,
-    0x000000000134558EULL,
-    0x0000000001345593ULL,
-    0x00000000013455D3ULL,
-    0x00000000013455D4ULL,
-    0x0000000001345641ULL,
-    0x0000000001345668ULL,
-    0x0000000001345685ULL,
-    0x0000000001345693ULL,
-    0x0000000001345C33ULL,
-    0x00000000013464B2ULL,
-    0x0000000001346599ULL,
-    0x0000000001348593ULL,
-    0x0000000001348853ULL,
-    0x0000000001348B2CULL,
-    0x0000000001348CB3ULL,
-    0x0000000001348D14ULL,
-    0x0000000001348D6FULL,
-    0x0000000001348D73ULL,
-    0x0000000001348D79ULL,
-    0x0000000001349033ULL,
-    0x00000000013490A4ULL,
-    0x00000000013490B2ULL,
-    0x00000000013490B3ULL,
-    0x0000000001349101ULL,
-    0x0000000001349105ULL,
-    0x0000000001349185ULL,
-    0x00000000013494E5ULL,
-    0x0000000001349584ULL,
-    0x00000000013495D3ULL,
-    0x00000000013495D4ULL,
-    0x0000000001349688ULL,
-    0x00000000013496B2ULL,
-    0x00000000013496C5ULL,
-    0x0000000001349A93ULL,
-    0x0000000001349D13ULL,
-    0x0000000001349D14ULL,
-    0x0000000001349D2CULL,
-    0x0000000001349D81ULL,
-    0x0000000001349DA1ULL,
-    0x0000000001349DC1ULL,
-    0x0000000001349DD3ULL,
-    0x000000000134A9F3ULL,
-    0x000000000134AC33ULL,
-    0x000000000134ACB2ULL,
-    0x000000000134ACB3ULL,
-    0x000000000134B093ULL,
-    0x000000000134B0A4ULL,
-    0x000000000134B0AEULL,
-    0x000000000134B0B2ULL,
-    0x000000000134B0B3ULL,
-    0x000000000134B0B8ULL,
-    0x000000000134B173ULL,
-    0x000000000134B179ULL,
-    0x000000000134B193ULL,
-    0x000000000134B199ULL,
-    0x000000000134B1F3ULL,
-    0x000000000134B293ULL,
-    0x000000000134B299ULL,
-    0x000000000134B2C1ULL,
-    0x000000000134B432ULL,
-    0x000000000134B433ULL,
-    0x000000000134B441ULL,
-    0x000000000134B533ULL,
-    0x000000000134B613ULL,
-    0x000000000134B6ACULL,
-    0x000000000134B865ULL,
-    0x000000000134B893ULL,
-    0x000000000134B8A4ULL,
-    0x000000000134B8B3ULL,
-    0x000000000134B8B7ULL,
-    0x000000000134B8E5ULL,
-    0x000000000134B8F3ULL,
-    0x000000000134B913ULL,
-    0x000000000134B973ULL,
-    0x000000000134B979ULL,
-    0x000000000134BAB3ULL,
-    0x000000000134C0A4ULL,
-    0x000000000134C0B3ULL,
-    0x000000000134C219ULL,
-    0x000000000134C8A4ULL,
-    0x000000000134C8A5ULL,
-    0x000000000134C8AEULL,
-    0x000000000134C8B3ULL,
-    0x000000000134C928ULL,
-    0x000000000134C933ULL,
-    0x000000000134C9E3ULL,
-    0x000000000134CA41ULL,
-    0x000000000134CAB0ULL,
-    0x000000000134CC2CULL,
-    0x000000000134CCB3ULL,
-    0x000000000134CE79ULL,
-    0x000000000134CE81ULL,
-    0x000000000134CE93ULL,
-    0x000000000134D032ULL,
-    0x000000000134D0A4ULL,
-    0x000000000134D0B3ULL,
-    0x000000000134D105ULL,
-    0x000000000134D161ULL,
-    0x000000000134D2B0ULL,
-    0x000000000134D2B3ULL,
-    0x000000000134D8B2ULL,
-    0x000000000134E0B2ULL,
-    0x000000000134E0B3ULL,
-    0x000000000134E1AFULL,
-    0x000000000134E285ULL,
-    0x000000000134E288ULL,
-    0x000000000134E299ULL,
-    0x000000000134E832ULL,
-    0x000000000134E8A4ULL,
-    0x000000000134E8ACULL,
-    0x000000000134E8B2ULL,
-    0x000000000134E8B3ULL,
-    0x00000000013584F3ULL,
-    0x000000000135852CULL,
-    0x0000000001358584ULL,
-    0x00000000013585CBULL,
-    0x0000000001358654ULL,
-    0x0000000001358685ULL,
-    0x0000000001358693ULL,
-    0x0000000001358694ULL,
-    0x00000000013586F3ULL,
-    0x000000000135942EULL,
-    0x0000000001359432ULL,
-    0x0000000001359493ULL,
-    0x00000000013594A4ULL,
-    0x00000000013594A6ULL,
-    0x00000000013594AEULL,
-    0x00000000013594B2ULL,
-    0x00000000013594B3ULL,
-    0x00000000013594B4ULL,
-    0x00000000013594E7ULL,
-    0x00000000013594F3ULL,
-    0x000000000135952EULL,
-    0x0000000001359586ULL,
-    0x000000000135958CULL,
-    0x000000000135958DULL,
-    0x0000000001359590ULL,
-    0x00000000013595C5ULL,
-    0x00000000013595D3ULL,
-    0x00000000013595F3ULL,
-    0x0000000001359613ULL,
-    0x0000000001359653ULL,
-    0x0000000001359693ULL,
-    0x00000000013596F3ULL,
-    0x000000000135A493ULL,
-    0x000000000135A4A4ULL,
-    0x000000000135A4B2ULL,
-    0x000000000135A4B3ULL,
-    0x000000000135A4B9ULL,
-    0x000000000135A4C6ULL,
-    0x000000000135A58CULL,
-    0x000000000135A5AFULL,
-    0x000000000135A5B0ULL,
-    0x000000000135A5B3ULL,
-    0x000000000135A5CBULL,
-    0x000000000135A5D3ULL,
-    0x000000000135A5D4ULL,
-    0x000000000135A5F3ULL,
-    0x000000000135A613ULL,
-    0x000000000135A64CULL,
-    0x000000000135A652ULL,
-    0x000000000135A654ULL,
-    0x000000000135A685ULL,
-    0x000000000135A693ULL,
-    0x000000000135A6C5ULL,
-    0x000000000135A6D9ULL,
-    0x000000000135B12DULL,
-    0x000000000135BC2CULL,
-    0x000000000135BC99ULL,
-    0x000000000135BCC6ULL,
-    0x000000000135BCF3ULL,
-    0x000000000135BD93ULL,
-    0x000000000135BDECULL,
-    0x000000000135BE54ULL,
-    0x000000000135BE68ULL,
-    0x000000000135C82EULL,
-    0x000000000135C92BULL,
-    0x000000000135D433ULL,
-    0x000000000135D4F3ULL,
-    0x000000000135D58BULL,
-    0x000000000135D58CULL,
-    0x000000000135D5CBULL,
-    0x000000000135E4A4ULL,
-    0x000000000135E4B2ULL,
-    0x000000000135E4B9ULL,
-    0x000000000135E4D3ULL,
-    0x000000000135E645ULL,
-    0x000000000135E653ULL,
-    0x000000000135E685ULL,
-    0x0000000001360453ULL,
-    0x000000000136046BULL,
-    0x0000000001360485ULL,
-    0x00000000013604B3ULL,
-    0x00000000013604F3ULL,
-    0x0000000001360524ULL,
-    0x000000000136052EULL,
-    0x0000000001360565ULL,
-    0x00000000013605B3ULL,
-    0x00000000013605C5ULL,
-    0x00000000013605C7ULL,
-    0x00000000013605CBULL,
-    0x00000000013605D4ULL,
-    0x0000000001360613ULL,
-    0x0000000001360654ULL,
-    0x0000000001360668ULL,
-    0x0000000001360685ULL,
-    0x0000000001360693ULL,
-    0x0000000001360699ULL,
-    0x00000000013606F3ULL,
-    0x0000000001360733ULL,
-    0x0000000001361453ULL,
-    0x0000000001361493ULL,
-    0x00000000013614ABULL,
-    0x00000000013614B0ULL,
-    0x00000000013614B2ULL,
-    0x00000000013614B4ULL,
-    0x0000000001361614ULL,
-    0x00000000013616F3ULL,
-    0x0000000001361733ULL,
-    0x0000000001362465ULL,
-    0x000000000136246BULL,
-    0x0000000001362485ULL,
-    0x00000000013624B2ULL,
-    0x0000000001362599ULL,
-    0x00000000013625A5ULL,
-    0x00000000013625B3ULL,
-    0x00000000013625B9ULL,
-    0x00000000013625C7ULL,
-    0x00000000013625CBULL,
-    0x0000000001362605ULL,
-    0x0000000001362613ULL,
-    0x0000000001362614ULL,
-    0x0000000001362668ULL,
-    0x0000000001362693ULL,
-    0x00000000013626C5ULL,
-    0x0000000001363C2EULL,
-    0x0000000001363C53ULL,
-    0x0000000001363CB3ULL,
-    0x0000000001363CF3ULL,
-    0x0000000001363D24ULL,
-    0x0000000001363D44ULL,
-    0x0000000001363DAFULL,
-    0x0000000001363DEDULL,
-    0x0000000001363DF0ULL,
-    0x0000000001363DF4ULL,
-    0x0000000001363E05ULL,
-    0x0000000001363E13ULL,
-    0x0000000001363E19ULL,
-    0x0000000001363E4DULL,
-    0x0000000001363E68ULL,
-    0x0000000001363E88ULL,
-    0x0000000001363E93ULL,
-    0x0000000001363EC5ULL,
-    0x0000000001363EF3ULL,
-    0x0000000001363F24ULL,
-    0x0000000001365442ULL,
-    0x0000000001365453ULL,
-    0x00000000013654A4ULL,
-    0x00000000013654B3ULL,
-    0x00000000013654C6ULL,
-    0x00000000013654F3ULL,
-    0x0000000001365534ULL,
-    0x00000000013655B0ULL,
-    0x00000000013655B3ULL,
-    0x00000000013655C7ULL,
-    0x00000000013655CBULL,
-    0x0000000001365642ULL,
-    0x0000000001365650ULL,
-    0x0000000001365653ULL,
-    0x0000000001365665ULL,
-    0x0000000001365668ULL,
-    0x00000000013664B2ULL,
-    0x0000000001366599ULL,
-    0x0000000001366605ULL,
-    0x000000000136842BULL,
-    0x000000000136846BULL,
-    0x000000000136852BULL,
-    0x000000000136858CULL,
-    0x000000000136858DULL,
-    0x0000000001368594ULL,
-    0x000000000136864DULL,
-    0x0000000001368654ULL,
-    0x0000000001368668ULL,
-    0x0000000001368745ULL,
-    0x0000000001369432ULL,
-    0x00000000013694ABULL,
-    0x00000000013694B3ULL,
-    0x000000000136952BULL,
-    0x0000000001369565ULL,
-    0x000000000136958CULL,
-    0x0000000001369594ULL,
-    0x000000000136964BULL,
-    0x00000000013696F3ULL,
-    0x000000000136A585ULL,
-    0x000000000136A64BULL,
-    0x000000000136A652ULL,
-    0x000000000136A653ULL,
-    0x000000000136A685ULL,
-    0x000000000136A688ULL,
-    0x000000000136A693ULL,
-    0x000000000136BC6BULL,
-    0x000000000136BCF3ULL,
-    0x000000000136BD65ULL,
-    0x000000000136BD6FULL,
-    0x000000000136BD79ULL,
-    0x000000000136BD94ULL,
-    0x000000000136BDF2ULL,
-    0x000000000136BDF4ULL,
-    0x000000000136BE45ULL,
-    0x000000000136BE47ULL,
-    0x000000000136BE85ULL,
-    0x000000000136BEB4ULL,
-    0x000000000136BEF4ULL,
-    0x000000000136D4F3ULL,
-    0x000000000136D653ULL,
-    0x000000000136D668ULL,
-    0x000000000136D693ULL,
-    0x0000000001370453ULL,
-    0x000000000137046BULL,
-    0x00000000013704D5ULL,
-    0x00000000013704F3ULL,
-    0x000000000137052CULL,
-    0x0000000001370565ULL,
-    0x0000000001370579ULL,
-    0x0000000001370613ULL,
-    0x0000000001370645ULL,
-    0x0000000001370646ULL,
-    0x000000000137064BULL,
-    0x000000000137064CULL,
-    0x0000000001370653ULL,
-    0x0000000001370659ULL,
-    0x0000000001370668ULL,
-    0x0000000001370688ULL,
-    0x00000000013706F3ULL,
-    0x0000000001371424ULL,
-    0x000000000137142BULL,
-    0x0000000001371430ULL,
-    0x0000000001371453ULL,
-    0x000000000137146BULL,
-    0x0000000001371493ULL,
-    0x00000000013714A4ULL,
-    0x00000000013714B2ULL,
-    0x00000000013714B3ULL,
-    0x000000000137158CULL,
-    0x0000000001372453ULL,
-    0x000000000137246BULL,
-    0x0000000001372485ULL,
-    0x00000000013724B3ULL,
-    0x00000000013724C6ULL,
-    0x00000000013724D4ULL,
-    0x00000000013724F3ULL,
-    0x0000000001372605ULL,
-    0x0000000001372613ULL,
-    0x0000000001372619ULL,
-    0x0000000001372654ULL,
-    0x0000000001372693ULL,
-    0x0000000001373C53ULL,
-    0x0000000001373C93ULL,
-    0x0000000001373CABULL,
-    0x0000000001373CB0ULL,
-    0x0000000001373CF3ULL,
-    0x0000000001373D65ULL,
-    0x0000000001373DE4ULL,
-    0x0000000001373DEBULL,
-    0x0000000001373DECULL,
-    0x0000000001373DF0ULL,
-    0x0000000001373DF4ULL,
-    0x0000000001373E45ULL,
-    0x0000000001373E54ULL,
-    0x0000000001373E93ULL,
-    0x0000000001373EB4ULL,
-    0x0000000001373EEBULL,
-    0x0000000001373EF3ULL,
-    0x0000000001373EF9ULL,
-    0x0000000001375453ULL,
-    0x000000000137546BULL,
-    0x00000000013754C6ULL,
-    0x00000000013754F3ULL,
-    0x0000000001375668ULL,
-    0x00000000013764B3ULL,
-    0x0000000001378573ULL,
-    0x0000000001378613ULL,
-    0x0000000001378619ULL,
-    0x0000000001378645ULL,
-    0x0000000001378653ULL,
-    0x00000000013786C5ULL,
-    0x0000000001378833ULL,
-    0x00000000013788B2ULL,
-    0x0000000001378C33ULL,
-    0x0000000001378CB3ULL,
-    0x0000000001378D6FULL,
-    0x0000000001378D73ULL,
-    0x0000000001378D85ULL,
-    0x0000000001379033ULL,
-    0x0000000001379099ULL,
-    0x0000000001379123ULL,
-    0x00000000013791EDULL,
-    0x0000000001379832ULL,
-    0x0000000001379833ULL,
-    0x0000000001379A81ULL,
-    0x0000000001379A93ULL,
-    0x0000000001379A99ULL,
-    0x0000000001379CB2ULL,
-    0x0000000001379CF9ULL,
-    0x000000000137A2B2ULL,
-    0x000000000137A593ULL,
-    0x000000000137A599ULL,
-    0x000000000137A833ULL,
-    0x000000000137AAB3ULL,
-    0x000000000137AC28ULL,
-    0x000000000137ACAEULL,
-    0x000000000137ACB3ULL,
-    0x000000000137ADECULL,
-    0x000000000137B028ULL,
-    0x000000000137B02EULL,
-    0x000000000137B032ULL,
-    0x000000000137B033ULL,
-    0x000000000137B085ULL,
-    0x000000000137B089ULL,
-    0x000000000137B08FULL,
-    0x000000000137B093ULL,
-    0x000000000137B0A4ULL,
-    0x000000000137B0A9ULL,
-    0x000000000137B0B2ULL,
-    0x000000000137B0B3ULL,
-    0x000000000137B124ULL,
-    0x000000000137B1EEULL,
-    0x000000000137B1F3ULL,
-    0x000000000137B2ADULL,
-    0x000000000137B2B3ULL,
-    0x000000000137B2C5ULL,
-    0x000000000137B42EULL,
-    0x000000000137B433ULL,
-    0x000000000137B832ULL,
-    0x000000000137B865ULL,
-    0x000000000137B885ULL,
-    0x000000000137B8B3ULL,
-    0x000000000137B8F3ULL,
-    0x000000000137B923ULL,
-    0x000000000137B999ULL,
-    0x000000000137B9C5ULL,
-    0x000000000137B9D9ULL,
-    0x000000000137BA65ULL,
-    0x000000000137BA79ULL,
-    0x000000000137BCB9ULL,
-    0x000000000137BD73ULL,
-    0x000000000137BD79ULL,
-    0x000000000137BD85ULL,
-    0x000000000137BD93ULL,
-    0x000000000137BDB3ULL,
-    0x000000000137BE13ULL,
-    0x000000000137BE85ULL,
-    0x000000000137BE88ULL,
-    0x000000000137BE93ULL,
-    0x000000000137BE99ULL,
-    0x000000000137C113ULL,
-    0x000000000137C119ULL,
-    0x000000000137C1F2ULL,
-    0x000000000137C219ULL,
-    0x000000000137C241ULL,
-    0x000000000137C82CULL,
-    0x000000000137C833ULL,
-    0x000000000137C84FULL,
-    0x000000000137C853ULL,
-    0x000000000137C881ULL,
-    0x000000000137C88FULL,
-    0x000000000137C893ULL,
-    0x000000000137C8A4ULL,
-    0x000000000137C8A5ULL,
-    0x000000000137C8ACULL,
-    0x000000000137C8B2ULL,
-    0x000000000137C8B3ULL,
-    0x000000000137C8B8ULL,
-    0x000000000137C8EFULL,
-    0x000000000137C9D3ULL,
-    0x000000000137CA41ULL,
-    0x000000000137CA59ULL,
-    0x000000000137CA81ULL,
-    0x000000000137CA93ULL,
-    0x000000000137CAB3ULL,
-    0x000000000137D113ULL,
-    0x000000000137D1ECULL,
-    0x000000000137D465ULL,
-    0x000000000137D474ULL,
-    0x000000000137D4E8ULL,
-    0x000000000137D573ULL,
-    0x000000000137D593ULL,
-    0x000000000137D5B3ULL,
-    0x000000000137D5C4ULL,
-    0x000000000137D613ULL,
-    0x000000000137D619ULL,
-    0x000000000137D653ULL,
-    0x000000000137D665ULL,
-    0x000000000137D688ULL,
-    0x000000000137D693ULL,
-    0x000000000137DC32ULL,
-    0x000000000137DC65ULL,
-    0x000000000137DCA4ULL,
-    0x000000000137DCB2ULL,
-    0x000000000137DCC6ULL,
-    0x000000000137DCD3ULL,
-    0x000000000137DD85ULL,
-    0x000000000137DD93ULL,
-    0x000000000137DDB3ULL,
-    0x000000000137DDC4ULL,
-    0x000000000137DDC5ULL,
-    0x000000000137DE13ULL,
-    0x000000000137DE65ULL,
-    0x000000000137DE88ULL,
-    0x000000000137E433ULL,
-    0x000000000137E585ULL,
-    0x000000000137E6BAULL,
-    0x000000000137E92EULL,
-    0x0000000001380465ULL,
-    0x0000000001380479ULL,
-    0x0000000001380485ULL,
-    0x000000000138048FULL,
-    0x00000000013804A4ULL,
-    0x00000000013804B2ULL,
-    0x00000000013804B3ULL,
-    0x00000000013804F3ULL,
-    0x0000000001380509ULL,
-    0x000000000138052CULL,
-    0x000000000138052EULL,
-    0x0000000001380534ULL,
-    0x0000000001380565ULL,
-    0x0000000001380584ULL,
-    0x0000000001380585ULL,
-    0x000000000138058CULL,
-    0x0000000001380594ULL,
-    0x00000000013805B3ULL,
-    0x00000000013805C5ULL,
-    0x00000000013805C7ULL,
-    0x00000000013805CBULL,
-    0x00000000013805D3ULL,
-    0x0000000001380644ULL,
-    0x0000000001380645ULL,
-    0x000000000138064BULL,
-    0x0000000001380653ULL,
-    0x0000000001380654ULL,
-    0x000000000138066DULL,
-    0x0000000001380685ULL,
-    0x0000000001380693ULL,
-    0x00000000013806ACULL,
-    0x00000000013806ECULL,
-    0x00000000013806EEULL,
-    0x00000000013806F3ULL,
-    0x0000000001380724ULL,
-    0x0000000001380733ULL,
-    0x0000000001380741ULL,
-    0x000000000138075AULL,
-    0x000000000138142BULL,
-    0x000000000138142CULL,
-    0x000000000138142EULL,
-    0x0000000001381432ULL,
-    0x0000000001381434ULL,
-    0x000000000138146BULL,
-    0x0000000001381473ULL,
-    0x0000000001381474ULL,
-    0x00000000013814A4ULL,
-    0x00000000013814ACULL,
-    0x00000000013814B2ULL,
-    0x000000000138152CULL,
-    0x0000000001381532ULL,
-    0x0000000001381573ULL,
-    0x0000000001381584ULL,
-    0x000000000138158BULL,
-    0x000000000138158CULL,
-    0x0000000001381594ULL,
-    0x00000000013815C4ULL,
-    0x00000000013815D4ULL,
-    0x00000000013815F3ULL,
-    0x000000000138164DULL,
-    0x0000000001381693ULL,
-    0x00000000013816A7ULL,
-    0x00000000013816F3ULL,
-    0x00000000013816F9ULL,
-    0x000000000138242CULL,
-    0x0000000001382461ULL,
-    0x0000000001382465ULL,
-    0x0000000001382479ULL,
-    0x0000000001382485ULL,
-    0x00000000013824A4ULL,
-    0x00000000013824ACULL,
-    0x00000000013824B2ULL,
-    0x00000000013824B3ULL,
-    0x00000000013824C6ULL,
-    0x00000000013824D3ULL,
-    0x0000000001382565ULL,
-    0x0000000001382579ULL,
-    0x0000000001382585ULL,
-    0x000000000138258CULL,
-    0x0000000001382594ULL,
-    0x00000000013825B3ULL,
-    0x00000000013825C1ULL,
-    0x00000000013825C5ULL,
-    0x00000000013825CBULL,
-    0x00000000013825D3ULL,
-    0x00000000013825D9ULL,
-    0x0000000001382645ULL,
-    0x0000000001382654ULL,
-    0x0000000001382659ULL,
-    0x0000000001382685ULL,
-    0x0000000001382693ULL,
-    0x000000000138269AULL,
-    0x00000000013826D3ULL,
-    0x0000000001383034ULL,
-    0x0000000001383039ULL,
-    0x0000000001383134ULL,
-    0x00000000013831E7ULL,
-    0x0000000001383C85ULL,
-    0x0000000001383C93ULL,
-    0x0000000001383D2CULL,
-    0x0000000001383D65ULL,
-    0x0000000001383DE6ULL,
-    0x0000000001383DEBULL,
-    0x0000000001383DECULL,
-    0x0000000001383DEDULL,
-    0x0000000001383DEEULL,
-    0x0000000001383DF2ULL,
-    0x0000000001383DF4ULL,
-    0x0000000001383E45ULL,
-    0x0000000001383E4BULL,
-    0x0000000001383E54ULL,
-    0x0000000001383E68ULL,
-    0x0000000001383E93ULL,
-    0x0000000001383EB4ULL,
-    0x0000000001384824ULL,
-    0x0000000001384827ULL,
-    0x0000000001384834ULL,
-    0x0000000001384839ULL,
-    0x00000000013848A4ULL,
-    0x00000000013848A5ULL,
-    0x00000000013848B7ULL,
-    0x0000000001384927ULL,
-    0x0000000001384934ULL,
-    0x00000000013849E4ULL,
-    0x00000000013849E7ULL,
-    0x0000000001384AA5ULL,
-    0x0000000001384AA7ULL,
-    0x0000000001385493ULL,
-    0x00000000013854A4ULL,
-    0x00000000013854B2ULL,
-    0x00000000013854B3ULL,
-    0x00000000013854F3ULL,
-    0x0000000001385585ULL,
-    0x00000000013855A5ULL,
-    0x00000000013855B9ULL,
-    0x00000000013855CBULL,
-    0x000000000138564EULL,
-    0x0000000001385653ULL,
-    0x0000000001385654ULL,
-    0x0000000001385681ULL,
-    0x000000000138642CULL,
-    0x0000000001386645ULL,
-    0x000000000138D422ULL,
-    0x000000000138D424ULL,
-    0x000000000138D434ULL,
-    0x000000000138D437ULL,
-    0x000000000138D4A7ULL,
-    0x000000000138D522ULL,
-    0x000000000138D524ULL,
-    0x000000000138D534ULL,
-    0x000000000138D53AULL,
-    0x00000000013A0453ULL,
-    0x00000000013A046BULL,
-    0x00000000013A0485ULL,
-    0x00000000013A04C6ULL,
-    0x00000000013A04E5ULL,
-    0x00000000013A04F3ULL,
-    0x00000000013A04F9ULL,
-    0x00000000013A0524ULL,
-    0x00000000013A0527ULL,
-    0x00000000013A052EULL,
-    0x00000000013A0532ULL,
-    0x00000000013A0565ULL,
-    0x00000000013A0585ULL,
-    0x00000000013A058BULL,
-    0x00000000013A058CULL,
-    0x00000000013A05B0ULL,
-    0x00000000013A05C4ULL,
-    0x00000000013A05C5ULL,
-    0x00000000013A05C7ULL,
-    0x00000000013A05CBULL,
-    0x00000000013A0608ULL,
-    0x00000000013A0613ULL,
-    0x00000000013A0645ULL,
-    0x00000000013A064BULL,
-    0x00000000013A064EULL,
-    0x00000000013A0652ULL,
-    0x00000000013A0653ULL,
-    0x00000000013A0654ULL,
-    0x00000000013A0668ULL,
-    0x00000000013A0685ULL,
-    0x00000000013A0693ULL,
-    0x00000000013A06AEULL,
-    0x00000000013A06C5ULL,
-    0x00000000013A06F3ULL,
-    0x00000000013A0733ULL,
-    0x00000000013A1424ULL,
-    0x00000000013A142BULL,
-    0x00000000013A142CULL,
-    0x00000000013A142DULL,
-    0x00000000013A142EULL,
-    0x00000000013A1432ULL,
-    0x00000000013A1484ULL,
-    0x00000000013A1485ULL,
-    0x00000000013A1493ULL,
-    0x00000000013A14A4ULL,
-    0x00000000013A14ABULL,
-    0x00000000013A14ACULL,
-    0x00000000013A14ADULL,
-    0x00000000013A14AEULL,
-    0x00000000013A14B0ULL,
-    0x00000000013A14B2ULL,
-    0x00000000013A152CULL,
-    0x00000000013A152EULL,
-    0x00000000013A1581ULL,
-    0x00000000013A1585ULL,
-    0x00000000013A158CULL,
-    0x00000000013A15A5ULL,
-    0x00000000013A15B3ULL,
-    0x00000000013A15C4ULL,
-    0x00000000013A15CFULL,
-    0x00000000013A15D3ULL,
-    0x00000000013A15D4ULL,
-    0x00000000013A1613ULL,
-    0x00000000013A1614ULL,
-    0x00000000013A1645ULL,
-    0x00000000013A164EULL,
-    0x00000000013A1693ULL,
-    0x00000000013A16F3ULL,
-    0x00000000013A16F9ULL,
-    0x00000000013A1733ULL,
-    0x00000000013A2468ULL,
-    0x00000000013A246BULL,
-    0x00000000013A24A4ULL,
-    0x00000000013A24B3ULL,
-    0x00000000013A24C6ULL,
-    0x00000000013A2582ULL,
-    0x00000000013A2585ULL,
-    0x00000000013A258CULL,
-    0x00000000013A2594ULL,
-    0x00000000013A25A5ULL,
-    0x00000000013A25B3ULL,
-    0x00000000013A25B9ULL,
-    0x00000000013A25C7ULL,
-    0x00000000013A25CBULL,
-    0x00000000013A25D4ULL,
-    0x00000000013A2601ULL,
-    0x00000000013A2605ULL,
-    0x00000000013A2645ULL,
-    0x00000000013A264BULL,
-    0x00000000013A2650ULL,
-    0x00000000013A2653ULL,
-    0x00000000013A26C5ULL,
-    0x00000000013A26D9ULL,
-    0x00000000013A3C25ULL,
-    0x00000000013A3C29ULL,
-    0x00000000013A3C33ULL,
-    0x00000000013A3C34ULL,
-    0x00000000013A3C53ULL,
-    0x00000000013A3C6BULL,
-    0x00000000013A3CB0ULL,
-    0x00000000013A3CF9ULL,
-    0x00000000013A3D23ULL,
-    0x00000000013A3D34ULL,
-    0x00000000013A3D65ULL,
-    0x00000000013A3D85ULL,
-    0x00000000013A3D8EULL,
-    0x00000000013A3DA1ULL,
-    0x00000000013A3DB0ULL,
-    0x00000000013A3DC4ULL,
-    0x00000000013A3DC5ULL,
-    0x00000000013A3DC7ULL,
-    0x00000000013A3DCBULL,
-    0x00000000013A3DCEULL,
-    0x00000000013A3DD9ULL,
-    0x00000000013A3DE4ULL,
-    0x00000000013A3DEBULL,
-    0x00000000013A3DECULL,
-    0x00000000013A3DF0ULL,
-    0x00000000013A3DF2ULL,
-    0x00000000013A3E05ULL,
-    0x00000000013A3E13ULL,
-    0x00000000013A3E14ULL,
-    0x00000000013A3E45ULL,
-    0x00000000013A3E4BULL,
-    0x00000000013A3E4DULL,
-    0x00000000013A3E59ULL,
-    0x00000000013A3E73ULL,
-    0x00000000013A3E93ULL,
-    0x00000000013A3E94ULL,
-    0x00000000013A3EAEULL,
-    0x00000000013A3EB0ULL,
-    0x00000000013A3EB2ULL,
-    0x00000000013A3EB4ULL,
-    0x00000000013A3EC5ULL,
-    0x00000000013A3EEEULL,
-    0x00000000013A3EF0ULL,
-    0x00000000013A3EF3ULL,
-    0x00000000013A4824ULL,
-    0x00000000013A4825ULL,
-    0x00000000013A4827ULL,
-    0x00000000013A482BULL,
-    0x00000000013A4830ULL,
-    0x00000000013A4837ULL,
-    0x00000000013A4839ULL,
-    0x00000000013A48B0ULL,
-    0x00000000013A48B7ULL,
-    0x00000000013A4921ULL,
-    0x00000000013A4927ULL,
-    0x00000000013A492DULL,
-    0x00000000013A4930ULL,
-    0x00000000013A49F0ULL,
-    0x00000000013A49F7ULL,
-    0x00000000013A49F9ULL,
-    0x00000000013A4AADULL,
-    0x00000000013A4AB4ULL,
-    0x00000000013A5453ULL,
-    0x00000000013A546BULL,
-    0x00000000013A5485ULL,
-    0x00000000013A5493ULL,
-    0x00000000013A5499ULL,
-    0x00000000013A54C6ULL,
-    0x00000000013A558CULL,
-    0x00000000013A558DULL,
-    0x00000000013A55ADULL,
-    0x00000000013A55B0ULL,
-    0x00000000013A55B3ULL,
-    0x00000000013A55C7ULL,
-    0x00000000013A55CBULL,
-    0x00000000013A55D3ULL,
-    0x00000000013A55D4ULL,
-    0x00000000013A5601ULL,
-    0x00000000013A5605ULL,
-    0x00000000013A5645ULL,
-    0x00000000013A5654ULL,
-    0x00000000013A64A4ULL,
-    0x00000000013A64B3ULL,
-    0x00000000013A6585ULL,
-    0x00000000013A6589ULL,
-    0x00000000013A658FULL,
-    0x00000000013A65A5ULL,
-    0x00000000013A65B9ULL,
-    0x00000000013A6645ULL,
-    0x00000000013A6685ULL,
-    0x00000000013A86C5ULL,
-    0x00000000013A8828ULL,
-    0x00000000013A8833ULL,
-    0x00000000013A8859ULL,
-    0x00000000013A88B2ULL,
-    0x00000000013A8901ULL,
-    0x00000000013A8C69ULL,
-    0x00000000013A8D73ULL,
-    0x00000000013A8D79ULL,
-    0x00000000013A8E45ULL,
-    0x00000000013A9093ULL,
-    0x00000000013A91F2ULL,
-    0x00000000013A9279ULL,
-    0x00000000013A9485ULL,
-    0x00000000013A95D4ULL,
-    0x00000000013A9653ULL,
-    0x00000000013A9685ULL,
-    0x00000000013A9693ULL,
-    0x00000000013A9699ULL,
-    0x00000000013A9C2EULL,
-    0x00000000013A9C32ULL,
-    0x00000000013A9D13ULL,
-    0x00000000013A9DF3ULL,
-    0x00000000013AA2B2ULL,
-    0x00000000013AA493ULL,
-    0x00000000013AA5C7ULL,
-    0x00000000013AA5D4ULL,
-    0x00000000013AA685ULL,
-    0x00000000013AA693ULL,
-    0x00000000013AA8A5ULL,
-    0x00000000013AAD13ULL,
-    0x00000000013AAEABULL,
-    0x00000000013AB069ULL,
-    0x00000000013AB0C1ULL,
-    0x00000000013AB0CFULL,
-    0x00000000013AB173ULL,
-    0x00000000013AB179ULL,
-    0x00000000013AB199ULL,
-    0x00000000013AB208ULL,
-    0x00000000013AB2B3ULL,
-    0x00000000013AB423ULL,
-    0x00000000013AB533ULL,
-    0x00000000013AB5A1ULL,
-    0x00000000013AB5F3ULL,
-    0x00000000013AB608ULL,
-    0x00000000013AB613ULL,
-    0x00000000013AB933ULL,
-    0x00000000013AB973ULL,
-    0x00000000013AB9C1ULL,
-    0x00000000013AB9D3ULL,
-    0x00000000013AB9D9ULL,
-    0x00000000013ABAB0ULL,
-    0x00000000013AC0B2ULL,
-    0x00000000013AC0B3ULL,
-    0x00000000013AC241ULL,
-    0x00000000013AC828ULL,
-    0x00000000013AC82CULL,
-    0x00000000013AC833ULL,
-    0x00000000013AC834ULL,
-    0x00000000013AC893ULL,
-    0x00000000013AC8A4ULL,
-    0x00000000013AC8B2ULL,
-    0x00000000013AC8B3ULL,
-    0x00000000013AC8D3ULL,
-    0x00000000013AC8D9ULL,
-    0x00000000013AC8E5ULL,
-    0x00000000013AC8F9ULL,
-    0x00000000013AC999ULL,
-    0x00000000013ACA41ULL,
-    0x00000000013ACCA4ULL,
-    0x00000000013ACCB3ULL,
-    0x00000000013ACD09ULL,
-    0x00000000013ACEB3ULL,
-    0x00000000013AD1F2ULL,
-    0x00000000013AD241ULL,
-    0x00000000013AD281ULL,
-    0x00000000013B8453ULL,
-    0x00000000013B846BULL,
-    0x00000000013B8493ULL,
-    0x00000000013B84E5ULL,
-    0x00000000013B84F3ULL,
-    0x00000000013B852CULL,
-    0x00000000013B852EULL,
-    0x00000000013B8585ULL,
-    0x00000000013B8599ULL,
-    0x00000000013B85A9ULL,
-    0x00000000013B85B0ULL,
-    0x00000000013B85B9ULL,
-    0x00000000013B85C7ULL,
-    0x00000000013B85CBULL,
-    0x00000000013B85D3ULL,
-    0x00000000013B8613ULL,
-    0x00000000013B8614ULL,
-    0x00000000013B8644ULL,
-    0x00000000013B8645ULL,
-    0x00000000013B8646ULL,
-    0x00000000013B864DULL,
-    0x00000000013B8654ULL,
-    0x00000000013B8668ULL,
-    0x00000000013B8688ULL,
-    0x00000000013B8693ULL,
-    0x00000000013B872CULL,
-    0x00000000013B8733ULL,
-    0x00000000013B942CULL,
-    0x00000000013B9432ULL,
-    0x00000000013B9434ULL,
-    0x00000000013B9485ULL,
-    0x00000000013B94A4ULL,
-    0x00000000013B94ACULL,
-    0x00000000013B94B0ULL,
-    0x00000000013B94B2ULL,
-    0x00000000013B94B3ULL,
-    0x00000000013B94B4ULL,
-    0x00000000013B9532ULL,
-    0x00000000013B958CULL,
-    0x00000000013B9594ULL,
-    0x00000000013B9614ULL,
-    0x00000000013B9646ULL,
-    0x00000000013B9733ULL,
-    0x00000000013BA4B3ULL,
-    0x00000000013BA4D4ULL,
-    0x00000000013BA4F3ULL,
-    0x00000000013BA585ULL,
-    0x00000000013BA58CULL,
-    0x00000000013BA5B3ULL,
-    0x00000000013BA5C5ULL,
-    0x00000000013BA5C7ULL,
-    0x00000000013BA5CBULL,
-    0x00000000013BA605ULL,
-    0x00000000013BA645ULL,
-    0x00000000013BA64CULL,
-    0x00000000013BA668ULL,
-    0x00000000013BA673ULL,
-    0x00000000013BA688ULL,
-    0x00000000013BA693ULL,
-    0x00000000013BA6C5ULL,
-    0x00000000013BA75AULL,
-    0x00000000013BBC53ULL,
-    0x00000000013BBD85ULL,
-    0x00000000013BBD8EULL,
-    0x00000000013BBDEEULL,
-    0x00000000013BBDF0ULL,
-    0x00000000013BBE13ULL,
-    0x00000000013BBE14ULL,
-    0x00000000013BBE44ULL,
-    0x00000000013BBE45ULL,
-    0x00000000013BBE4EULL,
-    0x00000000013BBE93ULL,
-    0x00000000013BBEAEULL,
-    0x00000000013BD5C7ULL,
-    0x00000000013C8845ULL,
-    0x00000000013C892CULL,
-    0x00000000013C89E5ULL,
-    0x00000000013C89F7ULL,
-    0x00000000013C8CA5ULL,
-    0x00000000013C8CB3ULL,
-    0x00000000013C8DEEULL,
-    0x00000000013C95D3ULL,
-    0x00000000013CACB2ULL,
-    0x00000000013CACB3ULL,
-    0x00000000013CB133ULL,
-    0x00000000013CB208ULL,
-    0x00000000013CB2C1ULL,
-    0x00000000013CB432ULL,
-    0x00000000013CB868ULL,
-    0x00000000013CB873ULL,
-    0x00000000013CB893ULL,
-    0x00000000013CB8A4ULL,
-    0x00000000013CB8B3ULL,
-    0x00000000013CB9E4ULL,
-    0x00000000013CBA88ULL,
-    0x00000000013CC0A4ULL,
-    0x00000000013CC0B3ULL,
-    0x00000000013CC113ULL,
-    0x00000000013CC828ULL,
-    0x00000000013CC8AEULL,
-    0x00000000013CCAB0ULL,
-    0x00000000013CCDF0ULL,
-    0x00000000013CD105ULL,
-    0x00000000013CD8B2ULL,
-    0x0000000001408593ULL,
-    0x0000000001408681ULL,
-    0x0000000001408859ULL,
-    0x00000000014088B2ULL,
-    0x00000000014088B3ULL,
-    0x0000000001408924ULL,
-    0x0000000001408933ULL,
-    0x0000000001408981ULL,
-    0x0000000001408985ULL,
-    0x00000000014089EFULL,
-    0x00000000014089F2ULL,
-    0x0000000001408AAEULL,
-    0x0000000001408AB3ULL,
-    0x0000000001408C2EULL,
-    0x0000000001408CB3ULL,
-    0x0000000001408CB4ULL,
-    0x0000000001408D05ULL,
-    0x0000000001408D0FULL,
-    0x0000000001408D13ULL,
-    0x0000000001408D34ULL,
-    0x0000000001408D73ULL,
-    0x0000000001408D79ULL,
-    0x0000000001408DF3ULL,
-    0x0000000001408E93ULL,
-    0x0000000001409593ULL,
-    0x00000000014098D9ULL,
-    0x0000000001409921ULL,
-    0x0000000001409CF9ULL,
-    0x0000000001409DA1ULL,
-    0x000000000140A033ULL,
-    0x000000000140A253ULL,
-    0x000000000140A4E1ULL,
-    0x000000000140A4F3ULL,
-    0x000000000140A56FULL,
-    0x000000000140A593ULL,
-    0x000000000140A5D3ULL,
-    0x000000000140A5D4ULL,
-    0x000000000140A641ULL,
-    0x000000000140A668ULL,
-    0x000000000140A693ULL,
-    0x000000000140A8B3ULL,
-    0x000000000140AC33ULL,
-    0x000000000140ACAEULL,
-    0x000000000140ACB2ULL,
-    0x000000000140ACB3ULL,
-    0x000000000140AD09ULL,
-    0x000000000140AD2EULL,
-    0x000000000140AD33ULL,
-    0x000000000140AD79ULL,
-    0x000000000140B02BULL,
-    0x000000000140B031ULL,
-    0x000000000140B032ULL,
-    0x000000000140B033ULL,
-    0x000000000140B073ULL,
-    0x000000000140B079ULL,
-    0x000000000140B0A1ULL,
-    0x000000000140B0B2ULL,
-    0x000000000140B0B3ULL,
-    0x000000000140B173ULL,
-    0x000000000140B179ULL,
-    0x000000000140B193ULL,
-    0x000000000140B199ULL,
-    0x000000000140B1A1ULL,
-    0x000000000140B1EEULL,
-    0x000000000140B201ULL,
-    0x000000000140B2ABULL,
-    0x000000000140B2B3ULL,
-    0x000000000140B42CULL,
-    0x000000000140B4A4ULL,
-    0x000000000140B4B2ULL,
-    0x000000000140B4B3ULL,
-    0x000000000140B52EULL,
-    0x000000000140B533ULL,
-    0x000000000140B5B9ULL,
-    0x000000000140B613ULL,
-    0x000000000140B833ULL,
-    0x000000000140B8E1ULL,
-    0x000000000140B8E9ULL,
-    0x000000000140B8EFULL,
-    0x000000000140B8F3ULL,
-    0x000000000140B8F9ULL,
-    0x000000000140B913ULL,
-    0x000000000140B961ULL,
-    0x000000000140B973ULL,
-    0x000000000140B979ULL,
-    0x000000000140B9C1ULL,
-    0x000000000140BA79ULL,
-    0x000000000140BA89ULL,
-    0x000000000140BA8FULL,
-    0x000000000140BA99ULL,
-    0x000000000140C033ULL,
-    0x000000000140C0A4ULL,
-    0x000000000140C0AEULL,
-    0x000000000140C0B2ULL,
-    0x000000000140C0B3ULL,
-    0x000000000140C0B4ULL,
-    0x000000000140C132ULL,
-    0x000000000140C133ULL,
-    0x000000000140C201ULL,
-    0x000000000140C2B3ULL,
-    0x000000000140C833ULL,
-    0x000000000140C88FULL,
-    0x000000000140C899ULL,
-    0x000000000140C8A4ULL,
-    0x000000000140C8B3ULL,
-    0x000000000140C8E1ULL,
-    0x000000000140C8E5ULL,
-    0x000000000140C9D3ULL,
-    0x000000000140C9E3ULL,
-    0x000000000140C9EBULL,
-    0x000000000140C9F3ULL,
-    0x000000000140C9F4ULL,
-    0x000000000140CA13ULL,
-    0x000000000140CA45ULL,
-    0x000000000140CA59ULL,
-    0x000000000140CA69ULL,
-    0x000000000140CA93ULL,
-    0x000000000140CA99ULL,
-    0x000000000140CC32ULL,
-    0x000000000140CCA4ULL,
-    0x000000000140CCB2ULL,
-    0x000000000140CCB3ULL,
-    0x000000000140CD73ULL,
-    0x000000000140CE61ULL,
-    0x000000000140CE65ULL,
-    0x000000000140CE6FULL,
-    0x000000000140CE85ULL,
-    0x000000000140CE99ULL,
-    0x000000000140D032ULL,
-    0x000000000140D0B2ULL,
-    0x000000000140D0B3ULL,
-    0x000000000140D113ULL,
-    0x000000000140D125ULL,
-    0x000000000140D1F5ULL,
-    0x000000000140D293ULL,
-    0x000000000140D299ULL,
-    0x000000000140D2B3ULL,
-    0x000000000140D445ULL,
-    0x000000000140D584ULL,
-    0x000000000140D5D4ULL,
-    0x000000000140D5EEULL,
-    0x000000000140D605ULL,
-    0x000000000140D693ULL,
-    0x000000000140D828ULL,
-    0x000000000140D833ULL,
-    0x000000000140D8B2ULL,
-    0x000000000140DC29ULL,
-    0x000000000140DC33ULL,
-    0x000000000140DCA4ULL,
-    0x000000000140DCB2ULL,
-    0x000000000140DD25ULL,
-    0x000000000140DDD9ULL,
-    0x000000000140DE65ULL,
-    0x000000000140DE93ULL,
-    0x000000000140E0A4ULL,
-    0x000000000140E0B2ULL,
-    0x000000000140E0B3ULL,
-    0x000000000140E133ULL,
-    0x000000000140E1ECULL,
-    0x000000000140E1EEULL,
-    0x000000000140E1F2ULL,
-    0x000000000140E2B3ULL,
-    0x000000000140E641ULL,
-    0x000000000140EB41ULL,
-    0x000000000140EB45ULL,
-    0x0000000001428468ULL,
-    0x0000000001428485ULL,
-    0x0000000001428493ULL,
-    0x00000000014284A4ULL,
-    0x0000000001428573ULL,
-    0x0000000001428593ULL,
-    0x00000000014285B3ULL,
-    0x0000000001428653ULL,
-    0x0000000001428659ULL,
-    0x0000000001428665ULL,
-    0x0000000001428693ULL,
-    0x0000000001428745ULL,
-    0x0000000001428D13ULL,
-    0x0000000001428D19ULL,
-    0x0000000001428E81ULL,
-    0x0000000001429099ULL,
-    0x0000000001429593ULL,
-    0x00000000014295B3ULL,
-    0x00000000014295C4ULL,
-    0x00000000014295C5ULL,
-    0x00000000014295D3ULL,
-    0x00000000014295D9ULL,
-    0x0000000001429653ULL,
-    0x0000000001429688ULL,
-    0x00000000014298D3ULL,
-    0x0000000001429CF3ULL,
-    0x0000000001429EA1ULL,
-    0x0000000001429EB3ULL,
-    0x000000000142A253ULL,
-    0x000000000142A524ULL,
-    0x000000000142A593ULL,
-    0x000000000142A5C4ULL,
-    0x000000000142A5D3ULL,
-    0x000000000142B025ULL,
-    0x000000000142B06FULL,
-    0x000000000142B0B3ULL,
-    0x000000000142B0B8ULL,
-    0x000000000142B121ULL,
-    0x000000000142B123ULL,
-    0x000000000142B193ULL,
-    0x000000000142B199ULL,
-    0x000000000142B1E9ULL,
-    0x000000000142B1F3ULL,
-    0x000000000142B4A4ULL,
-    0x000000000142B4B3ULL,
-    0x000000000142B609ULL,
-    0x000000000142B60FULL,
-    0x000000000142B613ULL,
-    0x000000000142B614ULL,
-    0x000000000142B665ULL,
-    0x000000000142B868ULL,
-    0x000000000142B893ULL,
-    0x000000000142B895ULL,
-    0x000000000142B8B3ULL,
-    0x000000000142B8B4ULL,
-    0x000000000142B8E5ULL,
-    0x000000000142B921ULL,
-    0x000000000142B9C5ULL,
-    0x000000000142B9CFULL,
-    0x000000000142B9D9ULL,
-    0x000000000142B9EEULL,
-    0x000000000142B9F2ULL,
-    0x000000000142BA65ULL,
-    0x000000000142BA88ULL,
-    0x000000000142BA93ULL,
-    0x000000000142BA99ULL,
-    0x000000000142BAA5ULL,
-    0x000000000142C02CULL,
-    0x000000000142C033ULL,
-    0x000000000142C0A5ULL,
-    0x000000000142C124ULL,
-    0x000000000142C1F9ULL,
-    0x000000000142C829ULL,
-    0x000000000142C833ULL,
-    0x000000000142C865ULL,
-    0x000000000142C8ABULL,
-    0x000000000142C8B3ULL,
-    0x000000000142C8C5ULL,
-    0x000000000142C8D3ULL,
-    0x000000000142C8E1ULL,
-    0x000000000142C9B3ULL,
-    0x000000000142C9C5ULL,
-    0x000000000142C9D3ULL,
-    0x000000000142CA41ULL,
-    0x000000000142CA59ULL,
-    0x000000000142CA65ULL,
-    0x000000000142CA93ULL,
-    0x000000000142CD81ULL,
-    0x000000000142CE81ULL,
-    0x000000000142CE85ULL,
-    0x000000000142CE93ULL,
-    0x000000000142CE99ULL,
-    0x000000000142D0B3ULL,
-    0x000000000142D113ULL,
-    0x000000000142D241ULL,
-    0x000000000142D249ULL,
-    0x000000000142D468ULL,
-    0x000000000142D4E8ULL,
-    0x000000000142DCA4ULL,
-    0x000000000142DCACULL,
-    0x000000000142DD34ULL,
-    0x000000000142E033ULL,
-    0x000000000142E0B3ULL,
-    0x000000000142E293ULL,
-    0x000000000144046BULL,
-    0x00000000014404E9ULL,
-    0x000000000144052DULL,
-    0x0000000001440585ULL,
-    0x0000000001440589ULL,
-    0x00000000014405C1ULL,
-    0x00000000014405C5ULL,
-    0x00000000014405C7ULL,
-    0x00000000014405CBULL,
-    0x00000000014405D3ULL,
-    0x00000000014405D8ULL,
-    0x000000000144064DULL,
-    0x0000000001440653ULL,
-    0x00000000014406F3ULL,
-    0x00000000014406F9ULL,
-    0x0000000001441445ULL,
-    0x0000000001441461ULL,
-    0x00000000014414A4ULL,
-    0x00000000014414ABULL,
-    0x00000000014414B3ULL,
-    0x00000000014414D4ULL,
-    0x00000000014414EEULL,
-    0x0000000001441523ULL,
-    0x000000000144152EULL,
-    0x0000000001441532ULL,
-    0x0000000001441586ULL,
-    0x00000000014415A1ULL,
-    0x00000000014415A5ULL,
-    0x00000000014415D3ULL,
-    0x00000000014415F7ULL,
-    0x0000000001441645ULL,
-    0x000000000144164DULL,
-    0x0000000001441665ULL,
-    0x0000000001441670ULL,
-    0x0000000001441681ULL,
-    0x0000000001441685ULL,
-    0x00000000014416F3ULL,
-    0x00000000014416F9ULL,
-    0x000000000144246BULL,
-    0x00000000014424A6ULL,
-    0x00000000014424E8ULL,
-    0x00000000014424F3ULL,
-    0x000000000144258BULL,
-    0x000000000144258CULL,
-    0x00000000014425C5ULL,
-    0x00000000014425C7ULL,
-    0x00000000014425CBULL,
-    0x00000000014425D3ULL,
-    0x00000000014425ECULL,
-    0x0000000001442644ULL,
-    0x000000000144264CULL,
-    0x0000000001443CD4ULL,
-    0x0000000001443D85ULL,
-    0x0000000001443D89ULL,
-    0x0000000001443DC7ULL,
-    0x0000000001443E4EULL,
-    0x0000000001443E4FULL,
-    0x0000000001443E50ULL,
-    0x0000000001443E65ULL,
-    0x0000000001443EB3ULL,
-    0x0000000001443EECULL,
-    0x0000000001444825ULL,
-    0x0000000001444837ULL,
-    0x00000000014448A5ULL,
-    0x00000000014448B7ULL,
-    0x0000000001444924ULL,
-    0x0000000001444930ULL,
-    0x00000000014449E2ULL,
-    0x00000000014449E5ULL,
-    0x00000000014449F7ULL,
-    0x0000000001444AADULL,
-    0x0000000001445493ULL,
-    0x00000000014454F3ULL,
-    0x0000000001445541ULL,
-    0x00000000014455A2ULL,
-    0x00000000014455B0ULL,
-    0x00000000014455CBULL,
-    0x000000000144564CULL,
-    0x0000000001445721ULL,
-    0x00000000014465A5ULL,
-    0x00000000014465A9ULL,
-    0x00000000014465B9ULL,
-    0x00000000014485D3ULL,
-    0x0000000001448641ULL,
-    0x0000000001448653ULL,
-    0x0000000001448921ULL,
-    0x0000000001448C2CULL,
-    0x0000000001448C61ULL,
-    0x0000000001448CA4ULL,
-    0x0000000001448CB3ULL,
-    0x0000000001448D19ULL,
-    0x0000000001448D73ULL,
-    0x0000000001448D79ULL,
-    0x000000000144902CULL,
-    0x0000000001449099ULL,
-    0x00000000014490A4ULL,
-    0x00000000014490B3ULL,
-    0x0000000001449653ULL,
-    0x00000000014498D3ULL,
-    0x00000000014499F3ULL,
-    0x0000000001449A93ULL,
-    0x0000000001449CB2ULL,
-    0x0000000001449CB3ULL,
-    0x0000000001449D14ULL,
-    0x0000000001449DEEULL,
-    0x000000000144AC33ULL,
-    0x000000000144ACB3ULL,
-    0x000000000144AD33ULL,
-    0x000000000144AD61ULL,
-    0x000000000144B02BULL,
-    0x000000000144B085ULL,
-    0x000000000144B0A4ULL,
-    0x000000000144B0B2ULL,
-    0x000000000144B0B3ULL,
-    0x000000000144B193ULL,
-    0x000000000144B199ULL,
-    0x000000000144B288ULL,
-    0x000000000144B293ULL,
-    0x000000000144B44FULL,
-    0x000000000144B4A4ULL,
-    0x000000000144B4B2ULL,
-    0x000000000144B4B3ULL,
-    0x000000000144B524ULL,
-    0x000000000144B5EEULL,
-    0x000000000144B613ULL,
-    0x000000000144B833ULL,
-    0x000000000144B874ULL,
-    0x000000000144B893ULL,
-    0x000000000144B8A1ULL,
-    0x000000000144B8A4ULL,
-    0x000000000144B8B3ULL,
-    0x000000000144B8E5ULL,
-    0x000000000144B8F3ULL,
-    0x000000000144B973ULL,
-    0x000000000144B9D9ULL,
-    0x000000000144BA93ULL,
-    0x000000000144BA99ULL,
-    0x000000000144C133ULL,
-    0x000000000144C219ULL,
-    0x000000000144C279ULL,
-    0x000000000144C8A4ULL,
-    0x000000000144C8B3ULL,
-    0x000000000144C993ULL,
-    0x000000000144C9F3ULL,
-    0x000000000144CA53ULL,
-    0x000000000144D02EULL,
-    0x000000000144D068ULL,
-    0x000000000144D0B2ULL,
-    0x000000000144D105ULL,
-    0x000000000144D133ULL,
-    0x000000000144D185ULL,
-    0x000000000144D245ULL,
-    0x000000000144D299ULL,
-    0x000000000144D2B0ULL,
-    0x000000000144E52EULL,
-    0x000000000144E5D3ULL,
-    0x000000000144E8B3ULL,
-    0x000000000144EB59ULL,
-    0x0000000001478493ULL,
-    0x0000000001478499ULL,
-    0x0000000001478674ULL,
-    0x0000000001478745ULL,
-    0x0000000001478D73ULL,
-    0x0000000001478D79ULL,
-    0x0000000001478DF3ULL,
-    0x0000000001479039ULL,
-    0x0000000001479085ULL,
-    0x0000000001479099ULL,
-    0x0000000001479433ULL,
-    0x00000000014798D3ULL,
-    0x00000000014798D9ULL,
-    0x0000000001479A93ULL,
-    0x0000000001479AB3ULL,
-    0x0000000001479C25ULL,
-    0x0000000001479C33ULL,
-    0x0000000001479CA4ULL,
-    0x0000000001479CB3ULL,
-    0x0000000001479EA5ULL,
-    0x000000000147A1F3ULL,
-    0x000000000147A585ULL,
-    0x000000000147A593ULL,
-    0x000000000147A5C7ULL,
-    0x000000000147A665ULL,
-    0x000000000147A693ULL,
-    0x000000000147AC39ULL,
-    0x000000000147ACA4ULL,
-    0x000000000147ACAEULL,
-    0x000000000147ACB2ULL,
-    0x000000000147ACB3ULL,
-    0x000000000147ADF3ULL,
-    0x000000000147B02EULL,
-    0x000000000147B032ULL,
-    0x000000000147B033ULL,
-    0x000000000147B0A4ULL,
-    0x000000000147B0B3ULL,
-    0x000000000147B193ULL,
-    0x000000000147B199ULL,
-    0x000000000147B293ULL,
-    0x000000000147B2B3ULL,
-    0x000000000147B32CULL,
-    0x000000000147B42EULL,
-    0x000000000147B453ULL,
-    0x000000000147B4B3ULL,
-    0x000000000147B521ULL,
-    0x000000000147B5B9ULL,
-    0x000000000147B5F3ULL,
-    0x000000000147B82CULL,
-    0x000000000147B889ULL,
-    0x000000000147B88FULL,
-    0x000000000147B8A4ULL,
-    0x000000000147B8B2ULL,
-    0x000000000147B8B3ULL,
-    0x000000000147B8B9ULL,
-    0x000000000147B8E1ULL,
-    0x000000000147B8F3ULL,
-    0x000000000147B923ULL,
-    0x000000000147B961ULL,
-    0x000000000147B973ULL,
-    0x000000000147B9C5ULL,
-    0x000000000147BAB3ULL,
-    0x000000000147BD93ULL,
-    0x000000000147BDB3ULL,
-    0x000000000147BDD3ULL,
-    0x000000000147BE88ULL,
-    0x000000000147BE93ULL,
-    0x000000000147C03AULL,
-    0x000000000147C0A4ULL,
-    0x000000000147C0A5ULL,
-    0x000000000147C0ABULL,
-    0x000000000147C0B2ULL,
-    0x000000000147C0B3ULL,
-    0x000000000147C105ULL,
-    0x000000000147C109ULL,
-    0x000000000147C113ULL,
-    0x000000000147C123ULL,
-    0x000000000147C133ULL,
-    0x000000000147C1E9ULL,
-    0x000000000147C1F3ULL,
-    0x000000000147C219ULL,
-    0x000000000147C6A5ULL,
-    0x000000000147C828ULL,
-    0x000000000147C82EULL,
-    0x000000000147C833ULL,
-    0x000000000147C868ULL,
-    0x000000000147C873ULL,
-    0x000000000147C8B3ULL,
-    0x000000000147C923ULL,
-    0x000000000147C929ULL,
-    0x000000000147C9F3ULL,
-    0x000000000147C9F4ULL,
-    0x000000000147CA53ULL,
-    0x000000000147CA65ULL,
-    0x000000000147CA69ULL,
-    0x000000000147CA6BULL,
-    0x000000000147CA6FULL,
-    0x000000000147CA81ULL,
-    0x000000000147CA85ULL,
-    0x000000000147CA93ULL,
-    0x000000000147CAB3ULL,
-    0x000000000147CC33ULL,
-    0x000000000147CCA4ULL,
-    0x000000000147CCB3ULL,
-    0x000000000147CD19ULL,
-    0x000000000147CE79ULL,
-    0x000000000147D02CULL,
-    0x000000000147D0A4ULL,
-    0x000000000147D0ADULL,
-    0x000000000147D0B2ULL,
-    0x000000000147D0B3ULL,
-    0x000000000147D299ULL,
-    0x000000000147D468ULL,
-    0x000000000147D4E8ULL,
-    0x000000000147D573ULL,
-    0x000000000147D5D3ULL,
-    0x000000000147D653ULL,
-    0x000000000147D665ULL,
-    0x000000000147D679ULL,
-    0x000000000147D693ULL,
-    0x000000000147D745ULL,
-    0x000000000147D759ULL,
-    0x000000000147DCA4ULL,
-    0x000000000147DCACULL,
-    0x000000000147DCB2ULL,
-    0x000000000147DD25ULL,
-    0x000000000147DDD3ULL,
-    0x000000000147DDD9ULL,
-    0x000000000147DE65ULL,
-    0x000000000147DE79ULL,
-    0x000000000147DE93ULL,
-    0x000000000147DF45ULL,
-    0x000000000147DF59ULL,
-    0x000000000147E123ULL,
-    0x000000000147E12EULL,
-    0x000000000147E4A4ULL,
-    0x000000000147E4B2ULL,
-    0x000000000147E5EEULL,
-    0x000000000147E5F3ULL,
-    0x000000000147E8A4ULL,
-    0x000000000147E8B3ULL,
-    0x000000000147E925ULL,
-    0x0000000001490453ULL,
-    0x0000000001490465ULL,
-    0x000000000149046BULL,
-    0x0000000001490474ULL,
-    0x0000000001490485ULL,
-    0x0000000001490493ULL,
-    0x00000000014904E9ULL,
-    0x000000000149052BULL,
-    0x000000000149052CULL,
-    0x000000000149052EULL,
-    0x0000000001490534ULL,
-    0x00000000014905B0ULL,
-    0x00000000014905B3ULL,
-    0x00000000014905CBULL,
-    0x00000000014905D1ULL,
-    0x00000000014905D3ULL,
-    0x00000000014905D4ULL,
-    0x0000000001490605ULL,
-    0x0000000001490613ULL,
-    0x0000000001490614ULL,
-    0x0000000001490668ULL,
-    0x0000000001490673ULL,
-    0x0000000001490693ULL,
-    0x0000000001490694ULL,
-    0x00000000014906C5ULL,
-    0x00000000014906ECULL,
-    0x0000000001490726ULL,
-    0x0000000001490733ULL,
-    0x0000000001491424ULL,
-    0x0000000001491434ULL,
-    0x000000000149146BULL,
-    0x00000000014914A4ULL,
-    0x00000000014914AEULL,
-    0x00000000014914B3ULL,
-    0x00000000014914C1ULL,
-    0x0000000001491526ULL,
-    0x0000000001491573ULL,
-    0x00000000014915A1ULL,
-    0x00000000014915B3ULL,
-    0x00000000014915C4ULL,
-    0x0000000001491673ULL,
-    0x0000000001491674ULL,
-    0x0000000001491693ULL,
-    0x00000000014916F3ULL,
-    0x0000000001491726ULL,
-    0x0000000001491733ULL,
-    0x0000000001492423ULL,
-    0x0000000001492424ULL,
-    0x000000000149242CULL,
-    0x0000000001492445ULL,
-    0x0000000001492465ULL,
-    0x000000000149246BULL,
-    0x0000000001492485ULL,
-    0x00000000014924A4ULL,
-    0x00000000014924B2ULL,
-    0x00000000014924B3ULL,
-    0x00000000014924C6ULL,
-    0x00000000014924EFULL,
-    0x00000000014924F3ULL,
-    0x0000000001492565ULL,
-    0x0000000001492584ULL,
-    0x000000000149258CULL,
-    0x00000000014925B3ULL,
-    0x00000000014925C5ULL,
-    0x00000000014925D3ULL,
-    0x00000000014925ECULL,
-    0x00000000014925F2ULL,
-    0x00000000014925F3ULL,
-    0x0000000001492605ULL,
-    0x0000000001492613ULL,
-    0x0000000001492619ULL,
-    0x0000000001492674ULL,
-    0x0000000001492685ULL,
-    0x0000000001493C24ULL,
-    0x0000000001493C2BULL,
-    0x0000000001493C34ULL,
-    0x0000000001493C6BULL,
-    0x0000000001493C85ULL,
-    0x0000000001493C93ULL,
-    0x0000000001493CF3ULL,
-    0x0000000001493D33ULL,
-    0x0000000001493D65ULL,
-    0x0000000001493D8CULL,
-    0x0000000001493DB0ULL,
-    0x0000000001493DC1ULL,
-    0x0000000001493DC3ULL,
-    0x0000000001493DC5ULL,
-    0x0000000001493DCBULL,
-    0x0000000001493DD3ULL,
-    0x0000000001493DF0ULL,
-    0x0000000001493DFAULL,
-    0x0000000001493E05ULL,
-    0x0000000001493E88ULL,
-    0x0000000001493E93ULL,
-    0x0000000001493EB4ULL,
-    0x0000000001493EC5ULL,
-    0x0000000001493EF3ULL,
-    0x0000000001493F33ULL,
-    0x0000000001495465ULL,
-    0x000000000149546BULL,
-    0x00000000014954A4ULL,
-    0x00000000014954B2ULL,
-    0x00000000014954B3ULL,
-    0x00000000014954EFULL,
-    0x00000000014954F3ULL,
-    0x000000000149558CULL,
-    0x0000000001495599ULL,
-    0x00000000014955B0ULL,
-    0x00000000014955CBULL,
-    0x0000000001495673ULL,
-    0x0000000001495674ULL,
-    0x0000000001495688ULL,
-    0x00000000014964B2ULL,
-    0x0000000001496565ULL,
-    0x00000000014965A1ULL,
-    0x0000000001496613ULL,
-    0x0000000001496674ULL,
-    0x0000000001498485ULL,
-    0x0000000001498489ULL,
-    0x0000000001498653ULL,
-    0x000000000149ACA4ULL,
-    0x000000000149D441ULL,
-    0x000000000149D44FULL,
-    0x00000000014A85D3ULL,
-    0x00000000014A8654ULL,
-    0x00000000014A8688ULL,
-    0x00000000014A8825ULL,
-    0x00000000014A882CULL,
-    0x00000000014A8832ULL,
-    0x00000000014A8833ULL,
-    0x00000000014A8859ULL,
-    0x00000000014A88A4ULL,
-    0x00000000014A88B2ULL,
-    0x00000000014A88B3ULL,
-    0x00000000014A8D73ULL,
-    0x00000000014A9833ULL,
-    0x00000000014A98C5ULL,
-    0x00000000014A98D3ULL,
-    0x00000000014A9A93ULL,
-    0x00000000014A9A99ULL,
-    0x00000000014A9E41ULL,
-    0x00000000014AA585ULL,
-    0x00000000014AA5C1ULL,
-    0x00000000014AA66DULL,
-    0x00000000014AAE95ULL,
-    0x00000000014AB0B3ULL,
-    0x00000000014AB130ULL,
-    0x00000000014AB185ULL,
-    0x00000000014AB201ULL,
-    0x00000000014AB269ULL,
-    0x00000000014AB524ULL,
-    0x00000000014AB5B9ULL,
-    0x00000000014AB5F2ULL,
-    0x00000000014AB613ULL,
-    0x00000000014AB619ULL,
-    0x00000000014AB833ULL,
-    0x00000000014AB893ULL,
-    0x00000000014AB8A4ULL,
-    0x00000000014AB8B2ULL,
-    0x00000000014AB8B3ULL,
-    0x00000000014AB8F3ULL,
-    0x00000000014AB923ULL,
-    0x00000000014AB9D9ULL,
-    0x00000000014AC0ABULL,
-    0x00000000014AC12BULL,
-    0x00000000014AC185ULL,
-    0x00000000014AC6A5ULL,
-    0x00000000014AC84FULL,
-    0x00000000014AC893ULL,
-    0x00000000014AC8D3ULL,
-    0x00000000014AC8D9ULL,
-    0x00000000014AC973ULL,
-    0x00000000014AC9A5ULL,
-    0x00000000014AC9B3ULL,
-    0x00000000014AC9D3ULL,
-    0x00000000014AC9D4ULL,
-    0x00000000014ACA13ULL,
-    0x00000000014ACA53ULL,
-    0x00000000014ACD19ULL,
-    0x00000000014ACD73ULL,
-    0x00000000014ACD79ULL,
-    0x00000000014AD0A5ULL,
-    0x00000000014AD1F2ULL,
-    0x00000000014AD289ULL,
-    0x00000000014AD299ULL,
-    0x00000000014AD2B3ULL,
-    0x00000000014AE0B3ULL,
-    0x00000000014AE4B2ULL,
-    0x00000000014B84B3ULL,
-    0x00000000014B852EULL,
-    0x00000000014B8593ULL,
-    0x00000000014B85C7ULL,
-    0x00000000014B85CBULL,
-    0x00000000014B8693ULL,
-    0x00000000014B8733ULL,
-    0x00000000014B942BULL,
-    0x00000000014B94A4ULL,
-    0x00000000014B94ACULL,
-    0x00000000014B94AEULL,
-    0x00000000014B94B0ULL,
-    0x00000000014B94B2ULL,
-    0x00000000014B94B4ULL,
-    0x00000000014B964BULL,
-    0x00000000014B9650ULL,
-    0x00000000014BA465ULL,
-    0x00000000014BA4B2ULL,
-    0x00000000014BA4F3ULL,
-    0x00000000014BA58CULL,
-    0x00000000014BA594ULL,
-    0x00000000014BA5C5ULL,
-    0x00000000014BA5CBULL,
-    0x00000000014BA5D3ULL,
-    0x00000000014BA5D9ULL,
-    0x00000000014BA645ULL,
-    0x00000000014BA64CULL,
-    0x00000000014BA650ULL,
-    0x00000000014BA674ULL,
-    0x00000000014BA685ULL,
-    0x00000000014BA693ULL,
-    0x00000000014BA714ULL,
-    0x00000000014BBCB2ULL,
-    0x00000000014BE4B2ULL,
-    0x00000000014C94B3ULL,
-    0x00000000014C9653ULL,
-    0x00000000014CA5C7ULL,
-    0x00000000014CA72EULL,
-    0x00000000014CACB3ULL,
-    0x00000000014CB0B2ULL,
-    0x00000000014CB613ULL,
-    0x00000000014CB885ULL,
-    0x00000000014CB8A4ULL,
-    0x00000000014CB8B3ULL,
-    0x00000000014CC02CULL,
-    0x00000000014CC0A4ULL,
-    0x00000000014CC0B3ULL,
-    0x00000000014CC0B9ULL,
-    0x00000000014CC123ULL,
-    0x00000000014CC1F3ULL,
-    0x00000000014CC213ULL,
-    0x00000000014CC28FULL,
-    0x00000000014CC82EULL,
-    0x00000000014CC8A4ULL,
-    0x00000000014CC8B3ULL,
-    0x00000000014CC9F3ULL,
-    0x00000000014CD105ULL,
-    0x00000000014D0653ULL,
-    0x0000000001520593ULL,
-    0x00000000015210B2ULL,
-    0x0000000001523DD3ULL,
-    0x0000000001538589ULL,
-    0x0000000001539CA4ULL,
-    0x000000000154302EULL,
-    0x0000000001545655ULL,
-    0x0000000001558665ULL,
-    0x00000000015605A1ULL,
-    0x00000000015605D3ULL,
-    0x0000000001560CB2ULL,
-    0x00000000015615A1ULL,
-    0x000000000156352EULL,
-    0x0000000001563824ULL,
-    0x0000000001563825ULL,
-    0x0000000001563832ULL,
-    0x0000000001563833ULL,
-    0x000000000156402EULL,
-    0x0000000001565241ULL,
-    0x0000000001565833ULL,
-    0x0000000001566525ULL,
-    0x0000000001566925ULL,
-    0x00000000015685A9ULL,
-    0x00000000015688ACULL,
-    0x00000000015688B2ULL,
-    0x0000000001568985ULL,
-    0x00000000015689F3ULL,
-    0x0000000001568A41ULL,
-    0x0000000001568A45ULL,
-    0x000000000156A423ULL,
-    0x000000000156A42BULL,
-    0x000000000156A431ULL,
-    0x000000000156B428ULL,
-    0x000000000156B433ULL,
-    0x000000000156B4A4ULL,
-    0x000000000156C0A4ULL,
-    0x000000000156C113ULL,
-    0x000000000156C125ULL,
-    0x000000000156C299ULL,
-    0x000000000156C828ULL,
-    0x000000000156C833ULL,
-    0x0000000001570533ULL,
-    0x0000000001570614ULL,
-    0x000000000157064DULL,
-    0x0000000001570659ULL,
-    0x00000000015706B3ULL,
-    0x0000000001570827ULL,
-    0x000000000157082EULL,
-    0x0000000001570832ULL,
-    0x00000000015708A4ULL,
-    0x0000000001570924ULL,
-    0x00000000015709F8ULL,
-    0x0000000001570C30ULL,
-    0x0000000001570CB3ULL,
-    0x0000000001570D21ULL,
-    0x0000000001570D85ULL,
-    0x0000000001570DF3ULL,
-    0x0000000001570DF9ULL,
-    0x0000000001570EB3ULL,
-    0x0000000001570EB4ULL,
-    0x000000000157102DULL,
-    0x00000000015710A5ULL,
-    0x00000000015710B2ULL,
-    0x0000000001571124ULL,
-    0x00000000015711F3ULL,
-    0x00000000015712A5ULL,
-    0x00000000015712A7ULL,
-    0x0000000001571688ULL,
-    0x00000000015718A4ULL,
-    0x0000000001571934ULL,
-    0x0000000001571938ULL,
-    0x0000000001571C27ULL,
-    0x0000000001571CB4ULL,
-    0x0000000001571DE4ULL,
-    0x0000000001571DF4ULL,
-    0x0000000001571EADULL,
-    0x0000000001572034ULL,
-    0x0000000001572130ULL,
-    0x0000000001572461ULL,
-    0x00000000015724D9ULL,
-    0x00000000015725EEULL,
-    0x0000000001572685ULL,
-    0x0000000001572693ULL,
-    0x0000000001572699ULL,
-    0x000000000157282DULL,
-    0x0000000001572CA4ULL,
-    0x0000000001572CB4ULL,
-    0x0000000001572D24ULL,
-    0x0000000001573037ULL,
-    0x0000000001573039ULL,
-    0x00000000015730A4ULL,
-    0x00000000015730B4ULL,
-    0x0000000001573124ULL,
-    0x0000000001573134ULL,
-    0x000000000157342EULL,
-    0x00000000015734B4ULL,
-    0x00000000015734B7ULL,
-    0x0000000001573538ULL,
-    0x0000000001574039ULL,
-    0x00000000015740A7ULL,
-    0x00000000015740AEULL,
-    0x000000000157412EULL,
-    0x00000000015748A4ULL,
-    0x0000000001574924ULL,
-    0x0000000001574927ULL,
-    0x0000000001574930ULL,
-    0x0000000001574C37ULL,
-    0x0000000001574C39ULL,
-    0x0000000001574CA5ULL,
-    0x0000000001574CB4ULL,
-    0x0000000001574CB7ULL,
-    0x0000000001574CB8ULL,
-    0x0000000001574DE4ULL,
-    0x0000000001575038ULL,
-    0x0000000001575125ULL,
-    0x000000000157512CULL,
-    0x000000000157512EULL,
-    0x0000000001575CA4ULL,
-    0x0000000001575CB4ULL,
-    0x0000000001575D34ULL,
-    0x0000000001575DEEULL,
-    0x0000000001576930ULL,
-    0x00000000015809F7ULL,
-    0x0000000001580B25ULL,
-    0x00000000015811F3ULL,
-    0x0000000001581259ULL,
-    0x00000000015815C4ULL,
-    0x00000000015828B4ULL,
-    0x0000000001583039ULL,
-    0x00000000015830A4ULL,
-    0x0000000001583134ULL,
-    0x00000000015840A4ULL,
-    0x00000000015840B2ULL,
-    0x000000000158482EULL,
-    0x0000000001584AAEULL,
-    0x0000000001584CA5ULL,
-    0x0000000001584CB4ULL,
-    0x0000000001584CB9ULL,
-    0x000000000158502BULL,
-    0x00000000015850B2ULL,
-    0x0000000001585125ULL,
-    0x00000000015904A9ULL,
-    0x0000000001590589ULL,
-    0x00000000015905F3ULL,
-    0x0000000001590645ULL,
-    0x0000000001590649ULL,
-    0x0000000001590665ULL,
-    0x0000000001590685ULL,
-    0x000000000159082EULL,
-    0x00000000015908B8ULL,
-    0x0000000001590921ULL,
-    0x00000000015910A5ULL,
-    0x000000000159142CULL,
-    0x0000000001591433ULL,
-    0x000000000159148FULL,
-    0x0000000001591523ULL,
-    0x00000000015915C1ULL,
-    0x00000000015915D4ULL,
-    0x0000000001591CA4ULL,
-    0x0000000001591CB2ULL,
-    0x0000000001591CB3ULL,
-    0x000000000159242CULL,
-    0x00000000015925C5ULL,
-    0x0000000001592685ULL,
-    0x000000000159342EULL,
-    0x000000000159382CULL,
-    0x00000000015938A4ULL,
-    0x00000000015940A4ULL,
-    0x0000000001594C25ULL,
-    0x0000000001594D24ULL,
-    0x0000000001594DEEULL,
-    0x0000000001595455ULL,
-    0x0000000001595833ULL,
-    0x00000000015984E5ULL,
-    0x0000000001599653ULL,
-    0x000000000159A0B2ULL,
-    0x000000000159A5C7ULL,
-    0x000000000159B8A1ULL,
-    0x000000000159C6A5ULL,
-    0x000000000159D42CULL,
-    0x000000000159D645ULL,
-    0x000000000159D650ULL,
-    0x000000000159D659ULL,
-    0x00000000015A1649ULL,
-    0x00000000015A2585ULL,
-    0x00000000015A50B2ULL,
-    0x00000000015B142CULL,
-    0x00000000015B1433ULL,
-    0x00000000015B5581ULL,
-    0x0000000001608EA1ULL,
-    0x00000000016090A4ULL,
-    0x00000000016090B3ULL,
-    0x0000000001609C2CULL,
-    0x0000000001609EA5ULL,
-    0x0000000001609EB3ULL,
-    0x000000000160A593ULL,
-    0x000000000160A645ULL,
-    0x000000000160A653ULL,
-    0x000000000160A659ULL,
-    0x000000000160AC33ULL,
-    0x000000000160AD2CULL,
-    0x000000000160B0B3ULL,
-    0x000000000160B0B4ULL,
-    0x000000000160B124ULL,
-    0x000000000160B133ULL,
-    0x000000000160B1F2ULL,
-    0x000000000160B265ULL,
-    0x000000000160B2A5ULL,
-    0x000000000160B2C5ULL,
-    0x000000000160B613ULL,
-    0x000000000160B619ULL,
-    0x000000000160B881ULL,
-    0x000000000160B8A4ULL,
-    0x000000000160B8B3ULL,
-    0x000000000160B8F3ULL,
-    0x000000000160BA93ULL,
-    0x000000000160C0A4ULL,
-    0x000000000160C0B2ULL,
-    0x000000000160C0B3ULL,
-    0x000000000160C124ULL,
-    0x000000000160C1F2ULL,
-    0x000000000160C82EULL,
-    0x000000000160C833ULL,
-    0x000000000160C899ULL,
-    0x000000000160C8A3ULL,
-    0x000000000160C8B3ULL,
-    0x000000000160C921ULL,
-    0x000000000160C938ULL,
-    0x000000000160C9C1ULL,
-    0x000000000160CAB3ULL,
-    0x000000000160CAC5ULL,
-    0x000000000160CC2CULL,
-    0x000000000160CCB3ULL,
-    0x000000000160CE93ULL,
-    0x000000000160CE99ULL,
-    0x000000000160D123ULL,
-    0x000000000160D2B3ULL,
-    0x000000000160D468ULL,
-    0x000000000160D594ULL,
-    0x000000000160D5D4ULL,
-    0x000000000160D685ULL,
-    0x000000000160D693ULL,
-    0x000000000160DE85ULL,
-    0x000000000160E0B3ULL,
-    0x0000000001628585ULL,
-    0x0000000001628593ULL,
-    0x0000000001628599ULL,
-    0x00000000016295C1ULL,
-    0x0000000001629613ULL,
-    0x0000000001629653ULL,
-    0x0000000001629659ULL,
-    0x0000000001629C2EULL,
-    0x0000000001629C33ULL,
-    0x0000000001629CB3ULL,
-    0x0000000001629D25ULL,
-    0x0000000001629DF3ULL,
-    0x000000000162A1A5ULL,
-    0x000000000162A593ULL,
-    0x000000000162A599ULL,
-    0x000000000162A5D3ULL,
-    0x000000000162A5D9ULL,
-    0x000000000162B032ULL,
-    0x000000000162B093ULL,
-    0x000000000162B094ULL,
-    0x000000000162B0B3ULL,
-    0x000000000162B193ULL,
-    0x000000000162B2ADULL,
-    0x000000000162B825ULL,
-    0x000000000162B82CULL,
-    0x000000000162B893ULL,
-    0x000000000162B895ULL,
-    0x000000000162B8B9ULL,
-    0x000000000162B8E5ULL,
-    0x000000000162B92EULL,
-    0x000000000162B9EDULL,
-    0x000000000162BA93ULL,
-    0x000000000162BAA5ULL,
-    0x000000000162BAB3ULL,
-    0x000000000162C853ULL,
-    0x000000000162C8E5ULL,
-    0x000000000162CA41ULL,
-    0x000000000162CA59ULL,
-    0x000000000162CA65ULL,
-    0x000000000162CA6FULL,
-    0x000000000162CA74ULL,
-    0x000000000162CA93ULL,
-    0x000000000162CA95ULL,
-    0x000000000162CAC5ULL,
-    0x000000000162CE01ULL,
-    0x000000000162CE81ULL,
-    0x000000000162CE93ULL,
-    0x000000000162D068ULL,
-    0x000000000162E0A4ULL,
-    0x000000000162E0B2ULL,
-    0x000000000162E0B3ULL,
-    0x000000000162E12CULL,
-    0x000000000162E932ULL,
-    0x0000000001648593ULL,
-    0x00000000016485C4ULL,
-    0x00000000016488B3ULL,
-    0x00000000016488B8ULL,
-    0x00000000016488B9ULL,
-    0x0000000001648C32ULL,
-    0x0000000001648CA4ULL,
-    0x0000000001648CB3ULL,
-    0x0000000001648D19ULL,
-    0x00000000016490AFULL,
-    0x0000000001649653ULL,
-    0x00000000016496F3ULL,
-    0x00000000016496F9ULL,
-    0x0000000001649881ULL,
-    0x00000000016498D3ULL,
-    0x0000000001649C33ULL,
-    0x0000000001649D21ULL,
-    0x0000000001649D2CULL,
-    0x0000000001649DF2ULL,
-    0x000000000164B085ULL,
-    0x000000000164B0B2ULL,
-    0x000000000164B181ULL,
-    0x000000000164B189ULL,
-    0x000000000164B193ULL,
-    0x000000000164B4AEULL,
-    0x000000000164B82CULL,
-    0x000000000164B833ULL,
-    0x000000000164B861ULL,
-    0x000000000164B8A4ULL,
-    0x000000000164B8B2ULL,
-    0x000000000164B8B3ULL,
-    0x000000000164B8B7ULL,
-    0x000000000164B923ULL,
-    0x000000000164B9F3ULL,
-    0x000000000164BA93ULL,
-    0x000000000164BB2CULL,
-    0x000000000164BD81ULL,
-    0x000000000164BD84ULL,
-    0x000000000164BD93ULL,
-    0x000000000164C0B2ULL,
-    0x000000000164C82CULL,
-    0x000000000164C8A4ULL,
-    0x000000000164C8AFULL,
-    0x000000000164C8B3ULL,
-    0x000000000164C8E1ULL,
-    0x000000000164C8E5ULL,
-    0x000000000164C924ULL,
-    0x000000000164C993ULL,
-    0x000000000164CA95ULL,
-    0x000000000164CAB3ULL,
-    0x000000000164CC33ULL,
-    0x000000000164CCA4ULL,
-    0x000000000164CCB3ULL,
-    0x000000000164CD25ULL,
-    0x000000000164CD34ULL,
-    0x000000000164CDC5ULL,
-    0x000000000164CDEEULL,
-    0x000000000164CDF2ULL,
-    0x000000000164CE81ULL,
-    0x000000000164CE8FULL,
-    0x000000000164D025ULL,
-    0x000000000164D02CULL,
-    0x000000000164D033ULL,
-    0x000000000164D0B8ULL,
-    0x000000000164D24FULL,
-    0x000000000164D281ULL,
-    0x000000000164D833ULL,
-    0x000000000164D834ULL,
-    0x000000000164D881ULL,
-    0x000000000164D8B2ULL,
-    0x000000000164D8B3ULL,
-    0x000000000164D924ULL,
-    0x000000000164E0AEULL,
-    0x000000000164E932ULL,
-    0x000000000164E9F2ULL,
-    0x0000000001661533ULL,
-    0x00000000016624B3ULL,
-    0x0000000001663CF3ULL,
-    0x0000000001678653ULL,
-    0x0000000001678C22ULL,
-    0x0000000001678C2CULL,
-    0x0000000001678CB3ULL,
-    0x0000000001679099ULL,
-    0x0000000001679161ULL,
-    0x00000000016791F5ULL,
-    0x00000000016792AEULL,
-    0x00000000016795A1ULL,
-    0x0000000001679D25ULL,
-    0x0000000001679EA5ULL,
-    0x000000000167A465ULL,
-    0x000000000167A493ULL,
-    0x000000000167A581ULL,
-    0x000000000167A585ULL,
-    0x000000000167A613ULL,
-    0x000000000167B025ULL,
-    0x000000000167B032ULL,
-    0x000000000167B0A4ULL,
-    0x000000000167B0B3ULL,
-    0x000000000167B0B4ULL,
-    0x000000000167B173ULL,
-    0x000000000167B281ULL,
-    0x000000000167B285ULL,
-    0x000000000167B289ULL,
-    0x000000000167B293ULL,
-    0x000000000167B2C1ULL,
-    0x000000000167B2C5ULL,
-    0x000000000167B4B2ULL,
-    0x000000000167B534ULL,
-    0x000000000167D0A4ULL,
-    0x000000000167D0B2ULL,
-    0x000000000167D0B3ULL,
-    0x000000000167D468ULL,
-    0x000000000167D4E5ULL,
-    0x000000000167D595ULL,
-    0x000000000167DCA4ULL,
-    0x000000000167DCACULL,
-    0x000000000167DCB2ULL,
-    0x000000000167E0ACULL,
-    0x000000000167E904ULL,
-    0x0000000001690523ULL,
-    0x0000000001692593ULL,
-    0x0000000001693DEDULL,
-    0x0000000001693EB3ULL,
-    0x0000000001693EB7ULL,
-    0x0000000001693EF3ULL,
-    0x00000000016A9CF3ULL,
-    0x00000000016A9CF9ULL,
-    0x00000000016A9D13ULL,
-    0x00000000016A9D19ULL,
-    0x00000000016AB0EFULL,
-    0x00000000016AB1D3ULL,
-    0x00000000016AB2C1ULL,
-    0x00000000016AD299ULL,
-    0x00000000016CA5C7ULL,
-    0x0000000001708473ULL,
-    0x0000000001708D65ULL,
-    0x0000000001708D6FULL,
-    0x0000000001708D73ULL,
-    0x0000000001708D79ULL,
-    0x0000000001709093ULL,
-    0x0000000001709099ULL,
-    0x00000000017090A4ULL,
-    0x00000000017090B2ULL,
-    0x00000000017090B3ULL,
-    0x00000000017090E5ULL,
-    0x0000000001709133ULL,
-    0x0000000001709293ULL,
-    0x00000000017098B2ULL,
-    0x00000000017098D3ULL,
-    0x0000000001709A93ULL,
-    0x0000000001709CA4ULL,
-    0x0000000001709CB2ULL,
-    0x0000000001709CB3ULL,
-    0x0000000001709CE1ULL,
-    0x0000000001709DEEULL,
-    0x0000000001709F35ULL,
-    0x000000000170A1EFULL,
-    0x000000000170A485ULL,
-    0x000000000170A4D3ULL,
-    0x000000000170A4D4ULL,
-    0x000000000170A593ULL,
-    0x000000000170A5D3ULL,
-    0x000000000170A653ULL,
-    0x000000000170A674ULL,
-    0x000000000170A685ULL,
-    0x000000000170A693ULL,
-    0x000000000170A6C5ULL,
-    0x000000000170AC33ULL,
-    0x000000000170ACA4ULL,
-    0x000000000170ACAEULL,
-    0x000000000170ACB2ULL,
-    0x000000000170ACB3ULL,
-    0x000000000170ACD3ULL,
-    0x000000000170B08FULL,
-    0x000000000170B093ULL,
-    0x000000000170B0A4ULL,
-    0x000000000170B0B2ULL,
-    0x000000000170B0B3ULL,
-    0x000000000170B125ULL,
-    0x000000000170B133ULL,
-    0x000000000170B173ULL,
-    0x000000000170B181ULL,
-    0x000000000170B193ULL,
-    0x000000000170B199ULL,
-    0x000000000170B299ULL,
-    0x000000000170B29AULL,
-    0x000000000170B4A4ULL,
-    0x000000000170B4B3ULL,
-    0x000000000170B6B3ULL,
-    0x000000000170B893ULL,
-    0x000000000170B8A4ULL,
-    0x000000000170B8B3ULL,
-    0x000000000170B8B9ULL,
-    0x000000000170B8F3ULL,
-    0x000000000170B973ULL,
-    0x000000000170B979ULL,
-    0x000000000170B985ULL,
-    0x000000000170B999ULL,
-    0x000000000170B9C1ULL,
-    0x000000000170BA93ULL,
-    0x000000000170BA99ULL,
-    0x000000000170BB45ULL,
-    0x000000000170C4D3ULL,
-    0x000000000170C853ULL,
-    0x000000000170C859ULL,
-    0x000000000170C893ULL,
-    0x000000000170C8A4ULL,
-    0x000000000170C8B3ULL,
-    0x000000000170C8BAULL,
-    0x000000000170C973ULL,
-    0x000000000170C9B3ULL,
-    0x000000000170C9D3ULL,
-    0x000000000170CA13ULL,
-    0x000000000170CA45ULL,
-    0x000000000170CA74ULL,
-    0x000000000170CA93ULL,
-    0x000000000170CA99ULL,
-    0x000000000170CCB3ULL,
-    0x000000000170CD19ULL,
-    0x000000000170CDB3ULL,
-    0x000000000170CE13ULL,
-    0x000000000170CE19ULL,
-    0x000000000170CE85ULL,
-    0x000000000170CE93ULL,
-    0x000000000170D030ULL,
-    0x000000000170D068ULL,
-    0x000000000170D0B2ULL,
-    0x000000000170D293ULL,
-    0x000000000170D4C6ULL,
-    0x000000000170D4E8ULL,
-    0x000000000170D573ULL,
-    0x000000000170D58BULL,
-    0x000000000170D593ULL,
-    0x000000000170D653ULL,
-    0x000000000170D8A4ULL,
-    0x000000000170D8B2ULL,
-    0x000000000170D8B3ULL,
-    0x000000000170D8B9ULL,
-    0x000000000170DC33ULL,
-    0x000000000170DCB3ULL,
-    0x000000000170DD93ULL,
-    0x000000000170E0A4ULL,
-    0x000000000170E0AEULL,
-    0x000000000170E0B2ULL,
-    0x000000000170E0B3ULL,
-    0x000000000170E4A4ULL,
-    0x000000000170E932ULL,
-    0x000000000170E9EFULL,
-    0x0000000001728584ULL,
-    0x0000000001728593ULL,
-    0x00000000017285A2ULL,
-    0x00000000017285D3ULL,
-    0x0000000001728653ULL,
-    0x0000000001728659ULL,
-    0x00000000017286C5ULL,
-    0x0000000001728859ULL,
-    0x00000000017288B2ULL,
-    0x0000000001728D14ULL,
-    0x00000000017290ACULL,
-    0x00000000017290E5ULL,
-    0x00000000017290F9ULL,
-    0x0000000001729493ULL,
-    0x0000000001729499ULL,
-    0x0000000001729565ULL,
-    0x0000000001729573ULL,
-    0x0000000001729593ULL,
-    0x00000000017295B3ULL,
-    0x00000000017295D3ULL,
-    0x00000000017295D9ULL,
-    0x0000000001729613ULL,
-    0x0000000001729619ULL,
-    0x0000000001729674ULL,
-    0x0000000001729685ULL,
-    0x0000000001729693ULL,
-    0x0000000001729A85ULL,
-    0x0000000001729A93ULL,
-    0x000000000172A493ULL,
-    0x000000000172A4E8ULL,
-    0x000000000172A593ULL,
-    0x000000000172A644ULL,
-    0x000000000172A653ULL,
-    0x000000000172A665ULL,
-    0x000000000172A745ULL,
-    0x000000000172AC33ULL,
-    0x000000000172B068ULL,
-    0x000000000172B093ULL,
-    0x000000000172B165ULL,
-    0x000000000172B173ULL,
-    0x000000000172B174ULL,
-    0x000000000172B193ULL,
-    0x000000000172B199ULL,
-    0x000000000172B268ULL,
-    0x000000000172B293ULL,
-    0x000000000172B453ULL,
-    0x000000000172B893ULL,
-    0x000000000172B8E5ULL,
-    0x000000000172B9D9ULL,
-    0x000000000172BA93ULL,
-    0x000000000172C9F3ULL,
-    0x000000000172CA68ULL,
-    0x000000000172CE93ULL,
-    0x000000000172D033ULL,
-    0x000000000172D199ULL,
-    0x000000000172E0A4ULL,
-    0x000000000172E0B3ULL,
-    0x000000000174046BULL,
-    0x0000000001740585ULL,
-    0x00000000017405AFULL,
-    0x00000000017405B3ULL,
-    0x00000000017405C7ULL,
-    0x0000000001740613ULL,
-    0x0000000001740645ULL,
-    0x0000000001740646ULL,
-    0x0000000001740681ULL,
-    0x0000000001740693ULL,
-    0x00000000017406B0ULL,
-    0x00000000017406B2ULL,
-    0x000000000174142CULL,
-    0x0000000001741432ULL,
-    0x0000000001741434ULL,
-    0x00000000017414ACULL,
-    0x00000000017414AEULL,
-    0x00000000017414B0ULL,
-    0x00000000017414D4ULL,
-    0x000000000174158BULL,
-    0x000000000174158DULL,
-    0x0000000001741590ULL,
-    0x00000000017415D3ULL,
-    0x0000000001741645ULL,
-    0x0000000001741693ULL,
-    0x00000000017416F3ULL,
-    0x0000000001741733ULL,
-    0x0000000001742468ULL,
-    0x0000000001742493ULL,
-    0x00000000017424C6ULL,
-    0x00000000017424D4ULL,
-    0x00000000017424F3ULL,
-    0x0000000001742585ULL,
-    0x000000000174258BULL,
-    0x00000000017425B3ULL,
-    0x00000000017425C5ULL,
-    0x00000000017425D3ULL,
-    0x00000000017425D9ULL,
-    0x00000000017425F3ULL,
-    0x0000000001742613ULL,
-    0x0000000001742614ULL,
-    0x000000000174264CULL,
-    0x0000000001742652ULL,
-    0x0000000001742653ULL,
-    0x0000000001742668ULL,
-    0x000000000174266BULL,
-    0x0000000001742673ULL,
-    0x0000000001742674ULL,
-    0x0000000001742685ULL,
-    0x0000000001742693ULL,
-    0x0000000001742699ULL,
-    0x000000000174275AULL,
-    0x0000000001743D85ULL,
-    0x0000000001743DB0ULL,
-    0x0000000001743DE6ULL,
-    0x0000000001743DF0ULL,
-    0x0000000001743DF4ULL,
-    0x0000000001743E13ULL,
-    0x0000000001743E4CULL,
-    0x0000000001743E54ULL,
-    0x0000000001743E65ULL,
-    0x0000000001743E6FULL,
-    0x0000000001743EF3ULL,
-    0x00000000017455B0ULL,
-    0x0000000001745613ULL,
-    0x0000000001746481ULL,
-    0x0000000001748C61ULL,
-    0x0000000001748D73ULL,
-    0x0000000001748D79ULL,
-    0x0000000001749099ULL,
-    0x00000000017490AEULL,
-    0x00000000017490B2ULL,
-    0x00000000017490B3ULL,
-    0x00000000017491F7ULL,
-    0x0000000001749288ULL,
-    0x0000000001749584ULL,
-    0x0000000001749593ULL,
-    0x00000000017498A4ULL,
-    0x00000000017498B3ULL,
-    0x00000000017498B9ULL,
-    0x0000000001749925ULL,
-    0x0000000001749A99ULL,
-    0x0000000001749C2EULL,
-    0x0000000001749CE1ULL,
-    0x0000000001749CF9ULL,
-    0x0000000001749D14ULL,
-    0x000000000174AD33ULL,
-    0x000000000174B06FULL,
-    0x000000000174B093ULL,
-    0x000000000174B0A4ULL,
-    0x000000000174B0B3ULL,
-    0x000000000174B0E1ULL,
-    0x000000000174B133ULL,
-    0x000000000174B141ULL,
-    0x000000000174B193ULL,
-    0x000000000174B199ULL,
-    0x000000000174B293ULL,
-    0x000000000174B613ULL,
-    0x000000000174B619ULL,
-    0x000000000174B865ULL,
-    0x000000000174B868ULL,
-    0x000000000174B893ULL,
-    0x000000000174B899ULL,
-    0x000000000174B8A4ULL,
-    0x000000000174B8B3ULL,
-    0x000000000174B8B9ULL,
-    0x000000000174B8E5ULL,
-    0x000000000174B8F3ULL,
-    0x000000000174B8F9ULL,
-    0x000000000174B973ULL,
-    0x000000000174B9C1ULL,
-    0x000000000174B9D3ULL,
-    0x000000000174B9F3ULL,
-    0x000000000174BB45ULL,
-    0x000000000174C0A4ULL,
-    0x000000000174C0B2ULL,
-    0x000000000174C0B3ULL,
-    0x000000000174C8A4ULL,
-    0x000000000174C8B2ULL,
-    0x000000000174C8B3ULL,
-    0x000000000174CA41ULL,
-    0x000000000174CCA4ULL,
-    0x000000000174CCB2ULL,
-    0x000000000174CCB3ULL,
-    0x000000000174CD01ULL,
-    0x000000000174CD14ULL,
-    0x000000000174CE13ULL,
-    0x000000000174CE19ULL,
-    0x000000000174CE93ULL,
-    0x000000000174D02EULL,
-    0x000000000174D068ULL,
-    0x000000000174D0A4ULL,
-    0x000000000174D0B3ULL,
-    0x000000000174D105ULL,
-    0x000000000174D113ULL,
-    0x000000000174D119ULL,
-    0x000000000174D299ULL,
-    0x000000000174D8A4ULL,
-    0x000000000174D8B2ULL,
-    0x000000000174D8B3ULL,
-    0x000000000174E8AEULL,
-    0x000000000174E8B3ULL,
-    0x0000000001778493ULL,
-    0x0000000001778584ULL,
-    0x0000000001778D73ULL,
-    0x00000000017790E5ULL,
-    0x0000000001779AACULL,
-    0x000000000177AAB3ULL,
-    0x000000000177ACAEULL,
-    0x000000000177ACB2ULL,
-    0x000000000177AD61ULL,
-    0x000000000177B093ULL,
-    0x000000000177B0D3ULL,
-    0x000000000177B199ULL,
-    0x000000000177B2C5ULL,
-    0x000000000177B42EULL,
-    0x000000000177B453ULL,
-    0x000000000177B459ULL,
-    0x000000000177B4AEULL,
-    0x000000000177B72EULL,
-    0x000000000177B8E1ULL,
-    0x000000000177B8E9ULL,
-    0x000000000177B973ULL,
-    0x000000000177B979ULL,
-    0x000000000177BA93ULL,
-    0x000000000177BC93ULL,
-    0x000000000177BC99ULL,
-    0x000000000177BCA4ULL,
-    0x000000000177BCB2ULL,
-    0x000000000177BCD3ULL,
-    0x000000000177BCD9ULL,
-    0x000000000177BD84ULL,
-    0x000000000177BD93ULL,
-    0x000000000177BD99ULL,
-    0x000000000177BDD3ULL,
-    0x000000000177BE13ULL,
-    0x000000000177BE19ULL,
-    0x000000000177BE65ULL,
-    0x000000000177BE68ULL,
-    0x000000000177BE9AULL,
-    0x000000000177BF59ULL,
-    0x000000000177C893ULL,
-    0x000000000177C899ULL,
-    0x000000000177C973ULL,
-    0x000000000177C984ULL,
-    0x000000000177C9B3ULL,
-    0x000000000177C9B9ULL,
-    0x000000000177CA59ULL,
-    0x000000000177CA65ULL,
-    0x000000000177CA74ULL,
-    0x000000000177CA88ULL,
-    0x000000000177CA93ULL,
-    0x000000000177D584ULL,
-    0x000000000177D5C4ULL,
-    0x000000000177D8AEULL,
-    0x000000000177DCA4ULL,
-    0x000000000177DCA5ULL,
-    0x000000000177E0AEULL,
-    0x000000000179046BULL,
-    0x00000000017905C7ULL,
-    0x0000000001790613ULL,
-    0x0000000001790614ULL,
-    0x0000000001790674ULL,
-    0x0000000001790685ULL,
-    0x0000000001790688ULL,
-    0x00000000017906ECULL,
-    0x000000000179142BULL,
-    0x000000000179146BULL,
-    0x00000000017915D3ULL,
-    0x0000000001791674ULL,
-    0x000000000179246BULL,
-    0x00000000017924A4ULL,
-    0x00000000017924B2ULL,
-    0x00000000017924B3ULL,
-    0x00000000017925C7ULL,
-    0x0000000001792674ULL,
-    0x0000000001792685ULL,
-    0x0000000001792693ULL,
-    0x0000000001793D65ULL,
-    0x0000000001793DC7ULL,
-    0x0000000001793DF4ULL,
-    0x0000000001793E85ULL,
-    0x0000000001793E88ULL,
-    0x00000000017955C7ULL,
-    0x00000000017964B2ULL,
-    0x0000000001796599ULL,
-    0x00000000017A9099ULL,
-    0x00000000017A92B3ULL,
-    0x00000000017AB193ULL,
-    0x00000000017ACA74ULL,
-    0x00000000017ACCB3ULL,
-    0x00000000017ACD15ULL,
-    0x00000000017ACE79ULL,
-    0x00000000017AE121ULL,
-    0x00000000017CB0A4ULL,
-    0x00000000017CB0B3ULL,
-    0x00000000017CB893ULL,
-    0x00000000017CB9D3ULL,
-    0x00000000017CD0A4ULL,
-    0x00000000017CD0B3ULL,
-    0x00000000018288A3ULL,
-    0x000000000182B921ULL,
-    0x000000000182B923ULL,
-    0x000000000182B9EEULL,
-    0x000000000182C923ULL,
-    0x000000000182C9F8ULL,
-    0x000000000182CAB3ULL,
-    0x00000000018785C1ULL,
-    0x0000000001890733ULL,
-    0x00000000018CB02EULL,
-    0x00000000018CB0ADULL,
-    0x00000000018CB123ULL,
-    0x00000000018CB1ECULL,
-    0x00000000018CB32CULL,
-    0x00000000018CCE89ULL,
-    0x00000000018CCE93ULL,
-    0x0000000001908653ULL,
-    0x0000000001908833ULL,
-    0x0000000001908841ULL,
-    0x0000000001908859ULL,
-    0x0000000001908C61ULL,
-    0x0000000001908D14ULL,
-    0x0000000001908D61ULL,
-    0x0000000001908D73ULL,
-    0x00000000019098D3ULL,
-    0x0000000001909CB2ULL,
-    0x0000000001909CB3ULL,
-    0x0000000001909D33ULL,
-    0x000000000190A1EFULL,
-    0x000000000190A644ULL,
-    0x000000000190AD61ULL,
-    0x000000000190ADF7ULL,
-    0x000000000190B0B3ULL,
-    0x000000000190B4AEULL,
-    0x000000000190B619ULL,
-    0x000000000190B6AEULL,
-    0x000000000190B8F3ULL,
-    0x000000000190B973ULL,
-    0x000000000190C1EBULL,
-    0x000000000190C1EEULL,
-    0x000000000190C213ULL,
-    0x000000000190C219ULL,
-    0x000000000190C82BULL,
-    0x000000000190C86FULL,
-    0x000000000190C893ULL,
-    0x000000000190C8B2ULL,
-    0x000000000190C8C1ULL,
-    0x000000000190C973ULL,
-    0x000000000190C9D3ULL,
-    0x000000000190CA53ULL,
-    0x000000000190CA81ULL,
-    0x000000000190CA8FULL,
-    0x000000000190D0B3ULL,
-    0x000000000190D493ULL,
-    0x000000000190D584ULL,
-    0x000000000190D613ULL,
-    0x000000000190DCA4ULL,
-    0x000000000190DCB9ULL,
-    0x000000000190DD93ULL,
-    0x000000000190DDD3ULL,
-    0x000000000190DDD9ULL,
-    0x000000000190DE13ULL,
-    0x0000000001913E45ULL,
-    0x000000000191B024ULL,
-    0x000000000191B0A4ULL,
-    0x000000000191BDC4ULL,
-    0x0000000001924824ULL,
-    0x00000000019248A4ULL,
-    0x0000000001928493ULL,
-    0x0000000001928513ULL,
-    0x000000000192858DULL,
-    0x00000000019285D3ULL,
-    0x0000000001928644ULL,
-    0x000000000192864EULL,
-    0x0000000001928653ULL,
-    0x0000000001928674ULL,
-    0x0000000001928C68ULL,
-    0x0000000001928D13ULL,
-    0x0000000001928D19ULL,
-    0x00000000019290B3ULL,
-    0x0000000001929493ULL,
-    0x0000000001929668ULL,
-    0x0000000001929CF3ULL,
-    0x000000000192B173ULL,
-    0x000000000192B193ULL,
-    0x000000000192B1B3ULL,
-    0x000000000192B213ULL,
-    0x000000000192B293ULL,
-    0x000000000192BA81ULL,
-    0x000000000192BA85ULL,
-    0x000000000192C841ULL,
-    0x000000000192C893ULL,
-    0x000000000192C973ULL,
-    0x000000000192CCB3ULL,
-    0x000000000192CD73ULL,
-    0x000000000192CE93ULL,
-    0x000000000192CE99ULL,
-    0x000000000192D133ULL,
-    0x000000000192D293ULL,
-    0x000000000192D573ULL,
-    0x000000000192D579ULL,
-    0x000000000192D8AEULL,
-    0x000000000192D8B3ULL,
-    0x000000000192DCAEULL,
-    0x000000000192E0A4ULL,
-    0x000000000192E0B3ULL,
-    0x0000000001931645ULL,
-    0x0000000001949584ULL,
-    0x000000000194ACA4ULL,
-    0x000000000194ACB3ULL,
-    0x000000000194B193ULL,
-    0x000000000194B865ULL,
-    0x000000000194C0B3ULL,
-    0x000000000194C219ULL,
-    0x000000000194C893ULL,
-    0x000000000194C973ULL,
-    0x000000000194CA53ULL,
-    0x000000000194CA88ULL,
-    0x000000000194D0B3ULL,
-    0x000000000194D125ULL,
-    0x00000000019615B3ULL,
-    0x0000000001962565ULL,
-    0x0000000001962CB3ULL,
-    0x000000000196BD94ULL,
-    0x000000000196C0B3ULL,
-    0x000000000197884FULL,
-    0x0000000001978859ULL,
-    0x0000000001978D73ULL,
-    0x00000000019790ACULL,
-    0x0000000001979113ULL,
-    0x0000000001979185ULL,
-    0x0000000001979C33ULL,
-    0x0000000001979CA5ULL,
-    0x0000000001979D13ULL,
-    0x0000000001979D23ULL,
-    0x0000000001979D2EULL,
-    0x0000000001979D33ULL,
-    0x000000000197A46BULL,
-    0x000000000197A82EULL,
-    0x000000000197ACA4ULL,
-    0x000000000197ACACULL,
-    0x000000000197ACB2ULL,
-    0x000000000197ACB3ULL,
-    0x000000000197AEACULL,
-    0x000000000197B173ULL,
-    0x000000000197B179ULL,
-    0x000000000197B52DULL,
-    0x000000000197B613ULL,
-    0x000000000197B923ULL,
-    0x000000000197B933ULL,
-    0x000000000197B973ULL,
-    0x000000000197BCD3ULL,
-    0x000000000197BE13ULL,
-    0x000000000197C8B3ULL,
-    0x000000000197C973ULL,
-    0x000000000197CA13ULL,
-    0x000000000197D573ULL,
-    0x000000000197D5C7ULL,
-    0x000000000197D64EULL,
-    0x000000000197D653ULL,
-    0x000000000197D654ULL,
-    0x000000000197D665ULL,
-    0x000000000197D688ULL,
-    0x000000000197DCA4ULL,
-    0x000000000197DCB3ULL,
-    0x000000000197DD25ULL,
-    0x000000000197DD93ULL,
-    0x000000000197DF41ULL,
-    0x0000000001990614ULL,
-    0x00000000019915D4ULL,
-    0x00000000019926C4ULL,
-    0x00000000019938A8ULL,
-    0x00000000019985A5ULL,
-    0x00000000019A3E74ULL,
-    0x00000000019A85D3ULL,
-    0x00000000019A8C33ULL,
-    0x00000000019A8C61ULL,
-    0x00000000019A8C68ULL,
-    0x00000000019A8D6FULL,
-    0x00000000019A8D73ULL,
-    0x00000000019A8D79ULL,
-    0x00000000019A9A93ULL,
-    0x00000000019A9C33ULL,
-    0x00000000019AACA4ULL,
-    0x00000000019AACB3ULL,
-    0x00000000019AAD79ULL,
-    0x00000000019AADF3ULL,
-    0x00000000019AB02EULL,
-    0x00000000019AB0B3ULL,
-    0x00000000019AB5AFULL,
-    0x00000000019AB5B9ULL,
-    0x00000000019AB613ULL,
-    0x00000000019AC1EEULL,
-    0x00000000019AC219ULL,
-    0x00000000019ACA81ULL,
-    0x00000000019ACA93ULL,
-    0x00000000019AEAB3ULL,
-    0x0000000001A08A41ULL,
-    0x0000000001A08D73ULL,
-    0x0000000001A0A481ULL,
-    0x0000000001A0A499ULL,
-    0x0000000001A0A645ULL,
-    0x0000000001A0AC34ULL,
-    0x0000000001A0B42EULL,
-    0x0000000001A0B44FULL,
-    0x0000000001A0B521ULL,
-    0x0000000001A0B941ULL,
-    0x0000000001A0BA85ULL,
-    0x0000000001A0BB41ULL,
-    0x0000000001A0BB45ULL,
-    0x0000000001A0C219ULL,
-    0x0000000001A0C8D3ULL,
-    0x0000000001A0C933ULL,
-    0x0000000001A0D133ULL,
-    0x0000000001A0E0B3ULL,
-    0x0000000001A0E52EULL,
-    0x0000000001A0E8AEULL,
-    0x0000000001A28593ULL,
-    0x0000000001A288A3ULL,
-    0x0000000001A28A41ULL,
-    0x0000000001A28AA2ULL,
-    0x0000000001A28AB3ULL,
-    0x0000000001A29033ULL,
-    0x0000000001A2A5D3ULL,
-    0x0000000001A2B88FULL,
-    0x0000000001A2C881ULL,
-    0x0000000001A2C973ULL,
-    0x0000000001A2C9F3ULL,
-    0x0000000001A2CE93ULL,
-    0x0000000001A2CE99ULL,
-    0x0000000001A2D033ULL,
-    0x0000000001A2E0B3ULL,
-    0x0000000001A2E8B3ULL,
-    0x0000000001A43DAFULL,
-    0x0000000001A488B4ULL,
-    0x0000000001A498D3ULL,
-    0x0000000001A49C2EULL,
-    0x0000000001A4B033ULL,
-    0x0000000001A4B068ULL,
-    0x0000000001A4B181ULL,
-    0x0000000001A4B193ULL,
-    0x0000000001A4B449ULL,
-    0x0000000001A4B453ULL,
-    0x0000000001A4B86FULL,
-    0x0000000001A4B873ULL,
-    0x0000000001A4B879ULL,
-    0x0000000001A4B8A2ULL,
-    0x0000000001A4B8B3ULL,
-    0x0000000001A4B8F3ULL,
-    0x0000000001A4B8F9ULL,
-    0x0000000001A4B965ULL,
-    0x0000000001A4B979ULL,
-    0x0000000001A4C20FULL,
-    0x0000000001A4C219ULL,
-    0x0000000001A4C82DULL,
-    0x0000000001A4D133ULL,
-    0x0000000001A4E8ACULL,
-    0x0000000001A4E934ULL,
-    0x0000000001A63E85ULL,
-    0x0000000001A63E99ULL,
-    0x0000000001A784A1ULL,
-    0x0000000001A789F3ULL,
-    0x0000000001A78AB3ULL,
-    0x0000000001A78C6FULL,
-    0x0000000001A79425ULL,
-    0x0000000001A7942CULL,
-    0x0000000001A79433ULL,
-    0x0000000001A7A66DULL,
-    0x0000000001A7A674ULL,
-    0x0000000001A7B449ULL,
-    0x0000000001A7B825ULL,
-    0x0000000001A7B82CULL,
-    0x0000000001A7B881ULL,
-    0x0000000001A7B8A4ULL,
-    0x0000000001A7B8B2ULL,
-    0x0000000001A7B8B3ULL,
-    0x0000000001A7B973ULL,
-    0x0000000001A7BCA1ULL,
-    0x0000000001A7BCB9ULL,
-    0x0000000001A7BD24ULL,
-    0x0000000001A7BD73ULL,
-    0x0000000001A7BDB3ULL,
-    0x0000000001A7BDD3ULL,
-    0x0000000001A7BE99ULL,
-    0x0000000001A7C201ULL,
-    0x0000000001A7C20FULL,
-    0x0000000001A7C92CULL,
-    0x0000000001A7C933ULL,
-    0x0000000001A7CA4FULL,
-    0x0000000001A7D573ULL,
-    0x0000000001A7DCA5ULL,
-    0x0000000001A7DD25ULL,
-    0x0000000001AAB2B3ULL,
-    0x0000000001AAC02EULL,
-    0x0000000001AAC033ULL,
-    0x0000000001AAC201ULL,
-    0x0000000001AAC8D3ULL,
-    0x0000000001AAE92DULL,
-    0x0000000001AC9C2CULL,
-    0x0000000001AC9DEEULL,
-    0x0000000001ACB4B3ULL,
-    0x0000000001ACB523ULL
+constexpr uint32_t kEncodedWords[kWordsCount] = {
+    0x0010A0A4U,
+    0x0010B129U,
+    0x0010C8E8U,
+    0x0010CA89U,
+    0x00110461U,
+    0x00110469U,
+    0x0011046BU,
+    0x00110473U,
+    0x001104D4U,
+    0x00110561U,
+    0x001105B0U,
+    0x001105C4U,
+    0x00110665U,
+    0x00110668U,
+    0x0011066BU,
+    0x00110685U,
+    0x00110721U,
+    0x00110833U,
+    0x001108A4U,
+    0x001108B3U,
+    0x001108B9U,
+    0x001109F4U,
+    0x00110CA5U,
+    0x0011142DU,
+    0x00111432U,
+    0x00111585U,
+    0x00111653U,
+    0x00111693U,
+    0x001121F2U,
+    0x00112485U,
+    0x001124B3U,
+    0x001130A4U,
+    0x001130B2U,
+    0x001130B3U,
+    0x001130B4U,
+    0x001131F7U,
+    0x0011350FU,
+    0x00113C85U,
+    0x00113D0DU,
+    0x00113D2CU,
+    0x00113DA1U,
+    0x00113DEEU,
+    0x00113E44U,
+    0x00113E45U,
+    0x00113E54U,
+    0x00113EB4U,
+    0x00113EC5U,
+    0x0011482DU,
+    0x00114839U,
+    0x0011492DU,
+    0x0011492EU,
+    0x00114933U,
+    0x00114CB9U,
+    0x00114D34U,
+    0x001155C1U,
+    0x001155C5U,
+    0x00115665U,
+    0x00115693U,
+    0x0011575AU,
+    0x001164B3U,
+    0x0011666DU,
+    0x00116673U,
+    0x00118533U,
+    0x00118649U,
+    0x00118C33U,
+    0x00118DF9U,
+    0x00119642U,
+    0x00119653U,
+    0x00119681U,
+    0x0011A032U,
+    0x0011A0A4U,
+    0x0011A0B3U,
+    0x0011A1EFU,
+    0x0011A493U,
+    0x0011A499U,
+    0x0011A5C7U,
+    0x0011A5C9U,
+    0x0011ACA5U,
+    0x0011ACB2U,
+    0x0011B4B3U,
+    0x0011B523U,
+    0x0011B8A4U,
+    0x0011B8B3U,
+    0x0011BC6BU,
+    0x0011BD84U,
+    0x0011BE4EU,
+    0x0011C8A4U,
+    0x0011C8B3U,
+    0x0011C924U,
+    0x0011C9F3U,
+    0x0011D0A4U,
+    0x0011D12EU,
+    0x0011D1EEU,
+    0x0011D1F2U,
+    0x0011D685U,
+    0x0011E593U,
+    0x001204E5U,
+    0x00120614U,
+    0x001206F3U,
+    0x00120733U,
+    0x001209F4U,
+    0x00121038U,
+    0x001210A4U,
+    0x001210B2U,
+    0x0012112FU,
+    0x00121185U,
+    0x001214ADU,
+    0x00121614U,
+    0x0012202EU,
+    0x001224B5U,
+    0x001225F3U,
+    0x00122693U,
+    0x0012342EU,
+    0x001234AEU,
+    0x0012352EU,
+    0x00123534U,
+    0x00123538U,
+    0x00123C45U,
+    0x00123C4FU,
+    0x00123E14U,
+    0x00123E45U,
+    0x00123E4EU,
+    0x00123EEEU,
+    0x00123F45U,
+    0x00124824U,
+    0x001248A4U,
+    0x00124EADU,
+    0x00125569U,
+    0x00125594U,
+    0x001255C3U,
+    0x00125674U,
+    0x001258B7U,
+    0x00126681U,
+    0x001268A4U,
+    0x001268B3U,
+    0x00128D21U,
+    0x001290B3U,
+    0x00129D33U,
+    0x0012BDD3U,
+    0x0012C925U,
+    0x0012C9F3U,
+    0x0012CD32U,
+    0x00130584U,
+    0x00130641U,
+    0x00130653U,
+    0x00131432U,
+    0x00131938U,
+    0x00132645U,
+    0x0013302AU,
+    0x00133DF4U,
+    0x00133E45U,
+    0x00133EACU,
+    0x00134934U,
+    0x001349F3U,
+    0x001350B2U,
+    0x0013852EU,
+    0x001385A1U,
+    0x001385A9U,
+    0x00138605U,
+    0x00138653U,
+    0x00138674U,
+    0x00138685U,
+    0x001386C5U,
+    0x00138745U,
+    0x001395C5U,
+    0x001395D4U,
+    0x00139653U,
+    0x00139CB2U,
+    0x00139D25U,
+    0x00139E49U,
+    0x00139E4FU,
+    0x00139E59U,
+    0x0013A033U,
+    0x0013A581U,
+    0x0013A585U,
+    0x0013A5C7U,
+    0x0013A5F3U,
+    0x0013A66DU,
+    0x0013A674U,
+    0x0013A681U,
+    0x0013B0A5U,
+    0x0013B0B4U,
+    0x0013B0B9U,
+    0x0013B1EFU,
+    0x0013B1F7U,
+    0x0013B2B3U,
+    0x0013B433U,
+    0x0013BCE5U,
+    0x0013BDC5U,
+    0x0013BDD3U,
+    0x0013BDD9U,
+    0x0013BDE4U,
+    0x0013C8A5U,
+    0x0013C921U,
+    0x0013C92EU,
+    0x0013C9F3U,
+    0x0013D4A4U,
+    0x0013D4B3U,
+    0x0013D5C1U,
+    0x0013D689U,
+    0x00141424U,
+    0x00141430U,
+    0x001415D4U,
+    0x001424E8U,
+    0x001425C4U,
+    0x001425C7U,
+    0x001425D4U,
+    0x00143D84U,
+    0x0014558CU,
+    0x00145655U,
+    0x00149033U,
+    0x001490A4U,
+    0x001490B2U,
+    0x001490B3U,
+    0x001491E9U,
+    0x001491F3U,
+    0x00149659U,
+    0x00149C33U,
+    0x00149D14U,
+    0x0014B0A4U,
+    0x0014B4A4U,
+    0x0014B4B2U,
+    0x0014B8A5U,
+    0x0014B8E1U,
+    0x0014BD89U,
+    0x0014C8A4U,
+    0x0014C8B2U,
+    0x0014C9D3U,
+    0x0014CA88U,
+    0x0014CA93U,
+    0x0014CD85U,
+    0x0014D068U,
+    0x0014D2B3U,
+    0x0014D8B2U,
+    0x0014E4A5U,
+    0x0014E985U,
+    0x001524B3U,
+    0x001526C1U,
+    0x001554E1U,
+    0x00155C2EU,
+    0x001594B3U,
+    0x00159581U,
+    0x001595C5U,
+    0x0015A5C7U,
+    0x0015A681U,
+    0x0015AC33U,
+    0x00160430U,
+    0x0016046BU,
+    0x001605AFU,
+    0x001605C4U,
+    0x001605C5U,
+    0x001605C7U,
+    0x001605D3U,
+    0x001605D4U,
+    0x00160601U,
+    0x00160613U,
+    0x0016064DU,
+    0x00160659U,
+    0x00160685U,
+    0x00160733U,
+    0x00160833U,
+    0x001608A5U,
+    0x00160AADU,
+    0x00160D24U,
+    0x00160DF3U,
+    0x001610A1U,
+    0x001610B2U,
+    0x001611ECU,
+    0x0016146BU,
+    0x00161473U,
+    0x001614D3U,
+    0x001614D4U,
+    0x00161608U,
+    0x00161654U,
+    0x001616F3U,
+    0x00161725U,
+    0x00161833U,
+    0x00161C25U,
+    0x00161C2CU,
+    0x00161C33U,
+    0x00161D24U,
+    0x00161D2EU,
+    0x00161DF2U,
+    0x00161EADU,
+    0x00162433U,
+    0x00162449U,
+    0x001624AEU,
+    0x001624D3U,
+    0x001624EEU,
+    0x00162565U,
+    0x001625C5U,
+    0x00162674U,
+    0x001626C5U,
+    0x00162721U,
+    0x00162D25U,
+    0x00162DF3U,
+    0x00162F24U,
+    0x00162F2CU,
+    0x00163039U,
+    0x001630A5U,
+    0x001630ACU,
+    0x001630B9U,
+    0x00163133U,
+    0x001631E4U,
+    0x001631F4U,
+    0x001631F7U,
+    0x001631F9U,
+    0x0016332CU,
+    0x00163428U,
+    0x00163433U,
+    0x001634A8U,
+    0x001634B3U,
+    0x001636A4U,
+    0x001636A7U,
+    0x00163C93U,
+    0x00163CA4U,
+    0x00163CB3U,
+    0x00163CD4U,
+    0x00163D01U,
+    0x00163D2EU,
+    0x00163DC5U,
+    0x00163DC7U,
+    0x00163DE6U,
+    0x00163DF3U,
+    0x00163EA4U,
+    0x00163EE5U,
+    0x00164101U,
+    0x00165032U,
+    0x001650B2U,
+    0x0016510FU,
+    0x001651F3U,
+    0x00165581U,
+    0x001655B3U,
+    0x00165645U,
+    0x00165832U,
+    0x00165C39U,
+    0x00168513U,
+    0x0016852EU,
+    0x00168673U,
+    0x00168685U,
+    0x001686B4U,
+    0x00168745U,
+    0x0016882EU,
+    0x001688B2U,
+    0x00168934U,
+    0x00168985U,
+    0x001689F3U,
+    0x00168A59U,
+    0x00169441U,
+    0x001694B2U,
+    0x001695C4U,
+    0x001695C5U,
+    0x001695D3U,
+    0x001695D4U,
+    0x0016A433U,
+    0x0016A465U,
+    0x0016A469U,
+    0x0016A485U,
+    0x0016A48FU,
+    0x0016A493U,
+    0x0016A4B3U,
+    0x0016A4E1U,
+    0x0016A4EFU,
+    0x0016A5C5U,
+    0x0016A5CFU,
+    0x0016A5D3U,
+    0x0016A653U,
+    0x0016A673U,
+    0x0016A699U,
+    0x0016B033U,
+    0x0016B42EU,
+    0x0016B5EEU,
+    0x0016B5F3U,
+    0x0016B921U,
+    0x0016B923U,
+    0x0016B92FU,
+    0x0016BD73U,
+    0x0016BD85U,
+    0x0016BDC7U,
+    0x0016BE54U,
+    0x0016BEB2U,
+    0x0016BEC5U,
+    0x0016BEF4U,
+    0x0016C0A4U,
+    0x0016C185U,
+    0x0016C199U,
+    0x0016C2ACU,
+    0x0016C934U,
+    0x0016D46BU,
+    0x0016D665U,
+    0x0016E593U,
+    0x001705C1U,
+    0x00170681U,
+    0x00170D0FU,
+    0x00170D85U,
+    0x00170DEEU,
+    0x0017124FU,
+    0x00171432U,
+    0x00171585U,
+    0x001715D4U,
+    0x00171C33U,
+    0x00171CACU,
+    0x00171CB2U,
+    0x00171D85U,
+    0x00171D8FU,
+    0x00171E59U,
+    0x00171E74U,
+    0x001724E8U,
+    0x00172585U,
+    0x00172593U,
+    0x001725A1U,
+    0x001725A5U,
+    0x001725A9U,
+    0x001725EEU,
+    0x00172665U,
+    0x00172CB2U,
+    0x00172D13U,
+    0x00172D85U,
+    0x00172EB3U,
+    0x00173033U,
+    0x0017382CU,
+    0x00173833U,
+    0x00173834U,
+    0x001738B8U,
+    0x001739F9U,
+    0x00173AACU,
+    0x00173C33U,
+    0x00173C85U,
+    0x00173D85U,
+    0x00173DB9U,
+    0x00174C25U,
+    0x00175025U,
+    0x00175032U,
+    0x00175033U,
+    0x001750A4U,
+    0x001750B3U,
+    0x00175123U,
+    0x00175133U,
+    0x00175241U,
+    0x00175245U,
+    0x00175279U,
+    0x00175641U,
+    0x0017592CU,
+    0x001765EEU,
+    0x0017CA81U,
+    0x00180465U,
+    0x001804E5U,
+    0x00180524U,
+    0x00180654U,
+    0x00180724U,
+    0x00180733U,
+    0x0018142BU,
+    0x001814ABU,
+    0x00181653U,
+    0x00181654U,
+    0x00181659U,
+    0x00181C32U,
+    0x00182124U,
+    0x00182133U,
+    0x0018242EU,
+    0x001825C7U,
+    0x001825ECU,
+    0x00182668U,
+    0x0018266DU,
+    0x001838A1U,
+    0x00183C85U,
+    0x00183C93U,
+    0x00183DF0U,
+    0x00183E54U,
+    0x0018402CU,
+    0x00184039U,
+    0x001840ACU,
+    0x00184185U,
+    0x00184199U,
+    0x0018424FU,
+    0x001842A9U,
+    0x001842B9U,
+    0x001848B3U,
+    0x001849EEU,
+    0x00184CB3U,
+    0x00184D33U,
+    0x00184DF3U,
+    0x001850A4U,
+    0x001850B2U,
+    0x00185199U,
+    0x0018D425U,
+    0x0018D433U,
+    0x00190441U,
+    0x00190573U,
+    0x001905A5U,
+    0x00190653U,
+    0x00190833U,
+    0x001909F2U,
+    0x00190CA4U,
+    0x00190D09U,
+    0x00190DF3U,
+    0x00190EB3U,
+    0x001910A2U,
+    0x001911F2U,
+    0x00191249U,
+    0x00191424U,
+    0x00191425U,
+    0x0019142CU,
+    0x00191432U,
+    0x00191433U,
+    0x00191461U,
+    0x00191484U,
+    0x00191485U,
+    0x001914D9U,
+    0x00191523U,
+    0x001915C1U,
+    0x001915C5U,
+    0x00191601U,
+    0x00191645U,
+    0x00191685U,
+    0x00191693U,
+    0x00191694U,
+    0x00191C2CU,
+    0x00191C2EU,
+    0x00191D2CU,
+    0x00191D85U,
+    0x00191DECU,
+    0x00191DEEU,
+    0x00191DF4U,
+    0x00191EA5U,
+    0x00191EB3U,
+    0x00192034U,
+    0x00192433U,
+    0x001924ACU,
+    0x00192569U,
+    0x00192593U,
+    0x001925F4U,
+    0x00192665U,
+    0x00192668U,
+    0x00192CA4U,
+    0x001930A4U,
+    0x001930B3U,
+    0x001934A4U,
+    0x001934B2U,
+    0x001934B4U,
+    0x0019352CU,
+    0x001935F2U,
+    0x00193833U,
+    0x00193AB4U,
+    0x00193C41U,
+    0x00193D01U,
+    0x00193D24U,
+    0x00193DA1U,
+    0x00193E65U,
+    0x00194033U,
+    0x001940AEU,
+    0x00194828U,
+    0x00194833U,
+    0x00194839U,
+    0x001948B4U,
+    0x00194933U,
+    0x001949F7U,
+    0x001949FAU,
+    0x00194CA4U,
+    0x00194CB3U,
+    0x00194CB9U,
+    0x00194D33U,
+    0x00194DEEU,
+    0x0019502CU,
+    0x001950ACU,
+    0x00195123U,
+    0x00195133U,
+    0x00195279U,
+    0x00195505U,
+    0x001955B3U,
+    0x0019582CU,
+    0x001958A5U,
+    0x001959F3U,
+    0x00196593U,
+    0x001985C1U,
+    0x00198DEEU,
+    0x00198DF4U,
+    0x00198EB3U,
+    0x00199123U,
+    0x0019A0A4U,
+    0x0019A0AEU,
+    0x0019A0B3U,
+    0x0019A0B4U,
+    0x0019A485U,
+    0x0019ACA4U,
+    0x0019ACB2U,
+    0x0019ACB7U,
+    0x0019ADE9U,
+    0x0019ADF3U,
+    0x0019C0AEU,
+    0x0019C0B2U,
+    0x0019C123U,
+    0x0019C125U,
+    0x0019C133U,
+    0x0019C24FU,
+    0x0019CC29U,
+    0x0019CC2DU,
+    0x0019CC39U,
+    0x0019CCB3U,
+    0x0019CCB4U,
+    0x0019CCBAU,
+    0x0019CDF4U,
+    0x0019D0B2U,
+    0x0019D132U,
+    0x0019D2AEU,
+    0x0019D641U,
+    0x0019DC39U,
+    0x0019DD2DU,
+    0x0019E581U,
+    0x001A0613U,
+    0x001A0719U,
+    0x001A24E9U,
+    0x001A2594U,
+    0x001A25B9U,
+    0x001A3033U,
+    0x001A342EU,
+    0x001A3433U,
+    0x001A35F3U,
+    0x001A3C73U,
+    0x001A3D65U,
+    0x001A3D73U,
+    0x001A3D8CU,
+    0x001A3DB3U,
+    0x001A3DB9U,
+    0x001A3DC5U,
+    0x001A3DD9U,
+    0x001A3E19U,
+    0x001A4921U,
+    0x001A4930U,
+    0x001A5030U,
+    0x001A5032U,
+    0x001A5123U,
+    0x001A5433U,
+    0x001A9024U,
+    0x001A912FU,
+    0x001A9134U,
+    0x001A9CB2U,
+    0x001A9D14U,
+    0x001A9EB2U,
+    0x001AB033U,
+    0x001AB123U,
+    0x001AB1E9U,
+    0x001AB1F3U,
+    0x001AB52CU,
+    0x001AB8B3U,
+    0x001ABA93U,
+    0x001ABA99U,
+    0x001AC825U,
+    0x001AC82CU,
+    0x001AC832U,
+    0x001AC833U,
+    0x001AC8A9U,
+    0x001AC8B3U,
+    0x001AC923U,
+    0x001AC933U,
+    0x001ACAADU,
+    0x001AD1F3U,
+    0x001AE12EU,
+    0x001B052CU,
+    0x001B0585U,
+    0x001B05D4U,
+    0x001B0674U,
+    0x001B1593U,
+    0x001B15D3U,
+    0x001B1653U,
+    0x001B1654U,
+    0x001B1C33U,
+    0x001B242EU,
+    0x001B25C5U,
+    0x001B25EEU,
+    0x001B2665U,
+    0x001B266FU,
+    0x001B2745U,
+    0x001B3D24U,
+    0x001B3EF3U,
+    0x001B6745U,
+    0x001B8534U,
+    0x001B8565U,
+    0x001B8644U,
+    0x001B8645U,
+    0x001B864EU,
+    0x001B8668U,
+    0x001B868FU,
+    0x001B86C5U,
+    0x001B8733U,
+    0x001B9193U,
+    0x001B94ACU,
+    0x001B968FU,
+    0x001B9AACU,
+    0x001BA5C7U,
+    0x001BB659U,
+    0x001BB8A4U,
+    0x001BB8B2U,
+    0x001BBD65U,
+    0x001BBD93U,
+    0x001BBE4BU,
+    0x001C1593U,
+    0x001C242CU,
+    0x001C2585U,
+    0x001C2593U,
+    0x001C25C7U,
+    0x001C25EDU,
+    0x001C25EEU,
+    0x001C2685U,
+    0x001C30A4U,
+    0x001C30B3U,
+    0x001C342EU,
+    0x001C34AEU,
+    0x001C3D24U,
+    0x001C3DC5U,
+    0x001C3DD3U,
+    0x001C8513U,
+    0x001C8721U,
+    0x001C9590U,
+    0x001C9E45U,
+    0x001CA5D3U,
+    0x001CBDD4U,
+    0x001CC8B3U,
+    0x001CC925U,
+    0x001D05D3U,
+    0x001D2485U,
+    0x001D248FU,
+    0x001D25C5U,
+    0x001D31EEU,
+    0x001D3D23U,
+    0x001D3D85U,
+    0x001D3DD3U,
+    0x001D3E85U,
+    0x001D3E88U,
+    0x001D5569U,
+    0x001D5645U,
+    0x001D564EU,
+    0x001D5659U,
+    0x001D64F9U,
+    0x001D65A5U,
+    0x001D65B3U,
+    0x002084A4U,
+    0x00208593U,
+    0x00208833U,
+    0x002088ACU,
+    0x002088B3U,
+    0x00208961U,
+    0x002089EFU,
+    0x00208AACU,
+    0x00208AB3U,
+    0x00208C61U,
+    0x00208C6FU,
+    0x00208C79U,
+    0x00208D01U,
+    0x00208D13U,
+    0x00208D73U,
+    0x00208DEEU,
+    0x00209099U,
+    0x002090E5U,
+    0x00209199U,
+    0x00209593U,
+    0x002098D3U,
+    0x002098D9U,
+    0x00209A93U,
+    0x00209CACU,
+    0x00209CF9U,
+    0x00209D13U,
+    0x00209D25U,
+    0x0020A293U,
+    0x0020A2B3U,
+    0x0020A2B4U,
+    0x0020A593U,
+    0x0020A64EU,
+    0x0020A661U,
+    0x0020A688U,
+    0x0020A693U,
+    0x0020A741U,
+    0x0020A745U,
+    0x0020A82EU,
+    0x0020AA41U,
+    0x0020AA49U,
+    0x0020AAB3U,
+    0x0020ACA4U,
+    0x0020ACAEU,
+    0x0020ACB2U,
+    0x0020ACB3U,
+    0x0020AE41U,
+    0x0020B033U,
+    0x0020B093U,
+    0x0020B099U,
+    0x0020B0A4U,
+    0x0020B0B2U,
+    0x0020B0B3U,
+    0x0020B173U,
+    0x0020B179U,
+    0x0020B193U,
+    0x0020B199U,
+    0x0020B1B3U,
+    0x0020B1B9U,
+    0x0020B1EFU,
+    0x0020B261U,
+    0x0020B289U,
+    0x0020B2AEU,
+    0x0020B2B3U,
+    0x0020B449U,
+    0x0020B82BU,
+    0x0020B82CU,
+    0x0020B86FU,
+    0x0020B873U,
+    0x0020B881U,
+    0x0020B888U,
+    0x0020B893U,
+    0x0020B899U,
+    0x0020B8A4U,
+    0x0020B8B3U,
+    0x0020B8F3U,
+    0x0020B921U,
+    0x0020B94FU,
+    0x0020B973U,
+    0x0020B9D3U,
+    0x0020BA93U,
+    0x0020BA95U,
+    0x0020BA99U,
+    0x0020BB21U,
+    0x0020C2B3U,
+    0x0020C845U,
+    0x0020C853U,
+    0x0020C859U,
+    0x0020C861U,
+    0x0020C885U,
+    0x0020C88FU,
+    0x0020C893U,
+    0x0020C899U,
+    0x0020C8A4U,
+    0x0020C8B2U,
+    0x0020C8B3U,
+    0x0020C8C9U,
+    0x0020C8D3U,
+    0x0020C8E5U,
+    0x0020C923U,
+    0x0020C973U,
+    0x0020C979U,
+    0x0020C9B3U,
+    0x0020C9B9U,
+    0x0020C9D3U,
+    0x0020C9D9U,
+    0x0020C9EEU,
+    0x0020CA13U,
+    0x0020CA41U,
+    0x0020CA45U,
+    0x0020CA4FU,
+    0x0020CA59U,
+    0x0020CB25U,
+    0x0020CC2CU,
+    0x0020CC2EU,
+    0x0020CCA4U,
+    0x0020CCAEU,
+    0x0020CCB2U,
+    0x0020CCB3U,
+    0x0020CD0FU,
+    0x0020CD23U,
+    0x0020CD2AU,
+    0x0020CD2CU,
+    0x0020CD2EU,
+    0x0020CD33U,
+    0x0020CD73U,
+    0x0020CDEEU,
+    0x0020CE65U,
+    0x0020CE69U,
+    0x0020CE6FU,
+    0x0020CE79U,
+    0x0020CE81U,
+    0x0020CE85U,
+    0x0020CE89U,
+    0x0020CE8FU,
+    0x0020CE93U,
+    0x0020D068U,
+    0x0020D0A4U,
+    0x0020D0B3U,
+    0x0020D105U,
+    0x0020D113U,
+    0x0020D12BU,
+    0x0020D1EEU,
+    0x0020D281U,
+    0x0020D293U,
+    0x0020D295U,
+    0x0020D299U,
+    0x0020D493U,
+    0x0020D573U,
+    0x0020D58BU,
+    0x0020D653U,
+    0x0020D92EU,
+    0x0020DC93U,
+    0x0020DC99U,
+    0x0020DD73U,
+    0x0020DD93U,
+    0x0020DDD3U,
+    0x0020DE53U,
+    0x0020DE99U,
+    0x0020E4A4U,
+    0x0020E4B2U,
+    0x0020E4B3U,
+    0x0020E585U,
+    0x0020E5F5U,
+    0x0020E693U,
+    0x0020E832U,
+    0x0020E9EFU,
+    0x00228468U,
+    0x00228493U,
+    0x00228499U,
+    0x00228573U,
+    0x00228579U,
+    0x00228593U,
+    0x002285B3U,
+    0x002285B9U,
+    0x002285CFU,
+    0x002285D3U,
+    0x002285D9U,
+    0x00228644U,
+    0x00228645U,
+    0x00228653U,
+    0x00228674U,
+    0x00228688U,
+    0x00228693U,
+    0x00228699U,
+    0x002286B3U,
+    0x002286B4U,
+    0x002286B8U,
+    0x002289F0U,
+    0x00228C30U,
+    0x00228D65U,
+    0x00228D73U,
+    0x00229024U,
+    0x002290ACU,
+    0x002290B3U,
+    0x002290B7U,
+    0x0022912DU,
+    0x00229325U,
+    0x00229468U,
+    0x00229489U,
+    0x002294D3U,
+    0x002294D9U,
+    0x00229613U,
+    0x00229653U,
+    0x00229659U,
+    0x00229693U,
+    0x00229934U,
+    0x002299E7U,
+    0x00229C24U,
+    0x00229C2EU,
+    0x00229C32U,
+    0x00229C34U,
+    0x00229CADU,
+    0x00229CB4U,
+    0x00229D2EU,
+    0x00229DF4U,
+    0x00229EADU,
+    0x00229EAEU,
+    0x0022A4E5U,
+    0x0022A4F9U,
+    0x0022A5C7U,
+    0x0022A5D3U,
+    0x0022AC28U,
+    0x0022B028U,
+    0x0022B032U,
+    0x0022B039U,
+    0x0022B068U,
+    0x0022B0A5U,
+    0x0022B0E1U,
+    0x0022B125U,
+    0x0022B185U,
+    0x0022B193U,
+    0x0022B199U,
+    0x0022B1EEU,
+    0x0022B1F7U,
+    0x0022B293U,
+    0x0022B424U,
+    0x0022B433U,
+    0x0022B538U,
+    0x0022B6A4U,
+    0x0022B868U,
+    0x0022B893U,
+    0x0022B899U,
+    0x0022B8B3U,
+    0x0022B8B4U,
+    0x0022B8E1U,
+    0x0022B933U,
+    0x0022B9C5U,
+    0x0022B9C9U,
+    0x0022B9D9U,
+    0x0022BA8FU,
+    0x0022BA93U,
+    0x0022BA99U,
+    0x0022C034U,
+    0x0022C839U,
+    0x0022C8B3U,
+    0x0022C8B4U,
+    0x0022C8F3U,
+    0x0022C96FU,
+    0x0022C973U,
+    0x0022C9A5U,
+    0x0022C9B3U,
+    0x0022C9E2U,
+    0x0022CA59U,
+    0x0022CA88U,
+    0x0022CB2CU,
+    0x0022CC34U,
+    0x0022CC37U,
+    0x0022CCA5U,
+    0x0022CCB3U,
+    0x0022CCB4U,
+    0x0022CD34U,
+    0x0022CDEDU,
+    0x0022CDF4U,
+    0x0022CE89U,
+    0x0022CE93U,
+    0x0022D033U,
+    0x0022D0A4U,
+    0x0022D0ACU,
+    0x0022D0B3U,
+    0x0022D113U,
+    0x0022D124U,
+    0x0022D1EEU,
+    0x0022D281U,
+    0x0022D299U,
+    0x0022D8ACU,
+    0x0022D8B2U,
+    0x0022D9F2U,
+    0x0022DAA5U,
+    0x0022DAD9U,
+    0x0022DCB4U,
+    0x0022DD27U,
+    0x0022E8ACU,
+    0x0022E8B3U,
+    0x0022E92CU,
+    0x0022EB59U,
+    0x00240533U,
+    0x00240549U,
+    0x002405C7U,
+    0x00240693U,
+    0x00241593U,
+    0x00243DF4U,
+    0x002455C1U,
+    0x00245693U,
+    0x00248468U,
+    0x00248589U,
+    0x00248599U,
+    0x00248853U,
+    0x002488B3U,
+    0x00248985U,
+    0x00248C79U,
+    0x00248CB0U,
+    0x00248CB3U,
+    0x00249099U,
+    0x002490A4U,
+    0x002490B2U,
+    0x002490B3U,
+    0x002490B4U,
+    0x00249133U,
+    0x002491EEU,
+    0x00249584U,
+    0x00249653U,
+    0x002498CFU,
+    0x002498D3U,
+    0x002498D9U,
+    0x00249924U,
+    0x00249C25U,
+    0x00249CF3U,
+    0x00249CF9U,
+    0x00249D01U,
+    0x00249D14U,
+    0x00249D99U,
+    0x00249DF3U,
+    0x00249DF4U,
+    0x0024A9F5U,
+    0x0024ACA4U,
+    0x0024ACB2U,
+    0x0024ACB3U,
+    0x0024AD25U,
+    0x0024B04FU,
+    0x0024B059U,
+    0x0024B0A4U,
+    0x0024B0B3U,
+    0x0024B0E5U,
+    0x0024B0F9U,
+    0x0024B173U,
+    0x0024B193U,
+    0x0024B199U,
+    0x0024B428U,
+    0x0024B433U,
+    0x0024B44FU,
+    0x0024B82CU,
+    0x0024B889U,
+    0x0024B893U,
+    0x0024B8B2U,
+    0x0024B8B3U,
+    0x0024B8E5U,
+    0x0024B8EFU,
+    0x0024B8F3U,
+    0x0024B8F9U,
+    0x0024B934U,
+    0x0024B973U,
+    0x0024BA93U,
+    0x0024BCF3U,
+    0x0024BDA5U,
+    0x0024BDD4U,
+    0x0024BE81U,
+    0x0024C0A4U,
+    0x0024C1E4U,
+    0x0024C868U,
+    0x0024C893U,
+    0x0024C973U,
+    0x0024C985U,
+    0x0024C993U,
+    0x0024C9F3U,
+    0x0024CA53U,
+    0x0024CA65U,
+    0x0024CA79U,
+    0x0024CA88U,
+    0x0024CCB3U,
+    0x0024CD73U,
+    0x0024CDEDU,
+    0x0024CDEEU,
+    0x0024D0B2U,
+    0x0024D0B3U,
+    0x0024D1F3U,
+    0x0024D1F5U,
+    0x0024D279U,
+    0x0024D285U,
+    0x0024D293U,
+    0x0024D299U,
+    0x0024D921U,
+    0x0024DAD9U,
+    0x0024E8B3U,
+    0x0024EB4FU,
+    0x0024EB59U,
+    0x00260453U,
+    0x0026046BU,
+    0x00260485U,
+    0x00260493U,
+    0x00260499U,
+    0x002604B2U,
+    0x002604B3U,
+    0x002604C6U,
+    0x002604F3U,
+    0x00260513U,
+    0x0026052EU,
+    0x002605A5U,
+    0x002605B3U,
+    0x002605C4U,
+    0x002605CBU,
+    0x00260645U,
+    0x00260654U,
+    0x00260665U,
+    0x00260668U,
+    0x00260674U,
+    0x00260685U,
+    0x00260693U,
+    0x00260694U,
+    0x002606A4U,
+    0x002606EEU,
+    0x002606F3U,
+    0x00260733U,
+    0x00260745U,
+    0x0026142BU,
+    0x00261432U,
+    0x00261434U,
+    0x00261453U,
+    0x00261468U,
+    0x002614A4U,
+    0x002614B0U,
+    0x002614B3U,
+    0x002615C4U,
+    0x002615D4U,
+    0x00261654U,
+    0x00261673U,
+    0x00261674U,
+    0x00261693U,
+    0x00261733U,
+    0x002625B0U,
+    0x002625B9U,
+    0x002625C4U,
+    0x002625C7U,
+    0x002625C9U,
+    0x002625CBU,
+    0x002625D3U,
+    0x002625D9U,
+    0x00262613U,
+    0x00262673U,
+    0x00262674U,
+    0x00262685U,
+    0x00262693U,
+    0x0026269AU,
+    0x002626C5U,
+    0x00263C34U,
+    0x00263C53U,
+    0x00263C6BU,
+    0x00263C73U,
+    0x00263CF3U,
+    0x00263D65U,
+    0x00263DC4U,
+    0x00263DE4U,
+    0x00263DEBU,
+    0x00263DEDU,
+    0x00263DF0U,
+    0x00263E45U,
+    0x00263E93U,
+    0x00263EEEU,
+    0x00263EF3U,
+    0x00263EF9U,
+    0x00265453U,
+    0x00265485U,
+    0x00265493U,
+    0x00265499U,
+    0x002654A4U,
+    0x002654B2U,
+    0x002654B3U,
+    0x002654B4U,
+    0x002654B9U,
+    0x002654C6U,
+    0x00265524U,
+    0x002655A5U,
+    0x002655CBU,
+    0x002655D4U,
+    0x00265642U,
+    0x00265653U,
+    0x00265654U,
+    0x00265668U,
+    0x00266605U,
+    0x00278453U,
+    0x00278573U,
+    0x00278644U,
+    0x00278653U,
+    0x00278654U,
+    0x00278674U,
+    0x00278693U,
+    0x00278823U,
+    0x0027882BU,
+    0x00278833U,
+    0x00278859U,
+    0x002789ECU,
+    0x002789F3U,
+    0x00278C61U,
+    0x00278C65U,
+    0x00278C69U,
+    0x00278D05U,
+    0x00278D73U,
+    0x002790A4U,
+    0x002790B3U,
+    0x002790E5U,
+    0x00279109U,
+    0x00279185U,
+    0x00279613U,
+    0x00279693U,
+    0x002796A6U,
+    0x002798CFU,
+    0x002798D3U,
+    0x00279C2EU,
+    0x00279CB9U,
+    0x00279CF9U,
+    0x00279D25U,
+    0x00279D85U,
+    0x00279EA5U,
+    0x00279EB3U,
+    0x0027A0A1U,
+    0x0027A1F3U,
+    0x0027A593U,
+    0x0027A5C7U,
+    0x0027A5CBU,
+    0x0027A685U,
+    0x0027ACA4U,
+    0x0027ACA8U,
+    0x0027ACB3U,
+    0x0027ADF3U,
+    0x0027B032U,
+    0x0027B033U,
+    0x0027B093U,
+    0x0027B0B3U,
+    0x0027B138U,
+    0x0027B193U,
+    0x0027B1F3U,
+    0x0027B293U,
+    0x0027B2B3U,
+    0x0027B433U,
+    0x0027B445U,
+    0x0027B44FU,
+    0x0027B453U,
+    0x0027B865U,
+    0x0027B893U,
+    0x0027B8A4U,
+    0x0027B8B2U,
+    0x0027B8B3U,
+    0x0027B8B9U,
+    0x0027B8EFU,
+    0x0027B8F3U,
+    0x0027B925U,
+    0x0027B973U,
+    0x0027B9C5U,
+    0x0027B9D9U,
+    0x0027BAB3U,
+    0x0027BB41U,
+    0x0027BB45U,
+    0x0027BC29U,
+    0x0027BC39U,
+    0x0027BC53U,
+    0x0027BC59U,
+    0x0027BC99U,
+    0x0027BCA4U,
+    0x0027BCD9U,
+    0x0027BCF9U,
+    0x0027BD13U,
+    0x0027BD73U,
+    0x0027BD79U,
+    0x0027BD93U,
+    0x0027BDB3U,
+    0x0027BDB9U,
+    0x0027BDC7U,
+    0x0027BDD3U,
+    0x0027BE44U,
+    0x0027BE53U,
+    0x0027BE65U,
+    0x0027BE74U,
+    0x0027BE88U,
+    0x0027BE93U,
+    0x0027BE99U,
+    0x0027BF45U,
+    0x0027BF59U,
+    0x0027C219U,
+    0x0027C82BU,
+    0x0027C82CU,
+    0x0027C833U,
+    0x0027C838U,
+    0x0027C885U,
+    0x0027C893U,
+    0x0027C8A4U,
+    0x0027C8A5U,
+    0x0027C8ACU,
+    0x0027C8B2U,
+    0x0027C8B3U,
+    0x0027C8EFU,
+    0x0027C923U,
+    0x0027C973U,
+    0x0027C9B3U,
+    0x0027C9C1U,
+    0x0027C9C5U,
+    0x0027C9EEU,
+    0x0027CA93U,
+    0x0027CA99U,
+    0x0027CA9AU,
+    0x0027CD25U,
+    0x0027CD73U,
+    0x0027CD79U,
+    0x0027CDEDU,
+    0x0027CDEEU,
+    0x0027CE79U,
+    0x0027CEAEU,
+    0x0027D033U,
+    0x0027D068U,
+    0x0027D0ACU,
+    0x0027D0B3U,
+    0x0027D119U,
+    0x0027D285U,
+    0x0027D293U,
+    0x0027D299U,
+    0x0027D4E5U,
+    0x0027D4E8U,
+    0x0027D573U,
+    0x0027D585U,
+    0x0027D594U,
+    0x0027D5C4U,
+    0x0027D5D3U,
+    0x0027D644U,
+    0x0027D647U,
+    0x0027D64EU,
+    0x0027D665U,
+    0x0027D679U,
+    0x0027D693U,
+    0x0027D924U,
+    0x0027DC34U,
+    0x0027DCA4U,
+    0x0027DCACU,
+    0x0027DCB2U,
+    0x0027DCB3U,
+    0x0027DCB4U,
+    0x0027DD25U,
+    0x0027DD93U,
+    0x0027DDC5U,
+    0x0027DE53U,
+    0x0027DE65U,
+    0x0027E0A4U,
+    0x0027E0AEU,
+    0x0027E0B2U,
+    0x0027E0B3U,
+    0x0027E181U,
+    0x0027E299U,
+    0x0027E432U,
+    0x0027E435U,
+    0x0027E4A4U,
+    0x0027E4D3U,
+    0x0027E4F3U,
+    0x0027E581U,
+    0x0027E5F3U,
+    0x0027E679U,
+    0x0027E9F3U,
+    0x00290429U,
+    0x00290465U,
+    0x00290468U,
+    0x0029046BU,
+    0x00290474U,
+    0x00290493U,
+    0x002904B3U,
+    0x002904F3U,
+    0x00290524U,
+    0x0029052CU,
+    0x0029052EU,
+    0x00290565U,
+    0x00290573U,
+    0x00290579U,
+    0x002905A5U,
+    0x002905C4U,
+    0x002905C5U,
+    0x002905CBU,
+    0x002905D3U,
+    0x002905D4U,
+    0x00290668U,
+    0x00290673U,
+    0x00290674U,
+    0x00290693U,
+    0x002906C1U,
+    0x002906C5U,
+    0x002906C9U,
+    0x002906CFU,
+    0x002906ECU,
+    0x002906EEU,
+    0x002906F3U,
+    0x00290719U,
+    0x00290733U,
+    0x00290741U,
+    0x00290745U,
+    0x00291424U,
+    0x0029142BU,
+    0x0029142DU,
+    0x00291485U,
+    0x00291493U,
+    0x002914A4U,
+    0x002914ADU,
+    0x002914B2U,
+    0x002914B3U,
+    0x00291524U,
+    0x00291533U,
+    0x002915A5U,
+    0x002915D3U,
+    0x002915D4U,
+    0x00291645U,
+    0x00291653U,
+    0x002916C5U,
+    0x002916F3U,
+    0x00291733U,
+    0x00292432U,
+    0x00292445U,
+    0x0029246BU,
+    0x00292485U,
+    0x002924A6U,
+    0x002924B2U,
+    0x002924B3U,
+    0x002924F3U,
+    0x00292569U,
+    0x00292573U,
+    0x0029258CU,
+    0x002925B3U,
+    0x002925C5U,
+    0x002925C7U,
+    0x002925CBU,
+    0x002925D3U,
+    0x002925D9U,
+    0x002925F3U,
+    0x00292665U,
+    0x0029266BU,
+    0x00292673U,
+    0x00292688U,
+    0x00292693U,
+    0x00292694U,
+    0x00292745U,
+    0x00293C24U,
+    0x00293C68U,
+    0x00293C6BU,
+    0x00293C93U,
+    0x00293CE8U,
+    0x00293CF3U,
+    0x00293D2CU,
+    0x00293D65U,
+    0x00293DA5U,
+    0x00293DAFU,
+    0x00293DC3U,
+    0x00293DC4U,
+    0x00293DE4U,
+    0x00293DEBU,
+    0x00293DECU,
+    0x00293DEDU,
+    0x00293DF3U,
+    0x00293E65U,
+    0x00293E79U,
+    0x00293E88U,
+    0x00293EEEU,
+    0x00293EF3U,
+    0x002954E8U,
+    0x0029552EU,
+    0x00295534U,
+    0x00295585U,
+    0x002955A5U,
+    0x002955C7U,
+    0x002955D4U,
+    0x00295668U,
+    0x0029566BU,
+    0x00295674U,
+    0x00295685U,
+    0x00295693U,
+    0x002A8693U,
+    0x002A8745U,
+    0x002A882CU,
+    0x002A8833U,
+    0x002A8841U,
+    0x002A8845U,
+    0x002A8859U,
+    0x002A8AB3U,
+    0x002A8D15U,
+    0x002A8D6FU,
+    0x002A8D73U,
+    0x002A8D75U,
+    0x002A9033U,
+    0x002A9099U,
+    0x002A90E5U,
+    0x002A9133U,
+    0x002A91F3U,
+    0x002A98C1U,
+    0x002A98C5U,
+    0x002A98C9U,
+    0x002A98CFU,
+    0x002A98D3U,
+    0x002A98D9U,
+    0x002A99F3U,
+    0x002A9A99U,
+    0x002A9CF9U,
+    0x002A9D85U,
+    0x002AA193U,
+    0x002AA253U,
+    0x002AA573U,
+    0x002AA584U,
+    0x002AA594U,
+    0x002AA674U,
+    0x002AACB3U,
+    0x002AB053U,
+    0x002AB0E5U,
+    0x002AB0F9U,
+    0x002AB173U,
+    0x002AB179U,
+    0x002AB181U,
+    0x002AB193U,
+    0x002AB199U,
+    0x002AB265U,
+    0x002AB44FU,
+    0x002AB4D3U,
+    0x002AB608U,
+    0x002AB613U,
+    0x002AB619U,
+    0x002AB833U,
+    0x002AB865U,
+    0x002AB868U,
+    0x002AB86FU,
+    0x002AB885U,
+    0x002AB888U,
+    0x002AB893U,
+    0x002AB894U,
+    0x002AB895U,
+    0x002AB899U,
+    0x002AB8F3U,
+    0x002AB8F9U,
+    0x002AB921U,
+    0x002AB945U,
+    0x002AB959U,
+    0x002AB96FU,
+    0x002AB973U,
+    0x002AB9D3U,
+    0x002AB9D9U,
+    0x002ABA93U,
+    0x002ABA99U,
+    0x002ABB21U,
+    0x002ABF33U,
+    0x002AC219U,
+    0x002AC82EU,
+    0x002AC833U,
+    0x002AC853U,
+    0x002AC893U,
+    0x002AC8B4U,
+    0x002AC8C9U,
+    0x002AC8E8U,
+    0x002AC8F3U,
+    0x002AC92EU,
+    0x002AC961U,
+    0x002AC965U,
+    0x002AC973U,
+    0x002AC993U,
+    0x002AC999U,
+    0x002AC9D3U,
+    0x002AC9D4U,
+    0x002AC9EFU,
+    0x002ACA13U,
+    0x002ACA21U,
+    0x002ACA4FU,
+    0x002ACA53U,
+    0x002ACA59U,
+    0x002ACA61U,
+    0x002ACA65U,
+    0x002ACA74U,
+    0x002ACC59U,
+    0x002ACCA4U,
+    0x002ACCB3U,
+    0x002ACD19U,
+    0x002ACD73U,
+    0x002ACD79U,
+    0x002ACE75U,
+    0x002ACE89U,
+    0x002ACE93U,
+    0x002ACE99U,
+    0x002AD068U,
+    0x002AD0AFU,
+    0x002AD0B3U,
+    0x002AD185U,
+    0x002AD1E8U,
+    0x002AD285U,
+    0x002AD293U,
+    0x002AD299U,
+    0x002AD2B4U,
+    0x002AD32CU,
+    0x002AE1EDU,
+    0x002AE4B2U,
+    0x002AEB59U,
+    0x002B85C1U,
+    0x002B8749U,
+    0x002C90A4U,
+    0x002C90B3U,
+    0x002CACA4U,
+    0x002CACB3U,
+    0x002CB037U,
+    0x002CC8B3U,
+    0x002CC993U,
+    0x002CCE69U,
+    0x002CD0B3U,
+    0x002CDC39U,
+    0x003084A4U,
+    0x0030882CU,
+    0x00308833U,
+    0x00308859U,
+    0x003088B2U,
+    0x0030892EU,
+    0x00308985U,
+    0x003089E2U,
+    0x003089E3U,
+    0x00308A45U,
+    0x00308C2FU,
+    0x00308C33U,
+    0x00308D05U,
+    0x00308D73U,
+    0x00308D79U,
+    0x00308E89U,
+    0x00309099U,
+    0x003090A5U,
+    0x003090B3U,
+    0x003090B4U,
+    0x003090E5U,
+    0x003090F9U,
+    0x00309125U,
+    0x00309133U,
+    0x00309245U,
+    0x00309461U,
+    0x00309665U,
+    0x003098B3U,
+    0x003098D3U,
+    0x00309CA4U,
+    0x00309CB2U,
+    0x00309CB3U,
+    0x00309CB9U,
+    0x00309DF4U,
+    0x0030A1F7U,
+    0x0030A493U,
+    0x0030A5D3U,
+    0x0030A644U,
+    0x0030A64EU,
+    0x0030A9EEU,
+    0x0030AAAEU,
+    0x0030ACA4U,
+    0x0030ACB3U,
+    0x0030ACB9U,
+    0x0030B0D3U,
+    0x0030B124U,
+    0x0030B126U,
+    0x0030B138U,
+    0x0030B173U,
+    0x0030B181U,
+    0x0030B193U,
+    0x0030B1B3U,
+    0x0030B1B9U,
+    0x0030B1F3U,
+    0x0030B201U,
+    0x0030B213U,
+    0x0030B2C5U,
+    0x0030B338U,
+    0x0030B42EU,
+    0x0030B433U,
+    0x0030B4ACU,
+    0x0030B4AFU,
+    0x0030B4B3U,
+    0x0030B533U,
+    0x0030B5F3U,
+    0x0030B609U,
+    0x0030B60FU,
+    0x0030B613U,
+    0x0030B619U,
+    0x0030B6B3U,
+    0x0030B82CU,
+    0x0030B899U,
+    0x0030B8A4U,
+    0x0030B8A8U,
+    0x0030B8B2U,
+    0x0030B8B3U,
+    0x0030B8F3U,
+    0x0030B924U,
+    0x0030B9C1U,
+    0x0030B9D3U,
+    0x0030B9D9U,
+    0x0030B9E5U,
+    0x0030B9EEU,
+    0x0030BA6FU,
+    0x0030BA74U,
+    0x0030BA8FU,
+    0x0030BA93U,
+    0x0030BA99U,
+    0x0030C033U,
+    0x0030C0A4U,
+    0x0030C0B2U,
+    0x0030C0B3U,
+    0x0030C0B8U,
+    0x0030C113U,
+    0x0030C13AU,
+    0x0030C185U,
+    0x0030C1EEU,
+    0x0030C1F3U,
+    0x0030C1F4U,
+    0x0030C249U,
+    0x0030C2ACU,
+    0x0030C2B4U,
+    0x0030C830U,
+    0x0030C834U,
+    0x0030C84FU,
+    0x0030C853U,
+    0x0030C859U,
+    0x0030C889U,
+    0x0030C893U,
+    0x0030C899U,
+    0x0030C8A4U,
+    0x0030C8B2U,
+    0x0030C8B3U,
+    0x0030C8B4U,
+    0x0030C8B8U,
+    0x0030C8EFU,
+    0x0030C973U,
+    0x0030C985U,
+    0x0030C993U,
+    0x0030C9D3U,
+    0x0030C9D9U,
+    0x0030C9E2U,
+    0x0030C9ECU,
+    0x0030C9EDU,
+    0x0030C9EEU,
+    0x0030CA09U,
+    0x0030CA13U,
+    0x0030CA53U,
+    0x0030CA59U,
+    0x0030CA65U,
+    0x0030CA81U,
+    0x0030CA85U,
+    0x0030CA93U,
+    0x0030CAC5U,
+    0x0030CAD9U,
+    0x0030CC33U,
+    0x0030CC6FU,
+    0x0030CCA4U,
+    0x0030CCB3U,
+    0x0030CD73U,
+    0x0030CD79U,
+    0x0030CE85U,
+    0x0030CE93U,
+    0x0030CEB3U,
+    0x0030D068U,
+    0x0030D0B2U,
+    0x0030D0B3U,
+    0x0030D299U,
+    0x0030D481U,
+    0x0030D573U,
+    0x0030D584U,
+    0x0030D58BU,
+    0x0030D593U,
+    0x0030D5B3U,
+    0x0030D613U,
+    0x0030D649U,
+    0x0030D661U,
+    0x0030D665U,
+    0x0030D833U,
+    0x0030D8A4U,
+    0x0030D8ACU,
+    0x0030D8B2U,
+    0x0030D8B3U,
+    0x0030D925U,
+    0x0030D92CU,
+    0x0030DCA4U,
+    0x0030DD73U,
+    0x0030E1EEU,
+    0x00328665U,
+    0x00328745U,
+    0x00328924U,
+    0x00328C2CU,
+    0x00328EADU,
+    0x00329032U,
+    0x003290A4U,
+    0x003290B2U,
+    0x003290B3U,
+    0x00329133U,
+    0x0032A441U,
+    0x0032A589U,
+    0x0032A593U,
+    0x0032B0A2U,
+    0x0032B181U,
+    0x0032B189U,
+    0x0032B18FU,
+    0x0032B193U,
+    0x0032B1EDU,
+    0x0032B293U,
+    0x0032BA65U,
+    0x0032BA8FU,
+    0x0032BA93U,
+    0x0032BA95U,
+    0x0032BE4CU,
+    0x0032C0B3U,
+    0x0032C869U,
+    0x0032C8A4U,
+    0x0032C8B3U,
+    0x0032C8E5U,
+    0x0032C921U,
+    0x0032C923U,
+    0x0032C9C5U,
+    0x0032C9E3U,
+    0x0032C9F3U,
+    0x0032CA93U,
+    0x0032CA99U,
+    0x0032CE65U,
+    0x0032CE81U,
+    0x0032CE89U,
+    0x0032D0B3U,
+    0x0032D32CU,
+    0x0032EAC5U,
+    0x00340465U,
+    0x0034046BU,
+    0x0034046FU,
+    0x0034048FU,
+    0x00340493U,
+    0x003404C5U,
+    0x003404C6U,
+    0x003404D4U,
+    0x0034052EU,
+    0x00340532U,
+    0x00340533U,
+    0x0034058BU,
+    0x00340593U,
+    0x003405B0U,
+    0x003405B3U,
+    0x003405C1U,
+    0x003405C7U,
+    0x003405CBU,
+    0x003405D4U,
+    0x003405F3U,
+    0x00340605U,
+    0x00340613U,
+    0x00340614U,
+    0x00340641U,
+    0x00340644U,
+    0x00340645U,
+    0x0034064BU,
+    0x0034064DU,
+    0x00340652U,
+    0x00340653U,
+    0x00340654U,
+    0x00340659U,
+    0x00340665U,
+    0x0034066DU,
+    0x00340693U,
+    0x003406C5U,
+    0x003406D3U,
+    0x003406EBU,
+    0x003406F3U,
+    0x00340721U,
+    0x00340733U,
+    0x00341430U,
+    0x00341434U,
+    0x0034146BU,
+    0x003414ABU,
+    0x003414B0U,
+    0x003414B2U,
+    0x003414D3U,
+    0x00341561U,
+    0x00341581U,
+    0x00341590U,
+    0x003415AFU,
+    0x003415B3U,
+    0x00341645U,
+    0x00341654U,
+    0x00341673U,
+    0x00341674U,
+    0x00341688U,
+    0x003416D9U,
+    0x003416F3U,
+    0x003416F9U,
+    0x0034242FU,
+    0x00342433U,
+    0x00342453U,
+    0x00342461U,
+    0x00342468U,
+    0x0034246BU,
+    0x0034246FU,
+    0x00342473U,
+    0x00342485U,
+    0x003424A6U,
+    0x003424ACU,
+    0x00342573U,
+    0x00342584U,
+    0x00342585U,
+    0x00342589U,
+    0x0034258CU,
+    0x003425A2U,
+    0x003425A5U,
+    0x003425AFU,
+    0x003425B0U,
+    0x003425C1U,
+    0x003425C5U,
+    0x003425C7U,
+    0x003425CFU,
+    0x003425D3U,
+    0x00342613U,
+    0x0034264BU,
+    0x0034264CU,
+    0x0034264DU,
+    0x0034264FU,
+    0x00342650U,
+    0x00342652U,
+    0x00342654U,
+    0x00342655U,
+    0x00342693U,
+    0x003426C5U,
+    0x003426D3U,
+    0x003426D9U,
+    0x0034275AU,
+    0x00343C6BU,
+    0x00343C6FU,
+    0x00343C73U,
+    0x00343C85U,
+    0x00343CF3U,
+    0x00343D2CU,
+    0x00343D32U,
+    0x00343D65U,
+    0x00343D6FU,
+    0x00343D79U,
+    0x00343D81U,
+    0x00343D89U,
+    0x00343D8FU,
+    0x00343DB0U,
+    0x00343DD3U,
+    0x00343DE6U,
+    0x00343DEBU,
+    0x00343DEDU,
+    0x00343DEEU,
+    0x00343E13U,
+    0x00343E44U,
+    0x00343E45U,
+    0x00343E65U,
+    0x00343E81U,
+    0x00343E94U,
+    0x00343EB4U,
+    0x00343EB8U,
+    0x00343EEBU,
+    0x00343EF3U,
+    0x00345453U,
+    0x0034546BU,
+    0x003454C1U,
+    0x003454C6U,
+    0x003454F3U,
+    0x003455B0U,
+    0x003455B3U,
+    0x003455CBU,
+    0x0034564CU,
+    0x0034564EU,
+    0x00345652U,
+    0x00345665U,
+    0x00345685U,
+    0x00345693U,
+    0x00346585U,
+    0x003465A5U,
+    0x003465C4U,
+    0x003489ECU,
+    0x003490A4U,
+    0x003490B2U,
+    0x003490B3U,
+    0x00349593U,
+    0x00349C32U,
+    0x00349CF9U,
+    0x0034B121U,
+    0x0034B193U,
+    0x0034B432U,
+    0x0034B4B8U,
+    0x0034B868U,
+    0x0034B874U,
+    0x0034B8B3U,
+    0x0034BA33U,
+    0x0034BDD3U,
+    0x0034C209U,
+    0x0034C861U,
+    0x0034C873U,
+    0x0034C8B3U,
+    0x0034C993U,
+    0x0034CA49U,
+    0x0034CC6FU,
+    0x0034CE79U,
+    0x0034CE93U,
+    0x0034D02CU,
+    0x0034D0A4U,
+    0x0034D0B2U,
+    0x0034D0B3U,
+    0x0034D8B3U,
+    0x0034D8B4U,
+    0x0034D923U,
+    0x0034D925U,
+    0x0034D92CU,
+    0x0034DAD9U,
+    0x00360468U,
+    0x0036046BU,
+    0x00360485U,
+    0x00360493U,
+    0x003604B3U,
+    0x003604F3U,
+    0x0036052DU,
+    0x003605A5U,
+    0x003605B0U,
+    0x003605B3U,
+    0x003605C7U,
+    0x003605CBU,
+    0x003605D3U,
+    0x00360613U,
+    0x00360614U,
+    0x0036064FU,
+    0x00360654U,
+    0x00360659U,
+    0x00360668U,
+    0x00360670U,
+    0x00360673U,
+    0x00360674U,
+    0x00360693U,
+    0x003606B4U,
+    0x003606C5U,
+    0x003606C9U,
+    0x003606F3U,
+    0x00360733U,
+    0x0036142EU,
+    0x00361432U,
+    0x00361434U,
+    0x0036146BU,
+    0x003614ABU,
+    0x003614B0U,
+    0x003614D3U,
+    0x003614D4U,
+    0x003614F3U,
+    0x0036152BU,
+    0x003615B3U,
+    0x00361605U,
+    0x00361614U,
+    0x0036164BU,
+    0x003616C5U,
+    0x003616F3U,
+    0x0036246BU,
+    0x003624A4U,
+    0x003624B3U,
+    0x003624C6U,
+    0x003624D4U,
+    0x003625A2U,
+    0x003625A5U,
+    0x003625C5U,
+    0x003625C7U,
+    0x003625CBU,
+    0x003625D4U,
+    0x00362605U,
+    0x00362613U,
+    0x00362614U,
+    0x00362693U,
+    0x00363C2BU,
+    0x00363C2DU,
+    0x00363C6BU,
+    0x00363C93U,
+    0x00363CC6U,
+    0x00363CF3U,
+    0x00363D65U,
+    0x00363DA2U,
+    0x00363DB0U,
+    0x00363DC5U,
+    0x00363DCBU,
+    0x00363DD3U,
+    0x00363DF0U,
+    0x00363DF4U,
+    0x00363E13U,
+    0x00363E65U,
+    0x00363E85U,
+    0x00363E88U,
+    0x00363E93U,
+    0x00363EA4U,
+    0x00363EB2U,
+    0x00363EB3U,
+    0x00363EB4U,
+    0x00363EC5U,
+    0x00363EEEU,
+    0x00363EF3U,
+    0x00363F25U,
+    0x00363F33U,
+    0x00363F45U,
+    0x00365453U,
+    0x0036546BU,
+    0x003654A4U,
+    0x003654B3U,
+    0x003654B9U,
+    0x003655B0U,
+    0x003655C7U,
+    0x003655CBU,
+    0x00366605U,
+    0x00372481U,
+    0x00378468U,
+    0x00378474U,
+    0x00378499U,
+    0x00378581U,
+    0x00378593U,
+    0x00378599U,
+    0x00378614U,
+    0x00378642U,
+    0x00378674U,
+    0x00378685U,
+    0x00378689U,
+    0x00378693U,
+    0x00378853U,
+    0x00378859U,
+    0x00378921U,
+    0x00378985U,
+    0x00378A41U,
+    0x00378B41U,
+    0x00378C33U,
+    0x00378C69U,
+    0x00378C6FU,
+    0x00378D73U,
+    0x00378D79U,
+    0x00378DE1U,
+    0x00378DF3U,
+    0x00379033U,
+    0x003790A3U,
+    0x003790A4U,
+    0x003790AEU,
+    0x003790B2U,
+    0x003790B3U,
+    0x003790B8U,
+    0x003791EEU,
+    0x00379493U,
+    0x003798D3U,
+    0x00379D25U,
+    0x00379DEEU,
+    0x00379EA5U,
+    0x0037A022U,
+    0x0037A0AEU,
+    0x0037A1E5U,
+    0x0037A1E7U,
+    0x0037A1F3U,
+    0x0037A4D3U,
+    0x0037A4EEU,
+    0x0037A593U,
+    0x0037A5D3U,
+    0x0037A653U,
+    0x0037A693U,
+    0x0037ACA4U,
+    0x0037ACB3U,
+    0x0037B033U,
+    0x0037B059U,
+    0x0037B093U,
+    0x0037B0A4U,
+    0x0037B0B3U,
+    0x0037B0B9U,
+    0x0037B123U,
+    0x0037B12EU,
+    0x0037B193U,
+    0x0037B199U,
+    0x0037B1E7U,
+    0x0037B1EEU,
+    0x0037B1F2U,
+    0x0037B293U,
+    0x0037B341U,
+    0x0037B425U,
+    0x0037B42CU,
+    0x0037B433U,
+    0x0037B445U,
+    0x0037B449U,
+    0x0037B44FU,
+    0x0037B453U,
+    0x0037B459U,
+    0x0037B4B2U,
+    0x0037B4B3U,
+    0x0037B4B4U,
+    0x0037B4D9U,
+    0x0037B523U,
+    0x0037B538U,
+    0x0037B5A1U,
+    0x0037B5AFU,
+    0x0037B5B3U,
+    0x0037B5B9U,
+    0x0037B60FU,
+    0x0037B613U,
+    0x0037B614U,
+    0x0037B685U,
+    0x0037B6B3U,
+    0x0037B868U,
+    0x0037B88FU,
+    0x0037B8A4U,
+    0x0037B8B3U,
+    0x0037B8B9U,
+    0x0037B8D3U,
+    0x0037B8E1U,
+    0x0037B8E5U,
+    0x0037B8EFU,
+    0x0037B921U,
+    0x0037B923U,
+    0x0037B92EU,
+    0x0037B973U,
+    0x0037B979U,
+    0x0037B9C5U,
+    0x0037B9D3U,
+    0x0037BA85U,
+    0x0037BA8FU,
+    0x0037BAB3U,
+    0x0037BACFU,
+    0x0037BC68U,
+    0x0037BCA4U,
+    0x0037BCA5U,
+    0x0037BCB2U,
+    0x0037BCB9U,
+    0x0037BCD3U,
+    0x0037BD73U,
+    0x0037BD79U,
+    0x0037BD93U,
+    0x0037BD99U,
+    0x0037BDA2U,
+    0x0037BDB3U,
+    0x0037BDB9U,
+    0x0037BE13U,
+    0x0037BE14U,
+    0x0037BE74U,
+    0x0037BE93U,
+    0x0037BF45U,
+    0x0037C02CU,
+    0x0037C039U,
+    0x0037C0A4U,
+    0x0037C0AEU,
+    0x0037C0B2U,
+    0x0037C0B3U,
+    0x0037C219U,
+    0x0037C241U,
+    0x0037C265U,
+    0x0037C279U,
+    0x0037C6A9U,
+    0x0037C82CU,
+    0x0037C82DU,
+    0x0037C845U,
+    0x0037C859U,
+    0x0037C893U,
+    0x0037C8A4U,
+    0x0037C8B2U,
+    0x0037C8B3U,
+    0x0037C8B9U,
+    0x0037C8E9U,
+    0x0037C921U,
+    0x0037C973U,
+    0x0037C979U,
+    0x0037C9B3U,
+    0x0037C9C9U,
+    0x0037C9CFU,
+    0x0037C9D3U,
+    0x0037C9D5U,
+    0x0037C9D9U,
+    0x0037CA13U,
+    0x0037CA65U,
+    0x0037CA6FU,
+    0x0037CCA3U,
+    0x0037CCA4U,
+    0x0037CCB3U,
+    0x0037CCB4U,
+    0x0037CCB9U,
+    0x0037CD25U,
+    0x0037CE81U,
+    0x0037CE85U,
+    0x0037CE93U,
+    0x0037D02EU,
+    0x0037D0A4U,
+    0x0037D0B3U,
+    0x0037D113U,
+    0x0037D281U,
+    0x0037D293U,
+    0x0037D468U,
+    0x0037D485U,
+    0x0037D4E8U,
+    0x0037D584U,
+    0x0037D5D4U,
+    0x0037D605U,
+    0x0037D613U,
+    0x0037D642U,
+    0x0037D644U,
+    0x0037D645U,
+    0x0037D653U,
+    0x0037D654U,
+    0x0037D681U,
+    0x0037D688U,
+    0x0037D8A4U,
+    0x0037D8AEU,
+    0x0037D8B2U,
+    0x0037D8B3U,
+    0x0037D8B4U,
+    0x0037D8B9U,
+    0x0037D92EU,
+    0x0037DC2CU,
+    0x0037DC2EU,
+    0x0037DCA4U,
+    0x0037DCB2U,
+    0x0037DD73U,
+    0x0037DD93U,
+    0x0037DE13U,
+    0x0037DE59U,
+    0x0037E025U,
+    0x0037E02CU,
+    0x0037E0A4U,
+    0x0037E0B3U,
+    0x0037E122U,
+    0x0037E435U,
+    0x0037E4A4U,
+    0x0037E4B2U,
+    0x0037E599U,
+    0x0037E615U,
+    0x0037E8A4U,
+    0x0037E8AEU,
+    0x0037E8B3U,
+    0x0037E8B9U,
+    0x0037E925U,
+    0x0039042CU,
+    0x00390453U,
+    0x0039046BU,
+    0x003904D4U,
+    0x003904F3U,
+    0x00390523U,
+    0x00390527U,
+    0x00390565U,
+    0x003905A5U,
+    0x003905B0U,
+    0x003905B3U,
+    0x003905C5U,
+    0x003905CBU,
+    0x003905D3U,
+    0x00390605U,
+    0x00390613U,
+    0x00390619U,
+    0x00390645U,
+    0x00390668U,
+    0x00390673U,
+    0x00390685U,
+    0x003906C5U,
+    0x003906ECU,
+    0x003906F3U,
+    0x00390733U,
+    0x00390745U,
+    0x00390759U,
+    0x0039142BU,
+    0x0039142DU,
+    0x0039148FU,
+    0x00391493U,
+    0x003914A4U,
+    0x003914ABU,
+    0x003914ACU,
+    0x003914B0U,
+    0x003914B3U,
+    0x003915A5U,
+    0x003915B3U,
+    0x003915C1U,
+    0x00391605U,
+    0x00391613U,
+    0x00391614U,
+    0x00391619U,
+    0x00391673U,
+    0x00391674U,
+    0x003916E5U,
+    0x003916F3U,
+    0x00392433U,
+    0x00392453U,
+    0x0039246BU,
+    0x003924A4U,
+    0x003924B2U,
+    0x003924B3U,
+    0x003925A5U,
+    0x003925B0U,
+    0x003925B3U,
+    0x003925C5U,
+    0x003925F3U,
+    0x00392605U,
+    0x00392613U,
+    0x00392665U,
+    0x00392670U,
+    0x00392688U,
+    0x00392693U,
+    0x00393C2BU,
+    0x00393C69U,
+    0x00393C6BU,
+    0x00393C73U,
+    0x00393CD4U,
+    0x00393CF3U,
+    0x00393DA2U,
+    0x00393DA5U,
+    0x00393DC5U,
+    0x00393DCBU,
+    0x00393DD3U,
+    0x00393DD9U,
+    0x00393DEBU,
+    0x00393DECU,
+    0x00393DEEU,
+    0x00393E13U,
+    0x00393E45U,
+    0x00393E73U,
+    0x00393E74U,
+    0x00393EB0U,
+    0x00393EB4U,
+    0x00393EE4U,
+    0x00393EEEU,
+    0x00393EF3U,
+    0x00393F45U,
+    0x0039546BU,
+    0x00395485U,
+    0x0039548FU,
+    0x00395493U,
+    0x00395499U,
+    0x003954ACU,
+    0x003954B3U,
+    0x003954B4U,
+    0x003954D4U,
+    0x003955A2U,
+    0x003955B0U,
+    0x003955CBU,
+    0x003955F2U,
+    0x00395641U,
+    0x00395665U,
+    0x00395668U,
+    0x00395674U,
+    0x00395679U,
+    0x003956C5U,
+    0x00395E88U,
+    0x003964B2U,
+    0x00396614U,
+    0x003A15C5U,
+    0x003A8859U,
+    0x003A88A2U,
+    0x003A88A4U,
+    0x003A88B2U,
+    0x003A88B3U,
+    0x003A8923U,
+    0x003A8934U,
+    0x003A9099U,
+    0x003A98CFU,
+    0x003A98D3U,
+    0x003AA4D3U,
+    0x003AA5C7U,
+    0x003AA668U,
+    0x003AA693U,
+    0x003AACB3U,
+    0x003AB068U,
+    0x003AB0B4U,
+    0x003AB0B8U,
+    0x003AB193U,
+    0x003AB199U,
+    0x003AB1B3U,
+    0x003AB201U,
+    0x003AB289U,
+    0x003AB293U,
+    0x003AB299U,
+    0x003AB4A3U,
+    0x003AB52EU,
+    0x003AB899U,
+    0x003AB8A9U,
+    0x003AB934U,
+    0x003ABA93U,
+    0x003AC0ACU,
+    0x003AC124U,
+    0x003AC201U,
+    0x003AC219U,
+    0x003AC834U,
+    0x003AC853U,
+    0x003AC868U,
+    0x003AC893U,
+    0x003AC899U,
+    0x003AC8A4U,
+    0x003AC8B2U,
+    0x003AC8B3U,
+    0x003AC8B4U,
+    0x003AC8D3U,
+    0x003AC921U,
+    0x003AC925U,
+    0x003AC92FU,
+    0x003AC989U,
+    0x003AC993U,
+    0x003AC999U,
+    0x003AC9D3U,
+    0x003AC9D9U,
+    0x003ACA53U,
+    0x003ACA59U,
+    0x003ACA65U,
+    0x003ACA69U,
+    0x003ACA74U,
+    0x003ACAC5U,
+    0x003ACAD9U,
+    0x003ACCA3U,
+    0x003ACD19U,
+    0x003ACD73U,
+    0x003ACE13U,
+    0x003ACE19U,
+    0x003ACE6FU,
+    0x003ACEADU,
+    0x003AD068U,
+    0x003AD0B2U,
+    0x003AD0B3U,
+    0x003AD0B9U,
+    0x003AD125U,
+    0x003AD12EU,
+    0x003AD133U,
+    0x003AD28FU,
+    0x003AD299U,
+    0x003AD2B0U,
+    0x003AD8A5U,
+    0x003AE8B3U,
+    0x003BD068U,
+    0x003C85CFU,
+    0x003C85D3U,
+    0x003C88B2U,
+    0x003C8C24U,
+    0x003C8C33U,
+    0x003C8D85U,
+    0x003C8D8FU,
+    0x003C90B2U,
+    0x003CB138U,
+    0x003CB425U,
+    0x003CB432U,
+    0x003CB433U,
+    0x003CB4B3U,
+    0x003CB5ECU,
+    0x003CB923U,
+    0x003CCE93U,
+    0x003CD0B3U,
+    0x003CD1EEU,
+    0x003D0653U,
+    0x00408593U,
+    0x00408841U,
+    0x00408CB3U,
+    0x00408D01U,
+    0x00408D73U,
+    0x00409028U,
+    0x00409033U,
+    0x00409099U,
+    0x004091F3U,
+    0x004098D3U,
+    0x004098D9U,
+    0x00409CE1U,
+    0x00409CF9U,
+    0x00409DF3U,
+    0x0040A193U,
+    0x0040A56FU,
+    0x0040A599U,
+    0x0040A5C5U,
+    0x0040A5D4U,
+    0x0040A659U,
+    0x0040A679U,
+    0x0040ACB2U,
+    0x0040B0A4U,
+    0x0040B0B3U,
+    0x0040B133U,
+    0x0040B185U,
+    0x0040B199U,
+    0x0040B293U,
+    0x0040B42EU,
+    0x0040B432U,
+    0x0040B4B3U,
+    0x0040B5A5U,
+    0x0040B5D3U,
+    0x0040B613U,
+    0x0040B619U,
+    0x0040B865U,
+    0x0040B879U,
+    0x0040B899U,
+    0x0040B8F3U,
+    0x0040B92FU,
+    0x0040B973U,
+    0x0040B9D9U,
+    0x0040BA93U,
+    0x0040C826U,
+    0x0040C853U,
+    0x0040C879U,
+    0x0040C8A4U,
+    0x0040C8B2U,
+    0x0040C8B3U,
+    0x0040C8E1U,
+    0x0040C8F3U,
+    0x0040C923U,
+    0x0040C933U,
+    0x0040C973U,
+    0x0040C9D3U,
+    0x0040CA45U,
+    0x0040CA93U,
+    0x0040CB49U,
+    0x0040CD09U,
+    0x0040CD19U,
+    0x0040D02CU,
+    0x0040D0A4U,
+    0x0040D0B2U,
+    0x0040D0B3U,
+    0x0040D1F3U,
+    0x0040D28FU,
+    0x0040D2ADU,
+    0x0040D445U,
+    0x0040D453U,
+    0x0040D459U,
+    0x0040D493U,
+    0x0040D594U,
+    0x0040D5D4U,
+    0x0040D653U,
+    0x0040D693U,
+    0x0040D8AEU,
+    0x0040D934U,
+    0x0040DC28U,
+    0x0040DC93U,
+    0x0040DCA4U,
+    0x0040DCAEU,
+    0x0040DD73U,
+    0x0040DDD3U,
+    0x0040DE93U,
+    0x0040E42EU,
+    0x0040E468U,
+    0x0040E5D4U,
+    0x0040E8A4U,
+    0x0040E8B2U,
+    0x0040E8B3U,
+    0x00428493U,
+    0x00428532U,
+    0x00428593U,
+    0x00428594U,
+    0x004285D3U,
+    0x00428645U,
+    0x0042864EU,
+    0x00428653U,
+    0x00428659U,
+    0x00428668U,
+    0x00428688U,
+    0x004286C5U,
+    0x004286F3U,
+    0x004286F9U,
+    0x00428827U,
+    0x00428832U,
+    0x00428859U,
+    0x004288ACU,
+    0x004288B3U,
+    0x00428934U,
+    0x00428A93U,
+    0x00428AA4U,
+    0x00428AA7U,
+    0x00428AB2U,
+    0x00428AB3U,
+    0x00428AB4U,
+    0x00428B25U,
+    0x00428C24U,
+    0x00428C26U,
+    0x00428C2CU,
+    0x00428C2EU,
+    0x00428C39U,
+    0x00428D6FU,
+    0x00428D73U,
+    0x00428DF2U,
+    0x00428DF3U,
+    0x00428DF9U,
+    0x00428E59U,
+    0x0042902CU,
+    0x00429493U,
+    0x00429499U,
+    0x00429599U,
+    0x004295B3U,
+    0x004295D3U,
+    0x00429613U,
+    0x00429645U,
+    0x00429653U,
+    0x00429693U,
+    0x004296C5U,
+    0x004296D3U,
+    0x00429834U,
+    0x004298B2U,
+    0x004298CFU,
+    0x00429933U,
+    0x004299E7U,
+    0x00429C33U,
+    0x00429EADU,
+    0x00429EB3U,
+    0x0042A465U,
+    0x0042A493U,
+    0x0042A4D9U,
+    0x0042A4EEU,
+    0x0042A593U,
+    0x0042A66DU,
+    0x0042A674U,
+    0x0042A699U,
+    0x0042ACA4U,
+    0x0042ACB3U,
+    0x0042AD6FU,
+    0x0042B039U,
+    0x0042B0A4U,
+    0x0042B0B3U,
+    0x0042B0D3U,
+    0x0042B0D4U,
+    0x0042B133U,
+    0x0042B193U,
+    0x0042B199U,
+    0x0042B1F3U,
+    0x0042B208U,
+    0x0042B281U,
+    0x0042B293U,
+    0x0042B2C5U,
+    0x0042B42EU,
+    0x0042B4B3U,
+    0x0042B523U,
+    0x0042B534U,
+    0x0042B5E2U,
+    0x0042B5E9U,
+    0x0042B5EEU,
+    0x0042B5F3U,
+    0x0042B614U,
+    0x0042B6B2U,
+    0x0042B832U,
+    0x0042B839U,
+    0x0042B868U,
+    0x0042B8B3U,
+    0x0042B8B4U,
+    0x0042B92DU,
+    0x0042B933U,
+    0x0042BA65U,
+    0x0042BA93U,
+    0x0042BF19U,
+    0x0042C1F4U,
+    0x0042C288U,
+    0x0042C834U,
+    0x0042C839U,
+    0x0042C859U,
+    0x0042C8A4U,
+    0x0042C8B3U,
+    0x0042C927U,
+    0x0042C9A1U,
+    0x0042C9B3U,
+    0x0042C9D3U,
+    0x0042C9D9U,
+    0x0042C9F3U,
+    0x0042CA4FU,
+    0x0042CA59U,
+    0x0042CA88U,
+    0x0042CAD3U,
+    0x0042CCB8U,
+    0x0042CD09U,
+    0x0042CD33U,
+    0x0042CD73U,
+    0x0042CE65U,
+    0x0042D0B2U,
+    0x0042D1F8U,
+    0x0042D465U,
+    0x0042D833U,
+    0x0042D8ACU,
+    0x0042D92CU,
+    0x0042D933U,
+    0x0042D9EEU,
+    0x0042D9F3U,
+    0x0042D9F4U,
+    0x0042DC2EU,
+    0x0042DC32U,
+    0x0042DC38U,
+    0x0042DCA4U,
+    0x0042E0B3U,
+    0x0042E125U,
+    0x00440441U,
+    0x00440573U,
+    0x00440593U,
+    0x00442572U,
+    0x00443C49U,
+    0x00443D85U,
+    0x00443D8CU,
+    0x00443D93U,
+    0x00443E89U,
+    0x00443EF3U,
+    0x00445689U,
+    0x00448474U,
+    0x00448593U,
+    0x004485C5U,
+    0x00448659U,
+    0x0044874FU,
+    0x00448853U,
+    0x00448CA4U,
+    0x00448CB2U,
+    0x00448CB3U,
+    0x00448CB9U,
+    0x00448D14U,
+    0x00448D73U,
+    0x00448D79U,
+    0x00448DF4U,
+    0x00448E81U,
+    0x00448E93U,
+    0x00448E99U,
+    0x00449099U,
+    0x00449125U,
+    0x004491F3U,
+    0x00449274U,
+    0x00449453U,
+    0x00449593U,
+    0x004495C5U,
+    0x00449693U,
+    0x004498D3U,
+    0x00449D14U,
+    0x00449D34U,
+    0x0044AC33U,
+    0x0044ACA4U,
+    0x0044ACB2U,
+    0x0044ACB3U,
+    0x0044ACB9U,
+    0x0044B08FU,
+    0x0044B189U,
+    0x0044B193U,
+    0x0044B199U,
+    0x0044B44FU,
+    0x0044B4B2U,
+    0x0044B4B3U,
+    0x0044B599U,
+    0x0044B613U,
+    0x0044B832U,
+    0x0044B8A4U,
+    0x0044B8B2U,
+    0x0044B8B3U,
+    0x0044B8E5U,
+    0x0044B8EFU,
+    0x0044B8F3U,
+    0x0044B8F9U,
+    0x0044B923U,
+    0x0044B973U,
+    0x0044B979U,
+    0x0044B9C1U,
+    0x0044B9F3U,
+    0x0044BA93U,
+    0x0044BC85U,
+    0x0044BD93U,
+    0x0044BE81U,
+    0x0044C219U,
+    0x0044C26FU,
+    0x0044C82DU,
+    0x0044C8B2U,
+    0x0044C8E5U,
+    0x0044C965U,
+    0x0044C973U,
+    0x0044C993U,
+    0x0044CA93U,
+    0x0044CA99U,
+    0x0044CC33U,
+    0x0044CC69U,
+    0x0044CC6FU,
+    0x0044CC73U,
+    0x0044CD19U,
+    0x0044CD73U,
+    0x0044CDA5U,
+    0x0044D02CU,
+    0x0044D033U,
+    0x0044D068U,
+    0x0044D0A4U,
+    0x0044D0B3U,
+    0x0044D279U,
+    0x0044D28FU,
+    0x0044D293U,
+    0x0044D299U,
+    0x0044D359U,
+    0x0044D82EU,
+    0x0044D833U,
+    0x0044D8A4U,
+    0x0044D8B2U,
+    0x0044D8B3U,
+    0x0044D933U,
+    0x0044D9C1U,
+    0x0044D9F3U,
+    0x0044D9F4U,
+    0x0044DAD9U,
+    0x0044DC2EU,
+    0x0044E125U,
+    0x0044E134U,
+    0x0044E433U,
+    0x0044E8AEU,
+    0x0044EB59U,
+    0x004525CEU,
+    0x004525D3U,
+    0x00478453U,
+    0x00478693U,
+    0x00478859U,
+    0x004788B3U,
+    0x00478925U,
+    0x00478981U,
+    0x00478A41U,
+    0x00478A4FU,
+    0x00478D14U,
+    0x00478D73U,
+    0x00478DF3U,
+    0x00478EB3U,
+    0x00479099U,
+    0x004790E5U,
+    0x004790F9U,
+    0x004791F3U,
+    0x00479573U,
+    0x00479653U,
+    0x00479674U,
+    0x00479688U,
+    0x004798D3U,
+    0x00479C2EU,
+    0x00479CB3U,
+    0x00479CB9U,
+    0x00479CEFU,
+    0x00479CF9U,
+    0x00479D25U,
+    0x00479DA1U,
+    0x0047A32FU,
+    0x0047A594U,
+    0x0047A599U,
+    0x0047A5C7U,
+    0x0047A693U,
+    0x0047A9F3U,
+    0x0047B065U,
+    0x0047B069U,
+    0x0047B0A4U,
+    0x0047B0B3U,
+    0x0047B121U,
+    0x0047B193U,
+    0x0047B199U,
+    0x0047B1A1U,
+    0x0047B1F2U,
+    0x0047B1F3U,
+    0x0047B293U,
+    0x0047B42CU,
+    0x0047B4A4U,
+    0x0047B4B3U,
+    0x0047B523U,
+    0x0047B828U,
+    0x0047B833U,
+    0x0047B8A5U,
+    0x0047B8B2U,
+    0x0047B8E1U,
+    0x0047B8F3U,
+    0x0047B96FU,
+    0x0047B9C1U,
+    0x0047B9C5U,
+    0x0047B9D9U,
+    0x0047B9F2U,
+    0x0047BA79U,
+    0x0047BAB4U,
+    0x0047BC53U,
+    0x0047BC65U,
+    0x0047BC99U,
+    0x0047BD73U,
+    0x0047BD85U,
+    0x0047BD93U,
+    0x0047BD99U,
+    0x0047BDB3U,
+    0x0047BDB9U,
+    0x0047BDC1U,
+    0x0047BE4EU,
+    0x0047BE53U,
+    0x0047BF59U,
+    0x0047C033U,
+    0x0047C0A4U,
+    0x0047C0B2U,
+    0x0047C0B3U,
+    0x0047C0B9U,
+    0x0047C824U,
+    0x0047C841U,
+    0x0047C853U,
+    0x0047C8A5U,
+    0x0047C8B3U,
+    0x0047C923U,
+    0x0047C933U,
+    0x0047C973U,
+    0x0047C979U,
+    0x0047C9B3U,
+    0x0047C9B9U,
+    0x0047CA13U,
+    0x0047CA53U,
+    0x0047CA61U,
+    0x0047CA65U,
+    0x0047CA93U,
+    0x0047CA99U,
+    0x0047CC29U,
+    0x0047CC33U,
+    0x0047CCA4U,
+    0x0047CCA8U,
+    0x0047CCB2U,
+    0x0047CCB3U,
+    0x0047CD01U,
+    0x0047D02CU,
+    0x0047D0A4U,
+    0x0047D0B2U,
+    0x0047D0B3U,
+    0x0047D299U,
+    0x0047D432U,
+    0x0047D454U,
+    0x0047D465U,
+    0x0047D473U,
+    0x0047D4E8U,
+    0x0047D573U,
+    0x0047D581U,
+    0x0047D5A1U,
+    0x0047D5B3U,
+    0x0047D613U,
+    0x0047D641U,
+    0x0047D665U,
+    0x0047D693U,
+    0x0047D8A4U,
+    0x0047D8AEU,
+    0x0047D8B2U,
+    0x0047D8B3U,
+    0x0047D925U,
+    0x0047DC32U,
+    0x0047DC93U,
+    0x0047DC99U,
+    0x0047DCA4U,
+    0x0047DCACU,
+    0x0047DCB2U,
+    0x0047DD25U,
+    0x0047DD85U,
+    0x0047DD93U,
+    0x0047DD99U,
+    0x0047DDC1U,
+    0x0047DDD3U,
+    0x0047DDD9U,
+    0x0047DE13U,
+    0x0047DE59U,
+    0x0047DE65U,
+    0x0047DE93U,
+    0x0047E0A4U,
+    0x0047E0B3U,
+    0x0047E125U,
+    0x0047E4AEU,
+    0x0047E599U,
+    0x0047E8A4U,
+    0x0047E8AEU,
+    0x0047E8B2U,
+    0x0047E8B3U,
+    0x00490453U,
+    0x0049046BU,
+    0x0049046FU,
+    0x004904C6U,
+    0x004904D4U,
+    0x004904F3U,
+    0x0049052CU,
+    0x0049052EU,
+    0x00490565U,
+    0x004905A1U,
+    0x004905B3U,
+    0x004905CBU,
+    0x004905D4U,
+    0x00490605U,
+    0x00490613U,
+    0x00490693U,
+    0x004906C5U,
+    0x004906ECU,
+    0x004906EEU,
+    0x004906F3U,
+    0x00490733U,
+    0x00491424U,
+    0x0049142DU,
+    0x00491432U,
+    0x0049146BU,
+    0x004914A4U,
+    0x004914B2U,
+    0x004914B3U,
+    0x004914F3U,
+    0x00491573U,
+    0x004915D4U,
+    0x00491645U,
+    0x00491673U,
+    0x00491674U,
+    0x00491733U,
+    0x00492453U,
+    0x00492465U,
+    0x004924A4U,
+    0x004924B2U,
+    0x004924B3U,
+    0x004924D4U,
+    0x0049258CU,
+    0x00492599U,
+    0x004925CBU,
+    0x00492613U,
+    0x00492614U,
+    0x004926C5U,
+    0x00493D24U,
+    0x00493D2CU,
+    0x00493D34U,
+    0x00493D65U,
+    0x00493D85U,
+    0x00493D8CU,
+    0x00493DA5U,
+    0x00493DC5U,
+    0x00493DD9U,
+    0x00493DE2U,
+    0x00493DE7U,
+    0x00493DEBU,
+    0x00493DECU,
+    0x00493DF0U,
+    0x00493E13U,
+    0x00493E14U,
+    0x00493E73U,
+    0x00493EABU,
+    0x00493EC5U,
+    0x00493EEEU,
+    0x00493EF3U,
+    0x00495453U,
+    0x004954F3U,
+    0x00495524U,
+    0x004955B3U,
+    0x004955CBU,
+    0x00495605U,
+    0x00495665U,
+    0x00495679U,
+    0x00495719U,
+    0x00496424U,
+    0x00496433U,
+    0x004964B2U,
+    0x00496599U,
+    0x0049BC4FU,
+    0x0049BDAFU,
+    0x004A8493U,
+    0x004A8593U,
+    0x004A85D3U,
+    0x004A8653U,
+    0x004A884FU,
+    0x004A8C2CU,
+    0x004A8C34U,
+    0x004A8CB3U,
+    0x004A8D19U,
+    0x004A8D73U,
+    0x004A8D79U,
+    0x004A8E93U,
+    0x004A9099U,
+    0x004A90A4U,
+    0x004A90B3U,
+    0x004A9593U,
+    0x004A9693U,
+    0x004A9694U,
+    0x004A98D3U,
+    0x004A9AB3U,
+    0x004AA5C7U,
+    0x004AA693U,
+    0x004AAC33U,
+    0x004AACA4U,
+    0x004AACB3U,
+    0x004AAD61U,
+    0x004AB065U,
+    0x004AB0B3U,
+    0x004AB121U,
+    0x004AB193U,
+    0x004AB199U,
+    0x004AB265U,
+    0x004AB433U,
+    0x004AB44FU,
+    0x004AB453U,
+    0x004AB561U,
+    0x004AB579U,
+    0x004AB5B9U,
+    0x004AB613U,
+    0x004AB619U,
+    0x004AB82DU,
+    0x004AB865U,
+    0x004AB868U,
+    0x004AB8B3U,
+    0x004AB8F3U,
+    0x004AB8F9U,
+    0x004AB973U,
+    0x004AB9CFU,
+    0x004AB9D9U,
+    0x004ABA68U,
+    0x004ABA93U,
+    0x004ABDA9U,
+    0x004ABDAFU,
+    0x004AC0A4U,
+    0x004AC0B2U,
+    0x004AC0B3U,
+    0x004AC185U,
+    0x004AC199U,
+    0x004AC219U,
+    0x004AC82CU,
+    0x004AC833U,
+    0x004AC8A4U,
+    0x004AC8B3U,
+    0x004AC8F9U,
+    0x004AC9D3U,
+    0x004AC9E3U,
+    0x004AC9F3U,
+    0x004AC9F9U,
+    0x004ACA41U,
+    0x004ACA53U,
+    0x004ACA59U,
+    0x004ACA74U,
+    0x004ACAADU,
+    0x004ACB49U,
+    0x004ACD73U,
+    0x004ACD79U,
+    0x004ACE93U,
+    0x004ACE99U,
+    0x004AD068U,
+    0x004AD8B4U,
+    0x004AE0B3U,
+    0x004B842CU,
+    0x004B8585U,
+    0x004B858DU,
+    0x004B85B3U,
+    0x004B85C7U,
+    0x004B8646U,
+    0x004B86ADU,
+    0x004B94A2U,
+    0x004B958CU,
+    0x004B9594U,
+    0x004BA585U,
+    0x004BA5C5U,
+    0x004C8493U,
+    0x004C9653U,
+    0x004CA5C7U,
+    0x004CADEEU,
+    0x004CB8ACU,
+    0x004CB8B3U,
+    0x004D21F3U,
+    0x00509CB2U,
+    0x00509D85U,
+    0x00509E45U,
+    0x0050B0A4U,
+    0x0050B0B3U,
+    0x0050B8A4U,
+    0x0050C893U,
+    0x0050C8A4U,
+    0x0050C993U,
+    0x0050C999U,
+    0x0050C9D3U,
+    0x0050C9D4U,
+    0x0050CA74U,
+    0x0050CA88U,
+    0x0050CCA4U,
+    0x0050CCACU,
+    0x0050CCB2U,
+    0x0050CCB3U,
+    0x0050CD85U,
+    0x0050CE93U,
+    0x0050D0AEU,
+    0x0050D0B2U,
+    0x0050D105U,
+    0x0050D8A4U,
+    0x0050D8B3U,
+    0x005108A4U,
+    0x005108B4U,
+    0x00513DD3U,
+    0x00513DD9U,
+    0x00513DEBU,
+    0x00518493U,
+    0x0051A0A4U,
+    0x0051A0B3U,
+    0x0051A1F3U,
+    0x0051B034U,
+    0x0051CAB3U,
+    0x005215A1U,
+    0x00521CA4U,
+    0x00521CB2U,
+    0x00521CB3U,
+    0x00522474U,
+    0x005224D9U,
+    0x00522585U,
+    0x00522693U,
+    0x00525465U,
+    0x00525474U,
+    0x0052A934U,
+    0x0052BA79U,
+    0x0052C925U,
+    0x0052D8AEU,
+    0x0052D9D3U,
+    0x005318A4U,
+    0x00538493U,
+    0x00539653U,
+    0x00539674U,
+    0x00539C32U,
+    0x00539CA4U,
+    0x00539CB2U,
+    0x0053B433U,
+    0x0053C8B4U,
+    0x005425C7U,
+    0x005490B2U,
+    0x005491F3U,
+    0x00549D14U,
+    0x00549DC5U,
+    0x0054ACA4U,
+    0x0054ADEEU,
+    0x0054B093U,
+    0x0054CCACU,
+    0x00551474U,
+    0x0055248FU,
+    0x0055A5C7U,
+    0x0055AC33U,
+    0x0056052EU,
+    0x005605C4U,
+    0x005605D3U,
+    0x00560685U,
+    0x005609F7U,
+    0x00560D09U,
+    0x005610B2U,
+    0x0056112EU,
+    0x00561474U,
+    0x005614F9U,
+    0x005615A9U,
+    0x005618A4U,
+    0x0056192EU,
+    0x00562424U,
+    0x00562485U,
+    0x005625D4U,
+    0x00562685U,
+    0x005634AEU,
+    0x00563CE5U,
+    0x00563CF9U,
+    0x00563D2EU,
+    0x00563E05U,
+    0x00563E13U,
+    0x005640A5U,
+    0x00564D2EU,
+    0x00565485U,
+    0x00565685U,
+    0x0056582EU,
+    0x005658AEU,
+    0x005658B2U,
+    0x005658B3U,
+    0x00568473U,
+    0x0056852CU,
+    0x00568832U,
+    0x00568839U,
+    0x005688A4U,
+    0x005688B2U,
+    0x005689E7U,
+    0x005689F7U,
+    0x005689F8U,
+    0x00568AB3U,
+    0x00568CA5U,
+    0x005694B2U,
+    0x005695C4U,
+    0x00569647U,
+    0x00569659U,
+    0x005696B3U,
+    0x0056A473U,
+    0x0056A653U,
+    0x0056A693U,
+    0x0056B433U,
+    0x0056B4B2U,
+    0x0056B4B4U,
+    0x0056B4B7U,
+    0x0056B733U,
+    0x0056BD49U,
+    0x0056BDC7U,
+    0x0056BE85U,
+    0x0056BEC5U,
+    0x0056C293U,
+    0x0056C299U,
+    0x0056D585U,
+    0x0056D645U,
+    0x0056E485U,
+    0x0056E493U,
+    0x00570474U,
+    0x0057064DU,
+    0x00570685U,
+    0x005710A4U,
+    0x005710B2U,
+    0x005710B7U,
+    0x005711F7U,
+    0x005712A5U,
+    0x005715A1U,
+    0x005715B9U,
+    0x005716F3U,
+    0x00571938U,
+    0x00572423U,
+    0x005729F9U,
+    0x00573134U,
+    0x005734B7U,
+    0x005739E7U,
+    0x00573AA9U,
+    0x00573D69U,
+    0x00573D93U,
+    0x00573E4DU,
+    0x00573EF3U,
+    0x005749ECU,
+    0x00574CB7U,
+    0x00574D79U,
+    0x00574EA5U,
+    0x005750B2U,
+    0x00575121U,
+    0x00575259U,
+    0x00575645U,
+    0x0057564EU,
+    0x005759E9U,
+    0x005759F9U,
+    0x00576B2DU,
+    0x0057C993U,
+    0x0057CD2EU,
+    0x00580474U,
+    0x005814B3U,
+    0x00582028U,
+    0x00582033U,
+    0x005821E4U,
+    0x005821F2U,
+    0x00582473U,
+    0x00583C68U,
+    0x00583C85U,
+    0x00583E14U,
+    0x00583F19U,
+    0x00584933U,
+    0x0058D42CU,
+    0x0058D4B3U,
+    0x0058D524U,
+    0x0058D530U,
+    0x00590665U,
+    0x00590921U,
+    0x00591474U,
+    0x005916D3U,
+    0x00591DEEU,
+    0x00591DF3U,
+    0x00591DF4U,
+    0x005922B3U,
+    0x00592461U,
+    0x0059246BU,
+    0x00592473U,
+    0x005925C7U,
+    0x005938A4U,
+    0x005938B3U,
+    0x00593C85U,
+    0x00593E65U,
+    0x005948A4U,
+    0x005949F2U,
+    0x00594CB3U,
+    0x00595474U,
+    0x005954EFU,
+    0x00595614U,
+    0x005956D3U,
+    0x005958AEU,
+    0x0059592CU,
+    0x00598C32U,
+    0x00598DF4U,
+    0x0059A585U,
+    0x0059AC32U,
+    0x0059ACB2U,
+    0x0059B8B3U,
+    0x0059CC39U,
+    0x0059CCB3U,
+    0x0059D0B2U,
+    0x0059D1E3U,
+    0x0059D1F0U,
+    0x0059D24FU,
+    0x005A04E5U,
+    0x005A0605U,
+    0x005A0693U,
+    0x005A15D3U,
+    0x005A202CU,
+    0x005A20B2U,
+    0x005A2123U,
+    0x005A21C5U,
+    0x005A21F3U,
+    0x005A232CU,
+    0x005A2473U,
+    0x005A3833U,
+    0x005A512EU,
+    0x005A5185U,
+    0x005A5485U,
+    0x005A5533U,
+    0x005A5CA5U,
+    0x005A65A1U,
+    0x005A9D13U,
+    0x005AACA4U,
+    0x005AC024U,
+    0x005AC9F3U,
+    0x005ACDECU,
+    0x005B0485U,
+    0x005B15D3U,
+    0x005B15D4U,
+    0x005B1654U,
+    0x005B1659U,
+    0x005B1693U,
+    0x005B21E5U,
+    0x005B2474U,
+    0x005B2593U,
+    0x005B2685U,
+    0x005B3D05U,
+    0x005B3D65U,
+    0x005B9653U,
+    0x005B9674U,
+    0x005BA1F7U,
+    0x005BACA4U,
+    0x005C0474U,
+    0x005C0594U,
+    0x005C05B3U,
+    0x005C0CACU,
+    0x005C1434U,
+    0x005C1473U,
+    0x005C14ADU,
+    0x005C15A5U,
+    0x005C1654U,
+    0x005C192CU,
+    0x005C24B3U,
+    0x005C2585U,
+    0x005C25C5U,
+    0x005C25C7U,
+    0x005C2674U,
+    0x005C2693U,
+    0x005C3C85U,
+    0x005C3DA5U,
+    0x005C3DD3U,
+    0x005C4034U,
+    0x005C40ACU,
+    0x005C41F3U,
+    0x005C51ECU,
+    0x005C5241U,
+    0x005C5485U,
+    0x005C5593U,
+    0x005C5594U,
+    0x005C5642U,
+    0x005C8673U,
+    0x005C9653U,
+    0x005CA5C7U,
+    0x005CBE93U,
+    0x005CC833U,
+    0x005CC8B3U,
+    0x005CC925U,
+    0x005CC932U,
+    0x005D25C5U,
+    0x00608859U,
+    0x00608985U,
+    0x00608CA4U,
+    0x00608CB2U,
+    0x00608CB3U,
+    0x00608CB4U,
+    0x00608D21U,
+    0x00608E81U,
+    0x00608E93U,
+    0x00609099U,
+    0x006090A4U,
+    0x006090B2U,
+    0x006090B3U,
+    0x006090E5U,
+    0x006091F3U,
+    0x006095C1U,
+    0x00609659U,
+    0x006098D3U,
+    0x006098D9U,
+    0x00609D2EU,
+    0x0060A573U,
+    0x0060A593U,
+    0x0060A5C5U,
+    0x0060A5D3U,
+    0x0060A5D4U,
+    0x0060A653U,
+    0x0060A659U,
+    0x0060A688U,
+    0x0060ACA4U,
+    0x0060ACB2U,
+    0x0060ACB3U,
+    0x0060ACB9U,
+    0x0060AD25U,
+    0x0060AD32U,
+    0x0060B02AU,
+    0x0060B193U,
+    0x0060B265U,
+    0x0060B4A4U,
+    0x0060B4B3U,
+    0x0060B82CU,
+    0x0060B879U,
+    0x0060B893U,
+    0x0060B8B3U,
+    0x0060B8E1U,
+    0x0060B8EFU,
+    0x0060B8F3U,
+    0x0060B973U,
+    0x0060B9D9U,
+    0x0060B9EEU,
+    0x0060B9F3U,
+    0x0060BAADU,
+    0x0060C532U,
+    0x0060C824U,
+    0x0060C865U,
+    0x0060C869U,
+    0x0060C879U,
+    0x0060C893U,
+    0x0060C8A4U,
+    0x0060C8B2U,
+    0x0060C8B3U,
+    0x0060C985U,
+    0x0060C993U,
+    0x0060C9B3U,
+    0x0060C9F3U,
+    0x0060CA4FU,
+    0x0060CA65U,
+    0x0060CA93U,
+    0x0060CC69U,
+    0x0060CE89U,
+    0x0060CE93U,
+    0x0060D02CU,
+    0x0060D0A4U,
+    0x0060D0B3U,
+    0x0060D199U,
+    0x0060D26FU,
+    0x0060D299U,
+    0x0060D2E1U,
+    0x0060D4E8U,
+    0x0060D584U,
+    0x0060D594U,
+    0x0060D5C1U,
+    0x0060D5D3U,
+    0x0060D644U,
+    0x0060D693U,
+    0x0060D6C5U,
+    0x0060D833U,
+    0x0060D8ACU,
+    0x0060D8B2U,
+    0x0060D8B3U,
+    0x0060D9F2U,
+    0x0060DAB3U,
+    0x0060DDD3U,
+    0x0060DDD9U,
+    0x0060E0A4U,
+    0x0060E0B3U,
+    0x0060E4A4U,
+    0x0060E4B2U,
+    0x0060E5C5U,
+    0x0060E645U,
+    0x0060E8A4U,
+    0x0060E8B3U,
+    0x00628593U,
+    0x00628645U,
+    0x00628653U,
+    0x00628654U,
+    0x00628665U,
+    0x00628674U,
+    0x00628693U,
+    0x00628745U,
+    0x00628C2CU,
+    0x00628CB3U,
+    0x00628D14U,
+    0x00628D34U,
+    0x00628D73U,
+    0x006290B8U,
+    0x00629453U,
+    0x00629493U,
+    0x00629593U,
+    0x006295D3U,
+    0x00629653U,
+    0x00629665U,
+    0x00629745U,
+    0x0062A1A5U,
+    0x0062A4EEU,
+    0x0062A5D4U,
+    0x0062A674U,
+    0x0062B068U,
+    0x0062B124U,
+    0x0062B181U,
+    0x0062B193U,
+    0x0062B199U,
+    0x0062B1EEU,
+    0x0062B293U,
+    0x0062B299U,
+    0x0062B42CU,
+    0x0062B4B3U,
+    0x0062B5A5U,
+    0x0062B5B9U,
+    0x0062B6B2U,
+    0x0062B865U,
+    0x0062B893U,
+    0x0062B899U,
+    0x0062B933U,
+    0x0062B973U,
+    0x0062B9D9U,
+    0x0062BA93U,
+    0x0062BC93U,
+    0x0062BCC6U,
+    0x0062C82CU,
+    0x0062C8B2U,
+    0x0062C8B3U,
+    0x0062C921U,
+    0x0062C999U,
+    0x0062C9A9U,
+    0x0062C9B3U,
+    0x0062C9D3U,
+    0x0062C9D9U,
+    0x0062CA59U,
+    0x0062CE65U,
+    0x0062CE81U,
+    0x0062CE93U,
+    0x0062CE99U,
+    0x0062D02CU,
+    0x0062D033U,
+    0x0062D068U,
+    0x0062D0A4U,
+    0x0062D0B3U,
+    0x0062D124U,
+    0x0062D1F2U,
+    0x0062D281U,
+    0x0062D293U,
+    0x0062D2B3U,
+    0x0062D2E1U,
+    0x0062D432U,
+    0x0062D493U,
+    0x0062D4A4U,
+    0x0062D8B2U,
+    0x0062DCB2U,
+    0x0062E4A4U,
+    0x0062E4B2U,
+    0x0062E599U,
+    0x0062E8B3U,
+    0x0062EB59U,
+    0x00648653U,
+    0x00648693U,
+    0x006488B2U,
+    0x00648A4FU,
+    0x00648CB3U,
+    0x00648D05U,
+    0x00648D15U,
+    0x00648D2EU,
+    0x00648DF3U,
+    0x00648EB3U,
+    0x006490B3U,
+    0x006490E5U,
+    0x006491F3U,
+    0x006494D3U,
+    0x00649584U,
+    0x006495C4U,
+    0x006495D4U,
+    0x00649645U,
+    0x00649653U,
+    0x00649659U,
+    0x00649674U,
+    0x006498A4U,
+    0x006498B2U,
+    0x006498B3U,
+    0x00649933U,
+    0x00649A88U,
+    0x00649A99U,
+    0x00649CF9U,
+    0x00649D14U,
+    0x00649DF3U,
+    0x0064ACA4U,
+    0x0064ACB3U,
+    0x0064B032U,
+    0x0064B068U,
+    0x0064B0A4U,
+    0x0064B0B2U,
+    0x0064B0B3U,
+    0x0064B0B4U,
+    0x0064B129U,
+    0x0064B173U,
+    0x0064B185U,
+    0x0064B18FU,
+    0x0064B193U,
+    0x0064B199U,
+    0x0064B1A9U,
+    0x0064B1B3U,
+    0x0064B1B9U,
+    0x0064B1F3U,
+    0x0064B288U,
+    0x0064B2ADU,
+    0x0064B82CU,
+    0x0064B861U,
+    0x0064B868U,
+    0x0064B893U,
+    0x0064B8A4U,
+    0x0064B8B2U,
+    0x0064B8B3U,
+    0x0064B933U,
+    0x0064B973U,
+    0x0064B9D9U,
+    0x0064B9F3U,
+    0x0064BE44U,
+    0x0064C513U,
+    0x0064C6A5U,
+    0x0064C8A4U,
+    0x0064C8B2U,
+    0x0064C8B3U,
+    0x0064C925U,
+    0x0064C973U,
+    0x0064C9B3U,
+    0x0064C9D3U,
+    0x0064CA59U,
+    0x0064CA74U,
+    0x0064CA88U,
+    0x0064CC73U,
+    0x0064CD19U,
+    0x0064CD73U,
+    0x0064CE93U,
+    0x0064CE99U,
+    0x0064D068U,
+    0x0064D199U,
+    0x0064D1C1U,
+    0x0064D285U,
+    0x0064D293U,
+    0x0064D8B2U,
+    0x0064D8B3U,
+    0x0064E0A4U,
+    0x0064E0B2U,
+    0x0064E0B3U,
+    0x0064E134U,
+    0x0064EB59U,
+    0x00651584U,
+    0x00653E44U,
+    0x00660453U,
+    0x0066046BU,
+    0x006604C6U,
+    0x006604F3U,
+    0x0066052CU,
+    0x00660532U,
+    0x00660565U,
+    0x00660573U,
+    0x00660579U,
+    0x006605A5U,
+    0x006605ADU,
+    0x006605B3U,
+    0x006605B9U,
+    0x006605C5U,
+    0x006605CBU,
+    0x006605D3U,
+    0x00660613U,
+    0x00660645U,
+    0x00660659U,
+    0x00660668U,
+    0x0066066BU,
+    0x00660693U,
+    0x006606C1U,
+    0x006606EEU,
+    0x006606F3U,
+    0x006606F9U,
+    0x00660719U,
+    0x00660733U,
+    0x0066142DU,
+    0x00661433U,
+    0x0066146BU,
+    0x006614ABU,
+    0x006614B2U,
+    0x006614B3U,
+    0x006614B4U,
+    0x006614F3U,
+    0x006615A5U,
+    0x00661668U,
+    0x006616B2U,
+    0x006616F3U,
+    0x00661709U,
+    0x0066170FU,
+    0x00661733U,
+    0x0066246BU,
+    0x00662473U,
+    0x006624A4U,
+    0x006624B2U,
+    0x006624B3U,
+    0x006625B0U,
+    0x006625B3U,
+    0x006625C7U,
+    0x006625D4U,
+    0x00662613U,
+    0x00662653U,
+    0x00662654U,
+    0x0066266BU,
+    0x00662685U,
+    0x00662693U,
+    0x00662694U,
+    0x00663C34U,
+    0x00663C53U,
+    0x00663C6BU,
+    0x00663C73U,
+    0x00663CB3U,
+    0x00663CF3U,
+    0x00663DC7U,
+    0x00663DE4U,
+    0x00663DF2U,
+    0x00663E13U,
+    0x00663E41U,
+    0x00663E53U,
+    0x00663E59U,
+    0x00663E68U,
+    0x00663E73U,
+    0x00663E81U,
+    0x00663E85U,
+    0x00663EB2U,
+    0x00663EB4U,
+    0x00663EEEU,
+    0x00663EF3U,
+    0x00665453U,
+    0x006654A4U,
+    0x006654B3U,
+    0x006654B9U,
+    0x006654C6U,
+    0x00665524U,
+    0x00665565U,
+    0x00665579U,
+    0x006655A5U,
+    0x006655B0U,
+    0x006655C7U,
+    0x006655CBU,
+    0x006655F2U,
+    0x00665652U,
+    0x00665668U,
+    0x00665685U,
+    0x00665699U,
+    0x00665734U,
+    0x00666459U,
+    0x006664B2U,
+    0x00666605U,
+    0x00666685U,
+    0x00678593U,
+    0x006785B3U,
+    0x006785B9U,
+    0x00678C2CU,
+    0x00678EB3U,
+    0x0067950EU,
+    0x00679CB9U,
+    0x00679CF9U,
+    0x00679D25U,
+    0x00679D85U,
+    0x00679DF5U,
+    0x0067A1D3U,
+    0x0067A493U,
+    0x0067A593U,
+    0x0067A5D3U,
+    0x0067A674U,
+    0x0067B093U,
+    0x0067B0B9U,
+    0x0067B121U,
+    0x0067B123U,
+    0x0067B125U,
+    0x0067B12FU,
+    0x0067B173U,
+    0x0067B179U,
+    0x0067B199U,
+    0x0067B4B3U,
+    0x0067B881U,
+    0x0067B893U,
+    0x0067B895U,
+    0x0067B8B3U,
+    0x0067B999U,
+    0x0067BA93U,
+    0x0067BC93U,
+    0x0067BC99U,
+    0x0067BD93U,
+    0x0067BE93U,
+    0x0067BE99U,
+    0x0067C82DU,
+    0x0067C839U,
+    0x0067C853U,
+    0x0067C859U,
+    0x0067C865U,
+    0x0067C88FU,
+    0x0067C893U,
+    0x0067C8ACU,
+    0x0067C8B3U,
+    0x0067C8B8U,
+    0x0067C8E5U,
+    0x0067C8EFU,
+    0x0067C973U,
+    0x0067C979U,
+    0x0067C9A5U,
+    0x0067C9B3U,
+    0x0067CA85U,
+    0x0067CA88U,
+    0x0067CA93U,
+    0x0067CA99U,
+    0x0067CAADU,
+    0x0067CB41U,
+    0x0067CB45U,
+    0x0067CE61U,
+    0x0067CE65U,
+    0x0067D434U,
+    0x0067D493U,
+    0x0067D4B2U,
+    0x0067D4B4U,
+    0x0067D585U,
+    0x0067D593U,
+    0x0067D5C4U,
+    0x0067D5D4U,
+    0x0067D653U,
+    0x0067D688U,
+    0x0067D8A1U,
+    0x0067DD93U,
+    0x0067DE88U,
+    0x0067E0A4U,
+    0x0067E0B3U,
+    0x0067E125U,
+    0x0067E4B2U,
+    0x0067E585U,
+    0x0067E5C5U,
+    0x00690453U,
+    0x0069046BU,
+    0x00690474U,
+    0x006904F3U,
+    0x0069052CU,
+    0x0069052DU,
+    0x006905A5U,
+    0x006905C3U,
+    0x006905CBU,
+    0x00690605U,
+    0x00690613U,
+    0x00690673U,
+    0x00690685U,
+    0x00690689U,
+    0x00690693U,
+    0x006906A4U,
+    0x006906B3U,
+    0x00690733U,
+    0x0069142BU,
+    0x006914A4U,
+    0x006914B2U,
+    0x006914B3U,
+    0x006914B4U,
+    0x00691534U,
+    0x006915A4U,
+    0x006915C1U,
+    0x006915EEU,
+    0x00691645U,
+    0x00691668U,
+    0x00691693U,
+    0x00692432U,
+    0x00692453U,
+    0x006924A4U,
+    0x006924B2U,
+    0x006924B3U,
+    0x006924F3U,
+    0x0069258CU,
+    0x00692665U,
+    0x0069266BU,
+    0x00692674U,
+    0x00692688U,
+    0x00692693U,
+    0x00692694U,
+    0x0069269AU,
+    0x00692745U,
+    0x0069275AU,
+    0x00693C6BU,
+    0x00693CB3U,
+    0x00693CF3U,
+    0x00693DC4U,
+    0x00693DD3U,
+    0x00693DD4U,
+    0x00693E45U,
+    0x00693E4EU,
+    0x00693E59U,
+    0x00693E68U,
+    0x00693E74U,
+    0x00693E88U,
+    0x00693EEEU,
+    0x00693EF3U,
+    0x00693EF9U,
+    0x00693F45U,
+    0x006954F3U,
+    0x00695534U,
+    0x006955B0U,
+    0x00695668U,
+    0x00695674U,
+    0x006964B2U,
+    0x006A8832U,
+    0x006A8859U,
+    0x006A8A79U,
+    0x006A8D73U,
+    0x006A8EB3U,
+    0x006A9099U,
+    0x006A90E5U,
+    0x006A90F9U,
+    0x006A9593U,
+    0x006A964FU,
+    0x006A98D3U,
+    0x006A98D9U,
+    0x006A9C2CU,
+    0x006A9CF9U,
+    0x006A9D25U,
+    0x006A9D2FU,
+    0x006A9D85U,
+    0x006A9D99U,
+    0x006A9EA5U,
+    0x006A9EB3U,
+    0x006AA933U,
+    0x006AB193U,
+    0x006AB199U,
+    0x006AB4A4U,
+    0x006AB4B2U,
+    0x006AB4B3U,
+    0x006AB4B4U,
+    0x006AB889U,
+    0x006AB893U,
+    0x006AB899U,
+    0x006AB8E9U,
+    0x006AB8EFU,
+    0x006AB8F3U,
+    0x006AB973U,
+    0x006AB979U,
+    0x006AB9D9U,
+    0x006AC82CU,
+    0x006AC82EU,
+    0x006AC861U,
+    0x006AC993U,
+    0x006AC9ECU,
+    0x006AC9F2U,
+    0x006ACA53U,
+    0x006ACA59U,
+    0x006ACA88U,
+    0x006ACB45U,
+    0x006ACB59U,
+    0x006ACCA4U,
+    0x006ACCA5U,
+    0x006ACCACU,
+    0x006ACCB3U,
+    0x006ACD2CU,
+    0x006ACD73U,
+    0x006ACE79U,
+    0x006ACE93U,
+    0x006ACE99U,
+    0x006AD1EEU,
+    0x006AE8A4U,
+    0x006AE8A5U,
+    0x006AE8B3U,
+    0x006AE92CU,
+    0x006AEB59U,
+    0x006C8CB3U,
+    0x006CACA4U,
+    0x006CACB3U,
+    0x006CB0B3U,
+    0x006CC893U,
+    0x006CD285U,
+    0x00708841U,
+    0x00708859U,
+    0x00708985U,
+    0x00709089U,
+    0x007090B3U,
+    0x007090E5U,
+    0x00709124U,
+    0x00709133U,
+    0x00709145U,
+    0x0070914FU,
+    0x0070926FU,
+    0x007098C5U,
+    0x007098D3U,
+    0x00709CA4U,
+    0x00709CB2U,
+    0x00709CB3U,
+    0x0070A493U,
+    0x0070A599U,
+    0x0070A5D3U,
+    0x0070A653U,
+    0x0070A681U,
+    0x0070A693U,
+    0x0070A694U,
+    0x0070A9F3U,
+    0x0070B028U,
+    0x0070B033U,
+    0x0070B038U,
+    0x0070B0A1U,
+    0x0070B0A4U,
+    0x0070B0B3U,
+    0x0070B193U,
+    0x0070B199U,
+    0x0070B1F0U,
+    0x0070B2B4U,
+    0x0070B2CFU,
+    0x0070B433U,
+    0x0070B439U,
+    0x0070B441U,
+    0x0070B445U,
+    0x0070B44FU,
+    0x0070B453U,
+    0x0070B4A4U,
+    0x0070B4B2U,
+    0x0070B4B3U,
+    0x0070B4B9U,
+    0x0070B523U,
+    0x0070B52EU,
+    0x0070B5A1U,
+    0x0070B5A5U,
+    0x0070B5B9U,
+    0x0070B613U,
+    0x0070B6B4U,
+    0x0070B868U,
+    0x0070B899U,
+    0x0070B8A6U,
+    0x0070B8B6U,
+    0x0070B8F3U,
+    0x0070B941U,
+    0x0070B9E6U,
+    0x0070BA93U,
+    0x0070BD93U,
+    0x0070C0A4U,
+    0x0070C0B2U,
+    0x0070C0B3U,
+    0x0070C1F3U,
+    0x0070C219U,
+    0x0070C845U,
+    0x0070C84FU,
+    0x0070C853U,
+    0x0070C881U,
+    0x0070C8B3U,
+    0x0070C933U,
+    0x0070C9B3U,
+    0x0070C9C9U,
+    0x0070CA45U,
+    0x0070CA88U,
+    0x0070CAADU,
+    0x0070CCB3U,
+    0x0070CE13U,
+    0x0070CE19U,
+    0x0070CE79U,
+    0x0070CE93U,
+    0x0070D068U,
+    0x0070D0A4U,
+    0x0070D0B2U,
+    0x0070D0B3U,
+    0x0070D113U,
+    0x0070D1F2U,
+    0x0070D468U,
+    0x0070D479U,
+    0x0070D493U,
+    0x0070D499U,
+    0x0070D4E5U,
+    0x0070D545U,
+    0x0070D594U,
+    0x0070D5B3U,
+    0x0070D5B9U,
+    0x0070D5D4U,
+    0x0070D613U,
+    0x0070D653U,
+    0x0070D673U,
+    0x0070D745U,
+    0x0070D759U,
+    0x0070D8ACU,
+    0x0070D9F4U,
+    0x0070DC79U,
+    0x0070DC93U,
+    0x0070DD73U,
+    0x0070DD79U,
+    0x0070DE13U,
+    0x0070DE79U,
+    0x0070E42CU,
+    0x0070E4B2U,
+    0x0070E599U,
+    0x0070E82CU,
+    0x0070E832U,
+    0x0070E8A4U,
+    0x0070E8B2U,
+    0x0070E8B3U,
+    0x0070E9EEU,
+    0x0070E9EFU,
+    0x00728593U,
+    0x007285D3U,
+    0x00728645U,
+    0x00728653U,
+    0x00728693U,
+    0x00728AB2U,
+    0x00728D6FU,
+    0x00728D73U,
+    0x00729573U,
+    0x00729579U,
+    0x00729613U,
+    0x00729665U,
+    0x00729674U,
+    0x0072A674U,
+    0x0072A693U,
+    0x0072B093U,
+    0x0072B0A5U,
+    0x0072B124U,
+    0x0072B199U,
+    0x0072B293U,
+    0x0072B4ACU,
+    0x0072B5A1U,
+    0x0072B5B9U,
+    0x0072B5F4U,
+    0x0072B82CU,
+    0x0072B833U,
+    0x0072B8B3U,
+    0x0072B8B4U,
+    0x0072B923U,
+    0x0072B925U,
+    0x0072B929U,
+    0x0072B930U,
+    0x0072B9D9U,
+    0x0072B9E1U,
+    0x0072B9EDU,
+    0x0072BA45U,
+    0x0072BA4FU,
+    0x0072BA93U,
+    0x0072BA99U,
+    0x0072BAA1U,
+    0x0072BAB3U,
+    0x0072BC85U,
+    0x0072BD24U,
+    0x0072C828U,
+    0x0072C845U,
+    0x0072C8B3U,
+    0x0072C985U,
+    0x0072C9B3U,
+    0x0072C9B9U,
+    0x0072C9C5U,
+    0x0072CE65U,
+    0x0072CE6FU,
+    0x0072CE85U,
+    0x0072CE93U,
+    0x0072D033U,
+    0x0072D2B0U,
+    0x0072D5B3U,
+    0x0072E42EU,
+    0x0072E4B2U,
+    0x00740674U,
+    0x00740693U,
+    0x007406B4U,
+    0x00740749U,
+    0x007414B3U,
+    0x00741674U,
+    0x00743E74U,
+    0x00743EACU,
+    0x0074658CU,
+    0x007485D4U,
+    0x007488A4U,
+    0x007488ACU,
+    0x007488B2U,
+    0x007488B3U,
+    0x00748989U,
+    0x00748AB3U,
+    0x00749099U,
+    0x00749A93U,
+    0x00749C33U,
+    0x00749D05U,
+    0x00749DF4U,
+    0x00749EA5U,
+    0x0074B033U,
+    0x0074B093U,
+    0x0074B0B4U,
+    0x0074B193U,
+    0x0074B199U,
+    0x0074B219U,
+    0x0074B293U,
+    0x0074B4ACU,
+    0x0074B5A5U,
+    0x0074B613U,
+    0x0074B619U,
+    0x0074B868U,
+    0x0074B8E5U,
+    0x0074B8F3U,
+    0x0074B973U,
+    0x0074B9D9U,
+    0x0074BB4FU,
+    0x0074C1EEU,
+    0x0074C20FU,
+    0x0074C219U,
+    0x0074C279U,
+    0x0074C893U,
+    0x0074C993U,
+    0x0074C999U,
+    0x0074C9D3U,
+    0x0074C9EEU,
+    0x0074C9F3U,
+    0x0074CA53U,
+    0x0074CA68U,
+    0x0074CA88U,
+    0x0074CA93U,
+    0x0074CDAFU,
+    0x0074CDB3U,
+    0x0074CE93U,
+    0x0074D068U,
+    0x0074D0B3U,
+    0x0074D674U,
+    0x0074D8A4U,
+    0x0074D8AEU,
+    0x0074D8B2U,
+    0x0074D8B3U,
+    0x0074E9AFU,
+    0x00760465U,
+    0x00760485U,
+    0x00760493U,
+    0x00760499U,
+    0x0076052BU,
+    0x00760532U,
+    0x007605B3U,
+    0x007605C4U,
+    0x007605D3U,
+    0x00760645U,
+    0x00760659U,
+    0x00760673U,
+    0x007606ADU,
+    0x007606B2U,
+    0x00760745U,
+    0x00760759U,
+    0x0076142DU,
+    0x0076142EU,
+    0x00761441U,
+    0x00761445U,
+    0x00761459U,
+    0x00761485U,
+    0x00761493U,
+    0x007614A4U,
+    0x007614ABU,
+    0x007614B3U,
+    0x007614B4U,
+    0x00761533U,
+    0x007615D3U,
+    0x007615D4U,
+    0x00761733U,
+    0x0076242CU,
+    0x00762433U,
+    0x00762453U,
+    0x00762485U,
+    0x007624C6U,
+    0x007624D4U,
+    0x00762565U,
+    0x007625A5U,
+    0x007625B3U,
+    0x007625D4U,
+    0x0076266BU,
+    0x00762693U,
+    0x0076269AU,
+    0x00763C2DU,
+    0x00763C34U,
+    0x00763C45U,
+    0x00763C49U,
+    0x00763C53U,
+    0x00763C59U,
+    0x00763C85U,
+    0x00763CE7U,
+    0x00763DB3U,
+    0x00763DEDU,
+    0x00763DF0U,
+    0x00763E13U,
+    0x00763E59U,
+    0x00763E73U,
+    0x00763E74U,
+    0x00763EB4U,
+    0x00763EC5U,
+    0x00763EF3U,
+    0x00763F45U,
+    0x007654A4U,
+    0x007654B2U,
+    0x007654B3U,
+    0x007654B9U,
+    0x007654F3U,
+    0x007655A5U,
+    0x007655B3U,
+    0x007655EEU,
+    0x00765685U,
+    0x00765693U,
+    0x00766608U,
+    0x0077064CU,
+    0x00770652U,
+    0x00770653U,
+    0x00770668U,
+    0x00770693U,
+    0x007706EEU,
+    0x007706F3U,
+    0x00773DA5U,
+    0x00773EF3U,
+    0x00778493U,
+    0x007784D3U,
+    0x00778593U,
+    0x00778659U,
+    0x00778693U,
+    0x00778699U,
+    0x0077882EU,
+    0x00778832U,
+    0x00778849U,
+    0x0077884FU,
+    0x00778859U,
+    0x00778933U,
+    0x007789F3U,
+    0x007790B4U,
+    0x00779199U,
+    0x0077926FU,
+    0x00779593U,
+    0x00779653U,
+    0x00779674U,
+    0x00779688U,
+    0x00779699U,
+    0x007798B2U,
+    0x007798D3U,
+    0x00779CE1U,
+    0x00779DF3U,
+    0x0077A4B2U,
+    0x0077A5C7U,
+    0x0077A933U,
+    0x0077B093U,
+    0x0077B099U,
+    0x0077B0ADU,
+    0x0077B0B3U,
+    0x0077B0D3U,
+    0x0077B199U,
+    0x0077B205U,
+    0x0077B213U,
+    0x0077B44FU,
+    0x0077B4B2U,
+    0x0077B601U,
+    0x0077B824U,
+    0x0077B868U,
+    0x0077B8A6U,
+    0x0077B8B2U,
+    0x0077B8F3U,
+    0x0077B921U,
+    0x0077B926U,
+    0x0077B973U,
+    0x0077B9C1U,
+    0x0077B9E6U,
+    0x0077BB33U,
+    0x0077BB4FU,
+    0x0077BC59U,
+    0x0077BC93U,
+    0x0077BC99U,
+    0x0077BCB9U,
+    0x0077BCD3U,
+    0x0077BCD9U,
+    0x0077BCF3U,
+    0x0077BD79U,
+    0x0077BD84U,
+    0x0077BD93U,
+    0x0077BD99U,
+    0x0077BDD3U,
+    0x0077BDD9U,
+    0x0077BE13U,
+    0x0077BE19U,
+    0x0077BE53U,
+    0x0077BE59U,
+    0x0077BE65U,
+    0x0077BE79U,
+    0x0077C02BU,
+    0x0077C12BU,
+    0x0077C82CU,
+    0x0077C833U,
+    0x0077C8A4U,
+    0x0077C8B3U,
+    0x0077C8E5U,
+    0x0077C933U,
+    0x0077C9B3U,
+    0x0077C9B9U,
+    0x0077CA13U,
+    0x0077CA65U,
+    0x0077CA79U,
+    0x0077CD14U,
+    0x0077CE65U,
+    0x0077D068U,
+    0x0077D113U,
+    0x0077D119U,
+    0x0077D281U,
+    0x0077D468U,
+    0x0077D4E5U,
+    0x0077D573U,
+    0x0077D641U,
+    0x0077D644U,
+    0x0077D693U,
+    0x0077D699U,
+    0x0077DC2EU,
+    0x0077DC93U,
+    0x0077DCD3U,
+    0x0077DD73U,
+    0x0077DD93U,
+    0x0077DDD3U,
+    0x0077E0B3U,
+    0x0077E52DU,
+    0x0077E585U,
+    0x0079042CU,
+    0x00790453U,
+    0x00790465U,
+    0x00790485U,
+    0x00790493U,
+    0x007904C6U,
+    0x007904D4U,
+    0x0079052CU,
+    0x0079052EU,
+    0x00790530U,
+    0x007905A1U,
+    0x007905A5U,
+    0x007905B0U,
+    0x007905B3U,
+    0x007905C1U,
+    0x007905C4U,
+    0x007905D3U,
+    0x007905D4U,
+    0x00790605U,
+    0x00790608U,
+    0x00790619U,
+    0x00790670U,
+    0x00790673U,
+    0x00790685U,
+    0x007906C5U,
+    0x007906D3U,
+    0x007906D9U,
+    0x00790733U,
+    0x00790745U,
+    0x00791434U,
+    0x00791445U,
+    0x0079144FU,
+    0x00791465U,
+    0x007914A4U,
+    0x007914ABU,
+    0x007914AEU,
+    0x007914B3U,
+    0x007914B4U,
+    0x007914E5U,
+    0x007914EFU,
+    0x0079152EU,
+    0x007915D3U,
+    0x00791665U,
+    0x007916C5U,
+    0x007916F3U,
+    0x00791733U,
+    0x00792465U,
+    0x00792485U,
+    0x00792493U,
+    0x007924A6U,
+    0x007924C6U,
+    0x007924D4U,
+    0x007924F3U,
+    0x00792565U,
+    0x0079258CU,
+    0x007925A5U,
+    0x007925B9U,
+    0x007925C4U,
+    0x007925D3U,
+    0x007925F4U,
+    0x00792605U,
+    0x00792613U,
+    0x00792614U,
+    0x00792619U,
+    0x00792665U,
+    0x00792674U,
+    0x00792679U,
+    0x00792688U,
+    0x00792693U,
+    0x00792745U,
+    0x00793C2EU,
+    0x00793C34U,
+    0x00793C99U,
+    0x00793CF3U,
+    0x00793D2EU,
+    0x00793D73U,
+    0x00793DA1U,
+    0x00793DC5U,
+    0x00793DE6U,
+    0x00793DEDU,
+    0x00793E05U,
+    0x00793E73U,
+    0x00793E7AU,
+    0x00793E93U,
+    0x00793EA6U,
+    0x00793EB0U,
+    0x00793EB4U,
+    0x00793EC5U,
+    0x00793ED9U,
+    0x00793EECU,
+    0x00793EEEU,
+    0x00793EF3U,
+    0x00794993U,
+    0x00794A4CU,
+    0x00795453U,
+    0x007954A4U,
+    0x007954ACU,
+    0x007954B3U,
+    0x007954C5U,
+    0x007954C6U,
+    0x007955A5U,
+    0x007955B0U,
+    0x007955C4U,
+    0x007955D4U,
+    0x00796465U,
+    0x00796485U,
+    0x00796565U,
+    0x00796605U,
+    0x00796614U,
+    0x007A846FU,
+    0x007A85C1U,
+    0x007A85CFU,
+    0x007A85D3U,
+    0x007A8644U,
+    0x007A8653U,
+    0x007A86C1U,
+    0x007A8D73U,
+    0x007A8D79U,
+    0x007A90B3U,
+    0x007A9673U,
+    0x007A9674U,
+    0x007A98D3U,
+    0x007A9C33U,
+    0x007AA485U,
+    0x007AA493U,
+    0x007AA584U,
+    0x007AA585U,
+    0x007AA594U,
+    0x007AA5B0U,
+    0x007AA64FU,
+    0x007AA665U,
+    0x007AB027U,
+    0x007AB032U,
+    0x007AB033U,
+    0x007AB068U,
+    0x007AB0B3U,
+    0x007AB0B4U,
+    0x007AB0D3U,
+    0x007AB0D9U,
+    0x007AB193U,
+    0x007AB199U,
+    0x007AB208U,
+    0x007AB213U,
+    0x007AB219U,
+    0x007AB44FU,
+    0x007AB5A1U,
+    0x007AB5A9U,
+    0x007AB5B9U,
+    0x007AB613U,
+    0x007AB899U,
+    0x007AB8E5U,
+    0x007AB8F9U,
+    0x007AB973U,
+    0x007AB979U,
+    0x007AB9D9U,
+    0x007AC219U,
+    0x007AC52EU,
+    0x007AC899U,
+    0x007AC8E5U,
+    0x007AC993U,
+    0x007AC999U,
+    0x007AC9D3U,
+    0x007ACA59U,
+    0x007ACA68U,
+    0x007ACAB3U,
+    0x007ACD19U,
+    0x007ACD81U,
+    0x007ACD85U,
+    0x007ACD89U,
+    0x007ACE79U,
+    0x007ACE8FU,
+    0x007ACE93U,
+    0x007ACE99U,
+    0x007AD279U,
+    0x007AD281U,
+    0x007AD299U,
+    0x007AE4A4U,
+    0x007AE585U,
+    0x007AE5F4U,
+    0x007AE665U,
+    0x007BA5C5U,
+    0x007C8593U,
+    0x007C85D3U,
+    0x007C88A4U,
+    0x007C88B3U,
+    0x007C9584U,
+    0x007CB613U,
+    0x007CB825U,
+    0x007CB925U,
+    0x007CB9D9U,
+    0x007CB9F3U,
+    0x007CBF41U,
+    0x007CC1F3U,
+    0x007CC20FU,
+    0x007CC219U,
+    0x007CC279U,
+    0x007CC82CU,
+    0x007CC8A4U,
+    0x007CC8B3U,
+    0x007CC9EEU,
+    0x007CC9F3U,
+    0x007CCAB3U,
+    0x007CD0B3U,
+    0x007CD8A4U,
+    0x007CD8B3U,
+    0x008084D3U,
+    0x00808653U,
+    0x00808934U,
+    0x00808985U,
+    0x00808AB3U,
+    0x00808CABU,
+    0x00808D73U,
+    0x0080902CU,
+    0x008090A4U,
+    0x008090B3U,
+    0x00809149U,
+    0x00809274U,
+    0x008095B3U,
+    0x00809693U,
+    0x008098D3U,
+    0x0080993AU,
+    0x00809A93U,
+    0x00809CF3U,
+    0x0080A033U,
+    0x0080A46BU,
+    0x0080A561U,
+    0x0080A573U,
+    0x0080A575U,
+    0x0080A593U,
+    0x0080A599U,
+    0x0080A5D3U,
+    0x0080A5D4U,
+    0x0080A653U,
+    0x0080A659U,
+    0x0080A688U,
+    0x0080A8B3U,
+    0x0080A933U,
+    0x0080A949U,
+    0x0080AC2DU,
+    0x0080AC33U,
+    0x0080ACA1U,
+    0x0080ACB3U,
+    0x0080AD2DU,
+    0x0080AEB3U,
+    0x0080B02CU,
+    0x0080B0A4U,
+    0x0080B0B2U,
+    0x0080B0B3U,
+    0x0080B0C1U,
+    0x0080B0D3U,
+    0x0080B124U,
+    0x0080B18FU,
+    0x0080B193U,
+    0x0080B1A1U,
+    0x0080B1B3U,
+    0x0080B1EEU,
+    0x0080B1F3U,
+    0x0080B265U,
+    0x0080B293U,
+    0x0080B2C1U,
+    0x0080B2C5U,
+    0x0080B2E1U,
+    0x0080B42CU,
+    0x0080B441U,
+    0x0080B4A4U,
+    0x0080B4B3U,
+    0x0080B5B9U,
+    0x0080B741U,
+    0x0080B830U,
+    0x0080B865U,
+    0x0080B868U,
+    0x0080B893U,
+    0x0080B899U,
+    0x0080B8E9U,
+    0x0080B8F3U,
+    0x0080B973U,
+    0x0080B979U,
+    0x0080BA61U,
+    0x0080BA65U,
+    0x0080BA93U,
+    0x0080BD85U,
+    0x0080BDA1U,
+    0x0080C038U,
+    0x0080C199U,
+    0x0080C209U,
+    0x0080C219U,
+    0x0080C2B3U,
+    0x0080C82DU,
+    0x0080C893U,
+    0x0080C899U,
+    0x0080C8A4U,
+    0x0080C8ADU,
+    0x0080C8B3U,
+    0x0080C92DU,
+    0x0080C973U,
+    0x0080C993U,
+    0x0080C9B3U,
+    0x0080C9D3U,
+    0x0080C9F3U,
+    0x0080CA13U,
+    0x0080CA19U,
+    0x0080CA59U,
+    0x0080CA68U,
+    0x0080CA93U,
+    0x0080CD19U,
+    0x0080CD73U,
+    0x0080CE13U,
+    0x0080CE81U,
+    0x0080CE85U,
+    0x0080CE99U,
+    0x0080D068U,
+    0x0080D0A4U,
+    0x0080D0B2U,
+    0x0080D0B3U,
+    0x0080D101U,
+    0x0080D493U,
+    0x0080D4D3U,
+    0x0080D4E8U,
+    0x0080D584U,
+    0x0080D58DU,
+    0x0080D593U,
+    0x0080D594U,
+    0x0080D5D3U,
+    0x0080D5D4U,
+    0x0080D665U,
+    0x0080D685U,
+    0x0080D8AEU,
+    0x0080D8B2U,
+    0x0080D8B3U,
+    0x0080D9E3U,
+    0x0080DCA4U,
+    0x0080DD73U,
+    0x0080DDB3U,
+    0x0080DE65U,
+    0x0080E4A4U,
+    0x0080E4B2U,
+    0x0080E4B9U,
+    0x0080E585U,
+    0x0080E82EU,
+    0x0080E8A4U,
+    0x0080E8ACU,
+    0x0080E8B2U,
+    0x0080E8B3U,
+    0x00828493U,
+    0x00828499U,
+    0x00828584U,
+    0x00828593U,
+    0x008285A5U,
+    0x00828613U,
+    0x00828619U,
+    0x00828644U,
+    0x00828645U,
+    0x00828653U,
+    0x00828654U,
+    0x00828674U,
+    0x00828688U,
+    0x00828693U,
+    0x008286C5U,
+    0x008286D9U,
+    0x008288AEU,
+    0x008288B3U,
+    0x00828D14U,
+    0x00828D73U,
+    0x008290B2U,
+    0x008290E5U,
+    0x008290F9U,
+    0x00829493U,
+    0x00829499U,
+    0x00829593U,
+    0x00829745U,
+    0x00829A85U,
+    0x00829A93U,
+    0x00829A99U,
+    0x0082A493U,
+    0x0082A4E8U,
+    0x0082A593U,
+    0x0082A653U,
+    0x0082A674U,
+    0x0082A822U,
+    0x0082AA41U,
+    0x0082B0A4U,
+    0x0082B0B3U,
+    0x0082B12FU,
+    0x0082B138U,
+    0x0082B18FU,
+    0x0082B193U,
+    0x0082B1B3U,
+    0x0082B1F3U,
+    0x0082B1F4U,
+    0x0082B213U,
+    0x0082B2C5U,
+    0x0082B42CU,
+    0x0082B4B3U,
+    0x0082B523U,
+    0x0082B52EU,
+    0x0082B613U,
+    0x0082B619U,
+    0x0082B865U,
+    0x0082B868U,
+    0x0082B893U,
+    0x0082B8E5U,
+    0x0082B9C1U,
+    0x0082B9D9U,
+    0x0082BA59U,
+    0x0082BA93U,
+    0x0082C032U,
+    0x0082C853U,
+    0x0082C859U,
+    0x0082C893U,
+    0x0082C8B3U,
+    0x0082C993U,
+    0x0082C9A1U,
+    0x0082C9B3U,
+    0x0082C9D3U,
+    0x0082C9EEU,
+    0x0082C9F3U,
+    0x0082CA59U,
+    0x0082CA65U,
+    0x0082CA9AU,
+    0x0082CB25U,
+    0x0082CE13U,
+    0x0082CE93U,
+    0x0082D0B3U,
+    0x0082D113U,
+    0x0082D468U,
+    0x0082D4E8U,
+    0x0082D8A1U,
+    0x0082DCA4U,
+    0x0082DCB2U,
+    0x0082DCE8U,
+    0x0082E024U,
+    0x0082E0A4U,
+    0x0082E0B2U,
+    0x0082E0B3U,
+    0x0082E32CU,
+    0x0082E4A4U,
+    0x008485D4U,
+    0x00848D73U,
+    0x008490A4U,
+    0x008490B2U,
+    0x008490B3U,
+    0x008495B3U,
+    0x00849D13U,
+    0x00849D14U,
+    0x0084A822U,
+    0x0084AA41U,
+    0x0084ACA4U,
+    0x0084ACB2U,
+    0x0084ACB3U,
+    0x0084ADE9U,
+    0x0084B032U,
+    0x0084B068U,
+    0x0084B18FU,
+    0x0084B193U,
+    0x0084B199U,
+    0x0084B293U,
+    0x0084B2ADU,
+    0x0084B2B3U,
+    0x0084B44FU,
+    0x0084B835U,
+    0x0084B893U,
+    0x0084B8E5U,
+    0x0084B8F3U,
+    0x0084B979U,
+    0x0084B9D9U,
+    0x0084BA93U,
+    0x0084BD33U,
+    0x0084C199U,
+    0x0084C20FU,
+    0x0084C219U,
+    0x0084C8A4U,
+    0x0084C8A5U,
+    0x0084C8B2U,
+    0x0084C8B3U,
+    0x0084CE79U,
+    0x0084CE93U,
+    0x0084D068U,
+    0x0084D105U,
+    0x0084D8A4U,
+    0x0084D8B2U,
+    0x0084D8B3U,
+    0x0084E8AEU,
+    0x008784A4U,
+    0x008784F9U,
+    0x00878644U,
+    0x00878653U,
+    0x00878659U,
+    0x00878674U,
+    0x00878859U,
+    0x008789F3U,
+    0x00878D73U,
+    0x00878EB3U,
+    0x00879024U,
+    0x00879141U,
+    0x00879653U,
+    0x00879C2EU,
+    0x00879CAEU,
+    0x00879CF3U,
+    0x00879D13U,
+    0x0087A0A4U,
+    0x0087A46BU,
+    0x0087A4A4U,
+    0x0087A573U,
+    0x0087A5C7U,
+    0x0087A665U,
+    0x0087A674U,
+    0x0087AC33U,
+    0x0087ACA4U,
+    0x0087ACB3U,
+    0x0087ACB9U,
+    0x0087AD33U,
+    0x0087AD75U,
+    0x0087AEADU,
+    0x0087B093U,
+    0x0087B0A4U,
+    0x0087B0B3U,
+    0x0087B0B9U,
+    0x0087B173U,
+    0x0087B181U,
+    0x0087B18FU,
+    0x0087B199U,
+    0x0087B1A5U,
+    0x0087B1B3U,
+    0x0087B1EEU,
+    0x0087B1F3U,
+    0x0087B293U,
+    0x0087B433U,
+    0x0087B4A4U,
+    0x0087B4B2U,
+    0x0087B4B3U,
+    0x0087B4B9U,
+    0x0087B525U,
+    0x0087B5A5U,
+    0x0087B82EU,
+    0x0087B881U,
+    0x0087B893U,
+    0x0087B8A4U,
+    0x0087B8B2U,
+    0x0087B8B3U,
+    0x0087B8B9U,
+    0x0087B8E9U,
+    0x0087B8F3U,
+    0x0087B973U,
+    0x0087B979U,
+    0x0087B9F2U,
+    0x0087BC68U,
+    0x0087BC93U,
+    0x0087BC99U,
+    0x0087BCB9U,
+    0x0087BCD3U,
+    0x0087BD61U,
+    0x0087BD73U,
+    0x0087BD79U,
+    0x0087BD99U,
+    0x0087BDD3U,
+    0x0087BE13U,
+    0x0087BE44U,
+    0x0087BE53U,
+    0x0087BE68U,
+    0x0087BE93U,
+    0x0087BE99U,
+    0x0087BEC5U,
+    0x0087C02BU,
+    0x0087C0A4U,
+    0x0087C0B2U,
+    0x0087C0B3U,
+    0x0087C219U,
+    0x0087C828U,
+    0x0087C82CU,
+    0x0087C833U,
+    0x0087C885U,
+    0x0087C933U,
+    0x0087C973U,
+    0x0087C9A5U,
+    0x0087C9D3U,
+    0x0087C9D9U,
+    0x0087CA65U,
+    0x0087CA74U,
+    0x0087CA79U,
+    0x0087CCA4U,
+    0x0087CCACU,
+    0x0087CCAEU,
+    0x0087CCB2U,
+    0x0087CCB3U,
+    0x0087CCB9U,
+    0x0087CE81U,
+    0x0087CE93U,
+    0x0087D068U,
+    0x0087D0ACU,
+    0x0087D0AEU,
+    0x0087D199U,
+    0x0087D299U,
+    0x0087D4C6U,
+    0x0087D4D3U,
+    0x0087D4E8U,
+    0x0087D5C4U,
+    0x0087D649U,
+    0x0087D653U,
+    0x0087D665U,
+    0x0087D693U,
+    0x0087D8A1U,
+    0x0087D8A4U,
+    0x0087D8ACU,
+    0x0087D8AEU,
+    0x0087D8B2U,
+    0x0087D8B3U,
+    0x0087DC45U,
+    0x0087DC99U,
+    0x0087DCB3U,
+    0x0087DCC6U,
+    0x0087DCD3U,
+    0x0087DD73U,
+    0x0087DD93U,
+    0x0087DE45U,
+    0x0087DE6FU,
+    0x0087E0A4U,
+    0x0087E0B3U,
+    0x0087E433U,
+    0x0087E4A4U,
+    0x0087E585U,
+    0x008A8859U,
+    0x008A8D73U,
+    0x008A91C1U,
+    0x008A92A4U,
+    0x008A9653U,
+    0x008A98D3U,
+    0x008A98D9U,
+    0x008A9CB2U,
+    0x008A9CF9U,
+    0x008AA2B3U,
+    0x008AA433U,
+    0x008AB033U,
+    0x008AB0B3U,
+    0x008AB173U,
+    0x008AB179U,
+    0x008AB18FU,
+    0x008AB193U,
+    0x008AB199U,
+    0x008AB42EU,
+    0x008AB433U,
+    0x008AB4D3U,
+    0x008AB523U,
+    0x008AB524U,
+    0x008AB5F2U,
+    0x008AB608U,
+    0x008AB613U,
+    0x008AB619U,
+    0x008AB6B3U,
+    0x008AB868U,
+    0x008AB973U,
+    0x008AB979U,
+    0x008ABA93U,
+    0x008AC893U,
+    0x008AC993U,
+    0x008AC999U,
+    0x008ACA41U,
+    0x008ACA59U,
+    0x008ACA74U,
+    0x008ACA93U,
+    0x008ACD19U,
+    0x008ACD73U,
+    0x008ACD79U,
+    0x008ACDF3U,
+    0x008ACE79U,
+    0x008AD068U,
+    0x008AD121U,
+    0x008AEB41U,
+    0x008AEB59U,
+    0x008BE593U,
+    0x008C9241U,
+    0x008C924FU,
+    0x008C95C1U,
+    0x008C95D3U,
+    0x008C9CE5U,
+    0x008CA5C7U,
+    0x008CACB3U,
+    0x008CB033U,
+    0x008CB0A7U,
+    0x008CB0B3U,
+    0x008CB123U,
+    0x008CB4AEU,
+    0x008CB5D3U,
+    0x008CB885U,
+    0x008CBD24U,
+    0x008CC0A4U,
+    0x008CC0B2U,
+    0x008CC0B3U,
+    0x008CC101U,
+    0x008CC119U,
+    0x008CC1F3U,
+    0x008CC838U,
+    0x008CCDEEU,
+    0x008CD105U,
+    0x0090B449U,
+    0x0090B453U,
+    0x0091492BU,
+    0x00919653U,
+    0x0091A0A4U,
+    0x0091A0B3U,
+    0x0091A1F2U,
+    0x0091A4B2U,
+    0x0091A599U,
+    0x0091A5C7U,
+    0x0091ACB2U,
+    0x0091AD85U,
+    0x0091BDD3U,
+    0x0091D02CU,
+    0x0091D123U,
+    0x0091D2B3U,
+    0x009205D4U,
+    0x0092142CU,
+    0x00921433U,
+    0x009214B3U,
+    0x009215D4U,
+    0x009225EDU,
+    0x009225F4U,
+    0x009230A4U,
+    0x009230B2U,
+    0x009230B3U,
+    0x00923D81U,
+    0x00923D93U,
+    0x0092658CU,
+    0x00926593U,
+    0x00935032U,
+    0x0093860FU,
+    0x00939CA4U,
+    0x0093B1EFU,
+    0x0093B2B3U,
+    0x0094482DU,
+    0x009585D3U,
+    0x00958693U,
+    0x0095BDD3U,
+    0x00961423U,
+    0x0096142CU,
+    0x009616ADU,
+    0x009616B3U,
+    0x00962423U,
+    0x00962424U,
+    0x0096242CU,
+    0x009626ADU,
+    0x009630B2U,
+    0x00963288U,
+    0x009684E5U,
+    0x009684EFU,
+    0x009685B3U,
+    0x00968649U,
+    0x009686ADU,
+    0x00968832U,
+    0x009688A4U,
+    0x00968AA5U,
+    0x0096A485U,
+    0x0096A48FU,
+    0x0096A493U,
+    0x0096A5C5U,
+    0x0096A5CFU,
+    0x0096B4B7U,
+    0x0096B534U,
+    0x0096B538U,
+    0x0096C0A4U,
+    0x0096C0ACU,
+    0x0096C133U,
+    0x0096C199U,
+    0x0096C1F4U,
+    0x0096C24FU,
+    0x0096CD09U,
+    0x0096CD19U,
+    0x009705C5U,
+    0x00970614U,
+    0x0097064DU,
+    0x009709F8U,
+    0x00970B25U,
+    0x00970CACU,
+    0x00970D85U,
+    0x00970DE7U,
+    0x00970EB2U,
+    0x00970EB3U,
+    0x00970EB4U,
+    0x009710B7U,
+    0x009710B8U,
+    0x00971121U,
+    0x00971125U,
+    0x009711ECU,
+    0x009711F7U,
+    0x00971249U,
+    0x009712A5U,
+    0x00971614U,
+    0x0097164DU,
+    0x00971654U,
+    0x009718B2U,
+    0x00971938U,
+    0x009719F3U,
+    0x00971A41U,
+    0x00971C2EU,
+    0x00971D85U,
+    0x00971DF4U,
+    0x009725EEU,
+    0x00972CA4U,
+    0x00972CB2U,
+    0x00972D85U,
+    0x00973039U,
+    0x009730B4U,
+    0x009738A4U,
+    0x009738B2U,
+    0x00973934U,
+    0x00973E42U,
+    0x009742B4U,
+    0x00974AAEU,
+    0x00974CB4U,
+    0x00974E0FU,
+    0x009750ACU,
+    0x009750B2U,
+    0x0097512CU,
+    0x00975133U,
+    0x00975241U,
+    0x0097524FU,
+    0x00975581U,
+    0x00975645U,
+    0x0097564EU,
+    0x00975674U,
+    0x00975832U,
+    0x00975D34U,
+    0x00979123U,
+    0x00979124U,
+    0x0097912EU,
+    0x0097B923U,
+    0x0097D033U,
+    0x009841EEU,
+    0x00990485U,
+    0x00990685U,
+    0x00992493U,
+    0x009925C7U,
+    0x00992CA4U,
+    0x00993D6FU,
+    0x00993DC5U,
+    0x00993DD3U,
+    0x00993DD9U,
+    0x00998833U,
+    0x0099A0B3U,
+    0x0099B0A4U,
+    0x0099B0B3U,
+    0x0099B0B4U,
+    0x0099B825U,
+    0x0099CCA9U,
+    0x0099CEA5U,
+    0x0099D185U,
+    0x009A0D19U,
+    0x009A15B3U,
+    0x009A20B2U,
+    0x009B24A4U,
+    0x009B24B3U,
+    0x009B3E59U,
+    0x009C2433U,
+    0x009C3839U,
+    0x009C3E41U,
+    0x009C5185U,
+    0x009D0644U,
+    0x009D0653U,
+    0x009D6834U,
+    0x00A08613U,
+    0x00A089F4U,
+    0x00A08C2CU,
+    0x00A08D73U,
+    0x00A08D79U,
+    0x00A090A4U,
+    0x00A090B3U,
+    0x00A09833U,
+    0x00A098C1U,
+    0x00A09C33U,
+    0x00A09CB2U,
+    0x00A09CF3U,
+    0x00A09CF9U,
+    0x00A09D32U,
+    0x00A09E41U,
+    0x00A0A593U,
+    0x00A0ACB2U,
+    0x00A0ACB3U,
+    0x00A0ACB9U,
+    0x00A0B030U,
+    0x00A0B1F0U,
+    0x00A0B445U,
+    0x00A0B44FU,
+    0x00A0B453U,
+    0x00A0B455U,
+    0x00A0B4B3U,
+    0x00A0B5B9U,
+    0x00A0B5EEU,
+    0x00A0B8B3U,
+    0x00A0B9D3U,
+    0x00A0B9D9U,
+    0x00A0BA99U,
+    0x00A0C02EU,
+    0x00A0C0A4U,
+    0x00A0C0B2U,
+    0x00A0C0B3U,
+    0x00A0C973U,
+    0x00A0C993U,
+    0x00A0CA13U,
+    0x00A0CA81U,
+    0x00A0CAACU,
+    0x00A0CCB9U,
+    0x00A0CE05U,
+    0x00A0CE13U,
+    0x00A0D1F3U,
+    0x00A0D573U,
+    0x00A0D5D4U,
+    0x00A0D613U,
+    0x00A0D833U,
+    0x00A0D8ACU,
+    0x00A0DC2EU,
+    0x00A0DCA4U,
+    0x00A0E125U,
+    0x00A0EB59U,
+    0x00A285D3U,
+    0x00A28693U,
+    0x00A288ACU,
+    0x00A29133U,
+    0x00A29593U,
+    0x00A29599U,
+    0x00A29613U,
+    0x00A29653U,
+    0x00A29745U,
+    0x00A298B3U,
+    0x00A298D3U,
+    0x00A2A024U,
+    0x00A2A2B3U,
+    0x00A2B022U,
+    0x00A2B18FU,
+    0x00A2B193U,
+    0x00A2B199U,
+    0x00A2B445U,
+    0x00A2B5B9U,
+    0x00A2B9D9U,
+    0x00A2BDD3U,
+    0x00A2C924U,
+    0x00A2C973U,
+    0x00A2C979U,
+    0x00A2CA59U,
+    0x00A2CE65U,
+    0x00A2CE93U,
+    0x00A2CEB3U,
+    0x00A2D0B3U,
+    0x00A2D1EEU,
+    0x00A2D299U,
+    0x00A2D5C5U,
+    0x00A2DCA4U,
+    0x00A2DCACU,
+    0x00A2DD25U,
+    0x00A40581U,
+    0x00A485F3U,
+    0x00A48841U,
+    0x00A48853U,
+    0x00A488A4U,
+    0x00A488B2U,
+    0x00A488B3U,
+    0x00A498D3U,
+    0x00A498D9U,
+    0x00A49CF9U,
+    0x00A49DF4U,
+    0x00A4A024U,
+    0x00A4B193U,
+    0x00A4B293U,
+    0x00A4B5B9U,
+    0x00A4B619U,
+    0x00A4B8EFU,
+    0x00A4B973U,
+    0x00A4B9C5U,
+    0x00A4B9C9U,
+    0x00A4B9D3U,
+    0x00A4C893U,
+    0x00A4C8E1U,
+    0x00A4CA45U,
+    0x00A4CDB3U,
+    0x00A4D8A4U,
+    0x00A4D8B2U,
+    0x00A4D8B3U,
+    0x00A4D8B9U,
+    0x00A705C1U,
+    0x00A788A4U,
+    0x00A788B3U,
+    0x00A78D6FU,
+    0x00A78D73U,
+    0x00A78D79U,
+    0x00A78DF3U,
+    0x00A790ACU,
+    0x00A79733U,
+    0x00A7A1D3U,
+    0x00A7A5D3U,
+    0x00A7A5D4U,
+    0x00A7A674U,
+    0x00A7ACA4U,
+    0x00A7ACB2U,
+    0x00A7ACB3U,
+    0x00A7ACB9U,
+    0x00A7ADECU,
+    0x00A7B0A4U,
+    0x00A7B0B3U,
+    0x00A7B193U,
+    0x00A7B199U,
+    0x00A7B293U,
+    0x00A7B299U,
+    0x00A7B5EEU,
+    0x00A7B5F3U,
+    0x00A7B8B3U,
+    0x00A7B8F3U,
+    0x00A7BA99U,
+    0x00A7BD73U,
+    0x00A7C82DU,
+    0x00A7CAADU,
+    0x00A7D033U,
+    0x00A7D299U,
+    0x00A7D2AEU,
+    0x00A7D42CU,
+    0x00A7D4F3U,
+    0x00A7D573U,
+    0x00A7D585U,
+    0x00A7D653U,
+    0x00A7D674U,
+    0x00A7DC32U,
+    0x00A7DCA4U,
+    0x00A7DD93U,
+    0x00A7DD99U,
+    0x00A7E4A4U,
+    0x00AA8833U,
+    0x00AA88B3U,
+    0x00AA8DF3U,
+    0x00AA9033U,
+    0x00AA90E5U,
+    0x00AA90F9U,
+    0x00AA91F3U,
+    0x00AA9C2CU,
+    0x00AA9EADU,
+    0x00AAA465U,
+    0x00AAA479U,
+    0x00AAAAB3U,
+    0x00AAACA4U,
+    0x00AAACB3U,
+    0x00AAAEB3U,
+    0x00AAB0B0U,
+    0x00AAB432U,
+    0x00AAB44FU,
+    0x00AAB459U,
+    0x00AAB613U,
+    0x00AAB619U,
+    0x00AAB86FU,
+    0x00AAB973U,
+    0x00AAB979U,
+    0x00AABA81U,
+    0x00AABA8FU,
+    0x00AAC0B3U,
+    0x00AAC1EEU,
+    0x00AAC82CU,
+    0x00AAC834U,
+    0x00AAC8ACU,
+    0x00AAC8B3U,
+    0x00AAC9F2U,
+    0x00AACE93U,
+    0x00AAD0B3U,
+    0x00AAD299U,
+    0x00AAD8B3U,
+    0x00AAD925U,
+    0x00B085A1U,
+    0x00B08822U,
+    0x00B08832U,
+    0x00B089E2U,
+    0x00B08D01U,
+    0x00B08D73U,
+    0x00B09029U,
+    0x00B090B3U,
+    0x00B09133U,
+    0x00B09932U,
+    0x00B09DF3U,
+    0x00B09EB3U,
+    0x00B0A02CU,
+    0x00B0A42BU,
+    0x00B0A493U,
+    0x00B0A4B3U,
+    0x00B0A4D3U,
+    0x00B0A561U,
+    0x00B0A573U,
+    0x00B0A593U,
+    0x00B0A5B3U,
+    0x00B0A5C7U,
+    0x00B0A5D3U,
+    0x00B0AC33U,
+    0x00B0AD33U,
+    0x00B0B02DU,
+    0x00B0B0B3U,
+    0x00B0B126U,
+    0x00B0B133U,
+    0x00B0B201U,
+    0x00B0B433U,
+    0x00B0B4B3U,
+    0x00B0B52BU,
+    0x00B0B533U,
+    0x00B0B5A5U,
+    0x00B0B825U,
+    0x00B0B833U,
+    0x00B0B899U,
+    0x00B0B8A8U,
+    0x00B0B8B3U,
+    0x00B0B8E1U,
+    0x00B0B8F3U,
+    0x00B0B949U,
+    0x00B0BA93U,
+    0x00B0BB55U,
+    0x00B0BDD3U,
+    0x00B0C033U,
+    0x00B0C113U,
+    0x00B0C1EBU,
+    0x00B0C1F7U,
+    0x00B0C201U,
+    0x00B0C2B3U,
+    0x00B0C2B4U,
+    0x00B0C833U,
+    0x00B0C834U,
+    0x00B0C973U,
+    0x00B0C9A1U,
+    0x00B0C9D3U,
+    0x00B0C9EFU,
+    0x00B0C9F3U,
+    0x00B0CA49U,
+    0x00B0CA74U,
+    0x00B0CA79U,
+    0x00B0CA93U,
+    0x00B0CB59U,
+    0x00B0CD01U,
+    0x00B0CDA5U,
+    0x00B0D02CU,
+    0x00B0D033U,
+    0x00B0D133U,
+    0x00B0D289U,
+    0x00B0D4E8U,
+    0x00B0D649U,
+    0x00B0D655U,
+    0x00B0D659U,
+    0x00B0D82CU,
+    0x00B0D833U,
+    0x00B0DC33U,
+    0x00B0DC35U,
+    0x00B0DCA4U,
+    0x00B0E42BU,
+    0x00B0E585U,
+    0x00B0E5F3U,
+    0x00B0E933U,
+    0x00B0E9EFU,
+    0x00B10653U,
+    0x00B28822U,
+    0x00B28832U,
+    0x00B289E2U,
+    0x00B28D73U,
+    0x00B290E5U,
+    0x00B290F9U,
+    0x00B29468U,
+    0x00B294D3U,
+    0x00B29573U,
+    0x00B29593U,
+    0x00B295A1U,
+    0x00B295CFU,
+    0x00B295D3U,
+    0x00B29613U,
+    0x00B29693U,
+    0x00B296C5U,
+    0x00B29932U,
+    0x00B2A2A1U,
+    0x00B2A653U,
+    0x00B2B0B0U,
+    0x00B2B12DU,
+    0x00B2B193U,
+    0x00B2B199U,
+    0x00B2B213U,
+    0x00B2B219U,
+    0x00B2B293U,
+    0x00B2B299U,
+    0x00B2B44FU,
+    0x00B2B453U,
+    0x00B2B613U,
+    0x00B2B614U,
+    0x00B2B619U,
+    0x00B2B826U,
+    0x00B2B868U,
+    0x00B2B88FU,
+    0x00B2B9F3U,
+    0x00B2BA85U,
+    0x00B2BA93U,
+    0x00B2C133U,
+    0x00B2C853U,
+    0x00B2C8ACU,
+    0x00B2C8D3U,
+    0x00B2C979U,
+    0x00B2C9A1U,
+    0x00B2C9C5U,
+    0x00B2C9D3U,
+    0x00B2C9F3U,
+    0x00B2CA59U,
+    0x00B2CAC5U,
+    0x00B2CC32U,
+    0x00B2CE93U,
+    0x00B2D033U,
+    0x00B2D068U,
+    0x00B2D0B3U,
+    0x00B2D1ECU,
+    0x00B2D8ACU,
+    0x00B2D92CU,
+    0x00B2E0B3U,
+    0x00B2E4A4U,
+    0x00B2E4B2U,
+    0x00B40489U,
+    0x00B404D3U,
+    0x00B40569U,
+    0x00B405D3U,
+    0x00B40608U,
+    0x00B40693U,
+    0x00B40721U,
+    0x00B40749U,
+    0x00B41481U,
+    0x00B41688U,
+    0x00B41693U,
+    0x00B43D41U,
+    0x00B43E53U,
+    0x00B43EADU,
+    0x00B45493U,
+    0x00B48434U,
+    0x00B4846BU,
+    0x00B485C7U,
+    0x00B48845U,
+    0x00B48849U,
+    0x00B488A9U,
+    0x00B488B3U,
+    0x00B48981U,
+    0x00B48D73U,
+    0x00B48D79U,
+    0x00B4908FU,
+    0x00B49099U,
+    0x00B490ACU,
+    0x00B490E5U,
+    0x00B494D3U,
+    0x00B49653U,
+    0x00B496C5U,
+    0x00B496D3U,
+    0x00B49D14U,
+    0x00B4ADE9U,
+    0x00B4B0B9U,
+    0x00B4B12DU,
+    0x00B4B193U,
+    0x00B4B1D3U,
+    0x00B4B1F3U,
+    0x00B4B213U,
+    0x00B4B293U,
+    0x00B4B299U,
+    0x00B4B44FU,
+    0x00B4B833U,
+    0x00B4B881U,
+    0x00B4B893U,
+    0x00B4B899U,
+    0x00B4B8B3U,
+    0x00B4B8F3U,
+    0x00B4B92EU,
+    0x00B4B973U,
+    0x00B4B979U,
+    0x00B4B9F3U,
+    0x00B4BE45U,
+    0x00B4BE6BU,
+    0x00B4C0B3U,
+    0x00B4C201U,
+    0x00B4C213U,
+    0x00B4C859U,
+    0x00B4C973U,
+    0x00B4C9D3U,
+    0x00B4CA49U,
+    0x00B4CC2EU,
+    0x00B4CE79U,
+    0x00B4CE93U,
+    0x00B4D0A4U,
+    0x00B4D0B2U,
+    0x00B4D0B3U,
+    0x00B4D105U,
+    0x00B4D113U,
+    0x00B4D299U,
+    0x00B4D2ACU,
+    0x00B4D833U,
+    0x00B4DD33U,
+    0x00B605C7U,
+    0x00B60613U,
+    0x00B61694U,
+    0x00B6246BU,
+    0x00B624A7U,
+    0x00B62573U,
+    0x00B63DC7U,
+    0x00B63DE6U,
+    0x00B654E5U,
+    0x00B6569AU,
+    0x00B7046BU,
+    0x00B704F3U,
+    0x00B70613U,
+    0x00B7064CU,
+    0x00B70653U,
+    0x00B706B2U,
+    0x00B706C5U,
+    0x00B706E5U,
+    0x00B71424U,
+    0x00B714A4U,
+    0x00B714ACU,
+    0x00B714B3U,
+    0x00B7158CU,
+    0x00B71594U,
+    0x00B724C5U,
+    0x00B72668U,
+    0x00B72693U,
+    0x00B726C5U,
+    0x00B73C53U,
+    0x00B73C6BU,
+    0x00B73D8CU,
+    0x00B73E13U,
+    0x00B73E70U,
+    0x00B73E93U,
+    0x00B73EB4U,
+    0x00B73EE5U,
+    0x00B73EEEU,
+    0x00B73EF3U,
+    0x00B75453U,
+    0x00B7564CU,
+    0x00B75652U,
+    0x00B75653U,
+    0x00B75693U,
+    0x00B78581U,
+    0x00B785D3U,
+    0x00B78613U,
+    0x00B7882EU,
+    0x00B789F3U,
+    0x00B79593U,
+    0x00B798D3U,
+    0x00B79A81U,
+    0x00B79C2CU,
+    0x00B7A033U,
+    0x00B7A0AEU,
+    0x00B7A193U,
+    0x00B7A5C5U,
+    0x00B7A933U,
+    0x00B7AC2DU,
+    0x00B7AC33U,
+    0x00B7ACB2U,
+    0x00B7AE41U,
+    0x00B7AEADU,
+    0x00B7B033U,
+    0x00B7B1F3U,
+    0x00B7B455U,
+    0x00B7B855U,
+    0x00B7B88FU,
+    0x00B7B973U,
+    0x00B7BD73U,
+    0x00B7BD79U,
+    0x00B7BE49U,
+    0x00B7C0ABU,
+    0x00B7C113U,
+    0x00B7C145U,
+    0x00B7C201U,
+    0x00B7C829U,
+    0x00B7C833U,
+    0x00B7C834U,
+    0x00B7C8B3U,
+    0x00B7C9A1U,
+    0x00B7C9F3U,
+    0x00B7CAAEU,
+    0x00B7CAB3U,
+    0x00B7CCB3U,
+    0x00B7D068U,
+    0x00B7D1F3U,
+    0x00B7D1F7U,
+    0x00B7D641U,
+    0x00B9042CU,
+    0x00B90453U,
+    0x00B904D4U,
+    0x00B90533U,
+    0x00B90534U,
+    0x00B905C7U,
+    0x00B905D3U,
+    0x00B905DAU,
+    0x00B906B4U,
+    0x00B90733U,
+    0x00B914B0U,
+    0x00B915C7U,
+    0x00B916E5U,
+    0x00B9258CU,
+    0x00B93DC1U,
+    0x00B93DC5U,
+    0x00B93DEEU,
+    0x00B95449U,
+    0x00B955CBU,
+    0x00B98653U,
+    0x00BA8925U,
+    0x00BA91F3U,
+    0x00BA92B3U,
+    0x00BA9355U,
+    0x00BA9933U,
+    0x00BA9CACU,
+    0x00BAA433U,
+    0x00BAAE49U,
+    0x00BAAEB3U,
+    0x00BAB02BU,
+    0x00BAB02EU,
+    0x00BAB033U,
+    0x00BAB0C9U,
+    0x00BAB533U,
+    0x00BAB733U,
+    0x00BAC933U,
+    0x00BACA45U,
+    0x00BACA81U,
+    0x00BACAB3U,
+    0x00BACE6FU,
+    0x00BAD033U,
+    0x00BAD068U,
+    0x00BAD133U,
+    0x00BAD2B3U,
+    0x00BAEAB3U,
+    0x00BB0673U,
+    0x00BB158CU,
+    0x00BB9581U,
+    0x00BC846BU,
+    0x00BC8573U,
+    0x00BC85C7U,
+    0x00BC8653U,
+    0x00BC8693U,
+    0x00BC89F3U,
+    0x00BC9274U,
+    0x00BCB0B3U,
+    0x00BCB125U,
+    0x00BCB12EU,
+    0x00BCB138U,
+    0x00BCB1E5U,
+    0x00BCB885U,
+    0x00BCB893U,
+    0x00BCC0B3U,
+    0x00BCC925U,
+    0x00BCD0B3U,
+    0x00BCD105U,
+    0x00C08649U,
+    0x00C08881U,
+    0x00C088ACU,
+    0x00C08921U,
+    0x00C08933U,
+    0x00C089F2U,
+    0x00C08A41U,
+    0x00C08CA4U,
+    0x00C08CB2U,
+    0x00C08CB3U,
+    0x00C08CB4U,
+    0x00C08CB9U,
+    0x00C08D73U,
+    0x00C09099U,
+    0x00C090A4U,
+    0x00C090AEU,
+    0x00C090B2U,
+    0x00C090B3U,
+    0x00C09185U,
+    0x00C09653U,
+    0x00C096CFU,
+    0x00C09C2EU,
+    0x00C09CB2U,
+    0x00C0A02CU,
+    0x00C0A032U,
+    0x00C0A468U,
+    0x00C0A473U,
+    0x00C0A493U,
+    0x00C0A4E8U,
+    0x00C0A561U,
+    0x00C0A573U,
+    0x00C0A644U,
+    0x00C0A653U,
+    0x00C0A659U,
+    0x00C0A688U,
+    0x00C0A699U,
+    0x00C0ACA4U,
+    0x00C0ACB2U,
+    0x00C0ACB3U,
+    0x00C0AD13U,
+    0x00C0AD2EU,
+    0x00C0AE61U,
+    0x00C0B099U,
+    0x00C0B193U,
+    0x00C0B433U,
+    0x00C0B453U,
+    0x00C0B459U,
+    0x00C0B4A4U,
+    0x00C0B4B2U,
+    0x00C0B4B3U,
+    0x00C0B521U,
+    0x00C0B5B9U,
+    0x00C0B613U,
+    0x00C0B829U,
+    0x00C0B833U,
+    0x00C0B865U,
+    0x00C0B868U,
+    0x00C0B885U,
+    0x00C0B893U,
+    0x00C0B8B3U,
+    0x00C0B973U,
+    0x00C0B979U,
+    0x00C0BA93U,
+    0x00C0C0ACU,
+    0x00C0C12EU,
+    0x00C0C133U,
+    0x00C0C145U,
+    0x00C0C265U,
+    0x00C0C868U,
+    0x00C0C893U,
+    0x00C0C899U,
+    0x00C0C8A5U,
+    0x00C0C8B3U,
+    0x00C0C8E5U,
+    0x00C0C8EFU,
+    0x00C0C933U,
+    0x00C0C973U,
+    0x00C0C979U,
+    0x00C0C9D3U,
+    0x00C0C9D4U,
+    0x00C0CAADU,
+    0x00C0CAC1U,
+    0x00C0CCA4U,
+    0x00C0CCB2U,
+    0x00C0CCB3U,
+    0x00C0CE69U,
+    0x00C0CE6FU,
+    0x00C0CE75U,
+    0x00C0CE79U,
+    0x00C0CE93U,
+    0x00C0D028U,
+    0x00C0D068U,
+    0x00C0D0A4U,
+    0x00C0D0AEU,
+    0x00C0D0B2U,
+    0x00C0D0B8U,
+    0x00C0D105U,
+    0x00C0D109U,
+    0x00C0D113U,
+    0x00C0D119U,
+    0x00C0D165U,
+    0x00C0D285U,
+    0x00C0D2B3U,
+    0x00C0D42EU,
+    0x00C0D468U,
+    0x00C0D493U,
+    0x00C0D4D3U,
+    0x00C0D4E8U,
+    0x00C0D5C4U,
+    0x00C0D641U,
+    0x00C0D82CU,
+    0x00C0D833U,
+    0x00C0D8A4U,
+    0x00C0D8B2U,
+    0x00C0D8B3U,
+    0x00C0DA41U,
+    0x00C0DAD9U,
+    0x00C0DCA4U,
+    0x00C0DCB2U,
+    0x00C0DD2EU,
+    0x00C0DD73U,
+    0x00C0DDD3U,
+    0x00C0DDD9U,
+    0x00C0E0A4U,
+    0x00C0E0B2U,
+    0x00C0E0B3U,
+    0x00C0E199U,
+    0x00C0E4A4U,
+    0x00C0E4B2U,
+    0x00C0E52EU,
+    0x00C0E6B0U,
+    0x00C0E832U,
+    0x00C0E8A4U,
+    0x00C0E8B3U,
+    0x00C0E9F3U,
+    0x00C0EB49U,
+    0x00C0EB4FU,
+    0x00C28468U,
+    0x00C28493U,
+    0x00C28499U,
+    0x00C284D3U,
+    0x00C284D9U,
+    0x00C28573U,
+    0x00C28579U,
+    0x00C285B3U,
+    0x00C285D3U,
+    0x00C285D4U,
+    0x00C285D9U,
+    0x00C28613U,
+    0x00C28614U,
+    0x00C28645U,
+    0x00C2864EU,
+    0x00C28653U,
+    0x00C28659U,
+    0x00C28665U,
+    0x00C28668U,
+    0x00C28674U,
+    0x00C28693U,
+    0x00C286C5U,
+    0x00C286D9U,
+    0x00C28745U,
+    0x00C288AEU,
+    0x00C28C79U,
+    0x00C290B3U,
+    0x00C290E5U,
+    0x00C290F9U,
+    0x00C292ADU,
+    0x00C29432U,
+    0x00C29468U,
+    0x00C29573U,
+    0x00C29613U,
+    0x00C29653U,
+    0x00C29659U,
+    0x00C29665U,
+    0x00C29693U,
+    0x00C29745U,
+    0x00C29A85U,
+    0x00C29A93U,
+    0x00C29A99U,
+    0x00C29C2CU,
+    0x00C29CB2U,
+    0x00C29CB3U,
+    0x00C29CE5U,
+    0x00C29CEFU,
+    0x00C29CF9U,
+    0x00C29D34U,
+    0x00C2A253U,
+    0x00C2A2A1U,
+    0x00C2A653U,
+    0x00C2A668U,
+    0x00C2B42EU,
+    0x00C2B4A4U,
+    0x00C2B4ACU,
+    0x00C2B4B3U,
+    0x00C2B5A1U,
+    0x00C2B5A5U,
+    0x00C2B5EEU,
+    0x00C2B6B2U,
+    0x00C2B893U,
+    0x00C2B8B3U,
+    0x00C2B8F3U,
+    0x00C2B933U,
+    0x00C2B9F3U,
+    0x00C2BA65U,
+    0x00C2BA89U,
+    0x00C2BA8FU,
+    0x00C2BDC5U,
+    0x00C2C0B2U,
+    0x00C2C124U,
+    0x00C2C241U,
+    0x00C2C281U,
+    0x00C2C8A4U,
+    0x00C2C8B3U,
+    0x00C2CA13U,
+    0x00C2CCB3U,
+    0x00C2CE93U,
+    0x00C2D068U,
+    0x00C2D105U,
+    0x00C2D2B0U,
+    0x00C2D468U,
+    0x00C2D46FU,
+    0x00C2D493U,
+    0x00C2D4E8U,
+    0x00C2D833U,
+    0x00C2D8A5U,
+    0x00C2D8ACU,
+    0x00C2D8B2U,
+    0x00C2D8B3U,
+    0x00C2D92EU,
+    0x00C2D933U,
+    0x00C2DD33U,
+    0x00C2E0B3U,
+    0x00C2E133U,
+    0x00C2E8B3U,
+    0x00C2EB41U,
+    0x00C2EB59U,
+    0x00C485C1U,
+    0x00C485C5U,
+    0x00C485C7U,
+    0x00C48644U,
+    0x00C48653U,
+    0x00C48654U,
+    0x00C488ACU,
+    0x00C488B2U,
+    0x00C48A41U,
+    0x00C48A49U,
+    0x00C48D09U,
+    0x00C48D14U,
+    0x00C48D34U,
+    0x00C48D73U,
+    0x00C49032U,
+    0x00C491F3U,
+    0x00C494D3U,
+    0x00C494E5U,
+    0x00C495D3U,
+    0x00C49653U,
+    0x00C496B3U,
+    0x00C496C5U,
+    0x00C498B2U,
+    0x00C498B3U,
+    0x00C49A93U,
+    0x00C49C2EU,
+    0x00C49CB2U,
+    0x00C49CE5U,
+    0x00C49D14U,
+    0x00C49DC5U,
+    0x00C4ACA4U,
+    0x00C4ACAEU,
+    0x00C4ACB2U,
+    0x00C4ACB3U,
+    0x00C4AD2EU,
+    0x00C4B023U,
+    0x00C4B193U,
+    0x00C4B1F3U,
+    0x00C4B293U,
+    0x00C4B42EU,
+    0x00C4B433U,
+    0x00C4B438U,
+    0x00C4B441U,
+    0x00C4B449U,
+    0x00C4B44FU,
+    0x00C4B453U,
+    0x00C4B459U,
+    0x00C4B4A4U,
+    0x00C4B4AEU,
+    0x00C4B4B3U,
+    0x00C4B4B9U,
+    0x00C4B534U,
+    0x00C4B5A1U,
+    0x00C4B5D3U,
+    0x00C4B5F3U,
+    0x00C4B601U,
+    0x00C4B613U,
+    0x00C4B823U,
+    0x00C4B868U,
+    0x00C4B893U,
+    0x00C4B899U,
+    0x00C4B8A4U,
+    0x00C4B8AEU,
+    0x00C4B8B2U,
+    0x00C4B8B3U,
+    0x00C4B8B9U,
+    0x00C4B8E1U,
+    0x00C4B8EFU,
+    0x00C4B8F3U,
+    0x00C4B8F9U,
+    0x00C4B92EU,
+    0x00C4B973U,
+    0x00C4B979U,
+    0x00C4B9D3U,
+    0x00C4B9D9U,
+    0x00C4B9F3U,
+    0x00C4BA93U,
+    0x00C4BA99U,
+    0x00C4BAADU,
+    0x00C4BAB8U,
+    0x00C4BDD3U,
+    0x00C4C033U,
+    0x00C4C0B3U,
+    0x00C4C124U,
+    0x00C4C12EU,
+    0x00C4C1F3U,
+    0x00C4C219U,
+    0x00C4C833U,
+    0x00C4C973U,
+    0x00C4C9F4U,
+    0x00C4CD73U,
+    0x00C4CD85U,
+    0x00C4CE13U,
+    0x00C4CE93U,
+    0x00C4D029U,
+    0x00C4D033U,
+    0x00C4D0A4U,
+    0x00C4D0B2U,
+    0x00C4D0B3U,
+    0x00C4D105U,
+    0x00C4D10FU,
+    0x00C4D113U,
+    0x00C4D245U,
+    0x00C4D8A4U,
+    0x00C4D8AEU,
+    0x00C4D8B2U,
+    0x00C4D8B3U,
+    0x00C4D924U,
+    0x00C4D9F2U,
+    0x00C4DA45U,
+    0x00C605A1U,
+    0x00C605CFU,
+    0x00C78468U,
+    0x00C78493U,
+    0x00C784D3U,
+    0x00C785B3U,
+    0x00C785B9U,
+    0x00C785D3U,
+    0x00C78674U,
+    0x00C78688U,
+    0x00C786C5U,
+    0x00C78832U,
+    0x00C78859U,
+    0x00C788A4U,
+    0x00C788B3U,
+    0x00C789F3U,
+    0x00C78AB3U,
+    0x00C78C2CU,
+    0x00C78D05U,
+    0x00C78D13U,
+    0x00C78D25U,
+    0x00C78D33U,
+    0x00C78D73U,
+    0x00C78DF3U,
+    0x00C78EADU,
+    0x00C78EB3U,
+    0x00C790AEU,
+    0x00C790B3U,
+    0x00C790E5U,
+    0x00C79673U,
+    0x00C79A93U,
+    0x00C79A99U,
+    0x00C79C2EU,
+    0x00C79CB3U,
+    0x00C79CF9U,
+    0x00C79D21U,
+    0x00C79D23U,
+    0x00C79D25U,
+    0x00C79D2EU,
+    0x00C79DE9U,
+    0x00C79DEEU,
+    0x00C79DF3U,
+    0x00C7A02EU,
+    0x00C7A493U,
+    0x00C7A5D3U,
+    0x00C7A605U,
+    0x00C7A653U,
+    0x00C7ACB3U,
+    0x00C7B193U,
+    0x00C7B199U,
+    0x00C7B1E7U,
+    0x00C7B433U,
+    0x00C7B4A4U,
+    0x00C7B4B3U,
+    0x00C7B8B2U,
+    0x00C7B8E1U,
+    0x00C7B8E5U,
+    0x00C7B8F3U,
+    0x00C7BC59U,
+    0x00C7BCA4U,
+    0x00C7BCB9U,
+    0x00C7BCC1U,
+    0x00C7BCD3U,
+    0x00C7BD25U,
+    0x00C7BD73U,
+    0x00C7BD79U,
+    0x00C7BDB3U,
+    0x00C7BDD3U,
+    0x00C7BDD9U,
+    0x00C7BE13U,
+    0x00C7BE19U,
+    0x00C7BE44U,
+    0x00C7BE65U,
+    0x00C7BE93U,
+    0x00C7C0A4U,
+    0x00C7C0B2U,
+    0x00C7C0B3U,
+    0x00C7C219U,
+    0x00C7C82CU,
+    0x00C7C82EU,
+    0x00C7C893U,
+    0x00C7C899U,
+    0x00C7C8ACU,
+    0x00C7C8B3U,
+    0x00C7C923U,
+    0x00C7C933U,
+    0x00C7CA59U,
+    0x00C7CCA4U,
+    0x00C7CCACU,
+    0x00C7CCAEU,
+    0x00C7CCB2U,
+    0x00C7CCB3U,
+    0x00C7CE79U,
+    0x00C7D028U,
+    0x00C7D033U,
+    0x00C7D0B3U,
+    0x00C7D123U,
+    0x00C7D1F3U,
+    0x00C7D261U,
+    0x00C7D281U,
+    0x00C7D285U,
+    0x00C7D28FU,
+    0x00C7D2B3U,
+    0x00C7D4A4U,
+    0x00C7D4E8U,
+    0x00C7D525U,
+    0x00C7D533U,
+    0x00C7D5A1U,
+    0x00C7D5C4U,
+    0x00C7D5D3U,
+    0x00C7D605U,
+    0x00C7D613U,
+    0x00C7D645U,
+    0x00C7D653U,
+    0x00C7D659U,
+    0x00C7D665U,
+    0x00C7D679U,
+    0x00C7D693U,
+    0x00C7D834U,
+    0x00C7D8A4U,
+    0x00C7D8B2U,
+    0x00C7D8B3U,
+    0x00C7D8B9U,
+    0x00C7D925U,
+    0x00C7DC2EU,
+    0x00C7DCA4U,
+    0x00C7DCB2U,
+    0x00C7DCB3U,
+    0x00C7DD99U,
+    0x00C7DDC4U,
+    0x00C7DDC5U,
+    0x00C7DDD3U,
+    0x00C7DE13U,
+    0x00C7DE59U,
+    0x00C7DE65U,
+    0x00C7DE93U,
+    0x00C7E0A4U,
+    0x00C7E0B3U,
+    0x00C7E42CU,
+    0x00C7E8AEU,
+    0x00CA8468U,
+    0x00CA86B3U,
+    0x00CA88A4U,
+    0x00CA88B3U,
+    0x00CA8A41U,
+    0x00CA8CB3U,
+    0x00CA8D24U,
+    0x00CA8D73U,
+    0x00CA8D79U,
+    0x00CA8E45U,
+    0x00CA90B3U,
+    0x00CA9123U,
+    0x00CA91F3U,
+    0x00CA98C1U,
+    0x00CA98D3U,
+    0x00CA9CA4U,
+    0x00CA9CB2U,
+    0x00CA9CB3U,
+    0x00CAB193U,
+    0x00CAB2B3U,
+    0x00CAB433U,
+    0x00CAB449U,
+    0x00CAB4AEU,
+    0x00CAB5A5U,
+    0x00CAB5B9U,
+    0x00CAB613U,
+    0x00CAB619U,
+    0x00CAB832U,
+    0x00CAB833U,
+    0x00CAB868U,
+    0x00CAB8B3U,
+    0x00CAB8B4U,
+    0x00CAB8E5U,
+    0x00CAB8E9U,
+    0x00CAB8F3U,
+    0x00CAB973U,
+    0x00CABA93U,
+    0x00CAC12EU,
+    0x00CAC2B3U,
+    0x00CAC868U,
+    0x00CAC8A4U,
+    0x00CAC8B2U,
+    0x00CAC8B3U,
+    0x00CAC8B8U,
+    0x00CAC8E9U,
+    0x00CAC8F9U,
+    0x00CAC924U,
+    0x00CAC973U,
+    0x00CACA59U,
+    0x00CACAC5U,
+    0x00CACCB2U,
+    0x00CACD19U,
+    0x00CACD73U,
+    0x00CACE93U,
+    0x00CACE99U,
+    0x00CACEB3U,
+    0x00CAD0A1U,
+    0x00CAD0A4U,
+    0x00CAD0B2U,
+    0x00CAD0B3U,
+    0x00CADAD9U,
+    0x00CAE0A4U,
+    0x00CAE0B2U,
+    0x00CAE0B3U,
+    0x00CB9533U,
+    0x00CC85B3U,
+    0x00CC8644U,
+    0x00CC8654U,
+    0x00CC8665U,
+    0x00CC8CA1U,
+    0x00CC8CA5U,
+    0x00CC8E41U,
+    0x00CCA5C7U,
+    0x00CCB4B3U,
+    0x00CCB608U,
+    0x00CCB8B3U,
+    0x00CCC8B3U,
+    0x00CCC923U,
+    0x00CCCCA4U,
+    0x00CCCCB3U,
+    0x00CCCD2EU,
+    0x00CCCD33U,
+    0x00CCCDECU,
+    0x00CCCE61U,
+    0x00CCD0A4U,
+    0x00CCD0B3U,
+    0x00CCD105U,
+    0x00CCD123U,
+    0x00CCD281U,
+    0x00D084A4U,
+    0x00D08645U,
+    0x00D08653U,
+    0x00D088B3U,
+    0x00D08C33U,
+    0x00D08C37U,
+    0x00D08CA4U,
+    0x00D08CB2U,
+    0x00D08CB3U,
+    0x00D08D05U,
+    0x00D08D09U,
+    0x00D08D0FU,
+    0x00D08D13U,
+    0x00D08D73U,
+    0x00D08D85U,
+    0x00D08DEEU,
+    0x00D08E4FU,
+    0x00D0902DU,
+    0x00D090E5U,
+    0x00D09124U,
+    0x00D09199U,
+    0x00D09245U,
+    0x00D0964CU,
+    0x00D09921U,
+    0x00D09923U,
+    0x00D09CB3U,
+    0x00D09CF3U,
+    0x00D09D23U,
+    0x00D09DA1U,
+    0x00D09DF4U,
+    0x00D09EB3U,
+    0x00D0A1E5U,
+    0x00D0A2A1U,
+    0x00D0A2E1U,
+    0x00D0A493U,
+    0x00D0A56FU,
+    0x00D0A573U,
+    0x00D0A585U,
+    0x00D0A58CU,
+    0x00D0A593U,
+    0x00D0A5B3U,
+    0x00D0A5D3U,
+    0x00D0A645U,
+    0x00D0A653U,
+    0x00D0A665U,
+    0x00D0A674U,
+    0x00D0A745U,
+    0x00D0A9F2U,
+    0x00D0AC32U,
+    0x00D0ACB2U,
+    0x00D0ACB3U,
+    0x00D0AD33U,
+    0x00D0ADF3U,
+    0x00D0B02DU,
+    0x00D0B032U,
+    0x00D0B033U,
+    0x00D0B038U,
+    0x00D0B0B3U,
+    0x00D0B123U,
+    0x00D0B12BU,
+    0x00D0B133U,
+    0x00D0B193U,
+    0x00D0B1B3U,
+    0x00D0B1B9U,
+    0x00D0B293U,
+    0x00D0B299U,
+    0x00D0B2B3U,
+    0x00D0B2C1U,
+    0x00D0B2E1U,
+    0x00D0B433U,
+    0x00D0B441U,
+    0x00D0B44FU,
+    0x00D0B4A5U,
+    0x00D0B4B9U,
+    0x00D0B525U,
+    0x00D0B5A1U,
+    0x00D0B5B9U,
+    0x00D0B833U,
+    0x00D0B834U,
+    0x00D0B889U,
+    0x00D0B8A2U,
+    0x00D0B8A4U,
+    0x00D0B8A8U,
+    0x00D0B8B3U,
+    0x00D0B8B4U,
+    0x00D0B8E1U,
+    0x00D0B8E5U,
+    0x00D0B8EFU,
+    0x00D0B8F3U,
+    0x00D0B8F9U,
+    0x00D0B921U,
+    0x00D0B923U,
+    0x00D0B933U,
+    0x00D0B979U,
+    0x00D0B999U,
+    0x00D0B9C1U,
+    0x00D0B9F2U,
+    0x00D0B9F3U,
+    0x00D0BA65U,
+    0x00D0BA81U,
+    0x00D0BA8FU,
+    0x00D0BA99U,
+    0x00D0BAACU,
+    0x00D0BAB3U,
+    0x00D0C035U,
+    0x00D0C185U,
+    0x00D0C6A9U,
+    0x00D0C825U,
+    0x00D0C828U,
+    0x00D0C833U,
+    0x00D0C868U,
+    0x00D0C873U,
+    0x00D0C899U,
+    0x00D0C8B3U,
+    0x00D0C8E5U,
+    0x00D0C8F3U,
+    0x00D0C921U,
+    0x00D0C924U,
+    0x00D0C961U,
+    0x00D0C973U,
+    0x00D0C985U,
+    0x00D0C993U,
+    0x00D0C999U,
+    0x00D0C9B3U,
+    0x00D0C9EEU,
+    0x00D0C9F2U,
+    0x00D0CA41U,
+    0x00D0CA49U,
+    0x00D0CA59U,
+    0x00D0CA65U,
+    0x00D0CA68U,
+    0x00D0CA93U,
+    0x00D0CAD9U,
+    0x00D0CC33U,
+    0x00D0CCA4U,
+    0x00D0CCB2U,
+    0x00D0CCB3U,
+    0x00D0CD19U,
+    0x00D0CD73U,
+    0x00D0CDEEU,
+    0x00D0CE61U,
+    0x00D0CE65U,
+    0x00D0CE79U,
+    0x00D0CE93U,
+    0x00D0CE99U,
+    0x00D0CEB3U,
+    0x00D0D029U,
+    0x00D0D068U,
+    0x00D0D0A4U,
+    0x00D0D0B2U,
+    0x00D0D0B3U,
+    0x00D0D0B9U,
+    0x00D0D113U,
+    0x00D0D12EU,
+    0x00D0D18FU,
+    0x00D0D285U,
+    0x00D0D293U,
+    0x00D0D341U,
+    0x00D0D34FU,
+    0x00D0D459U,
+    0x00D0D493U,
+    0x00D0D593U,
+    0x00D0D5C4U,
+    0x00D0D649U,
+    0x00D0D679U,
+    0x00D0D693U,
+    0x00D0D6C5U,
+    0x00D0D759U,
+    0x00D0D8AEU,
+    0x00D0D925U,
+    0x00D0D92EU,
+    0x00D0D933U,
+    0x00D0DCA4U,
+    0x00D0DD73U,
+    0x00D0DD79U,
+    0x00D0DDD3U,
+    0x00D0DE53U,
+    0x00D0E0A4U,
+    0x00D0E0B3U,
+    0x00D0E12DU,
+    0x00D0E133U,
+    0x00D0E42EU,
+    0x00D0E433U,
+    0x00D0E445U,
+    0x00D0E4A4U,
+    0x00D0E5F2U,
+    0x00D0E5F3U,
+    0x00D0E674U,
+    0x00D0E8A4U,
+    0x00D0E8B2U,
+    0x00D0E8B3U,
+    0x00D0E8B9U,
+    0x00D0EAB4U,
+    0x00D12641U,
+    0x00D28493U,
+    0x00D28593U,
+    0x00D28599U,
+    0x00D285C5U,
+    0x00D285D3U,
+    0x00D285D4U,
+    0x00D285D9U,
+    0x00D28645U,
+    0x00D28665U,
+    0x00D28688U,
+    0x00D28693U,
+    0x00D28699U,
+    0x00D289F3U,
+    0x00D28C61U,
+    0x00D28D13U,
+    0x00D28D73U,
+    0x00D2902CU,
+    0x00D29121U,
+    0x00D29123U,
+    0x00D29129U,
+    0x00D29185U,
+    0x00D29493U,
+    0x00D29653U,
+    0x00D29693U,
+    0x00D298D3U,
+    0x00D2A5D3U,
+    0x00D2A5D4U,
+    0x00D2A5D9U,
+    0x00D2A688U,
+    0x00D2AD61U,
+    0x00D2B033U,
+    0x00D2B041U,
+    0x00D2B093U,
+    0x00D2B0A5U,
+    0x00D2B123U,
+    0x00D2B12BU,
+    0x00D2B193U,
+    0x00D2B1EEU,
+    0x00D2B293U,
+    0x00D2B299U,
+    0x00D2B4B3U,
+    0x00D2B5F3U,
+    0x00D2B824U,
+    0x00D2B893U,
+    0x00D2B8A4U,
+    0x00D2B8B3U,
+    0x00D2B8E5U,
+    0x00D2B8F3U,
+    0x00D2BA61U,
+    0x00D2BA65U,
+    0x00D2BA68U,
+    0x00D2BA81U,
+    0x00D2BA8FU,
+    0x00D2BAB3U,
+    0x00D2BEB3U,
+    0x00D2BEF3U,
+    0x00D2C868U,
+    0x00D2C873U,
+    0x00D2C879U,
+    0x00D2C885U,
+    0x00D2C8A4U,
+    0x00D2C8ACU,
+    0x00D2C8B2U,
+    0x00D2C8B3U,
+    0x00D2C8E5U,
+    0x00D2C92CU,
+    0x00D2C933U,
+    0x00D2C934U,
+    0x00D2C973U,
+    0x00D2C985U,
+    0x00D2C993U,
+    0x00D2CA59U,
+    0x00D2CA65U,
+    0x00D2CC2CU,
+    0x00D2CC33U,
+    0x00D2CCACU,
+    0x00D2CCB3U,
+    0x00D2CD19U,
+    0x00D2CD23U,
+    0x00D2CDC5U,
+    0x00D2CDEEU,
+    0x00D2CE79U,
+    0x00D2CE8FU,
+    0x00D2D02CU,
+    0x00D2D0A4U,
+    0x00D2D0B2U,
+    0x00D2D0B3U,
+    0x00D2D10FU,
+    0x00D2D113U,
+    0x00D2D123U,
+    0x00D2D126U,
+    0x00D2D133U,
+    0x00D2D1ECU,
+    0x00D2D245U,
+    0x00D2D24FU,
+    0x00D2D665U,
+    0x00D2D8A4U,
+    0x00D2D8B3U,
+    0x00D2DCA4U,
+    0x00D2DD93U,
+    0x00D2E5D4U,
+    0x00D2E8B3U,
+    0x00D2EB45U,
+    0x00D2EB4FU,
+    0x00D43E52U,
+    0x00D485F5U,
+    0x00D485F7U,
+    0x00D4866DU,
+    0x00D486ACU,
+    0x00D48C33U,
+    0x00D48D05U,
+    0x00D48D14U,
+    0x00D48D73U,
+    0x00D48D79U,
+    0x00D48DF3U,
+    0x00D48E41U,
+    0x00D48E4FU,
+    0x00D49099U,
+    0x00D490E5U,
+    0x00D490F9U,
+    0x00D49133U,
+    0x00D49274U,
+    0x00D495D3U,
+    0x00D496C5U,
+    0x00D498D3U,
+    0x00D498D9U,
+    0x00D49A99U,
+    0x00D49CF3U,
+    0x00D49D14U,
+    0x00D4A033U,
+    0x00D4A133U,
+    0x00D4ACA4U,
+    0x00D4ACB3U,
+    0x00D4AE41U,
+    0x00D4AEC1U,
+    0x00D4B068U,
+    0x00D4B093U,
+    0x00D4B0B2U,
+    0x00D4B0B3U,
+    0x00D4B0D3U,
+    0x00D4B121U,
+    0x00D4B16FU,
+    0x00D4B173U,
+    0x00D4B179U,
+    0x00D4B185U,
+    0x00D4B193U,
+    0x00D4B1F2U,
+    0x00D4B1F3U,
+    0x00D4B201U,
+    0x00D4B293U,
+    0x00D4B299U,
+    0x00D4B29AU,
+    0x00D4B4A4U,
+    0x00D4B4AFU,
+    0x00D4B4B2U,
+    0x00D4B4B3U,
+    0x00D4B523U,
+    0x00D4B679U,
+    0x00D4B825U,
+    0x00D4B832U,
+    0x00D4B833U,
+    0x00D4B865U,
+    0x00D4B879U,
+    0x00D4B893U,
+    0x00D4B8A4U,
+    0x00D4B8B2U,
+    0x00D4B8B3U,
+    0x00D4B8E5U,
+    0x00D4B8F3U,
+    0x00D4B8F9U,
+    0x00D4B92DU,
+    0x00D4B933U,
+    0x00D4B965U,
+    0x00D4B973U,
+    0x00D4B9D9U,
+    0x00D4B9F2U,
+    0x00D4B9F3U,
+    0x00D4BA93U,
+    0x00D4BA99U,
+    0x00D4BAB3U,
+    0x00D4C8A4U,
+    0x00D4C8B3U,
+    0x00D4C8B8U,
+    0x00D4C924U,
+    0x00D4C92EU,
+    0x00D4C973U,
+    0x00D4C979U,
+    0x00D4C999U,
+    0x00D4C9F3U,
+    0x00D4CA88U,
+    0x00D4CAD3U,
+    0x00D4CB41U,
+    0x00D4CC68U,
+    0x00D4CC8FU,
+    0x00D4CCB2U,
+    0x00D4CCB3U,
+    0x00D4CCEFU,
+    0x00D4CDF3U,
+    0x00D4CE61U,
+    0x00D4CE79U,
+    0x00D4CE93U,
+    0x00D4CE99U,
+    0x00D4D068U,
+    0x00D4D0B2U,
+    0x00D4D0B3U,
+    0x00D4D133U,
+    0x00D4D245U,
+    0x00D4D293U,
+    0x00D4E0A4U,
+    0x00D4E0AEU,
+    0x00D4E0B2U,
+    0x00D4E0B3U,
+    0x00D4E285U,
+    0x00D4E2B0U,
+    0x00D4E8AEU,
+    0x00D4EB59U,
+    0x00D715A5U,
+    0x00D785D3U,
+    0x00D78693U,
+    0x00D78859U,
+    0x00D788B3U,
+    0x00D788B9U,
+    0x00D78925U,
+    0x00D78985U,
+    0x00D78D01U,
+    0x00D78D09U,
+    0x00D78D13U,
+    0x00D78D19U,
+    0x00D78D73U,
+    0x00D7902CU,
+    0x00D790ACU,
+    0x00D790ADU,
+    0x00D790B2U,
+    0x00D790B3U,
+    0x00D790E5U,
+    0x00D79129U,
+    0x00D792B3U,
+    0x00D79653U,
+    0x00D799F3U,
+    0x00D79CF9U,
+    0x00D79EACU,
+    0x00D7A0ACU,
+    0x00D7A1F3U,
+    0x00D7A253U,
+    0x00D7A2A1U,
+    0x00D7A2B2U,
+    0x00D7A585U,
+    0x00D7A593U,
+    0x00D7A641U,
+    0x00D7A645U,
+    0x00D7A674U,
+    0x00D7A693U,
+    0x00D7A9F3U,
+    0x00D7ACB3U,
+    0x00D7AD33U,
+    0x00D7ADF3U,
+    0x00D7B02CU,
+    0x00D7B032U,
+    0x00D7B033U,
+    0x00D7B093U,
+    0x00D7B099U,
+    0x00D7B0A4U,
+    0x00D7B0B3U,
+    0x00D7B181U,
+    0x00D7B193U,
+    0x00D7B199U,
+    0x00D7B28FU,
+    0x00D7B293U,
+    0x00D7B333U,
+    0x00D7B4B3U,
+    0x00D7B5A1U,
+    0x00D7B5B9U,
+    0x00D7B6B3U,
+    0x00D7B824U,
+    0x00D7B82CU,
+    0x00D7B833U,
+    0x00D7B885U,
+    0x00D7B88FU,
+    0x00D7B8B2U,
+    0x00D7B8B9U,
+    0x00D7B8EFU,
+    0x00D7B8F3U,
+    0x00D7B923U,
+    0x00D7B925U,
+    0x00D7B973U,
+    0x00D7B9F3U,
+    0x00D7BA85U,
+    0x00D7BA88U,
+    0x00D7BA99U,
+    0x00D7BC53U,
+    0x00D7BC68U,
+    0x00D7BC93U,
+    0x00D7BC99U,
+    0x00D7BCA4U,
+    0x00D7BD73U,
+    0x00D7BD81U,
+    0x00D7BD89U,
+    0x00D7BD93U,
+    0x00D7BD99U,
+    0x00D7BDC7U,
+    0x00D7BDD3U,
+    0x00D7BDD9U,
+    0x00D7BE13U,
+    0x00D7BE53U,
+    0x00D7BE59U,
+    0x00D7BE65U,
+    0x00D7BE93U,
+    0x00D7BEC5U,
+    0x00D7C0A4U,
+    0x00D7C0B2U,
+    0x00D7C0B3U,
+    0x00D7C0B9U,
+    0x00D7C219U,
+    0x00D7C279U,
+    0x00D7C2B3U,
+    0x00D7C825U,
+    0x00D7C82CU,
+    0x00D7C833U,
+    0x00D7C834U,
+    0x00D7C839U,
+    0x00D7C8ACU,
+    0x00D7C8B3U,
+    0x00D7C921U,
+    0x00D7C9C5U,
+    0x00D7C9D3U,
+    0x00D7C9EEU,
+    0x00D7CA08U,
+    0x00D7CA41U,
+    0x00D7CA4FU,
+    0x00D7CA65U,
+    0x00D7CA93U,
+    0x00D7CCA4U,
+    0x00D7CCB3U,
+    0x00D7CCB9U,
+    0x00D7CD73U,
+    0x00D7CE6FU,
+    0x00D7CE79U,
+    0x00D7CE85U,
+    0x00D7CE93U,
+    0x00D7D0A4U,
+    0x00D7D0ACU,
+    0x00D7D0AEU,
+    0x00D7D0B3U,
+    0x00D7D0B4U,
+    0x00D7D0B9U,
+    0x00D7D113U,
+    0x00D7D119U,
+    0x00D7D126U,
+    0x00D7D133U,
+    0x00D7D1F2U,
+    0x00D7D285U,
+    0x00D7D28FU,
+    0x00D7D293U,
+    0x00D7D299U,
+    0x00D7D2B3U,
+    0x00D7D341U,
+    0x00D7D468U,
+    0x00D7D4B3U,
+    0x00D7D584U,
+    0x00D7D593U,
+    0x00D7D594U,
+    0x00D7D5C4U,
+    0x00D7D5D4U,
+    0x00D7D613U,
+    0x00D7D64EU,
+    0x00D7D665U,
+    0x00D7D674U,
+    0x00D7D679U,
+    0x00D7D688U,
+    0x00D7D8A4U,
+    0x00D7D8B2U,
+    0x00D7D8B3U,
+    0x00D7D925U,
+    0x00D7DC33U,
+    0x00D7DCA4U,
+    0x00D7DCB2U,
+    0x00D7DE41U,
+    0x00D7E033U,
+    0x00D7E125U,
+    0x00D7E433U,
+    0x00D7E585U,
+    0x00D7E593U,
+    0x00D7E8A4U,
+    0x00D7E8B3U,
+    0x00D7E9F3U,
+    0x00D848B4U,
+    0x00DA8D0FU,
+    0x00DA8D23U,
+    0x00DA8D24U,
+    0x00DA8D2EU,
+    0x00DA8D73U,
+    0x00DA8D79U,
+    0x00DA8DF2U,
+    0x00DA8E4FU,
+    0x00DA8EB3U,
+    0x00DA9099U,
+    0x00DA90E5U,
+    0x00DA9132U,
+    0x00DA9241U,
+    0x00DA98D3U,
+    0x00DA9A89U,
+    0x00DA9CE1U,
+    0x00DA9CF3U,
+    0x00DA9CF9U,
+    0x00DAA199U,
+    0x00DAA493U,
+    0x00DAA593U,
+    0x00DAA653U,
+    0x00DAA674U,
+    0x00DAA92BU,
+    0x00DAB068U,
+    0x00DAB074U,
+    0x00DAB0A4U,
+    0x00DAB0B3U,
+    0x00DAB0B9U,
+    0x00DAB0E1U,
+    0x00DAB125U,
+    0x00DAB181U,
+    0x00DAB193U,
+    0x00DAB265U,
+    0x00DAB268U,
+    0x00DAB5B3U,
+    0x00DAB5B9U,
+    0x00DAB613U,
+    0x00DAB679U,
+    0x00DAB6B3U,
+    0x00DAB868U,
+    0x00DAB8E1U,
+    0x00DAB8E5U,
+    0x00DAB8EFU,
+    0x00DAB8F3U,
+    0x00DAB933U,
+    0x00DABA93U,
+    0x00DABA95U,
+    0x00DABDD3U,
+    0x00DAC82CU,
+    0x00DAC833U,
+    0x00DAC8A4U,
+    0x00DAC8B3U,
+    0x00DAC8B8U,
+    0x00DAC924U,
+    0x00DAC973U,
+    0x00DAC979U,
+    0x00DAC993U,
+    0x00DAC999U,
+    0x00DACA41U,
+    0x00DACA45U,
+    0x00DACA49U,
+    0x00DACA53U,
+    0x00DACA59U,
+    0x00DACA89U,
+    0x00DACAC1U,
+    0x00DACC32U,
+    0x00DACC61U,
+    0x00DACCA4U,
+    0x00DACCB2U,
+    0x00DACCB3U,
+    0x00DACCB4U,
+    0x00DACD01U,
+    0x00DACD19U,
+    0x00DACD23U,
+    0x00DACD34U,
+    0x00DACD73U,
+    0x00DACD79U,
+    0x00DACDF3U,
+    0x00DACE65U,
+    0x00DACE79U,
+    0x00DACE88U,
+    0x00DACE93U,
+    0x00DACE99U,
+    0x00DAD068U,
+    0x00DAD0A4U,
+    0x00DAD0B2U,
+    0x00DAD0B3U,
+    0x00DAD101U,
+    0x00DAD133U,
+    0x00DAD1EEU,
+    0x00DAD293U,
+    0x00DAE0A4U,
+    0x00DAE0B3U,
+    0x00DAE82BU,
+    0x00DAEB59U,
+    0x00DB5585U,
+    0x00DC858CU,
+    0x00DCB032U,
+    0x00DCB828U,
+    0x00DCB833U,
+    0x00DCBD24U,
+    0x00DCBDA1U,
+    0x00DCBE05U,
+    0x00DCBE13U,
+    0x00DCBE19U,
+    0x00DCCA48U,
+    0x00DCCD24U,
+    0x00DCD109U,
+    0x00DCD113U,
+    0x00DCD119U,
+    0x00DCE1F3U,
+    0x00DD14B3U,
+    0x00E085B3U,
+    0x00E085D3U,
+    0x00E088B3U,
+    0x00E08933U,
+    0x00E08973U,
+    0x00E08981U,
+    0x00E089E2U,
+    0x00E08D05U,
+    0x00E08D0FU,
+    0x00E08E45U,
+    0x00E09033U,
+    0x00E09132U,
+    0x00E096C5U,
+    0x00E096C9U,
+    0x00E098D3U,
+    0x00E09C33U,
+    0x00E09CF9U,
+    0x00E09DF2U,
+    0x00E0A02CU,
+    0x00E0A424U,
+    0x00E0A4D3U,
+    0x00E0A573U,
+    0x00E0A593U,
+    0x00E0A641U,
+    0x00E0A655U,
+    0x00E0A6C5U,
+    0x00E0ACA4U,
+    0x00E0ACB2U,
+    0x00E0ACC1U,
+    0x00E0B033U,
+    0x00E0B0A4U,
+    0x00E0B181U,
+    0x00E0B4A4U,
+    0x00E0B4B2U,
+    0x00E0B4B3U,
+    0x00E0B5A1U,
+    0x00E0B6B3U,
+    0x00E0B833U,
+    0x00E0B865U,
+    0x00E0B879U,
+    0x00E0B895U,
+    0x00E0B9C1U,
+    0x00E0B9D9U,
+    0x00E0B9F3U,
+    0x00E0BAA1U,
+    0x00E0C033U,
+    0x00E0C0A4U,
+    0x00E0C0B3U,
+    0x00E0C1EFU,
+    0x00E0C201U,
+    0x00E0C205U,
+    0x00E0C219U,
+    0x00E0C833U,
+    0x00E0C86FU,
+    0x00E0C873U,
+    0x00E0C893U,
+    0x00E0C8B3U,
+    0x00E0C923U,
+    0x00E0C933U,
+    0x00E0C973U,
+    0x00E0C979U,
+    0x00E0CA45U,
+    0x00E0CC2CU,
+    0x00E0CD09U,
+    0x00E0CE99U,
+    0x00E0D02CU,
+    0x00E0D068U,
+    0x00E0D0B3U,
+    0x00E0D133U,
+    0x00E0D299U,
+    0x00E0D468U,
+    0x00E0D5D4U,
+    0x00E0D82CU,
+    0x00E0D832U,
+    0x00E0D8ACU,
+    0x00E0D8B3U,
+    0x00E0D8B7U,
+    0x00E0DAD9U,
+    0x00E0DC22U,
+    0x00E0E8B3U,
+    0x00E0E932U,
+    0x00E0E933U,
+    0x00E25541U,
+    0x00E284C5U,
+    0x00E28593U,
+    0x00E28613U,
+    0x00E28653U,
+    0x00E28688U,
+    0x00E28693U,
+    0x00E288ABU,
+    0x00E288ACU,
+    0x00E28D73U,
+    0x00E29099U,
+    0x00E29493U,
+    0x00E29499U,
+    0x00E29584U,
+    0x00E29585U,
+    0x00E295A2U,
+    0x00E295B3U,
+    0x00E29613U,
+    0x00E29665U,
+    0x00E29745U,
+    0x00E29E4FU,
+    0x00E29EB3U,
+    0x00E2A4D3U,
+    0x00E2A4E8U,
+    0x00E2A674U,
+    0x00E2A6C5U,
+    0x00E2B133U,
+    0x00E2B199U,
+    0x00E2B433U,
+    0x00E2B5D3U,
+    0x00E2B614U,
+    0x00E2B8B3U,
+    0x00E2BDD3U,
+    0x00E2C0B2U,
+    0x00E2C134U,
+    0x00E2C82CU,
+    0x00E2C893U,
+    0x00E2C899U,
+    0x00E2C961U,
+    0x00E2C973U,
+    0x00E2C9ECU,
+    0x00E2CA93U,
+    0x00E2CA9AU,
+    0x00E2CAC5U,
+    0x00E2CAD9U,
+    0x00E2CE93U,
+    0x00E2D0B3U,
+    0x00E2D1F0U,
+    0x00E2D293U,
+    0x00E2D299U,
+    0x00E2D573U,
+    0x00E2D5A5U,
+    0x00E2D5B3U,
+    0x00E2D8ACU,
+    0x00E2D8B2U,
+    0x00E2D8B3U,
+    0x00E2DAB3U,
+    0x00E2DC53U,
+    0x00E2DCA4U,
+    0x00E2DCACU,
+    0x00E2DCB2U,
+    0x00E2DD25U,
+    0x00E2DD99U,
+    0x00E2DE79U,
+    0x00E2DE93U,
+    0x00E2E293U,
+    0x00E2E2B3U,
+    0x00E3852FU,
+    0x00E385C1U,
+    0x00E38689U,
+    0x00E3BDA1U,
+    0x00E3DCA5U,
+    0x00E48C24U,
+    0x00E48CB2U,
+    0x00E48D05U,
+    0x00E48D14U,
+    0x00E48D73U,
+    0x00E48DECU,
+    0x00E4902CU,
+    0x00E490A4U,
+    0x00E490B3U,
+    0x00E491F2U,
+    0x00E492B3U,
+    0x00E49465U,
+    0x00E494D3U,
+    0x00E496C5U,
+    0x00E498B3U,
+    0x00E498D3U,
+    0x00E498D9U,
+    0x00E49A99U,
+    0x00E49CB2U,
+    0x00E49D13U,
+    0x00E49D14U,
+    0x00E4A12CU,
+    0x00E4AC22U,
+    0x00E4AC28U,
+    0x00E4AC35U,
+    0x00E4B193U,
+    0x00E4B449U,
+    0x00E4B453U,
+    0x00E4B613U,
+    0x00E4B8B2U,
+    0x00E4B8B3U,
+    0x00E4B941U,
+    0x00E4B9D9U,
+    0x00E4B9EEU,
+    0x00E4BA88U,
+    0x00E4C033U,
+    0x00E4C219U,
+    0x00E4C422U,
+    0x00E4C993U,
+    0x00E4C999U,
+    0x00E4CCA9U,
+    0x00E4CE65U,
+    0x00E4CEB3U,
+    0x00E4D0B2U,
+    0x00E4D0B3U,
+    0x00E4D124U,
+    0x00E4D1EEU,
+    0x00E4D245U,
+    0x00E4D24FU,
+    0x00E4D259U,
+    0x00E4D299U,
+    0x00E4D82CU,
+    0x00E4E0A4U,
+    0x00E4E0B2U,
+    0x00E4E0B3U,
+    0x00E4E125U,
+    0x00E4E82DU,
+    0x00E5BE69U,
+    0x00E78513U,
+    0x00E78859U,
+    0x00E78985U,
+    0x00E78999U,
+    0x00E78D73U,
+    0x00E7902CU,
+    0x00E79099U,
+    0x00E790B3U,
+    0x00E792B3U,
+    0x00E79593U,
+    0x00E79CF3U,
+    0x00E7A1F7U,
+    0x00E7A593U,
+    0x00E7A599U,
+    0x00E7A5D4U,
+    0x00E7A653U,
+    0x00E7A665U,
+    0x00E7A679U,
+    0x00E7B0B3U,
+    0x00E7B193U,
+    0x00E7B1F3U,
+    0x00E7B424U,
+    0x00E7B433U,
+    0x00E7B4AEU,
+    0x00E7B4B3U,
+    0x00E7B523U,
+    0x00E7B5E9U,
+    0x00E7B5F3U,
+    0x00E7B833U,
+    0x00E7B865U,
+    0x00E7B8B3U,
+    0x00E7B8B4U,
+    0x00E7B8F3U,
+    0x00E7B933U,
+    0x00E7B9D9U,
+    0x00E7BB2CU,
+    0x00E7BC53U,
+    0x00E7BD34U,
+    0x00E7BD73U,
+    0x00E7BD79U,
+    0x00E7BDD3U,
+    0x00E7BE13U,
+    0x00E7BE65U,
+    0x00E7C02CU,
+    0x00E7C921U,
+    0x00E7C933U,
+    0x00E7C973U,
+    0x00E7C9A1U,
+    0x00E7C9B3U,
+    0x00E7CA88U,
+    0x00E7CCA4U,
+    0x00E7CCB2U,
+    0x00E7CCB3U,
+    0x00E7CCB9U,
+    0x00E7D02CU,
+    0x00E7D068U,
+    0x00E7D0A4U,
+    0x00E7D0B2U,
+    0x00E7D0B3U,
+    0x00E7D2ADU,
+    0x00E7D584U,
+    0x00E7D585U,
+    0x00E7D593U,
+    0x00E7D5D3U,
+    0x00E7D5D9U,
+    0x00E7D613U,
+    0x00E7D825U,
+    0x00E7D833U,
+    0x00E7D8ACU,
+    0x00E7DAADU,
+    0x00E7DC39U,
+    0x00E7DCA4U,
+    0x00E7DD93U,
+    0x00E7DE93U,
+    0x00E7DE99U,
+    0x00E7E02CU,
+    0x00E7E0B3U,
+    0x00E7E435U,
+    0x00E7E4A4U,
+    0x00E7E4B3U,
+    0x00EA8859U,
+    0x00EA8921U,
+    0x00EA8D01U,
+    0x00EA9099U,
+    0x00EA90B2U,
+    0x00EA90B3U,
+    0x00EA90E5U,
+    0x00EA9125U,
+    0x00EA9348U,
+    0x00EA98D3U,
+    0x00EA9C25U,
+    0x00EAACA4U,
+    0x00EAACB3U,
+    0x00EAB181U,
+    0x00EAB193U,
+    0x00EAB453U,
+    0x00EAB4AEU,
+    0x00EAB5B9U,
+    0x00EAB9D9U,
+    0x00EAC893U,
+    0x00EAC899U,
+    0x00EAC993U,
+    0x00EACA53U,
+    0x00EACA65U,
+    0x00EAD26FU,
+    0x00EAD279U,
+    0x00EAD299U,
+    0x00EC84C6U,
+    0x00EC8581U,
+    0x00ECA5C7U,
+    0x00ECB1EEU,
+    0x00ECB608U,
+    0x00ECCE61U,
+    0x00F0ACA4U,
+    0x00F0ACAEU,
+    0x00F0ACB2U,
+    0x00F0AEADU,
+    0x00F0C8A4U,
+    0x00F0CCB3U,
+    0x00F0CD33U,
+    0x00F0CE93U,
+    0x00F0D0AEU,
+    0x00F0D0B2U,
+    0x00F0D113U,
+    0x00F0D8B3U,
+    0x00F105C7U,
+    0x00F11428U,
+    0x00F11589U,
+    0x00F11665U,
+    0x00F11733U,
+    0x00F12433U,
+    0x00F124A4U,
+    0x00F12534U,
+    0x00F12693U,
+    0x00F128B4U,
+    0x00F13CB3U,
+    0x00F13D85U,
+    0x00F13D89U,
+    0x00F13D93U,
+    0x00F18C2DU,
+    0x00F18EB2U,
+    0x00F1942EU,
+    0x00F1A0B2U,
+    0x00F1A0B3U,
+    0x00F1A245U,
+    0x00F1A259U,
+    0x00F1ACB2U,
+    0x00F1C8A1U,
+    0x00F1D024U,
+    0x00F1D02CU,
+    0x00F1D02EU,
+    0x00F1D033U,
+    0x00F1D0B4U,
+    0x00F1D32CU,
+    0x00F1D589U,
+    0x00F20513U,
+    0x00F20593U,
+    0x00F210B2U,
+    0x00F21199U,
+    0x00F215EEU,
+    0x00F216ADU,
+    0x00F2266DU,
+    0x00F22674U,
+    0x00F226ADU,
+    0x00F23E53U,
+    0x00F23EB2U,
+    0x00F26585U,
+    0x00F26593U,
+    0x00F30733U,
+    0x00F3182CU,
+    0x00F318A4U,
+    0x00F318B2U,
+    0x00F31925U,
+    0x00F33027U,
+    0x00F350AEU,
+    0x00F350B2U,
+    0x00F385B3U,
+    0x00F394A4U,
+    0x00F394B3U,
+    0x00F39D2EU,
+    0x00F3A02DU,
+    0x00F3A6C5U,
+    0x00F3B0A4U,
+    0x00F3B0B2U,
+    0x00F3B0B3U,
+    0x00F3B523U,
+    0x00F3C8B3U,
+    0x00F42433U,
+    0x00F425C7U,
+    0x00F43523U,
+    0x00F43DC5U,
+    0x00F49121U,
+    0x00F4B0A4U,
+    0x00F4B0B2U,
+    0x00F4B973U,
+    0x00F4BA93U,
+    0x00F525A5U,
+    0x00F58609U,
+    0x00F58733U,
+    0x00F59513U,
+    0x00F5C833U,
+    0x00F5D033U,
+    0x00F610AEU,
+    0x00F610B2U,
+    0x00F61125U,
+    0x00F61523U,
+    0x00F6152EU,
+    0x00F615D4U,
+    0x00F615F3U,
+    0x00F616ADU,
+    0x00F625F3U,
+    0x00F626C5U,
+    0x00F63033U,
+    0x00F63036U,
+    0x00F630B2U,
+    0x00F63125U,
+    0x00F63CF9U,
+    0x00F64025U,
+    0x00F640B3U,
+    0x00F68661U,
+    0x00F688B2U,
+    0x00F68A45U,
+    0x00F68AB3U,
+    0x00F694E1U,
+    0x00F695D3U,
+    0x00F69653U,
+    0x00F6A693U,
+    0x00F6B028U,
+    0x00F6BED3U,
+    0x00F6C828U,
+    0x00F70CB2U,
+    0x00F70CB3U,
+    0x00F70CB4U,
+    0x00F70EB3U,
+    0x00F71599U,
+    0x00F71653U,
+    0x00F71659U,
+    0x00F725EEU,
+    0x00F726ADU,
+    0x00F72EB3U,
+    0x00F73039U,
+    0x00F738A4U,
+    0x00F74CB4U,
+    0x00F75123U,
+    0x00F78934U,
+    0x00F7A0A4U,
+    0x00F7B608U,
+    0x00F7BA93U,
+    0x00F7C0A4U,
+    0x00F7C925U,
+    0x00F7CCB3U,
+    0x00F7D124U,
+    0x00F7E8A4U,
+    0x00F7E8B3U,
+    0x00F80513U,
+    0x00F80593U,
+    0x00F815D3U,
+    0x00F81605U,
+    0x00F81641U,
+    0x00F825C5U,
+    0x00F825C7U,
+    0x00F826ADU,
+    0x00F841F3U,
+    0x00F84D2EU,
+    0x00F850A4U,
+    0x00F850B2U,
+    0x00F85123U,
+    0x00F90468U,
+    0x00F90479U,
+    0x00F90593U,
+    0x00F905C7U,
+    0x00F905D4U,
+    0x00F90685U,
+    0x00F908A4U,
+    0x00F90934U,
+    0x00F90C33U,
+    0x00F90D2EU,
+    0x00F910B2U,
+    0x00F911F3U,
+    0x00F91424U,
+    0x00F918B3U,
+    0x00F91C2EU,
+    0x00F91D21U,
+    0x00F91D23U,
+    0x00F91EA5U,
+    0x00F92449U,
+    0x00F924ACU,
+    0x00F92701U,
+    0x00F930B3U,
+    0x00F931EEU,
+    0x00F931F0U,
+    0x00F934B2U,
+    0x00F93933U,
+    0x00F9412EU,
+    0x00F94933U,
+    0x00F9510FU,
+    0x00F9582CU,
+    0x00F969F3U,
+    0x00F98C32U,
+    0x00F9A023U,
+    0x00F9A4B2U,
+    0x00F9B523U,
+    0x00F9B5ECU,
+    0x00F9CD21U,
+    0x00F9D121U,
+    0x00FA0575U,
+    0x00FA0659U,
+    0x00FA20B2U,
+    0x00FA5032U,
+    0x00FA50B2U,
+    0x00FA51F3U,
+    0x00FA8934U,
+    0x00FA8D14U,
+    0x00FA95D3U,
+    0x00FA9D14U,
+    0x00FAA541U,
+    0x00FAB173U,
+    0x00FAB433U,
+    0x00FAB865U,
+    0x00FAB899U,
+    0x00FAC033U,
+    0x00FAC0A4U,
+    0x00FAC105U,
+    0x00FAC113U,
+    0x00FAC925U,
+    0x00FACCACU,
+    0x00FACE93U,
+    0x00FAD059U,
+    0x00FAD08FU,
+    0x00FAD0A4U,
+    0x00FAD0B2U,
+    0x00FAD0EFU,
+    0x00FAD245U,
+    0x00FAD24FU,
+    0x00FAD281U,
+    0x00FAE8ACU,
+    0x00FAE9F3U,
+    0x00FB0593U,
+    0x00FB0659U,
+    0x00FB0685U,
+    0x00FB1593U,
+    0x00FB15D3U,
+    0x00FB1653U,
+    0x00FB1654U,
+    0x00FB25C5U,
+    0x00FB2674U,
+    0x00FB3D24U,
+    0x00FB3D89U,
+    0x00FB3D8FU,
+    0x00FB5585U,
+    0x00FB8D05U,
+    0x00FBA4B3U,
+    0x00FBA5C7U,
+    0x00FBB0A4U,
+    0x00FBB0B2U,
+    0x00FBB0B4U,
+    0x00FBB8A4U,
+    0x00FBB8B2U,
+    0x00FBC8B3U,
+    0x00FBC925U,
+    0x00FBCCAEU,
+    0x00FC09F7U,
+    0x00FC1653U,
+    0x00FC1725U,
+    0x00FC2485U,
+    0x00FC2493U,
+    0x00FC24B3U,
+    0x00FC25A5U,
+    0x00FC25B3U,
+    0x00FC3130U,
+    0x00FC50B2U,
+    0x00FC9653U,
+    0x00FD1569U,
+    0x00FD3DC5U,
+    0x00FD6925U,
+    0x01008593U,
+    0x010085D3U,
+    0x01008C33U,
+    0x01008CA4U,
+    0x01008CB2U,
+    0x01008CB3U,
+    0x01008CB9U,
+    0x01008D01U,
+    0x01008D73U,
+    0x01008DF3U,
+    0x01008E81U,
+    0x01008E93U,
+    0x01009099U,
+    0x01009133U,
+    0x01009185U,
+    0x010091A1U,
+    0x01009245U,
+    0x01009249U,
+    0x0100942EU,
+    0x0100948FU,
+    0x010095EEU,
+    0x01009C2EU,
+    0x01009CA4U,
+    0x01009CB2U,
+    0x01009CB3U,
+    0x01009D85U,
+    0x01009DE4U,
+    0x01009E49U,
+    0x0100A573U,
+    0x0100A593U,
+    0x0100A5D3U,
+    0x0100A5D4U,
+    0x0100A645U,
+    0x0100A653U,
+    0x0100A661U,
+    0x0100A665U,
+    0x0100AD61U,
+    0x0100B033U,
+    0x0100B039U,
+    0x0100B0A1U,
+    0x0100B0A4U,
+    0x0100B0B2U,
+    0x0100B0B3U,
+    0x0100B0B4U,
+    0x0100B133U,
+    0x0100B169U,
+    0x0100B181U,
+    0x0100B193U,
+    0x0100B199U,
+    0x0100B1B3U,
+    0x0100B1B9U,
+    0x0100B209U,
+    0x0100B213U,
+    0x0100B261U,
+    0x0100B279U,
+    0x0100B601U,
+    0x0100B838U,
+    0x0100B865U,
+    0x0100B881U,
+    0x0100B893U,
+    0x0100B899U,
+    0x0100B8A4U,
+    0x0100B8ACU,
+    0x0100B8B3U,
+    0x0100B8E1U,
+    0x0100B8F3U,
+    0x0100B923U,
+    0x0100B92DU,
+    0x0100B96FU,
+    0x0100B9C5U,
+    0x0100B9C9U,
+    0x0100BA79U,
+    0x0100BA8FU,
+    0x0100BA93U,
+    0x0100BA99U,
+    0x0100BD89U,
+    0x0100BD8FU,
+    0x0100C02CU,
+    0x0100C033U,
+    0x0100C037U,
+    0x0100C0B2U,
+    0x0100C0B3U,
+    0x0100C209U,
+    0x0100C219U,
+    0x0100C825U,
+    0x0100C833U,
+    0x0100C868U,
+    0x0100C889U,
+    0x0100C893U,
+    0x0100C899U,
+    0x0100C8A4U,
+    0x0100C8AEU,
+    0x0100C8AFU,
+    0x0100C8B2U,
+    0x0100C8B3U,
+    0x0100C8B5U,
+    0x0100C8B6U,
+    0x0100C8E5U,
+    0x0100C8EFU,
+    0x0100C933U,
+    0x0100C961U,
+    0x0100C969U,
+    0x0100C973U,
+    0x0100C979U,
+    0x0100C985U,
+    0x0100C999U,
+    0x0100C9A1U,
+    0x0100C9ECU,
+    0x0100CA13U,
+    0x0100CA41U,
+    0x0100CA53U,
+    0x0100CA59U,
+    0x0100CA65U,
+    0x0100CA89U,
+    0x0100CA93U,
+    0x0100CA99U,
+    0x0100CAC5U,
+    0x0100CACFU,
+    0x0100CCAFU,
+    0x0100CCB3U,
+    0x0100CD01U,
+    0x0100CD0DU,
+    0x0100CD61U,
+    0x0100CE19U,
+    0x0100CE65U,
+    0x0100CE81U,
+    0x0100CE85U,
+    0x0100CE93U,
+    0x0100CE99U,
+    0x0100D068U,
+    0x0100D0A4U,
+    0x0100D0AEU,
+    0x0100D0B2U,
+    0x0100D0B3U,
+    0x0100D113U,
+    0x0100D12EU,
+    0x0100D12FU,
+    0x0100D161U,
+    0x0100D199U,
+    0x0100D279U,
+    0x0100D285U,
+    0x0100D299U,
+    0x0100D2B3U,
+    0x0100D433U,
+    0x0100D593U,
+    0x0100D665U,
+    0x0100D82EU,
+    0x0100D8A4U,
+    0x0100D8AEU,
+    0x0100D8B2U,
+    0x0100D8B3U,
+    0x0100D924U,
+    0x0100D92EU,
+    0x0100D933U,
+    0x0100DC33U,
+    0x0100DC37U,
+    0x0100DCA4U,
+    0x0100DCB2U,
+    0x0100DD73U,
+    0x0100DD79U,
+    0x0100DD93U,
+    0x0100DDD3U,
+    0x0100E0B3U,
+    0x0100E4A4U,
+    0x0100E4A5U,
+    0x0100E4B2U,
+    0x0100E5F2U,
+    0x0100E664U,
+    0x01028465U,
+    0x01028468U,
+    0x010284E5U,
+    0x010284F3U,
+    0x01028573U,
+    0x01028579U,
+    0x01028593U,
+    0x010285D3U,
+    0x01028645U,
+    0x0102864CU,
+    0x01028653U,
+    0x01028654U,
+    0x01028665U,
+    0x01028693U,
+    0x01028699U,
+    0x010286D9U,
+    0x01028745U,
+    0x01028833U,
+    0x01028C2EU,
+    0x01028D13U,
+    0x01028D65U,
+    0x01028D73U,
+    0x01028D79U,
+    0x0102902CU,
+    0x010290B3U,
+    0x01029133U,
+    0x0102924FU,
+    0x01029465U,
+    0x01029573U,
+    0x01029593U,
+    0x010295D3U,
+    0x010295F9U,
+    0x01029605U,
+    0x01029613U,
+    0x01029653U,
+    0x01029659U,
+    0x010296C5U,
+    0x01029CF9U,
+    0x01029D13U,
+    0x0102A5D3U,
+    0x0102A665U,
+    0x0102A745U,
+    0x0102AC2EU,
+    0x0102ACB3U,
+    0x0102AD2EU,
+    0x0102ADE5U,
+    0x0102B033U,
+    0x0102B035U,
+    0x0102B0B3U,
+    0x0102B0D3U,
+    0x0102B193U,
+    0x0102B1A1U,
+    0x0102B1EEU,
+    0x0102B281U,
+    0x0102B293U,
+    0x0102B82CU,
+    0x0102B865U,
+    0x0102B893U,
+    0x0102B895U,
+    0x0102B8A4U,
+    0x0102B8B3U,
+    0x0102B8EFU,
+    0x0102B925U,
+    0x0102B933U,
+    0x0102B973U,
+    0x0102B9C1U,
+    0x0102B9C5U,
+    0x0102B9C9U,
+    0x0102B9D9U,
+    0x0102BA93U,
+    0x0102BDD3U,
+    0x0102BDD9U,
+    0x0102C181U,
+    0x0102C1F3U,
+    0x0102C219U,
+    0x0102C269U,
+    0x0102C829U,
+    0x0102C865U,
+    0x0102C868U,
+    0x0102C873U,
+    0x0102C895U,
+    0x0102C899U,
+    0x0102C8A1U,
+    0x0102C8B3U,
+    0x0102C92CU,
+    0x0102C933U,
+    0x0102C973U,
+    0x0102C979U,
+    0x0102C9B3U,
+    0x0102C9D3U,
+    0x0102C9E7U,
+    0x0102CA13U,
+    0x0102CA59U,
+    0x0102CA65U,
+    0x0102CA74U,
+    0x0102CA93U,
+    0x0102CAC5U,
+    0x0102CACFU,
+    0x0102CAD3U,
+    0x0102CAD9U,
+    0x0102CD79U,
+    0x0102CDF3U,
+    0x0102CE8FU,
+    0x0102CE93U,
+    0x0102CE99U,
+    0x0102D02CU,
+    0x0102D032U,
+    0x0102D0B2U,
+    0x0102D134U,
+    0x0102D245U,
+    0x0102D249U,
+    0x0102D289U,
+    0x0102D28FU,
+    0x0102D299U,
+    0x0102DCA5U,
+    0x0102DD34U,
+    0x0102E665U,
+    0x010404E5U,
+    0x010405C7U,
+    0x01040645U,
+    0x0104064DU,
+    0x01040665U,
+    0x010414B2U,
+    0x010415C5U,
+    0x010415EEU,
+    0x01041665U,
+    0x0104242CU,
+    0x01042668U,
+    0x0104275AU,
+    0x010431F8U,
+    0x01043C61U,
+    0x01043DC5U,
+    0x01043DCFU,
+    0x01043DD3U,
+    0x01043DD9U,
+    0x01043E8FU,
+    0x01043E93U,
+    0x01044114U,
+    0x01045693U,
+    0x01046581U,
+    0x01046585U,
+    0x010485C9U,
+    0x010485CFU,
+    0x010485D3U,
+    0x0104882CU,
+    0x01048C2CU,
+    0x01048C33U,
+    0x01048C79U,
+    0x01048D73U,
+    0x01048D79U,
+    0x01048DF4U,
+    0x01048E41U,
+    0x01048EACU,
+    0x01049465U,
+    0x010495C4U,
+    0x01049653U,
+    0x01049654U,
+    0x01049681U,
+    0x01049693U,
+    0x01049699U,
+    0x0104974FU,
+    0x01049CF9U,
+    0x01049D14U,
+    0x01049DB9U,
+    0x0104A5C7U,
+    0x0104AC33U,
+    0x0104AC35U,
+    0x0104ACA4U,
+    0x0104ACB2U,
+    0x0104ACB3U,
+    0x0104ACB9U,
+    0x0104AD33U,
+    0x0104AEACU,
+    0x0104B025U,
+    0x0104B026U,
+    0x0104B02FU,
+    0x0104B032U,
+    0x0104B035U,
+    0x0104B037U,
+    0x0104B068U,
+    0x0104B0A1U,
+    0x0104B0A4U,
+    0x0104B0A9U,
+    0x0104B0B2U,
+    0x0104B0B3U,
+    0x0104B133U,
+    0x0104B193U,
+    0x0104B1F4U,
+    0x0104B1F7U,
+    0x0104B2ADU,
+    0x0104B2B3U,
+    0x0104B433U,
+    0x0104B613U,
+    0x0104B833U,
+    0x0104B868U,
+    0x0104B8A4U,
+    0x0104B8B3U,
+    0x0104B8B9U,
+    0x0104B8EFU,
+    0x0104B8F3U,
+    0x0104B96FU,
+    0x0104B973U,
+    0x0104B979U,
+    0x0104B9C1U,
+    0x0104B9D9U,
+    0x0104B9EEU,
+    0x0104B9F4U,
+    0x0104BA81U,
+    0x0104BA8FU,
+    0x0104BA93U,
+    0x0104BAB0U,
+    0x0104BDD3U,
+    0x0104BDD9U,
+    0x0104BEB3U,
+    0x0104BF25U,
+    0x0104BF33U,
+    0x0104C02CU,
+    0x0104C033U,
+    0x0104C0A4U,
+    0x0104C0B2U,
+    0x0104C0B3U,
+    0x0104C0B4U,
+    0x0104C133U,
+    0x0104C134U,
+    0x0104C219U,
+    0x0104C2ACU,
+    0x0104C6A5U,
+    0x0104C829U,
+    0x0104C993U,
+    0x0104C9D3U,
+    0x0104C9E7U,
+    0x0104CC6FU,
+    0x0104CCB3U,
+    0x0104CD79U,
+    0x0104CDF3U,
+    0x0104CE79U,
+    0x0104CE85U,
+    0x0104D033U,
+    0x0104D068U,
+    0x0104D113U,
+    0x0104D119U,
+    0x0104D1EEU,
+    0x0104D1F4U,
+    0x0104D281U,
+    0x0104D5B3U,
+    0x0104D9F4U,
+    0x0104E0ACU,
+    0x0104E0B3U,
+    0x0104E125U,
+    0x0104E8A4U,
+    0x0104E8B3U,
+    0x0104EB41U,
+    0x01060433U,
+    0x01060465U,
+    0x0106046BU,
+    0x010604E5U,
+    0x01060524U,
+    0x0106052EU,
+    0x01060534U,
+    0x010605C5U,
+    0x010605CBU,
+    0x010605D3U,
+    0x010605D4U,
+    0x01060613U,
+    0x01060668U,
+    0x0106066DU,
+    0x01060674U,
+    0x01060685U,
+    0x01060693U,
+    0x01060694U,
+    0x01060699U,
+    0x01060721U,
+    0x01060733U,
+    0x01060741U,
+    0x01061424U,
+    0x01061433U,
+    0x01061434U,
+    0x01061445U,
+    0x01061453U,
+    0x010615C1U,
+    0x010615EEU,
+    0x01061668U,
+    0x010616F3U,
+    0x01062461U,
+    0x010624A4U,
+    0x010624B2U,
+    0x010624B3U,
+    0x010625B3U,
+    0x010625C7U,
+    0x010625CBU,
+    0x01063C34U,
+    0x01063C93U,
+    0x01063DC7U,
+    0x01063DCBU,
+    0x01063DEBU,
+    0x01063E13U,
+    0x01063E93U,
+    0x01063E9AU,
+    0x01063EABU,
+    0x01063EF3U,
+    0x01063F25U,
+    0x01063F33U,
+    0x0106546BU,
+    0x010654B3U,
+    0x010654C6U,
+    0x010654F3U,
+    0x010655A2U,
+    0x010655A5U,
+    0x010655B0U,
+    0x010655B3U,
+    0x010655B9U,
+    0x010655CBU,
+    0x010655F4U,
+    0x01065668U,
+    0x0106568FU,
+    0x010664B2U,
+    0x01078468U,
+    0x01078561U,
+    0x01078565U,
+    0x010789F9U,
+    0x01078D73U,
+    0x01078D79U,
+    0x0107902CU,
+    0x01079099U,
+    0x010790B8U,
+    0x010790E5U,
+    0x010790F9U,
+    0x01079121U,
+    0x010795B3U,
+    0x01079613U,
+    0x01079679U,
+    0x01079693U,
+    0x01079CB9U,
+    0x01079CE5U,
+    0x01079DF3U,
+    0x0107A0A4U,
+    0x0107A595U,
+    0x0107A5C4U,
+    0x0107A5D4U,
+    0x0107A665U,
+    0x0107AC2CU,
+    0x0107ACA4U,
+    0x0107ACB2U,
+    0x0107ACB3U,
+    0x0107ACB9U,
+    0x0107AD25U,
+    0x0107B032U,
+    0x0107B0A4U,
+    0x0107B0B2U,
+    0x0107B0B3U,
+    0x0107B0B9U,
+    0x0107B12FU,
+    0x0107B133U,
+    0x0107B145U,
+    0x0107B161U,
+    0x0107B173U,
+    0x0107B193U,
+    0x0107B199U,
+    0x0107B1F3U,
+    0x0107B293U,
+    0x0107B330U,
+    0x0107B333U,
+    0x0107B445U,
+    0x0107B4B3U,
+    0x0107B5B9U,
+    0x0107B5F3U,
+    0x0107B613U,
+    0x0107B865U,
+    0x0107B879U,
+    0x0107B893U,
+    0x0107B8B3U,
+    0x0107B8B9U,
+    0x0107B8E1U,
+    0x0107B8EFU,
+    0x0107B8F3U,
+    0x0107B8F9U,
+    0x0107B973U,
+    0x0107BA93U,
+    0x0107BA99U,
+    0x0107BB55U,
+    0x0107BC68U,
+    0x0107BC93U,
+    0x0107BCA4U,
+    0x0107BCD3U,
+    0x0107BCD9U,
+    0x0107BD13U,
+    0x0107BD41U,
+    0x0107BD61U,
+    0x0107BD73U,
+    0x0107BD93U,
+    0x0107BDD3U,
+    0x0107BE13U,
+    0x0107BE19U,
+    0x0107BE49U,
+    0x0107BE54U,
+    0x0107BE93U,
+    0x0107BEC5U,
+    0x0107BED9U,
+    0x0107C0B3U,
+    0x0107C201U,
+    0x0107C219U,
+    0x0107C279U,
+    0x0107C825U,
+    0x0107C82CU,
+    0x0107C868U,
+    0x0107C8A4U,
+    0x0107C8B2U,
+    0x0107C8B3U,
+    0x0107C8E5U,
+    0x0107C8F9U,
+    0x0107C92EU,
+    0x0107C973U,
+    0x0107C979U,
+    0x0107C9CFU,
+    0x0107C9D3U,
+    0x0107C9D9U,
+    0x0107CA81U,
+    0x0107CA93U,
+    0x0107CA99U,
+    0x0107CCA4U,
+    0x0107CCB2U,
+    0x0107CCB3U,
+    0x0107CCB9U,
+    0x0107CD0FU,
+    0x0107CD34U,
+    0x0107CE65U,
+    0x0107CE93U,
+    0x0107D025U,
+    0x0107D068U,
+    0x0107D0A4U,
+    0x0107D0B3U,
+    0x0107D12EU,
+    0x0107D1EFU,
+    0x0107D279U,
+    0x0107D28FU,
+    0x0107D293U,
+    0x0107D299U,
+    0x0107D468U,
+    0x0107D4C6U,
+    0x0107D4D3U,
+    0x0107D565U,
+    0x0107D573U,
+    0x0107D585U,
+    0x0107D590U,
+    0x0107D594U,
+    0x0107D5C4U,
+    0x0107D605U,
+    0x0107D614U,
+    0x0107D653U,
+    0x0107D693U,
+    0x0107D699U,
+    0x0107DC2EU,
+    0x0107DCB2U,
+    0x0107DD2EU,
+    0x0107DDC4U,
+    0x0107DDD3U,
+    0x0107DDD9U,
+    0x0107DE45U,
+    0x0107E0A4U,
+    0x0107E0B3U,
+    0x0107E5D4U,
+    0x0107E5F5U,
+    0x0107E665U,
+    0x0107EB59U,
+    0x0109042DU,
+    0x01090493U,
+    0x01090515U,
+    0x010905B3U,
+    0x010905C1U,
+    0x010905C7U,
+    0x010905CBU,
+    0x010905F3U,
+    0x01090665U,
+    0x01090685U,
+    0x01090693U,
+    0x01090694U,
+    0x01090699U,
+    0x010906B3U,
+    0x010906EEU,
+    0x01090733U,
+    0x01091499U,
+    0x010914A4U,
+    0x010914AEU,
+    0x010914B3U,
+    0x01091526U,
+    0x010915B3U,
+    0x010915B9U,
+    0x010915D4U,
+    0x010915EEU,
+    0x010915F0U,
+    0x01091613U,
+    0x01091661U,
+    0x01091665U,
+    0x01091673U,
+    0x01091674U,
+    0x010916C5U,
+    0x01091719U,
+    0x01091733U,
+    0x0109242CU,
+    0x01092465U,
+    0x0109246BU,
+    0x01092479U,
+    0x01092485U,
+    0x010924A4U,
+    0x010924A6U,
+    0x010924B2U,
+    0x010924B3U,
+    0x010924F3U,
+    0x0109258CU,
+    0x010925A1U,
+    0x010925A5U,
+    0x010925A9U,
+    0x010925AFU,
+    0x010925B0U,
+    0x010925B3U,
+    0x010925B9U,
+    0x010925CBU,
+    0x010925D4U,
+    0x010925EEU,
+    0x010925F2U,
+    0x01092665U,
+    0x0109266DU,
+    0x01092673U,
+    0x010926D9U,
+    0x01092745U,
+    0x01093C33U,
+    0x01093C45U,
+    0x01093C53U,
+    0x01093C93U,
+    0x01093CADU,
+    0x01093CD3U,
+    0x01093CF3U,
+    0x01093D2EU,
+    0x01093D65U,
+    0x01093D85U,
+    0x01093D8CU,
+    0x01093DAFU,
+    0x01093DB3U,
+    0x01093DC5U,
+    0x01093DC7U,
+    0x01093DCBU,
+    0x01093DE6U,
+    0x01093E13U,
+    0x01093E45U,
+    0x01093E65U,
+    0x01093E6FU,
+    0x01093E73U,
+    0x01093E74U,
+    0x01093E79U,
+    0x01093E8FU,
+    0x01093EA4U,
+    0x01093EACU,
+    0x01093EC5U,
+    0x01093EECU,
+    0x01093EF3U,
+    0x01093F19U,
+    0x01093F2EU,
+    0x01095485U,
+    0x010955C5U,
+    0x010955D4U,
+    0x01095681U,
+    0x010964B2U,
+    0x01096665U,
+    0x0109858DU,
+    0x010996A4U,
+    0x0109A037U,
+    0x0109A5EEU,
+    0x0109BC25U,
+    0x0109BC29U,
+    0x0109BC33U,
+    0x0109BE41U,
+    0x0109E468U,
+    0x0109E5F0U,
+    0x010A886FU,
+    0x010A88B3U,
+    0x010A8923U,
+    0x010A8933U,
+    0x010A8C2EU,
+    0x010A8CB2U,
+    0x010A8CB3U,
+    0x010A8D61U,
+    0x010A8D73U,
+    0x010A9099U,
+    0x010A90E5U,
+    0x010A90F9U,
+    0x010A9123U,
+    0x010A91F2U,
+    0x010A9279U,
+    0x010A92B3U,
+    0x010A9653U,
+    0x010A98C1U,
+    0x010A98D3U,
+    0x010A98D9U,
+    0x010A9CF9U,
+    0x010A9D2CU,
+    0x010AA033U,
+    0x010AA828U,
+    0x010AA833U,
+    0x010AAC33U,
+    0x010AACA4U,
+    0x010AACB2U,
+    0x010AACB3U,
+    0x010AACB9U,
+    0x010AAD61U,
+    0x010AAEB3U,
+    0x010AB02FU,
+    0x010AB033U,
+    0x010AB0A4U,
+    0x010AB0B2U,
+    0x010AB0B3U,
+    0x010AB12BU,
+    0x010AB133U,
+    0x010AB161U,
+    0x010AB173U,
+    0x010AB189U,
+    0x010AB193U,
+    0x010AB199U,
+    0x010AB1AFU,
+    0x010AB213U,
+    0x010AB219U,
+    0x010AB265U,
+    0x010AB2B3U,
+    0x010AB433U,
+    0x010AB525U,
+    0x010AB613U,
+    0x010AB833U,
+    0x010AB865U,
+    0x010AB868U,
+    0x010AB8E1U,
+    0x010AB8F3U,
+    0x010AB949U,
+    0x010AB961U,
+    0x010AB973U,
+    0x010AB979U,
+    0x010AB9D9U,
+    0x010ABA8FU,
+    0x010ABA93U,
+    0x010ABA99U,
+    0x010AC025U,
+    0x010AC033U,
+    0x010AC12CU,
+    0x010AC219U,
+    0x010AC2B3U,
+    0x010AC881U,
+    0x010AC8A4U,
+    0x010AC8A5U,
+    0x010AC8B2U,
+    0x010AC8B3U,
+    0x010AC8E5U,
+    0x010AC92EU,
+    0x010AC933U,
+    0x010AC993U,
+    0x010ACA19U,
+    0x010ACA53U,
+    0x010ACA65U,
+    0x010ACA79U,
+    0x010ACA99U,
+    0x010ACCB3U,
+    0x010ACD19U,
+    0x010ACD85U,
+    0x010AD124U,
+    0x010AD1EEU,
+    0x010AD289U,
+    0x010AD28FU,
+    0x010AD293U,
+    0x010AD299U,
+    0x010AE8ACU,
+    0x010BB8A4U,
+    0x010C8693U,
+    0x010C9693U,
+    0x010C9C2CU,
+    0x010C9DB9U,
+    0x010CA5D3U,
+    0x010CB1EEU,
+    0x010CB8A4U,
+    0x010CB8B3U,
+    0x010CBD24U,
+    0x010CBE93U,
+    0x010CC82CU,
+    0x010CC82EU,
+    0x010CC8B3U,
+    0x010CC8B8U,
+    0x010CC923U,
+    0x010CC9F3U,
+    0x010CE0A4U,
+    0x010CE0B3U,
+    0x010CE125U,
+    0x010CE133U,
+    0x010D075AU,
+    0x01109133U,
+    0x0110A493U,
+    0x0110A831U,
+    0x0110B834U,
+    0x0110C12BU,
+    0x01148981U,
+    0x0117C113U,
+    0x0117C9A1U,
+    0x011A846BU,
+    0x011A8493U,
+    0x011A84C6U,
+    0x011A84F3U,
+    0x011A852CU,
+    0x011A8532U,
+    0x011A8533U,
+    0x011A8565U,
+    0x011A8579U,
+    0x011A8585U,
+    0x011A858DU,
+    0x011A85D4U,
+    0x011A8645U,
+    0x011A864BU,
+    0x011A8654U,
+    0x011A8668U,
+    0x011A8669U,
+    0x011A8673U,
+    0x011A8685U,
+    0x011A8693U,
+    0x011A8724U,
+    0x011A8733U,
+    0x011A8934U,
+    0x011A942EU,
+    0x011A94AEU,
+    0x011A94B2U,
+    0x011A958CU,
+    0x011A95A5U,
+    0x011A95C1U,
+    0x011A964EU,
+    0x011A9659U,
+    0x011A9674U,
+    0x011A96A5U,
+    0x011A972EU,
+    0x011A9733U,
+    0x011AA468U,
+    0x011AA46BU,
+    0x011AA493U,
+    0x011AA4B4U,
+    0x011AA4C6U,
+    0x011AA58CU,
+    0x011AA594U,
+    0x011AA5B3U,
+    0x011AA5C1U,
+    0x011AA5C5U,
+    0x011AA5CFU,
+    0x011AA5D3U,
+    0x011AA5D4U,
+    0x011AA60FU,
+    0x011AA613U,
+    0x011AA615U,
+    0x011AA645U,
+    0x011AA64BU,
+    0x011AA654U,
+    0x011AA674U,
+    0x011AA685U,
+    0x011AA693U,
+    0x011ABC24U,
+    0x011ABC93U,
+    0x011ABD26U,
+    0x011ABD2EU,
+    0x011ABD34U,
+    0x011ABD8CU,
+    0x011ABDCBU,
+    0x011ABE13U,
+    0x011ABE81U,
+    0x011ABE85U,
+    0x011ABE88U,
+    0x011ACA68U,
+    0x011AE685U,
+    0x01208834U,
+    0x01208849U,
+    0x01208923U,
+    0x01208924U,
+    0x01208933U,
+    0x01208CA4U,
+    0x01208CB2U,
+    0x01208CB3U,
+    0x01208D05U,
+    0x01208D73U,
+    0x01208DEEU,
+    0x01209032U,
+    0x012090E5U,
+    0x01209129U,
+    0x0120912FU,
+    0x01209138U,
+    0x012091EEU,
+    0x012098D3U,
+    0x01209A93U,
+    0x01209C33U,
+    0x01209C85U,
+    0x01209CA4U,
+    0x01209CA5U,
+    0x01209CB2U,
+    0x01209CB3U,
+    0x01209CE1U,
+    0x01209CF3U,
+    0x01209CF9U,
+    0x01209D33U,
+    0x01209EB3U,
+    0x0120A0A4U,
+    0x0120A2A9U,
+    0x0120A433U,
+    0x0120A493U,
+    0x0120A573U,
+    0x0120A585U,
+    0x0120A593U,
+    0x0120A5C5U,
+    0x0120A5D3U,
+    0x0120A5D9U,
+    0x0120A644U,
+    0x0120A665U,
+    0x0120A681U,
+    0x0120A693U,
+    0x0120A828U,
+    0x0120A833U,
+    0x0120A8B3U,
+    0x0120ACA4U,
+    0x0120ACA5U,
+    0x0120ACB2U,
+    0x0120ACB3U,
+    0x0120AD21U,
+    0x0120AD33U,
+    0x0120AEB3U,
+    0x0120B0B3U,
+    0x0120B199U,
+    0x0120B208U,
+    0x0120B42CU,
+    0x0120B4A5U,
+    0x0120B4AEU,
+    0x0120B4B4U,
+    0x0120B525U,
+    0x0120B52EU,
+    0x0120B533U,
+    0x0120B5B9U,
+    0x0120B613U,
+    0x0120B6B3U,
+    0x0120B833U,
+    0x0120B865U,
+    0x0120B868U,
+    0x0120B893U,
+    0x0120B899U,
+    0x0120B8A5U,
+    0x0120B8E1U,
+    0x0120B8E5U,
+    0x0120B8E9U,
+    0x0120B8F3U,
+    0x0120B8F9U,
+    0x0120B924U,
+    0x0120B933U,
+    0x0120B965U,
+    0x0120B973U,
+    0x0120BA93U,
+    0x0120C0A4U,
+    0x0120C0B2U,
+    0x0120C0B3U,
+    0x0120C105U,
+    0x0120C124U,
+    0x0120C205U,
+    0x0120C8A4U,
+    0x0120C8A5U,
+    0x0120C8B2U,
+    0x0120C8B3U,
+    0x0120C973U,
+    0x0120CCA4U,
+    0x0120CCB2U,
+    0x0120CCB3U,
+    0x0120CE13U,
+    0x0120CE19U,
+    0x0120CE65U,
+    0x0120CE81U,
+    0x0120D02CU,
+    0x0120D02EU,
+    0x0120D033U,
+    0x0120D068U,
+    0x0120D0A4U,
+    0x0120D0ACU,
+    0x0120D0B2U,
+    0x0120D0B3U,
+    0x0120D101U,
+    0x0120D105U,
+    0x0120D113U,
+    0x0120D12FU,
+    0x0120D1EFU,
+    0x0120D1F3U,
+    0x0120D299U,
+    0x0120D2B3U,
+    0x0120D5D3U,
+    0x0120D60FU,
+    0x0120D8A4U,
+    0x0120D8ACU,
+    0x0120D8AEU,
+    0x0120D8B2U,
+    0x0120D8B3U,
+    0x0120D8B9U,
+    0x0120D92EU,
+    0x0120DCB2U,
+    0x0120DD2EU,
+    0x0120DD99U,
+    0x0120DDD3U,
+    0x0120E0A4U,
+    0x0120E0B3U,
+    0x0120E428U,
+    0x0120E433U,
+    0x0120E4A4U,
+    0x0120E585U,
+    0x0120E5C5U,
+    0x0120E5EEU,
+    0x0120E8A4U,
+    0x0120E8A5U,
+    0x0120E8B2U,
+    0x0120E8B3U,
+    0x0120E9EFU,
+    0x0120E9F2U,
+    0x01228468U,
+    0x01228474U,
+    0x01228484U,
+    0x01228493U,
+    0x01228499U,
+    0x01228533U,
+    0x01228573U,
+    0x0122858DU,
+    0x0122858FU,
+    0x01228593U,
+    0x012285A5U,
+    0x012285B3U,
+    0x012285B9U,
+    0x012285D3U,
+    0x01228613U,
+    0x0122864DU,
+    0x01228653U,
+    0x01228674U,
+    0x01228681U,
+    0x01228685U,
+    0x012286C5U,
+    0x01228832U,
+    0x01228845U,
+    0x012288A3U,
+    0x012288ACU,
+    0x01228924U,
+    0x01228934U,
+    0x012289F0U,
+    0x01228AB3U,
+    0x01228AB4U,
+    0x01228AB9U,
+    0x01228C2CU,
+    0x01228C30U,
+    0x01228C65U,
+    0x01228C6FU,
+    0x01228C79U,
+    0x01228D34U,
+    0x01228D73U,
+    0x01228DEEU,
+    0x01228E81U,
+    0x01228E89U,
+    0x01228E8FU,
+    0x01228EB2U,
+    0x01228EB4U,
+    0x0122902EU,
+    0x01229093U,
+    0x01229099U,
+    0x012290A4U,
+    0x012290B3U,
+    0x01229121U,
+    0x01229124U,
+    0x01229130U,
+    0x01229199U,
+    0x012291EEU,
+    0x012291F3U,
+    0x012291F8U,
+    0x01229259U,
+    0x012292A2U,
+    0x012292B8U,
+    0x01229325U,
+    0x01229468U,
+    0x01229485U,
+    0x01229493U,
+    0x01229499U,
+    0x012294D3U,
+    0x012294D9U,
+    0x01229573U,
+    0x01229579U,
+    0x01229593U,
+    0x012295D3U,
+    0x01229674U,
+    0x012296C5U,
+    0x012298A4U,
+    0x012298ACU,
+    0x012298B2U,
+    0x012298CFU,
+    0x01229933U,
+    0x01229934U,
+    0x01229938U,
+    0x01229999U,
+    0x01229A59U,
+    0x01229C2CU,
+    0x01229C32U,
+    0x01229CB3U,
+    0x01229CEFU,
+    0x01229D25U,
+    0x01229DA1U,
+    0x01229DC1U,
+    0x01229DF3U,
+    0x01229EB2U,
+    0x0122A022U,
+    0x0122A0ADU,
+    0x0122A4D3U,
+    0x0122A4D9U,
+    0x0122A4EEU,
+    0x0122A569U,
+    0x0122A573U,
+    0x0122A5CBU,
+    0x0122A5D3U,
+    0x0122A644U,
+    0x0122A674U,
+    0x0122A6C5U,
+    0x0122A927U,
+    0x0122A9EEU,
+    0x0122ACA4U,
+    0x0122ACB3U,
+    0x0122ACB9U,
+    0x0122B038U,
+    0x0122B039U,
+    0x0122B0B4U,
+    0x0122B123U,
+    0x0122B125U,
+    0x0122B134U,
+    0x0122B18FU,
+    0x0122B42EU,
+    0x0122B430U,
+    0x0122B4AEU,
+    0x0122B4B4U,
+    0x0122B4B8U,
+    0x0122B534U,
+    0x0122B538U,
+    0x0122B82CU,
+    0x0122B839U,
+    0x0122B893U,
+    0x0122B8B7U,
+    0x0122B8B9U,
+    0x0122B8E1U,
+    0x0122B927U,
+    0x0122B92EU,
+    0x0122B9C5U,
+    0x0122B9F3U,
+    0x0122BA85U,
+    0x0122BA93U,
+    0x0122BD2CU,
+    0x0122BE47U,
+    0x0122C039U,
+    0x0122C0A7U,
+    0x0122C0ACU,
+    0x0122C12EU,
+    0x0122C181U,
+    0x0122C199U,
+    0x0122C1F3U,
+    0x0122C1F4U,
+    0x0122C213U,
+    0x0122C24FU,
+    0x0122C82EU,
+    0x0122C927U,
+    0x0122CAAEU,
+    0x0122CC34U,
+    0x0122CC37U,
+    0x0122CC39U,
+    0x0122CCA5U,
+    0x0122CCB3U,
+    0x0122CCB4U,
+    0x0122CCB7U,
+    0x0122CD24U,
+    0x0122CD2EU,
+    0x0122CD34U,
+    0x0122CDE4U,
+    0x0122CDF7U,
+    0x0122CE8FU,
+    0x0122CE93U,
+    0x0122CE99U,
+    0x0122CEB3U,
+    0x0122D027U,
+    0x0122D038U,
+    0x0122D068U,
+    0x0122D0ADU,
+    0x0122D121U,
+    0x0122D125U,
+    0x0122D1F8U,
+    0x0122D24FU,
+    0x0122D259U,
+    0x0122D665U,
+    0x0122D8ACU,
+    0x0122D8B4U,
+    0x0122D925U,
+    0x0122DAA5U,
+    0x0122DC2EU,
+    0x0122DC38U,
+    0x0122DCA4U,
+    0x0122DCB4U,
+    0x0122DD2EU,
+    0x0122DDEEU,
+    0x0122DE88U,
+    0x0122E0B3U,
+    0x0122E8B3U,
+    0x01241433U,
+    0x012415A5U,
+    0x012416ADU,
+    0x012424B3U,
+    0x012425A5U,
+    0x012425C5U,
+    0x012425CFU,
+    0x01243C99U,
+    0x01243DA2U,
+    0x01243DC5U,
+    0x012455A2U,
+    0x012465A5U,
+    0x012465C5U,
+    0x01246681U,
+    0x01248493U,
+    0x01248593U,
+    0x012485D4U,
+    0x01248681U,
+    0x01248833U,
+    0x01248859U,
+    0x012488B3U,
+    0x01248CA4U,
+    0x01248CB2U,
+    0x01248CB3U,
+    0x01248CB9U,
+    0x01248D14U,
+    0x01248D2EU,
+    0x01248D73U,
+    0x012490B2U,
+    0x012490B3U,
+    0x012490E5U,
+    0x012490F9U,
+    0x01249123U,
+    0x01249593U,
+    0x012495B3U,
+    0x012496C5U,
+    0x012498B2U,
+    0x012498D3U,
+    0x01249985U,
+    0x01249A85U,
+    0x01249A93U,
+    0x01249A99U,
+    0x01249CF3U,
+    0x01249D14U,
+    0x01249D24U,
+    0x01249DECU,
+    0x01249DF2U,
+    0x0124B0A4U,
+    0x0124B0B3U,
+    0x0124B0B9U,
+    0x0124B185U,
+    0x0124B193U,
+    0x0124B425U,
+    0x0124B4A4U,
+    0x0124B4B2U,
+    0x0124B4B3U,
+    0x0124B6B3U,
+    0x0124B893U,
+    0x0124B899U,
+    0x0124B8B3U,
+    0x0124B8F3U,
+    0x0124B973U,
+    0x0124BA65U,
+    0x0124BD41U,
+    0x0124BE93U,
+    0x0124C0A4U,
+    0x0124C0AEU,
+    0x0124C0B2U,
+    0x0124C0B3U,
+    0x0124C213U,
+    0x0124CCAEU,
+    0x0124CCB2U,
+    0x0124CCB3U,
+    0x0124CD09U,
+    0x0124CD73U,
+    0x0124CD79U,
+    0x0124CE13U,
+    0x0124CEB3U,
+    0x0124D0B3U,
+    0x0124D293U,
+    0x0124D359U,
+    0x0124D82CU,
+    0x0124D833U,
+    0x0124D8A4U,
+    0x0124D8ACU,
+    0x0124D8AEU,
+    0x0124D8B2U,
+    0x0124D8B3U,
+    0x0124D8B4U,
+    0x0124E42CU,
+    0x0124E833U,
+    0x01278468U,
+    0x01278493U,
+    0x012785B3U,
+    0x012785D3U,
+    0x01278653U,
+    0x01278659U,
+    0x01278674U,
+    0x01278685U,
+    0x012788A4U,
+    0x012788B3U,
+    0x0127892EU,
+    0x01278985U,
+    0x012789F4U,
+    0x01278D73U,
+    0x01278D79U,
+    0x012790A4U,
+    0x012790AFU,
+    0x012790B3U,
+    0x01279CB2U,
+    0x01279EA5U,
+    0x01279EB9U,
+    0x0127A0B3U,
+    0x0127A493U,
+    0x0127A593U,
+    0x0127A599U,
+    0x0127A5D3U,
+    0x0127A674U,
+    0x0127A82BU,
+    0x0127A933U,
+    0x0127ACA4U,
+    0x0127ACB2U,
+    0x0127ACB3U,
+    0x0127B027U,
+    0x0127B0B3U,
+    0x0127B0D3U,
+    0x0127B193U,
+    0x0127B42CU,
+    0x0127B42EU,
+    0x0127B4AFU,
+    0x0127B613U,
+    0x0127B885U,
+    0x0127B88FU,
+    0x0127B8AFU,
+    0x0127B8B3U,
+    0x0127B92EU,
+    0x0127B9C5U,
+    0x0127BA85U,
+    0x0127BA93U,
+    0x0127BC93U,
+    0x0127BCD3U,
+    0x0127BCD9U,
+    0x0127BD73U,
+    0x0127BD79U,
+    0x0127BDB3U,
+    0x0127BDB9U,
+    0x0127BDD3U,
+    0x0127BE13U,
+    0x0127BE19U,
+    0x0127BE61U,
+    0x0127BE65U,
+    0x0127BE74U,
+    0x0127BE93U,
+    0x0127BE99U,
+    0x0127C0A4U,
+    0x0127C0B2U,
+    0x0127C0B3U,
+    0x0127C0B9U,
+    0x0127C6A5U,
+    0x0127C82CU,
+    0x0127C8B3U,
+    0x0127C923U,
+    0x0127C924U,
+    0x0127C925U,
+    0x0127CA93U,
+    0x0127CA99U,
+    0x0127CCA4U,
+    0x0127CCB3U,
+    0x0127CCB4U,
+    0x0127CD09U,
+    0x0127CD2EU,
+    0x0127CD34U,
+    0x0127CE89U,
+    0x0127CE93U,
+    0x0127D02CU,
+    0x0127D02EU,
+    0x0127D033U,
+    0x0127D068U,
+    0x0127D0A4U,
+    0x0127D0B3U,
+    0x0127D133U,
+    0x0127D193U,
+    0x0127D1EEU,
+    0x0127D1F2U,
+    0x0127D1F3U,
+    0x0127D285U,
+    0x0127D4AEU,
+    0x0127D4B3U,
+    0x0127D4E5U,
+    0x0127D4E8U,
+    0x0127D585U,
+    0x0127D593U,
+    0x0127D5B3U,
+    0x0127D5C4U,
+    0x0127D613U,
+    0x0127D619U,
+    0x0127D665U,
+    0x0127D674U,
+    0x0127D685U,
+    0x0127D688U,
+    0x0127D693U,
+    0x0127D8A4U,
+    0x0127D8AEU,
+    0x0127D8B2U,
+    0x0127D8B3U,
+    0x0127DC2EU,
+    0x0127DC99U,
+    0x0127DCA4U,
+    0x0127DCACU,
+    0x0127DCAEU,
+    0x0127DCB2U,
+    0x0127DD25U,
+    0x0127DDA5U,
+    0x0127DDC4U,
+    0x0127DE88U,
+    0x0127DE93U,
+    0x0127E42CU,
+    0x0127E5C5U,
+    0x0127E674U,
+    0x0127E8B4U,
+    0x0127E934U,
+    0x012A85C1U,
+    0x012A8829U,
+    0x012A8859U,
+    0x012A88ACU,
+    0x012A88B3U,
+    0x012A892EU,
+    0x012A8985U,
+    0x012A8989U,
+    0x012A8AB3U,
+    0x012A8D05U,
+    0x012A8D73U,
+    0x012A9033U,
+    0x012A9093U,
+    0x012A9099U,
+    0x012A90B2U,
+    0x012A90B3U,
+    0x012A9125U,
+    0x012A9133U,
+    0x012A9481U,
+    0x012A9653U,
+    0x012A98C5U,
+    0x012A98D3U,
+    0x012A9C25U,
+    0x012A9C2CU,
+    0x012A9C59U,
+    0x012A9CF9U,
+    0x012AA5C7U,
+    0x012AA5D3U,
+    0x012AAD13U,
+    0x012AB0A4U,
+    0x012AB0B2U,
+    0x012AB0B3U,
+    0x012AB42CU,
+    0x012AB441U,
+    0x012AB44FU,
+    0x012AB4AEU,
+    0x012AB4B3U,
+    0x012AB599U,
+    0x012AB5B9U,
+    0x012AB5F2U,
+    0x012AB60FU,
+    0x012AB613U,
+    0x012AB619U,
+    0x012AB868U,
+    0x012AB893U,
+    0x012AB8A4U,
+    0x012AB8B3U,
+    0x012AB8F3U,
+    0x012AB923U,
+    0x012AB9D9U,
+    0x012ABA93U,
+    0x012ABA99U,
+    0x012AC0A5U,
+    0x012AC121U,
+    0x012AC82CU,
+    0x012ACA13U,
+    0x012ACAB3U,
+    0x012ACC33U,
+    0x012ACCB3U,
+    0x012ACD19U,
+    0x012ACD73U,
+    0x012ACDA1U,
+    0x012ACE65U,
+    0x012ACE93U,
+    0x012ACE99U,
+    0x012AD113U,
+    0x012AD12EU,
+    0x012AD299U,
+    0x012C8593U,
+    0x012C8834U,
+    0x012CACA4U,
+    0x012CACB3U,
+    0x012CB5A5U,
+    0x012CB893U,
+    0x012CBE93U,
+    0x012CC0B2U,
+    0x013084F3U,
+    0x0130882CU,
+    0x013088A4U,
+    0x013088B2U,
+    0x013088B3U,
+    0x01308901U,
+    0x0130892EU,
+    0x01308932U,
+    0x01308985U,
+    0x013089F4U,
+    0x01308A41U,
+    0x01308A45U,
+    0x01308D73U,
+    0x01308E41U,
+    0x0130908FU,
+    0x013090B3U,
+    0x01309105U,
+    0x01309115U,
+    0x01309133U,
+    0x01309199U,
+    0x013091F3U,
+    0x01309341U,
+    0x013098A4U,
+    0x013098B2U,
+    0x013098B3U,
+    0x01309C33U,
+    0x01309CB2U,
+    0x01309CB3U,
+    0x01309CF9U,
+    0x01309DF3U,
+    0x01309EADU,
+    0x0130A0A2U,
+    0x0130A122U,
+    0x0130A465U,
+    0x0130A46BU,
+    0x0130A473U,
+    0x0130A493U,
+    0x0130A4E1U,
+    0x0130A593U,
+    0x0130A5B3U,
+    0x0130A5C5U,
+    0x0130A5D3U,
+    0x0130A5D4U,
+    0x0130A653U,
+    0x0130A674U,
+    0x0130A688U,
+    0x0130A9F5U,
+    0x0130AC29U,
+    0x0130ACB2U,
+    0x0130ACB3U,
+    0x0130AD21U,
+    0x0130AD33U,
+    0x0130AE89U,
+    0x0130B024U,
+    0x0130B02CU,
+    0x0130B034U,
+    0x0130B0B0U,
+    0x0130B0B3U,
+    0x0130B0B4U,
+    0x0130B123U,
+    0x0130B138U,
+    0x0130B185U,
+    0x0130B199U,
+    0x0130B1A9U,
+    0x0130B1ECU,
+    0x0130B1EEU,
+    0x0130B1F0U,
+    0x0130B201U,
+    0x0130B213U,
+    0x0130B261U,
+    0x0130B265U,
+    0x0130B28FU,
+    0x0130B293U,
+    0x0130B299U,
+    0x0130B2A5U,
+    0x0130B2B4U,
+    0x0130B2C5U,
+    0x0130B2CFU,
+    0x0130B42EU,
+    0x0130B433U,
+    0x0130B441U,
+    0x0130B44FU,
+    0x0130B4ABU,
+    0x0130B4ACU,
+    0x0130B4AEU,
+    0x0130B4B3U,
+    0x0130B4B9U,
+    0x0130B4D5U,
+    0x0130B5B9U,
+    0x0130B609U,
+    0x0130B613U,
+    0x0130B893U,
+    0x0130B899U,
+    0x0130B8A4U,
+    0x0130B8B2U,
+    0x0130B8B3U,
+    0x0130B8E1U,
+    0x0130B8E8U,
+    0x0130B8EFU,
+    0x0130B8F3U,
+    0x0130B96FU,
+    0x0130BA61U,
+    0x0130BA8FU,
+    0x0130BA93U,
+    0x0130BD81U,
+    0x0130C02EU,
+    0x0130C124U,
+    0x0130C1F2U,
+    0x0130C219U,
+    0x0130C82EU,
+    0x0130C893U,
+    0x0130C8A4U,
+    0x0130C8A5U,
+    0x0130C8E5U,
+    0x0130C8EFU,
+    0x0130C92EU,
+    0x0130C933U,
+    0x0130C973U,
+    0x0130C979U,
+    0x0130C9E4U,
+    0x0130C9F3U,
+    0x0130CAB3U,
+    0x0130CCB2U,
+    0x0130CD2EU,
+    0x0130CE65U,
+    0x0130CE79U,
+    0x0130D029U,
+    0x0130D039U,
+    0x0130D0A4U,
+    0x0130D0ADU,
+    0x0130D0B3U,
+    0x0130D12EU,
+    0x0130D133U,
+    0x0130D332U,
+    0x0130D441U,
+    0x0130D465U,
+    0x0130D468U,
+    0x0130D479U,
+    0x0130D4E8U,
+    0x0130D593U,
+    0x0130D594U,
+    0x0130D5C1U,
+    0x0130D5D4U,
+    0x0130D659U,
+    0x0130D685U,
+    0x0130D693U,
+    0x0130D8A4U,
+    0x0130D8B2U,
+    0x0130D8B3U,
+    0x0130D8B9U,
+    0x0130D92EU,
+    0x0130D9F2U,
+    0x0130D9F9U,
+    0x0130DAD9U,
+    0x0130DC28U,
+    0x0130DCA4U,
+    0x0130DCB2U,
+    0x0130E0B3U,
+    0x0130E4A4U,
+    0x0130E4B2U,
+    0x0130E524U,
+    0x0130E5C5U,
+    0x0130E5EEU,
+    0x0130E674U,
+    0x0130E8B3U,
+    0x01318453U,
+    0x01318493U,
+    0x013184C6U,
+    0x013184F3U,
+    0x0131852CU,
+    0x01318581U,
+    0x01318584U,
+    0x01318585U,
+    0x0131858CU,
+    0x01318590U,
+    0x01318599U,
+    0x013185B0U,
+    0x013185B3U,
+    0x013185C4U,
+    0x013185D3U,
+    0x013185D4U,
+    0x01318601U,
+    0x01318605U,
+    0x01318609U,
+    0x01318645U,
+    0x01318646U,
+    0x01318650U,
+    0x01318653U,
+    0x01318654U,
+    0x01318659U,
+    0x01318688U,
+    0x01318693U,
+    0x01318694U,
+    0x013186A4U,
+    0x013186B0U,
+    0x013186B2U,
+    0x013186F3U,
+    0x01319434U,
+    0x013195C1U,
+    0x013195C4U,
+    0x013195C5U,
+    0x013195D4U,
+    0x0131A036U,
+    0x0131A1AFU,
+    0x0131A2ACU,
+    0x0131A2E1U,
+    0x0131A5EEU,
+    0x0131B12DU,
+    0x0131BC99U,
+    0x0131BCC6U,
+    0x0131BCF3U,
+    0x0131BD84U,
+    0x0131BDC5U,
+    0x0131BDE7U,
+    0x0131BDF0U,
+    0x0131BDF4U,
+    0x0131BE01U,
+    0x0131BE05U,
+    0x0131BE13U,
+    0x0131BE45U,
+    0x0131BE4EU,
+    0x0131BE93U,
+    0x0131BEA7U,
+    0x0131BEB0U,
+    0x0131BEB2U,
+    0x0131BEB4U,
+    0x0131BEECU,
+    0x0131BEF0U,
+    0x0131BEF3U,
+    0x0131C822U,
+    0x0131C825U,
+    0x0131C827U,
+    0x0131C82DU,
+    0x0131C82EU,
+    0x0131C830U,
+    0x0131C834U,
+    0x0131C837U,
+    0x0131C839U,
+    0x0131C8A5U,
+    0x0131C8B7U,
+    0x0131C92DU,
+    0x0131C930U,
+    0x0131C9E2U,
+    0x0131C9E4U,
+    0x0131C9E7U,
+    0x0131C9F7U,
+    0x0131CAA2U,
+    0x0131CAADU,
+    0x0131D441U,
+    0x0131D489U,
+    0x0131D48FU,
+    0x0131D493U,
+    0x0131D4C6U,
+    0x0131D4D4U,
+    0x0131D4F3U,
+    0x0131D58BU,
+    0x0131D58CU,
+    0x0131D590U,
+    0x0131D593U,
+    0x0131D5B3U,
+    0x0131D613U,
+    0x0131D646U,
+    0x0131D653U,
+    0x0131D665U,
+    0x0131D681U,
+    0x0131D685U,
+    0x0131D693U,
+    0x0131D75AU,
+    0x0131E4B3U,
+    0x0132072EU,
+    0x0132152EU,
+    0x01328593U,
+    0x013285A5U,
+    0x013285B3U,
+    0x013285B9U,
+    0x013285D3U,
+    0x01328645U,
+    0x01328653U,
+    0x01328665U,
+    0x01328693U,
+    0x01328745U,
+    0x01328AADU,
+    0x01328C6FU,
+    0x01328D13U,
+    0x01328E93U,
+    0x0132902EU,
+    0x013290B2U,
+    0x013290B3U,
+    0x013290E5U,
+    0x013290F9U,
+    0x013292ADU,
+    0x01329493U,
+    0x01329499U,
+    0x01329573U,
+    0x01329584U,
+    0x01329593U,
+    0x01329599U,
+    0x013295B3U,
+    0x01329613U,
+    0x01329619U,
+    0x01329653U,
+    0x013298B2U,
+    0x01329C32U,
+    0x01329DC9U,
+    0x01329DCFU,
+    0x01329DECU,
+    0x01329DF3U,
+    0x01329EA5U,
+    0x0132A249U,
+    0x0132A4D3U,
+    0x0132A593U,
+    0x0132A5C5U,
+    0x0132A653U,
+    0x0132A665U,
+    0x0132A66DU,
+    0x0132A699U,
+    0x0132A741U,
+    0x0132A745U,
+    0x0132ADF3U,
+    0x0132AE93U,
+    0x0132B028U,
+    0x0132B0B3U,
+    0x0132B0D3U,
+    0x0132B181U,
+    0x0132B185U,
+    0x0132B193U,
+    0x0132B2C1U,
+    0x0132B4A5U,
+    0x0132B4AEU,
+    0x0132B4B3U,
+    0x0132B525U,
+    0x0132B533U,
+    0x0132B833U,
+    0x0132B893U,
+    0x0132B8B3U,
+    0x0132B8E9U,
+    0x0132B9C1U,
+    0x0132B9F2U,
+    0x0132BA61U,
+    0x0132BA65U,
+    0x0132BA69U,
+    0x0132BA85U,
+    0x0132BA89U,
+    0x0132BA93U,
+    0x0132BAD9U,
+    0x0132BB41U,
+    0x0132C024U,
+    0x0132C02CU,
+    0x0132C121U,
+    0x0132C123U,
+    0x0132C1F9U,
+    0x0132C281U,
+    0x0132C293U,
+    0x0132C823U,
+    0x0132C829U,
+    0x0132C82CU,
+    0x0132C8A4U,
+    0x0132C8B2U,
+    0x0132C8B3U,
+    0x0132C8D3U,
+    0x0132C8E5U,
+    0x0132C923U,
+    0x0132C926U,
+    0x0132C92EU,
+    0x0132C973U,
+    0x0132C9EEU,
+    0x0132C9F7U,
+    0x0132CA41U,
+    0x0132CA45U,
+    0x0132CA53U,
+    0x0132CA59U,
+    0x0132CAADU,
+    0x0132CAC5U,
+    0x0132CACFU,
+    0x0132CCB9U,
+    0x0132CE61U,
+    0x0132D025U,
+    0x0132D02CU,
+    0x0132D1EEU,
+    0x0132D293U,
+    0x0132D2B0U,
+    0x0132D8AEU,
+    0x0132D8B2U,
+    0x0132DC2EU,
+    0x0132DC32U,
+    0x0132DCA4U,
+    0x0132DCACU,
+    0x0132DCAEU,
+    0x0132DCB2U,
+    0x0132DD2EU,
+    0x0132E0A4U,
+    0x0132E0B2U,
+    0x0132E0B3U,
+    0x0132E28FU,
+    0x0132E293U,
+    0x0132E4AEU,
+    0x0134046BU,
+    0x01340485U,
+    0x01340493U,
+    0x01340499U,
+    0x013404D4U,
+    0x013404F3U,
+    0x01340513U,
+    0x01340565U,
+    0x0134056FU,
+    0x01340574U,
+    0x01340579U,
+    0x01340585U,
+    0x0134058CU,
+    0x0134058DU,
+    0x01340594U,
+    0x01340599U,
+    0x013405A1U,
+    0x013405A5U,
+    0x013405B3U,
+    0x013405C4U,
+    0x013405CBU,
+    0x013405D3U,
+    0x01340605U,
+    0x01340613U,
+    0x01340644U,
+    0x01340645U,
+    0x0134064BU,
+    0x0134064EU,
+    0x01340650U,
+    0x01340668U,
+    0x013406ACU,
+    0x013406C5U,
+    0x013406ECU,
+    0x013406EDU,
+    0x013406EEU,
+    0x013406F3U,
+    0x01340721U,
+    0x01340733U,
+    0x01340D09U,
+    0x01341426U,
+    0x0134142CU,
+    0x01341432U,
+    0x01341433U,
+    0x01341493U,
+    0x013414ACU,
+    0x013414AEU,
+    0x013414B0U,
+    0x013414B2U,
+    0x013414B4U,
+    0x0134152BU,
+    0x01341586U,
+    0x0134158CU,
+    0x013415C4U,
+    0x013415D4U,
+    0x013415ECU,
+    0x01341644U,
+    0x01341645U,
+    0x0134164FU,
+    0x01341693U,
+    0x013416C1U,
+    0x013416EEU,
+    0x013416F3U,
+    0x01342429U,
+    0x013424A4U,
+    0x013424ACU,
+    0x013424B2U,
+    0x013424B3U,
+    0x013424D4U,
+    0x0134258CU,
+    0x01342599U,
+    0x013425B3U,
+    0x013425C5U,
+    0x013425D3U,
+    0x013425D9U,
+    0x01342613U,
+    0x01342645U,
+    0x0134264BU,
+    0x01342652U,
+    0x01342653U,
+    0x01342654U,
+    0x01342668U,
+    0x0134266FU,
+    0x01342674U,
+    0x01342685U,
+    0x01342693U,
+    0x013426B2U,
+    0x013426C1U,
+    0x013426C5U,
+    0x013426D3U,
+    0x013430B0U,
+    0x013432A2U,
+    0x013434ABU,
+    0x013435E5U,
+    0x01343C2CU,
+    0x01343C34U,
+    0x01343C6BU,
+    0x01343CA4U,
+    0x01343CB2U,
+    0x01343CB3U,
+    0x01343CE9U,
+    0x01343CF3U,
+    0x01343D49U,
+    0x01343D4FU,
+    0x01343D81U,
+    0x01343DC5U,
+    0x01343DEBU,
+    0x01343DECU,
+    0x01343DEEU,
+    0x01343DF3U,
+    0x01343DF4U,
+    0x01343E05U,
+    0x01343E13U,
+    0x01343E45U,
+    0x01343E4CU,
+    0x01343E4EU,
+    0x01343E54U,
+    0x01343E85U,
+    0x01343E93U,
+    0x01343E94U,
+    0x01343EB4U,
+    0x01343EC5U,
+    0x01343EE4U,
+    0x01343EEEU,
+    0x01343EF3U,
+    0x01343EF9U,
+    0x01343F35U,
+    0x013448A4U,
+    0x013448B7U,
+    0x01344933U,
+    0x013449F7U,
+    0x01344AA2U,
+    0x01344AA7U,
+    0x0134512BU,
+    0x013452ADU,
+    0x013452B0U,
+    0x0134546BU,
+    0x01345585U,
+    0x0134558EU,
+    0x01345593U,
+    0x013455D3U,
+    0x013455D4U,
+    0x01345641U,
+    0x01345668U,
+    0x01345685U,
+    0x01345693U,
+    0x01345C33U,
+    0x013464B2U,
+    0x01346599U,
+    0x01348593U,
+    0x01348853U,
+    0x01348B2CU,
+    0x01348CB3U,
+    0x01348D14U,
+    0x01348D6FU,
+    0x01348D73U,
+    0x01348D79U,
+    0x01349033U,
+    0x013490A4U,
+    0x013490B2U,
+    0x013490B3U,
+    0x01349101U,
+    0x01349105U,
+    0x01349185U,
+    0x013494E5U,
+    0x01349584U,
+    0x013495D3U,
+    0x013495D4U,
+    0x01349688U,
+    0x013496B2U,
+    0x013496C5U,
+    0x01349A93U,
+    0x01349D13U,
+    0x01349D14U,
+    0x01349D2CU,
+    0x01349D81U,
+    0x01349DA1U,
+    0x01349DC1U,
+    0x01349DD3U,
+    0x0134A9F3U,
+    0x0134AC33U,
+    0x0134ACB2U,
+    0x0134ACB3U,
+    0x0134B093U,
+    0x0134B0A4U,
+    0x0134B0AEU,
+    0x0134B0B2U,
+    0x0134B0B3U,
+    0x0134B0B8U,
+    0x0134B173U,
+    0x0134B179U,
+    0x0134B193U,
+    0x0134B199U,
+    0x0134B1F3U,
+    0x0134B293U,
+    0x0134B299U,
+    0x0134B2C1U,
+    0x0134B432U,
+    0x0134B433U,
+    0x0134B441U,
+    0x0134B533U,
+    0x0134B613U,
+    0x0134B6ACU,
+    0x0134B865U,
+    0x0134B893U,
+    0x0134B8A4U,
+    0x0134B8B3U,
+    0x0134B8B7U,
+    0x0134B8E5U,
+    0x0134B8F3U,
+    0x0134B913U,
+    0x0134B973U,
+    0x0134B979U,
+    0x0134BAB3U,
+    0x0134C0A4U,
+    0x0134C0B3U,
+    0x0134C219U,
+    0x0134C8A4U,
+    0x0134C8A5U,
+    0x0134C8AEU,
+    0x0134C8B3U,
+    0x0134C928U,
+    0x0134C933U,
+    0x0134C9E3U,
+    0x0134CA41U,
+    0x0134CAB0U,
+    0x0134CC2CU,
+    0x0134CCB3U,
+    0x0134CE79U,
+    0x0134CE81U,
+    0x0134CE93U,
+    0x0134D032U,
+    0x0134D0A4U,
+    0x0134D0B3U,
+    0x0134D105U,
+    0x0134D161U,
+    0x0134D2B0U,
+    0x0134D2B3U,
+    0x0134D8B2U,
+    0x0134E0B2U,
+    0x0134E0B3U,
+    0x0134E1AFU,
+    0x0134E285U,
+    0x0134E288U,
+    0x0134E299U,
+    0x0134E832U,
+    0x0134E8A4U,
+    0x0134E8ACU,
+    0x0134E8B2U,
+    0x0134E8B3U,
+    0x013584F3U,
+    0x0135852CU,
+    0x01358584U,
+    0x013585CBU,
+    0x01358654U,
+    0x01358685U,
+    0x01358693U,
+    0x01358694U,
+    0x013586F3U,
+    0x0135942EU,
+    0x01359432U,
+    0x01359493U,
+    0x013594A4U,
+    0x013594A6U,
+    0x013594AEU,
+    0x013594B2U,
+    0x013594B3U,
+    0x013594B4U,
+    0x013594E7U,
+    0x013594F3U,
+    0x0135952EU,
+    0x01359586U,
+    0x0135958CU,
+    0x0135958DU,
+    0x01359590U,
+    0x013595C5U,
+    0x013595D3U,
+    0x013595F3U,
+    0x01359613U,
+    0x01359653U,
+    0x01359693U,
+    0x013596F3U,
+    0x0135A493U,
+    0x0135A4A4U,
+    0x0135A4B2U,
+    0x0135A4B3U,
+    0x0135A4B9U,
+    0x0135A4C6U,
+    0x0135A58CU,
+    0x0135A5AFU,
+    0x0135A5B0U,
+    0x0135A5B3U,
+    0x0135A5CBU,
+    0x0135A5D3U,
+    0x0135A5D4U,
+    0x0135A5F3U,
+    0x0135A613U,
+    0x0135A64CU,
+    0x0135A652U,
+    0x0135A654U,
+    0x0135A685U,
+    0x0135A693U,
+    0x0135A6C5U,
+    0x0135A6D9U,
+    0x0135B12DU,
+    0x0135BC2CU,
+    0x0135BC99U,
+    0x0135BCC6U,
+    0x0135BCF3U,
+    0x0135BD93U,
+    0x0135BDECU,
+    0x0135BE54U,
+    0x0135BE68U,
+    0x0135C82EU,
+    0x0135C92BU,
+    0x0135D433U,
+    0x0135D4F3U,
+    0x0135D58BU,
+    0x0135D58CU,
+    0x0135D5CBU,
+    0x0135E4A4U,
+    0x0135E4B2U,
+    0x0135E4B9U,
+    0x0135E4D3U,
+    0x0135E645U,
+    0x0135E653U,
+    0x0135E685U,
+    0x01360453U,
+    0x0136046BU,
+    0x01360485U,
+    0x013604B3U,
+    0x013604F3U,
+    0x01360524U,
+    0x0136052EU,
+    0x01360565U,
+    0x013605B3U,
+    0x013605C5U,
+    0x013605C7U,
+    0x013605CBU,
+    0x013605D4U,
+    0x01360613U,
+    0x01360654U,
+    0x01360668U,
+    0x01360685U,
+    0x01360693U,
+    0x01360699U,
+    0x013606F3U,
+    0x01360733U,
+    0x01361453U,
+    0x01361493U,
+    0x013614ABU,
+    0x013614B0U,
+    0x013614B2U,
+    0x013614B4U,
+    0x01361614U,
+    0x013616F3U,
+    0x01361733U,
+    0x01362465U,
+    0x0136246BU,
+    0x01362485U,
+    0x013624B2U,
+    0x01362599U,
+    0x013625A5U,
+    0x013625B3U,
+    0x013625B9U,
+    0x013625C7U,
+    0x013625CBU,
+    0x01362605U,
+    0x01362613U,
+    0x01362614U,
+    0x01362668U,
+    0x01362693U,
+    0x013626C5U,
+    0x01363C2EU,
+    0x01363C53U,
+    0x01363CB3U,
+    0x01363CF3U,
+    0x01363D24U,
+    0x01363D44U,
+    0x01363DAFU,
+    0x01363DEDU,
+    0x01363DF0U,
+    0x01363DF4U,
+    0x01363E05U,
+    0x01363E13U,
+    0x01363E19U,
+    0x01363E4DU,
+    0x01363E68U,
+    0x01363E88U,
+    0x01363E93U,
+    0x01363EC5U,
+    0x01363EF3U,
+    0x01363F24U,
+    0x01365442U,
+    0x01365453U,
+    0x013654A4U,
+    0x013654B3U,
+    0x013654C6U,
+    0x013654F3U,
+    0x01365534U,
+    0x013655B0U,
+    0x013655B3U,
+    0x013655C7U,
+    0x013655CBU,
+    0x01365642U,
+    0x01365650U,
+    0x01365653U,
+    0x01365665U,
+    0x01365668U,
+    0x013664B2U,
+    0x01366599U,
+    0x01366605U,
+    0x0136842BU,
+    0x0136846BU,
+    0x0136852BU,
+    0x0136858CU,
+    0x0136858DU,
+    0x01368594U,
+    0x0136864DU,
+    0x01368654U,
+    0x01368668U,
+    0x01368745U,
+    0x01369432U,
+    0x013694ABU,
+    0x013694B3U,
+    0x0136952BU,
+    0x01369565U,
+    0x0136958CU,
+    0x01369594U,
+    0x0136964BU,
+    0x013696F3U,
+    0x0136A585U,
+    0x0136A64BU,
+    0x0136A652U,
+    0x0136A653U,
+    0x0136A685U,
+    0x0136A688U,
+    0x0136A693U,
+    0x0136BC6BU,
+    0x0136BCF3U,
+    0x0136BD65U,
+    0x0136BD6FU,
+    0x0136BD79U,
+    0x0136BD94U,
+    0x0136BDF2U,
+    0x0136BDF4U,
+    0x0136BE45U,
+    0x0136BE47U,
+    0x0136BE85U,
+    0x0136BEB4U,
+    0x0136BEF4U,
+    0x0136D4F3U,
+    0x0136D653U,
+    0x0136D668U,
+    0x0136D693U,
+    0x01370453U,
+    0x0137046BU,
+    0x013704D5U,
+    0x013704F3U,
+    0x0137052CU,
+    0x01370565U,
+    0x01370579U,
+    0x01370613U,
+    0x01370645U,
+    0x01370646U,
+    0x0137064BU,
+    0x0137064CU,
+    0x01370653U,
+    0x01370659U,
+    0x01370668U,
+    0x01370688U,
+    0x013706F3U,
+    0x01371424U,
+    0x0137142BU,
+    0x01371430U,
+    0x01371453U,
+    0x0137146BU,
+    0x01371493U,
+    0x013714A4U,
+    0x013714B2U,
+    0x013714B3U,
+    0x0137158CU,
+    0x01372453U,
+    0x0137246BU,
+    0x01372485U,
+    0x013724B3U,
+    0x013724C6U,
+    0x013724D4U,
+    0x013724F3U,
+    0x01372605U,
+    0x01372613U,
+    0x01372619U,
+    0x01372654U,
+    0x01372693U,
+    0x01373C53U,
+    0x01373C93U,
+    0x01373CABU,
+    0x01373CB0U,
+    0x01373CF3U,
+    0x01373D65U,
+    0x01373DE4U,
+    0x01373DEBU,
+    0x01373DECU,
+    0x01373DF0U,
+    0x01373DF4U,
+    0x01373E45U,
+    0x01373E54U,
+    0x01373E93U,
+    0x01373EB4U,
+    0x01373EEBU,
+    0x01373EF3U,
+    0x01373EF9U,
+    0x01375453U,
+    0x0137546BU,
+    0x013754C6U,
+    0x013754F3U,
+    0x01375668U,
+    0x013764B3U,
+    0x01378573U,
+    0x01378613U,
+    0x01378619U,
+    0x01378645U,
+    0x01378653U,
+    0x013786C5U,
+    0x01378833U,
+    0x013788B2U,
+    0x01378C33U,
+    0x01378CB3U,
+    0x01378D6FU,
+    0x01378D73U,
+    0x01378D85U,
+    0x01379033U,
+    0x01379099U,
+    0x01379123U,
+    0x013791EDU,
+    0x01379832U,
+    0x01379833U,
+    0x01379A81U,
+    0x01379A93U,
+    0x01379A99U,
+    0x01379CB2U,
+    0x01379CF9U,
+    0x0137A2B2U,
+    0x0137A593U,
+    0x0137A599U,
+    0x0137A833U,
+    0x0137AAB3U,
+    0x0137AC28U,
+    0x0137ACAEU,
+    0x0137ACB3U,
+    0x0137ADECU,
+    0x0137B028U,
+    0x0137B02EU,
+    0x0137B032U,
+    0x0137B033U,
+    0x0137B085U,
+    0x0137B089U,
+    0x0137B08FU,
+    0x0137B093U,
+    0x0137B0A4U,
+    0x0137B0A9U,
+    0x0137B0B2U,
+    0x0137B0B3U,
+    0x0137B124U,
+    0x0137B1EEU,
+    0x0137B1F3U,
+    0x0137B2ADU,
+    0x0137B2B3U,
+    0x0137B2C5U,
+    0x0137B42EU,
+    0x0137B433U,
+    0x0137B832U,
+    0x0137B865U,
+    0x0137B885U,
+    0x0137B8B3U,
+    0x0137B8F3U,
+    0x0137B923U,
+    0x0137B999U,
+    0x0137B9C5U,
+    0x0137B9D9U,
+    0x0137BA65U,
+    0x0137BA79U,
+    0x0137BCB9U,
+    0x0137BD73U,
+    0x0137BD79U,
+    0x0137BD85U,
+    0x0137BD93U,
+    0x0137BDB3U,
+    0x0137BE13U,
+    0x0137BE85U,
+    0x0137BE88U,
+    0x0137BE93U,
+    0x0137BE99U,
+    0x0137C113U,
+    0x0137C119U,
+    0x0137C1F2U,
+    0x0137C219U,
+    0x0137C241U,
+    0x0137C82CU,
+    0x0137C833U,
+    0x0137C84FU,
+    0x0137C853U,
+    0x0137C881U,
+    0x0137C88FU,
+    0x0137C893U,
+    0x0137C8A4U,
+    0x0137C8A5U,
+    0x0137C8ACU,
+    0x0137C8B2U,
+    0x0137C8B3U,
+    0x0137C8B8U,
+    0x0137C8EFU,
+    0x0137C9D3U,
+    0x0137CA41U,
+    0x0137CA59U,
+    0x0137CA81U,
+    0x0137CA93U,
+    0x0137CAB3U,
+    0x0137D113U,
+    0x0137D1ECU,
+    0x0137D465U,
+    0x0137D474U,
+    0x0137D4E8U,
+    0x0137D573U,
+    0x0137D593U,
+    0x0137D5B3U,
+    0x0137D5C4U,
+    0x0137D613U,
+    0x0137D619U,
+    0x0137D653U,
+    0x0137D665U,
+    0x0137D688U,
+    0x0137D693U,
+    0x0137DC32U,
+    0x0137DC65U,
+    0x0137DCA4U,
+    0x0137DCB2U,
+    0x0137DCC6U,
+    0x0137DCD3U,
+    0x0137DD85U,
+    0x0137DD93U,
+    0x0137DDB3U,
+    0x0137DDC4U,
+    0x0137DDC5U,
+    0x0137DE13U,
+    0x0137DE65U,
+    0x0137DE88U,
+    0x0137E433U,
+    0x0137E585U,
+    0x0137E6BAU,
+    0x0137E92EU,
+    0x01380465U,
+    0x01380479U,
+    0x01380485U,
+    0x0138048FU,
+    0x013804A4U,
+    0x013804B2U,
+    0x013804B3U,
+    0x013804F3U,
+    0x01380509U,
+    0x0138052CU,
+    0x0138052EU,
+    0x01380534U,
+    0x01380565U,
+    0x01380584U,
+    0x01380585U,
+    0x0138058CU,
+    0x01380594U,
+    0x013805B3U,
+    0x013805C5U,
+    0x013805C7U,
+    0x013805CBU,
+    0x013805D3U,
+    0x01380644U,
+    0x01380645U,
+    0x0138064BU,
+    0x01380653U,
+    0x01380654U,
+    0x0138066DU,
+    0x01380685U,
+    0x01380693U,
+    0x013806ACU,
+    0x013806ECU,
+    0x013806EEU,
+    0x013806F3U,
+    0x01380724U,
+    0x01380733U,
+    0x01380741U,
+    0x0138075AU,
+    0x0138142BU,
+    0x0138142CU,
+    0x0138142EU,
+    0x01381432U,
+    0x01381434U,
+    0x0138146BU,
+    0x01381473U,
+    0x01381474U,
+    0x013814A4U,
+    0x013814ACU,
+    0x013814B2U,
+    0x0138152CU,
+    0x01381532U,
+    0x01381573U,
+    0x01381584U,
+    0x0138158BU,
+    0x0138158CU,
+    0x01381594U,
+    0x013815C4U,
+    0x013815D4U,
+    0x013815F3U,
+    0x0138164DU,
+    0x01381693U,
+    0x013816A7U,
+    0x013816F3U,
+    0x013816F9U,
+    0x0138242CU,
+    0x01382461U,
+    0x01382465U,
+    0x01382479U,
+    0x01382485U,
+    0x013824A4U,
+    0x013824ACU,
+    0x013824B2U,
+    0x013824B3U,
+    0x013824C6U,
+    0x013824D3U,
+    0x01382565U,
+    0x01382579U,
+    0x01382585U,
+    0x0138258CU,
+    0x01382594U,
+    0x013825B3U,
+    0x013825C1U,
+    0x013825C5U,
+    0x013825CBU,
+    0x013825D3U,
+    0x013825D9U,
+    0x01382645U,
+    0x01382654U,
+    0x01382659U,
+    0x01382685U,
+    0x01382693U,
+    0x0138269AU,
+    0x013826D3U,
+    0x01383034U,
+    0x01383039U,
+    0x01383134U,
+    0x013831E7U,
+    0x01383C85U,
+    0x01383C93U,
+    0x01383D2CU,
+    0x01383D65U,
+    0x01383DE6U,
+    0x01383DEBU,
+    0x01383DECU,
+    0x01383DEDU,
+    0x01383DEEU,
+    0x01383DF2U,
+    0x01383DF4U,
+    0x01383E45U,
+    0x01383E4BU,
+    0x01383E54U,
+    0x01383E68U,
+    0x01383E93U,
+    0x01383EB4U,
+    0x01384824U,
+    0x01384827U,
+    0x01384834U,
+    0x01384839U,
+    0x013848A4U,
+    0x013848A5U,
+    0x013848B7U,
+    0x01384927U,
+    0x01384934U,
+    0x013849E4U,
+    0x013849E7U,
+    0x01384AA5U,
+    0x01384AA7U,
+    0x01385493U,
+    0x013854A4U,
+    0x013854B2U,
+    0x013854B3U,
+    0x013854F3U,
+    0x01385585U,
+    0x013855A5U,
+    0x013855B9U,
+    0x013855CBU,
+    0x0138564EU,
+    0x01385653U,
+    0x01385654U,
+    0x01385681U,
+    0x0138642CU,
+    0x01386645U,
+    0x0138D422U,
+    0x0138D424U,
+    0x0138D434U,
+    0x0138D437U,
+    0x0138D4A7U,
+    0x0138D522U,
+    0x0138D524U,
+    0x0138D534U,
+    0x0138D53AU,
+    0x013A0453U,
+    0x013A046BU,
+    0x013A0485U,
+    0x013A04C6U,
+    0x013A04E5U,
+    0x013A04F3U,
+    0x013A04F9U,
+    0x013A0524U,
+    0x013A0527U,
+    0x013A052EU,
+    0x013A0532U,
+    0x013A0565U,
+    0x013A0585U,
+    0x013A058BU,
+    0x013A058CU,
+    0x013A05B0U,
+    0x013A05C4U,
+    0x013A05C5U,
+    0x013A05C7U,
+    0x013A05CBU,
+    0x013A0608U,
+    0x013A0613U,
+    0x013A0645U,
+    0x013A064BU,
+    0x013A064EU,
+    0x013A0652U,
+    0x013A0653U,
+    0x013A0654U,
+    0x013A0668U,
+    0x013A0685U,
+    0x013A0693U,
+    0x013A06AEU,
+    0x013A06C5U,
+    0x013A06F3U,
+    0x013A0733U,
+    0x013A1424U,
+    0x013A142BU,
+    0x013A142CU,
+    0x013A142DU,
+    0x013A142EU,
+    0x013A1432U,
+    0x013A1484U,
+    0x013A1485U,
+    0x013A1493U,
+    0x013A14A4U,
+    0x013A14ABU,
+    0x013A14ACU,
+    0x013A14ADU,
+    0x013A14AEU,
+    0x013A14B0U,
+    0x013A14B2U,
+    0x013A152CU,
+    0x013A152EU,
+    0x013A1581U,
+    0x013A1585U,
+    0x013A158CU,
+    0x013A15A5U,
+    0x013A15B3U,
+    0x013A15C4U,
+    0x013A15CFU,
+    0x013A15D3U,
+    0x013A15D4U,
+    0x013A1613U,
+    0x013A1614U,
+    0x013A1645U,
+    0x013A164EU,
+    0x013A1693U,
+    0x013A16F3U,
+    0x013A16F9U,
+    0x013A1733U,
+    0x013A2468U,
+    0x013A246BU,
+    0x013A24A4U,
+    0x013A24B3U,
+    0x013A24C6U,
+    0x013A2582U,
+    0x013A2585U,
+    0x013A258CU,
+    0x013A2594U,
+    0x013A25A5U,
+    0x013A25B3U,
+    0x013A25B9U,
+    0x013A25C7U,
+    0x013A25CBU,
+    0x013A25D4U,
+    0x013A2601U,
+    0x013A2605U,
+    0x013A2645U,
+    0x013A264BU,
+    0x013A2650U,
+    0x013A2653U,
+    0x013A26C5U,
+    0x013A26D9U,
+    0x013A3C25U,
+    0x013A3C29U,
+    0x013A3C33U,
+    0x013A3C34U,
+    0x013A3C53U,
+    0x013A3C6BU,
+    0x013A3CB0U,
+    0x013A3CF9U,
+    0x013A3D23U,
+    0x013A3D34U,
+    0x013A3D65U,
+    0x013A3D85U,
+    0x013A3D8EU,
+    0x013A3DA1U,
+    0x013A3DB0U,
+    0x013A3DC4U,
+    0x013A3DC5U,
+    0x013A3DC7U,
+    0x013A3DCBU,
+    0x013A3DCEU,
+    0x013A3DD9U,
+    0x013A3DE4U,
+    0x013A3DEBU,
+    0x013A3DECU,
+    0x013A3DF0U,
+    0x013A3DF2U,
+    0x013A3E05U,
+    0x013A3E13U,
+    0x013A3E14U,
+    0x013A3E45U,
+    0x013A3E4BU,
+    0x013A3E4DU,
+    0x013A3E59U,
+    0x013A3E73U,
+    0x013A3E93U,
+    0x013A3E94U,
+    0x013A3EAEU,
+    0x013A3EB0U,
+    0x013A3EB2U,
+    0x013A3EB4U,
+    0x013A3EC5U,
+    0x013A3EEEU,
+    0x013A3EF0U,
+    0x013A3EF3U,
+    0x013A4824U,
+    0x013A4825U,
+    0x013A4827U,
+    0x013A482BU,
+    0x013A4830U,
+    0x013A4837U,
+    0x013A4839U,
+    0x013A48B0U,
+    0x013A48B7U,
+    0x013A4921U,
+    0x013A4927U,
+    0x013A492DU,
+    0x013A4930U,
+    0x013A49F0U,
+    0x013A49F7U,
+    0x013A49F9U,
+    0x013A4AADU,
+    0x013A4AB4U,
+    0x013A5453U,
+    0x013A546BU,
+    0x013A5485U,
+    0x013A5493U,
+    0x013A5499U,
+    0x013A54C6U,
+    0x013A558CU,
+    0x013A558DU,
+    0x013A55ADU,
+    0x013A55B0U,
+    0x013A55B3U,
+    0x013A55C7U,
+    0x013A55CBU,
+    0x013A55D3U,
+    0x013A55D4U,
+    0x013A5601U,
+    0x013A5605U,
+    0x013A5645U,
+    0x013A5654U,
+    0x013A64A4U,
+    0x013A64B3U,
+    0x013A6585U,
+    0x013A6589U,
+    0x013A658FU,
+    0x013A65A5U,
+    0x013A65B9U,
+    0x013A6645U,
+    0x013A6685U,
+    0x013A86C5U,
+    0x013A8828U,
+    0x013A8833U,
+    0x013A8859U,
+    0x013A88B2U,
+    0x013A8901U,
+    0x013A8C69U,
+    0x013A8D73U,
+    0x013A8D79U,
+    0x013A8E45U,
+    0x013A9093U,
+    0x013A91F2U,
+    0x013A9279U,
+    0x013A9485U,
+    0x013A95D4U,
+    0x013A9653U,
+    0x013A9685U,
+    0x013A9693U,
+    0x013A9699U,
+    0x013A9C2EU,
+    0x013A9C32U,
+    0x013A9D13U,
+    0x013A9DF3U,
+    0x013AA2B2U,
+    0x013AA493U,
+    0x013AA5C7U,
+    0x013AA5D4U,
+    0x013AA685U,
+    0x013AA693U,
+    0x013AA8A5U,
+    0x013AAD13U,
+    0x013AAEABU,
+    0x013AB069U,
+    0x013AB0C1U,
+    0x013AB0CFU,
+    0x013AB173U,
+    0x013AB179U,
+    0x013AB199U,
+    0x013AB208U,
+    0x013AB2B3U,
+    0x013AB423U,
+    0x013AB533U,
+    0x013AB5A1U,
+    0x013AB5F3U,
+    0x013AB608U,
+    0x013AB613U,
+    0x013AB933U,
+    0x013AB973U,
+    0x013AB9C1U,
+    0x013AB9D3U,
+    0x013AB9D9U,
+    0x013ABAB0U,
+    0x013AC0B2U,
+    0x013AC0B3U,
+    0x013AC241U,
+    0x013AC828U,
+    0x013AC82CU,
+    0x013AC833U,
+    0x013AC834U,
+    0x013AC893U,
+    0x013AC8A4U,
+    0x013AC8B2U,
+    0x013AC8B3U,
+    0x013AC8D3U,
+    0x013AC8D9U,
+    0x013AC8E5U,
+    0x013AC8F9U,
+    0x013AC999U,
+    0x013ACA41U,
+    0x013ACCA4U,
+    0x013ACCB3U,
+    0x013ACD09U,
+    0x013ACEB3U,
+    0x013AD1F2U,
+    0x013AD241U,
+    0x013AD281U,
+    0x013B8453U,
+    0x013B846BU,
+    0x013B8493U,
+    0x013B84E5U,
+    0x013B84F3U,
+    0x013B852CU,
+    0x013B852EU,
+    0x013B8585U,
+    0x013B8599U,
+    0x013B85A9U,
+    0x013B85B0U,
+    0x013B85B9U,
+    0x013B85C7U,
+    0x013B85CBU,
+    0x013B85D3U,
+    0x013B8613U,
+    0x013B8614U,
+    0x013B8644U,
+    0x013B8645U,
+    0x013B8646U,
+    0x013B864DU,
+    0x013B8654U,
+    0x013B8668U,
+    0x013B8688U,
+    0x013B8693U,
+    0x013B872CU,
+    0x013B8733U,
+    0x013B942CU,
+    0x013B9432U,
+    0x013B9434U,
+    0x013B9485U,
+    0x013B94A4U,
+    0x013B94ACU,
+    0x013B94B0U,
+    0x013B94B2U,
+    0x013B94B3U,
+    0x013B94B4U,
+    0x013B9532U,
+    0x013B958CU,
+    0x013B9594U,
+    0x013B9614U,
+    0x013B9646U,
+    0x013B9733U,
+    0x013BA4B3U,
+    0x013BA4D4U,
+    0x013BA4F3U,
+    0x013BA585U,
+    0x013BA58CU,
+    0x013BA5B3U,
+    0x013BA5C5U,
+    0x013BA5C7U,
+    0x013BA5CBU,
+    0x013BA605U,
+    0x013BA645U,
+    0x013BA64CU,
+    0x013BA668U,
+    0x013BA673U,
+    0x013BA688U,
+    0x013BA693U,
+    0x013BA6C5U,
+    0x013BA75AU,
+    0x013BBC53U,
+    0x013BBD85U,
+    0x013BBD8EU,
+    0x013BBDEEU,
+    0x013BBDF0U,
+    0x013BBE13U,
+    0x013BBE14U,
+    0x013BBE44U,
+    0x013BBE45U,
+    0x013BBE4EU,
+    0x013BBE93U,
+    0x013BBEAEU,
+    0x013BD5C7U,
+    0x013C8845U,
+    0x013C892CU,
+    0x013C89E5U,
+    0x013C89F7U,
+    0x013C8CA5U,
+    0x013C8CB3U,
+    0x013C8DEEU,
+    0x013C95D3U,
+    0x013CACB2U,
+    0x013CACB3U,
+    0x013CB133U,
+    0x013CB208U,
+    0x013CB2C1U,
+    0x013CB432U,
+    0x013CB868U,
+    0x013CB873U,
+    0x013CB893U,
+    0x013CB8A4U,
+    0x013CB8B3U,
+    0x013CB9E4U,
+    0x013CBA88U,
+    0x013CC0A4U,
+    0x013CC0B3U,
+    0x013CC113U,
+    0x013CC828U,
+    0x013CC8AEU,
+    0x013CCAB0U,
+    0x013CCDF0U,
+    0x013CD105U,
+    0x013CD8B2U,
+    0x01408593U,
+    0x01408681U,
+    0x01408859U,
+    0x014088B2U,
+    0x014088B3U,
+    0x01408924U,
+    0x01408933U,
+    0x01408981U,
+    0x01408985U,
+    0x014089EFU,
+    0x014089F2U,
+    0x01408AAEU,
+    0x01408AB3U,
+    0x01408C2EU,
+    0x01408CB3U,
+    0x01408CB4U,
+    0x01408D05U,
+    0x01408D0FU,
+    0x01408D13U,
+    0x01408D34U,
+    0x01408D73U,
+    0x01408D79U,
+    0x01408DF3U,
+    0x01408E93U,
+    0x01409593U,
+    0x014098D9U,
+    0x01409921U,
+    0x01409CF9U,
+    0x01409DA1U,
+    0x0140A033U,
+    0x0140A253U,
+    0x0140A4E1U,
+    0x0140A4F3U,
+    0x0140A56FU,
+    0x0140A593U,
+    0x0140A5D3U,
+    0x0140A5D4U,
+    0x0140A641U,
+    0x0140A668U,
+    0x0140A693U,
+    0x0140A8B3U,
+    0x0140AC33U,
+    0x0140ACAEU,
+    0x0140ACB2U,
+    0x0140ACB3U,
+    0x0140AD09U,
+    0x0140AD2EU,
+    0x0140AD33U,
+    0x0140AD79U,
+    0x0140B02BU,
+    0x0140B031U,
+    0x0140B032U,
+    0x0140B033U,
+    0x0140B073U,
+    0x0140B079U,
+    0x0140B0A1U,
+    0x0140B0B2U,
+    0x0140B0B3U,
+    0x0140B173U,
+    0x0140B179U,
+    0x0140B193U,
+    0x0140B199U,
+    0x0140B1A1U,
+    0x0140B1EEU,
+    0x0140B201U,
+    0x0140B2ABU,
+    0x0140B2B3U,
+    0x0140B42CU,
+    0x0140B4A4U,
+    0x0140B4B2U,
+    0x0140B4B3U,
+    0x0140B52EU,
+    0x0140B533U,
+    0x0140B5B9U,
+    0x0140B613U,
+    0x0140B833U,
+    0x0140B8E1U,
+    0x0140B8E9U,
+    0x0140B8EFU,
+    0x0140B8F3U,
+    0x0140B8F9U,
+    0x0140B913U,
+    0x0140B961U,
+    0x0140B973U,
+    0x0140B979U,
+    0x0140B9C1U,
+    0x0140BA79U,
+    0x0140BA89U,
+    0x0140BA8FU,
+    0x0140BA99U,
+    0x0140C033U,
+    0x0140C0A4U,
+    0x0140C0AEU,
+    0x0140C0B2U,
+    0x0140C0B3U,
+    0x0140C0B4U,
+    0x0140C132U,
+    0x0140C133U,
+    0x0140C201U,
+    0x0140C2B3U,
+    0x0140C833U,
+    0x0140C88FU,
+    0x0140C899U,
+    0x0140C8A4U,
+    0x0140C8B3U,
+    0x0140C8E1U,
+    0x0140C8E5U,
+    0x0140C9D3U,
+    0x0140C9E3U,
+    0x0140C9EBU,
+    0x0140C9F3U,
+    0x0140C9F4U,
+    0x0140CA13U,
+    0x0140CA45U,
+    0x0140CA59U,
+    0x0140CA69U,
+    0x0140CA93U,
+    0x0140CA99U,
+    0x0140CC32U,
+    0x0140CCA4U,
+    0x0140CCB2U,
+    0x0140CCB3U,
+    0x0140CD73U,
+    0x0140CE61U,
+    0x0140CE65U,
+    0x0140CE6FU,
+    0x0140CE85U,
+    0x0140CE99U,
+    0x0140D032U,
+    0x0140D0B2U,
+    0x0140D0B3U,
+    0x0140D113U,
+    0x0140D125U,
+    0x0140D1F5U,
+    0x0140D293U,
+    0x0140D299U,
+    0x0140D2B3U,
+    0x0140D445U,
+    0x0140D584U,
+    0x0140D5D4U,
+    0x0140D5EEU,
+    0x0140D605U,
+    0x0140D693U,
+    0x0140D828U,
+    0x0140D833U,
+    0x0140D8B2U,
+    0x0140DC29U,
+    0x0140DC33U,
+    0x0140DCA4U,
+    0x0140DCB2U,
+    0x0140DD25U,
+    0x0140DDD9U,
+    0x0140DE65U,
+    0x0140DE93U,
+    0x0140E0A4U,
+    0x0140E0B2U,
+    0x0140E0B3U,
+    0x0140E133U,
+    0x0140E1ECU,
+    0x0140E1EEU,
+    0x0140E1F2U,
+    0x0140E2B3U,
+    0x0140E641U,
+    0x0140EB41U,
+    0x0140EB45U,
+    0x01428468U,
+    0x01428485U,
+    0x01428493U,
+    0x014284A4U,
+    0x01428573U,
+    0x01428593U,
+    0x014285B3U,
+    0x01428653U,
+    0x01428659U,
+    0x01428665U,
+    0x01428693U,
+    0x01428745U,
+    0x01428D13U,
+    0x01428D19U,
+    0x01428E81U,
+    0x01429099U,
+    0x01429593U,
+    0x014295B3U,
+    0x014295C4U,
+    0x014295C5U,
+    0x014295D3U,
+    0x014295D9U,
+    0x01429653U,
+    0x01429688U,
+    0x014298D3U,
+    0x01429CF3U,
+    0x01429EA1U,
+    0x01429EB3U,
+    0x0142A253U,
+    0x0142A524U,
+    0x0142A593U,
+    0x0142A5C4U,
+    0x0142A5D3U,
+    0x0142B025U,
+    0x0142B06FU,
+    0x0142B0B3U,
+    0x0142B0B8U,
+    0x0142B121U,
+    0x0142B123U,
+    0x0142B193U,
+    0x0142B199U,
+    0x0142B1E9U,
+    0x0142B1F3U,
+    0x0142B4A4U,
+    0x0142B4B3U,
+    0x0142B609U,
+    0x0142B60FU,
+    0x0142B613U,
+    0x0142B614U,
+    0x0142B665U,
+    0x0142B868U,
+    0x0142B893U,
+    0x0142B895U,
+    0x0142B8B3U,
+    0x0142B8B4U,
+    0x0142B8E5U,
+    0x0142B921U,
+    0x0142B9C5U,
+    0x0142B9CFU,
+    0x0142B9D9U,
+    0x0142B9EEU,
+    0x0142B9F2U,
+    0x0142BA65U,
+    0x0142BA88U,
+    0x0142BA93U,
+    0x0142BA99U,
+    0x0142BAA5U,
+    0x0142C02CU,
+    0x0142C033U,
+    0x0142C0A5U,
+    0x0142C124U,
+    0x0142C1F9U,
+    0x0142C829U,
+    0x0142C833U,
+    0x0142C865U,
+    0x0142C8ABU,
+    0x0142C8B3U,
+    0x0142C8C5U,
+    0x0142C8D3U,
+    0x0142C8E1U,
+    0x0142C9B3U,
+    0x0142C9C5U,
+    0x0142C9D3U,
+    0x0142CA41U,
+    0x0142CA59U,
+    0x0142CA65U,
+    0x0142CA93U,
+    0x0142CD81U,
+    0x0142CE81U,
+    0x0142CE85U,
+    0x0142CE93U,
+    0x0142CE99U,
+    0x0142D0B3U,
+    0x0142D113U,
+    0x0142D241U,
+    0x0142D249U,
+    0x0142D468U,
+    0x0142D4E8U,
+    0x0142DCA4U,
+    0x0142DCACU,
+    0x0142DD34U,
+    0x0142E033U,
+    0x0142E0B3U,
+    0x0142E293U,
+    0x0144046BU,
+    0x014404E9U,
+    0x0144052DU,
+    0x01440585U,
+    0x01440589U,
+    0x014405C1U,
+    0x014405C5U,
+    0x014405C7U,
+    0x014405CBU,
+    0x014405D3U,
+    0x014405D8U,
+    0x0144064DU,
+    0x01440653U,
+    0x014406F3U,
+    0x014406F9U,
+    0x01441445U,
+    0x01441461U,
+    0x014414A4U,
+    0x014414ABU,
+    0x014414B3U,
+    0x014414D4U,
+    0x014414EEU,
+    0x01441523U,
+    0x0144152EU,
+    0x01441532U,
+    0x01441586U,
+    0x014415A1U,
+    0x014415A5U,
+    0x014415D3U,
+    0x014415F7U,
+    0x01441645U,
+    0x0144164DU,
+    0x01441665U,
+    0x01441670U,
+    0x01441681U,
+    0x01441685U,
+    0x014416F3U,
+    0x014416F9U,
+    0x0144246BU,
+    0x014424A6U,
+    0x014424E8U,
+    0x014424F3U,
+    0x0144258BU,
+    0x0144258CU,
+    0x014425C5U,
+    0x014425C7U,
+    0x014425CBU,
+    0x014425D3U,
+    0x014425ECU,
+    0x01442644U,
+    0x0144264CU,
+    0x01443CD4U,
+    0x01443D85U,
+    0x01443D89U,
+    0x01443DC7U,
+    0x01443E4EU,
+    0x01443E4FU,
+    0x01443E50U,
+    0x01443E65U,
+    0x01443EB3U,
+    0x01443EECU,
+    0x01444825U,
+    0x01444837U,
+    0x014448A5U,
+    0x014448B7U,
+    0x01444924U,
+    0x01444930U,
+    0x014449E2U,
+    0x014449E5U,
+    0x014449F7U,
+    0x01444AADU,
+    0x01445493U,
+    0x014454F3U,
+    0x01445541U,
+    0x014455A2U,
+    0x014455B0U,
+    0x014455CBU,
+    0x0144564CU,
+    0x01445721U,
+    0x014465A5U,
+    0x014465A9U,
+    0x014465B9U,
+    0x014485D3U,
+    0x01448641U,
+    0x01448653U,
+    0x01448921U,
+    0x01448C2CU,
+    0x01448C61U,
+    0x01448CA4U,
+    0x01448CB3U,
+    0x01448D19U,
+    0x01448D73U,
+    0x01448D79U,
+    0x0144902CU,
+    0x01449099U,
+    0x014490A4U,
+    0x014490B3U,
+    0x01449653U,
+    0x014498D3U,
+    0x014499F3U,
+    0x01449A93U,
+    0x01449CB2U,
+    0x01449CB3U,
+    0x01449D14U,
+    0x01449DEEU,
+    0x0144AC33U,
+    0x0144ACB3U,
+    0x0144AD33U,
+    0x0144AD61U,
+    0x0144B02BU,
+    0x0144B085U,
+    0x0144B0A4U,
+    0x0144B0B2U,
+    0x0144B0B3U,
+    0x0144B193U,
+    0x0144B199U,
+    0x0144B288U,
+    0x0144B293U,
+    0x0144B44FU,
+    0x0144B4A4U,
+    0x0144B4B2U,
+    0x0144B4B3U,
+    0x0144B524U,
+    0x0144B5EEU,
+    0x0144B613U,
+    0x0144B833U,
+    0x0144B874U,
+    0x0144B893U,
+    0x0144B8A1U,
+    0x0144B8A4U,
+    0x0144B8B3U,
+    0x0144B8E5U,
+    0x0144B8F3U,
+    0x0144B973U,
+    0x0144B9D9U,
+    0x0144BA93U,
+    0x0144BA99U,
+    0x0144C133U,
+    0x0144C219U,
+    0x0144C279U,
+    0x0144C8A4U,
+    0x0144C8B3U,
+    0x0144C993U,
+    0x0144C9F3U,
+    0x0144CA53U,
+    0x0144D02EU,
+    0x0144D068U,
+    0x0144D0B2U,
+    0x0144D105U,
+    0x0144D133U,
+    0x0144D185U,
+    0x0144D245U,
+    0x0144D299U,
+    0x0144D2B0U,
+    0x0144E52EU,
+    0x0144E5D3U,
+    0x0144E8B3U,
+    0x0144EB59U,
+    0x01478493U,
+    0x01478499U,
+    0x01478674U,
+    0x01478745U,
+    0x01478D73U,
+    0x01478D79U,
+    0x01478DF3U,
+    0x01479039U,
+    0x01479085U,
+    0x01479099U,
+    0x01479433U,
+    0x014798D3U,
+    0x014798D9U,
+    0x01479A93U,
+    0x01479AB3U,
+    0x01479C25U,
+    0x01479C33U,
+    0x01479CA4U,
+    0x01479CB3U,
+    0x01479EA5U,
+    0x0147A1F3U,
+    0x0147A585U,
+    0x0147A593U,
+    0x0147A5C7U,
+    0x0147A665U,
+    0x0147A693U,
+    0x0147AC39U,
+    0x0147ACA4U,
+    0x0147ACAEU,
+    0x0147ACB2U,
+    0x0147ACB3U,
+    0x0147ADF3U,
+    0x0147B02EU,
+    0x0147B032U,
+    0x0147B033U,
+    0x0147B0A4U,
+    0x0147B0B3U,
+    0x0147B193U,
+    0x0147B199U,
+    0x0147B293U,
+    0x0147B2B3U,
+    0x0147B32CU,
+    0x0147B42EU,
+    0x0147B453U,
+    0x0147B4B3U,
+    0x0147B521U,
+    0x0147B5B9U,
+    0x0147B5F3U,
+    0x0147B82CU,
+    0x0147B889U,
+    0x0147B88FU,
+    0x0147B8A4U,
+    0x0147B8B2U,
+    0x0147B8B3U,
+    0x0147B8B9U,
+    0x0147B8E1U,
+    0x0147B8F3U,
+    0x0147B923U,
+    0x0147B961U,
+    0x0147B973U,
+    0x0147B9C5U,
+    0x0147BAB3U,
+    0x0147BD93U,
+    0x0147BDB3U,
+    0x0147BDD3U,
+    0x0147BE88U,
+    0x0147BE93U,
+    0x0147C03AU,
+    0x0147C0A4U,
+    0x0147C0A5U,
+    0x0147C0ABU,
+    0x0147C0B2U,
+    0x0147C0B3U,
+    0x0147C105U,
+    0x0147C109U,
+    0x0147C113U,
+    0x0147C123U,
+    0x0147C133U,
+    0x0147C1E9U,
+    0x0147C1F3U,
+    0x0147C219U,
+    0x0147C6A5U,
+    0x0147C828U,
+    0x0147C82EU,
+    0x0147C833U,
+    0x0147C868U,
+    0x0147C873U,
+    0x0147C8B3U,
+    0x0147C923U,
+    0x0147C929U,
+    0x0147C9F3U,
+    0x0147C9F4U,
+    0x0147CA53U,
+    0x0147CA65U,
+    0x0147CA69U,
+    0x0147CA6BU,
+    0x0147CA6FU,
+    0x0147CA81U,
+    0x0147CA85U,
+    0x0147CA93U,
+    0x0147CAB3U,
+    0x0147CC33U,
+    0x0147CCA4U,
+    0x0147CCB3U,
+    0x0147CD19U,
+    0x0147CE79U,
+    0x0147D02CU,
+    0x0147D0A4U,
+    0x0147D0ADU,
+    0x0147D0B2U,
+    0x0147D0B3U,
+    0x0147D299U,
+    0x0147D468U,
+    0x0147D4E8U,
+    0x0147D573U,
+    0x0147D5D3U,
+    0x0147D653U,
+    0x0147D665U,
+    0x0147D679U,
+    0x0147D693U,
+    0x0147D745U,
+    0x0147D759U,
+    0x0147DCA4U,
+    0x0147DCACU,
+    0x0147DCB2U,
+    0x0147DD25U,
+    0x0147DDD3U,
+    0x0147DDD9U,
+    0x0147DE65U,
+    0x0147DE79U,
+    0x0147DE93U,
+    0x0147DF45U,
+    0x0147DF59U,
+    0x0147E123U,
+    0x0147E12EU,
+    0x0147E4A4U,
+    0x0147E4B2U,
+    0x0147E5EEU,
+    0x0147E5F3U,
+    0x0147E8A4U,
+    0x0147E8B3U,
+    0x0147E925U,
+    0x01490453U,
+    0x01490465U,
+    0x0149046BU,
+    0x01490474U,
+    0x01490485U,
+    0x01490493U,
+    0x014904E9U,
+    0x0149052BU,
+    0x0149052CU,
+    0x0149052EU,
+    0x01490534U,
+    0x014905B0U,
+    0x014905B3U,
+    0x014905CBU,
+    0x014905D1U,
+    0x014905D3U,
+    0x014905D4U,
+    0x01490605U,
+    0x01490613U,
+    0x01490614U,
+    0x01490668U,
+    0x01490673U,
+    0x01490693U,
+    0x01490694U,
+    0x014906C5U,
+    0x014906ECU,
+    0x01490726U,
+    0x01490733U,
+    0x01491424U,
+    0x01491434U,
+    0x0149146BU,
+    0x014914A4U,
+    0x014914AEU,
+    0x014914B3U,
+    0x014914C1U,
+    0x01491526U,
+    0x01491573U,
+    0x014915A1U,
+    0x014915B3U,
+    0x014915C4U,
+    0x01491673U,
+    0x01491674U,
+    0x01491693U,
+    0x014916F3U,
+    0x01491726U,
+    0x01491733U,
+    0x01492423U,
+    0x01492424U,
+    0x0149242CU,
+    0x01492445U,
+    0x01492465U,
+    0x0149246BU,
+    0x01492485U,
+    0x014924A4U,
+    0x014924B2U,
+    0x014924B3U,
+    0x014924C6U,
+    0x014924EFU,
+    0x014924F3U,
+    0x01492565U,
+    0x01492584U,
+    0x0149258CU,
+    0x014925B3U,
+    0x014925C5U,
+    0x014925D3U,
+    0x014925ECU,
+    0x014925F2U,
+    0x014925F3U,
+    0x01492605U,
+    0x01492613U,
+    0x01492619U,
+    0x01492674U,
+    0x01492685U,
+    0x01493C24U,
+    0x01493C2BU,
+    0x01493C34U,
+    0x01493C6BU,
+    0x01493C85U,
+    0x01493C93U,
+    0x01493CF3U,
+    0x01493D33U,
+    0x01493D65U,
+    0x01493D8CU,
+    0x01493DB0U,
+    0x01493DC1U,
+    0x01493DC3U,
+    0x01493DC5U,
+    0x01493DCBU,
+    0x01493DD3U,
+    0x01493DF0U,
+    0x01493DFAU,
+    0x01493E05U,
+    0x01493E88U,
+    0x01493E93U,
+    0x01493EB4U,
+    0x01493EC5U,
+    0x01493EF3U,
+    0x01493F33U,
+    0x01495465U,
+    0x0149546BU,
+    0x014954A4U,
+    0x014954B2U,
+    0x014954B3U,
+    0x014954EFU,
+    0x014954F3U,
+    0x0149558CU,
+    0x01495599U,
+    0x014955B0U,
+    0x014955CBU,
+    0x01495673U,
+    0x01495674U,
+    0x01495688U,
+    0x014964B2U,
+    0x01496565U,
+    0x014965A1U,
+    0x01496613U,
+    0x01496674U,
+    0x01498485U,
+    0x01498489U,
+    0x01498653U,
+    0x0149ACA4U,
+    0x0149D441U,
+    0x0149D44FU,
+    0x014A85D3U,
+    0x014A8654U,
+    0x014A8688U,
+    0x014A8825U,
+    0x014A882CU,
+    0x014A8832U,
+    0x014A8833U,
+    0x014A8859U,
+    0x014A88A4U,
+    0x014A88B2U,
+    0x014A88B3U,
+    0x014A8D73U,
+    0x014A9833U,
+    0x014A98C5U,
+    0x014A98D3U,
+    0x014A9A93U,
+    0x014A9A99U,
+    0x014A9E41U,
+    0x014AA585U,
+    0x014AA5C1U,
+    0x014AA66DU,
+    0x014AAE95U,
+    0x014AB0B3U,
+    0x014AB130U,
+    0x014AB185U,
+    0x014AB201U,
+    0x014AB269U,
+    0x014AB524U,
+    0x014AB5B9U,
+    0x014AB5F2U,
+    0x014AB613U,
+    0x014AB619U,
+    0x014AB833U,
+    0x014AB893U,
+    0x014AB8A4U,
+    0x014AB8B2U,
+    0x014AB8B3U,
+    0x014AB8F3U,
+    0x014AB923U,
+    0x014AB9D9U,
+    0x014AC0ABU,
+    0x014AC12BU,
+    0x014AC185U,
+    0x014AC6A5U,
+    0x014AC84FU,
+    0x014AC893U,
+    0x014AC8D3U,
+    0x014AC8D9U,
+    0x014AC973U,
+    0x014AC9A5U,
+    0x014AC9B3U,
+    0x014AC9D3U,
+    0x014AC9D4U,
+    0x014ACA13U,
+    0x014ACA53U,
+    0x014ACD19U,
+    0x014ACD73U,
+    0x014ACD79U,
+    0x014AD0A5U,
+    0x014AD1F2U,
+    0x014AD289U,
+    0x014AD299U,
+    0x014AD2B3U,
+    0x014AE0B3U,
+    0x014AE4B2U,
+    0x014B84B3U,
+    0x014B852EU,
+    0x014B8593U,
+    0x014B85C7U,
+    0x014B85CBU,
+    0x014B8693U,
+    0x014B8733U,
+    0x014B942BU,
+    0x014B94A4U,
+    0x014B94ACU,
+    0x014B94AEU,
+    0x014B94B0U,
+    0x014B94B2U,
+    0x014B94B4U,
+    0x014B964BU,
+    0x014B9650U,
+    0x014BA465U,
+    0x014BA4B2U,
+    0x014BA4F3U,
+    0x014BA58CU,
+    0x014BA594U,
+    0x014BA5C5U,
+    0x014BA5CBU,
+    0x014BA5D3U,
+    0x014BA5D9U,
+    0x014BA645U,
+    0x014BA64CU,
+    0x014BA650U,
+    0x014BA674U,
+    0x014BA685U,
+    0x014BA693U,
+    0x014BA714U,
+    0x014BBCB2U,
+    0x014BE4B2U,
+    0x014C94B3U,
+    0x014C9653U,
+    0x014CA5C7U,
+    0x014CA72EU,
+    0x014CACB3U,
+    0x014CB0B2U,
+    0x014CB613U,
+    0x014CB885U,
+    0x014CB8A4U,
+    0x014CB8B3U,
+    0x014CC02CU,
+    0x014CC0A4U,
+    0x014CC0B3U,
+    0x014CC0B9U,
+    0x014CC123U,
+    0x014CC1F3U,
+    0x014CC213U,
+    0x014CC28FU,
+    0x014CC82EU,
+    0x014CC8A4U,
+    0x014CC8B3U,
+    0x014CC9F3U,
+    0x014CD105U,
+    0x014D0653U,
+    0x01520593U,
+    0x015210B2U,
+    0x01523DD3U,
+    0x01538589U,
+    0x01539CA4U,
+    0x0154302EU,
+    0x01545655U,
+    0x01558665U,
+    0x015605A1U,
+    0x015605D3U,
+    0x01560CB2U,
+    0x015615A1U,
+    0x0156352EU,
+    0x01563824U,
+    0x01563825U,
+    0x01563832U,
+    0x01563833U,
+    0x0156402EU,
+    0x01565241U,
+    0x01565833U,
+    0x01566525U,
+    0x01566925U,
+    0x015685A9U,
+    0x015688ACU,
+    0x015688B2U,
+    0x01568985U,
+    0x015689F3U,
+    0x01568A41U,
+    0x01568A45U,
+    0x0156A423U,
+    0x0156A42BU,
+    0x0156A431U,
+    0x0156B428U,
+    0x0156B433U,
+    0x0156B4A4U,
+    0x0156C0A4U,
+    0x0156C113U,
+    0x0156C125U,
+    0x0156C299U,
+    0x0156C828U,
+    0x0156C833U,
+    0x01570533U,
+    0x01570614U,
+    0x0157064DU,
+    0x01570659U,
+    0x015706B3U,
+    0x01570827U,
+    0x0157082EU,
+    0x01570832U,
+    0x015708A4U,
+    0x01570924U,
+    0x015709F8U,
+    0x01570C30U,
+    0x01570CB3U,
+    0x01570D21U,
+    0x01570D85U,
+    0x01570DF3U,
+    0x01570DF9U,
+    0x01570EB3U,
+    0x01570EB4U,
+    0x0157102DU,
+    0x015710A5U,
+    0x015710B2U,
+    0x01571124U,
+    0x015711F3U,
+    0x015712A5U,
+    0x015712A7U,
+    0x01571688U,
+    0x015718A4U,
+    0x01571934U,
+    0x01571938U,
+    0x01571C27U,
+    0x01571CB4U,
+    0x01571DE4U,
+    0x01571DF4U,
+    0x01571EADU,
+    0x01572034U,
+    0x01572130U,
+    0x01572461U,
+    0x015724D9U,
+    0x015725EEU,
+    0x01572685U,
+    0x01572693U,
+    0x01572699U,
+    0x0157282DU,
+    0x01572CA4U,
+    0x01572CB4U,
+    0x01572D24U,
+    0x01573037U,
+    0x01573039U,
+    0x015730A4U,
+    0x015730B4U,
+    0x01573124U,
+    0x01573134U,
+    0x0157342EU,
+    0x015734B4U,
+    0x015734B7U,
+    0x01573538U,
+    0x01574039U,
+    0x015740A7U,
+    0x015740AEU,
+    0x0157412EU,
+    0x015748A4U,
+    0x01574924U,
+    0x01574927U,
+    0x01574930U,
+    0x01574C37U,
+    0x01574C39U,
+    0x01574CA5U,
+    0x01574CB4U,
+    0x01574CB7U,
+    0x01574CB8U,
+    0x01574DE4U,
+    0x01575038U,
+    0x01575125U,
+    0x0157512CU,
+    0x0157512EU,
+    0x01575CA4U,
+    0x01575CB4U,
+    0x01575D34U,
+    0x01575DEEU,
+    0x01576930U,
+    0x015809F7U,
+    0x01580B25U,
+    0x015811F3U,
+    0x01581259U,
+    0x015815C4U,
+    0x015828B4U,
+    0x01583039U,
+    0x015830A4U,
+    0x01583134U,
+    0x015840A4U,
+    0x015840B2U,
+    0x0158482EU,
+    0x01584AAEU,
+    0x01584CA5U,
+    0x01584CB4U,
+    0x01584CB9U,
+    0x0158502BU,
+    0x015850B2U,
+    0x01585125U,
+    0x015904A9U,
+    0x01590589U,
+    0x015905F3U,
+    0x01590645U,
+    0x01590649U,
+    0x01590665U,
+    0x01590685U,
+    0x0159082EU,
+    0x015908B8U,
+    0x01590921U,
+    0x015910A5U,
+    0x0159142CU,
+    0x01591433U,
+    0x0159148FU,
+    0x01591523U,
+    0x015915C1U,
+    0x015915D4U,
+    0x01591CA4U,
+    0x01591CB2U,
+    0x01591CB3U,
+    0x0159242CU,
+    0x015925C5U,
+    0x01592685U,
+    0x0159342EU,
+    0x0159382CU,
+    0x015938A4U,
+    0x015940A4U,
+    0x01594C25U,
+    0x01594D24U,
+    0x01594DEEU,
+    0x01595455U,
+    0x01595833U,
+    0x015984E5U,
+    0x01599653U,
+    0x0159A0B2U,
+    0x0159A5C7U,
+    0x0159B8A1U,
+    0x0159C6A5U,
+    0x0159D42CU,
+    0x0159D645U,
+    0x0159D650U,
+    0x0159D659U,
+    0x015A1649U,
+    0x015A2585U,
+    0x015A50B2U,
+    0x015B142CU,
+    0x015B1433U,
+    0x015B5581U,
+    0x01608EA1U,
+    0x016090A4U,
+    0x016090B3U,
+    0x01609C2CU,
+    0x01609EA5U,
+    0x01609EB3U,
+    0x0160A593U,
+    0x0160A645U,
+    0x0160A653U,
+    0x0160A659U,
+    0x0160AC33U,
+    0x0160AD2CU,
+    0x0160B0B3U,
+    0x0160B0B4U,
+    0x0160B124U,
+    0x0160B133U,
+    0x0160B1F2U,
+    0x0160B265U,
+    0x0160B2A5U,
+    0x0160B2C5U,
+    0x0160B613U,
+    0x0160B619U,
+    0x0160B881U,
+    0x0160B8A4U,
+    0x0160B8B3U,
+    0x0160B8F3U,
+    0x0160BA93U,
+    0x0160C0A4U,
+    0x0160C0B2U,
+    0x0160C0B3U,
+    0x0160C124U,
+    0x0160C1F2U,
+    0x0160C82EU,
+    0x0160C833U,
+    0x0160C899U,
+    0x0160C8A3U,
+    0x0160C8B3U,
+    0x0160C921U,
+    0x0160C938U,
+    0x0160C9C1U,
+    0x0160CAB3U,
+    0x0160CAC5U,
+    0x0160CC2CU,
+    0x0160CCB3U,
+    0x0160CE93U,
+    0x0160CE99U,
+    0x0160D123U,
+    0x0160D2B3U,
+    0x0160D468U,
+    0x0160D594U,
+    0x0160D5D4U,
+    0x0160D685U,
+    0x0160D693U,
+    0x0160DE85U,
+    0x0160E0B3U,
+    0x01628585U,
+    0x01628593U,
+    0x01628599U,
+    0x016295C1U,
+    0x01629613U,
+    0x01629653U,
+    0x01629659U,
+    0x01629C2EU,
+    0x01629C33U,
+    0x01629CB3U,
+    0x01629D25U,
+    0x01629DF3U,
+    0x0162A1A5U,
+    0x0162A593U,
+    0x0162A599U,
+    0x0162A5D3U,
+    0x0162A5D9U,
+    0x0162B032U,
+    0x0162B093U,
+    0x0162B094U,
+    0x0162B0B3U,
+    0x0162B193U,
+    0x0162B2ADU,
+    0x0162B825U,
+    0x0162B82CU,
+    0x0162B893U,
+    0x0162B895U,
+    0x0162B8B9U,
+    0x0162B8E5U,
+    0x0162B92EU,
+    0x0162B9EDU,
+    0x0162BA93U,
+    0x0162BAA5U,
+    0x0162BAB3U,
+    0x0162C853U,
+    0x0162C8E5U,
+    0x0162CA41U,
+    0x0162CA59U,
+    0x0162CA65U,
+    0x0162CA6FU,
+    0x0162CA74U,
+    0x0162CA93U,
+    0x0162CA95U,
+    0x0162CAC5U,
+    0x0162CE01U,
+    0x0162CE81U,
+    0x0162CE93U,
+    0x0162D068U,
+    0x0162E0A4U,
+    0x0162E0B2U,
+    0x0162E0B3U,
+    0x0162E12CU,
+    0x0162E932U,
+    0x01648593U,
+    0x016485C4U,
+    0x016488B3U,
+    0x016488B8U,
+    0x016488B9U,
+    0x01648C32U,
+    0x01648CA4U,
+    0x01648CB3U,
+    0x01648D19U,
+    0x016490AFU,
+    0x01649653U,
+    0x016496F3U,
+    0x016496F9U,
+    0x01649881U,
+    0x016498D3U,
+    0x01649C33U,
+    0x01649D21U,
+    0x01649D2CU,
+    0x01649DF2U,
+    0x0164B085U,
+    0x0164B0B2U,
+    0x0164B181U,
+    0x0164B189U,
+    0x0164B193U,
+    0x0164B4AEU,
+    0x0164B82CU,
+    0x0164B833U,
+    0x0164B861U,
+    0x0164B8A4U,
+    0x0164B8B2U,
+    0x0164B8B3U,
+    0x0164B8B7U,
+    0x0164B923U,
+    0x0164B9F3U,
+    0x0164BA93U,
+    0x0164BB2CU,
+    0x0164BD81U,
+    0x0164BD84U,
+    0x0164BD93U,
+    0x0164C0B2U,
+    0x0164C82CU,
+    0x0164C8A4U,
+    0x0164C8AFU,
+    0x0164C8B3U,
+    0x0164C8E1U,
+    0x0164C8E5U,
+    0x0164C924U,
+    0x0164C993U,
+    0x0164CA95U,
+    0x0164CAB3U,
+    0x0164CC33U,
+    0x0164CCA4U,
+    0x0164CCB3U,
+    0x0164CD25U,
+    0x0164CD34U,
+    0x0164CDC5U,
+    0x0164CDEEU,
+    0x0164CDF2U,
+    0x0164CE81U,
+    0x0164CE8FU,
+    0x0164D025U,
+    0x0164D02CU,
+    0x0164D033U,
+    0x0164D0B8U,
+    0x0164D24FU,
+    0x0164D281U,
+    0x0164D833U,
+    0x0164D834U,
+    0x0164D881U,
+    0x0164D8B2U,
+    0x0164D8B3U,
+    0x0164D924U,
+    0x0164E0AEU,
+    0x0164E932U,
+    0x0164E9F2U,
+    0x01661533U,
+    0x016624B3U,
+    0x01663CF3U,
+    0x01678653U,
+    0x01678C22U,
+    0x01678C2CU,
+    0x01678CB3U,
+    0x01679099U,
+    0x01679161U,
+    0x016791F5U,
+    0x016792AEU,
+    0x016795A1U,
+    0x01679D25U,
+    0x01679EA5U,
+    0x0167A465U,
+    0x0167A493U,
+    0x0167A581U,
+    0x0167A585U,
+    0x0167A613U,
+    0x0167B025U,
+    0x0167B032U,
+    0x0167B0A4U,
+    0x0167B0B3U,
+    0x0167B0B4U,
+    0x0167B173U,
+    0x0167B281U,
+    0x0167B285U,
+    0x0167B289U,
+    0x0167B293U,
+    0x0167B2C1U,
+    0x0167B2C5U,
+    0x0167B4B2U,
+    0x0167B534U,
+    0x0167D0A4U,
+    0x0167D0B2U,
+    0x0167D0B3U,
+    0x0167D468U,
+    0x0167D4E5U,
+    0x0167D595U,
+    0x0167DCA4U,
+    0x0167DCACU,
+    0x0167DCB2U,
+    0x0167E0ACU,
+    0x0167E904U,
+    0x01690523U,
+    0x01692593U,
+    0x01693DEDU,
+    0x01693EB3U,
+    0x01693EB7U,
+    0x01693EF3U,
+    0x016A9CF3U,
+    0x016A9CF9U,
+    0x016A9D13U,
+    0x016A9D19U,
+    0x016AB0EFU,
+    0x016AB1D3U,
+    0x016AB2C1U,
+    0x016AD299U,
+    0x016CA5C7U,
+    0x01708473U,
+    0x01708D65U,
+    0x01708D6FU,
+    0x01708D73U,
+    0x01708D79U,
+    0x01709093U,
+    0x01709099U,
+    0x017090A4U,
+    0x017090B2U,
+    0x017090B3U,
+    0x017090E5U,
+    0x01709133U,
+    0x01709293U,
+    0x017098B2U,
+    0x017098D3U,
+    0x01709A93U,
+    0x01709CA4U,
+    0x01709CB2U,
+    0x01709CB3U,
+    0x01709CE1U,
+    0x01709DEEU,
+    0x01709F35U,
+    0x0170A1EFU,
+    0x0170A485U,
+    0x0170A4D3U,
+    0x0170A4D4U,
+    0x0170A593U,
+    0x0170A5D3U,
+    0x0170A653U,
+    0x0170A674U,
+    0x0170A685U,
+    0x0170A693U,
+    0x0170A6C5U,
+    0x0170AC33U,
+    0x0170ACA4U,
+    0x0170ACAEU,
+    0x0170ACB2U,
+    0x0170ACB3U,
+    0x0170ACD3U,
+    0x0170B08FU,
+    0x0170B093U,
+    0x0170B0A4U,
+    0x0170B0B2U,
+    0x0170B0B3U,
+    0x0170B125U,
+    0x0170B133U,
+    0x0170B173U,
+    0x0170B181U,
+    0x0170B193U,
+    0x0170B199U,
+    0x0170B299U,
+    0x0170B29AU,
+    0x0170B4A4U,
+    0x0170B4B3U,
+    0x0170B6B3U,
+    0x0170B893U,
+    0x0170B8A4U,
+    0x0170B8B3U,
+    0x0170B8B9U,
+    0x0170B8F3U,
+    0x0170B973U,
+    0x0170B979U,
+    0x0170B985U,
+    0x0170B999U,
+    0x0170B9C1U,
+    0x0170BA93U,
+    0x0170BA99U,
+    0x0170BB45U,
+    0x0170C4D3U,
+    0x0170C853U,
+    0x0170C859U,
+    0x0170C893U,
+    0x0170C8A4U,
+    0x0170C8B3U,
+    0x0170C8BAU,
+    0x0170C973U,
+    0x0170C9B3U,
+    0x0170C9D3U,
+    0x0170CA13U,
+    0x0170CA45U,
+    0x0170CA74U,
+    0x0170CA93U,
+    0x0170CA99U,
+    0x0170CCB3U,
+    0x0170CD19U,
+    0x0170CDB3U,
+    0x0170CE13U,
+    0x0170CE19U,
+    0x0170CE85U,
+    0x0170CE93U,
+    0x0170D030U,
+    0x0170D068U,
+    0x0170D0B2U,
+    0x0170D293U,
+    0x0170D4C6U,
+    0x0170D4E8U,
+    0x0170D573U,
+    0x0170D58BU,
+    0x0170D593U,
+    0x0170D653U,
+    0x0170D8A4U,
+    0x0170D8B2U,
+    0x0170D8B3U,
+    0x0170D8B9U,
+    0x0170DC33U,
+    0x0170DCB3U,
+    0x0170DD93U,
+    0x0170E0A4U,
+    0x0170E0AEU,
+    0x0170E0B2U,
+    0x0170E0B3U,
+    0x0170E4A4U,
+    0x0170E932U,
+    0x0170E9EFU,
+    0x01728584U,
+    0x01728593U,
+    0x017285A2U,
+    0x017285D3U,
+    0x01728653U,
+    0x01728659U,
+    0x017286C5U,
+    0x01728859U,
+    0x017288B2U,
+    0x01728D14U,
+    0x017290ACU,
+    0x017290E5U,
+    0x017290F9U,
+    0x01729493U,
+    0x01729499U,
+    0x01729565U,
+    0x01729573U,
+    0x01729593U,
+    0x017295B3U,
+    0x017295D3U,
+    0x017295D9U,
+    0x01729613U,
+    0x01729619U,
+    0x01729674U,
+    0x01729685U,
+    0x01729693U,
+    0x01729A85U,
+    0x01729A93U,
+    0x0172A493U,
+    0x0172A4E8U,
+    0x0172A593U,
+    0x0172A644U,
+    0x0172A653U,
+    0x0172A665U,
+    0x0172A745U,
+    0x0172AC33U,
+    0x0172B068U,
+    0x0172B093U,
+    0x0172B165U,
+    0x0172B173U,
+    0x0172B174U,
+    0x0172B193U,
+    0x0172B199U,
+    0x0172B268U,
+    0x0172B293U,
+    0x0172B453U,
+    0x0172B893U,
+    0x0172B8E5U,
+    0x0172B9D9U,
+    0x0172BA93U,
+    0x0172C9F3U,
+    0x0172CA68U,
+    0x0172CE93U,
+    0x0172D033U,
+    0x0172D199U,
+    0x0172E0A4U,
+    0x0172E0B3U,
+    0x0174046BU,
+    0x01740585U,
+    0x017405AFU,
+    0x017405B3U,
+    0x017405C7U,
+    0x01740613U,
+    0x01740645U,
+    0x01740646U,
+    0x01740681U,
+    0x01740693U,
+    0x017406B0U,
+    0x017406B2U,
+    0x0174142CU,
+    0x01741432U,
+    0x01741434U,
+    0x017414ACU,
+    0x017414AEU,
+    0x017414B0U,
+    0x017414D4U,
+    0x0174158BU,
+    0x0174158DU,
+    0x01741590U,
+    0x017415D3U,
+    0x01741645U,
+    0x01741693U,
+    0x017416F3U,
+    0x01741733U,
+    0x01742468U,
+    0x01742493U,
+    0x017424C6U,
+    0x017424D4U,
+    0x017424F3U,
+    0x01742585U,
+    0x0174258BU,
+    0x017425B3U,
+    0x017425C5U,
+    0x017425D3U,
+    0x017425D9U,
+    0x017425F3U,
+    0x01742613U,
+    0x01742614U,
+    0x0174264CU,
+    0x01742652U,
+    0x01742653U,
+    0x01742668U,
+    0x0174266BU,
+    0x01742673U,
+    0x01742674U,
+    0x01742685U,
+    0x01742693U,
+    0x01742699U,
+    0x0174275AU,
+    0x01743D85U,
+    0x01743DB0U,
+    0x01743DE6U,
+    0x01743DF0U,
+    0x01743DF4U,
+    0x01743E13U,
+    0x01743E4CU,
+    0x01743E54U,
+    0x01743E65U,
+    0x01743E6FU,
+    0x01743EF3U,
+    0x017455B0U,
+    0x01745613U,
+    0x01746481U,
+    0x01748C61U,
+    0x01748D73U,
+    0x01748D79U,
+    0x01749099U,
+    0x017490AEU,
+    0x017490B2U,
+    0x017490B3U,
+    0x017491F7U,
+    0x01749288U,
+    0x01749584U,
+    0x01749593U,
+    0x017498A4U,
+    0x017498B3U,
+    0x017498B9U,
+    0x01749925U,
+    0x01749A99U,
+    0x01749C2EU,
+    0x01749CE1U,
+    0x01749CF9U,
+    0x01749D14U,
+    0x0174AD33U,
+    0x0174B06FU,
+    0x0174B093U,
+    0x0174B0A4U,
+    0x0174B0B3U,
+    0x0174B0E1U,
+    0x0174B133U,
+    0x0174B141U,
+    0x0174B193U,
+    0x0174B199U,
+    0x0174B293U,
+    0x0174B613U,
+    0x0174B619U,
+    0x0174B865U,
+    0x0174B868U,
+    0x0174B893U,
+    0x0174B899U,
+    0x0174B8A4U,
+    0x0174B8B3U,
+    0x0174B8B9U,
+    0x0174B8E5U,
+    0x0174B8F3U,
+    0x0174B8F9U,
+    0x0174B973U,
+    0x0174B9C1U,
+    0x0174B9D3U,
+    0x0174B9F3U,
+    0x0174BB45U,
+    0x0174C0A4U,
+    0x0174C0B2U,
+    0x0174C0B3U,
+    0x0174C8A4U,
+    0x0174C8B2U,
+    0x0174C8B3U,
+    0x0174CA41U,
+    0x0174CCA4U,
+    0x0174CCB2U,
+    0x0174CCB3U,
+    0x0174CD01U,
+    0x0174CD14U,
+    0x0174CE13U,
+    0x0174CE19U,
+    0x0174CE93U,
+    0x0174D02EU,
+    0x0174D068U,
+    0x0174D0A4U,
+    0x0174D0B3U,
+    0x0174D105U,
+    0x0174D113U,
+    0x0174D119U,
+    0x0174D299U,
+    0x0174D8A4U,
+    0x0174D8B2U,
+    0x0174D8B3U,
+    0x0174E8AEU,
+    0x0174E8B3U,
+    0x01778493U,
+    0x01778584U,
+    0x01778D73U,
+    0x017790E5U,
+    0x01779AACU,
+    0x0177AAB3U,
+    0x0177ACAEU,
+    0x0177ACB2U,
+    0x0177AD61U,
+    0x0177B093U,
+    0x0177B0D3U,
+    0x0177B199U,
+    0x0177B2C5U,
+    0x0177B42EU,
+    0x0177B453U,
+    0x0177B459U,
+    0x0177B4AEU,
+    0x0177B72EU,
+    0x0177B8E1U,
+    0x0177B8E9U,
+    0x0177B973U,
+    0x0177B979U,
+    0x0177BA93U,
+    0x0177BC93U,
+    0x0177BC99U,
+    0x0177BCA4U,
+    0x0177BCB2U,
+    0x0177BCD3U,
+    0x0177BCD9U,
+    0x0177BD84U,
+    0x0177BD93U,
+    0x0177BD99U,
+    0x0177BDD3U,
+    0x0177BE13U,
+    0x0177BE19U,
+    0x0177BE65U,
+    0x0177BE68U,
+    0x0177BE9AU,
+    0x0177BF59U,
+    0x0177C893U,
+    0x0177C899U,
+    0x0177C973U,
+    0x0177C984U,
+    0x0177C9B3U,
+    0x0177C9B9U,
+    0x0177CA59U,
+    0x0177CA65U,
+    0x0177CA74U,
+    0x0177CA88U,
+    0x0177CA93U,
+    0x0177D584U,
+    0x0177D5C4U,
+    0x0177D8AEU,
+    0x0177DCA4U,
+    0x0177DCA5U,
+    0x0177E0AEU,
+    0x0179046BU,
+    0x017905C7U,
+    0x01790613U,
+    0x01790614U,
+    0x01790674U,
+    0x01790685U,
+    0x01790688U,
+    0x017906ECU,
+    0x0179142BU,
+    0x0179146BU,
+    0x017915D3U,
+    0x01791674U,
+    0x0179246BU,
+    0x017924A4U,
+    0x017924B2U,
+    0x017924B3U,
+    0x017925C7U,
+    0x01792674U,
+    0x01792685U,
+    0x01792693U,
+    0x01793D65U,
+    0x01793DC7U,
+    0x01793DF4U,
+    0x01793E85U,
+    0x01793E88U,
+    0x017955C7U,
+    0x017964B2U,
+    0x01796599U,
+    0x017A9099U,
+    0x017A92B3U,
+    0x017AB193U,
+    0x017ACA74U,
+    0x017ACCB3U,
+    0x017ACD15U,
+    0x017ACE79U,
+    0x017AE121U,
+    0x017CB0A4U,
+    0x017CB0B3U,
+    0x017CB893U,
+    0x017CB9D3U,
+    0x017CD0A4U,
+    0x017CD0B3U,
+    0x018288A3U,
+    0x0182B921U,
+    0x0182B923U,
+    0x0182B9EEU,
+    0x0182C923U,
+    0x0182C9F8U,
+    0x0182CAB3U,
+    0x018785C1U,
+    0x01890733U,
+    0x018CB02EU,
+    0x018CB0ADU,
+    0x018CB123U,
+    0x018CB1ECU,
+    0x018CB32CU,
+    0x018CCE89U,
+    0x018CCE93U,
+    0x01908653U,
+    0x01908833U,
+    0x01908841U,
+    0x01908859U,
+    0x01908C61U,
+    0x01908D14U,
+    0x01908D61U,
+    0x01908D73U,
+    0x019098D3U,
+    0x01909CB2U,
+    0x01909CB3U,
+    0x01909D33U,
+    0x0190A1EFU,
+    0x0190A644U,
+    0x0190AD61U,
+    0x0190ADF7U,
+    0x0190B0B3U,
+    0x0190B4AEU,
+    0x0190B619U,
+    0x0190B6AEU,
+    0x0190B8F3U,
+    0x0190B973U,
+    0x0190C1EBU,
+    0x0190C1EEU,
+    0x0190C213U,
+    0x0190C219U,
+    0x0190C82BU,
+    0x0190C86FU,
+    0x0190C893U,
+    0x0190C8B2U,
+    0x0190C8C1U,
+    0x0190C973U,
+    0x0190C9D3U,
+    0x0190CA53U,
+    0x0190CA81U,
+    0x0190CA8FU,
+    0x0190D0B3U,
+    0x0190D493U,
+    0x0190D584U,
+    0x0190D613U,
+    0x0190DCA4U,
+    0x0190DCB9U,
+    0x0190DD93U,
+    0x0190DDD3U,
+    0x0190DDD9U,
+    0x0190DE13U,
+    0x01913E45U,
+    0x0191B024U,
+    0x0191B0A4U,
+    0x0191BDC4U,
+    0x01924824U,
+    0x019248A4U,
+    0x01928493U,
+    0x01928513U,
+    0x0192858DU,
+    0x019285D3U,
+    0x01928644U,
+    0x0192864EU,
+    0x01928653U,
+    0x01928674U,
+    0x01928C68U,
+    0x01928D13U,
+    0x01928D19U,
+    0x019290B3U,
+    0x01929493U,
+    0x01929668U,
+    0x01929CF3U,
+    0x0192B173U,
+    0x0192B193U,
+    0x0192B1B3U,
+    0x0192B213U,
+    0x0192B293U,
+    0x0192BA81U,
+    0x0192BA85U,
+    0x0192C841U,
+    0x0192C893U,
+    0x0192C973U,
+    0x0192CCB3U,
+    0x0192CD73U,
+    0x0192CE93U,
+    0x0192CE99U,
+    0x0192D133U,
+    0x0192D293U,
+    0x0192D573U,
+    0x0192D579U,
+    0x0192D8AEU,
+    0x0192D8B3U,
+    0x0192DCAEU,
+    0x0192E0A4U,
+    0x0192E0B3U,
+    0x01931645U,
+    0x01949584U,
+    0x0194ACA4U,
+    0x0194ACB3U,
+    0x0194B193U,
+    0x0194B865U,
+    0x0194C0B3U,
+    0x0194C219U,
+    0x0194C893U,
+    0x0194C973U,
+    0x0194CA53U,
+    0x0194CA88U,
+    0x0194D0B3U,
+    0x0194D125U,
+    0x019615B3U,
+    0x01962565U,
+    0x01962CB3U,
+    0x0196BD94U,
+    0x0196C0B3U,
+    0x0197884FU,
+    0x01978859U,
+    0x01978D73U,
+    0x019790ACU,
+    0x01979113U,
+    0x01979185U,
+    0x01979C33U,
+    0x01979CA5U,
+    0x01979D13U,
+    0x01979D23U,
+    0x01979D2EU,
+    0x01979D33U,
+    0x0197A46BU,
+    0x0197A82EU,
+    0x0197ACA4U,
+    0x0197ACACU,
+    0x0197ACB2U,
+    0x0197ACB3U,
+    0x0197AEACU,
+    0x0197B173U,
+    0x0197B179U,
+    0x0197B52DU,
+    0x0197B613U,
+    0x0197B923U,
+    0x0197B933U,
+    0x0197B973U,
+    0x0197BCD3U,
+    0x0197BE13U,
+    0x0197C8B3U,
+    0x0197C973U,
+    0x0197CA13U,
+    0x0197D573U,
+    0x0197D5C7U,
+    0x0197D64EU,
+    0x0197D653U,
+    0x0197D654U,
+    0x0197D665U,
+    0x0197D688U,
+    0x0197DCA4U,
+    0x0197DCB3U,
+    0x0197DD25U,
+    0x0197DD93U,
+    0x0197DF41U,
+    0x01990614U,
+    0x019915D4U,
+    0x019926C4U,
+    0x019938A8U,
+    0x019985A5U,
+    0x019A3E74U,
+    0x019A85D3U,
+    0x019A8C33U,
+    0x019A8C61U,
+    0x019A8C68U,
+    0x019A8D6FU,
+    0x019A8D73U,
+    0x019A8D79U,
+    0x019A9A93U,
+    0x019A9C33U,
+    0x019AACA4U,
+    0x019AACB3U,
+    0x019AAD79U,
+    0x019AADF3U,
+    0x019AB02EU,
+    0x019AB0B3U,
+    0x019AB5AFU,
+    0x019AB5B9U,
+    0x019AB613U,
+    0x019AC1EEU,
+    0x019AC219U,
+    0x019ACA81U,
+    0x019ACA93U,
+    0x019AEAB3U,
+    0x01A08A41U,
+    0x01A08D73U,
+    0x01A0A481U,
+    0x01A0A499U,
+    0x01A0A645U,
+    0x01A0AC34U,
+    0x01A0B42EU,
+    0x01A0B44FU,
+    0x01A0B521U,
+    0x01A0B941U,
+    0x01A0BA85U,
+    0x01A0BB41U,
+    0x01A0BB45U,
+    0x01A0C219U,
+    0x01A0C8D3U,
+    0x01A0C933U,
+    0x01A0D133U,
+    0x01A0E0B3U,
+    0x01A0E52EU,
+    0x01A0E8AEU,
+    0x01A28593U,
+    0x01A288A3U,
+    0x01A28A41U,
+    0x01A28AA2U,
+    0x01A28AB3U,
+    0x01A29033U,
+    0x01A2A5D3U,
+    0x01A2B88FU,
+    0x01A2C881U,
+    0x01A2C973U,
+    0x01A2C9F3U,
+    0x01A2CE93U,
+    0x01A2CE99U,
+    0x01A2D033U,
+    0x01A2E0B3U,
+    0x01A2E8B3U,
+    0x01A43DAFU,
+    0x01A488B4U,
+    0x01A498D3U,
+    0x01A49C2EU,
+    0x01A4B033U,
+    0x01A4B068U,
+    0x01A4B181U,
+    0x01A4B193U,
+    0x01A4B449U,
+    0x01A4B453U,
+    0x01A4B86FU,
+    0x01A4B873U,
+    0x01A4B879U,
+    0x01A4B8A2U,
+    0x01A4B8B3U,
+    0x01A4B8F3U,
+    0x01A4B8F9U,
+    0x01A4B965U,
+    0x01A4B979U,
+    0x01A4C20FU,
+    0x01A4C219U,
+    0x01A4C82DU,
+    0x01A4D133U,
+    0x01A4E8ACU,
+    0x01A4E934U,
+    0x01A63E85U,
+    0x01A63E99U,
+    0x01A784A1U,
+    0x01A789F3U,
+    0x01A78AB3U,
+    0x01A78C6FU,
+    0x01A79425U,
+    0x01A7942CU,
+    0x01A79433U,
+    0x01A7A66DU,
+    0x01A7A674U,
+    0x01A7B449U,
+    0x01A7B825U,
+    0x01A7B82CU,
+    0x01A7B881U,
+    0x01A7B8A4U,
+    0x01A7B8B2U,
+    0x01A7B8B3U,
+    0x01A7B973U,
+    0x01A7BCA1U,
+    0x01A7BCB9U,
+    0x01A7BD24U,
+    0x01A7BD73U,
+    0x01A7BDB3U,
+    0x01A7BDD3U,
+    0x01A7BE99U,
+    0x01A7C201U,
+    0x01A7C20FU,
+    0x01A7C92CU,
+    0x01A7C933U,
+    0x01A7CA4FU,
+    0x01A7D573U,
+    0x01A7DCA5U,
+    0x01A7DD25U,
+    0x01AAB2B3U,
+    0x01AAC02EU,
+    0x01AAC033U,
+    0x01AAC201U,
+    0x01AAC8D3U,
+    0x01AAE92DU,
+    0x01AC9C2CU,
+    0x01AC9DEEU,
+    0x01ACB4B3U,
+    0x01ACB523U
 };
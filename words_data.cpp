@@ -4,9 +4,32 @@
 #include <cctype>
 #include <fstream>
 #include <iostream>
+#include <type_traits>
 
 #include "word_lists.h"
 
+namespace {
+
+static_assert(std::is_same_v<std::remove_cv_t<std::remove_extent_t<
+                                 decltype(kEncodedWords)>>,
+                             encoded_word>,
+              "kEncodedWords must hold encoded_word values");
+
+constexpr bool strictly_ascending(const encoded_word *words, size_t count) {
+  for (size_t i = 1; i < count; ++i) {
+    if (words[i - 1] >= words[i])
+      return false;
+  }
+  return true;
+}
+
+// WordIndex binary-searches the embedded list in place, so word_lists.h must
+// keep it sorted (alphabetical order is ascending encoded order).
+static_assert(strictly_ascending(kEncodedWords, kWordsCount),
+              "kEncodedWords must be strictly ascending");
+
+} // namespace
+
 std::string decode_word(encoded_word encoded) {
   std::string word = "     ";
   for (int i = 4; i >= 0; --i) {
@@ -75,3 +98,15 @@ const std::vector<uint32_t> &load_word_weights() {
       compute_word_weights(load_words());
   return weights;
 }
+
+uint64_t hash_word_list(const std::vector<encoded_word> &words) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const auto word : words) {
+    const uint32_t value = static_cast<uint32_t>(word);
+    for (int shift = 0; shift < 32; shift += 8) {
+      hash ^= (value >> shift) & 0xFF;
+      hash *= 0x100000001b3ULL;
+    }
+  }
+  return hash;
+}
@@ -6,7 +6,8 @@
 
 #include "solver_types.h"
 
-// Encodes a 5-letter word into a 64-bit integer with 5 bits per letter.
+// Encodes a 5-letter word into an encoded_word (uint32_t): 5 bits per letter,
+// first letter highest, so only the low 25 bits are used.
 constexpr encoded_word encode_word(std::string_view word) {
   encoded_word encoded = 0;
   for (const char c : word) {
@@ -27,5 +28,9 @@ std::vector<encoded_word> load_words_from_file(const std::string &path);
 std::vector<uint32_t> compute_word_weights(const std::vector<encoded_word> &words);
 const std::vector<uint32_t> &load_word_weights();
 
+// FNV-1a over the 25-bit word codes (4 little-endian bytes each, in order).
+// Identifies the vocabulary a serialized asset was built against.
+uint64_t hash_word_list(const std::vector<encoded_word> &words);
+
 inline constexpr encoded_word kInitialGuess = encode_word("roate");
 inline constexpr std::string_view kFeedbackTablePath = "feedback_table.bin";